@@ -29,6 +29,7 @@
 #include "Infrastructure/GameInformation/GameInformation.h"
 #include "Infrastructure/NUSensorsData/NUSensorsData.h"
 #include "Tools/Math/General.h"
+#include "Behaviour/NavigationKernel.h"
 
 #include "debug.h"
 #include "debugverbositybehaviour.h"
@@ -40,8 +41,35 @@
 class BehaviourPotentials 
 {
 public:
-    
-    
+    /*! @brief Returns this robot's navigation state, which holds the turning hysteresis of goToPoint, goToPointBackwards
+               and goToBallDirectWithSidewardsKick between calls
+     */
+    static NavigationState& getNavigationState()
+    {
+        static NavigationState state;
+        return state;
+    }
+
+    /*! @brief Fills obstacles with the obstacles among the ambiguous field objects, and returns how many there are
+        @param obstacles space for NavigationKernel::MaxObstacles obstacles; any more than that are ignored
+     */
+    static unsigned int getObstacles(NavigationObstacle* obstacles)
+    {
+        std::vector<AmbiguousObject>& objects = Blackboard->Objects->ambiguousFieldObjects;
+        unsigned int num_obstacles = 0;
+        for (size_t i=0; i<objects.size() and num_obstacles < NavigationKernel::MaxObstacles; i++)
+        {
+            if (objects[i].isObjectAPossibility(FieldObjects::FO_OBSTACLE))
+            {
+                obstacles[num_obstacles].distance = objects[i].measuredDistance();
+                obstacles[num_obstacles].bearing = objects[i].measuredBearing();
+                obstacles[num_obstacles].arc_width = objects[i].arc_width;
+                num_obstacles++;
+            }
+        }
+        return num_obstacles;
+    }
+
     /*! @brief Returns a vector to go to a field state 
         @param distance to the distance to the point
         @param bearing to the point
@@ -52,86 +80,10 @@ public:
      */
     static std::vector<float> goToPointBackwards(float distance, float bearing, float heading, float stoppeddistance = 10.f, float stoppingdistance = 50, float turningdistance = 70)
     {
-        static const float m_HYSTERESIS = 0.15;      // the fraction of hysteresis in the turning point toward the desired heading
-        static double m_previous_time = 0;          // the previous time in ms
-        static bool m_previous_turning = false;     // the previous turning state; used to implement hysteresis in the decision to turn around.
-        static bool m_turning_left = false; 
-        //bearing = mathGeneral::normaliseAngle(bearing+3.1416);
-        Self self = Blackboard->Objects->self;
-        std::vector<float> result(3,0);
-        
-        
-    
-        
-        
-        
-        if (fabs(bearing) > 0.4 or (fabs(bearing) > m_HYSTERESIS and m_previous_turning)) { //turn with hysteresis
-            m_previous_turning = true;
-            if (bearing > 0. and bearing < 2.6 and distance > stoppeddistance) {
-                result[2] = bearing*1.0;
-                m_turning_left = true;
-            } else if (bearing <= 0. and bearing > -2.6 and distance > stoppeddistance) {
-                result[2] = bearing*0.8;
-                m_turning_left = false;
-            } else if (distance < stoppeddistance) {
-                result[2] = heading*0.6;
-            } else if (m_turning_left) {
-                result[2] = 1.f;
-            } else if (not m_turning_left) {
-                result[2] = -1.f;
-            }
-            result[0] = -0.01f;
-        } else { //run forward
-            m_previous_turning = false;
-            if (distance > stoppingdistance) {
-                result[0] = 1.0;
-            } else if (distance > stoppingdistance/2.f) {
-                result[0] = 0.7;
-            } else if (distance > stoppeddistance) {
-                result[0] = 0.25;
-            } else {
-                result[2] = heading*0.5;
-            }
-            /*if (distance < stoppingdistance) {
-                result[1] = bearing;
-                }*/
-        }
-        
-        //std::cout << result[0] << ", " << result[1] << ", " << result[2] << std::endl;
-        //std::cout << distance << ", " << bearing << ", " << heading << std::endl;
-       /* if (Blackboard->Sensors->CurrentTime - m_previous_time > 500)
-        {
-            m_previous_turning = false;
-        }
-        
-        if (distance > stoppeddistance or fabs(heading) > 0.05)
-        {
-            // calculate the translational speed
-            if (distance < stoppingdistance)
-                result[0] = distance/stoppingdistance;
-            else
-                result[0] = 1;
-            
-            // calculate the translational direction
-            //result[1] = bearing;
-            
-            // calculate the rotational speed
-            if (bearing > 0.1 or (m_previous_turning and bearing < .1+m_HYSTERESIS))
-            {   // We use a bit of hysteresis in the turning point, once the turn has started its best to stick with it
-                if (fabs(heading) > 3)
-                    heading = fabs(heading);
-                result[2] = 0.5*heading;
-                result[0] = 0.;
-                m_previous_turning = true;
-            }
-            else
-            {
-                result[2] = 0.f;//5*bearing;
-                m_previous_turning = false;
-            }
-        }
-        m_previous_time = Blackboard->Sensors->CurrentTime;*/
-        return result;
+        NavigationTarget target = {distance, bearing, heading};
+        NavigationVector speed;
+        NavigationKernel::goToPointBackwards(getNavigationState(), target, stoppeddistance, stoppingdistance, speed);
+        return speed.toVector();
     }
 
     /*! @brief Returns a vector to go to a field state 
@@ -157,96 +109,12 @@ public:
      */
     static std::vector<float> goToPoint(float distance, float bearing, float heading, float stoppeddistance = 4.f, float stoppingdistance = 50, float turningdistance = 70)
     {
-        static const float m_HYSTERESIS = 0.1;      // the fraction of hysteresis in the turning point toward the desired heading
-        static double m_previous_time = 0;          // the previous time in ms
-        static bool m_previous_turning = false;     // the previous turning state; used to implement hysteresis in the decision to turn around.
-        static bool m_turning_left = false; 
-        
-        Self self = Blackboard->Objects->self;
-        std::vector<float> result(3,0);
-        
-        //Modify bearing based on objects in the way
-        std::vector<AmbiguousObject> objects = Blackboard->Objects->ambiguousFieldObjects;
-        float goaldistance = 80.f;
-
-        for(unsigned int i=0; i<objects.size(); i++) { //for each object
-            if (objects[i].isObjectAPossibility(FieldObjects::FO_OBSTACLE) and objects[i].measuredDistance() < goaldistance) { //if we are an obstacle
-                if (objects[i].measuredBearing() > bearing and objects[i].measuredBearing()-objects[i].arc_width < bearing) { //if we are on the right and occluding
-                    bearing = objects[i].measuredBearing()-objects[i].arc_width;
-                } else if (objects[i].measuredBearing() < bearing and objects[i].measuredBearing()+objects[i].arc_width > bearing) { //if we are on the left and occluding
-                    bearing = objects[i].measuredBearing()+objects[i].arc_width;
-                }
-            }
-        }
-        
-        
-        
-        if (fabs(bearing) > 0.3 or (fabs(bearing) > m_HYSTERESIS and m_previous_turning and distance > stoppeddistance*1.5)) { //turn with hysteresis
-            m_previous_turning = true;
-            if (bearing > 0. and bearing < 2.6) {
-                result[2] = bearing*0.5;
-                m_turning_left = true;
-            } else if (bearing <= 0. and bearing > -2.6) {
-                result[2] = bearing*0.5;
-                m_turning_left = false;
-            } else if (distance < stoppeddistance) {
-                result[2] = heading*0.5;
-            } else if (m_turning_left) {
-                result[2] = 1.f;
-            } else if (not m_turning_left) {
-                result[2] = -1.f;
-            }
-            result[0] = -0.1f;
-        } else { //run forward
-            m_previous_turning = false;
-            if (distance > stoppingdistance) {
-                result[0] = 1.0;
-            } else if (distance > stoppingdistance/2.f) {
-                result[0] = 0.65;
-            } else if (distance > stoppeddistance) {
-                result[0] = 0.25;
-            } else {
-                result[2] = heading*0.5;
-                result[1] = mathGeneral::PI/2.f*mathGeneral::sign(-heading);
-                result[0] = 0.1;
-            }
-        }
-        
-        //std::cout << result[0] << ", " << result[1] << ", " << result[2] << std::endl;
-        //std::cout << distance << ", " << bearing << ", " << heading << std::endl;
-       /* if (Blackboard->Sensors->CurrentTime - m_previous_time > 500)
-        {
-            m_previous_turning = false;
-        }
-        
-        if (distance > stoppeddistance or fabs(heading) > 0.05)
-        {
-            // calculate the translational speed
-            if (distance < stoppingdistance)
-                result[0] = distance/stoppingdistance;
-            else
-                result[0] = 1;
-            
-            // calculate the translational direction
-            //result[1] = bearing;
-            
-            // calculate the rotational speed
-            if (bearing > 0.1 or (m_previous_turning and bearing < .1+m_HYSTERESIS))
-            {   // We use a bit of hysteresis in the turning point, once the turn has started its best to stick with it
-                if (fabs(heading) > 3)
-                    heading = fabs(heading);
-                result[2] = 0.5*heading;
-                result[0] = 0.;
-                m_previous_turning = true;
-            }
-            else
-            {
-                result[2] = 0.f;//5*bearing;
-                m_previous_turning = false;
-            }
-        }
-        m_previous_time = Blackboard->Sensors->CurrentTime;*/
-        return result;
+        NavigationObstacle obstacles[NavigationKernel::MaxObstacles];
+        unsigned int num_obstacles = getObstacles(obstacles);
+        NavigationTarget target = {distance, bearing, heading};
+        NavigationVector speed;
+        NavigationKernel::goToPoint(getNavigationState(), target, obstacles, num_obstacles, stoppeddistance, stoppingdistance, speed);
+        return speed.toVector();
     }
     
     /*! @brief Returns a vector to avoid a field state 
@@ -257,47 +125,19 @@ public:
      */
     static std::vector<float> avoidFieldState(Self& self, std::vector<float>& fieldstate, float objectsize = 25, float dontcaredistance = 100)
     {
-        std::vector<float> result(3,0);
         if (fieldstate.size() < 3)
             fieldstate.push_back(0);
         std::vector<float> relativestate = self.CalculateDifferenceFromFieldState(fieldstate);
-        
-        float distance = relativestate[0];
-        float bearing = relativestate[1];
-        
-        if (distance > dontcaredistance)
-        {   // if the object is too far away don't avoid it
-            return result;
-        }
-        else
-        {
-            // calculate the translational speed --- max if inside the object and reduces to zero at dontcaredistance
-            if (distance < objectsize)
-                result[0] = 1;
-            else
-                result[0] = (distance - dontcaredistance)/(objectsize - dontcaredistance);
-            // calculate the translational bearing --- away
-            if (fabs(bearing) < 0.1)
-                result[1] = mathGeneral::PI/2;
-            else
-                result[1] = bearing - mathGeneral::sign(bearing)*mathGeneral::PI/2;
-            // calculate the rotational speed --- spin facing object if infront, spin away if behind
-            float y = distance*sin(bearing);
-            float x = distance*cos(bearing);
-            if (fabs(y) < objectsize)
-                result[2] = atan2(y - mathGeneral::sign(y)*objectsize, x);
-            else
-                result[2] = 0;
-            
-            return result;
-        }
+
+        NavigationVector speed;
+        NavigationKernel::avoidPoint(relativestate[0], relativestate[1], objectsize, dontcaredistance, speed);
+        return speed.toVector();
     }
 
     /*! @brief Returns a vector to go to a ball
      */
     static std::vector<float> goToBallDirectWithSidewardsKick(MobileObject& ball, Self& self, float heading, float kickingdistance = 15.0, float stoppingdistance = 65)
     {
-        std::vector<float> speed(3, 0.0f);  // [Magnitude, Direction, Rotation]
 
         float ballx, bally;
         ballx = ball.X();
@@ -419,272 +259,27 @@ public:
         //std::cout << "Ball Goal Bearing: " << fwd_angle << "\tkick orientation: " << best_kicking_orientation << std::endl;
         //std::cout << "Goal RelX: " << goalx-my_x << "\tGoal RelY: " << goaly-my_y << "\tBall Distance: " << ball_distance << std::endl;
 
-        static bool turning = false;
-        static bool turningLeft = false;
-        float target_heading = (ball_distance > stoppingdistance) ? angle_to_kick_pos : ball_bearing; //angle_to_aim_pos;
-        
-        //Bearing Alteration
-        std::vector<AmbiguousObject> objects = Blackboard->Objects->ambiguousFieldObjects;
-
-        for(unsigned int i=0; i<objects.size(); i++) { //for each object
-            if (objects[i].isObjectAPossibility(FieldObjects::FO_OBSTACLE) and objects[i].measuredDistance() > ball_distance) { //if we are an obstacle
-                if (objects[i].measuredBearing() > target_heading and objects[i].measuredBearing()-objects[i].arc_width < target_heading) { //if we are on the right and occluding
-                    target_heading = objects[i].measuredBearing()-objects[i].arc_width;
-                } else if (objects[i].measuredBearing() < target_heading and objects[i].measuredBearing()+objects[i].arc_width > target_heading) { //if we are on the left and occluding
-                    target_heading = objects[i].measuredBearing()+objects[i].arc_width;
-                }
-            }
-        }
-        
-        //change bearing to align to ball
-        if (fabs(ball_bearing) < 0.3) {
-            std::vector<float> goalPosition(3,0);
-            float bearingLineUpSide = 0.4;
-            float bearingLineUpFront = 0.45;
-            goalPosition = self.CalculateDifferenceFromGoal(getOpponentGoal(Blackboard->Objects, Blackboard->GameInfo));
-            if (goalPosition[1] > mathGeneral::PI/4.f) { //to our left > 45 degrees
-                ball_bearing -= bearingLineUpSide*(kickingdistance-2.)/ball_distance;
-            } else if (goalPosition[1] < -mathGeneral::PI/4.f) { //to our right > 45 degrees
-                ball_bearing += bearingLineUpSide*(kickingdistance-2.)/ball_distance;
-            } else {
-                ball_bearing += mathGeneral::sign(ball_bearing)*bearingLineUpFront*(kickingdistance-2.)/ball_distance;
-            }
-        }
-        
-        //hysteresis for 180 degrees out of phase
-        if (target_heading > 0.f and target_heading < 3.f) {
-            turningLeft = true;
-        } else if (target_heading < 0.f and target_heading > -3.f) {
-            turningLeft = false;
-        }
-        if (turningLeft and target_heading < 0. or (not turningLeft) and target_heading > 0.) {
-            target_heading *= -1.f;
-        }
+        float goal_bearing = 0;
+        if (fabs(ball_bearing) < 0.3)
+            goal_bearing = self.CalculateDifferenceFromGoal(getOpponentGoal(Blackboard->Objects, Blackboard->GameInfo))[1];
 
-        if(turning and 
-            (fabs(target_heading) < 0.1 or fabs(target_heading) < 0.3 and ball_distance > stoppingdistance/2.))
-        {
-            turning = false;
-        }
-        else if (not turning and fabs(target_heading) > 0.5)
-        {
-            turning = true;
-        }
-
-        if(turning)
-        {
-            speed[0] = 0.03f; // 10% speed
-            speed[1] = -mathGeneral::sign(target_heading)*3.1;
-            speed[2] = 0.6*target_heading;
-            if (ball_distance < kickingdistance * 1.5) {
-                speed[2] = 0.3*target_heading;
-            }
-            /*
-            std::cout << "Calculated heading: " << -atan2(y_diff, x_diff) << std::endl;
-            std::cout << "My heading: " << my_heading << std::endl;
-            std::cout << "Heading to Ball: " << ball_bearing << std::endl;
-            std::cout << "Ball Position: (" << ballx << ", " << bally << ")" << std::endl;
-            std::cout << "Kick Position: (" << best_kicking_pos_x << ", " << best_kicking_pos_y << ")" << std::endl;
-            std::cout << angle_to_kick_pos << std::endl;
-            std::cout << "Turning." << std::endl;*/
-        }
-        else if(ball_distance > stoppingdistance)
-        {
-            // Full speed ahead!
-            speed[0] = 1.0f; // 100% speed.
-            speed[1] = 0.0f;    // Straight
-            speed[2] = 0.0f;    // Straight
-//            std::cout << "Walking." << std::endl;
-        } else if (ball_distance > kickingdistance) {
-            speed[0] = 0.5f; // 100% speed.
-            speed[1] = 0.2*ball_bearing;    // Straight
-            speed[2] = 0.0f;    // Straight
-        
-        } else {
-            speed[2] = 0.2*ball_bearing;
-        }
-        //std::cout << speed[0] << ", " << speed[1] << ", " << speed[2] << std::endl;
-        return speed;
+        NavigationObstacle obstacles[NavigationKernel::MaxObstacles];
+        unsigned int num_obstacles = getObstacles(obstacles);
+        NavigationVector speed;
+        NavigationKernel::goToKickPosition(getNavigationState(), angle_to_kick_pos, ball_distance, ball_bearing, goal_bearing, obstacles, num_obstacles, kickingdistance, stoppingdistance, speed);
+        return speed.toVector();
     }
 
     /*! @brief Returns a vector to go to a ball
      */
     static std::vector<float> goToBall(MobileObject& ball, Self& self, float heading, float kickingdistance = 15.0, float stoppingdistance = 65)
     {
-        std::vector<float> ball_prediction = self.CalculateClosestInterceptToMobileObject(ball);
-        if (false)//ball_prediction[0] < 4 and ball.estimatedDistance() > 30)
-        {   // if the ball is moving go to where the ball will be!
-
-    
-            float x = ball_prediction[1];
-
-            float y = ball_prediction[2];
-            float distance = sqrt(x*x + y*y);
-            float bearing = atan2(y,x);
-            
-            std::vector<float> speed = goToPoint(distance, bearing, 0, 0, 0, distance+9000);
-            
-            #if DEBUG_BEHAVIOUR_VERBOSITY > 1
-                debug << "goToBall Predicated x:" << x << " y: " << y << " ballx: " << ball.estimatedDistance()*cos(heading) << " bally: " << ball.estimatedDistance()*sin(heading) << std::endl;
-            #endif
-            return speed;
-        }
-        else
-        {
-            float distance = ball.estimatedDistance(); //*cos(ball.estimatedElevation());
-            float bearing = ball.estimatedBearing();
-            
-
-
-
-
-            float x = distance * cos(bearing);
-            float y = distance * sin(bearing);
-            
-            float dist_hysteresis = 5.f;
-
-            
-            float offsetDistance = 3.0f;
-            
-            if (ball.isObjectVisible() and ball.TimeSeen() > 500.) {
-                bearing = ball.measuredBearing();
-                distance = ball.measuredDistance();//*cos(ball.measuredElevation();
-            }
-            
-            
-            float left_foot_x = x + offsetDistance * cos(heading - mathGeneral::PI/2);
-            float left_foot_y = y + offsetDistance * sin(heading - mathGeneral::PI/2);
-            float left_foot_distance = sqrt(pow(left_foot_x,2) + pow(left_foot_y,2));
-            
-            float right_foot_x = x + offsetDistance * cos(heading + mathGeneral::PI/2);
-            float right_foot_y = y + offsetDistance * sin(heading + mathGeneral::PI/2);
-            float right_foot_distance = sqrt(pow(right_foot_x,2) + pow(right_foot_y,2));
-      
-            if(left_foot_distance < right_foot_distance)
-            {   // if the calculated left foot position is closer, then pick that one
-                x = left_foot_x;
-                y = left_foot_y;
-            }
-            else
-            {
-                x = right_foot_x;
-                y = right_foot_y;
-            }
-            
-            /*float approachOffset = 20.;
-            if (Blackboard->GameInfo->getTeamColour() == GameInformation::BlueTeam and distance > (kickingdistance + approachOffset)) {
-                x -= approachOffset-dist_hysteresis;
-            } else if (distance > kickingdistance + approachOffset) {
-                x += approachOffset-dist_hysteresis;
-            }*/
-            
-            
-            
-
-            distance = sqrt(x*x + y*y);
-            bearing = atan2(y,x);
-
-            // calculate the component to position the ball at the kicking distance
-            float position_speed;
-            float position_direction;
-            float position_rotation;
-            if (distance < kickingdistance)
-            {   // if we are too close to the ball then we need to go backwards
-                position_speed = 0.1;//(kickingdistance - distance)/(kickingdistance);
-                position_direction = mathGeneral::normaliseAngle(bearing + mathGeneral::PI);
-                
-                //position_rotation = 0.5*bearing; //previous value for NAO
-                if (bearing < mathGeneral::PI/8.) {
-                    position_rotation = mathGeneral::sign(heading)*0.3;
-                } else if (bearing > mathGeneral::PI/3.) {
-                    position_rotation = mathGeneral::sign(bearing)*0.3;
-                } else {
-                    position_rotation = 0.;//mathGeneral::sign(bearing)*0.3;
-                }
-                //speed up if we're too slow at shuffling
-                /*if (fabs(bearing) > 0.8f and position_speed < 0.3 and fabs() ) {
-                    position_speed += 0.1;
-                } else if (fabs(bearing) > 1.0f and position_speed < 0.3) {
-                    position_speed += 0.15;
-                } */
-                
-            }
-            else if (distance < stoppingdistance)
-            {   // if we are close enough to slow down
-                
-                position_speed = (distance - kickingdistance+3.)/(stoppingdistance - kickingdistance+3.);
-                position_direction = bearing;
-                //position_rotation = 0.5*bearing; //previous value for NAO
-                position_rotation = 0.7*bearing;
-                
-                //added this to boost sidestepping ability when lining up
-                if (position_speed < 0.3 and fabs(bearing) < mathGeneral::PI/3.) {
-                    position_speed += 0.13;
-                }
-                
-            }
-            else
-            {   // if it is outside the stopping distance - full speed
-                if ( fabs (bearing) < 0.3 or (fabs (bearing) < 0.5) and distance > stoppingdistance) {
-                    position_speed = 1.0;
-                    position_direction = bearing*0.6;
-                    position_rotation = 0.;//6*bearing;
-                } else {
-                    position_speed = 0.2;
-                    position_direction = mathGeneral::normaliseAngle(bearing - mathGeneral::sign(heading)*mathGeneral::PI/2);
-                    position_rotation = 0.5*bearing;
-                }
-                //position_rotation = 0.5*bearing; //previous value for NAO
-            }
-            
-            // calculate the component to go around the ball to face the heading
-            std::vector<float> speed(3,0);
-            float around_speed;
-            float around_direction;
-            float around_rotation;
-            if (distance < stoppingdistance and distance > 1.5*kickingdistance or distance < 1.15*kickingdistance)
-            {   // if we are close enough to worry about the heading
-                float heading_gain = 0.5;
-                if (distance < 1.25*kickingdistance) {
-                    heading_gain = 0.2;
-                    }
-                const float heading_threshold = mathGeneral::PI/3;
-                if (fabs(heading) < heading_threshold)
-                    around_speed = (heading_gain/heading_threshold)*fabs(heading);
-                else
-                    around_speed = heading_gain;
-                if (fabs(heading) > 2.85)
-                    around_direction = mathGeneral::normaliseAngle(bearing + mathGeneral::PI/2);
-                else
-                    around_direction = mathGeneral::normaliseAngle(bearing - mathGeneral::sign(heading)*mathGeneral::PI/2);
-                //around_rotation = -mathGeneral::sign(around_direction)*around_speed*12/distance;        // previous value for NAO
-                around_rotation = -mathGeneral::sign(around_direction)*around_speed/distance/2.;        // 11 is rough speed in cm/s
-            }
-            else
-            {
-                around_speed = 0;
-                around_direction = 0;
-                around_rotation = 0;
-            }
-            
-            //std::vector<float> speed(3,0);
-            
-            
-            speed[0] = std::max(position_speed, around_speed);
-            //float xsum = position_speed*cos(position_direction) + around_speed*cos(around_direction);
-            //float ysum = position_speed*sin(position_direction) + around_speed*sin(around_direction);
-            speed[1] = (position_speed*position_direction + around_speed*around_direction)/(std::max(position_speed,0.3f)+around_speed);//atan2(ysum, xsum);
-            speed[2] = (position_speed*position_rotation + around_speed*around_rotation)/(position_speed+around_speed);
-            speed[2] = std::min(fabs(speed[2]), 0.3) * mathGeneral::sign(speed[2]);
-            
-            /*std::cout << std::endl;
-            std::cout << "Goal Heading: " << heading << "\tBall Distance: " << distance << std::endl;
-            std::cout << "Goto Speed:   " << position_speed << "\t" << position_direction << "\t" << position_rotation << "\t" << std::endl;
-            std::cout << "Around Speed: " << around_speed << "\t" << around_direction << "\t" << around_rotation << "\t" << std::endl;
-            std::cout << "Final Speed:  " << speed[0] << "\t" << speed[1] << "\t" << speed[2] << "\t" << std::endl;*/
-            return speed;
-        }
+        NavigationTarget target = {ball.estimatedDistance(), ball.estimatedBearing(), heading};
+        NavigationVector speed;
+        NavigationKernel::goToBall(target, kickingdistance, stoppingdistance, speed);
+        return speed.toVector();
     }
+
     
     /*! @brief Returns a the vector sum of the potentials
         @param potentials a list of [trans_speed, trans_direction, rot_speed] vectors
@@ -20,6 +20,8 @@
  */
 #include "HeadBehaviour.h"
 
+#include "debug.h"
+#include "debugverbositybehaviour.h"
 
 
 #include <vector>
@@ -63,11 +65,13 @@ HeadBehaviour::HeadBehaviour():Mrlagent(){
     NUCameraData cameraSpecs(std::string(CONFIG_DIR) + "CameraSpecs.cfg");
     m_CAMERA_FOV_X = cameraSpecs.m_horizontalFov;
     m_CAMERA_FOV_Y = cameraSpecs.m_verticalFov;
+    m_head_planner = new HeadPlanner(m_CAMERA_FOV_X, m_CAMERA_FOV_Y);
     landmarkSeenFrequency = 1200;
     ballSeenFrequency = 800;
     lastVisionPolicy = -1;
     maximumSearchTime = 1000.;
     CONFIRMATION_TIME = 250.;
+    m_head_planner->setTiming(0.1, CONFIRMATION_TIME/1000.);
     buttonPressTime = 0.;
     actionObjectID = -1;
     time_since_last_localisation = 0;
@@ -123,6 +127,7 @@ HeadBehaviour::HeadBehaviour():Mrlagent(){
   */
 HeadBehaviour::~HeadBehaviour(){
     Mrlagent.saveMRLAgent("HeadBehaviourMRL");
+    delete m_head_planner;
     delete head_logic;
 }
 
@@ -149,69 +154,48 @@ void HeadBehaviour::doPriorityListPolicy() {
         dispatchHeadJob(&(Blackboard->Objects->stationaryFieldObjects[ran]));
     }
 }
-/*! @brief Policy chooses lowest cost object not seen for longest time
+/*! @brief Policy looks at the object that starts the sequence of fixations collecting the most information per second of
+    head movement. The sequence is planned by m_head_planner from HeadLogic's interesting objects.
 */
 void HeadBehaviour::doTimeVSCostPriorityPolicy(){
-    //Do highest priority of HeadLogic's interesting objects. Priority = (time since last seen)/cost
-
     vector<float> times = head_logic->getTimeSinceLastSeenSummary();
-    vector<float> costs = head_logic->getCostList((float)1.0,(float)1.0);//Look at whole screen.
-
-
-    //Debug:
-    std::cout<<" HeadBehaviour::doTimeVSCostPriorityPolicy(): cost list = [";
-    for(int i = 0; i<costs.size(); i++){
-        std::cout<<" "<<costs[i]<<",";
-    }
-    std::cout<<"]"<<std::endl;
-    std::cout<<" HeadBehaviour::doTimeVSCostPriorityPolicy(): time since last seen list = [";
-    for(int i = 0; i<times.size(); i++){
-        std::cout<<" "<<times[i]<<",";
-    }
-    std::cout<<"]"<<std::endl;
-
-    vector<float> priorities(0);
-    if(times.size()==costs.size()){
-        for (int i = 0; i<times.size(); i++ ){
-            if(costs[i]==0.0){
-                priorities.push_back((float)0);//Don't look at something already in vision.
-            } else {
-                priorities.push_back((float)times[i]/costs[i]);
-            }
+    head_logic->getFixationSummary(m_fixation_yaws, m_fixation_pitches);
+
+    int number_of_objects = std::min((int)times.size(), (int)m_fixation_yaws.size());
+    int first_mobile = head_logic->relevantObjects[HeadLogic::STATIONARY_OBJECT].size();
+    int first_ambiguous = first_mobile + head_logic->relevantObjects[HeadLogic::MOBILE_OBJECT].size();
+    m_head_planner->setObjectCount(number_of_objects);
+    for (int i = 0; i < number_of_objects; i++){
+        if (i >= first_mobile and i < first_ambiguous){
+            m_head_planner->setObject(i, m_fixation_yaws[i], m_fixation_pitches[i], times[i], 1.0, ballSeenFrequency/1000.);
+        } else {
+            m_head_planner->setObject(i, m_fixation_yaws[i], m_fixation_pitches[i], times[i], 1.0, landmarkSeenFrequency/1000.);
         }
-    }else std::cout<<"HeadBehaviour::doTimeVSCostPriorityPolicy(): Times and costs different sizes()."<<std::endl;
-
-    std::cout<<" HeadBehaviour::doTimeVSCostPriorityPolicy(): priorities = [";
-    for(int i = 0; i<priorities.size(); i++){
-        std::cout<<" "<<priorities[i]<<",";
     }
-    std::cout<<"]"<<std::endl;
-
-    float bestPriority = 0;
-    int bestObject = 0;
-    //Find index of best priority Object
-    for (int i = 0; i< priorities.size();i++){
-        if (bestPriority<priorities[i]){
-            bestPriority = priorities[i];
-            bestObject = i;
-        }
+
+    float head_yaw = 0, head_pitch = 0;
+    Blackboard->Sensors->getPosition(NUSensorsData::HeadYaw, head_yaw);
+    Blackboard->Sensors->getPosition(NUSensorsData::HeadPitch, head_pitch);
+    int bestObject = m_head_planner->plan(head_yaw, head_pitch);
+    if (bestObject < 0){
+        //Nothing can be seen from any fixation
+        bestObject = 0;
     }
 
-    int ob_type = head_logic->getObjectType(bestObject);
+    #if DEBUG_BEHAVIOUR_VERBOSITY > 2
+        debug << "HeadBehaviour::doTimeVSCostPriorityPolicy(): object " << bestObject << " of a sequence of " << m_head_planner->getSequenceLength()
+              << " at " << m_head_planner->getRate() << " per second, " << m_head_planner->getNodesEvaluated() << " sequences scored" << std::endl;
+    #endif
 
-    if (ob_type == 1){
+    int ob_type = head_logic->getObjectType(bestObject);
+    if (ob_type == HeadLogic::MOBILE_OBJECT){
         dispatchHeadJob((MobileObject*)head_logic->getObject(bestObject));
-        std::cout<<" HeadBehaviour::doPriorityListPolicy() Performing priority policy - Mobile Object: "<< bestObject <<std::endl;
-    } else if (ob_type == 2){
+    } else if (ob_type == HeadLogic::AMBIGUOUS_OBJECT){
         dispatchHeadJob((AmbiguousObject*)head_logic->getObject(bestObject));
-        std::cout<<" HeadBehaviour::doPriorityListPolicy() Performing priority policy - Ambiguous Object: "<< bestObject <<std::endl;
     } else {
         dispatchHeadJob((StationaryObject*)head_logic->getObject(bestObject));
-        std::cout<<" HeadBehaviour::doPriorityListPolicy() Performing priority policy - Stationary Object: "<< bestObject <<std::endl;
     }
-
-
-    //Warning:temporary p
+    m_current_action = bestObject;
 }
 
 
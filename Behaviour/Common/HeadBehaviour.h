@@ -46,6 +46,7 @@
 #include "Infrastructure/Jobs/MotionJobs/HeadTrackJob.h"
 #include "Infrastructure/Jobs/MotionJobs/HeadPanJob.h"
 #include "HeadLogic.h"
+#include "HeadPlanner.h"
 #include <cstdlib>
 #include <ctime>
 
@@ -126,6 +127,11 @@ private:
     bool last_job_was_trackjob;
     double time_last_quick_panned;
 
+    //Plans the fixations of the TimeVSCostPriority policy
+    HeadPlanner* m_head_planner;
+    std::vector<float> m_fixation_yaws;
+    std::vector<float> m_fixation_pitches;
+
 
     /*! @brief
     */
@@ -140,7 +146,8 @@ private:
     */
     void doPriorityListPolicy();
 
-    /*! @brief Perform a policy which choice maximises time since last seen and minimises head movement cost.
+    /*! @brief Perform a policy which plans a short sequence of fixations collecting the most information per second of
+        head movement, and looks at the first.
     */
     void doTimeVSCostPriorityPolicy();
 
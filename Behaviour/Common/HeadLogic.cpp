@@ -565,6 +565,25 @@ std::vector<float> HeadLogic::getTimeSinceLastSeenSummary(){
 }
 
 
+/*! @brief Gets the head yaw and pitch (rad) that centre each relevant object in the image.
+  Object order matches with the objects returned by the location summary methods.
+*/
+void HeadLogic::getFixationSummary(std::vector<float>& yaws, std::vector<float>& pitches){
+    float camera_height;
+    if (not Blackboard->Sensors->getCameraHeight(camera_height)){
+        camera_height = 38.;
+    }
+    std::vector<std::vector<float> > summary = getPolarObLocSummary();
+    yaws.clear();
+    pitches.clear();
+    //The first entry is the self location
+    for (int i = 1; i < summary.size(); i++){
+        yaws.push_back(summary[i][1]);
+        pitches.push_back(atan2(camera_height, summary[i][0]));
+    }
+}
+
+
 /*! @brief Returns a simple vector of relevant object locations in the form [x1,y1,x2,y2,...,xn,yn].
   All locations are relative except self location.
 */
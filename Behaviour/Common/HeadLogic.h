@@ -92,6 +92,7 @@ public:
     float innerProd(std::vector<float> x1, std::vector<float> x2);
 
     std::vector<float> getTimeSinceLastSeenSummary();
+    void getFixationSummary(std::vector<float>& yaws, std::vector<float>& pitches);
     std::vector<float> getSimpleObLocSummary();
 
     std::vector<std::vector<float> > getObLocSummary();
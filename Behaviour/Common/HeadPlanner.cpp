@@ -0,0 +1,214 @@
+/*! @file HeadPlanner.cpp
+    @brief Implementation of the short horizon head planner.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "HeadPlanner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <time.h>
+
+//Head movements smaller than this (rad) are not made.
+static const float FIXATION_TOLERANCE = 0.02;
+//The deadline is checked every this many sequences.
+static const int BUDGET_CHECK_MASK = 63;
+
+HeadPlanner::HeadPlanner(float fov_x, float fov_y){
+    m_fov_x = fov_x;
+    m_fov_y = fov_y;
+    m_scale_x = 1.0;
+    m_scale_y = 1.0;
+    m_yaw_speed = 2.0;
+    m_pitch_speed = 1.0;
+    m_min_yaw = -1.5708;
+    m_max_yaw = 1.5708;
+    m_min_pitch = 0.1;
+    m_max_pitch = 1.2;
+    m_settle_time = 0.1;
+    m_dwell_time = 0.25;
+    m_horizon = 3;
+    m_budget = 200;
+    m_count = 0;
+    m_best_length = 0;
+    m_best_rate = 0;
+    m_nodes = 0;
+    m_budget_exhausted = false;
+}
+
+void HeadPlanner::setHeadSpeeds(float yaw_speed, float pitch_speed){
+    m_yaw_speed = yaw_speed;
+    m_pitch_speed = pitch_speed;
+}
+
+void HeadPlanner::setHeadLimits(float min_yaw, float max_yaw, float min_pitch, float max_pitch){
+    m_min_yaw = min_yaw;
+    m_max_yaw = max_yaw;
+    m_min_pitch = min_pitch;
+    m_max_pitch = max_pitch;
+}
+
+void HeadPlanner::setTiming(float settle_time, float dwell_time){
+    m_settle_time = settle_time;
+    m_dwell_time = dwell_time;
+}
+
+void HeadPlanner::setViewScale(float scale_x, float scale_y){
+    m_scale_x = scale_x;
+    m_scale_y = scale_y;
+}
+
+void HeadPlanner::setHorizon(int horizon){
+    m_horizon = std::max(1, std::min(horizon, MAX_HORIZON));
+}
+
+void HeadPlanner::setBudget(int microseconds){
+    m_budget = microseconds;
+}
+
+void HeadPlanner::setObjectCount(int count){
+    m_count = std::max(0, std::min(count, MAX_OBJECTS));
+}
+
+void HeadPlanner::setObject(int index, float yaw, float pitch, float time_since_seen, float weight, float time_constant){
+    if (index < 0 or index >= m_count)
+        return;
+    m_yaw[index] = yaw;
+    m_pitch[index] = pitch;
+    m_time_since_seen[index] = time_since_seen;
+    m_weight[index] = weight;
+    m_inverse_time_constant[index] = time_constant > 0 ? 1.0/time_constant : 0;
+}
+
+int HeadPlanner::plan(float head_yaw, float head_pitch){
+    precompute(head_yaw, head_pitch);
+
+    m_best_length = 0;
+    m_best_rate = 0;
+    m_nodes = 0;
+    m_budget_exhausted = false;
+    m_deadline = now() + 1e-6*m_budget;
+
+    //Objects were seen before the plan started
+    for (int i = 0; i < m_count; i++){
+        m_seen_at[0][i] = -m_time_since_seen[i];
+    }
+
+    //Deepen one fixation at a time, keeping the best sequence of the deepest horizon searched fully
+    for (int horizon = 1; horizon <= m_horizon; horizon++){
+        m_level_rate = 0;
+        if (not search(0, horizon, 0, 0)){
+            m_budget_exhausted = true;
+            break;
+        }
+        if (m_level_rate > 0){
+            for (int d = 0; d < horizon; d++)
+                m_best_sequence[d] = m_level_sequence[d];
+            m_best_length = horizon;
+            m_best_rate = m_level_rate;
+        }
+    }
+    return m_best_length > 0 ? m_best_sequence[0] : -1;
+}
+
+float HeadPlanner::getFixationTime(int from, int to) const{
+    return m_fixation_time[from < 0 ? m_count : from][to];
+}
+
+/*! @brief Clips the fixations to the head limits, and finds the objects in view at each fixation and the time to move
+    between fixations.
+*/
+void HeadPlanner::precompute(float head_yaw, float head_pitch){
+    float half_width = 0.5*m_fov_x*m_scale_x;
+    float half_height = 0.5*m_fov_y*m_scale_y;
+
+    for (int j = 0; j < m_count; j++){
+        m_fixation_yaw[j] = std::max(m_min_yaw, std::min(m_yaw[j], m_max_yaw));
+        m_fixation_pitch[j] = std::max(m_min_pitch, std::min(m_pitch[j], m_max_pitch));
+    }
+
+    for (int j = 0; j < m_count; j++){
+        unsigned int in_view = 0;
+        for (int i = 0; i < m_count; i++){
+            if (std::fabs(m_yaw[i] - m_fixation_yaw[j]) < half_width and std::fabs(m_pitch[i] - m_fixation_pitch[j]) < half_height)
+                in_view |= 1u << i;
+        }
+        m_in_view[j] = in_view;
+
+        for (int k = 0; k < m_count; k++){
+            m_fixation_time[k][j] = moveTime(m_fixation_yaw[k], m_fixation_pitch[k], m_fixation_yaw[j], m_fixation_pitch[j]);
+        }
+        m_fixation_time[m_count][j] = moveTime(head_yaw, head_pitch, m_fixation_yaw[j], m_fixation_pitch[j]);
+    }
+}
+
+/*! @brief The time to move the head, including settling, and to hold the new fixation. Yaw and pitch move together.
+*/
+float HeadPlanner::moveTime(float from_yaw, float from_pitch, float to_yaw, float to_pitch) const{
+    float yaw_distance = std::fabs(to_yaw - from_yaw);
+    float pitch_distance = std::fabs(to_pitch - from_pitch);
+    if (yaw_distance < FIXATION_TOLERANCE and pitch_distance < FIXATION_TOLERANCE)
+        return m_dwell_time;
+    return m_settle_time + std::max(yaw_distance/m_yaw_speed, pitch_distance/m_pitch_speed) + m_dwell_time;
+}
+
+/*! @brief Scores every sequence of horizon fixations that starts with the depth fixations in m_sequence.
+    @return false if the deadline passed, in which case the search of this horizon is abandoned
+*/
+bool HeadPlanner::search(int depth, int horizon, float elapsed, float information){
+    if (depth == horizon){
+        m_nodes++;
+        float rate = information/elapsed;
+        if (rate > m_level_rate){
+            m_level_rate = rate;
+            for (int d = 0; d < horizon; d++)
+                m_level_sequence[d] = m_sequence[d];
+        }
+        //The first fixation is always searched fully, so there is always a plan
+        if (horizon > 1 and (m_nodes & BUDGET_CHECK_MASK) == 0 and now() > m_deadline)
+            return false;
+        return true;
+    }
+
+    int from = depth == 0 ? m_count : m_sequence[depth - 1];
+    const float* seen_at = m_seen_at[depth];
+    float* next_seen_at = m_seen_at[depth + 1];
+    for (int j = 0; j < m_count; j++){
+        //Looking at the same thing again, or at nothing, collects nothing
+        if (j == from or m_in_view[j] == 0)
+            continue;
+
+        float t = elapsed + m_fixation_time[from][j];
+        float gain = 0;
+        for (int i = 0; i < m_count; i++){
+            if ((m_in_view[j] >> i) & 1){
+                gain += m_weight[i]*(1 - std::exp((seen_at[i] - t)*m_inverse_time_constant[i]));
+                next_seen_at[i] = t;
+            } else {
+                next_seen_at[i] = seen_at[i];
+            }
+        }
+
+        m_sequence[depth] = j;
+        if (not search(depth + 1, horizon, t, information + gain))
+            return false;
+    }
+    return true;
+}
+
+double HeadPlanner::now() const{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
@@ -0,0 +1,136 @@
+/*! @file HeadPlanner.h
+    @brief Short horizon planner for choosing which object the head looks at next.
+
+    The planner is given, for each of HeadLogic's interesting objects, the head yaw and pitch that centre the object in
+    the image, the time since it was last seen and how much information seeing it is worth. It precomputes the time to
+    move the head between every pair of fixations and which objects are inside the field of view at each fixation, and
+    then searches sequences of up to MAX_HORIZON fixations for the one that collects the most information per second of
+    head movement and dwell. Only the first fixation is used; the plan is made again at the next decision.
+
+    The uncertainty of an object grows with the time since it was seen as weight*(1 - exp(-t/time_constant)), and all of
+    it is collected when the object is inside the field of view at a fixation. The search deepens one fixation at a time
+    and stops when the time budget runs out, keeping the best sequence of the deepest horizon that was searched fully.
+
+    The planner does not use the Blackboard, so it can be run offline (see HeadPlannerSimulation.cpp).
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HEADPLANNER_H
+#define HEADPLANNER_H
+
+class HeadPlanner {
+public:
+    static const int MAX_OBJECTS = 16;
+    static const int MAX_HORIZON = 4;
+
+    /*! @brief Creates a planner for a camera with the given field of view (rad). The head speeds, limits and timing
+        default to those in Config/Darwin/Motion/Head.cfg.
+    */
+    HeadPlanner(float fov_x, float fov_y);
+
+    /*! @brief Sets the maximum head speeds (rad/s). */
+    void setHeadSpeeds(float yaw_speed, float pitch_speed);
+    /*! @brief Sets the head limits (rad); fixations are clipped to them. */
+    void setHeadLimits(float min_yaw, float max_yaw, float min_pitch, float max_pitch);
+    /*! @brief Sets the time (s) to start and settle a head movement, and the time (s) a fixation must be held for the
+        objects in view to be counted as seen (HeadBehaviour's CONFIRMATION_TIME).
+    */
+    void setTiming(float settle_time, float dwell_time);
+    /*! @brief Sets the proportion of the field of view an object must be inside to be counted as seen. */
+    void setViewScale(float scale_x, float scale_y);
+    /*! @brief Sets the longest sequence searched, at most MAX_HORIZON. */
+    void setHorizon(int horizon);
+    /*! @brief Sets the time a plan may take (us). The first fixation is always searched fully. */
+    void setBudget(int microseconds);
+
+    /*! @brief Sets the number of objects, at most MAX_OBJECTS. Every object must then be set with setObject. */
+    void setObjectCount(int count);
+    /*! @brief Sets an object.
+        @param yaw the head yaw (rad) that centres the object in the image
+        @param pitch the head pitch (rad) that centres the object in the image
+        @param time_since_seen the time (s) since the object was last seen
+        @param weight the information collected by seeing an object that has not been seen for a long time
+        @param time_constant the time (s) it takes for the uncertainty of the object to grow to 63% of its weight
+    */
+    void setObject(int index, float yaw, float pitch, float time_since_seen, float weight, float time_constant);
+
+    /*! @brief Plans a sequence of fixations from the current head position.
+        @return the object to look at first, or -1 if no fixation sees anything
+    */
+    int plan(float head_yaw, float head_pitch);
+
+    /*! @brief The planned fixations, the first of which is returned by plan. */
+    const int* getSequence() const {return m_best_sequence;}
+    int getSequenceLength() const {return m_best_length;}
+    /*! @brief The information per second of the planned sequence. */
+    float getRate() const {return m_best_rate;}
+    /*! @brief The number of sequences scored by the last plan. */
+    int getNodesEvaluated() const {return m_nodes;}
+    /*! @brief True if the last plan stopped before searching the whole horizon. */
+    bool getBudgetExhausted() const {return m_budget_exhausted;}
+
+    /*! @brief The time (s) to move from fixation from to fixation to and hold it; from == -1 is the current head position. */
+    float getFixationTime(int from, int to) const;
+    /*! @brief True if object is counted as seen while looking at fixation. */
+    bool isInView(int fixation, int object) const {return (m_in_view[fixation] >> object) & 1;}
+
+private:
+    void precompute(float head_yaw, float head_pitch);
+    float moveTime(float from_yaw, float from_pitch, float to_yaw, float to_pitch) const;
+    bool search(int depth, int horizon, float elapsed, float information);
+    double now() const;
+
+    //Camera and head
+    float m_fov_x;
+    float m_fov_y;
+    float m_scale_x;
+    float m_scale_y;
+    float m_yaw_speed;
+    float m_pitch_speed;
+    float m_min_yaw, m_max_yaw;
+    float m_min_pitch, m_max_pitch;
+    float m_settle_time;
+    float m_dwell_time;
+    int m_horizon;
+    int m_budget;
+
+    //Objects
+    int m_count;
+    float m_yaw[MAX_OBJECTS];
+    float m_pitch[MAX_OBJECTS];
+    float m_time_since_seen[MAX_OBJECTS];
+    float m_weight[MAX_OBJECTS];
+    float m_inverse_time_constant[MAX_OBJECTS];
+
+    //Precomputed per plan; row m_count of m_fixation_time is the current head position
+    float m_fixation_yaw[MAX_OBJECTS];
+    float m_fixation_pitch[MAX_OBJECTS];
+    unsigned int m_in_view[MAX_OBJECTS];
+    float m_fixation_time[MAX_OBJECTS + 1][MAX_OBJECTS];
+
+    //Search state; m_seen_at[d][i] is the time object i was last seen after d fixations, negative before the plan
+    int m_sequence[MAX_HORIZON];
+    float m_seen_at[MAX_HORIZON + 1][MAX_OBJECTS];
+    int m_level_sequence[MAX_HORIZON];
+    float m_level_rate;
+    int m_best_sequence[MAX_HORIZON];
+    int m_best_length;
+    float m_best_rate;
+    int m_nodes;
+    bool m_budget_exhausted;
+    double m_deadline;
+};
+
+#endif // HEADPLANNER_H
@@ -0,0 +1,320 @@
+/*! @file HeadPlannerSimulation.cpp
+    @brief Scores head policies offline. A robot walks around a field with the four goal posts and a moving ball while a
+           policy chooses what the head looks at. The head moves at the speeds in Config/Darwin/Motion/Head.cfg, and an
+           object is seen in a frame when the head is still and the object is inside the field of view.
+
+    The policies are the previous doTimeVSCostPriorityPolicy (greatest time since last seen over head movement angle),
+    and the HeadPlanner with a horizon of one and of three fixations. Each is scored by the uncertainty of the objects
+    averaged over the frames, the time since a goal post and the ball were seen, the proportion of frames that see
+    something, the number of head movements, and the time taken to choose.
+
+    Build and run from this directory with
+    @code
+        make HeadPlannerSimulation && ./HeadPlannerSimulation
+    @endcode
+    It returns non-zero if the planner leaves more uncertainty than the previous policy, or plans nothing while an object is
+    within reach of the head.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HeadPlanner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <time.h>
+
+//The camera, head and timing used by HeadBehaviour on the Darwin
+static const float FOV_X = 62.8*M_PI/180;
+static const float FOV_Y = 48.8*M_PI/180;
+static const float YAW_SPEED = 2.0;
+static const float PITCH_SPEED = 1.0;
+static const float MIN_YAW = -1.5708, MAX_YAW = 1.5708;
+static const float MIN_PITCH = 0.1, MAX_PITCH = 1.2;
+static const float SETTLE_TIME = 0.1;
+static const float CONFIRMATION_TIME = 0.25;
+static const float MAXIMUM_SEARCH_TIME = 1.0;
+static const float LANDMARK_TIME_CONSTANT = 1.2;
+static const float BALL_TIME_CONSTANT = 0.8;
+static const float CAMERA_HEIGHT = 38;
+
+static const float FRAME_TIME = 1/30.;
+static const int NUM_EPISODES = 40;
+static const float EPISODE_TIME = 60;
+
+//HeadLogic's interesting objects: the four goal posts, then the ball
+static const int NUM_OBJECTS = 5;
+static const int BALL = 4;
+static const float POST_X[4] = {-300, -300, 300, 300};
+static const float POST_Y[4] = {-75, 75, 75, -75};
+
+enum PolicyID {
+    PreviousPolicy,
+    PlannerOnePolicy,
+    PlannerThreePolicy,
+    NUM_POLICIES
+};
+static const char* POLICY_NAMES[NUM_POLICIES] = {"previous time vs cost", "planner, 1 fixation", "planner, 3 fixations"};
+
+struct World {
+    float x, y, heading;
+    float ball_x, ball_y, ball_vx, ball_vy;
+    float head_yaw, head_pitch;
+    float still_time;                       //time the head has been still on its target
+    float time_since_seen[NUM_OBJECTS];
+    float yaw[NUM_OBJECTS];
+    float pitch[NUM_OBJECTS];
+};
+
+struct Score {
+    double uncertainty;
+    double landmark_time;
+    double ball_time;
+    long useful_frames;
+    long frames;
+    long movements;
+    double choose_time;
+    double longest_choose_time;
+    long choices;
+    long nothing_planned;
+};
+
+static float uniform(float low, float high)
+{
+    return low + (high - low)*rand()/(float)RAND_MAX;
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static float normaliseAngle(float angle)
+{
+    return atan2(sin(angle), cos(angle));
+}
+
+static float uncertainty(int i, float time_since_seen)
+{
+    return 1 - exp(-time_since_seen/(i == BALL ? BALL_TIME_CONSTANT : LANDMARK_TIME_CONSTANT));
+}
+
+/*! @brief The head angles that centre each object, as HeadLogic::getFixationSummary */
+static void updateFixations(World& world)
+{
+    for (int i = 0; i < NUM_OBJECTS; i++)
+    {
+        float dx = (i == BALL ? world.ball_x : POST_X[i]) - world.x;
+        float dy = (i == BALL ? world.ball_y : POST_Y[i]) - world.y;
+        world.yaw[i] = normaliseAngle(atan2(dy, dx) - world.heading);
+        world.pitch[i] = atan2(CAMERA_HEIGHT, sqrt(dx*dx + dy*dy));
+    }
+}
+
+static void startEpisode(World& world)
+{
+    world.x = uniform(-250, 250);
+    world.y = uniform(-180, 180);
+    world.heading = uniform(-M_PI, M_PI);
+    world.ball_x = uniform(-250, 250);
+    world.ball_y = uniform(-180, 180);
+    world.ball_vx = world.ball_vy = 0;
+    world.head_yaw = 0;
+    world.head_pitch = 0.5;
+    world.still_time = 0;
+    for (int i = 0; i < NUM_OBJECTS; i++)
+        world.time_since_seen[i] = uniform(0, 3);
+    updateFixations(world);
+}
+
+/*! @brief The robot wanders towards the ball and turns, and the ball is kicked now and then */
+static void stepWorld(World& world)
+{
+    float to_ball = atan2(world.ball_y - world.y, world.ball_x - world.x);
+    world.heading = normaliseAngle(world.heading + FRAME_TIME*(0.6*normaliseAngle(to_ball - world.heading) + uniform(-1, 1)));
+    world.x = std::max(-280.f, std::min(world.x + FRAME_TIME*8*std::cos(world.heading), 280.f));
+    world.y = std::max(-190.f, std::min(world.y + FRAME_TIME*8*std::sin(world.heading), 190.f));
+
+    if (rand() % 150 == 0)
+    {
+        world.ball_vx = uniform(-80, 80);
+        world.ball_vy = uniform(-80, 80);
+    }
+    world.ball_x = std::max(-290.f, std::min(world.ball_x + FRAME_TIME*world.ball_vx, 290.f));
+    world.ball_y = std::max(-190.f, std::min(world.ball_y + FRAME_TIME*world.ball_vy, 190.f));
+    world.ball_vx *= 0.97;
+    world.ball_vy *= 0.97;
+    updateFixations(world);
+}
+
+/*! @brief The previous doTimeVSCostPriorityPolicy: the greatest time since seen over HeadLogic::getRequiredHeadMovementAngle */
+static int choosePrevious(const World& world)
+{
+    float best_priority = 0;
+    int best = 0;
+    for (int i = 0; i < NUM_OBJECTS; i++)
+    {
+        float relative_yaw = fabs(world.yaw[i] - world.head_yaw);
+        float relative_pitch = fabs(world.pitch[i] - world.head_pitch);
+        float cost;
+        if (relative_yaw < FOV_X/2 and relative_pitch < FOV_Y/2)
+            cost = 0;
+        else if (relative_yaw < FOV_X/2)
+            cost = relative_pitch - FOV_Y/2;
+        else if (relative_pitch < FOV_Y/2)
+            cost = relative_yaw - FOV_X/2;
+        else
+            cost = sqrt((relative_yaw - FOV_X/2)*(relative_yaw - FOV_X/2) + (relative_pitch - FOV_Y/2)*(relative_pitch - FOV_Y/2));
+
+        float priority = cost == 0 ? 0 : world.time_since_seen[i]/cost;
+        if (best_priority < priority)
+        {
+            best_priority = priority;
+            best = i;
+        }
+    }
+    return best;
+}
+
+/*! @brief As HeadBehaviour::doTimeVSCostPriorityPolicy */
+static int choosePlanner(HeadPlanner& planner, const World& world, Score& score)
+{
+    planner.setObjectCount(NUM_OBJECTS);
+    for (int i = 0; i < NUM_OBJECTS; i++)
+        planner.setObject(i, world.yaw[i], world.pitch[i], world.time_since_seen[i], 1.0, i == BALL ? BALL_TIME_CONSTANT : LANDMARK_TIME_CONSTANT);
+    int best = planner.plan(world.head_yaw, world.head_pitch);
+    if (best < 0)
+    {
+        //Nothing at all should be planned only when every object is out of the head's reach
+        for (int i = 0; i < NUM_OBJECTS; i++)
+            if (fabs(world.yaw[i]) < MAX_YAW + FOV_X/2 and world.pitch[i] > MIN_PITCH - FOV_Y/2 and world.pitch[i] < MAX_PITCH + FOV_Y/2)
+                score.nothing_planned++;
+        best = 0;
+    }
+    return best;
+}
+
+/*! @brief Moves the head towards the target at the maximum speeds, and counts the objects seen in this frame */
+static void stepHead(World& world, int target, Score& score)
+{
+    float target_yaw = std::max(MIN_YAW, std::min(world.yaw[target], MAX_YAW));
+    float target_pitch = std::max(MIN_PITCH, std::min(world.pitch[target], MAX_PITCH));
+    float yaw_step = std::max(-YAW_SPEED*FRAME_TIME, std::min(target_yaw - world.head_yaw, YAW_SPEED*FRAME_TIME));
+    float pitch_step = std::max(-PITCH_SPEED*FRAME_TIME, std::min(target_pitch - world.head_pitch, PITCH_SPEED*FRAME_TIME));
+    world.head_yaw += yaw_step;
+    world.head_pitch += pitch_step;
+
+    //A small correction while tracking does not blur the image
+    if (fabs(yaw_step) < 0.02 and fabs(pitch_step) < 0.02)
+        world.still_time += FRAME_TIME;
+    else
+        world.still_time = 0;
+
+    bool useful = false;
+    for (int i = 0; i < NUM_OBJECTS; i++)
+    {
+        world.time_since_seen[i] += FRAME_TIME;
+        if (world.still_time > SETTLE_TIME and fabs(world.yaw[i] - world.head_yaw) < FOV_X/2 and fabs(world.pitch[i] - world.head_pitch) < FOV_Y/2)
+        {
+            world.time_since_seen[i] = 0;
+            useful = true;
+        }
+    }
+
+    float landmark_time = world.time_since_seen[0];
+    for (int i = 1; i < BALL; i++)
+        landmark_time = std::min(landmark_time, world.time_since_seen[i]);
+    for (int i = 0; i < NUM_OBJECTS; i++)
+        score.uncertainty += uncertainty(i, world.time_since_seen[i]);
+    score.landmark_time += landmark_time;
+    score.ball_time += world.time_since_seen[BALL];
+    score.useful_frames += useful;
+    score.frames++;
+}
+
+static Score run(PolicyID policy, unsigned int seed)
+{
+    Score score = Score();
+    HeadPlanner planner(FOV_X, FOV_Y);
+    planner.setHeadSpeeds(YAW_SPEED, PITCH_SPEED);
+    planner.setHeadLimits(MIN_YAW, MAX_YAW, MIN_PITCH, MAX_PITCH);
+    planner.setTiming(SETTLE_TIME, CONFIRMATION_TIME);
+    planner.setHorizon(policy == PlannerThreePolicy ? 3 : 1);
+
+    srand(seed);
+    for (int e = 0; e < NUM_EPISODES; e++)
+    {
+        World world;
+        startEpisode(world);
+        int target = -1;
+        float action_time = 0;
+        for (float t = 0; t < EPISODE_TIME; t += FRAME_TIME)
+        {
+            //As HeadBehaviour::makeVisionChoice, choose again once the target is confirmed or the search time is over
+            bool confirmed = target >= 0 and world.still_time > SETTLE_TIME + CONFIRMATION_TIME and world.time_since_seen[target] == 0;
+            if (target < 0 or confirmed or action_time > MAXIMUM_SEARCH_TIME)
+            {
+                double start = now();
+                int next = policy == PreviousPolicy ? choosePrevious(world) : choosePlanner(planner, world, score);
+                double taken = now() - start;
+                score.choose_time += taken;
+                score.longest_choose_time = std::max(score.longest_choose_time, taken);
+                score.choices++;
+                if (next != target)
+                    score.movements++;
+                target = next;
+                action_time = 0;
+            }
+            stepHead(world, target, score);
+            stepWorld(world);
+            action_time += FRAME_TIME;
+        }
+    }
+    return score;
+}
+
+int main()
+{
+    std::cout << "Head policies over " << NUM_EPISODES << " episodes of " << EPISODE_TIME << " s" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    Score scores[NUM_POLICIES];
+    for (int p = 0; p < NUM_POLICIES; p++)
+    {
+        scores[p] = run((PolicyID)p, 1234);
+        const Score& s = scores[p];
+        double seconds = s.frames*FRAME_TIME;
+        std::cout << POLICY_NAMES[p] << ":" << std::endl;
+        std::cout << "    mean uncertainty " << s.uncertainty/s.frames << " of " << NUM_OBJECTS
+                  << ", time since a goal post seen " << s.landmark_time/s.frames << " s, since the ball seen " << s.ball_time/s.frames << " s" << std::endl;
+        std::cout << "    frames seeing something " << 100.0*s.useful_frames/s.frames << "%, "
+                  << s.movements/seconds << " head movements per s, " << s.choices/seconds << " choices per s" << std::endl;
+        std::cout << "    choosing takes " << 1e6*s.choose_time/s.choices << " us on average, " << 1e6*s.longest_choose_time << " us at most" << std::endl;
+    }
+
+    bool ok = true;
+    for (int p = PlannerOnePolicy; p < NUM_POLICIES; p++)
+    {
+        ok = ok and scores[p].nothing_planned == 0;
+        ok = ok and scores[p].uncertainty <= scores[PreviousPolicy].uncertainty;
+    }
+    std::cout << (ok ? "All checks passed" : "Checks FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -24,6 +24,8 @@ SET (YOUR_SRCS  HeadBehaviour.h
 		HeadBehaviour.cpp
 		HeadLogic.h
 		HeadLogic.cpp
+		HeadPlanner.h
+		HeadPlanner.cpp
 		BehaviourStateLogic.h
 		BehaviourStateLogic.cpp
 		NavigationLogic.h
@@ -101,6 +101,8 @@ void ScriptedPoseProvider::doSelectedMotion()
     		m_script_playing = true;
     		m_script.play(m_data, m_actions);
     	}
+        else
+            m_script.process(m_data, m_actions);
 
         m_jobs->addMotionJob(new WalkJob(0,0,0));
     }
@@ -0,0 +1,566 @@
+/*! @file NavigationBenchmark.cpp
+    @brief Drives many virtual robots with the NavigationKernel without a Blackboard. It checks the kernel against the
+           previous BehaviourPotentials calculations, checks that robots in a batch do not disturb each other's hysteresis,
+           and times the previous calculations, the kernel and the kernel's batch functions.
+
+    Build and run from this directory with
+    @code
+        make NavigationBenchmark && ./NavigationBenchmark
+    @endcode
+    It returns non-zero if any check fails.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NavigationKernel.h"
+#include "Tools/Math/General.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include <time.h>
+
+/*! @brief The previous BehaviourPotentials calculations, with the Blackboard's obstacles passed in as the copy they made of them */
+class Reference
+{
+public:
+    static std::vector<float> goToPoint(float distance, float bearing, float heading, std::vector<NavigationObstacle> objects, float stoppeddistance, float stoppingdistance)
+    {
+        static const float m_HYSTERESIS = 0.1;
+        static bool m_previous_turning = false;
+        static bool m_turning_left = false;
+        std::vector<float> result(3,0);
+
+        float goaldistance = 80.f;
+        for(unsigned int i=0; i<objects.size(); i++) {
+            if (objects[i].distance < goaldistance) {
+                if (objects[i].bearing > bearing and objects[i].bearing-objects[i].arc_width < bearing) {
+                    bearing = objects[i].bearing-objects[i].arc_width;
+                } else if (objects[i].bearing < bearing and objects[i].bearing+objects[i].arc_width > bearing) {
+                    bearing = objects[i].bearing+objects[i].arc_width;
+                }
+            }
+        }
+
+        if (fabs(bearing) > 0.3 or (fabs(bearing) > m_HYSTERESIS and m_previous_turning and distance > stoppeddistance*1.5)) {
+            m_previous_turning = true;
+            if (bearing > 0. and bearing < 2.6) {
+                result[2] = bearing*0.5;
+                m_turning_left = true;
+            } else if (bearing <= 0. and bearing > -2.6) {
+                result[2] = bearing*0.5;
+                m_turning_left = false;
+            } else if (distance < stoppeddistance) {
+                result[2] = heading*0.5;
+            } else if (m_turning_left) {
+                result[2] = 1.f;
+            } else if (not m_turning_left) {
+                result[2] = -1.f;
+            }
+            result[0] = -0.1f;
+        } else {
+            m_previous_turning = false;
+            if (distance > stoppingdistance) {
+                result[0] = 1.0;
+            } else if (distance > stoppingdistance/2.f) {
+                result[0] = 0.65;
+            } else if (distance > stoppeddistance) {
+                result[0] = 0.25;
+            } else {
+                result[2] = heading*0.5;
+                result[1] = mathGeneral::PI/2.f*mathGeneral::sign(-heading);
+                result[0] = 0.1;
+            }
+        }
+        return result;
+    }
+
+    static std::vector<float> goToPointBackwards(float distance, float bearing, float heading, float stoppeddistance, float stoppingdistance)
+    {
+        static const float m_HYSTERESIS = 0.15;
+        static bool m_previous_turning = false;
+        static bool m_turning_left = false;
+        std::vector<float> result(3,0);
+        if (fabs(bearing) > 0.4 or (fabs(bearing) > m_HYSTERESIS and m_previous_turning)) {
+            m_previous_turning = true;
+            if (bearing > 0. and bearing < 2.6 and distance > stoppeddistance) {
+                result[2] = bearing*1.0;
+                m_turning_left = true;
+            } else if (bearing <= 0. and bearing > -2.6 and distance > stoppeddistance) {
+                result[2] = bearing*0.8;
+                m_turning_left = false;
+            } else if (distance < stoppeddistance) {
+                result[2] = heading*0.6;
+            } else if (m_turning_left) {
+                result[2] = 1.f;
+            } else if (not m_turning_left) {
+                result[2] = -1.f;
+            }
+            result[0] = -0.01f;
+        } else {
+            m_previous_turning = false;
+            if (distance > stoppingdistance) {
+                result[0] = 1.0;
+            } else if (distance > stoppingdistance/2.f) {
+                result[0] = 0.7;
+            } else if (distance > stoppeddistance) {
+                result[0] = 0.25;
+            } else {
+                result[2] = heading*0.5;
+            }
+        }
+        return result;
+    }
+
+    static std::vector<float> goToKickPosition(float angle_to_kick_pos, float ball_distance, float ball_bearing, float goal_bearing, std::vector<NavigationObstacle> objects, float kickingdistance, float stoppingdistance)
+    {
+        std::vector<float> speed(3, 0.0f);
+        static bool turning = false;
+        static bool turningLeft = false;
+        float target_heading = (ball_distance > stoppingdistance) ? angle_to_kick_pos : ball_bearing;
+
+        for(unsigned int i=0; i<objects.size(); i++) {
+            if (objects[i].distance > ball_distance) {
+                if (objects[i].bearing > target_heading and objects[i].bearing-objects[i].arc_width < target_heading) {
+                    target_heading = objects[i].bearing-objects[i].arc_width;
+                } else if (objects[i].bearing < target_heading and objects[i].bearing+objects[i].arc_width > target_heading) {
+                    target_heading = objects[i].bearing+objects[i].arc_width;
+                }
+            }
+        }
+
+        if (fabs(ball_bearing) < 0.3) {
+            float bearingLineUpSide = 0.4;
+            float bearingLineUpFront = 0.45;
+            if (goal_bearing > mathGeneral::PI/4.f) {
+                ball_bearing -= bearingLineUpSide*(kickingdistance-2.)/ball_distance;
+            } else if (goal_bearing < -mathGeneral::PI/4.f) {
+                ball_bearing += bearingLineUpSide*(kickingdistance-2.)/ball_distance;
+            } else {
+                ball_bearing += mathGeneral::sign(ball_bearing)*bearingLineUpFront*(kickingdistance-2.)/ball_distance;
+            }
+        }
+
+        if (target_heading > 0.f and target_heading < 3.f) {
+            turningLeft = true;
+        } else if (target_heading < 0.f and target_heading > -3.f) {
+            turningLeft = false;
+        }
+        if ((turningLeft and target_heading < 0.) or ((not turningLeft) and target_heading > 0.)) {
+            target_heading *= -1.f;
+        }
+
+        if(turning and (fabs(target_heading) < 0.1 or (fabs(target_heading) < 0.3 and ball_distance > stoppingdistance/2.))) {
+            turning = false;
+        } else if (not turning and fabs(target_heading) > 0.5) {
+            turning = true;
+        }
+
+        if(turning) {
+            speed[0] = 0.03f;
+            speed[1] = -mathGeneral::sign(target_heading)*3.1;
+            speed[2] = 0.6*target_heading;
+            if (ball_distance < kickingdistance * 1.5) {
+                speed[2] = 0.3*target_heading;
+            }
+        } else if(ball_distance > stoppingdistance) {
+            speed[0] = 1.0f;
+            speed[1] = 0.0f;
+            speed[2] = 0.0f;
+        } else if (ball_distance > kickingdistance) {
+            speed[0] = 0.5f;
+            speed[1] = 0.2*ball_bearing;
+            speed[2] = 0.0f;
+        } else {
+            speed[2] = 0.2*ball_bearing;
+        }
+        return speed;
+    }
+
+    static std::vector<float> goToBall(float distance, float bearing, float heading, float kickingdistance, float stoppingdistance)
+    {
+        float x = distance * cos(bearing);
+        float y = distance * sin(bearing);
+        float offsetDistance = 3.0f;
+
+        float left_foot_x = x + offsetDistance * cos(heading - mathGeneral::PI/2);
+        float left_foot_y = y + offsetDistance * sin(heading - mathGeneral::PI/2);
+        float left_foot_distance = sqrt(pow(left_foot_x,2) + pow(left_foot_y,2));
+        float right_foot_x = x + offsetDistance * cos(heading + mathGeneral::PI/2);
+        float right_foot_y = y + offsetDistance * sin(heading + mathGeneral::PI/2);
+        float right_foot_distance = sqrt(pow(right_foot_x,2) + pow(right_foot_y,2));
+        if(left_foot_distance < right_foot_distance) {
+            x = left_foot_x;
+            y = left_foot_y;
+        } else {
+            x = right_foot_x;
+            y = right_foot_y;
+        }
+        distance = sqrt(x*x + y*y);
+        bearing = atan2(y,x);
+
+        float position_speed;
+        float position_direction;
+        float position_rotation;
+        if (distance < kickingdistance) {
+            position_speed = 0.1;
+            position_direction = mathGeneral::normaliseAngle(bearing + mathGeneral::PI);
+            if (bearing < mathGeneral::PI/8.) {
+                position_rotation = mathGeneral::sign(heading)*0.3;
+            } else if (bearing > mathGeneral::PI/3.) {
+                position_rotation = mathGeneral::sign(bearing)*0.3;
+            } else {
+                position_rotation = 0.;
+            }
+        } else if (distance < stoppingdistance) {
+            position_speed = (distance - kickingdistance+3.)/(stoppingdistance - kickingdistance+3.);
+            position_direction = bearing;
+            position_rotation = 0.7*bearing;
+            if (position_speed < 0.3 and fabs(bearing) < mathGeneral::PI/3.) {
+                position_speed += 0.13;
+            }
+        } else {
+            if ( fabs (bearing) < 0.3 or ((fabs (bearing) < 0.5) and distance > stoppingdistance)) {
+                position_speed = 1.0;
+                position_direction = bearing*0.6;
+                position_rotation = 0.;
+            } else {
+                position_speed = 0.2;
+                position_direction = mathGeneral::normaliseAngle(bearing - mathGeneral::sign(heading)*mathGeneral::PI/2);
+                position_rotation = 0.5*bearing;
+            }
+        }
+
+        std::vector<float> speed(3,0);
+        float around_speed;
+        float around_direction;
+        float around_rotation;
+        if ((distance < stoppingdistance and distance > 1.5*kickingdistance) or distance < 1.15*kickingdistance) {
+            float heading_gain = 0.5;
+            if (distance < 1.25*kickingdistance) {
+                heading_gain = 0.2;
+            }
+            const float heading_threshold = mathGeneral::PI/3;
+            if (fabs(heading) < heading_threshold)
+                around_speed = (heading_gain/heading_threshold)*fabs(heading);
+            else
+                around_speed = heading_gain;
+            if (fabs(heading) > 2.85)
+                around_direction = mathGeneral::normaliseAngle(bearing + mathGeneral::PI/2);
+            else
+                around_direction = mathGeneral::normaliseAngle(bearing - mathGeneral::sign(heading)*mathGeneral::PI/2);
+            around_rotation = -mathGeneral::sign(around_direction)*around_speed/distance/2.;
+        } else {
+            around_speed = 0;
+            around_direction = 0;
+            around_rotation = 0;
+        }
+        speed[0] = std::max(position_speed, around_speed);
+        speed[1] = (position_speed*position_direction + around_speed*around_direction)/(std::max(position_speed,0.3f)+around_speed);
+        speed[2] = (position_speed*position_rotation + around_speed*around_rotation)/(position_speed+around_speed);
+        speed[2] = std::min(double(fabs(speed[2])), 0.3) * mathGeneral::sign(speed[2]);
+        return speed;
+    }
+
+    static std::vector<float> avoidFieldState(float distance, float bearing, float objectsize, float dontcaredistance)
+    {
+        std::vector<float> result(3,0);
+        if (distance > dontcaredistance)
+            return result;
+        if (distance < objectsize)
+            result[0] = 1;
+        else
+            result[0] = (distance - dontcaredistance)/(objectsize - dontcaredistance);
+        if (fabs(bearing) < 0.1)
+            result[1] = mathGeneral::PI/2;
+        else
+            result[1] = bearing - mathGeneral::sign(bearing)*mathGeneral::PI/2;
+        float y = distance*sin(bearing);
+        float x = distance*cos(bearing);
+        if (fabs(y) < objectsize)
+            result[2] = atan2(y - mathGeneral::sign(y)*objectsize, x);
+        else
+            result[2] = 0;
+        return result;
+    }
+};
+
+/*! @brief A robot walking about a 600x400cm field toward a target, around a few obstacles */
+struct VirtualRobot
+{
+    float x, y, heading;
+    float target_x, target_y, target_heading;
+    std::vector<NavigationObstacle> obstacles;
+};
+
+static float uniform(float min, float max)
+{
+    return min + (max - min)*(rand()/(RAND_MAX + 1.0f));
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static bool same(const std::vector<float>& a, const NavigationVector& b)
+{
+    return a.size() == 3 and a[0] == b[0] and a[1] == b[1] and a[2] == b[2];
+}
+
+static std::vector<VirtualRobot> createRobots(unsigned int num_robots)
+{
+    std::vector<VirtualRobot> robots(num_robots);
+    for (unsigned int i=0; i<num_robots; i++)
+    {
+        VirtualRobot& robot = robots[i];
+        robot.x = uniform(-300, 300);
+        robot.y = uniform(-200, 200);
+        robot.heading = uniform(-3.14, 3.14);
+        robot.target_x = uniform(-300, 300);
+        robot.target_y = uniform(-200, 200);
+        robot.target_heading = uniform(-3.14, 3.14);
+        unsigned int num_obstacles = rand() % 5;
+        for (unsigned int j=0; j<num_obstacles; j++)
+        {
+            NavigationObstacle obstacle = {uniform(20, 150), uniform(-1.5, 1.5), uniform(0.1, 0.5)};
+            robot.obstacles.push_back(obstacle);
+        }
+    }
+    return robots;
+}
+
+static NavigationTarget relativeTarget(const VirtualRobot& robot)
+{
+    float dx = robot.target_x - robot.x;
+    float dy = robot.target_y - robot.y;
+    NavigationTarget target;
+    target.distance = sqrt(dx*dx + dy*dy);
+    target.bearing = mathGeneral::normaliseAngle(atan2(dy, dx) - robot.heading);
+    target.heading = mathGeneral::normaliseAngle(robot.target_heading - robot.heading);
+    return target;
+}
+
+/*! @brief Moves the robot for a 50ms step at the speed, with a top speed of 20cm/s and 1rad/s */
+static void step(VirtualRobot& robot, const NavigationVector& speed)
+{
+    robot.x += 1.0f*speed[0]*cos(robot.heading + speed[1]);
+    robot.y += 1.0f*speed[0]*sin(robot.heading + speed[1]);
+    robot.heading = mathGeneral::normaliseAngle(robot.heading + 0.05f*std::max(-1.0f, std::min(speed[2], 1.0f)));
+}
+
+static NavigationVector fromVector(const std::vector<float>& v)
+{
+    NavigationVector speed;
+    speed[0] = v[0];
+    speed[1] = v[1];
+    speed[2] = v[2];
+    return speed;
+}
+
+/*! @brief Drives one robot for num_steps with the previous calculations and the kernel side by side, and returns the number of differences */
+static unsigned int compareOneRobot(unsigned int num_steps)
+{
+    VirtualRobot robot = createRobots(1)[0];
+    NavigationState state;
+    unsigned int differences = 0;
+    for (unsigned int i=0; i<num_steps; i++)
+    {
+        NavigationTarget target = relativeTarget(robot);
+        std::vector<float> old_point = Reference::goToPoint(target.distance, target.bearing, target.heading, robot.obstacles, 4, 50);
+        NavigationVector point;
+        NavigationKernel::goToPoint(state, target, robot.obstacles.data(), robot.obstacles.size(), 4, 50, point);
+        differences += not same(old_point, point);
+
+        std::vector<float> old_backwards = Reference::goToPointBackwards(target.distance, target.bearing, target.heading, 10, 100);
+        NavigationVector backwards;
+        NavigationKernel::goToPointBackwards(state, target, 10, 100, backwards);
+        differences += not same(old_backwards, backwards);
+
+        float kick_bearing = mathGeneral::normaliseAngle(target.bearing + uniform(-0.5, 0.5));
+        float goal_bearing = uniform(-3, 3);
+        std::vector<float> old_kick = Reference::goToKickPosition(kick_bearing, target.distance, target.bearing, goal_bearing, robot.obstacles, 15, 65);
+        NavigationVector kick;
+        NavigationKernel::goToKickPosition(state, kick_bearing, target.distance, target.bearing, goal_bearing, robot.obstacles.data(), robot.obstacles.size(), 15, 65, kick);
+        differences += not same(old_kick, kick);
+
+        std::vector<float> old_ball = Reference::goToBall(target.distance, target.bearing, target.heading, 11, 42);
+        NavigationVector ball;
+        NavigationKernel::goToBall(target, 11, 42, ball);
+        differences += not same(old_ball, ball);
+
+        std::vector<float> old_avoid = Reference::avoidFieldState(target.distance, target.bearing, 25, 100);
+        NavigationVector avoid;
+        NavigationKernel::avoidPoint(target.distance, target.bearing, 25, 100, avoid);
+        differences += not same(old_avoid, avoid);
+
+        step(robot, point);
+        if (target.distance < 5)
+        {   // a new target once the robot gets there, so all of the branches are visited
+            robot.target_x = uniform(-300, 300);
+            robot.target_y = uniform(-200, 200);
+        }
+    }
+    return differences;
+}
+
+int main()
+{
+    srand(7);
+    bool ok = true;
+
+    // the kernel gives exactly the previous results for one robot
+    unsigned int differences = compareOneRobot(200000);
+    ok = ok and differences == 0;
+    std::cout << "Kernel against the previous calculations over 200000 steps of one robot: " << differences << " differences" << std::endl;
+
+    // robots in a batch do not disturb each other, and the candidates do not change the state
+    const unsigned int num_robots = 4096;
+    const unsigned int num_steps = 200;
+    std::vector<VirtualRobot> robots = createRobots(num_robots);
+    std::vector<VirtualRobot> alone = robots;
+    std::vector<NavigationObstacle> obstacles;
+    std::vector<NavigationRobot> batch(num_robots);
+    for (unsigned int i=0; i<num_robots; i++)
+    {
+        batch[i].first_obstacle = obstacles.size();
+        batch[i].num_obstacles = robots[i].obstacles.size();
+        obstacles.insert(obstacles.end(), robots[i].obstacles.begin(), robots[i].obstacles.end());
+    }
+    for (unsigned int s=0; s<num_steps; s++)
+    {
+        for (unsigned int i=0; i<num_robots; i++)
+            batch[i].target = relativeTarget(robots[i]);
+        NavigationKernel::goToPoint(batch.data(), num_robots, obstacles.data(), 4, 50);
+        for (unsigned int i=0; i<num_robots; i++)
+            step(robots[i], batch[i].speed);
+    }
+    unsigned int interference = 0;
+    for (unsigned int i=0; i<num_robots; i++)
+    {
+        NavigationState state;
+        for (unsigned int s=0; s<num_steps; s++)
+        {
+            NavigationVector speed;
+            NavigationKernel::goToPoint(state, relativeTarget(alone[i]), alone[i].obstacles.data(), alone[i].obstacles.size(), 4, 50, speed);
+            step(alone[i], speed);
+        }
+        interference += alone[i].x != robots[i].x or alone[i].y != robots[i].y or alone[i].heading != robots[i].heading;
+    }
+    ok = ok and interference == 0;
+    std::cout << "Robots in a batch ending somewhere other than when driven alone: " << interference << " of " << num_robots << std::endl;
+
+    const unsigned int num_candidates = 64;
+    std::vector<NavigationTarget> candidates(num_candidates);
+    for (unsigned int c=0; c<num_candidates; c++)
+    {
+        candidates[c].distance = uniform(0, 300);
+        candidates[c].bearing = uniform(-3.14, 3.14);
+        candidates[c].heading = uniform(-3.14, 3.14);
+    }
+    std::vector<NavigationVector> candidate_speeds(num_candidates);
+    unsigned int candidate_differences = 0;
+    for (unsigned int i=0; i<num_robots; i++)
+    {
+        NavigationState before = batch[i].state;
+        NavigationKernel::goToPointCandidates(batch[i].state, candidates.data(), num_candidates, &obstacles[batch[i].first_obstacle], batch[i].num_obstacles, 4, 50, candidate_speeds.data());
+        candidate_differences += memcmp(&before, &batch[i].state, sizeof(NavigationState)) != 0;
+        for (unsigned int c=0; c<num_candidates; c++)
+        {
+            NavigationState copy = batch[i].state;
+            NavigationVector speed;
+            NavigationKernel::goToPoint(copy, candidates[c], &obstacles[batch[i].first_obstacle], batch[i].num_obstacles, 4, 50, speed);
+            candidate_differences += memcmp(&speed, &candidate_speeds[c], sizeof(NavigationVector)) != 0;
+        }
+    }
+    ok = ok and candidate_differences == 0;
+    std::cout << "Candidate evaluations differing from goToPoint from a copy of the state: " << candidate_differences << std::endl;
+
+    // the time per robot per step, with the previous calculations, the kernel one robot at a time, and the kernel's batches
+    robots = createRobots(num_robots);
+    alone = robots;
+    std::vector<VirtualRobot> batched = robots;
+    std::vector<NavigationState> states(num_robots);
+    double start = now();
+    for (unsigned int s=0; s<num_steps; s++)
+    {
+        for (unsigned int i=0; i<num_robots; i++)
+        {
+            NavigationTarget target = relativeTarget(robots[i]);
+            step(robots[i], fromVector(Reference::goToPoint(target.distance, target.bearing, target.heading, robots[i].obstacles, 4, 50)));
+        }
+    }
+    double old_time = now() - start;
+    start = now();
+    for (unsigned int s=0; s<num_steps; s++)
+    {
+        for (unsigned int i=0; i<num_robots; i++)
+        {
+            NavigationVector speed;
+            NavigationKernel::goToPoint(states[i], relativeTarget(alone[i]), alone[i].obstacles.data(), alone[i].obstacles.size(), 4, 50, speed);
+            step(alone[i], speed);
+        }
+    }
+    double kernel_time = now() - start;
+    for (unsigned int i=0; i<num_robots; i++)
+        batch[i].state.reset();
+    start = now();
+    for (unsigned int s=0; s<num_steps; s++)
+    {
+        for (unsigned int i=0; i<num_robots; i++)
+            batch[i].target = relativeTarget(batched[i]);
+        NavigationKernel::goToPoint(batch.data(), num_robots, obstacles.data(), 4, 50);
+        for (unsigned int i=0; i<num_robots; i++)
+            step(batched[i], batch[i].speed);
+    }
+    double batch_time = now() - start;
+
+    std::vector<NavigationVector> ball_speeds(num_candidates);
+    volatile float sink = 0;
+    start = now();
+    for (unsigned int s=0; s<num_robots; s++)
+    {
+        for (unsigned int c=0; c<num_candidates; c++)
+            sink += Reference::goToBall(candidates[c].distance, candidates[c].bearing, candidates[c].heading, 11, 42)[0];
+    }
+    double old_ball_time = now() - start;
+    start = now();
+    for (unsigned int s=0; s<num_robots; s++)
+    {
+        NavigationKernel::goToBall(candidates.data(), num_candidates, 11, 42, ball_speeds.data());
+        sink += ball_speeds[0][0];
+    }
+    double ball_time = now() - start;
+
+    const double calls = double(num_robots)*num_steps;
+    const double ball_calls = double(num_robots)*num_candidates;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::endl << num_robots << " virtual robots for " << num_steps << " steps, ns per robot step including the simulation" << std::endl;
+    std::cout << std::setw(40) << "previous goToPoint" << std::setw(10) << 1e9*old_time/calls << std::endl;
+    std::cout << std::setw(40) << "kernel goToPoint" << std::setw(10) << 1e9*kernel_time/calls << std::endl;
+    std::cout << std::setw(40) << "kernel goToPoint batch" << std::setw(10) << 1e9*batch_time/calls << std::endl;
+    std::cout << "goToBall, ns per ball" << std::endl;
+    std::cout << std::setw(40) << "previous goToBall" << std::setw(10) << 1e9*old_ball_time/ball_calls << std::endl;
+    std::cout << std::setw(40) << "kernel goToBall batch" << std::setw(10) << 1e9*ball_time/ball_calls << std::endl;
+    std::cout << (ok ? "All checks passed" : "Checks FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
+
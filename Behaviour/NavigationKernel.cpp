@@ -0,0 +1,430 @@
+/*! @file NavigationKernel.cpp
+    @brief Implementation of the navigation kernel behind the behaviour motor schemas in BehaviourPotentials
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NavigationKernel.h"
+#include "Tools/Math/General.h"
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+/*! @brief Returns the bearing moved to the edge of each obstacle it passes through. The obstacles are taken in order,
+           and only those strictly between mindistance and maxdistance are avoided.
+    @param obstacles the obstacles
+    @param num_obstacles the number of obstacles
+    @param bearing the bearing to move along
+    @param mindistance the distance in cm an obstacle must be further than to be avoided
+    @param maxdistance the distance in cm an obstacle must be closer than to be avoided
+ */
+float NavigationKernel::avoidObstacles(const NavigationObstacle* obstacles, unsigned int num_obstacles, float bearing, float mindistance, float maxdistance)
+{
+    for (unsigned int i=0; i<num_obstacles; i++)
+    {
+        const NavigationObstacle& obstacle = obstacles[i];
+        if (obstacle.distance > mindistance and obstacle.distance < maxdistance)
+        {
+            if (obstacle.bearing > bearing and obstacle.bearing - obstacle.arc_width < bearing)         // if we are on the right and occluding
+                bearing = obstacle.bearing - obstacle.arc_width;
+            else if (obstacle.bearing < bearing and obstacle.bearing + obstacle.arc_width > bearing)    // if we are on the left and occluding
+                bearing = obstacle.bearing + obstacle.arc_width;
+        }
+    }
+    return bearing;
+}
+
+/*! @brief Calculates the speed to go to a point, turning on the spot toward it first if it is too far off to the side
+    @param state the robot's navigation state, the turning hysteresis is updated
+    @param target the point, and the heading at the point
+    @param obstacles the obstacles, those within 80cm are walked around
+    @param num_obstacles the number of obstacles
+    @param stoppeddistance the distance in cm to the target at which the robot will stop walking, ie the accurarcy required.
+    @param stoppingdistance the distance in cm from the target the robot will start to slow
+    @param result the speed
+ */
+void NavigationKernel::goToPoint(NavigationState& state, const NavigationTarget& target, const NavigationObstacle* obstacles, unsigned int num_obstacles, float stoppeddistance, float stoppingdistance, NavigationVector& result)
+{
+    const float hysteresis = 0.1;
+    const float distance = target.distance;
+    const float heading = target.heading;
+    float bearing = avoidObstacles(obstacles, num_obstacles, target.bearing, -std::numeric_limits<float>::max(), 80.f);
+    result = NavigationVector();
+
+    if (fabs(bearing) > 0.3 or (fabs(bearing) > hysteresis and state.point_turning and distance > stoppeddistance*1.5))
+    {   // turn with hysteresis
+        state.point_turning = true;
+        if (bearing > 0. and bearing < 2.6) {
+            result[2] = bearing*0.5;
+            state.point_turning_left = true;
+        } else if (bearing <= 0. and bearing > -2.6) {
+            result[2] = bearing*0.5;
+            state.point_turning_left = false;
+        } else if (distance < stoppeddistance) {
+            result[2] = heading*0.5;
+        } else if (state.point_turning_left) {
+            result[2] = 1.f;
+        } else {
+            result[2] = -1.f;
+        }
+        result[0] = -0.1f;
+    }
+    else
+    {   // run forward
+        state.point_turning = false;
+        if (distance > stoppingdistance) {
+            result[0] = 1.0;
+        } else if (distance > stoppingdistance/2.f) {
+            result[0] = 0.65;
+        } else if (distance > stoppeddistance) {
+            result[0] = 0.25;
+        } else {
+            result[2] = heading*0.5;
+            result[1] = mathGeneral::PI/2.f*mathGeneral::sign(-heading);
+            result[0] = 0.1;
+        }
+    }
+}
+
+/*! @brief Calculates the speed to go to a point, without walking around obstacles and turning a little more eagerly than goToPoint
+    @param state the robot's navigation state, the turning hysteresis is updated
+    @param target the point, and the heading at the point
+    @param stoppeddistance the distance in cm to the target at which the robot will stop walking, ie the accurarcy required.
+    @param stoppingdistance the distance in cm from the target the robot will start to slow
+    @param result the speed
+ */
+void NavigationKernel::goToPointBackwards(NavigationState& state, const NavigationTarget& target, float stoppeddistance, float stoppingdistance, NavigationVector& result)
+{
+    const float hysteresis = 0.15;
+    const float distance = target.distance;
+    const float bearing = target.bearing;
+    const float heading = target.heading;
+    result = NavigationVector();
+
+    if (fabs(bearing) > 0.4 or (fabs(bearing) > hysteresis and state.backwards_turning))
+    {   // turn with hysteresis
+        state.backwards_turning = true;
+        if (bearing > 0. and bearing < 2.6 and distance > stoppeddistance) {
+            result[2] = bearing*1.0;
+            state.backwards_turning_left = true;
+        } else if (bearing <= 0. and bearing > -2.6 and distance > stoppeddistance) {
+            result[2] = bearing*0.8;
+            state.backwards_turning_left = false;
+        } else if (distance < stoppeddistance) {
+            result[2] = heading*0.6;
+        } else if (state.backwards_turning_left) {
+            result[2] = 1.f;
+        } else {
+            result[2] = -1.f;
+        }
+        result[0] = -0.01f;
+    }
+    else
+    {   // run forward
+        state.backwards_turning = false;
+        if (distance > stoppingdistance) {
+            result[0] = 1.0;
+        } else if (distance > stoppingdistance/2.f) {
+            result[0] = 0.7;
+        } else if (distance > stoppeddistance) {
+            result[0] = 0.25;
+        } else {
+            result[2] = heading*0.5;
+        }
+    }
+}
+
+/*! @brief Calculates the speed to walk to a kicking position beside or behind the ball, and then line the ball up with a foot
+    @param state the robot's navigation state, the turning hysteresis is updated
+    @param kickpositionbearing the bearing to the kicking position
+    @param balldistance the distance to the ball
+    @param ballbearing the bearing to the ball
+    @param goalbearing the bearing to the opponent's goal. It is only used when the ball is within 0.3 rad of straight ahead
+    @param obstacles the obstacles, those further than the ball are walked around
+    @param num_obstacles the number of obstacles
+    @param kickingdistance the distance to the ball at which the robot stops walking
+    @param stoppingdistance the distance to the ball at which the robot slows down
+    @param result the speed
+ */
+void NavigationKernel::goToKickPosition(NavigationState& state, float kickpositionbearing, float balldistance, float ballbearing, float goalbearing, const NavigationObstacle* obstacles, unsigned int num_obstacles, float kickingdistance, float stoppingdistance, NavigationVector& result)
+{
+    float targetheading = (balldistance > stoppingdistance) ? kickpositionbearing : ballbearing;
+    targetheading = avoidObstacles(obstacles, num_obstacles, targetheading, balldistance, std::numeric_limits<float>::max());
+    result = NavigationVector();
+
+    // change bearing to align to ball
+    if (fabs(ballbearing) < 0.3)
+    {
+        const float bearinglineupside = 0.4;
+        const float bearinglineupfront = 0.45;
+        if (goalbearing > mathGeneral::PI/4.f)              // to our left > 45 degrees
+            ballbearing -= bearinglineupside*(kickingdistance-2.)/balldistance;
+        else if (goalbearing < -mathGeneral::PI/4.f)        // to our right > 45 degrees
+            ballbearing += bearinglineupside*(kickingdistance-2.)/balldistance;
+        else
+            ballbearing += mathGeneral::sign(ballbearing)*bearinglineupfront*(kickingdistance-2.)/balldistance;
+    }
+
+    // hysteresis for 180 degrees out of phase
+    if (targetheading > 0.f and targetheading < 3.f)
+        state.kick_turning_left = true;
+    else if (targetheading < 0.f and targetheading > -3.f)
+        state.kick_turning_left = false;
+    if ((state.kick_turning_left and targetheading < 0.) or (not state.kick_turning_left and targetheading > 0.))
+        targetheading *= -1.f;
+
+    if (state.kick_turning and (fabs(targetheading) < 0.1 or (fabs(targetheading) < 0.3 and balldistance > stoppingdistance/2.)))
+        state.kick_turning = false;
+    else if (not state.kick_turning and fabs(targetheading) > 0.5)
+        state.kick_turning = true;
+
+    if (state.kick_turning)
+    {
+        result[0] = 0.03f;
+        result[1] = -mathGeneral::sign(targetheading)*3.1;
+        result[2] = 0.6*targetheading;
+        if (balldistance < kickingdistance*1.5)
+            result[2] = 0.3*targetheading;
+    }
+    else if (balldistance > stoppingdistance)
+    {   // full speed ahead
+        result[0] = 1.0f;
+    }
+    else if (balldistance > kickingdistance)
+    {
+        result[0] = 0.5f;
+        result[1] = 0.2*ballbearing;
+    }
+    else
+    {
+        result[2] = 0.2*ballbearing;
+    }
+}
+
+/*! @brief Calculates the speed to go to the ball, lining it up with the closer foot, and going around it to face the heading
+    @param ball the ball's estimated distance and bearing, and the desired heading (the bearing to the kick's target)
+    @param kickingdistance the distance to the ball at which the robot stops walking
+    @param stoppingdistance the distance to the ball at which the robot slows down
+    @param result the speed
+ */
+void NavigationKernel::goToBall(const NavigationTarget& ball, float kickingdistance, float stoppingdistance, NavigationVector& result)
+{
+    float distance = ball.distance;
+    float bearing = ball.bearing;
+    const float heading = ball.heading;
+
+    float x = distance * cos(bearing);
+    float y = distance * sin(bearing);
+
+    float offsetDistance = 3.0f;
+
+    float left_foot_x = x + offsetDistance * cos(heading - mathGeneral::PI/2);
+    float left_foot_y = y + offsetDistance * sin(heading - mathGeneral::PI/2);
+    float left_foot_distance = sqrt(pow(left_foot_x,2) + pow(left_foot_y,2));
+
+    float right_foot_x = x + offsetDistance * cos(heading + mathGeneral::PI/2);
+    float right_foot_y = y + offsetDistance * sin(heading + mathGeneral::PI/2);
+    float right_foot_distance = sqrt(pow(right_foot_x,2) + pow(right_foot_y,2));
+
+    if (left_foot_distance < right_foot_distance)
+    {   // if the calculated left foot position is closer, then pick that one
+        x = left_foot_x;
+        y = left_foot_y;
+    }
+    else
+    {
+        x = right_foot_x;
+        y = right_foot_y;
+    }
+
+    distance = sqrt(x*x + y*y);
+    bearing = atan2(y,x);
+
+    // calculate the component to position the ball at the kicking distance
+    float position_speed;
+    float position_direction;
+    float position_rotation;
+    if (distance < kickingdistance)
+    {   // if we are too close to the ball then we need to go backwards
+        position_speed = 0.1;
+        position_direction = mathGeneral::normaliseAngle(bearing + mathGeneral::PI);
+        if (bearing < mathGeneral::PI/8.)
+            position_rotation = mathGeneral::sign(heading)*0.3;
+        else if (bearing > mathGeneral::PI/3.)
+            position_rotation = mathGeneral::sign(bearing)*0.3;
+        else
+            position_rotation = 0.;
+    }
+    else if (distance < stoppingdistance)
+    {   // if we are close enough to slow down
+        position_speed = (distance - kickingdistance+3.)/(stoppingdistance - kickingdistance+3.);
+        position_direction = bearing;
+        position_rotation = 0.7*bearing;
+
+        // boost the sidestepping when lining up
+        if (position_speed < 0.3 and fabs(bearing) < mathGeneral::PI/3.)
+            position_speed += 0.13;
+    }
+    else
+    {   // if it is outside the stopping distance - full speed
+        if (fabs(bearing) < 0.3 or (fabs(bearing) < 0.5 and distance > stoppingdistance)) {
+            position_speed = 1.0;
+            position_direction = bearing*0.6;
+            position_rotation = 0.;
+        } else {
+            position_speed = 0.2;
+            position_direction = mathGeneral::normaliseAngle(bearing - mathGeneral::sign(heading)*mathGeneral::PI/2);
+            position_rotation = 0.5*bearing;
+        }
+    }
+
+    // calculate the component to go around the ball to face the heading
+    float around_speed;
+    float around_direction;
+    float around_rotation;
+    if ((distance < stoppingdistance and distance > 1.5*kickingdistance) or distance < 1.15*kickingdistance)
+    {   // if we are close enough to worry about the heading
+        float heading_gain = 0.5;
+        if (distance < 1.25*kickingdistance)
+            heading_gain = 0.2;
+        const float heading_threshold = mathGeneral::PI/3;
+        if (fabs(heading) < heading_threshold)
+            around_speed = (heading_gain/heading_threshold)*fabs(heading);
+        else
+            around_speed = heading_gain;
+        if (fabs(heading) > 2.85)
+            around_direction = mathGeneral::normaliseAngle(bearing + mathGeneral::PI/2);
+        else
+            around_direction = mathGeneral::normaliseAngle(bearing - mathGeneral::sign(heading)*mathGeneral::PI/2);
+        around_rotation = -mathGeneral::sign(around_direction)*around_speed/distance/2.;        // 11 is rough speed in cm/s
+    }
+    else
+    {
+        around_speed = 0;
+        around_direction = 0;
+        around_rotation = 0;
+    }
+
+    result[0] = std::max(position_speed, around_speed);
+    result[1] = (position_speed*position_direction + around_speed*around_direction)/(std::max(position_speed,0.3f)+around_speed);
+    result[2] = (position_speed*position_rotation + around_speed*around_rotation)/(position_speed+around_speed);
+    result[2] = std::min(fabs(result[2]), 0.3f) * mathGeneral::sign(result[2]);
+}
+
+/*! @brief Calculates the speed to avoid a point
+    @param distance the distance in cm to the point
+    @param bearing the bearing to the point
+    @param objectsize the radius in cm of the object to avoid
+    @param dontcaredistance the distance in cm at which I make no attempt to avoid the object
+    @param result the speed
+ */
+void NavigationKernel::avoidPoint(float distance, float bearing, float objectsize, float dontcaredistance, NavigationVector& result)
+{
+    result = NavigationVector();
+    if (distance > dontcaredistance)
+        return;             // if the object is too far away don't avoid it
+
+    // calculate the translational speed --- max if inside the object and reduces to zero at dontcaredistance
+    if (distance < objectsize)
+        result[0] = 1;
+    else
+        result[0] = (distance - dontcaredistance)/(objectsize - dontcaredistance);
+    // calculate the translational bearing --- away
+    if (fabs(bearing) < 0.1)
+        result[1] = mathGeneral::PI/2;
+    else
+        result[1] = bearing - mathGeneral::sign(bearing)*mathGeneral::PI/2;
+    // calculate the rotational speed --- spin facing object if infront, spin away if behind
+    float y = distance*sin(bearing);
+    float x = distance*cos(bearing);
+    if (fabs(y) < objectsize)
+        result[2] = atan2(y - mathGeneral::sign(y)*objectsize, x);
+    else
+        result[2] = 0;
+}
+
+/*! @brief Calculates the vector sum of the potentials. The speed is the largest of their speeds, and the rotations are added.
+    @param potentials the potentials
+    @param num_potentials the number of potentials
+    @param result the sum
+ */
+void NavigationKernel::sumPotentials(const NavigationVector* potentials, unsigned int num_potentials, NavigationVector& result)
+{
+    float xsum = 0;
+    float ysum = 0;
+    float yawsum = 0;
+    float maxspeed = 0;
+    for (unsigned int i=0; i<num_potentials; i++)
+    {
+        if (potentials[i][0] > maxspeed)
+            maxspeed = potentials[i][0];
+        xsum += potentials[i][0]*cos(potentials[i][1]);
+        ysum += potentials[i][0]*sin(potentials[i][1]);
+        yawsum += potentials[i][2];
+    }
+    result[0] = maxspeed;
+    result[1] = atan2(ysum,xsum);
+    result[2] = yawsum;
+}
+
+/*! @brief Calculates the speed of each robot going to its target, updating each robot's state
+    @param robots the robots, each with its state, target and obstacles. Each robot's speed is set.
+    @param num_robots the number of robots
+    @param obstacles the obstacles of all of the robots
+    @param stoppeddistance the distance in cm to the target at which a robot will stop walking
+    @param stoppingdistance the distance in cm from the target a robot will start to slow
+ */
+void NavigationKernel::goToPoint(NavigationRobot* robots, unsigned int num_robots, const NavigationObstacle* obstacles, float stoppeddistance, float stoppingdistance)
+{
+    for (unsigned int i=0; i<num_robots; i++)
+    {
+        NavigationRobot& robot = robots[i];
+        goToPoint(robot.state, robot.target, obstacles + robot.first_obstacle, robot.num_obstacles, stoppeddistance, stoppingdistance, robot.speed);
+    }
+}
+
+/*! @brief Calculates the speed one robot would have going to each of several candidate targets. The robot's state is not changed;
+           each candidate is evaluated from a copy of it, so the results are what goToPoint would return for that candidate.
+    @param state the robot's navigation state
+    @param candidates the targets
+    @param num_candidates the number of targets
+    @param obstacles the robot's obstacles
+    @param num_obstacles the number of obstacles
+    @param stoppeddistance the distance in cm to the target at which the robot will stop walking
+    @param stoppingdistance the distance in cm from the target the robot will start to slow
+    @param results the speed for each candidate
+ */
+void NavigationKernel::goToPointCandidates(const NavigationState& state, const NavigationTarget* candidates, unsigned int num_candidates, const NavigationObstacle* obstacles, unsigned int num_obstacles, float stoppeddistance, float stoppingdistance, NavigationVector* results)
+{
+    for (unsigned int i=0; i<num_candidates; i++)
+    {
+        NavigationState copy = state;
+        goToPoint(copy, candidates[i], obstacles, num_obstacles, stoppeddistance, stoppingdistance, results[i]);
+    }
+}
+
+/*! @brief Calculates the speed to go to each of several balls
+    @param balls the balls' distances and bearings, and the desired headings
+    @param num_balls the number of balls
+    @param kickingdistance the distance to the ball at which the robot stops walking
+    @param stoppingdistance the distance to the ball at which the robot slows down
+    @param results the speed for each ball
+ */
+void NavigationKernel::goToBall(const NavigationTarget* balls, unsigned int num_balls, float kickingdistance, float stoppingdistance, NavigationVector* results)
+{
+    for (unsigned int i=0; i<num_balls; i++)
+        goToBall(balls[i], kickingdistance, stoppingdistance, results[i]);
+}
+
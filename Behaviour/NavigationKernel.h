@@ -0,0 +1,112 @@
+/*! @file NavigationKernel.h
+    @brief Declaration of the navigation kernel behind the behaviour motor schemas in BehaviourPotentials
+
+    @class NavigationKernel
+    @brief The go to point, go to ball, avoid and sum potentials calculations, without a Blackboard.
+
+    Everything the calculations remember between calls (the turning hysteresis) is kept in a NavigationState,
+    which the caller owns, one per robot. The results are fixed size NavigationVectors written into space the
+    caller provides, so nothing is allocated, and the kernel can be called from several threads at once, for
+    many robots or many candidate targets. The batch functions evaluate whole arrays of these in one call.
+
+    Every speed is [trans_speed, trans_direction, rot_speed], as in BehaviourPotentials.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NAVIGATION_KERNEL_H
+#define NAVIGATION_KERNEL_H
+
+#include <vector>
+
+/*! @brief A speed [trans_speed, trans_direction, rot_speed] */
+struct NavigationVector
+{
+    float v[3];
+
+    NavigationVector() {v[0] = 0; v[1] = 0; v[2] = 0;}
+    float& operator[](int i) {return v[i];}
+    const float& operator[](int i) const {return v[i];}
+    std::vector<float> toVector() const {return std::vector<float>(v, v + 3);}
+};
+
+/*! @brief An obstacle seen by the robot, as a distance (cm) and bearing (rad) to its centre, and the angle it covers either side of it */
+struct NavigationObstacle
+{
+    float distance;
+    float bearing;
+    float arc_width;
+};
+
+/*! @brief A point relative to the robot, with the heading (rad) the robot should have when it gets there */
+struct NavigationTarget
+{
+    float distance;
+    float bearing;
+    float heading;
+};
+
+/*! @brief The turning hysteresis of one robot */
+struct NavigationState
+{
+    bool point_turning;                 //!< true if goToPoint was turning toward the point
+    bool point_turning_left;
+    bool backwards_turning;             //!< true if goToPointBackwards was turning
+    bool backwards_turning_left;
+    bool kick_turning;                  //!< true if goToKickPosition was turning toward the kicking position
+    bool kick_turning_left;
+
+    NavigationState() {reset();}
+    void reset()
+    {
+        point_turning = false;
+        point_turning_left = false;
+        backwards_turning = false;
+        backwards_turning_left = false;
+        kick_turning = false;
+        kick_turning_left = false;
+    }
+};
+
+/*! @brief One robot of a batch, with its obstacles at [first_obstacle, first_obstacle + num_obstacles) of the batch's obstacles */
+struct NavigationRobot
+{
+    NavigationState state;
+    NavigationTarget target;
+    unsigned int first_obstacle;
+    unsigned int num_obstacles;
+    NavigationVector speed;             //!< the result
+};
+
+class NavigationKernel
+{
+public:
+    static const unsigned int MaxObstacles = 16;        //!< the most obstacles BehaviourPotentials passes to the kernel
+
+    static float avoidObstacles(const NavigationObstacle* obstacles, unsigned int num_obstacles, float bearing, float mindistance, float maxdistance);
+
+    static void goToPoint(NavigationState& state, const NavigationTarget& target, const NavigationObstacle* obstacles, unsigned int num_obstacles, float stoppeddistance, float stoppingdistance, NavigationVector& result);
+    static void goToPointBackwards(NavigationState& state, const NavigationTarget& target, float stoppeddistance, float stoppingdistance, NavigationVector& result);
+    static void goToKickPosition(NavigationState& state, float kickpositionbearing, float balldistance, float ballbearing, float goalbearing, const NavigationObstacle* obstacles, unsigned int num_obstacles, float kickingdistance, float stoppingdistance, NavigationVector& result);
+    static void goToBall(const NavigationTarget& ball, float kickingdistance, float stoppingdistance, NavigationVector& result);
+    static void avoidPoint(float distance, float bearing, float objectsize, float dontcaredistance, NavigationVector& result);
+    static void sumPotentials(const NavigationVector* potentials, unsigned int num_potentials, NavigationVector& result);
+
+    static void goToPoint(NavigationRobot* robots, unsigned int num_robots, const NavigationObstacle* obstacles, float stoppeddistance, float stoppingdistance);
+    static void goToPointCandidates(const NavigationState& state, const NavigationTarget* candidates, unsigned int num_candidates, const NavigationObstacle* obstacles, unsigned int num_obstacles, float stoppeddistance, float stoppingdistance, NavigationVector* results);
+    static void goToBall(const NavigationTarget* balls, unsigned int num_balls, float kickingdistance, float stoppingdistance, NavigationVector* results);
+};
+
+#endif
+
@@ -25,6 +25,7 @@ SET (YOUR_SRCS  BehaviourProvider.cpp BehaviourProvider.h
                 BehaviourState.cpp BehaviourState.h
                 BehaviourFSMState.cpp BehaviourFSMState.h
                 BehaviourPotentials.h
+                NavigationKernel.cpp NavigationKernel.h
                 Behaviour.cpp Behaviour.h
 )
 ####################################################################################
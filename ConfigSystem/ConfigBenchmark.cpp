@@ -0,0 +1,169 @@
+/*!
+    @file ConfigBenchmark.cpp
+    @brief Compares reading parameters by path with reading them through
+           ConfigHandles, using every parameter in the Darwin configuration.
+
+    Build with 'make ConfigBenchmark', and run from the directory containing
+    'nubot/Config/Darwin/defaultConfig.json'.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/foreach.hpp>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <iostream>
+
+#include <time.h>
+
+#include "ConfigManager.h"
+
+using namespace ConfigSystem;
+using boost::property_tree::ptree;
+
+//! The path, name and type of a parameter in the configuration.
+struct ParamName
+{
+    std::string path;
+    std::string name;
+    std::string type;
+};
+
+//! An object that counts its updates.
+class CountingModule : public Configurable
+{
+public:
+    CountingModule() : numLoads(0), numUpdates(0) {}
+    void loadConfig()   { numLoads++;   }
+    void updateConfig() { numUpdates++; }
+    int numLoads;
+    int numUpdates;
+};
+
+//! Finds every parameter (i.e. node with a type and a value) in the tree.
+void findParams(const ptree &tree, const std::string &path, std::vector<ParamName> &params)
+{
+    BOOST_FOREACH(const ptree::value_type &child, tree)
+    {
+        if(child.second.count("type") and child.second.count("value"))
+        {
+            ParamName p;
+            p.path = path;
+            p.name = child.first;
+            p.type = child.second.get<std::string>("type");
+            params.push_back(p);
+        }
+        else
+            findParams(child.second, path.empty()? child.first : path + "." + child.first, params);
+    }
+}
+
+double timeNow()
+{
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return 1e3*t.tv_sec + 1e-6*t.tv_nsec;
+}
+
+void printTime(const std::string &what, double ms, long n, const std::string &per)
+{
+    std::cout << "    " << what << ": " << 1e6*ms/n << " ns/" << per
+              << " (" << ms << " ms for " << n << ")" << std::endl;
+}
+
+
+int main(int argc, char** argv)
+{
+    std::string configName = (argc > 1)? argv[1] : "defaultConfig";
+    const int numFrames  = 20;
+    const int numModules = 64;
+
+    double start = timeNow();
+    ConfigManager config(configName);
+    double loadTime = timeNow() - start;
+
+    ptree root;
+    read_json("nubot/Config/Darwin/" + configName + ".json", root);
+    std::vector<ParamName> params;
+    findParams(root, "", params);
+
+    std::vector<ParamName> doubles;
+    BOOST_FOREACH(const ParamName &p, params)
+        if(p.type == "double") doubles.push_back(p);
+
+    std::cout << "Loaded '" << configName << "' (" << params.size() << " parameters, "
+              << doubles.size() << " doubles) in " << loadTime << " ms." << std::endl;
+
+    // Read every double as if each were read once per frame:
+    double sumPath = 0;
+    start = timeNow();
+    for(int f = 0; f < numFrames; f++)
+        BOOST_FOREACH(const ParamName &p, doubles)
+        {
+            double v = 0;
+            config.ReadValue(p.path, p.name, &v);
+            sumPath += v;
+        }
+    printTime("ReadValue(path, name)", timeNow() - start, numFrames*doubles.size(), "read");
+
+    std::vector<ConfigHandle<double> > handles(doubles.size());
+    start = timeNow();
+    for(size_t i = 0; i < doubles.size(); i++)
+        config.GetParamHandle(doubles[i].path, doubles[i].name, &handles[i]);
+    printTime("GetParamHandle(path, name)", timeNow() - start, doubles.size(), "handle");
+
+    double sumHandle = 0;
+    start = timeNow();
+    for(int f = 0; f < 1000*numFrames; f++)
+        for(size_t i = 0; i < handles.size(); i++)
+            if(handles[i].isValid()) sumHandle += handles[i].get();
+    sumHandle /= 1000;
+    printTime("ConfigHandle::get()", timeNow() - start, 1000*numFrames*handles.size(), "read");
+    std::cout << "    (sums " << sumPath << " and " << sumHandle << ")" << std::endl;
+
+    // Objects watching different parts of the configuration:
+    std::vector<CountingModule> modules(numModules);
+    for(int i = 0; i < numModules; i++)
+    {
+        modules[i].setConfigBasePath(doubles[(i*doubles.size())/numModules].path);
+        config.AddConfigObject(&modules[i]);
+    }
+
+    start = timeNow();
+    for(int f = 0; f < 100000; f++)
+        config.UpdateConfiguration();
+    printTime("UpdateConfiguration() with no changes", timeNow() - start, 100000, "frame");
+
+    // Change one parameter each frame:
+    unsigned int version = handles[0].getVersion();
+    start = timeNow();
+    for(int f = 0; f < 1000; f++)
+    {
+        config.SetValue(doubles[0].path, doubles[0].name, (double) f);
+        config.UpdateConfiguration();
+    }
+    printTime("SetValue(path, name) + UpdateConfiguration()", timeNow() - start, 1000, "frame");
+
+    int numUpdates = 0;
+    BOOST_FOREACH(const CountingModule &m, modules)
+        numUpdates += m.numUpdates;
+    bool correct = handles[0].hasChanged(&version) and handles[0].get() == 999.0;
+    std::cout << "    handle " << (correct? "followed" : "DID NOT FOLLOW") << " the changes ("
+              << numUpdates << " module updates)" << std::endl;
+
+    return correct? 0 : 1;
+}
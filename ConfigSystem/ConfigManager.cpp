@@ -48,6 +48,10 @@ namespace ConfigSystem
         }
         else
         {
+            // Copy the new configuration into the parameter handles first,
+            // since the configObjects may read from them.
+            refreshParamHandles();
+
             // Send the new configuration to the configObjects
             // #warning Should occur within UpdateConfiguration()
             reconfigureConfigObjects();
@@ -117,10 +121,15 @@ namespace ConfigSystem
 
     void ConfigManager::updateConfigObjects()
     {
-        BOOST_FOREACH(Configurable* c, _configObjects)
-        {
-            if(c == NULL) continue;
+        if(_outdatedObjects.empty()) return;
+
+        // Objects marked by the updates themselves are queued for next time.
+        std::vector<Configurable*> outdated;
+        outdated.swap(_outdatedObjects);
 
+        BOOST_FOREACH(Configurable* c, outdated)
+        {
+            // c may have been reconfigured since it was queued
             if(c->isConfigOutdated())
             {
                 c->updateConfig();
@@ -128,6 +137,13 @@ namespace ConfigSystem
             }
         }
     }
+
+    void ConfigManager::markConfigObject(Configurable* c)
+    {
+        if(c->isConfigOutdated()) return;
+        c->setConfigAsOutdated();
+        _outdatedObjects.push_back(c);
+    }
     
     void ConfigManager::markConfigObjects(
             const std::string &paramPath,
@@ -146,9 +162,146 @@ namespace ConfigSystem
             // (such a data structure would be initialised within 
             // ConfigManager::SetConfigObjects(...))
             if(boost::starts_with(paramPath, c->getConfigBasePath()))
-                c->setConfigAsOutdated();
+                markConfigObject(c);
+        }
+    }
+
+    bool ConfigManager::watchSlot(size_t slot, Configurable* configObject)
+    {
+        if(configObject == NULL) return false;
+        _valueStore.addWatcher(slot, configObject);
+        return true;
+    }
+
+    template<typename T>
+    void ConfigManager::updateParamHandle(
+        const std::string &paramPath,
+        const std::string &paramName,
+        const T &value
+        )
+    {
+        size_t slot;
+        if(!_valueStore.findSlot(paramPath, paramName, &slot)) return;
+        if(!_valueStore.setValue(slot, value)) return;
+
+        BOOST_FOREACH(Configurable* c, _valueStore.getWatchers(slot))
+            markConfigObject(c);
+    }
+
+    template<typename T>
+    void ConfigManager::refreshParamHandle(size_t slot)
+    {
+        const std::string &paramPath = _valueStore.getPath(slot);
+        const std::string &paramName = _valueStore.getName(slot);
+
+        T value;
+        ConfigParameter cp(vt_none);
+        if(!_currConfigTree->getParam(paramPath, paramName, cp) || !cp.getValue(&value))
+        {
+            std::cout << "ConfigManager::refreshParamHandle(...): "
+                      << paramPath << "." << paramName
+                      << " is not in the new configuration; its handles keep their old value."
+                      << std::endl;
+            return;
+        }
+        updateParamHandle(paramPath, paramName, value);
+    }
+
+    void ConfigManager::refreshParamHandles()
+    {
+        for(size_t slot = 0; slot < _valueStore.size(); slot++)
+        {
+            switch(_valueStore.getType(slot))
+            {
+                case vt_long           : refreshParamHandle<long         >(slot); break;
+                case vt_double         : refreshParamHandle<double       >(slot); break;
+                case vt_string         : refreshParamHandle<std::string  >(slot); break;
+                case vt_1dvector_long  : refreshParamHandle<std::vector<long> >(slot); break;
+                case vt_2dvector_long  : refreshParamHandle<Vector2Long  >(slot); break;
+                case vt_3dvector_long  : refreshParamHandle<Vector3Long  >(slot); break;
+                case vt_1dvector_double: refreshParamHandle<std::vector<double> >(slot); break;
+                case vt_2dvector_double: refreshParamHandle<Vector2Double>(slot); break;
+                case vt_3dvector_double: refreshParamHandle<Vector3Double>(slot); break;
+                default: break;
+            }
+        }
+    }
+
+
+    template<typename T>
+    bool ConfigManager::GetParamHandle(
+        const std::string &paramPath,
+        const std::string &paramName,
+        ConfigHandle<T>* handle
+        )
+    {
+        CONFIGSYS_DEBUG_CALLS;
+        if(handle == NULL)
+        {
+            std::cout << __PRETTY_FUNCTION__ << ":"
+                      << " 'handle' must not be NULL."
+                      << std::endl;
+            return false;
         }
+
+        //! Only resolve the path the first time a handle is requested
+        size_t slot;
+        if(!_valueStore.findSlot(paramPath, paramName, &slot))
+        {
+            T value;
+            ConfigParameter cp(vt_none);
+            if(!_currConfigTree->getParam(paramPath, paramName, cp)) return false;
+            if(!cp.getValue(&value)) return false;
+            slot = _valueStore.addSlot(paramPath, paramName, value);
+        }
+
+        if(!_valueStore.makeHandle(slot, handle))
+        {
+            std::cout << "ConfigManager::GetParamHandle(...): "
+                      << paramPath << "." << paramName << " is a "
+                      << makeValueTypeString(_valueStore.getType(slot)) << "."
+                      << std::endl;
+            return false;
+        }
+        return true;
     }
+
+    template bool ConfigManager::GetParamHandle<long> (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<long> *handle
+        );
+    template bool ConfigManager::GetParamHandle<double> (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<double> *handle
+        );
+    template bool ConfigManager::GetParamHandle<std::string> (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<std::string> *handle
+        );
+    template bool ConfigManager::GetParamHandle<std::vector<long> > (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<std::vector<long> > *handle
+        );
+    template bool ConfigManager::GetParamHandle<std::vector<std::vector<long> > > (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<std::vector<std::vector<long> > > *handle
+        );
+    template bool ConfigManager::GetParamHandle<std::vector<std::vector<std::vector<long> > > > (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<std::vector<std::vector<std::vector<long> > > > *handle
+        );
+    template bool ConfigManager::GetParamHandle<std::vector<double> > (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<std::vector<double> > *handle
+        );
+    template bool ConfigManager::GetParamHandle<std::vector<std::vector<double> > > (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<std::vector<std::vector<double> > > *handle
+        );
+    template bool ConfigManager::GetParamHandle<std::vector<std::vector<std::vector<double> > > > (
+        const std::string &paramPath, const std::string &paramName,
+        ConfigHandle<std::vector<std::vector<std::vector<double> > > > *handle
+        );
     
     
     template<typename T>
@@ -176,6 +329,10 @@ namespace ConfigSystem
         //! Store the new parameter into the tree
         if(!_currConfigTree->storeParam(paramPath, paramName, cp)) return false;
         
+        //! Update the handles to this parameter (if it was deleted and is
+        //! being re-created)
+        updateParamHandle(paramPath, paramName, initialValue);
+
         //! Request update of configObjects that depend on this parameter
         //! (these actually might exist)
         markConfigObjects(paramPath, paramName);
@@ -393,11 +550,15 @@ namespace ConfigSystem
         if(!_currConfigTree->getParam(paramPath, paramName, cp)) return false;
         
         //! Set the new value
+        //! (data is clipped to the parameter's range if it has autoClip set)
         if(!cp.setValue(data)) return false; 
         
         //! Store the modified parameter back into the tree
         if(!_currConfigTree->storeParam(paramPath, paramName, cp)) return false;
         
+        //! Update the handles to this parameter
+        updateParamHandle(paramPath, paramName, data);
+
         //! Request update of configObjects that depend on this parameter
         markConfigObjects(paramPath, paramName);
 
@@ -12,8 +12,14 @@
     configuration, it should inherit from 'ConfigSystem::Configurable', and use
     'ConfigManager::AddConfigObject(Configurable*)' to add itself to the list
     of objects that the ConfigManager 'manages'.
-    The ConfigManager updates the objects it manages on every iteration of the
-    see-think thread (updating only those that need updating).
+    When a parameter changes, the objects that depend on it are queued, and
+    the queued objects are updated on the next iteration of the see-think
+    thread. If nothing has changed an iteration costs nothing.
+
+    Code that reads a parameter often (e.g. every frame) should get a
+    'ConfigHandle' for it with 'ConfigManager::GetParamHandle(...)' instead of
+    calling 'ReadValue(...)' each time. The parameter's path is only resolved
+    once, and reading it through the handle is constant time.
     
     Note: Creating more that one ConfigManager will cause errors in the
           config system's persistant store (i.e. not all changes to
@@ -50,6 +56,7 @@
 
 #include "ConfigStorageManager.h"
 #include "ConfigTree.h"
+#include "ConfigValueStore.h"
 #include "Configurable.h"
 
 namespace ConfigSystem
@@ -88,6 +95,8 @@ namespace ConfigSystem
          * 
          *         This method is called once in every iteration of the main 
          *         loop in the run() method of the See-Think thread.
+         *         Only the objects queued by a change are visited, so this
+         *         does nothing if no parameter has changed.
          */
         void UpdateConfiguration();
         
@@ -108,6 +117,42 @@ namespace ConfigSystem
          */
         bool AddConfigObject(Configurable* config_object);
         
+        /*! @brief  Gets a handle through which the value of the named
+         *          parameter stored at the given path can be read in
+         *          constant time. The path is only resolved the first time
+         *          a handle to the parameter is requested.
+         *          The handle always holds the parameter's current value; it
+         *          is updated whenever the parameter is set or a
+         *          configuration is loaded.
+         *          (If the parameter is deleted, the handle keeps its last value)
+         *  @param  param_path Path to the desired parameter.
+         *  @param  param_name Name of the desired parameter.
+         *  @param  handle The handle to set.
+         *  @return Whether the operation was successful.
+         *          (fails if the parameter doesn't exist or has a different type)
+         */
+        template<typename T>
+        bool GetParamHandle(
+            const std::string &param_path,
+            const std::string &param_name,
+            ConfigHandle<T>* handle);
+
+        /*! @brief  Queues the given object to be updated (by calling its
+         *          'Configurable::updateConfig()' method) whenever the value
+         *          of the parameter referred to by the given handle changes,
+         *          regardless of the object's base path.
+         *  @param  handle A handle to the parameter to watch.
+         *  @param  config_object The object to update.
+         *  @return Returns whether or not the operation succeeded.
+         *          (returns false if config_object is NULL or the handle is invalid)
+         */
+        template<typename T>
+        bool WatchParam(const ConfigHandle<T> &handle, Configurable* config_object)
+        {
+            if(!handle.isValid()) return false;
+            return watchSlot(handle.getSlot(), config_object);
+        }
+
         /*! @brief Creates a new parameter with the given name, stored at the 
          *         given path, and having the given initial value.
          *         (An attempt to 'create' an existing parameter will fail)
@@ -238,6 +283,13 @@ namespace ConfigSystem
          // This should be a std::unordered_set
         std::vector<Configurable*> _configObjects;
 
+        /*! The objects that have been marked as outdated since the last call
+         *  to 'UpdateConfiguration()'. */
+        std::vector<Configurable*> _outdatedObjects;
+
+        /*! Copies of the parameters that handles have been requested for. */
+        ConfigValueStore _valueStore;
+
         /*! @brief     Update all config_objects that depend on the given 
          *             parameter.
          *  @param     param_path Path to check.
@@ -254,6 +306,35 @@ namespace ConfigSystem
             const std::string &param_path,
             const std::string &param_name);
 
+        /*! @brief Marks a config_object as having had its configuration
+         *         modified, and queues it to be updated.
+         */
+        void markConfigObject(Configurable* c);
+
+        /*! @brief Adds config_object to the watchers of the parameter in the
+         *         given slot of the value store.
+         */
+        bool watchSlot(size_t slot, Configurable* config_object);
+
+        /*! @brief  Copies a new value of a parameter into the value store,
+         *          if a handle to the parameter has been requested, and
+         *          marks the parameter's watchers if its value changed.
+         */
+        template<typename T>
+        void updateParamHandle(
+            const std::string &param_path,
+            const std::string &param_name,
+            const T &value);
+
+        /*! @brief Re-reads every parameter in the value store from the
+         *         current configuration (i.e. after a new one is loaded).
+         */
+        void refreshParamHandles();
+
+        //! Re-reads the parameter in the given slot of the value store.
+        template<typename T>
+        void refreshParamHandle(size_t slot);
+
         /*! @brief Reconfigures the config_objects by calling 
          *         'reconfigureConfigObject(Configurable*)'
          *         on each of them.
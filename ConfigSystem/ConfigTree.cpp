@@ -50,7 +50,7 @@ namespace ConfigSystem
     }
 
 
-    std::string ConfigTree::makeFullParamPath(const std::string paramPath, const std::string paramName)
+    std::string ConfigTree::makeFullParamPath(const std::string &paramPath, const std::string &paramName)
     {
         return paramPath + "." + paramName;
     }
@@ -61,8 +61,8 @@ namespace ConfigSystem
     }
 
     bool ConfigTree::checkParam (
-            const std::string paramPath, 
-            const std::string paramName
+            const std::string &paramPath, 
+            const std::string &paramName
             )
     {
         CONFIGSYS_DEBUG_CALLS;
@@ -76,7 +76,8 @@ namespace ConfigSystem
         try
         {
             // Get the subtree representing the desired parameter.
-            ptree paramSubtree = _treeRoot.get_child(fullPath);
+            // (by reference, since copying a ptree copies all of its children)
+            const ptree &paramSubtree = _treeRoot.get_child(fullPath);
 
             // Convert the parameter subtree into a parameter object.
             ConfigParameter cp(vt_none);
@@ -91,8 +92,8 @@ namespace ConfigSystem
     }
 
     bool ConfigTree::getParam (
-            const std::string paramPath, 
-            const std::string paramName, 
+            const std::string &paramPath, 
+            const std::string &paramName, 
             ConfigParameter &data
             )
     {
@@ -107,7 +108,8 @@ namespace ConfigSystem
         try
         {
             // Get the subtree representing the desired parameter.
-            ptree paramSubtree = _treeRoot.get_child(fullPath);
+            // (by reference, since copying a ptree copies all of its children)
+            const ptree &paramSubtree = _treeRoot.get_child(fullPath);
 
             // Convert the parameter subtree into a parameter object.
             success = paramFromPtree(paramSubtree, data);
@@ -124,8 +126,8 @@ namespace ConfigSystem
     }
 
     bool ConfigTree::storeParam (
-            const std::string paramPath, 
-            const std::string paramName, 
+            const std::string &paramPath, 
+            const std::string &paramName, 
             ConfigParameter data
             )
     {
@@ -178,7 +180,7 @@ namespace ConfigSystem
         try
         {
             // get the parent node
-            ptree paramParent = _treeRoot.get_child(fullPath);
+            ptree &paramParent = _treeRoot.get_child(fullPath);
 
             // Delete the parameter.
             // (Note: Only erases 'direct children'.
@@ -192,9 +194,6 @@ namespace ConfigSystem
                             << std::endl;
                 return false; // return failure if nothing was erased
             }
-            
-            // put back the modified parent node
-            _treeRoot.put_child(fullPath, paramParent);
         }
         catch (boost::property_tree::ptree_error e)
         {
@@ -208,7 +207,7 @@ namespace ConfigSystem
     }
 
 
-    bool ConfigTree::paramFromPtree(ptree fromPtree, ConfigParameter &toParam)
+    bool ConfigTree::paramFromPtree(const ptree &fromPtree, ConfigParameter &toParam)
     {
         CONFIGSYS_DEBUG_CALLS;
 
@@ -250,7 +249,7 @@ namespace ConfigSystem
         return addParamValueandRangeToPtree(fromParam, toPtree);
     }
 
-    bool ConfigTree::addPtreeValueandRangeToParam(ptree fromPtree, ConfigParameter &toParam)
+    bool ConfigTree::addPtreeValueandRangeToParam(const ptree &fromPtree, ConfigParameter &toParam)
     {
         CONFIGSYS_DEBUG_CALLS;
 
@@ -437,7 +436,7 @@ namespace ConfigSystem
     }
 
     
-    ptree ConfigTree::getRoot()
+    const ptree& ConfigTree::getRoot() const
     {
         return _treeRoot;
     }
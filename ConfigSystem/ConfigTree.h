@@ -74,8 +74,8 @@ namespace ConfigSystem
          *  @return Returns whether a valid parameter exists.
          */
         bool checkParam (
-            const std::string paramPath,
-            const std::string paramName
+            const std::string &paramPath,
+            const std::string &paramName
             );
 
         /*! 
@@ -86,8 +86,8 @@ namespace ConfigSystem
          *  @return Returns whether the operation was successful.
          */
         bool getParam (
-            const std::string paramPath,
-            const std::string paramName,
+            const std::string &paramPath,
+            const std::string &paramName,
             ConfigParameter &data
             );
         
@@ -99,8 +99,8 @@ namespace ConfigSystem
          *  @return Returns whether the operation was successful.
          */
         bool storeParam (
-            const std::string paramPath, 
-            const std::string paramName, 
+            const std::string &paramPath, 
+            const std::string &paramName, 
             ConfigParameter data
             );
         
@@ -118,7 +118,7 @@ namespace ConfigSystem
         //! Return this tree's root node (This method is only intended to
         //! be used by ConfigStorageManager. Modifying the returned ptree
         //! is dangerous).
-        ptree getRoot();
+        const ptree& getRoot() const;
 
 
     private:
@@ -136,7 +136,7 @@ namespace ConfigSystem
          *  @return Returns whether the conversion succeeded (i.e. if the
          *          minimum set of required fields/keys were not present).
          */
-        bool paramFromPtree(ptree fromPtree, ConfigParameter &toParam);
+        bool paramFromPtree(const ptree &fromPtree, ConfigParameter &toParam);
 
         /*! 
          *  @brief  Converts a parameter object into a property tree that fully
@@ -165,14 +165,14 @@ namespace ConfigSystem
          *  @return A string containing the full path.
          */
         std::string makeFullParamPath(
-            const std::string paramPath,
-            const std::string paramName
+            const std::string &paramPath,
+            const std::string &paramName
             );
 
         //! Attempts to read parameter information from the given ptree
         //! into the given ConfigParameter.
         //! Returns whether the conversion was successful.
-        bool addPtreeValueandRangeToParam(ptree fromPtree, ConfigParameter &toParam);
+        bool addPtreeValueandRangeToParam(const ptree &fromPtree, ConfigParameter &toParam);
         
         /*! 
          *  @brief  Attempts to read and convert the "value" from the given
@@ -182,7 +182,7 @@ namespace ConfigSystem
          *  @return Whether the conversion was successful.
          */
         template<typename T>
-        bool addValueToParam(ptree fromPtree, ConfigParameter &toParam)
+        bool addValueToParam(const ptree &fromPtree, ConfigParameter &toParam)
         {
             T v = fromPtree.get<T>("value");
             if(!toParam.setValue(v)) return false;
@@ -198,13 +198,13 @@ namespace ConfigSystem
          */
         template<typename T>
         bool ptreeToVector1D(
-            ptree from_ptree, 
+            const ptree &from_ptree, 
             std::vector<T>& to_vector)
         {
             try
             {
                 //Retrieve values of type T from vector in tree and place in vector.
-                BOOST_FOREACH(ptree::value_type &child, from_ptree)
+                BOOST_FOREACH(const ptree::value_type &child, from_ptree)
                 {
                     T val = child.second.get<T>("");
                     to_vector.push_back(val);
@@ -227,13 +227,13 @@ namespace ConfigSystem
          */
         template<typename T>
         bool ptreeToVector2D(
-            ptree from_ptree, 
+            const ptree &from_ptree, 
             std::vector<std::vector<T> >& to_vector)
         {
             try
             {
                 //Retrieve values of type T from vector in tree and place in vector.
-                BOOST_FOREACH(ptree::value_type &child, from_ptree)
+                BOOST_FOREACH(const ptree::value_type &child, from_ptree)
                 {
                     std::vector<T> vec;
 
@@ -269,13 +269,13 @@ namespace ConfigSystem
          */
         template<typename T>
         bool ptreeToVector3D(
-            ptree from_ptree, 
+            const ptree &from_ptree, 
             std::vector<std::vector<std::vector<T> > >& to_vector)
         {
             try
             {
                 //Retrieve values of type T from vector in tree and place in vector.
-                BOOST_FOREACH(ptree::value_type &child, from_ptree)
+                BOOST_FOREACH(const ptree::value_type &child, from_ptree)
                 {
                     std::vector<std::vector<T> > vec;
 
@@ -305,7 +305,7 @@ namespace ConfigSystem
 
 
         template<typename T>
-        bool addVectorValueToParam1D(ptree from_ptree, ConfigParameter &to_param)
+        bool addVectorValueToParam1D(const ptree &from_ptree, ConfigParameter &to_param)
         {
             try
             {
@@ -325,7 +325,7 @@ namespace ConfigSystem
             return true;
         }
         template<typename T>
-        bool addVectorValueToParam2D(ptree from_ptree, ConfigParameter &to_param)
+        bool addVectorValueToParam2D(const ptree &from_ptree, ConfigParameter &to_param)
         {
             try
             {
@@ -345,7 +345,7 @@ namespace ConfigSystem
             return true;
         }
         template<typename T>
-        bool addVectorValueToParam3D(ptree from_ptree, ConfigParameter &to_param)
+        bool addVectorValueToParam3D(const ptree &from_ptree, ConfigParameter &to_param)
         {
             try
             {
@@ -367,7 +367,7 @@ namespace ConfigSystem
         
 
         template<typename T>
-        bool addRangeToParam(ptree fromPtree, ConfigParameter &toParam)
+        bool addRangeToParam(const ptree &fromPtree, ConfigParameter &toParam)
         {
             // Read range
             std::string lBStr = fromPtree.get("range.lBound", "none");
@@ -0,0 +1,56 @@
+/*! @file ConfigValueStore.cpp
+    @brief Implementation of the ConfigValueStore class.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ConfigValueStore.h"
+
+#include <algorithm>
+
+namespace ConfigSystem
+{
+    ConfigValueStore::ConfigValueStore()
+    {
+        CONFIGSYS_DEBUG_CALLS;
+    }
+
+    bool ConfigValueStore::findSlot(
+            const std::string &paramPath,
+            const std::string &paramName,
+            size_t* slot
+            ) const
+    {
+        std::map<std::string, size_t>::const_iterator it = _slotIndex.find(makeKey(paramPath, paramName));
+        if(it == _slotIndex.end()) return false;
+        *slot = it->second;
+        return true;
+    }
+
+    void ConfigValueStore::addWatcher(size_t slot, Configurable* configObject)
+    {
+        std::vector<Configurable*>& watchers = _slots[slot].watchers;
+        if(std::find(watchers.begin(), watchers.end(), configObject) == watchers.end())
+            watchers.push_back(configObject);
+    }
+
+    std::string ConfigValueStore::makeKey(
+            const std::string &paramPath,
+            const std::string &paramName
+            )
+    {
+        // the same full path that ConfigTree uses
+        return paramPath + "." + paramName;
+    }
+}
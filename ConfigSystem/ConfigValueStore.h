@@ -0,0 +1,257 @@
+/*! @file ConfigValueStore.h
+    @brief Defines the ConfigValueStore class and the ConfigHandle used to
+           read parameters from it.
+
+    @class ConfigSystem::ConfigValueStore
+    @brief A flat copy of the parameters that have been registered through
+           'ConfigManager::GetParamHandle(...)'.
+
+    Parameters in the ConfigTree are found by walking a boost::property_tree
+    with their dotted path and converting the value from a string, which is
+    far too slow to do every frame.
+    Instead, code that reads a parameter often asks the ConfigManager for a
+    ConfigHandle once. The parameter's path is resolved when the handle is
+    created, and its value is copied into a contiguous table holding every
+    registered parameter of the same type. Reading the parameter through the
+    handle is then just an index into that table.
+
+    Every parameter in the store has a version that is incremented each time
+    its value actually changes, so a reader can cheaply tell whether it needs
+    to recompute anything derived from the parameter.
+    The ConfigManager keeps the store up to date; a ConfigValueStore should
+    not be modified by anything else.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ConfigValueStore_H
+#define ConfigValueStore_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ConfigParameter.h"
+
+class Configurable;
+
+namespace ConfigSystem
+{
+    //! Maps each type a parameter can be read as onto its value_type.
+    template<typename T> struct ConfigValueType { };
+    template<> struct ConfigValueType<long         > { static const value_type type = vt_long           ; };
+    template<> struct ConfigValueType<double       > { static const value_type type = vt_double         ; };
+    template<> struct ConfigValueType<std::string  > { static const value_type type = vt_string         ; };
+    template<> struct ConfigValueType<std::vector<long> >   { static const value_type type = vt_1dvector_long  ; };
+    template<> struct ConfigValueType<Vector2Long  > { static const value_type type = vt_2dvector_long  ; };
+    template<> struct ConfigValueType<Vector3Long  > { static const value_type type = vt_3dvector_long  ; };
+    template<> struct ConfigValueType<std::vector<double> > { static const value_type type = vt_1dvector_double; };
+    template<> struct ConfigValueType<Vector2Double> { static const value_type type = vt_2dvector_double; };
+    template<> struct ConfigValueType<Vector3Double> { static const value_type type = vt_3dvector_double; };
+
+    /*! The values and versions of every registered parameter of one type,
+     *  stored as two parallel arrays. */
+    template<typename T>
+    struct ConfigValueTable
+    {
+        std::vector<T>            values;
+        std::vector<unsigned int> versions;
+    };
+
+    /*!
+     *  @brief A typed reference to a parameter in the ConfigValueStore.
+     *
+     *  A default constructed handle is invalid; valid handles are only
+     *  created by 'ConfigManager::GetParamHandle(...)', and remain valid
+     *  for the lifetime of the ConfigManager that created them.
+     */
+    template<typename T>
+    class ConfigHandle
+    {
+    public:
+        ConfigHandle() : _table(NULL), _index(0), _slot(0) {}
+
+        //! Returns whether this handle refers to a parameter.
+        bool isValid() const { return _table != NULL; }
+
+        /*! @brief Returns the parameter's current value.
+         *  Note: The reference is only guaranteed to be valid until the
+         *        next handle of the same type is created.
+         */
+        const T& get() const { return _table->values[_index]; }
+
+        //! Returns the number of times the parameter's value has changed.
+        unsigned int getVersion() const { return _table->versions[_index]; }
+
+        /*! @brief  Returns whether the parameter has changed since the
+         *          given version, and updates the version if it has.
+         *  @param  version The version the caller last saw.
+         *  @return Whether the value is different to the one last seen.
+         */
+        bool hasChanged(unsigned int* version) const
+        {
+            unsigned int current = _table->versions[_index];
+            if(current == *version) return false;
+            *version = current;
+            return true;
+        }
+
+        //! Returns the index of the parameter in its ConfigValueStore.
+        size_t getSlot() const { return _slot; }
+
+    private:
+        friend class ConfigValueStore;
+
+        ConfigValueTable<T>* _table;    //!< the table holding the parameter's value.
+        size_t _index;                  //!< the parameter's index in _table.
+        size_t _slot;                   //!< the parameter's slot in the store.
+    };
+
+
+    class ConfigValueStore
+    {
+    public:
+        ConfigValueStore();
+
+        /*! @brief  Finds the slot of the parameter with the given path and name.
+         *  @param  param_path Path to the parameter.
+         *  @param  param_name Name of the parameter.
+         *  @param  slot The slot of the parameter, if it is in the store.
+         *  @return Whether the parameter is in the store.
+         */
+        bool findSlot(
+            const std::string &param_path,
+            const std::string &param_name,
+            size_t* slot) const;
+
+        /*! @brief  Adds a parameter to the store. The parameter must not
+         *          already be in the store.
+         *  @param  param_path Path to the parameter.
+         *  @param  param_name Name of the parameter.
+         *  @param  value The parameter's current value.
+         *  @return The slot of the new parameter.
+         */
+        template<typename T>
+        size_t addSlot(
+            const std::string &param_path,
+            const std::string &param_name,
+            const T &value)
+        {
+            ConfigValueTable<T>& table = getTable<T>();
+
+            Slot s;
+            s.type  = ConfigValueType<T>::type;
+            s.index = table.values.size();
+            s.path  = param_path;
+            s.name  = param_name;
+            table.values.push_back(value);
+            table.versions.push_back(0);
+
+            _slots.push_back(s);
+            _slotIndex[makeKey(param_path, param_name)] = _slots.size() - 1;
+            return _slots.size() - 1;
+        }
+
+        /*! @brief  Makes the given handle refer to the parameter in the given slot.
+         *  @return Whether the parameter has the handle's type.
+         */
+        template<typename T>
+        bool makeHandle(size_t slot, ConfigHandle<T>* handle)
+        {
+            if(getType(slot) != ConfigValueType<T>::type) return false;
+            handle->_table = &getTable<T>();
+            handle->_index = _slots[slot].index;
+            handle->_slot  = slot;
+            return true;
+        }
+
+        /*! @brief  Sets the value of the parameter in the given slot,
+         *          incrementing its version if the value is different.
+         *  @return Whether the value changed.
+         *          (also returns false if the parameter has a different type)
+         */
+        template<typename T>
+        bool setValue(size_t slot, const T &value)
+        {
+            if(getType(slot) != ConfigValueType<T>::type) return false;
+            ConfigValueTable<T>& table = getTable<T>();
+            size_t index = _slots[slot].index;
+            if(table.values[index] == value) return false;
+            table.values[index] = value;
+            table.versions[index]++;
+            return true;
+        }
+
+        //! Returns the number of parameters in the store.
+        size_t size() const { return _slots.size(); }
+
+        //! Returns the type of the parameter in the given slot.
+        value_type getType(size_t slot) const { return _slots[slot].type; }
+        //! Returns the path of the parameter in the given slot.
+        const std::string& getPath(size_t slot) const { return _slots[slot].path; }
+        //! Returns the name of the parameter in the given slot.
+        const std::string& getName(size_t slot) const { return _slots[slot].name; }
+
+        //! Adds an object to be notified when the parameter in the given slot changes.
+        void addWatcher(size_t slot, Configurable* config_object);
+        //! Returns the objects to notify when the parameter in the given slot changes.
+        const std::vector<Configurable*>& getWatchers(size_t slot) const { return _slots[slot].watchers; }
+
+    private:
+        //! The location of a parameter in its typed table.
+        struct Slot
+        {
+            value_type type;
+            size_t index;
+            std::string path;
+            std::string name;
+            std::vector<Configurable*> watchers;
+        };
+
+        std::vector<Slot> _slots;
+
+        /*! Maps the full path of each parameter in the store to its slot.
+         *  This is only used when handles are created. */
+        std::map<std::string, size_t> _slotIndex;
+
+        ConfigValueTable<long         > _longs;
+        ConfigValueTable<double       > _doubles;
+        ConfigValueTable<std::string  > _strings;
+        ConfigValueTable<std::vector<long> >   _vector1dLongs;
+        ConfigValueTable<Vector2Long  > _vector2dLongs;
+        ConfigValueTable<Vector3Long  > _vector3dLongs;
+        ConfigValueTable<std::vector<double> > _vector1dDoubles;
+        ConfigValueTable<Vector2Double> _vector2dDoubles;
+        ConfigValueTable<Vector3Double> _vector3dDoubles;
+
+        //! Returns the table storing parameters of type T.
+        template<typename T> ConfigValueTable<T>& getTable();
+
+        static std::string makeKey(
+            const std::string &param_path,
+            const std::string &param_name);
+    };
+
+    template<> inline ConfigValueTable<long         >& ConfigValueStore::getTable<long         >() { return _longs          ; }
+    template<> inline ConfigValueTable<double       >& ConfigValueStore::getTable<double       >() { return _doubles        ; }
+    template<> inline ConfigValueTable<std::string  >& ConfigValueStore::getTable<std::string  >() { return _strings        ; }
+    template<> inline ConfigValueTable<std::vector<long> >&   ConfigValueStore::getTable<std::vector<long> >()   { return _vector1dLongs  ; }
+    template<> inline ConfigValueTable<Vector2Long  >& ConfigValueStore::getTable<Vector2Long  >() { return _vector2dLongs  ; }
+    template<> inline ConfigValueTable<Vector3Long  >& ConfigValueStore::getTable<Vector3Long  >() { return _vector3dLongs  ; }
+    template<> inline ConfigValueTable<std::vector<double> >& ConfigValueStore::getTable<std::vector<double> >() { return _vector1dDoubles; }
+    template<> inline ConfigValueTable<Vector2Double>& ConfigValueStore::getTable<Vector2Double>() { return _vector2dDoubles; }
+    template<> inline ConfigValueTable<Vector3Double>& ConfigValueStore::getTable<Vector3Double>() { return _vector3dDoubles; }
+}
+
+#endif
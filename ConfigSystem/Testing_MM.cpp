@@ -299,6 +299,75 @@ bool testSaveLoad()
 }
 
 
+//! Counts the number of times its configuration is updated.
+class HandleWatcher : public Configurable
+{
+public:
+    HandleWatcher() : numUpdates(0) {}
+    void loadConfig()   {}
+    void updateConfig() { numUpdates++; }
+    int numUpdates;
+};
+
+bool testParamHandles()
+{
+    // Watchers are never removed, so this must outlive the config system.
+    static HandleWatcher watcher;
+
+    ConfigHandle<double> handle_d;
+    ConfigHandle<long  > handle_l;
+
+    // Get a handle:
+    // pass: If the handle is valid and holds the parameter's value.
+    startTimedTest();
+    bool res_h = config->GetParamHandle("Testing.MM", "param_double", &handle_d);
+    endTimedTest();
+    double read_d;
+    config->ReadValue("Testing.MM", "param_double", &read_d);
+    res_h &= handle_d.isValid() && handle_d.get() == read_d;
+    printTestResult("getHandle", res_h);
+
+    // Attempt to get a handle of the wrong type:
+    // pass: If no handle is returned.
+    bool res_t = !config->GetParamHandle("Testing.MM", "param_double", &handle_l);
+    res_t &= !handle_l.isValid();
+    printTestResult("getHandleAsIncorrectType", res_t);
+
+    // Set the parameter:
+    // pass: If the handle holds the new value, and its version has changed.
+    double store_d;
+    createTestValue<double>(store_d, 0, 100);
+    unsigned int version = handle_d.getVersion();
+    config->SetValue("Testing.MM", "param_double", store_d);
+    bool res_s = handle_d.get() == store_d && handle_d.hasChanged(&version);
+
+    // Set the parameter to the same value:
+    // pass: If the version hasn't changed.
+    config->SetValue("Testing.MM", "param_double", store_d);
+    res_s &= !handle_d.hasChanged(&version);
+    printTestResult("handleFollowsSetValue", res_s);
+
+    // Watch the parameter, and change it twice:
+    // pass: If the watcher is updated once, by the next UpdateConfiguration().
+    config->UpdateConfiguration();
+    config->WatchParam(handle_d, &watcher);
+    int updates = watcher.numUpdates;
+    store_d += 1;
+    config->SetValue("Testing.MM", "param_double", store_d);
+    store_d += 1;
+    config->SetValue("Testing.MM", "param_double", store_d);
+    bool res_w = watcher.numUpdates == updates;
+    config->UpdateConfiguration();
+    res_w &= watcher.numUpdates == updates + 1;
+    config->UpdateConfiguration();
+    res_w &= watcher.numUpdates == updates + 1;
+    printTestResult("watcherUpdatedOnce", res_w);
+    std::cout << std::endl;
+
+    return res_h && res_t && res_s && res_w;
+}
+
+
 
 int main(void)
 {
@@ -356,6 +425,9 @@ int main(void)
 
         std::cout << std::endl << "TEST: Auto-updating variables." << std::endl;
         res_all &= Module::autoUpdateTest();
+
+        std::cout << std::endl << "TEST: Parameter handles." << std::endl;
+        res_all &= testParamHandles();
     }
 
     if(res_all) std::cout << std::endl << "Testing complete: All tests passed." << std::endl;
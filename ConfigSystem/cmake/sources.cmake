@@ -24,6 +24,7 @@ SET (YOUR_SRCS ConfigManager.cpp
                ConfigParameter.cpp
                ConfigStorageManager.cpp
                ConfigTree.cpp
+               ConfigValueStore.cpp
                Configurable.cpp
                ###
                # Extra sources just for testing
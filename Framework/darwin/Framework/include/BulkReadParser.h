@@ -0,0 +1,82 @@
+#ifndef BULK_READ_PARSER_H
+#define BULK_READ_PARSER_H
+
+#include "MX28.h"
+
+#define MAXNUM_BULKREADDEVICES (256)
+
+namespace Robot
+{
+    class BulkReadData;
+}
+
+namespace Robot
+{
+    //! Parses the response to a bulk read as its bytes arrive.
+    //! The response is one status packet from each device read:
+    //!   0xFF 0xFF ID LENGTH ERRBIT PARAMETER... CHECKSUM
+    //! Each packet is copied into the device's BulkReadData as soon as its
+    //! checksum arrives, so the bytes can be read from the port in whatever
+    //! pieces they come in, and the read can be finished the moment the last
+    //! expected packet is complete.
+    class BulkReadParser
+    {
+    public:
+        BulkReadParser();
+
+        //! Starts a new response, to be copied into the given data.
+        //! (The devices to expect are then added with Expect)
+        void Reset(BulkReadData* bulk_read_data);
+
+        //! Expects a packet from the given device, holding num_bytes of its
+        //! table from start_address.
+        void Expect(int sensor_id, int start_address, int num_bytes);
+
+        //! Parses the given bytes of the response.
+        //! Returns true once every expected packet has either arrived or
+        //! failed its checksum.
+        bool Parse(const unsigned char* bytes, int length);
+
+        //! Whether every expected packet has arrived or failed its checksum.
+        bool IsComplete() const { return num_received_ + num_failed_ == num_expected_; }
+
+        //! The total length in bytes of the expected response
+        int expected_length() const { return expected_length_; }
+        int num_expected() const { return num_expected_; }
+        int num_received() const { return num_received_; }
+        //! The number of expected packets that failed their checksum
+        int num_failed() const { return num_failed_; }
+        //! The number of bytes parsed since the last Reset
+        int num_bytes() const { return num_bytes_; }
+
+    private:
+        enum State
+        {
+            WAIT_HEADER_1,
+            WAIT_HEADER_2,
+            WAIT_ID,
+            WAIT_LENGTH,
+            WAIT_DATA
+        };
+
+        //! Finishes the packet in packet_, once its checksum has arrived.
+        void FinishPacket();
+
+        BulkReadData* bulk_read_data_;
+        //! Whether a packet is still expected from each device id
+        bool expected_[MAXNUM_BULKREADDEVICES];
+        int num_expected_;
+        int num_received_;
+        int num_failed_;
+        int num_bytes_;
+        int expected_length_;
+
+        State state_;
+        //! The packet being parsed, from its ID byte
+        unsigned char packet_[MX28::MAXNUM_ADDRESS + 4];
+        //! The number of bytes in packet_ so far
+        int packet_length_;
+    };
+}
+
+#endif
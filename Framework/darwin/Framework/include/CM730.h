@@ -11,17 +11,24 @@
 #include <boost/unordered_map.hpp>
 #include "MX28.h"
 #include "SensorReadManager.h"
+#include "BulkReadParser.h"
 
 #define MAXNUM_TXPARAM      (256)
 #define MAXNUM_RXPARAM      (1024)
 
 namespace Robot
 {
+    class CM730BusScheduler;
+
     class BulkReadData
     {
     public:
         int start_address;
         int length;
+        //! The number of bytes from start_address that hold read values.
+        //! (a longer read, made every few cycles, stays valid until the
+        //!  reads start at another address)
+        int valid_length;
         int error;
         unsigned char table[MX28::MAXNUM_ADDRESS];
 
@@ -164,8 +171,18 @@ namespace Robot
         //! Manages sensor read descriptors
         SensorReadManager* sensor_read_manager_;
 
+        //! Schedules the bus transactions of the motion cycle
+        CM730BusScheduler* bus_scheduler_;
+
         unsigned char bulk_read_tx_packet_[MAXNUM_TXPARAM + 10];
 
+        // The bulk read in flight (see BeginBulkRead)
+        BulkReadParser bulk_read_parser_;
+        bool bulk_read_in_flight_;
+        int bulk_read_cycle_;
+        int bulk_read_result_;
+        bool bulk_read_significant_error_;
+
         int TxRxPacket(unsigned char *txpacket, unsigned char *rxpacket, int priority);
         unsigned char CalculateChecksum(unsigned char *packet);
 
@@ -180,15 +197,7 @@ namespace Robot
             unsigned char *&rxpacket,
             int &res,
             int &length);
-        void TxRxBulkReadPacket(
-            unsigned char *&txpacket,
-            unsigned char *&rxpacket,
-            int &res);
-        int ReceiveBulkReadResponseFromPort(
-            unsigned char* rxpacket,
-            int to_length,
-            PlatformCM730 *m_Platform,
-            int &res);
+        void EndBulkRead(int result);
 
     public:
         bool DEBUG_PRINT;
@@ -198,6 +207,7 @@ namespace Robot
         ~CM730();
 
         SensorReadManager* sensor_read_manager() { return sensor_read_manager_; }
+        CM730BusScheduler* bus_scheduler() { return bus_scheduler_; }
 
         bool Connect();
         bool ChangeBaud(int baud);
@@ -219,6 +229,28 @@ namespace Robot
         void MakeBulkReadPacket();
         bool BulkRead(int* out_error_code);
 
+        // Pipelined bulk read:
+        // The request is sent by BeginBulkRead, and the response is parsed
+        // by PollBulkRead as its bytes arrive, so other work can be done
+        // while the devices answer. The bus is held until the read ends;
+        // any other transaction on this CM730 first finishes the read.
+        // (A read must be finished by the thread that began it, or by one
+        //  that is otherwise synchronised with it)
+
+        //! Sends the bulk read request for the next cycle.
+        //! Returns false if the request could not be sent.
+        bool BeginBulkRead();
+        //! Parses the bytes of the response that have arrived.
+        //! Returns true once the read has ended (complete or timed out).
+        bool PollBulkRead();
+        //! Waits for the read to end. Returns true if a significant error
+        //! occurred, and the result in out_error_code, as BulkRead does.
+        //! (After the read has ended, returns the result of that read)
+        bool FinishBulkRead(int* out_error_code);
+        bool IsBulkReadInFlight() const { return bulk_read_in_flight_; }
+        //! The number of bulk reads begun
+        int bulk_read_cycle() const { return bulk_read_cycle_; }
+
         // Utility
         static int MakeWord(int lowbyte, int highbyte);
         static int GetLowByte(int word);
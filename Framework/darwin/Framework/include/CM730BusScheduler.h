@@ -0,0 +1,83 @@
+#ifndef CM730_BUS_SCHEDULER_H
+#define CM730_BUS_SCHEDULER_H
+
+namespace Robot
+{
+    class CM730;
+}
+
+namespace Robot
+{
+    //! Schedules the CM730 bus transactions of the motion cycle, so that the
+    //! bus and the CPU work at the same time.
+    //!
+    //! Each cycle:
+    //!  - CompleteRead ends the bulk read started in the last cycle (usually
+    //!    already ended), so that its data can be copied, and StartRead sends
+    //!    the request for the next one.
+    //!  - While the devices answer, motion runs and the SyncWrite is made.
+    //!    The response is parsed as it arrives (PollRead may be called to
+    //!    parse what has arrived so far).
+    //!  - SyncWrite needs the bus, so it ends the read first, then writes.
+    //! Which registers are read depends on the cycle (see
+    //! SensorReadDescriptor::NumBytesForCycle).
+    //!
+    //! The achieved cycle time, and the time spent waiting for the bus, are
+    //! kept in statistics().
+    class CM730BusScheduler
+    {
+    public:
+        struct Statistics
+        {
+            int cycles;                 //!< cycles since ResetStatistics
+            double last_cycle_time;     //!< ms between the last two StartReads
+            double mean_cycle_time;     //!< ms
+            double max_cycle_time;      //!< ms
+            double mean_wait_time;      //!< ms per cycle waiting for reads to end
+            double max_wait_time;       //!< ms
+            int timeouts;               //!< reads that got no response
+            int corrupt;                //!< reads with missing or corrupt packets
+        };
+
+        CM730BusScheduler(CM730* cm730);
+
+        //! Sends the bulk read request for the next cycle.
+        void StartRead();
+
+        //! Parses the bytes of the response that have arrived.
+        //! Returns true once the read has ended.
+        bool PollRead();
+
+        //! Waits for the read to end. Returns true if a significant error
+        //! occurred, and the result in out_error_code (as CM730::BulkRead).
+        bool CompleteRead(int* out_error_code);
+
+        //! Ends the read in flight, then sends the SyncWrite.
+        int SyncWrite(int start_addr, int each_length, int number, int* pParam);
+
+        const Statistics& statistics() const { return statistics_; }
+        void ResetStatistics();
+
+        //! Pretty prints the statistics
+        void PrintStatistics();
+
+    private:
+        //! Waits for the read in flight to end, and counts the time waited.
+        void WaitForRead();
+
+        CM730* cm730_;
+        Statistics statistics_;
+        //! The time (ms) of the last StartRead, or 0 before the first
+        double cycle_start_time_;
+        //! The time (ms) waited for reads in this cycle
+        double cycle_wait_time_;
+        double total_cycle_time_;
+        double total_wait_time_;
+        //! The number of cycles with a cycle time (i.e. one less than cycles)
+        int timed_cycles_;
+        //! Whether a read has been started that CompleteRead has not counted
+        bool read_started_;
+    };
+}
+
+#endif
@@ -14,6 +14,8 @@ namespace Robot
             sensor_id_     = 0;
             start_address_ = 0;
             num_bytes_     = 0;
+            slow_num_bytes_ = 0;
+            slow_read_period_ = 0;
             consecutive_errors_ = 0;
             response_rate_ = 1;
         };
@@ -21,11 +23,21 @@ namespace Robot
         int sensor_id() const { return sensor_id_; }
         int start_address() const { return start_address_; }
         int num_bytes() const { return num_bytes_; }
+        int slow_num_bytes() const { return slow_num_bytes_; }
+        int slow_read_period() const { return slow_read_period_; }
         int consecutive_errors() const { return consecutive_errors_; }
         double response_rate() const { return response_rate_; }
         void set_sensor_id(int sensor_id) { sensor_id_ = sensor_id; }
         void set_start_address(int address) { start_address_ = address; }
         void set_num_bytes(int num_bytes) { num_bytes_ = num_bytes; }
+        //! Reads num_bytes from the start address once every 'period' cycles
+        //! instead of num_bytes() (e.g. to read slowly changing values, like
+        //! the temperature, that are after those read every cycle).
+        void set_slow_read(int num_bytes, int period)
+        {
+            slow_num_bytes_ = num_bytes;
+            slow_read_period_ = period;
+        }
         void set_response_rate(double rate) { response_rate_ = rate; }
 
         //! Updates the response rate estimate for the given sensor using the
@@ -35,6 +47,11 @@ namespace Robot
         // and results in reasonable performance.
         double UpdateResponseRate(int error_code);
 
+        //! Returns the number of bytes to read in the given cycle.
+        //! The slow reads of the sensors are staggered by sensor id, so that
+        //! they are spread over the cycles rather than all made in one.
+        int NumBytesForCycle(int cycle) const;
+
     private:
         //! The id of the sensor to read
         int sensor_id_;
@@ -42,6 +59,10 @@ namespace Robot
         int start_address_;
         //! The number of bytes to read from the sensor's memory table
         int num_bytes_;
+        //! The number of bytes read once every slow_read_period_ cycles
+        int slow_num_bytes_;
+        //! The period in cycles of the slow read (0 for none)
+        int slow_read_period_;
         //! The length of the streak of errors that includes the latest read
         int consecutive_errors_;
         //! A value in the range [0, 1] that gives an indication of the
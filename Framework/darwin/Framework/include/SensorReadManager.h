@@ -40,7 +40,9 @@ namespace Robot
         //! Copies descriptor data to the given transmit packet buffer,
         //! ordering the sensors such that the number that are expected to
         //! respond is high.
-        void MakeBulkReadPacket(unsigned char* tx_packet);
+        //! The bytes read from each sensor depend on the cycle
+        //! (see SensorReadDescriptor::NumBytesForCycle).
+        void MakeBulkReadPacket(unsigned char* tx_packet, int cycle);
 
         //! Checks all sensors for bulk read errors and returns true if any
         //! 'significant' errors occured.
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include "CM730.h"
+#include "BulkReadParser.h"
+
+using namespace Robot;
+
+// Positions in packet_, which starts at the ID byte of a status packet
+#define PACKET_ID       (0)
+#define PACKET_LENGTH   (1)
+#define PACKET_ERRBIT   (2)
+#define PACKET_DATA     (3)
+
+
+BulkReadParser::BulkReadParser() :
+        bulk_read_data_(0)
+{
+    Reset(0);
+}
+
+void BulkReadParser::Reset(BulkReadData* bulk_read_data)
+{
+    bulk_read_data_ = bulk_read_data;
+    for(int i = 0; i < MAXNUM_BULKREADDEVICES; i++)
+        expected_[i] = false;
+    num_expected_ = 0;
+    num_received_ = 0;
+    num_failed_ = 0;
+    num_bytes_ = 0;
+    expected_length_ = 0;
+    state_ = WAIT_HEADER_1;
+    packet_length_ = 0;
+}
+
+void BulkReadParser::Expect(int sensor_id, int start_address, int num_bytes)
+{
+    BulkReadData& sensor_data = bulk_read_data_[sensor_id];
+
+    // The table keeps the values of a longer read made in an earlier cycle,
+    // as long as the reads start at the same address.
+    if(sensor_data.start_address != start_address)
+        sensor_data.valid_length = 0;
+    sensor_data.start_address = start_address;
+    sensor_data.length = num_bytes;
+    sensor_data.error = -1;
+
+    expected_[sensor_id] = true;
+    num_expected_++;
+    expected_length_ += num_bytes + 6;
+}
+
+bool BulkReadParser::Parse(const unsigned char* bytes, int length)
+{
+    for(int i = 0; i < length; i++)
+    {
+        unsigned char byte = bytes[i];
+        num_bytes_++;
+
+        switch(state_)
+        {
+        case WAIT_HEADER_1:
+            if(byte == 0xFF)
+                state_ = WAIT_HEADER_2;
+            break;
+
+        case WAIT_HEADER_2:
+            state_ = (byte == 0xFF)? WAIT_ID : WAIT_HEADER_1;
+            break;
+
+        case WAIT_ID:
+            // (a third 0xFF is still part of the header)
+            if(byte != 0xFF)
+            {
+                packet_[PACKET_ID] = byte;
+                packet_length_ = 1;
+                state_ = WAIT_LENGTH;
+            }
+            break;
+
+        case WAIT_LENGTH:
+            // Only a packet from a device that is expected, with the length
+            // that was asked for, is read. Anything else is noise, and the
+            // next header is looked for.
+            if(expected_[packet_[PACKET_ID]] &&
+               byte == bulk_read_data_[packet_[PACKET_ID]].length + 2)
+            {
+                packet_[PACKET_LENGTH] = byte;
+                packet_length_ = 2;
+                state_ = WAIT_DATA;
+            }
+            else
+                state_ = (byte == 0xFF)? WAIT_HEADER_2 : WAIT_HEADER_1;
+            break;
+
+        case WAIT_DATA:
+            packet_[packet_length_++] = byte;
+            if(packet_length_ == packet_[PACKET_LENGTH] + 2)
+            {
+                FinishPacket();
+                state_ = WAIT_HEADER_1;
+            }
+            break;
+        }
+    }
+
+    return IsComplete();
+}
+
+void BulkReadParser::FinishPacket()
+{
+    int sensor_id = packet_[PACKET_ID];
+    int checksum_index = packet_length_ - 1;
+
+    unsigned char checksum = 0x00;
+    for(int i = 0; i < checksum_index; i++)
+        checksum += packet_[i];
+    checksum = ~checksum;
+
+    // The device's packet has come, whether or not it is intact,
+    // so no more is expected from it.
+    expected_[sensor_id] = false;
+
+    if(packet_[checksum_index] != checksum)
+    {
+        num_failed_++;
+        return;
+    }
+
+    BulkReadData& sensor_data = bulk_read_data_[sensor_id];
+    for(int j = 0; j < sensor_data.length; j++)
+        sensor_data.table[sensor_data.start_address + j] = packet_[PACKET_DATA + j];
+    sensor_data.valid_length = std::max(sensor_data.valid_length, sensor_data.length);
+    sensor_data.error = (int)packet_[PACKET_ERRBIT];
+    num_received_++;
+}
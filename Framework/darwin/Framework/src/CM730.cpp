@@ -11,6 +11,7 @@
 
 #include "FSR.h"
 #include "CM730.h"
+#include "CM730BusScheduler.h"
 #include "MotionStatus.h"
 
 using namespace Robot;
@@ -36,6 +37,7 @@ using namespace Robot;
 BulkReadData::BulkReadData() :
         start_address(0),
         length(0),
+        valid_length(0),
         error(-1)
 {
     for(int i = 0; i < MX28::MAXNUM_ADDRESS; i++)
@@ -45,7 +47,7 @@ BulkReadData::BulkReadData() :
 int BulkReadData::ReadByte(int address)
 {
     if(address >= start_address &&
-       address < (start_address + length))
+       address < (start_address + valid_length))
         return (int)table[address];
 
     return 0;
@@ -54,7 +56,7 @@ int BulkReadData::ReadByte(int address)
 int BulkReadData::ReadWord(int address)
 {
     if(address >= start_address &&
-       address < (start_address + length))
+       address < (start_address + valid_length))
         return CM730::MakeWord(table[address], table[address+1]);
 
     return 0;
@@ -68,13 +70,21 @@ CM730::CM730(PlatformCM730 *platform)
     for(int i = 0; i < ID_BROADCAST; i++)
         bulk_read_data_[i] = BulkReadData();
 
+    bulk_read_in_flight_ = false;
+    bulk_read_cycle_ = 0;
+    bulk_read_result_ = RX_FAIL; // (no read yet)
+    bulk_read_significant_error_ = false;
+
     // Create the sensor read manager
     sensor_read_manager_ = new Robot::SensorReadManager();
+
+    bus_scheduler_ = new Robot::CM730BusScheduler(this);
 }
 
 CM730::~CM730()
 {
     Disconnect();
+    delete bus_scheduler_;
     delete sensor_read_manager_;
 }
 
@@ -111,9 +121,8 @@ inline void CM730::PerformPriorityRelease(int priority)
 
 // Cm730 packet (communicate only to the CM730 controller board,
 // and not attached devices)
-// Note: This method is similar to CM730::TxRxBulkReadPacket.
-//       See the comments there for help deciphering it.
-//       (I'll refactor these soon. -MM)
+// Note: The status packet read here has the same layout as each packet of
+//       a bulk read response. See BulkReadParser for help deciphering it.
 inline void CM730::TxRxCMPacket(
     unsigned char* &txpacket,
     unsigned char* &rxpacket,
@@ -280,69 +289,6 @@ void PrintSuccessfulBulkReadTimes(Robot::PlatformCM730* m_Platform)
     fprintf(stderr, "Minimum successful bulk read time = %fms\n", min_successful_bulk_read_time);
 }
 
-inline int CM730::ReceiveBulkReadResponseFromPort(
-    unsigned char* rxpacket,
-    int to_length,
-    PlatformCM730 *m_Platform,
-    int &res)
-{
-    if(DEBUG_PRINT == true) fprintf(stderr, "RX: ");
-
-    // original multiplier of 1.5 appears to be an undocumented hack.
-    // Make the timeout long enough that we always get reasonable information
-    // on failed motors.
-    // m_Platform->SetPacketTimeout(to_length * 1.5 * 0.5);
-    m_Platform->SetPacketTimeout(to_length * 1.5 * 40);
-    // m_Platform->SetPacketTimeout(to_length * 1.5 * 400);
-
-    int get_length = 0; //! length in bytes of data read so far
-    // Read data from port
-    // (loop until all data has been read, or a timeout occurs)
-    while(true)
-    {
-        // read some (more) data
-        int length = m_Platform->ReadPort(&rxpacket[get_length],
-                                          to_length - get_length);
-        if(DEBUG_PRINT == true)
-        {
-            for(int n = 0; n < length; n++)
-                fprintf(stderr, "%.2X ", rxpacket[get_length + n]);
-        }
-        get_length += length;
-
-        // break if all data has been read
-        if(get_length == to_length)
-        {
-            res = SUCCESS;
-            // PrintSuccessfulBulkReadTimes(m_Platform);
-            // PrintSuccessfulBulkReadPeriod(m_Platform);
-            break;
-        }
-
-        // break, and set error code, if a timeout occured
-        if(m_Platform->IsPacketTimeout() == true)
-        {
-            if(get_length == 0)
-            {
-                res = RX_TIMEOUT;
-                // fprintf(stderr, "RX_TIMEOUT: Reading data (time = %fms)\n",
-                //         m_Platform->GetPacketTime());
-            }
-            else
-            {
-                res = RX_CORRUPT;
-                // fprintf(stderr, "RX_CORRUPT: Reading data (time = %fms)\n",
-                //         m_Platform->GetPacketTime());
-            }
-            break;
-        }
-    }
-
-    // PrintSuccessfulBulkReadPeriod(m_Platform);
-
-    return get_length;
-}
-
 int CM730::AdvanceBuffer(unsigned char* buffer, int buffer_length,
                           int num_bytes_to_advance)
 {
@@ -354,143 +300,8 @@ int CM730::AdvanceBuffer(unsigned char* buffer, int buffer_length,
     return new_length;
 }
 
-inline void CM730::TxRxBulkReadPacket(
-    unsigned char* &txpacket,
-    unsigned char* &rxpacket,
-    int &res)
-{
-    int to_length = 0; //! length in bytes of data to read
-    int num = (txpacket[LENGTH]-3) / 3; // number of blocks to read
-
-    // Set bulkreaddata lengths and start addresses
-    for(int x = 0; x < num; x++)
-    {
-        int _id   = txpacket[PARAMETER+(3*x)+2];
-        int _len  = txpacket[PARAMETER+(3*x)+1];
-        int _addr = txpacket[PARAMETER+(3*x)+3];
-
-        to_length += _len + 6;
-        bulk_read_data_[_id].length = _len;
-        bulk_read_data_[_id].start_address = _addr;
-    }
-
-    // Read data from port
-    int get_length = ReceiveBulkReadResponseFromPort(rxpacket, to_length,
-                                                     m_Platform, res);
-    
-
-    // ResetBulkReadDataErrorCodes
-    for(int x = 0; x < num; x++)
-    {
-        int _id = txpacket[PARAMETER+(3*x)+2];
-        bulk_read_data_[_id].error = -1;
-    }
-
-
-    // Validate received data (in rxpacket) and
-    // copy it into BulkReadData objects (in bulk_read_data_).
-    while(1)
-    {
-        // Note: rxpacket may contain several sets of values to be read
-        //       (e.g. one set for each motor, containing all the values from
-        //        that motor's memory table).
-        //
-        // The first bytes of a valid set of values are the following:
-        // 0x00: 0xFF      (literal value 0xFF)
-        // 0x01: 0xFF      (literal value 0xFF)
-        // 0x02: ID        (a byte indicating which motor/device's data follows)
-        // 0x03: LENGTH    (the number of bytes following the error bit)
-        // 0x04: ERRBIT    (stores an error code for this read)
-        // 0x05: (PARAMETER) (the first byte of data from the device)
-        //
-        // ... (all the data)
-        //
-        // 0x03+(LENGTH): A checksum for this data packet.
-        //                (Note: this is the last address of the packet)
-        //
-        // In particular, sets always start with the bytes, 0xFF 0xFF.
-        //
-
-        int i;
-        for(i = 0; i < get_length - 1; i++)
-        {
-            if(rxpacket[i] == 0xFF && rxpacket[i+1] == 0xFF)
-                break;
-            else if(i == (get_length - 2) && rxpacket[get_length - 1] == 0xFF)
-                break;
-        }
-
-        if(i != 0)
-        {
-            // skip invalid/header bytes
-            get_length = AdvanceBuffer(rxpacket, get_length, i);
-
-            // continue;
-        }
-        else
-        // if(i == 0)
-        {
-            // Check checksum
-            unsigned char checksum = CalculateChecksum(rxpacket);
-            if(DEBUG_PRINT == true)
-                fprintf(stderr, "CHK:%.2X\n", checksum);
-
-            // If the last element is equal to the checksum...
-            // Note: rxpacket[LENGTH] stores the number of bytes in rxpacket
-            //       after the array position LENGTH.
-            if(rxpacket[LENGTH+rxpacket[LENGTH]] == checksum)
-            {
-                // Copy data of first value to the datatable of the
-                // corresponding BulkReadData object.
-                int sensor_id = rxpacket[ID];
-                BulkReadData& sensor_data = bulk_read_data_[sensor_id];
-
-                // fprintf(stderr, "BulkReading: id=%d\n", sensor_id);
-
-                for(int j = 0; j < (rxpacket[LENGTH]-2); j++)
-                    sensor_data.table[sensor_data.start_address + j] = rxpacket[PARAMETER + j];
-
-                sensor_data.error = (int)rxpacket[ERRBIT];
-
-                // skip the rxpacket entry that was just read
-                int cur_packet_length = LENGTH + 1 + rxpacket[LENGTH];
-                to_length = AdvanceBuffer(rxpacket, get_length, cur_packet_length);
-                get_length = to_length;
-
-                num--;
-            }
-            else
-            {
-                // fprintf(stderr, "RX_CORRUPT: Checksum.\n");
-                res = RX_CORRUPT;
-                
-                // skip next 2 bytes of rxpacket
-                to_length = AdvanceBuffer(rxpacket, get_length, 2);
-                get_length = to_length;
-            }
-
-            if(num == 0) // rxpacket has been read entirely
-                break;
-            else if(get_length <= 6) // no room for any more data
-            {
-                // if(num != 0) // redundant
-                // {
-                    res = RX_CORRUPT;
-                    // fprintf(stderr, "RX_CORRUPT: Unexpected end of packet.\n");
-                // }
-                break;
-            }
-
-            // continue;
-        }
-    }
-}
-
 int CM730::TxRxPacket(unsigned char *txpacket, unsigned char *rxpacket, int priority)
 {
-    // Acquire resources
-    PerformPriorityWait(priority);
-
     int res = TX_FAIL;
     int length = txpacket[LENGTH] + 4;
 
@@ -498,6 +309,14 @@ int CM730::TxRxPacket(unsigned char *txpacket, unsigned char *rxpacket, int prio
     txpacket[1] = 0xFF;
     txpacket[length - 1] = CalculateChecksum(txpacket);
 
+    // The packet is made while a bulk read may still be in flight;
+    // the bus is only needed from here.
+    if(bulk_read_in_flight_)
+        FinishBulkRead(NULL);
+
+    // Acquire resources
+    PerformPriorityWait(priority);
+
     if(DEBUG_PRINT == true)
     {
         fprintf(stderr, "\nTX: ");
@@ -519,13 +338,10 @@ int CM730::TxRxPacket(unsigned char *txpacket, unsigned char *rxpacket, int prio
             {
                 TxRxCMPacket(txpacket, rxpacket, res, length); // Note: 'length' can be passed by value here.
             }
-            else if(txpacket[INSTRUCTION] == INST_BULK_READ) // (INST_BULK_READ is an ID_BROADCAST)
-            {
-                TxRxBulkReadPacket(txpacket, rxpacket, res);
-            }
             else
             {
                 // i.e. Must be an ID_BROADCAST, and one of:
+                // (INST_BULK_READ is sent by BeginBulkRead)
                 //   - INST_PING
                 //   - INST_READ
                 //   - INST_WRITE
@@ -563,27 +379,130 @@ unsigned char CM730::CalculateChecksum(unsigned char *packet)
 
 bool CM730::BulkRead(int* out_error_code)
 {
-    unsigned char rxpacket[MAXNUM_RXPARAM + 10] = {0, };
+    BeginBulkRead();
+    return FinishBulkRead(out_error_code);
+}
+
+bool CM730::BeginBulkRead()
+{
+    if(bulk_read_in_flight_)
+        FinishBulkRead(NULL);
 
     // Note: This can be skipped if no errors have occured, and all sensors are
     //       responding for appropriately many consecutive reads.
     //       (at the time of writing, however, this call is comparatively
     //        inexpensive)
-    sensor_read_manager_->MakeBulkReadPacket(bulk_read_tx_packet_);
+    //       The registers read depend on the cycle (see SensorReadDescriptor).
+    sensor_read_manager_->MakeBulkReadPacket(bulk_read_tx_packet_, bulk_read_cycle_++);
+
+    unsigned char* txpacket = bulk_read_tx_packet_;
+    int length = txpacket[LENGTH] + 4;
+    txpacket[0] = 0xFF;
+    txpacket[1] = 0xFF;
+    txpacket[length - 1] = CalculateChecksum(txpacket);
+
+    // Set bulkreaddata lengths and start addresses
+    bulk_read_parser_.Reset(bulk_read_data_);
+    int num = (txpacket[LENGTH]-3) / 3; // number of blocks to read
+    for(int x = 0; x < num; x++)
+    {
+        int _len  = txpacket[PARAMETER+(3*x)+1];
+        int _id   = txpacket[PARAMETER+(3*x)+2];
+        int _addr = txpacket[PARAMETER+(3*x)+3];
+        bulk_read_parser_.Expect(_id, _addr, _len);
+    }
+
+    if(DEBUG_PRINT == true)
+    {
+        fprintf(stderr, "\nTX: ");
+        for(int n=0; n<length; n++)
+            fprintf(stderr, "%.2X ", txpacket[n]);
+
+        PrintInstructionType(txpacket);
+    }
+
+    // Acquire resources (until the read ends)
+    PerformPriorityWait(0);
+
+    if(length >= (MAXNUM_TXPARAM + 6))
+    {
+        EndBulkRead(TX_CORRUPT);
+        return false;
+    }
+
+    m_Platform->ClearPort();
+    if(m_Platform->WritePort(txpacket, length) != length)
+    {
+        EndBulkRead(TX_FAIL);
+        return false;
+    }
+
+    // original multiplier of 1.5 appears to be an undocumented hack.
+    // Make the timeout long enough that we always get reasonable information
+    // on failed motors.
+    m_Platform->SetPacketTimeout(bulk_read_parser_.expected_length() * 1.5 * 40);
+
+    if(DEBUG_PRINT == true) fprintf(stderr, "RX: ");
+    bulk_read_in_flight_ = true;
+    return true;
+}
+
+bool CM730::PollBulkRead()
+{
+    if(!bulk_read_in_flight_)
+        return true;
+
+    unsigned char rxpacket[MAXNUM_RXPARAM + 10];
+    int length = m_Platform->ReadPort(rxpacket, sizeof(rxpacket));
+    if(length > 0)
+    {
+        if(DEBUG_PRINT == true)
+        {
+            for(int n = 0; n < length; n++)
+                fprintf(stderr, "%.2X ", rxpacket[n]);
+        }
+
+        bulk_read_parser_.Parse(rxpacket, length);
+    }
 
-    // Perform the read operation from the CM730.
     // Note: Possible error codes are:
     //  { SUCCESS, TX_CORRUPT, TX_FAIL, RX_FAIL, RX_TIMEOUT, RX_CORRUPT }
-    int bulk_read_error_code = TxRxPacket(bulk_read_tx_packet_, rxpacket, 0);
-    
+    if(bulk_read_parser_.IsComplete())
+        EndBulkRead((bulk_read_parser_.num_failed() == 0)? SUCCESS : RX_CORRUPT);
+    else if(m_Platform->IsPacketTimeout() == true)
+        EndBulkRead((bulk_read_parser_.num_bytes() == 0)? RX_TIMEOUT : RX_CORRUPT);
+
+    return !bulk_read_in_flight_;
+}
+
+bool CM730::FinishBulkRead(int* out_error_code)
+{
+    while(!PollBulkRead())
+        ;
+
     if(out_error_code != NULL)
-        *out_error_code = bulk_read_error_code;
+        *out_error_code = bulk_read_result_;
 
-    bool significant_error_occurred = sensor_read_manager_->ProcessBulkReadErrors(
-        bulk_read_error_code,
-        bulk_read_data_);
+    return bulk_read_significant_error_;
+}
 
-    return significant_error_occurred;
+void CM730::EndBulkRead(int result)
+{
+    bulk_read_in_flight_ = false;
+    bulk_read_result_ = result;
+
+    if(DEBUG_PRINT == true)
+    {
+        fprintf(stderr, "Time:%.2fms  ", m_Platform->GetPacketTime());
+        PrintResultType(result);
+    }
+
+    // Release resources
+    PerformPriorityRelease(0);
+
+    bulk_read_significant_error_ = sensor_read_manager_->ProcessBulkReadErrors(
+        bulk_read_result_,
+        bulk_read_data_);
 }
 
 int CM730::SyncWrite(int start_addr, int each_length, int number, int *pParam)
@@ -648,6 +567,9 @@ bool CM730::DXLPowerOn()
 
 void CM730::Disconnect()
 {
+    if(bulk_read_in_flight_)
+        FinishBulkRead(NULL);
+
     // Make the Head LED to green
     //WriteWord(CM730::ID_CM, CM730::P_LED_HEAD_L, MakeColor(0, 255, 0), 0);
     unsigned char txpacket[] = {0xFF, 0xFF, 0xC8, 0x05, 0x03, 0x1A, 0xE0, 0x03, 0x32};
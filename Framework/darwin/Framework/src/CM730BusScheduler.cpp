@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <time.h>
+#include <algorithm>
+
+#include "CM730.h"
+#include "CM730BusScheduler.h"
+
+using namespace Robot;
+
+
+// The time in ms from a monotonic clock
+static double SchedulerTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return ((double)time.tv_sec*1000.0 + (double)time.tv_nsec/1000000.0);
+}
+
+CM730BusScheduler::CM730BusScheduler(CM730* cm730)
+{
+    cm730_ = cm730;
+    cycle_start_time_ = 0;
+    read_started_ = false;
+    ResetStatistics();
+}
+
+void CM730BusScheduler::ResetStatistics()
+{
+    statistics_.cycles = 0;
+    statistics_.last_cycle_time = 0;
+    statistics_.mean_cycle_time = 0;
+    statistics_.max_cycle_time = 0;
+    statistics_.mean_wait_time = 0;
+    statistics_.max_wait_time = 0;
+    statistics_.timeouts = 0;
+    statistics_.corrupt = 0;
+
+    cycle_wait_time_ = 0;
+    total_cycle_time_ = 0;
+    total_wait_time_ = 0;
+    timed_cycles_ = 0;
+}
+
+void CM730BusScheduler::StartRead()
+{
+    double now = SchedulerTime();
+
+    // The cycle ends when the next begins
+    if(cycle_start_time_ > 0 && statistics_.cycles > 0)
+    {
+        double cycle_time = now - cycle_start_time_;
+        timed_cycles_++;
+        total_cycle_time_ += cycle_time;
+        statistics_.last_cycle_time = cycle_time;
+        statistics_.mean_cycle_time = total_cycle_time_ / timed_cycles_;
+        statistics_.max_cycle_time = std::max(statistics_.max_cycle_time, cycle_time);
+    }
+    cycle_start_time_ = now;
+    statistics_.cycles++;
+    cycle_wait_time_ = 0;
+
+    cm730_->BeginBulkRead();
+    read_started_ = true;
+}
+
+bool CM730BusScheduler::PollRead()
+{
+    return cm730_->PollBulkRead();
+}
+
+bool CM730BusScheduler::CompleteRead(int* out_error_code)
+{
+    WaitForRead();
+
+    int error_code;
+    bool significant_error_occurred = cm730_->FinishBulkRead(&error_code);
+
+    // (the read may have been ended by any transaction since StartRead)
+    if(read_started_)
+    {
+        if(error_code == CM730::RX_TIMEOUT)
+            statistics_.timeouts++;
+        else if(error_code != CM730::SUCCESS)
+            statistics_.corrupt++;
+        read_started_ = false;
+    }
+
+    if(out_error_code != NULL)
+        *out_error_code = error_code;
+
+    return significant_error_occurred;
+}
+
+int CM730BusScheduler::SyncWrite(int start_addr, int each_length, int number, int* pParam)
+{
+    // The parameters have been made while the read was in flight;
+    // the bus is needed from here.
+    WaitForRead();
+    return cm730_->SyncWrite(start_addr, each_length, number, pParam);
+}
+
+void CM730BusScheduler::WaitForRead()
+{
+    if(!cm730_->IsBulkReadInFlight())
+        return;
+
+    double start = SchedulerTime();
+    cm730_->FinishBulkRead(NULL);
+    double wait_time = SchedulerTime() - start;
+
+    cycle_wait_time_ += wait_time;
+    total_wait_time_ += wait_time;
+    statistics_.mean_wait_time = total_wait_time_ / std::max(1, statistics_.cycles);
+    statistics_.max_wait_time = std::max(statistics_.max_wait_time, cycle_wait_time_);
+}
+
+void CM730BusScheduler::PrintStatistics()
+{
+    fprintf(stderr, "Bus cycles = %d\n", statistics_.cycles);
+    fprintf(stderr, "   Last cycle time = %fms\n", statistics_.last_cycle_time);
+    fprintf(stderr, "Average cycle time = %fms\n", statistics_.mean_cycle_time);
+    fprintf(stderr, "Maximum cycle time = %fms\n", statistics_.max_cycle_time);
+    fprintf(stderr, "Average wait for reads = %fms\n", statistics_.mean_wait_time);
+    fprintf(stderr, "Maximum wait for reads = %fms\n", statistics_.max_wait_time);
+    fprintf(stderr, "Reads timed out = %d, corrupt = %d\n", statistics_.timeouts, statistics_.corrupt);
+}
@@ -31,4 +31,12 @@ double SensorReadDescriptor::UpdateResponseRate(int sensor_error_code)
 
     response_rate_ = new_rate;
     return new_rate;
-}
\ No newline at end of file
+}
+
+int SensorReadDescriptor::NumBytesForCycle(int cycle) const
+{
+    if(slow_read_period_ > 0 && (cycle + sensor_id_) % slow_read_period_ == 0)
+        return std::max(num_bytes_, slow_num_bytes_);
+
+    return num_bytes_;
+}
@@ -1,3 +1,4 @@
+#include <iostream>
 #include <iomanip>
 #include <vector>
 #include <algorithm>
@@ -42,6 +43,10 @@ const int Robot::FSR::ID_L_FSR;
 #define INST_SYNC_WRITE (131)   // 0x83
 #define INST_BULK_READ  (146)   // 0x92
 
+// The values that change slowly (the battery voltage, and the servos'
+// temperatures) are read once in this many cycles.
+static const int kSlowReadPeriod = 10;
+
 
 SensorReadManager::SensorReadManager()
 {
@@ -55,6 +60,7 @@ SensorReadManager::SensorReadManager()
     cm_read->set_sensor_id(CM730::ID_CM);
     cm_read->set_start_address(CM730::P_BUTTON);
     cm_read->set_num_bytes(20);
+    cm_read->set_slow_read(CM730::P_VOLTAGE - CM730::P_BUTTON + 1, kSlowReadPeriod);
     descriptor_list_.push_back(cm_read);
 
     //   - Servo motors:
@@ -64,6 +70,7 @@ SensorReadManager::SensorReadManager()
         servo_read->set_sensor_id(servo_id);
         servo_read->set_start_address(MX28::P_PRESENT_POSITION_L);
         servo_read->set_num_bytes(2);
+        servo_read->set_slow_read(MX28::P_PRESENT_TEMPERATURE - MX28::P_PRESENT_POSITION_L + 1, kSlowReadPeriod);
         descriptor_list_.push_back(servo_read);
     }
 
@@ -162,7 +169,7 @@ bool SensorReadManager::ProcessBulkReadErrors(
     return error_occurred;
 }
 
-void SensorReadManager::MakeBulkReadPacket(unsigned char* bulk_read_tx_packet_)
+void SensorReadManager::MakeBulkReadPacket(unsigned char* bulk_read_tx_packet_, int cycle)
 {
     const int kDataStart = (PARAMETER) + 1;
 
@@ -187,7 +194,7 @@ void SensorReadManager::MakeBulkReadPacket(unsigned char* bulk_read_tx_packet_)
         //     descriptor_heap_.begin(),
         //     descriptor_heap_.end() - i,
         //     CompareSensorReadDescriptors());
-        bulk_read_tx_packet_[kDataStart + pos++] = sensor_read->num_bytes();
+        bulk_read_tx_packet_[kDataStart + pos++] = sensor_read->NumBytesForCycle(cycle);
         bulk_read_tx_packet_[kDataStart + pos++] = sensor_read->sensor_id();
         bulk_read_tx_packet_[kDataStart + pos++] = sensor_read->start_address();
     }
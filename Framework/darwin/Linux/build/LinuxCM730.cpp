@@ -77,21 +77,30 @@ bool LinuxCM730::OpenPort()
 
 	// Set non-standard baudrate
     if(ioctl(m_Socket_fd, TIOCGSERIAL, &serinfo) < 0)
-		goto UART_OPEN_ERROR;
-
-    serinfo.flags &= ~ASYNC_SPD_MASK;
-    serinfo.flags |= ASYNC_SPD_CUST;
-    serinfo.custom_divisor = serinfo.baud_base / baudrate;
-	
-    if(ioctl(m_Socket_fd, TIOCSSERIAL, &serinfo) < 0)
 	{
+		// A pseudo-terminal (e.g. cm730_simulator's) has no baud rate to set
+		if(errno != ENOTTY && errno != EINVAL)
+			goto UART_OPEN_ERROR;
+
 		if(DEBUG_PRINT == true)
-			printf("failed!\n");
-		goto UART_OPEN_ERROR;
+			printf("skipped (not a serial port)\n");
 	}
+	else
+	{
+		serinfo.flags &= ~ASYNC_SPD_MASK;
+		serinfo.flags |= ASYNC_SPD_CUST;
+		serinfo.custom_divisor = serinfo.baud_base / baudrate;
 
-	if(DEBUG_PRINT == true)
-		printf("success!\n");
+		if(ioctl(m_Socket_fd, TIOCSSERIAL, &serinfo) < 0)
+		{
+			if(DEBUG_PRINT == true)
+				printf("failed!\n");
+			goto UART_OPEN_ERROR;
+		}
+
+		if(DEBUG_PRINT == true)
+			printf("success!\n");
+	}
 
 	tcflush(m_Socket_fd, TCIFLUSH);
 
@@ -46,7 +46,6 @@ ColorFinder* httpd::red_finder;
 ColorFinder* httpd::yellow_finder;
 ColorFinder* httpd::blue_finder;
 minIni*      httpd::ini;
-bool httpd::ClientRequest(false);
 
 /******************************************************************************
 Description.: initializes the iobuffer structure properly
@@ -225,35 +224,61 @@ void httpd::decodeBase64(char *data) {
   *data = '\0';
 }
 
+/******************************************************************************
+Description.: Waits for a frame newer than last_sequence and takes a reference
+              to it. The lock is only held to take the reference, the frame
+              is sent without it.
+Input Value.: last_sequence is the sequence of the last frame sent, or 0
+Return Value: the frame, to be given back with release_frame
+******************************************************************************/
+jpg_frame* httpd::acquire_frame(unsigned int last_sequence) {
+  jpg_frame *frame;
+
+  pthread_mutex_lock( &pglobal->db );
+  while ( pglobal->latest == NULL || pglobal->latest->sequence == last_sequence )
+    pthread_cond_wait(&pglobal->db_update, &pglobal->db);
+  frame = pglobal->latest;
+  frame->refs++;
+  pthread_mutex_unlock( &pglobal->db );
+
+  return frame;
+}
+
+/******************************************************************************
+Description.: Gives back a reference to a frame, the last reference returns
+              the frame to the unused frames for the encoder to reuse.
+Input Value.: the globals the frame belongs to, and the frame
+Return Value: -
+******************************************************************************/
+void httpd::release_frame(globals *pglobal, jpg_frame *frame) {
+  pthread_mutex_lock( &pglobal->db );
+  if ( --frame->refs == 0 ) {
+    frame->next = pglobal->unused;
+    pglobal->unused = frame;
+  }
+  pthread_mutex_unlock( &pglobal->db );
+}
+
 /******************************************************************************
 Description.: Send a complete HTTP response and a single JPG-frame.
 Input Value.: fildescriptor fd to send the answer to
 Return Value: -
 ******************************************************************************/
 void httpd::send_snapshot(int fd) {
-  unsigned char *frame=NULL;
-  int frame_size=0;
+  jpg_frame *frame;
+  unsigned int last_sequence;
   char buffer[BUFFER_SIZE] = {0};
 
   /* wait for a fresh frame */
-  pthread_cond_wait(&pglobal->db_update, &pglobal->db);
-
-  /* read buffer */
-  frame_size = pglobal->size;
-
-  /* allocate a buffer for this single frame */
-  if ( (frame = (unsigned char*)malloc(frame_size+1)) == NULL ) {
-    free(frame);
-    pthread_mutex_unlock( &pglobal->db );
-    send_error(fd, 500, "not enough memory");
-    return;
-  }
-
-  memcpy(frame, pglobal->buf, frame_size);
-  DBG("got frame (size: %d kB)\n", frame_size/1024);
-
+  pthread_mutex_lock( &pglobal->db );
+  last_sequence = (pglobal->latest == NULL) ? 0 : pglobal->latest->sequence;
   pthread_mutex_unlock( &pglobal->db );
 
+  pglobal->clients++;
+  frame = acquire_frame(last_sequence);
+  pglobal->clients--;
+  DBG("got frame (size: %d kB)\n", frame->size/1024);
+
   /* write the response */
   sprintf(buffer, "HTTP/1.0 200 OK\r\n" \
                   STD_HEADER \
@@ -261,23 +286,22 @@ void httpd::send_snapshot(int fd) {
                   "\r\n");
 
   /* send header and image now */
-  if( write(fd, buffer, strlen(buffer)) < 0 ) {
-    free(frame);
-    return;
-  }
-  write(fd, frame, frame_size);
+  if( write(fd, buffer, strlen(buffer)) >= 0 )
+    write(fd, frame->buf, frame->size);
 
-  free(frame);
+  release_frame(pglobal, frame);
 }
 
 /******************************************************************************
 Description.: Send a complete HTTP response and a stream of JPG-frames.
+              A slow client skips to the newest frame each time it is ready
+              for another, it never holds up the encoder or other clients.
 Input Value.: fildescriptor fd to send the answer to
 Return Value: -
 ******************************************************************************/
 void httpd::send_stream(int fd) {
-  unsigned char *frame=NULL, *tmp=NULL;
-  int frame_size=0, max_frame_size=0;
+  jpg_frame *frame;
+  unsigned int last_sequence = 0;
   char buffer[BUFFER_SIZE] = {0};
 
   DBG("preparing header\n");
@@ -289,39 +313,18 @@ void httpd::send_stream(int fd) {
                   "--" BOUNDARY "\r\n");
 
   if ( write(fd, buffer, strlen(buffer)) < 0 ) {
-    free(frame);
     return;
   }
 
   DBG("Headers send, sending stream now\n");
 
+  pglobal->clients++;
   while ( 1 /*!pglobal->stop*/ ) {
 
     /* wait for fresh frames */
-    pthread_cond_wait(&pglobal->db_update, &pglobal->db);
-
-    /* read buffer */
-    frame_size = pglobal->size;
-
-    /* check if framebuffer is large enough, increase it if necessary */
-    if ( frame_size > max_frame_size ) {
-      DBG("increasing buffer size to %d\n", frame_size);
-
-      max_frame_size = frame_size+TEN_K;
-      if ( (tmp = (unsigned char*)realloc(frame, max_frame_size)) == NULL ) {
-        free(frame);
-        pthread_mutex_unlock( &pglobal->db );
-        send_error(fd, 500, "not enough memory");
-        return;
-      }
-
-      frame = tmp;
-    }
-
-    memcpy(frame, pglobal->buf, frame_size);
-    DBG("got frame (size: %d kB)\n", frame_size/1024);
-
-    pthread_mutex_unlock( &pglobal->db );
+    frame = acquire_frame(last_sequence);
+    last_sequence = frame->sequence;
+    DBG("got frame (size: %d kB)\n", frame->size/1024);
 
     /*
      * print the individual mimetype and the length
@@ -330,19 +333,22 @@ void httpd::send_stream(int fd) {
      */
     sprintf(buffer, "Content-Type: image/jpeg\r\n" \
                     "Content-Length: %d\r\n" \
-                    "\r\n", frame_size);
+                    "\r\n", frame->size);
     DBG("sending intemdiate header\n");
     if ( write(fd, buffer, strlen(buffer)) < 0 ) break;
 
     DBG("sending frame\n");
-    if( write(fd, frame, frame_size) < 0 ) break;
+    if( write(fd, frame->buf, frame->size) < 0 ) break;
 
     DBG("sending boundary\n");
     sprintf(buffer, "\r\n--" BOUNDARY "\r\n");
     if ( write(fd, buffer, strlen(buffer)) < 0 ) break;
+
+    release_frame(pglobal, frame);
   }
 
-  free(frame);
+  release_frame(pglobal, frame);
+  pglobal->clients--;
 }
 
 /******************************************************************************
@@ -982,8 +988,6 @@ void* httpd::client_thread( void *arg ) {
     DBG("access granted\n");
   }
 
-  ClientRequest = true;
-
   /* now it's time to answer */
   switch ( req.type ) {
     case A_SNAPSHOT:
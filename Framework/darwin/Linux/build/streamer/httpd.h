@@ -23,6 +23,9 @@
 #ifndef HTTPD_H_
 #define HTTPD_H_
 
+#include <pthread.h>
+#include <atomic>
+
 #define IO_BUFFER 256
 #define BUFFER_SIZE 1024
 
@@ -133,15 +136,33 @@ typedef enum {
 }out_cmd_type;
 
 
+/*
+ * an encoded JPG frame
+ * the newest frame is referenced by the globals, and each client holds a reference while it sends
+ * a frame, so the encoder never waits for a client; a frame is reused once nothing references it
+ */
+typedef struct _jpg_frame jpg_frame;
+struct _jpg_frame {
+    unsigned char* buf;
+    int size;
+    int capacity;
+    int refs;               /* protected by db */
+    unsigned int sequence;  /* increases by one with each frame, so a client can wait for a newer one */
+    jpg_frame* next;        /* the next unused frame */
+};
+
 typedef struct _globals globals;
 struct _globals {
-    /* signal fresh frames */
+    /* signal fresh frames, and protect the frames' references */
     pthread_mutex_t db;
     pthread_cond_t  db_update;
 
-    /* global JPG frame, this is more or less the "database" */
-    unsigned char* buf;
-    int size;
+    /* the newest JPG frame, this is more or less the "database" */
+    jpg_frame* latest;
+    jpg_frame* unused;
+
+    /* the number of clients waiting for or sending frames, nothing is encoded without one */
+    std::atomic<int> clients;
 };
 
 
@@ -301,6 +322,7 @@ private:
     static int _read(int fd, iobuffer *iobuf, void *buffer, size_t len, int timeout);
     static int _readline(int fd, iobuffer *iobuf, void *buffer, size_t len, int timeout);
     static void decodeBase64(char *data);
+    static jpg_frame* acquire_frame(unsigned int last_sequence);
     static void send_snapshot(int fd);
     static void send_stream(int fd);
     static void send_file(int fd, char *parameter);
@@ -317,9 +339,9 @@ public:
     static ColorFinder* yellow_finder;
     static ColorFinder* blue_finder;
     static minIni*      ini;
-	static bool ClientRequest;
 
     static void *server_thread( void *arg );
+    static void release_frame(globals *pglobal, jpg_frame *frame);
     static void send_error(int fd, int which, char *message);
 };
 
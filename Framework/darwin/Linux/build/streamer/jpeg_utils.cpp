@@ -39,9 +39,14 @@ Return Value:
 boolean jpeg_utils::empty_output_buffer(j_compress_ptr cinfo) {
   mjpg_dest_ptr dest = (mjpg_dest_ptr) cinfo->dest;
 
-  memcpy(dest->outbuffer_cursor, dest->buffer, OUTPUT_BUF_SIZE);
-  dest->outbuffer_cursor += OUTPUT_BUF_SIZE;
-  *(dest->written) += OUTPUT_BUF_SIZE;
+  /* the rest of a JPG that does not fit is dropped */
+  if (*(dest->written) + OUTPUT_BUF_SIZE > dest->outbuffer_size)
+    dest->overflow = 1;
+  else {
+    memcpy(dest->outbuffer_cursor, dest->buffer, OUTPUT_BUF_SIZE);
+    dest->outbuffer_cursor += OUTPUT_BUF_SIZE;
+    *(dest->written) += OUTPUT_BUF_SIZE;
+  }
 
   dest->pub.next_output_byte = dest->buffer;
   dest->pub.free_in_buffer = OUTPUT_BUF_SIZE;
@@ -60,6 +65,10 @@ void jpeg_utils::term_destination(j_compress_ptr cinfo) {
   size_t datacount = OUTPUT_BUF_SIZE - dest->pub.free_in_buffer;
 
   /* Write any data remaining in the buffer */
+  if (dest->overflow || *(dest->written) + (int)datacount > dest->outbuffer_size) {
+    dest->overflow = 1;
+    return;
+  }
   memcpy(dest->outbuffer_cursor, dest->buffer, datacount);
   dest->outbuffer_cursor += datacount;
   *(dest->written) += datacount;
@@ -86,27 +95,28 @@ void jpeg_utils::dest_buffer(j_compress_ptr cinfo, unsigned char *buffer, int si
   dest->outbuffer_size = size;
   dest->outbuffer_cursor = buffer;
   dest->written = written;
+  dest->overflow = 0;
 }
 
-int jpeg_utils::compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int size, int quality)
+int jpeg_utils::compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int size, int quality, int scale)
 {
     struct jpeg_compress_struct cinfo;
     struct jpeg_error_mgr jerr;
     JSAMPROW row_pointer[1];
     unsigned char *line_buffer, *yuyv;
-    int z;
-    static int written;
+    int width = src->m_Width / scale;
+    int height = src->m_Height / scale;
+    int written = 0;
 
-    line_buffer = (unsigned char*)calloc (src->m_Width * 3, 1);
-    yuyv = src->m_ImageData;
+    line_buffer = (unsigned char*)calloc (width * 3, 1);
 
     cinfo.err = jpeg_std_error (&jerr);
     jpeg_create_compress (&cinfo);
     /* jpeg_stdio_dest (&cinfo, file); */
     dest_buffer(&cinfo, buffer, size, &written);
 
-    cinfo.image_width = src->m_Width;
-    cinfo.image_height = src->m_Height;
+    cinfo.image_width = width;
+    cinfo.image_height = height;
     cinfo.input_components = 3;
     cinfo.in_color_space = JCS_RGB;
 
@@ -115,16 +125,19 @@ int jpeg_utils::compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int siz
 
     jpeg_start_compress (&cinfo, TRUE);
 
-    z = 0;
-    while (cinfo.next_scanline < src->m_Height) {
+    while (cinfo.next_scanline < (unsigned int)height) {
         int x;
         unsigned char *ptr = line_buffer;
+        /* two pixels share each four bytes, Y0 U Y1 V */
+        unsigned char *row = src->m_ImageData + cinfo.next_scanline * scale * src->m_Width * 2;
 
-        for (x = 0; x < src->m_Width; x++) {
+        for (x = 0; x < width; x++) {
             int r, g, b;
             int y, u, v;
+            int sx = x * scale;
 
-            if (!z)
+            yuyv = row + (sx >> 1) * 4;
+            if (!(sx & 1))
                 y = yuyv[0] << 8;
             else
                 y = yuyv[2] << 8;
@@ -138,11 +151,6 @@ int jpeg_utils::compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int siz
             *(ptr++) = (r > 255) ? 255 : ((r < 0) ? 0 : r);
             *(ptr++) = (g > 255) ? 255 : ((g < 0) ? 0 : g);
             *(ptr++) = (b > 255) ? 255 : ((b < 0) ? 0 : b);
-
-            if (z++) {
-                z = 0;
-                yuyv += 4;
-            }
         }
 
         row_pointer[0] = line_buffer;
@@ -150,6 +158,8 @@ int jpeg_utils::compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int siz
     }
 
     jpeg_finish_compress (&cinfo);
+    if (((mjpg_dest_ptr)cinfo.dest)->overflow)
+        written = 0;
     jpeg_destroy_compress (&cinfo);
 
     free (line_buffer);
@@ -157,25 +167,25 @@ int jpeg_utils::compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int siz
     return (written);
 }
 
-int jpeg_utils::compress_rgb_to_jpeg(Image *src, unsigned char* buffer, int size, int quality)
+int jpeg_utils::compress_rgb_to_jpeg(Image *src, unsigned char* buffer, int size, int quality, int scale)
 {
     struct jpeg_compress_struct cinfo;
     struct jpeg_error_mgr jerr;
     JSAMPROW row_pointer[1];
     unsigned char *line_buffer, *rgb;
-    int z;
-    static int written;
+    int width = src->m_Width / scale;
+    int height = src->m_Height / scale;
+    int written = 0;
 
-    line_buffer = (unsigned char*)calloc (src->m_Width * 3, 1);
-    rgb = src->m_ImageData;
+    line_buffer = (unsigned char*)calloc (width * 3, 1);
 
     cinfo.err = jpeg_std_error (&jerr);
     jpeg_create_compress (&cinfo);
     /* jpeg_stdio_dest (&cinfo, file); */
     dest_buffer(&cinfo, buffer, size, &written);
 
-    cinfo.image_width = src->m_Width;
-    cinfo.image_height = src->m_Height;
+    cinfo.image_width = width;
+    cinfo.image_height = height;
     cinfo.input_components = 3;
     cinfo.in_color_space = JCS_RGB;
 
@@ -184,23 +194,17 @@ int jpeg_utils::compress_rgb_to_jpeg(Image *src, unsigned char* buffer, int size
 
     jpeg_start_compress (&cinfo, TRUE);
 
-    z = 0;
-    while (cinfo.next_scanline < src->m_Height) {
+    while (cinfo.next_scanline < (unsigned int)height) {
         int x;
         unsigned char *ptr = line_buffer;
 
-        for (x = 0; x < src->m_Width; x++) {
-            int r, g, b;
-
-            r = rgb[0];
-            g = rgb[1];
-            b = rgb[2];
-
-            *(ptr++) = (r > 255) ? 255 : ((r < 0) ? 0 : r);
-            *(ptr++) = (g > 255) ? 255 : ((g < 0) ? 0 : g);
-            *(ptr++) = (b > 255) ? 255 : ((b < 0) ? 0 : b);
+        rgb = src->m_ImageData + cinfo.next_scanline * scale * src->m_Width * 3;
+        for (x = 0; x < width; x++) {
+            *(ptr++) = rgb[0];
+            *(ptr++) = rgb[1];
+            *(ptr++) = rgb[2];
 
-            rgb += 3;
+            rgb += 3 * scale;
         }
 
         row_pointer[0] = line_buffer;
@@ -208,6 +212,8 @@ int jpeg_utils::compress_rgb_to_jpeg(Image *src, unsigned char* buffer, int size
     }
 
     jpeg_finish_compress (&cinfo);
+    if (((mjpg_dest_ptr)cinfo.dest)->overflow)
+        written = 0;
     jpeg_destroy_compress (&cinfo);
 
     free (line_buffer);
@@ -26,6 +26,8 @@ private:
       int outbuffer_size;
       unsigned char *outbuffer_cursor;
       int *written;
+      int overflow;
+
 
     } mjpg_destination_mgr;
 
@@ -37,8 +39,9 @@ private:
     static void dest_buffer(j_compress_ptr cinfo, unsigned char *buffer, int size, int *written);
 
 public:
-    static int compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int size, int quality);
-    static int compress_rgb_to_jpeg(Image *src, unsigned char* buffer, int size, int quality);
+    /* scale > 1 encodes every scale'th pixel of every scale'th row; both return 0 if the JPG does not fit in size */
+    static int compress_yuyv_to_jpeg(Image *src, unsigned char* buffer, int size, int quality, int scale = 1);
+    static int compress_rgb_to_jpeg(Image *src, unsigned char* buffer, int size, int quality, int scale = 1);
 };
 
 #endif /* JPEG_UTILS_H_ */
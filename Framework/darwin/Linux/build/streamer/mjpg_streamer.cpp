@@ -8,6 +8,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <time.h>
 #include <arpa/inet.h>
 #include <linux/videodev2.h>
 
@@ -16,40 +18,56 @@
 
 #define WWW_FOLDER          "./www/"
 
+/* the number of frames measured before the encoding is changed again */
+#define ADAPT_FRAMES        5
+
 globals mjpg_streamer::global;
 
-mjpg_streamer::mjpg_streamer(int width, int height)
+static double now()
 {
-    // TODO Auto-generated constructor stub
-    input_yuv = new Image(width, height, Image::YUV_PIXEL_SIZE);
-    input_rgb = new Image(width, height, Image::RGB_PIXEL_SIZE);
-    global.buf = (unsigned char*)malloc(width*height*Image::YUV_PIXEL_SIZE);
-    global.size = 0;
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
 
-    if(pthread_mutex_init(&global.db, NULL) != 0)
-        exit(EXIT_FAILURE);
-    if(pthread_cond_init(&global.db_update, NULL) != 0)
-        exit(EXIT_FAILURE);
-    if(pthread_mutex_init(&controls_mutex, NULL) != 0)
-        exit(EXIT_FAILURE);
+mjpg_streamer::mjpg_streamer(int width, int height)
+{
+    init(width, height, (char*)WWW_FOLDER, 8080);
+}
 
-    server.pglobal = &global;
-    server.conf.port = htons(8080);
-    server.conf.credentials = NULL;
-    server.conf.www_folder = WWW_FOLDER;
-    server.conf.nocommands = 0;
+mjpg_streamer::mjpg_streamer(int width, int height, char* wwwdir)
+{
+    init(width, height, wwwdir, 8080);
+}
 
-    pthread_create(&(server.threadID), NULL, server_thread, &(server));
-    pthread_detach(server.threadID);
+mjpg_streamer::mjpg_streamer(int width, int height, char* wwwdir, int port)
+{
+    init(width, height, wwwdir, port);
 }
 
-mjpg_streamer::mjpg_streamer(int width, int height, char* wwwdir)
+void mjpg_streamer::init(int width, int height, char* wwwdir, int port)
 {
-    // TODO Auto-generated constructor stub
-    input_yuv = new Image(width, height, Image::YUV_PIXEL_SIZE);
-    input_rgb = new Image(width, height, Image::RGB_PIXEL_SIZE);
-    global.buf = (unsigned char*)malloc(width*height*Image::YUV_PIXEL_SIZE);
-    global.size = 0;
+    for(int i = 0; i < 3; i++)
+    {
+        raw[i] = new Image(width, height, Image::YUV_PIXEL_SIZE);
+        raw_pixel_size[i] = Image::YUV_PIXEL_SIZE;
+    }
+    raw_write = 0;
+    raw_read = 1;
+    raw_latest = 2;
+    frame_capacity = width*height*Image::YUV_PIXEL_SIZE;
+
+    target_fps = 15;
+    target_bitrate = 0;
+    quality = MAX_QUALITY;
+    scale = 1;
+    encode_time = 0;
+    frame_size = 0;
+    frames_measured = 0;
+
+    global.latest = NULL;
+    global.unused = NULL;
+    global.clients = 0;
 
     if(pthread_mutex_init(&global.db, NULL) != 0)
         exit(EXIT_FAILURE);
@@ -57,9 +75,15 @@ mjpg_streamer::mjpg_streamer(int width, int height, char* wwwdir)
         exit(EXIT_FAILURE);
     if(pthread_mutex_init(&controls_mutex, NULL) != 0)
         exit(EXIT_FAILURE);
+    if(sem_init(&raw_ready, 0, 0) != 0)
+        exit(EXIT_FAILURE);
+
+    stopping = false;
+    if(pthread_create(&encoder, NULL, encoder_thread, this) != 0)
+        exit(EXIT_FAILURE);
 
     server.pglobal = &global;
-    server.conf.port = htons(8080);
+    server.conf.port = htons(port);
     server.conf.credentials = NULL;
     server.conf.www_folder = wwwdir;
     server.conf.nocommands = 0;
@@ -70,7 +94,14 @@ mjpg_streamer::mjpg_streamer(int width, int height, char* wwwdir)
 
 mjpg_streamer::~mjpg_streamer()
 {
-    // TODO Auto-generated destructor stub
+    /* the server and its clients keep running with the last frame, as before */
+    stopping = true;
+    sem_post(&raw_ready);
+    pthread_join(encoder, NULL);
+    sem_destroy(&raw_ready);
+
+    for(int i = 0; i < 3; i++)
+        delete raw[i];
 }
 
 int mjpg_streamer::input_cmd(in_cmd_type cmd, int value)
@@ -91,39 +122,206 @@ int mjpg_streamer::input_cmd(in_cmd_type cmd, int value)
     return res;
 }
 
+/* Copies the frame into the latest-frame slot for the encoder; it never waits for the encoder or the clients */
 int mjpg_streamer::send_image(Image* img)
 {
-	if(httpd::ClientRequest == true)
-	{
-		if(img->m_PixelSize == Image::YUV_PIXEL_SIZE)
-			memcpy(input_yuv->m_ImageData, img->m_ImageData, img->m_ImageSize);
-		else if(img->m_PixelSize == Image::RGB_PIXEL_SIZE)
-			memcpy(input_rgb->m_ImageData, img->m_ImageData, img->m_ImageSize);
-
-		pthread_mutex_lock(&global.db);
-
-		if(img->m_PixelSize == Image::YUV_PIXEL_SIZE)
-			global.size = jpeg_utils::compress_yuyv_to_jpeg(input_yuv, global.buf, input_yuv->m_ImageSize, 80);
-		else if(img->m_PixelSize == Image::RGB_PIXEL_SIZE)
-			global.size = jpeg_utils::compress_rgb_to_jpeg(input_rgb, global.buf, input_rgb->m_ImageSize, 80);
-
-		pthread_cond_broadcast(&global.db_update);
-		pthread_mutex_unlock(&global.db);
-		httpd::ClientRequest = false;
-	}
-	else
-	{
-        pthread_mutex_lock(&global.db);
-        pthread_cond_broadcast(&global.db_update);
-        pthread_mutex_unlock(&global.db);
-	}
+    if(global.clients == 0)
+        return 0;
+    if(img->m_ImageSize > raw[raw_write]->m_ImageSize)
+        return -1;
+
+    memcpy(raw[raw_write]->m_ImageData, img->m_ImageData, img->m_ImageSize);
+    raw_pixel_size[raw_write] = img->m_PixelSize;
+
+    /* the frame the encoder has not taken yet, if any, becomes the one written next */
+    int previous = raw_latest.exchange(raw_write | RAW_FRESH);
+    raw_write = previous & ~RAW_FRESH;
+    if(!(previous & RAW_FRESH))
+        sem_post(&raw_ready);
 
     return 0;
 }
 
+void mjpg_streamer::set_targets(double fps, int bitrate)
+{
+    pthread_mutex_lock(&controls_mutex);
+    if(fps > 0)
+        target_fps = fps;
+    target_bitrate = (bitrate > 0) ? bitrate : 0;
+    frames_measured = 0;
+    pthread_mutex_unlock(&controls_mutex);
+}
+
+void mjpg_streamer::get_encoding(int& current_quality, int& current_scale)
+{
+    pthread_mutex_lock(&controls_mutex);
+    current_quality = quality;
+    current_scale = scale;
+    pthread_mutex_unlock(&controls_mutex);
+}
+
 void* mjpg_streamer::server_thread(void* arg)
 {
     httpd::server_thread(arg);
     return NULL;
 }
 
+void* mjpg_streamer::encoder_thread(void* arg)
+{
+    ((mjpg_streamer*)arg)->encode_frames();
+    return NULL;
+}
+
+/* The encoder thread: encodes the latest raw frame, at most target_fps times a second */
+void mjpg_streamer::encode_frames()
+{
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while(1)
+    {
+        while(sem_wait(&raw_ready) != 0 && errno == EINTR);
+        if(stopping)
+            break;
+
+        /* each post of raw_ready is one fresh frame, so the slot has one to take */
+        raw_read = raw_latest.exchange(raw_read) & ~RAW_FRESH;
+        if(global.clients == 0)
+            continue;
+
+        pthread_mutex_lock(&controls_mutex);
+        int q = quality;
+        int s = scale;
+        double period = 1.0 / target_fps;
+        int bitrate = target_bitrate;
+        pthread_mutex_unlock(&controls_mutex);
+
+        jpg_frame* frame = unused_frame();
+        double start = now();
+        if(raw_pixel_size[raw_read] == Image::RGB_PIXEL_SIZE)
+            frame->size = jpeg_utils::compress_rgb_to_jpeg(raw[raw_read], frame->buf, frame->capacity, q, s);
+        else
+            frame->size = jpeg_utils::compress_yuyv_to_jpeg(raw[raw_read], frame->buf, frame->capacity, q, s);
+        adapt(now() - start, frame->size);
+
+        if(frame->size > 0)
+            publish_frame(frame);
+        else
+        {
+            frame->refs = 1;
+            httpd::release_frame(&global, frame);
+        }
+
+        /* wait out the rest of the frame period, which is longer when even the smallest encoding is over the bitrate */
+        if(bitrate > 0 && q == MIN_QUALITY && s == MAX_SCALE && (double)frame->size / bitrate > period)
+            period = (double)frame->size / bitrate;
+        next.tv_nsec += (long)(period * 1e9);
+        next.tv_sec += next.tv_nsec / 1000000000;
+        next.tv_nsec %= 1000000000;
+        struct timespec current;
+        clock_gettime(CLOCK_MONOTONIC, &current);
+        if(current.tv_sec > next.tv_sec || (current.tv_sec == next.tv_sec && current.tv_nsec > next.tv_nsec))
+            next = current;
+        else
+            while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR);
+    }
+}
+
+/* Returns a frame no client is sending, reusing one if there is one */
+jpg_frame* mjpg_streamer::unused_frame()
+{
+    pthread_mutex_lock(&global.db);
+    jpg_frame* frame = global.unused;
+    if(frame != NULL)
+        global.unused = frame->next;
+    pthread_mutex_unlock(&global.db);
+
+    if(frame == NULL)
+    {
+        frame = (jpg_frame*)malloc(sizeof(jpg_frame));
+        if(frame == NULL || (frame->buf = (unsigned char*)malloc(frame_capacity)) == NULL)
+            exit(EXIT_FAILURE);
+        frame->capacity = frame_capacity;
+        frame->sequence = 0;
+    }
+    frame->size = 0;
+    frame->refs = 0;
+    frame->next = NULL;
+    return frame;
+}
+
+/* Makes the frame the latest, and wakes the clients waiting for it */
+void mjpg_streamer::publish_frame(jpg_frame* frame)
+{
+    pthread_mutex_lock(&global.db);
+    jpg_frame* previous = global.latest;
+    frame->refs = 1;
+    frame->sequence = (previous == NULL) ? 1 : previous->sequence + 1;
+    if(frame->sequence == 0)
+        frame->sequence = 1;
+    global.latest = frame;
+    if(previous != NULL && --previous->refs == 0)
+    {
+        previous->next = global.unused;
+        global.unused = previous;
+    }
+    pthread_cond_broadcast(&global.db_update);
+    pthread_mutex_unlock(&global.db);
+}
+
+/*
+ * Changes the quality and scale after ADAPT_FRAMES frames that are all too slow or too large, or all
+ * comfortably inside the targets; a frame that did not fit in its buffer lowers the quality at once.
+ * Going down, the quality is lowered before the resolution is halved; going up, the resolution is
+ * restored (at MIN_QUALITY) once a frame four times the size would fit, before the quality is raised.
+ * Below that the encoder keeps to the bitrate by encoding fewer frames.
+ */
+void mjpg_streamer::adapt(double seconds, int size)
+{
+    pthread_mutex_lock(&controls_mutex);
+
+    double period = 1.0 / target_fps;
+    double budget = (target_bitrate > 0) ? target_bitrate / target_fps : 0;
+
+    if(frames_measured == 0)
+    {
+        encode_time = seconds;
+        frame_size = size;
+    }
+    else
+    {
+        encode_time = 0.7*encode_time + 0.3*seconds;
+        frame_size = 0.7*frame_size + 0.3*size;
+    }
+    frames_measured++;
+
+    bool over = size == 0 || encode_time > period || (budget > 0 && frame_size > budget);
+    bool under = encode_time < 0.5*period && (budget == 0 || frame_size < 0.6*budget);
+    int factor = (scale > 1) ? 4 : 1;
+    bool full_fits = encode_time*factor < 0.5*period && (budget == 0 || frame_size*factor < 0.6*budget);
+
+    if(size == 0 || (over && frames_measured >= ADAPT_FRAMES))
+    {
+        if(quality > MIN_QUALITY)
+            quality = (quality - QUALITY_STEP < MIN_QUALITY) ? MIN_QUALITY : quality - QUALITY_STEP;
+        else if(scale < MAX_SCALE)
+            scale *= 2;
+        frames_measured = 0;
+    }
+    else if(under && frames_measured >= ADAPT_FRAMES)
+    {
+        if(scale > 1 && full_fits)
+        {
+            scale /= 2;
+            quality = MIN_QUALITY;
+            frames_measured = 0;
+        }
+        else if(quality < MAX_QUALITY)
+        {
+            quality = (quality + QUALITY_STEP > MAX_QUALITY) ? MAX_QUALITY : quality + QUALITY_STEP;
+            frames_measured = 0;
+        }
+    }
+
+    pthread_mutex_unlock(&controls_mutex);
+}
@@ -9,6 +9,8 @@
 #define MJPG_STREAMER_H_
 
 #include <pthread.h>
+#include <semaphore.h>
+#include <atomic>
 
 #include "Image.h"
 #include "LinuxCamera.h"
@@ -16,31 +18,76 @@
 
 using namespace Robot;
 
+/*
+ * send_image() only copies the frame into a free raw buffer and swaps it into the latest-frame slot,
+ * without a lock; the encoder thread takes the latest raw frame, encodes it, and publishes it to the
+ * clients. Frames arriving faster than the encoder skip the ones in between, and nothing is copied or
+ * encoded while no client is connected.
+ *
+ * The encoder lowers the quality, and then halves the resolution, when encoding a frame takes longer
+ * than the frame period or the frames are larger than the bitrate allows, and raises them again when
+ * there is room. At the lowest quality and resolution it keeps to the bitrate by skipping frames.
+ */
 class mjpg_streamer
 {
 private:
     static globals          global;
 
+    static const int        RAW_FRESH = 4;      /* set in raw_latest until the encoder takes the frame */
+    static const int        MIN_QUALITY = 30;
+    static const int        MAX_QUALITY = 80;
+    static const int        QUALITY_STEP = 10;
+    static const int        MAX_SCALE = 2;
+
     pthread_t               cam;
     pthread_mutex_t         controls_mutex;
 
-    Image*                  input_yuv;
-    Image*                  input_rgb;
+    /* three raw frames: one written by send_image, one encoded, and the latest */
+    Image*                  raw[3];
+    int                     raw_pixel_size[3];
+    std::atomic<int>        raw_latest;
+    int                     raw_write;
+    int                     raw_read;
+    sem_t                   raw_ready;
+
+    pthread_t               encoder;
+    std::atomic<bool>       stopping;
+    int                     frame_capacity;
+
+    /* rate control, the targets are protected by controls_mutex */
+    double                  target_fps;
+    int                     target_bitrate;     /* bytes per second, 0 for no limit */
+    int                     quality;
+    int                     scale;
+    double                  encode_time;        /* smoothed seconds per frame */
+    double                  frame_size;         /* smoothed bytes per frame */
+    int                     frames_measured;    /* since the encoding last changed */
 
     context                 server;
 
+    void init(int width, int height, char* wwwdir, int port);
     static void* server_thread(void* arg);
+    static void* encoder_thread(void* arg);
+    void encode_frames();
+    jpg_frame* unused_frame();
+    void publish_frame(jpg_frame* frame);
+    void adapt(double seconds, int size);
 
 public:
 
     mjpg_streamer(int width, int height);
     mjpg_streamer(int width, int height, char* wwwdir);
+    mjpg_streamer(int width, int height, char* wwwdir, int port);
     virtual ~mjpg_streamer();
 
     int input_init();
     int input_cmd(in_cmd_type cmd, int value);
     int send_image(Image* img);
 
+    /* fps is the most frames encoded per second, bitrate the most bytes per second sent to each client (0 for no limit) */
+    void set_targets(double fps, int bitrate);
+    void get_encoding(int& current_quality, int& current_scale);
+
     int output_init();
     int output_run();
 };
@@ -0,0 +1,616 @@
+/*
+ *   main.cpp
+ *
+ *   cm730_simulator: Emulates a CM730 and its MX28 servos on a
+ *   pseudo-terminal, so that the CM730 bus code can be run and timed
+ *   without a robot.
+ *
+ *   Usage:
+ *     ./cm730_simulator          Runs the bus tests against the simulator
+ *                                (exits with 0 if they all pass).
+ *     ./cm730_simulator --serve  Only runs the simulator, and prints the
+ *                                name of its port (to be opened by any
+ *                                program using LinuxCM730).
+ *        [--drop ID]             (the servo with the given ID doesn't respond)
+ *        [--corrupt N]           (every Nth bulk read response has a
+ *                                 corrupt byte)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include "LinuxDARwIn.h"
+#include "CM730BusScheduler.h"
+#include "SensorReadManager.h"
+
+using namespace Robot;
+
+#define INST_PING       (1)
+#define INST_READ       (2)
+#define INST_WRITE      (3)
+#define INST_SYNC_WRITE (131)   // 0x83
+#define INST_BULK_READ  (146)   // 0x92
+
+#define NUM_SERVOS          (JointData::NUMBER_OF_JOINTS - 1)
+#define TABLE_SIZE          (128)
+
+// Bus timing at 1Mbps (10 bits per byte), and the time each device takes
+// to start answering
+#define BYTE_TIME_US        (10)
+#define RETURN_DELAY_US     (20)
+
+// The time the motion modules take each cycle
+#define MOTION_WORK_US      (2000)
+
+#define NUM_TIMING_CYCLES   (300)
+
+
+//////////////////////////////////// Simulator ////////////////////////////////////
+
+struct Simulator
+{
+    int master_fd;
+    char slave_name[64];
+    pthread_t thread;
+    pthread_mutex_t mutex;
+
+    unsigned char table[256][TABLE_SIZE];
+
+    // Faults
+    volatile int drop_id;           // (0 for none)
+    volatile int corrupt_period;    // (0 for none)
+    volatile int corrupt_next;
+    int num_bulk_reads;
+};
+
+static Simulator sim;
+
+static double TimeMs()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec*1000.0 + (double)time.tv_nsec/1000000.0;
+}
+
+static void SleepUntil(const struct timespec& time)
+{
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, NULL) == EINTR)
+        ;
+}
+
+static void AddMicroseconds(struct timespec* time, long us)
+{
+    time->tv_nsec += us * 1000;
+    while(time->tv_nsec >= 1000000000)
+    {
+        time->tv_nsec -= 1000000000;
+        time->tv_sec++;
+    }
+}
+
+static unsigned char Checksum(const unsigned char* packet)
+{
+    // (sums from the ID byte to the last parameter)
+    unsigned char checksum = 0x00;
+    for(int i = 2; i < packet[3] + 3; i++)
+        checksum += packet[i];
+    return ~checksum;
+}
+
+// Makes a status packet with num_bytes of id's table from address.
+static int MakeStatusPacket(unsigned char* packet, int id, int address, int num_bytes)
+{
+    packet[0] = 0xFF;
+    packet[1] = 0xFF;
+    packet[2] = id;
+    packet[3] = num_bytes + 2;
+    packet[4] = 0; // (no error)
+    for(int i = 0; i < num_bytes; i++)
+        packet[5 + i] = sim.table[id][address + i];
+    packet[5 + num_bytes] = Checksum(packet);
+    return num_bytes + 6;
+}
+
+static bool DeviceExists(int id)
+{
+    return (id == CM730::ID_CM || (id >= 1 && id <= NUM_SERVOS)) && id != sim.drop_id;
+}
+
+// Writes the bytes as the bus would deliver them: each device's packet
+// arrives once it has been sent in full.
+static void Send(const unsigned char* packet, int length, struct timespec* time)
+{
+    AddMicroseconds(time, RETURN_DELAY_US + length * BYTE_TIME_US);
+    SleepUntil(*time);
+    if(write(sim.master_fd, packet, length) != length)
+        fprintf(stderr, "cm730_simulator: write failed\n");
+}
+
+static void UpdateServo(int id)
+{
+    // The servos reach their goals instantly, and are warm
+    unsigned char* table = sim.table[id];
+    table[MX28::P_PRESENT_POSITION_L] = table[MX28::P_GOAL_POSITION_L];
+    table[MX28::P_PRESENT_POSITION_H] = table[MX28::P_GOAL_POSITION_H];
+    table[MX28::P_PRESENT_LOAD_L] = (unsigned char)(id * 3);
+    table[MX28::P_PRESENT_LOAD_H] = 0;
+    table[MX28::P_PRESENT_VOLTAGE] = 121;
+    table[MX28::P_PRESENT_TEMPERATURE] = 40 + id;
+}
+
+static void Write(int id, int address, const unsigned char* values, int num_values)
+{
+    if(address + num_values > TABLE_SIZE)
+        return;
+    memcpy(&sim.table[id][address], values, num_values);
+    if(id != CM730::ID_CM)
+        UpdateServo(id);
+}
+
+// Answers one instruction packet
+static void Execute(const unsigned char* packet, struct timespec* time)
+{
+    unsigned char response[TABLE_SIZE + 10];
+    int id = packet[2];
+    int instruction = packet[4];
+    const unsigned char* params = &packet[5];
+    int num_params = packet[3] - 2;
+
+    pthread_mutex_lock(&sim.mutex);
+
+    switch(instruction)
+    {
+    case INST_PING:
+        if(DeviceExists(id))
+            Send(response, MakeStatusPacket(response, id, 0, 0), time);
+        break;
+
+    case INST_READ:
+        if(DeviceExists(id) && params[0] + params[1] <= TABLE_SIZE)
+            Send(response, MakeStatusPacket(response, id, params[0], params[1]), time);
+        break;
+
+    case INST_WRITE:
+        if(id == CM730::ID_BROADCAST)
+        {
+            for(int i = 1; i <= NUM_SERVOS; i++)
+                Write(i, params[0], &params[1], num_params - 1);
+        }
+        else if(DeviceExists(id))
+        {
+            Write(id, params[0], &params[1], num_params - 1);
+            Send(response, MakeStatusPacket(response, id, 0, 0), time);
+        }
+        break;
+
+    case INST_SYNC_WRITE:
+        {
+            int address = params[0];
+            int each_length = params[1];
+            for(int n = 2; n + each_length < num_params + 1; n += each_length + 1)
+            {
+                if(DeviceExists(params[n]))
+                    Write(params[n], address, &params[n + 1], each_length);
+            }
+        }
+        break;
+
+    case INST_BULK_READ:
+        {
+            sim.num_bulk_reads++;
+            bool corrupt = sim.corrupt_next ||
+                (sim.corrupt_period > 0 && sim.num_bulk_reads % sim.corrupt_period == 0);
+            sim.corrupt_next = 0;
+
+            // (params[0] is 0x00; then (length, id, address) for each device)
+            int num_devices = (num_params - 1) / 3;
+            for(int d = 0; d < num_devices; d++)
+            {
+                int length = params[1 + 3*d];
+                int device_id = params[2 + 3*d];
+                int address = params[3 + 3*d];
+
+                // Each device waits for the one before it to answer:
+                // when one doesn't, the rest of the read is lost.
+                if(!DeviceExists(device_id) || address + length > TABLE_SIZE)
+                    break;
+
+                int size = MakeStatusPacket(response, device_id, address, length);
+                if(corrupt && d == num_devices / 2)
+                    response[5] ^= 0x5A;
+                Send(response, size, time);
+            }
+        }
+        break;
+    }
+
+    pthread_mutex_unlock(&sim.mutex);
+}
+
+static void* SimulatorThread(void* arg)
+{
+    unsigned char buffer[1024];
+    int length = 0;
+
+    while(1)
+    {
+        struct pollfd fd;
+        fd.fd = sim.master_fd;
+        fd.events = POLLIN;
+        if(poll(&fd, 1, 100) <= 0)
+            continue;
+
+        int num_read = read(sim.master_fd, &buffer[length], sizeof(buffer) - length);
+        if(num_read <= 0)
+        {
+            // (the master reads EIO while the slave is closed)
+            usleep(1000);
+            continue;
+        }
+        length += num_read;
+
+        // Execute each complete instruction packet
+        while(1)
+        {
+            int start = 0;
+            while(start < length - 1 && !(buffer[start] == 0xFF && buffer[start + 1] == 0xFF))
+                start++;
+            length = CM730::AdvanceBuffer(buffer, length, start);
+
+            if(length < 4 || length < buffer[3] + 4)
+                break;
+
+            int size = buffer[3] + 4;
+            if(buffer[size - 1] == Checksum(buffer) && buffer[3] >= 2)
+            {
+                struct timespec time;
+                clock_gettime(CLOCK_MONOTONIC, &time);
+                AddMicroseconds(&time, size * BYTE_TIME_US);
+                Execute(buffer, &time);
+                length = CM730::AdvanceBuffer(buffer, length, size);
+            }
+            else
+                length = CM730::AdvanceBuffer(buffer, length, 2);
+        }
+    }
+
+    return NULL;
+}
+
+static bool StartSimulator()
+{
+    memset(sim.table, 0, sizeof(sim.table));
+    sim.drop_id = 0;
+    sim.corrupt_period = 0;
+    sim.corrupt_next = 0;
+    sim.num_bulk_reads = 0;
+    pthread_mutex_init(&sim.mutex, NULL);
+
+    for(int id = 1; id <= NUM_SERVOS; id++)
+    {
+        sim.table[id][MX28::P_ID] = id;
+        sim.table[id][MX28::P_GOAL_POSITION_L] = CM730::GetLowByte(MX28::CENTER_VALUE);
+        sim.table[id][MX28::P_GOAL_POSITION_H] = CM730::GetHighByte(MX28::CENTER_VALUE);
+        UpdateServo(id);
+    }
+    unsigned char* cm_table = sim.table[CM730::ID_CM];
+    cm_table[CM730::P_ID] = CM730::ID_CM;
+    for(int address = CM730::P_GYRO_Z_L; address <= CM730::P_ACCEL_Z_H; address += 2)
+    {
+        cm_table[address] = CM730::GetLowByte(512 + address);
+        cm_table[address + 1] = CM730::GetHighByte(512 + address);
+    }
+    cm_table[CM730::P_VOLTAGE] = 123;
+
+    sim.master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if(sim.master_fd < 0 || grantpt(sim.master_fd) != 0 || unlockpt(sim.master_fd) != 0)
+    {
+        fprintf(stderr, "cm730_simulator: can't open a pseudo-terminal\n");
+        return false;
+    }
+
+    struct termios raw;
+    tcgetattr(sim.master_fd, &raw);
+    cfmakeraw(&raw);
+    tcsetattr(sim.master_fd, TCSANOW, &raw);
+
+    strncpy(sim.slave_name, ptsname(sim.master_fd), sizeof(sim.slave_name) - 1);
+    sim.slave_name[sizeof(sim.slave_name) - 1] = '\0';
+
+    return pthread_create(&sim.thread, NULL, SimulatorThread, NULL) == 0;
+}
+
+static void SetDropId(int id)
+{
+    pthread_mutex_lock(&sim.mutex);
+    sim.drop_id = id;
+    pthread_mutex_unlock(&sim.mutex);
+}
+
+static void CorruptNextBulkRead()
+{
+    pthread_mutex_lock(&sim.mutex);
+    sim.corrupt_next = 1;
+    pthread_mutex_unlock(&sim.mutex);
+}
+
+
+////////////////////////////////////// Tests //////////////////////////////////////
+
+static int failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if(condition) printf("  ok:     "); \
+        else { printf("  FAILED: "); failures++; } \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } while(0)
+
+// The motion modules' work. (It sleeps rather than spins, so that the
+// simulator, which stands in for the hardware, has the CPU meanwhile)
+static void MotionWork()
+{
+    usleep(MOTION_WORK_US);
+}
+
+static int GoalForCycle(int cycle, int id)
+{
+    return MX28::CENTER_VALUE + ((cycle * 7 + id * 13) % 200) - 100;
+}
+
+// Makes SyncWrite params that move every servo to its goal for the cycle
+static int MakeGoals(int cycle, int* params)
+{
+    int n = 0;
+    for(int id = 1; id <= NUM_SERVOS; id++)
+    {
+        int value = GoalForCycle(cycle, id);
+        params[n++] = id;
+        params[n++] = 0;    // D_GAIN
+        params[n++] = 0;    // I_GAIN
+        params[n++] = 32;   // P_GAIN
+        params[n++] = 0;
+        params[n++] = CM730::GetLowByte(value);
+        params[n++] = CM730::GetHighByte(value);
+    }
+    return NUM_SERVOS;
+}
+
+// The blocking cycle (as before): read, then move, then write.
+static double RunBlockingCycles(CM730* cm730, int num_cycles)
+{
+    int params[NUM_SERVOS * MX28::PARAM_BYTES];
+
+    double start = TimeMs();
+    for(int cycle = 0; cycle < num_cycles; cycle++)
+    {
+        int error_code;
+        cm730->BulkRead(&error_code);
+        MotionWork();
+        int number = MakeGoals(cycle, params);
+        cm730->SyncWrite(MX28::P_D_GAIN, MX28::PARAM_BYTES, number, params);
+    }
+    return (TimeMs() - start) / num_cycles;
+}
+
+// The pipelined cycle: the read for the next cycle is in flight while
+// motion runs.
+static double RunPipelinedCycles(CM730* cm730, int num_cycles, int* num_errors)
+{
+    CM730BusScheduler* scheduler = cm730->bus_scheduler();
+    int params[NUM_SERVOS * MX28::PARAM_BYTES];
+
+    *num_errors = 0;
+    scheduler->CompleteRead(NULL);
+    scheduler->ResetStatistics();
+
+    double start = TimeMs();
+    for(int cycle = 0; cycle < num_cycles; cycle++)
+    {
+        int error_code;
+        scheduler->CompleteRead(&error_code);
+        if(cycle > 0 && error_code != CM730::SUCCESS)
+            (*num_errors)++;
+        scheduler->StartRead();
+
+        MotionWork();
+        int number = MakeGoals(cycle, params);
+        scheduler->SyncWrite(MX28::P_D_GAIN, MX28::PARAM_BYTES, number, params);
+    }
+    scheduler->CompleteRead(NULL);
+    return (TimeMs() - start) / num_cycles;
+}
+
+static void TestCycleTime(CM730* cm730)
+{
+    printf("\nCycle time (%d cycles, %.1fms of motion work each):\n",
+           NUM_TIMING_CYCLES, MOTION_WORK_US / 1000.0);
+
+    double blocking_time = RunBlockingCycles(cm730, NUM_TIMING_CYCLES);
+    int num_errors;
+    double pipelined_time = RunPipelinedCycles(cm730, NUM_TIMING_CYCLES, &num_errors);
+
+    printf("  blocking:  %.3fms\n", blocking_time);
+    printf("  pipelined: %.3fms\n", pipelined_time);
+    fflush(stdout);
+    cm730->bus_scheduler()->PrintStatistics();
+
+    CHECK(num_errors == 0, "every pipelined read succeeded (%d failed)", num_errors);
+    CHECK(pipelined_time < blocking_time,
+          "the pipelined cycle is shorter (by %.3fms)", blocking_time - pipelined_time);
+}
+
+static void TestData(CM730* cm730)
+{
+    printf("\nData read back:\n");
+
+    CM730BusScheduler* scheduler = cm730->bus_scheduler();
+    int params[NUM_SERVOS * MX28::PARAM_BYTES];
+    int slow_read_period = cm730->sensor_read_manager()->GetDescriptorById(1)->slow_read_period();
+    int num_cycles = 2 * slow_read_period;
+    int last_cycle = 0;
+
+    // Write goals, then read them back (from the following cycle's read)
+    for(int cycle = 0; cycle < num_cycles; cycle++)
+    {
+        scheduler->CompleteRead(NULL);
+        scheduler->StartRead();
+        int number = MakeGoals(cycle, params);
+        scheduler->SyncWrite(MX28::P_D_GAIN, MX28::PARAM_BYTES, number, params);
+        last_cycle = cycle;
+    }
+    scheduler->CompleteRead(NULL);
+    scheduler->StartRead();
+    int error_code;
+    scheduler->CompleteRead(&error_code);
+    CHECK(error_code == CM730::SUCCESS, "the last read succeeded (%s)",
+          CM730::getTxRxErrorString(error_code));
+
+    int num_positions_correct = 0;
+    int num_temperatures_read = 0;
+    for(int id = 1; id <= NUM_SERVOS; id++)
+    {
+        BulkReadData& data = cm730->bulk_read_data_[id];
+        if(data.ReadWord(MX28::P_PRESENT_POSITION_L) == GoalForCycle(last_cycle, id))
+            num_positions_correct++;
+        if(data.ReadByte(MX28::P_PRESENT_TEMPERATURE) == 40 + id)
+            num_temperatures_read++;
+    }
+    CHECK(num_positions_correct == NUM_SERVOS,
+          "present positions match the goals written (%d of %d)",
+          num_positions_correct, NUM_SERVOS);
+    CHECK(num_temperatures_read == NUM_SERVOS,
+          "temperatures are read every %d cycles (%d of %d)",
+          slow_read_period, num_temperatures_read, NUM_SERVOS);
+
+    BulkReadData& cm_data = cm730->bulk_read_data_[CM730::ID_CM];
+    CHECK(cm_data.ReadWord(CM730::P_GYRO_Z_L) == 512 + CM730::P_GYRO_Z_L,
+          "the gyro is read (%d)", cm_data.ReadWord(CM730::P_GYRO_Z_L));
+    CHECK(cm_data.ReadByte(CM730::P_VOLTAGE) == 123,
+          "the voltage is read (%d)", cm_data.ReadByte(CM730::P_VOLTAGE));
+}
+
+static void TestDroppedServo(CM730* cm730)
+{
+    const int kDropId = 9;
+    printf("\nServo %d not responding:\n", kDropId);
+
+    CM730BusScheduler* scheduler = cm730->bus_scheduler();
+    SensorReadManager* manager = cm730->sensor_read_manager();
+
+    SetDropId(kDropId);
+    int error_code = CM730::SUCCESS;
+    double start = TimeMs();
+    for(int cycle = 0; cycle < 4; cycle++)
+    {
+        scheduler->StartRead();
+        scheduler->CompleteRead(&error_code);
+    }
+    printf("  (%.1fms per read)\n", (TimeMs() - start) / 4);
+
+    int consecutive_errors = manager->GetDescriptorById(kDropId)->consecutive_errors();
+    CHECK(error_code == CM730::RX_CORRUPT, "the read ends incomplete (%s)",
+          CM730::getTxRxErrorString(error_code));
+    CHECK(consecutive_errors > 0, "the servo's errors are counted (%d)", consecutive_errors);
+
+    SetDropId(0);
+    for(int cycle = 0; cycle < 2; cycle++)
+    {
+        scheduler->StartRead();
+        scheduler->CompleteRead(&error_code);
+    }
+    CHECK(error_code == CM730::SUCCESS, "reads succeed once it responds again (%s)",
+          CM730::getTxRxErrorString(error_code));
+}
+
+static void TestCorruptByte(CM730* cm730)
+{
+    printf("\nA corrupt byte:\n");
+
+    CM730BusScheduler* scheduler = cm730->bus_scheduler();
+
+    // The time for a read that succeeds
+    scheduler->StartRead();
+    double start = TimeMs();
+    scheduler->CompleteRead(NULL);
+    double read_time = TimeMs() - start;
+
+    CorruptNextBulkRead();
+    int error_code;
+    scheduler->StartRead();
+    start = TimeMs();
+    scheduler->CompleteRead(&error_code);
+    double corrupt_read_time = TimeMs() - start;
+
+    CHECK(error_code == CM730::RX_CORRUPT, "the read is corrupt (%s)",
+          CM730::getTxRxErrorString(error_code));
+    CHECK(corrupt_read_time < read_time + 5.0,
+          "it ends when the response does, not at the timeout (%.1fms; %.1fms without the corrupt byte)",
+          corrupt_read_time, read_time);
+
+    scheduler->StartRead();
+    scheduler->CompleteRead(&error_code);
+    CHECK(error_code == CM730::SUCCESS, "the next read succeeds (%s)",
+          CM730::getTxRxErrorString(error_code));
+}
+
+int main(int argc, char* argv[])
+{
+    bool serve = false;
+    for(int i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--serve") == 0)
+            serve = true;
+        else if(strcmp(argv[i], "--drop") == 0 && i + 1 < argc)
+            sim.drop_id = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--corrupt") == 0 && i + 1 < argc)
+            sim.corrupt_period = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "usage: %s [--serve [--drop ID] [--corrupt N]]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    int drop_id = sim.drop_id;
+    int corrupt_period = sim.corrupt_period;
+    if(StartSimulator() == false)
+        return 1;
+    sim.drop_id = drop_id;
+    sim.corrupt_period = corrupt_period;
+
+    if(serve)
+    {
+        printf("CM730 simulator on %s\n", sim.slave_name);
+        fflush(stdout);
+        pthread_join(sim.thread, NULL);
+        return 0;
+    }
+
+    printf("\n[CM730 simulator bus tests on %s]\n", sim.slave_name);
+
+    LinuxCM730 linux_cm730(sim.slave_name);
+    CM730 cm730(&linux_cm730);
+    if(cm730.Connect() == false)
+    {
+        printf("Fail to connect CM-730!\n");
+        return 1;
+    }
+
+    TestCycleTime(&cm730);
+    TestData(&cm730);
+    TestDroppedServo(&cm730);
+    TestCorruptByte(&cm730);
+
+    printf("\n%s (%d failed)\n", (failures == 0)? "PASSED" : "FAILED", failures);
+    return (failures == 0)? 0 : 1;
+}
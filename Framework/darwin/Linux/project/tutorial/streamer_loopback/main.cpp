@@ -0,0 +1,291 @@
+/*
+ * main.cpp
+ *
+ *  Loopback test of the MJPG streamer, without a camera or a browser.
+ *
+ *  Synthetic YUYV frames are sent at 30 fps while local HTTP clients read from the streamer on 127.0.0.1:
+ *  a stream client that checks every JPG it receives, a stream client that never reads (a stalled browser),
+ *  and a snapshot client. It reports how long send_image takes, the frame rate the stream client sees, and
+ *  the encoding the streamer settles on without and with a bitrate target.
+ *
+ *  Usage: streamer_loopback [port] [bitrate in bytes/s for the second phase]
+ *  It returns non-zero if a JPG is malformed, the stream stalls, or send_image ever waits.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "mjpg_streamer.h"
+
+#define WIDTH           320
+#define HEIGHT          240
+#define SEND_FPS        30
+#define PHASE_SECONDS   4
+
+static int port = 8099;
+static volatile bool running = true;
+
+/* counted by the stream client */
+static volatile int frames_received = 0;
+static volatile int bad_frames = 0;
+static volatile long bytes_received = 0;
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static int connect_and_request(const char* request)
+{
+    int fd = socket(PF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    for(int attempt = 0; connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0; attempt++)
+    {
+        if(attempt == 50)
+        {
+            close(fd);
+            return -1;
+        }
+        usleep(20000);
+    }
+    char buffer[256];
+    sprintf(buffer, "GET /?action=%s HTTP/1.0\r\n\r\n", request);
+    if(write(fd, buffer, strlen(buffer)) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool read_exact(int fd, unsigned char* buffer, int size)
+{
+    while(size > 0)
+    {
+        int n = read(fd, buffer, size);
+        if(n <= 0)
+            return false;
+        buffer += n;
+        size -= n;
+    }
+    return true;
+}
+
+/* reads a line up to and including \n, returns its length or -1 */
+static int read_line(int fd, char* line, int size)
+{
+    int length = 0;
+    while(length < size - 1)
+    {
+        if(read(fd, line + length, 1) != 1)
+            return -1;
+        if(line[length++] == '\n')
+            break;
+    }
+    line[length] = 0;
+    return length;
+}
+
+static bool valid_jpg(const unsigned char* buf, int size)
+{
+    return size > 4 && buf[0] == 0xFF && buf[1] == 0xD8 && buf[size-2] == 0xFF && buf[size-1] == 0xD9;
+}
+
+static void* stream_client(void* arg)
+{
+    int fd = connect_and_request("stream");
+    if(fd < 0)
+    {
+        bad_frames++;
+        return NULL;
+    }
+    char line[1024];
+    unsigned char* frame = (unsigned char*)malloc(MAX_FRAME_SIZE);
+
+    /* the response header, up to the first boundary */
+    while(read_line(fd, line, sizeof(line)) > 0 && strstr(line, "--" BOUNDARY) == NULL);
+
+    while(running)
+    {
+        int length = -1;
+        while(read_line(fd, line, sizeof(line)) > 2)
+            sscanf(line, "Content-Length: %d", &length);
+        if(length <= 0 || length > MAX_FRAME_SIZE || !read_exact(fd, frame, length))
+        {
+            bad_frames++;
+            break;
+        }
+        if(!valid_jpg(frame, length))
+            bad_frames++;
+        frames_received++;
+        bytes_received += length;
+
+        /* \r\n--boundary\r\n */
+        read_line(fd, line, sizeof(line));
+        read_line(fd, line, sizeof(line));
+    }
+
+    free(frame);
+    close(fd);
+    return NULL;
+}
+
+/* a browser that stopped reading: its socket buffers fill, and its client thread blocks in write */
+static void* stalled_client(void* arg)
+{
+    int fd = connect_and_request("stream");
+    while(running)
+        usleep(100000);
+    if(fd >= 0)
+        close(fd);
+    return NULL;
+}
+
+/* a snapshot waits for the next frame, so it is taken while frames are being sent */
+static void* snapshot_client(void* arg)
+{
+    bool* ok = (bool*)arg;
+    *ok = false;
+    usleep(500000);
+    int fd = connect_and_request("snapshot");
+    if(fd < 0)
+        return NULL;
+    static unsigned char buffer[MAX_FRAME_SIZE];
+    int size = 0, n;
+    while(size < MAX_FRAME_SIZE && (n = read(fd, buffer + size, MAX_FRAME_SIZE - size)) > 0)
+        size += n;
+    close(fd);
+
+    unsigned char* body = (unsigned char*)memmem(buffer, size, "\r\n\r\n", 4);
+    *ok = body != NULL && valid_jpg(body + 4, size - (body + 4 - buffer));
+    return NULL;
+}
+
+/* a moving pattern with some texture, so the JPGs are not trivially small */
+static void fill_frame(Image* img, int t)
+{
+    unsigned char* p = img->m_ImageData;
+    for(int y = 0; y < HEIGHT; y++)
+    {
+        for(int x = 0; x < WIDTH; x += 2)
+        {
+            p[0] = (unsigned char)((x + t*3) ^ (y*2));
+            p[1] = (unsigned char)(128 + ((x + y + t) & 63) - 32);
+            p[2] = (unsigned char)((x + 1 + t*3) ^ (y*2 + (x*y & 15)));
+            p[3] = (unsigned char)(128 + ((y - t) & 63) - 32);
+            p += 4;
+        }
+    }
+}
+
+/* sends frames for a phase, returns the longest send_image in seconds */
+static double run_phase(mjpg_streamer* streamer, Image* img, int& t, double seconds, double& average)
+{
+    double longest = 0, total = 0;
+    int sent = 0;
+    double next = now();
+    double end = next + seconds;
+    while(now() < end)
+    {
+        fill_frame(img, t++);
+        double start = now();
+        streamer->send_image(img);
+        double taken = now() - start;
+        total += taken;
+        sent++;
+        if(taken > longest)
+            longest = taken;
+
+        next += 1.0 / SEND_FPS;
+        double wait = next - now();
+        if(wait > 0)
+            usleep((useconds_t)(wait * 1e6));
+    }
+    average = total / sent;
+    return longest;
+}
+
+int main(int argc, char* argv[])
+{
+    printf( "\n===== MJPG Streamer Loopback Test =====\n\n");
+
+    if(argc > 1)
+        port = atoi(argv[1]);
+    int bitrate = (argc > 2) ? atoi(argv[2]) : 40000;
+
+    signal(SIGPIPE, SIG_IGN);
+
+    Image* img = new Image(WIDTH, HEIGHT, Image::YUV_PIXEL_SIZE);
+    mjpg_streamer* streamer = new mjpg_streamer(WIDTH, HEIGHT, (char*)"./www/", port);
+    streamer->set_targets(SEND_FPS, 0);
+
+    pthread_t stream, stalled, snapshot;
+    bool snapshot_ok;
+    pthread_create(&stream, NULL, stream_client, NULL);
+    pthread_create(&stalled, NULL, stalled_client, NULL);
+    pthread_create(&snapshot, NULL, snapshot_client, &snapshot_ok);
+
+    bool ok = true;
+    int t = 0;
+    int quality, scale;
+    double average;
+
+    double start = now();
+    double longest = run_phase(streamer, img, t, PHASE_SECONDS, average);
+    double elapsed = now() - start;
+    pthread_join(snapshot, NULL);
+    streamer->get_encoding(quality, scale);
+    int frames = frames_received;
+    long bytes = bytes_received;
+    printf("no bitrate target: send_image %.1f us average, %.1f us longest\n", average*1e6, longest*1e6);
+    printf("  stream client: %d frames (%.1f fps, %.0f bytes/s), quality %d, scale 1/%d, snapshot %s\n",
+           frames, frames/elapsed, bytes/elapsed, quality, scale, snapshot_ok ? "ok" : "FAILED");
+    ok = ok && snapshot_ok && frames > PHASE_SECONDS*SEND_FPS/4;
+
+    /* the second half of the phase, once the encoding has settled, is measured */
+    streamer->set_targets(SEND_FPS, bitrate);
+    double longest_limited = run_phase(streamer, img, t, PHASE_SECONDS/2, average);
+    frames = frames_received;
+    bytes = bytes_received;
+    start = now();
+    double longest_settled = run_phase(streamer, img, t, PHASE_SECONDS/2, average);
+    elapsed = now() - start;
+    if(longest_settled > longest_limited)
+        longest_limited = longest_settled;
+    streamer->get_encoding(quality, scale);
+    frames = frames_received - frames;
+    bytes = bytes_received - bytes;
+    printf("bitrate target %d bytes/s: send_image %.1f us average, %.1f us longest\n", bitrate, average*1e6, longest_limited*1e6);
+    printf("  stream client, once settled: %d frames (%.1f fps, %.0f bytes/s), quality %d, scale 1/%d\n",
+           frames, frames/elapsed, bytes/elapsed, quality, scale);
+    ok = ok && frames > 0 && bytes/elapsed < 1.5*bitrate;
+
+    /* send_image is a copy and an exchange; tens of ms would mean it waited on the encoder or a client */
+    if(longest > 0.02 || longest_limited > 0.02)
+        ok = false;
+    if(bad_frames > 0)
+    {
+        printf("%d malformed frames\n", bad_frames);
+        ok = false;
+    }
+
+    printf("%s\n", ok ? "All checks passed" : "Checks FAILED");
+    /* the server threads never return, so leave without joining the clients */
+    running = false;
+    fflush(stdout);
+    _exit(ok ? 0 : 1);
+}
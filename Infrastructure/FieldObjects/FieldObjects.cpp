@@ -11,6 +11,7 @@ FieldObjects::FieldObjects()
 	InitStationaryFieldObjects();
 	InitMobileFieldObjects();
 	m_timestamp = 0.0;
+	m_table.setSize(NUM_STAT_FIELD_OBJECTS + NUM_MOBILE_FIELD_OBJECTS);
 }
 
 FieldObjects::~FieldObjects()
@@ -19,32 +20,27 @@ FieldObjects::~FieldObjects()
 }
 
 FieldObjects::FieldObjects(const FieldObjects& source): TimestampedData(), m_timestamp(source.m_timestamp), self(source.self),
-stationaryFieldObjects(source.stationaryFieldObjects), mobileFieldObjects(source.mobileFieldObjects), ambiguousFieldObjects(source.ambiguousFieldObjects)
+stationaryFieldObjects(source.stationaryFieldObjects), mobileFieldObjects(source.mobileFieldObjects), ambiguousFieldObjects(source.ambiguousFieldObjects),
+m_table(source.m_table)
 {
 }
 
 /*! @brief Preprocesses each field object
 	@param timestamp the current timestamp in ms
  
-	This calls preprocess on each object, and clears all of the ambiguous objects
+	This clears all of the ambiguous objects. Object::preProcess does nothing, so the other objects are not visited.
  */
 void FieldObjects::preProcess(const float timestamp)
 {
-	for (unsigned int i = 0; i < stationaryFieldObjects.size(); i++)
-	{
-		stationaryFieldObjects[i].preProcess(timestamp);
-	}
-	for (unsigned int i = 0; i < mobileFieldObjects.size(); i++)
-	{
-		mobileFieldObjects[i].preProcess(timestamp);
-	}
+	(void)(timestamp); // To stop compiler warnings.
 	ambiguousFieldObjects.clear();
 }
 
 /*! @brief Postprocesses each field object
 	@brief timestamp the current timestamp in ms
  
-	This calls the postprocess on each object, including the ambiguous objects
+	This calls the postprocess on each object, including the ambiguous objects, and records the stationary
+	and mobile objects that were seen in the table.
  */
 void FieldObjects::postProcess(const float timestamp)
 {
@@ -55,6 +51,41 @@ void FieldObjects::postProcess(const float timestamp)
 		mobileFieldObjects[i].postProcess(timestamp);
 	for (unsigned int i = 0; i < ambiguousFieldObjects.size(); i++)
 		ambiguousFieldObjects[i].postProcess(timestamp);
+	updateTable();
+}
+
+/*! @brief Records the visible stationary and mobile objects in the table
+ */
+void FieldObjects::updateTable()
+{
+	m_table.beginFrame();
+	for (unsigned int i = 0; i < stationaryFieldObjects.size(); i++)
+	{
+		if (stationaryFieldObjects[i].isObjectVisible())
+			m_table.addVisible(i, stationaryFieldObjects[i]);
+	}
+	for (unsigned int i = 0; i < mobileFieldObjects.size(); i++)
+	{
+		if (mobileFieldObjects[i].isObjectVisible())
+			m_table.addVisible(NUM_STAT_FIELD_OBJECTS + i, mobileFieldObjects[i]);
+	}
+	m_table.endFrame();
+}
+
+/*! @brief Returns the object at index in the table
+ */
+Object& FieldObjects::tableObject(int index)
+{
+	if (index < NUM_STAT_FIELD_OBJECTS)
+		return stationaryFieldObjects[index];
+	return mobileFieldObjects[index - NUM_STAT_FIELD_OBJECTS];
+}
+
+const Object& FieldObjects::tableObject(int index) const
+{
+	if (index < NUM_STAT_FIELD_OBJECTS)
+		return stationaryFieldObjects[index];
+	return mobileFieldObjects[index - NUM_STAT_FIELD_OBJECTS];
 }
 
 void FieldObjects::InitStationaryFieldObjects()
@@ -658,6 +689,7 @@ std::istream& operator>>(std::istream& input, FieldObjects& p_fob)
         }
         input >> p_fob.ambiguousFieldObjects[i];
     }
+    p_fob.updateTable();
     //std::cout << p_fob.toString();
     return input;
 }
@@ -5,6 +5,7 @@
 #include "Self.h"
 #include "MobileObject.h"
 #include "AmbiguousObject.h"
+#include "FieldObjectsTable.h"
 #include "Tools/FileFormats/TimestampedData.h"
 #include <vector>
 
@@ -109,6 +110,22 @@ public:
 
 	void preProcess(const float timestamp);
 	void postProcess(const float timestamp);
+
+	/*! @brief The vision state of the stationary and mobile objects this frame, see FieldObjectsTable */
+	const FieldObjectsTable& table() const
+	{
+		return m_table;
+	}
+	Object& tableObject(int index);
+	const Object& tableObject(int index) const;
+	static int tableIndex(StationaryFieldObjectID id)
+	{
+		return id;
+	}
+	static int tableIndex(MobileFieldObjectID id)
+	{
+		return NUM_STAT_FIELD_OBJECTS + id;
+	}
     
 	double GetTimestamp() const
 	{
@@ -146,6 +163,9 @@ public:
 private:
 	void InitStationaryFieldObjects();
 	void InitMobileFieldObjects();
+	void updateTable();
+
+	FieldObjectsTable m_table;
 
 
 };
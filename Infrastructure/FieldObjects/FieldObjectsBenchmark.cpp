@@ -0,0 +1,188 @@
+/*! @file FieldObjectsBenchmark.cpp
+    @brief Times the per frame use of FieldObjects with and without its table.
+
+    Each frame vision updates a few objects between preProcess and postProcess, and then four consumers look at the
+    result: the ball and the goal posts, every visible landmark (as SelfLocalisation does), a count of the visible
+    objects, and the objects that changed since the last frame. Without the table each consumer scans the object
+    vectors; with it they use the visible list and the masks. The results of the two are checked against each other.
+
+    Build and run from this directory with
+    @code
+        make FieldObjectsBenchmark && ./FieldObjectsBenchmark
+    @endcode
+    It returns non-zero if the table disagrees with the scans.
+ */
+
+#include "Infrastructure/FieldObjects/FieldObjects.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+static const int NUM_FRAMES = 200000;
+static const float FRAME_TIME = 33;
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+/*! @brief What the consumers found in a frame, summed over the frames */
+struct Result
+{
+    double behaviour;           // ball and goal post distances
+    double localisation;        // bearings of the visible landmarks
+    long logged;                // visible objects
+    long shared;                // objects changed since the last frame
+};
+
+/*! @brief Vision: the ball and a goal post most frames, and a few corners some of the time */
+static void updateVision(FieldObjects& objects, float timestamp, unsigned int seed)
+{
+    Vector3<float> measurement, error;
+    Vector2<float> angle;
+    Vector2<int> position, size;
+    srand(seed);
+    if (rand() % 10 < 8)
+    {
+        measurement = Vector3<float>(100 + rand() % 200, 0.01*(rand() % 100), 0);
+        objects.mobileFieldObjects[FieldObjects::FO_BALL].UpdateVisualObject(measurement, error, angle, position, size, timestamp);
+    }
+    if (rand() % 10 < 5)
+    {
+        measurement = Vector3<float>(200 + rand() % 300, 0.01*(rand() % 100) - 0.5, 0);
+        objects.stationaryFieldObjects[FieldObjects::FO_YELLOW_LEFT_GOALPOST + rand() % 2].UpdateVisualObject(measurement, error, angle, position, size, timestamp);
+    }
+    for (int i = rand() % 3; i > 0; i--)
+    {
+        measurement = Vector3<float>(50 + rand() % 300, 0.01*(rand() % 100) - 0.5, 0);
+        objects.stationaryFieldObjects[FieldObjects::FO_CORNER_YELLOW_FIELD_LEFT + rand() % 15].UpdateVisualObject(measurement, error, angle, position, size, timestamp);
+    }
+    if (rand() % 10 < 3)
+    {
+        AmbiguousObject post(FieldObjects::FO_YELLOW_GOALPOST_UNKNOWN, "Unknown Yellow Post");
+        post.UpdateVisualObject(measurement, error, angle, position, size, timestamp);
+        objects.ambiguousFieldObjects.push_back(post);
+    }
+}
+
+/*! @brief The previous preProcess, which called Object::preProcess on every known object */
+static void previousPreProcess(FieldObjects& objects, float timestamp)
+{
+    for (unsigned int i = 0; i < objects.stationaryFieldObjects.size(); i++)
+        objects.stationaryFieldObjects[i].preProcess(timestamp);
+    for (unsigned int i = 0; i < objects.mobileFieldObjects.size(); i++)
+        objects.mobileFieldObjects[i].preProcess(timestamp);
+    objects.ambiguousFieldObjects.clear();
+}
+
+static void scanConsumers(const FieldObjects& objects, std::vector<bool>& previous, Result& result)
+{
+    const MobileObject& ball = objects.mobileFieldObjects[FieldObjects::FO_BALL];
+    if (ball.isObjectVisible())
+        result.behaviour += ball.measuredDistance();
+    for (int i = FieldObjects::FO_BLUE_LEFT_GOALPOST; i <= FieldObjects::FO_YELLOW_RIGHT_GOALPOST; i++)
+        if (objects.stationaryFieldObjects[i].isObjectVisible())
+            result.behaviour += objects.stationaryFieldObjects[i].measuredDistance();
+
+    for (unsigned int i = 0; i < objects.stationaryFieldObjects.size(); i++)
+        if (objects.stationaryFieldObjects[i].isObjectVisible())
+            result.localisation += objects.stationaryFieldObjects[i].measuredBearing();
+
+    for (unsigned int i = 0; i < objects.stationaryFieldObjects.size(); i++)
+        result.logged += objects.stationaryFieldObjects[i].isObjectVisible();
+    for (unsigned int i = 0; i < objects.mobileFieldObjects.size(); i++)
+        result.logged += objects.mobileFieldObjects[i].isObjectVisible();
+
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < objects.stationaryFieldObjects.size(); i++, n++)
+    {
+        bool visible = objects.stationaryFieldObjects[i].isObjectVisible();
+        result.shared += visible or previous[n];
+        previous[n] = visible;
+    }
+    for (unsigned int i = 0; i < objects.mobileFieldObjects.size(); i++, n++)
+    {
+        bool visible = objects.mobileFieldObjects[i].isObjectVisible();
+        result.shared += visible or previous[n];
+        previous[n] = visible;
+    }
+}
+
+static int popcount(uint64_t bits)
+{
+    int count = 0;
+    for (; bits; bits &= bits - 1)
+        count++;
+    return count;
+}
+
+static void tableConsumers(const FieldObjects& objects, Result& result)
+{
+    const FieldObjectsTable& table = objects.table();
+    const uint64_t wanted = (uint64_t(1) << FieldObjects::tableIndex(FieldObjects::FO_BALL)) | 0xF;
+    for (uint64_t bits = table.visible & wanted; bits; bits &= bits - 1)
+    {
+        int index = 0;
+        while (((bits >> index) & 1) == 0)
+            index++;
+        result.behaviour += table.distance[index];
+    }
+
+    for (int i = 0; i < table.numVisible(); i++)
+        if (table.visibleIndex(i) < FieldObjects::NUM_STAT_FIELD_OBJECTS)
+            result.localisation += objects.tableObject(table.visibleIndex(i)).measuredBearing();
+
+    result.logged += table.numVisible();
+    result.shared += popcount(table.changed);
+}
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(3);
+    FieldObjects previous_objects, table_objects;
+    std::vector<bool> previous_visible(FieldObjects::NUM_STAT_FIELD_OBJECTS + FieldObjects::NUM_MOBILE_FIELD_OBJECTS, false);
+    Result scanned = Result(), tabled = Result();
+    double scan_consumer_time = 0, table_consumer_time = 0;
+
+    double start = now();
+    for (int f = 1; f <= NUM_FRAMES; f++)
+    {
+        float timestamp = f*FRAME_TIME;
+        previousPreProcess(previous_objects, timestamp);
+        updateVision(previous_objects, timestamp, f);
+        previous_objects.postProcess(timestamp);
+        double consumer_start = now();
+        scanConsumers(previous_objects, previous_visible, scanned);
+        scan_consumer_time += now() - consumer_start;
+    }
+    double scan_time = now() - start;
+
+    start = now();
+    for (int f = 1; f <= NUM_FRAMES; f++)
+    {
+        float timestamp = f*FRAME_TIME;
+        table_objects.preProcess(timestamp);
+        updateVision(table_objects, timestamp, f);
+        table_objects.postProcess(timestamp);
+        double consumer_start = now();
+        tableConsumers(table_objects, tabled);
+        table_consumer_time += now() - consumer_start;
+    }
+    double table_time = now() - start;
+
+    std::cout << NUM_FRAMES << " frames, " << (double)scanned.logged/NUM_FRAMES << " objects visible per frame" << std::endl;
+    std::cout << "scanning the objects: " << 1e6*scan_time/NUM_FRAMES << " us per frame, of which the consumers "
+              << 1e6*scan_consumer_time/NUM_FRAMES << " us" << std::endl;
+    std::cout << "with the table:       " << 1e6*table_time/NUM_FRAMES << " us per frame, of which the consumers "
+              << 1e6*table_consumer_time/NUM_FRAMES << " us" << std::endl;
+    std::cout << "(both frames include vision's updates and postProcess, which visits every object and fills the table)" << std::endl;
+
+    bool ok = scanned.behaviour == tabled.behaviour and scanned.localisation == tabled.localisation
+              and scanned.logged == tabled.logged and scanned.shared == tabled.shared;
+    std::cout << (ok ? "The table agrees with the scans" : "The table DISAGREES with the scans") << std::endl;
+    return ok ? 0 : 1;
+}
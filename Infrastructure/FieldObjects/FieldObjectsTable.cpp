@@ -0,0 +1,47 @@
+#include "FieldObjectsTable.h"
+
+FieldObjectsTable::FieldObjectsTable()
+{
+	m_size = 0;
+	visible = seen = lost = changed = 0;
+	m_previous_visible = 0;
+	m_num_visible = 0;
+	for (int i = 0; i < MAX_OBJECTS; i++)
+	{
+		distance[i] = bearing[i] = elevation[i] = 0;
+		timeLastSeen[i] = timeSeen[i] = 0;
+	}
+}
+
+/*! @brief Starts a frame, the visible objects are then added with addVisible
+ */
+void FieldObjectsTable::beginFrame()
+{
+	m_previous_visible = visible;
+	visible = 0;
+	m_num_visible = 0;
+}
+
+/*! @brief Adds an object seen this frame, copying its measurement
+	@param index the object's index in the table
+	@param object the object
+ */
+void FieldObjectsTable::addVisible(int index, const Object& object)
+{
+	visible |= uint64_t(1) << index;
+	m_visible_list[m_num_visible++] = index;
+	distance[index] = object.measuredDistance();
+	bearing[index] = object.measuredBearing();
+	elevation[index] = object.measuredElevation();
+	timeLastSeen[index] = object.TimeLastSeen();
+	timeSeen[index] = object.TimeSeen();
+}
+
+/*! @brief Finishes a frame by working out which objects were found and lost
+ */
+void FieldObjectsTable::endFrame()
+{
+	seen = visible & ~m_previous_visible;
+	lost = m_previous_visible & ~visible;
+	changed = visible | lost;
+}
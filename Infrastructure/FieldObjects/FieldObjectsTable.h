@@ -0,0 +1,57 @@
+#ifndef FIELDOBJECTSTABLE_H
+#define FIELDOBJECTSTABLE_H
+
+#include "Object.h"
+#include <stdint.h>
+
+/*! @brief The vision state of the known field objects for one frame, as a structure of arrays.
+
+	FieldObjects fills this in postProcess, so that a consumer can look at only the objects vision updated
+	instead of scanning every object. An object's index is its stationary id, or NUM_STAT_FIELD_OBJECTS plus
+	its mobile id; FieldObjects::tableObject(index) gives the object itself.
+
+	The masks have bit i set for object i:
+		- visible: the object was seen this frame
+		- seen: the object was seen this frame and was not seen the frame before
+		- lost: the object was seen the frame before and is not seen this frame
+		- changed: visible or lost, that is, everything vision changed this frame
+	The measurements are those of the last frame the object was seen.
+ */
+class FieldObjectsTable
+{
+public:
+	static const int MAX_OBJECTS = 64;
+
+	FieldObjectsTable();
+
+	void beginFrame();
+	void addVisible(int index, const Object& object);
+	void endFrame();
+
+	int size() const {return m_size;}
+	void setSize(int size) {m_size = size;}
+
+	uint64_t visible;
+	uint64_t seen;
+	uint64_t lost;
+	uint64_t changed;
+
+	int numVisible() const {return m_num_visible;}
+	int visibleIndex(int i) const {return m_visible_list[i];}
+	bool isVisible(int index) const {return (visible >> index) & 1;}
+	bool isChanged(int index) const {return (changed >> index) & 1;}
+
+	float distance[MAX_OBJECTS];
+	float bearing[MAX_OBJECTS];
+	float elevation[MAX_OBJECTS];
+	float timeLastSeen[MAX_OBJECTS];
+	float timeSeen[MAX_OBJECTS];
+
+private:
+	int m_size;
+	uint64_t m_previous_visible;
+	int m_num_visible;
+	unsigned char m_visible_list[MAX_OBJECTS];
+};
+
+#endif
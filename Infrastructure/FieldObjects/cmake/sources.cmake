@@ -23,6 +23,7 @@ ENDIF()
 SET (YOUR_SRCS
 AmbiguousObject.cpp
 FieldObjects.cpp
+FieldObjectsTable.cpp
 MobileObject.cpp
 Object.cpp
 Self.cpp
@@ -20,6 +20,7 @@
  */
 
 #include "ChangeCameraSettingsJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -101,6 +102,24 @@ void ChangeCameraSettingsJob::toStream(std::ostream& output) const
     output << m_camera_settings;
 }
 
+/*! @brief Writes the ChangeCameraSettingsJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void ChangeCameraSettingsJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    m_camera_settings.toBuffer(output);
+}
+
+/*! @brief Reads the ChangeCameraSettingsJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void ChangeCameraSettingsJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_camera_settings.fromBuffer(input);
+}
+
 /*! @relates ChangeCameraSettingsJob
     @brief Stream insertion operator for a ChangeCameraSettingsJob
 
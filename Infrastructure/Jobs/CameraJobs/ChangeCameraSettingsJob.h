@@ -45,6 +45,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const ChangeCameraSettingsJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     CameraSettings m_camera_settings;         //!< the camera settings to apply
 };
@@ -21,12 +21,13 @@
 
 #include "Job.h"
 #include "Jobs.h"
+#include "JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
 /*! @brief Job constructor
  */
-Job::Job(job_type_t jobtype, job_id_t jobid) : m_job_type(jobtype), m_job_id(jobid)
+Job::Job(job_type_t jobtype, job_id_t jobid) : m_job_type(jobtype), m_job_id(jobid), m_job_time(0)
 {
 }
 
@@ -87,6 +88,31 @@ void Job::toStream(std::ostream& output) const
     output.write((char*) &m_job_time, sizeof(m_job_time));
 }
 
+/*! @brief Writes the job into a buffer for the binary job format (see JobList::encode).
+
+    Like toStream each class level writes the members introduced at that level, so a child's
+    implementation starts with Job::toBuffer(output). Unlike the stream the buffer is not self
+    describing; fromBuffer must read exactly what toBuffer wrote, in the same order.
+
+    @param output the writer to put the job in
+ */
+void Job::toBuffer(JobWriter& output) const
+{
+    output.putDouble(m_job_time);
+}
+
+/*! @brief Reads the job's members out of a buffer written by toBuffer.
+
+    Jobs are reused by the JobPool, so every member written by toBuffer must be overwritten here, and
+    containers should be refilled in place rather than reconstructed.
+
+    @param input the reader from which to take the job
+ */
+void Job::fromBuffer(JobReader& input)
+{
+    m_job_time = input.getDouble();
+}
+
 /*! @relates Job
     @brief Stream insertion operator for Job.
  
@@ -177,6 +203,9 @@ std::istream& operator>>(std::istream& input, Job** job)
         case Job::MOTION_WALK_PARAMETERS:
             *job = new WalkParametersJob(input);
             break;
+        case Job::MOTION_WALK_PERTURBATION:
+            *job = new WalkPerturbationJob(input);
+            break;
         case Job::MOTION_KICK:
             *job = new KickJob(jobtime, input);
             break;
@@ -30,6 +30,8 @@
 #include <vector>
 #include <iostream>
 
+class JobWriter;
+class JobReader;
 
 class Job
 {
@@ -95,8 +97,11 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const Job& job);
     friend std::ostream& operator<<(std::ostream& output, const Job* job);
     friend std::istream& operator>>(std::istream& input, Job** job);
+    friend class JobList;
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 
 protected:
     // Properties that *every* job has
@@ -0,0 +1,268 @@
+/*! @file JobCodec.h
+    @brief Declaration and implementation of the JobWriter and JobReader classes.
+
+    @class JobWriter
+    @brief Writes job data into a fixed size buffer in a little-endian layout that is independent of the host
+
+    Writing past the end of the buffer does not write anything; it sets a flag that can be checked with ok().
+
+    @class JobReader
+    @brief Reads job data written by a JobWriter out of a buffer
+
+    Reading past the end of the buffer returns zeros, and sets a flag that can be checked with ok(), so
+    a job can read all of its members and be checked once at the end.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JOBCODEC_H
+#define JOBCODEC_H
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+class JobWriter
+{
+public:
+    JobWriter(char* buffer, int size) : m_buffer(buffer), m_size(size), m_position(0), m_ok(true) {}
+
+    bool ok() const {return m_ok;}
+    int position() const {return m_position;}
+    char* at(int position) {return m_buffer + position;}
+
+    /*! @brief Reserves space to be filled in later, and returns its position (or -1 if there is no room) */
+    int skip(int numbytes)
+    {
+        if (not fits(numbytes))
+            return -1;
+        int position = m_position;
+        m_position += numbytes;
+        return position;
+    }
+
+    void putUint8(uint8_t value)
+    {
+        if (fits(1))
+            m_buffer[m_position++] = static_cast<char>(value);
+    }
+
+    void putBool(bool value) {putUint8(value ? 1 : 0);}
+
+    void putUint16(uint16_t value)
+    {
+        if (fits(2))
+        {
+            putUint16(m_buffer + m_position, value);
+            m_position += 2;
+        }
+    }
+
+    void putUint32(uint32_t value)
+    {
+        if (fits(4))
+        {
+            m_buffer[m_position] = static_cast<char>(value);
+            m_buffer[m_position + 1] = static_cast<char>(value >> 8);
+            m_buffer[m_position + 2] = static_cast<char>(value >> 16);
+            m_buffer[m_position + 3] = static_cast<char>(value >> 24);
+            m_position += 4;
+        }
+    }
+
+    void putFloat(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        putUint32(bits);
+    }
+
+    void putDouble(double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        putUint32(static_cast<uint32_t>(bits));
+        putUint32(static_cast<uint32_t>(bits >> 32));
+    }
+
+    /*! @brief Writes a vector of floats as a uint8 length followed by the values. At most 255 values can be written. */
+    void putFloats(const std::vector<float>& values)
+    {
+        if (values.size() > 255)
+        {
+            m_ok = false;
+            return;
+        }
+        putUint8(values.size());
+        for (size_t i=0; i<values.size(); i++)
+            putFloat(values[i]);
+    }
+
+    /*! @brief Writes a string as a uint16 length followed by the characters */
+    void putString(const std::string& value)
+    {
+        if (value.size() > 0xFFFF)
+        {
+            m_ok = false;
+            return;
+        }
+        putBytes(value.data(), value.size());
+    }
+
+    /*! @brief Writes a block of bytes as a uint16 length followed by the bytes */
+    void putBytes(const char* data, int numbytes)
+    {
+        putUint16(numbytes);
+        if (fits(numbytes))
+        {
+            memcpy(m_buffer + m_position, data, numbytes);
+            m_position += numbytes;
+        }
+    }
+
+    /*! @brief Writes a uint16 at a position reserved with skip() */
+    static void putUint16(char* buffer, uint16_t value)
+    {
+        buffer[0] = static_cast<char>(value);
+        buffer[1] = static_cast<char>(value >> 8);
+    }
+private:
+    bool fits(int numbytes)
+    {
+        if (m_ok and m_position + numbytes <= m_size)
+            return true;
+        m_ok = false;
+        return false;
+    }
+private:
+    char* m_buffer;             //!< the buffer being written
+    int m_size;                 //!< the size of the buffer in bytes
+    int m_position;             //!< the number of bytes written so far
+    bool m_ok;                  //!< false once a write did not fit
+};
+
+class JobReader
+{
+public:
+    JobReader(const char* buffer, int size) : m_buffer(buffer), m_size(size), m_position(0), m_ok(true) {}
+
+    bool ok() const {return m_ok;}
+    int position() const {return m_position;}
+    int remaining() const {return m_size - m_position;}
+
+    uint8_t getUint8()
+    {
+        if (not fits(1))
+            return 0;
+        return static_cast<uint8_t>(m_buffer[m_position++]);
+    }
+
+    bool getBool() {return getUint8() != 0;}
+
+    uint16_t getUint16()
+    {
+        if (not fits(2))
+            return 0;
+        const unsigned char* b = reinterpret_cast<const unsigned char*>(m_buffer + m_position);
+        m_position += 2;
+        return b[0] | (b[1] << 8);
+    }
+
+    uint32_t getUint32()
+    {
+        if (not fits(4))
+            return 0;
+        const unsigned char* b = reinterpret_cast<const unsigned char*>(m_buffer + m_position);
+        m_position += 4;
+        return b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+    }
+
+    float getFloat()
+    {
+        uint32_t bits = getUint32();
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    double getDouble()
+    {
+        uint64_t bits = getUint32();
+        bits |= static_cast<uint64_t>(getUint32()) << 32;
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /*! @brief Reads a vector of floats written by putFloats. The vector's storage is reused, so this only allocates if it grows. */
+    void getFloats(std::vector<float>& values)
+    {
+        unsigned int size = getUint8();
+        if (not fits(4*size))
+            size = 0;
+        values.resize(size);
+        for (unsigned int i=0; i<size; i++)
+            values[i] = getFloat();
+    }
+
+    /*! @brief Reads a string written by putString. The string's storage is reused, so this only allocates if it grows. */
+    void getString(std::string& value)
+    {
+        int numbytes = 0;
+        const char* data = getBytes(numbytes);
+        value.assign(data, numbytes);
+    }
+
+    /*! @brief Returns a reader over the next numbytes bytes, and skips over them in this reader.
+               If there are not that many bytes left the returned reader is empty, and this reader is not ok().
+     */
+    JobReader take(int numbytes)
+    {
+        if (numbytes < 0 or not fits(numbytes))
+            return JobReader(m_buffer, 0);
+        JobReader reader(m_buffer + m_position, numbytes);
+        m_position += numbytes;
+        return reader;
+    }
+
+    /*! @brief Reads a block of bytes written by putBytes, without copying them
+        @param numbytes will be updated with the number of bytes in the block
+        @return a pointer to the bytes, which is only valid as long as the buffer being read
+     */
+    const char* getBytes(int& numbytes)
+    {
+        numbytes = getUint16();
+        if (not fits(numbytes))
+            numbytes = 0;
+        const char* data = m_buffer + m_position;
+        m_position += numbytes;
+        return data;
+    }
+private:
+    bool fits(int numbytes)
+    {
+        if (m_ok and m_position + numbytes <= m_size)
+            return true;
+        m_ok = false;
+        return false;
+    }
+private:
+    const char* m_buffer;       //!< the buffer being read
+    int m_size;                 //!< the size of the buffer in bytes
+    int m_position;             //!< the number of bytes read so far
+    bool m_ok;                  //!< false once a read went past the end of the buffer
+};
+
+#endif
@@ -20,9 +20,14 @@
  */
 
 #include "JobList.h"
+#include "JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
+#include <string.h>
+
+const char JobList::Header[4] = {'N', 'U', 'j', 'b'};
+
 /*! @brief JobList constructor
  */
 JobList::JobList()
@@ -34,6 +39,7 @@ JobList::JobList()
     m_job_lists.push_back(&m_camera_jobs);
     m_job_lists.push_back(&m_system_jobs);
     m_job_lists.push_back(&m_other_jobs);
+    pthread_mutex_init(&m_spare_nodes_mutex, NULL);
 }
 
 /*! @brief Job destructor
@@ -47,6 +53,7 @@ JobList::~JobList()
         if (*it != NULL)
             delete *it;
     }
+    pthread_mutex_destroy(&m_spare_nodes_mutex);
 }
 
 /*! @brief Add a job to the job list. The type inside the job will be used to determine what type it is ;)
@@ -137,7 +144,15 @@ void JobList::addOtherJob(Job* job)
  */
 void JobList::addJob(Job* job, std::list<Job*>& joblist)
 {
-    joblist.push_back(job);
+    pthread_mutex_lock(&m_spare_nodes_mutex);
+    if (m_spare_nodes.empty())
+        joblist.push_back(job);
+    else
+    {   // reuse the node of a removed job rather than allocating a new one
+        m_spare_nodes.front() = job;
+        joblist.splice(joblist.end(), m_spare_nodes, m_spare_nodes.begin());
+    }
+    pthread_mutex_unlock(&m_spare_nodes_mutex);
 }
 
 /*! @brief Remove a job from the list based on its an iterator's position
@@ -211,7 +226,9 @@ std::list<Job*>::iterator JobList::removeMotionJob(std::list<Job*>::iterator ite
  */
 void JobList::clearMotionJobs()
 {
-    m_motion_jobs.clear();
+    pthread_mutex_lock(&m_spare_nodes_mutex);
+    m_spare_nodes.splice(m_spare_nodes.end(), m_motion_jobs);
+    pthread_mutex_unlock(&m_spare_nodes_mutex);
 }
 
 /*! @brief Remove a camera job from the list
@@ -241,15 +258,21 @@ std::list<Job*>::iterator JobList::removeOtherJob(std::list<Job*>::iterator iter
     return removeJob(m_other_jobs, iter);
 }
 
-/*! @brief Remove a job from the passed in list
+/*! @brief Remove a job from the passed in list. The job is given to the pool to be reused by decode, and its list node is kept for addJob.
     @param joblist the list from which the job will be removed
     @param iter the position in the list of the job to be removed
     @return the new iterator position post job-removal
  */
 std::list<Job*>::iterator JobList::removeJob(std::list<Job*>& joblist, std::list<Job*>::iterator iter)
 {
-    delete *iter;
-    return joblist.erase(iter);
+    Job* job = *iter;
+    std::list<Job*>::iterator next = iter;
+    ++next;
+    pthread_mutex_lock(&m_spare_nodes_mutex);
+    m_spare_nodes.splice(m_spare_nodes.end(), joblist, iter);
+    pthread_mutex_unlock(&m_spare_nodes_mutex);
+    m_pool.release(job);
+    return next;
 }
 
 /*! @brief Returns an iterator at the beginning of the job list. This iterator goes over the
@@ -374,13 +397,15 @@ std::list<Job*>::iterator JobList::other_end()
     return m_other_jobs.end();
 }
 
-/*! @brief Clears the contents of the job list
+/*! @brief Clears the contents of the job list. The jobs themselves are not deleted.
  */
 void JobList::clear()
 {
     std::list<std::list<Job*>*>::iterator it;
+    pthread_mutex_lock(&m_spare_nodes_mutex);
     for (it = m_job_lists.begin(); it != m_job_lists.end(); it++)
-        (*it)->clear();
+        m_spare_nodes.splice(m_spare_nodes.end(), **it);
+    pthread_mutex_unlock(&m_spare_nodes_mutex);
 }
 
 /*! @brief Returns true if the JobList is empty
@@ -455,6 +480,7 @@ std::istream& operator>>(std::istream& input, JobList& joblist)
     Job* tempjob = NULL;
     for (unsigned int i=0; i<numnewjobs; i++)
     {
+        tempjob = NULL;                     // an unknown job leaves this untouched, and the previous job must not be added twice
         input >> &tempjob;
         joblist.addJob(tempjob);
     }
@@ -462,6 +488,163 @@ std::istream& operator>>(std::istream& input, JobList& joblist)
 }
 
 
+/*! @brief Encodes the jobs in the binary job format, which unlike the stream format can be decoded without any stream parsing.
+
+    The layout is, with every field little-endian:
+        0   char[4]     header "NUjb"
+        4   uint8       version
+        5   uint8       reserved (0)
+        6   uint32      the CRC-32 of every byte after it
+        10  uint16      number of jobs
+        12  the jobs, each of which is
+                uint16      the number of bytes in the rest of the job
+                uint8       job id
+                double      job time
+                            the job specific data written by the job's toBuffer
+ 
+    The length prefix lets a receiver skip the jobs it does not know about, and the checksum lets it
+    drop a packet that was damaged on the way.
+ 
+    @param buffer the buffer to encode the jobs into
+    @param size the size of the buffer in bytes
+    @return the number of bytes used, or 0 if the buffer is too small
+ */
+int JobList::encode(char* buffer, int size)
+{
+    JobWriter output(buffer, size);
+    for (int i=0; i<4; i++)
+        output.putUint8(Header[i]);
+    output.putUint8(Version);
+    output.putUint8(0);
+    int checksumposition = output.skip(4);
+    int countposition = output.skip(2);
+    
+    unsigned int count = 0;
+    std::list<std::list<Job*>*>::iterator it;
+    std::list<Job*>::iterator jit;
+    for (it = m_job_lists.begin(); it != m_job_lists.end(); ++it)
+    {
+        for (jit = (*it)->begin(); jit != (*it)->end() and output.ok(); ++jit)
+        {
+            int lengthposition = output.skip(2);
+            output.putUint8((*jit)->getID());
+            (*jit)->toBuffer(output);
+            if (output.ok())
+                JobWriter::putUint16(output.at(lengthposition), output.position() - lengthposition - 2);
+            count++;
+        }
+    }
+    
+    if (not output.ok() or count > 0xFFFF)
+    {
+        errorlog << "JobList::encode. The " << count << " jobs do not fit in " << size << " bytes." << std::endl;
+        return 0;
+    }
+    JobWriter::putUint16(output.at(countposition), count);
+    JobWriter(output.at(checksumposition), 4).putUint32(checksum(buffer + countposition, output.position() - countposition));
+    return output.position();
+}
+
+/*! @brief Decodes jobs written by encode, and adds them to the list. The jobs are taken from the pool of removed jobs,
+           so a steady stream of jobs does not allocate once the pool has warmed up.
+ 
+    Jobs with an id this version can not create are skipped. A packet from another version of the format,
+    or whose checksum does not match, is dropped without decoding any of its jobs.
+ 
+    @param buffer the encoded jobs
+    @param size the number of bytes in the buffer
+    @return false if the buffer is not in this version of the binary job format, or is damaged or truncated
+ */
+bool JobList::decode(const char* buffer, int size)
+{
+    if (not isEncoded(buffer, size))
+        return false;
+    if (static_cast<unsigned char>(buffer[4]) != Version)
+    {
+        errorlog << "JobList::decode. Version " << static_cast<int>(static_cast<unsigned char>(buffer[4])) << " of the binary job format is not supported." << std::endl;
+        return false;
+    }
+    
+    JobReader input(buffer, size);
+    input.take(6);                          // the header and version have already been checked
+    if (input.getUint32() != checksum(buffer + 10, size - 10))
+    {
+        #if DEBUG_JOBS_VERBOSITY > 0
+            debug << "JobList::decode. Dropping a damaged packet of " << size << " bytes." << std::endl;
+        #endif
+        return false;
+    }
+    
+    unsigned int count = input.getUint16();
+    for (unsigned int i=0; i<count; i++)
+    {
+        JobReader jobinput = input.take(input.getUint16());
+        if (not input.ok())
+        {
+            errorlog << "JobList::decode. Job " << i << " of " << count << " runs past the end of the " << size << " bytes." << std::endl;
+            return false;
+        }
+        
+        Job::job_id_t jobid = static_cast<Job::job_id_t>(jobinput.getUint8());
+        Job* job = m_pool.acquire(jobid);
+        if (job == NULL)
+        {
+            #if DEBUG_JOBS_VERBOSITY > 0
+                debug << "JobList::decode. Skipping job with unknown id " << jobid << std::endl;
+            #endif
+            continue;
+        }
+        
+        job->fromBuffer(jobinput);
+        if (jobinput.ok())
+            addJob(job);
+        else
+        {
+            errorlog << "JobList::decode. Job " << jobid << " is shorter than its data." << std::endl;
+            m_pool.release(job);
+        }
+    }
+    return true;
+}
+
+/*! @brief Returns true if the buffer starts with the binary job format's header. Packets without it are in the stream format.
+    @param buffer the received data
+    @param size the number of bytes in the buffer
+ */
+bool JobList::isEncoded(const char* buffer, int size)
+{
+    return size >= HeaderSize and memcmp(buffer, Header, 4) == 0;
+}
+
+/*! @brief The lookup table of the CRC-32, built once */
+struct CrcTable
+{
+    uint32_t Entries[256];
+    CrcTable()
+    {
+        for (uint32_t i=0; i<256; i++)
+        {
+            uint32_t c = i;
+            for (int k=0; k<8; k++)
+                c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            Entries[i] = c;
+        }
+    }
+};
+
+/*! @brief Returns the CRC-32 (the polynomial used by ethernet and zlib) of the bytes
+    @param buffer the bytes to check
+    @param size the number of bytes
+ */
+uint32_t JobList::checksum(const char* buffer, int size)
+{
+    static const CrcTable table;
+    uint32_t crc = 0xFFFFFFFF;
+    for (int i=0; i<size; i++)
+        crc = table.Entries[(crc ^ static_cast<unsigned char>(buffer[i])) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFF;
+}
+
 
 /******************************************************************************************************************************************
                                                                                                             JobListIterator Implementation
@@ -27,9 +27,12 @@
 #define JOBLIST_H
 
 #include "Job.h"
+#include "JobPool.h"
 
 #include <list>
 #include <iterator>
+#include <pthread.h>
+#include <stdint.h>
 
 
 class JobListIterator;      // definition is below JobList
@@ -92,6 +95,15 @@ public:
     friend std::ostream& operator<<(std::ostream& output, JobList& joblist);
     friend std::istream& operator>>(std::istream& input, JobList& joblist);
     
+    // Binary job format
+    int encode(char* buffer, int size);
+    bool decode(const char* buffer, int size);
+    static bool isEncoded(const char* buffer, int size);
+    static uint32_t checksum(const char* buffer, int size);
+    static const char Header[4];
+    static const unsigned char Version = 2;
+    static const int HeaderSize = 12;
+    
 private:
     void addJob(Job* job, std::list<Job*>& joblist);
     std::list<Job*>::iterator removeJob(std::list<Job*>& joblist, std::list<Job*>::iterator iter);
@@ -105,6 +117,10 @@ private:
     std::list<Job*> m_system_jobs;               //!< a list of all the current system/os jobs
     std::list<Job*> m_other_jobs;                //!< a list of all other jobs
     std::list<std::list<Job*>*> m_job_lists;          //!< a list of all the lists of jobs
+    
+    JobPool m_pool;                              //!< the removed jobs waiting to be reused by decode
+    std::list<Job*> m_spare_nodes;               //!< list nodes left over from removed jobs, spliced back in by addJob so adding a job does not allocate
+    pthread_mutex_t m_spare_nodes_mutex;         //!< lock protecting m_spare_nodes, as jobs are added by the JobPort's thread
 };
 
 
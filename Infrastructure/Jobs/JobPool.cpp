@@ -0,0 +1,142 @@
+/*! @file JobPool.cpp
+    @brief Implementation of JobPool class.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "JobPool.h"
+#include "Jobs.h"
+#include "debug.h"
+#include "debugverbosityjobs.h"
+
+/*! @brief JobPool constructor
+ */
+JobPool::JobPool()
+{
+    pthread_mutex_init(&m_mutex, NULL);
+    for (int i=0; i<Job::ID_UNDEFINED; i++)
+        m_free[i].reserve(MaxFree);
+}
+
+/*! @brief JobPool destructor. Deletes all of the jobs waiting to be reused.
+ */
+JobPool::~JobPool()
+{
+    for (int i=0; i<Job::ID_UNDEFINED; i++)
+    {
+        for (size_t j=0; j<m_free[i].size(); j++)
+            delete m_free[i][j];
+    }
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/*! @brief Gets a job with the given id, reusing a released job if there is one. The job's members are
+           left over from its previous use, so the caller must set them all (ie. with Job::fromBuffer).
+    @param jobid the id of the job
+    @return the job, or NULL if jobs with that id can not be created by the pool
+ */
+Job* JobPool::acquire(Job::job_id_t jobid)
+{
+    if (jobid < 0 or jobid >= Job::ID_UNDEFINED)
+        return NULL;
+
+    Job* job = NULL;
+    pthread_mutex_lock(&m_mutex);
+    if (not m_free[jobid].empty())
+    {
+        job = m_free[jobid].back();
+        m_free[jobid].pop_back();
+    }
+    pthread_mutex_unlock(&m_mutex);
+
+    if (job == NULL)
+        job = create(jobid);
+    return job;
+}
+
+/*! @brief Gives a finished job to the pool. The pool takes ownership of the job, which may be deleted.
+    @param job the finished job. It need not have come from the pool, but it must have been created with new.
+ */
+void JobPool::release(Job* job)
+{
+    if (job == NULL)
+        return;
+
+    Job::job_id_t jobid = job->getID();
+    bool kept = false;
+    if (jobid >= 0 and jobid < Job::ID_UNDEFINED)
+    {
+        pthread_mutex_lock(&m_mutex);
+        if (m_free[jobid].size() < MaxFree)
+        {
+            m_free[jobid].push_back(job);
+            kept = true;
+        }
+        pthread_mutex_unlock(&m_mutex);
+    }
+
+    if (not kept)
+        delete job;
+}
+
+/*! @brief Creates a new job with the given id, with placeholder members
+    @param jobid the id of the job
+    @return the new job, or NULL if the job can not be sent over the network
+
+    @attention This needs to be updated when you want to send a new type of Job, at the same time as
+               adding its toBuffer and fromBuffer.
+ */
+Job* JobPool::create(Job::job_id_t jobid)
+{
+    #if DEBUG_JOBS_VERBOSITY > 2
+        debug << "JobPool::create(" << jobid << ")" << std::endl;
+    #endif
+    switch (jobid)
+    {
+        case Job::MOTION_WALK_TO_POINT:
+            return new WalkToPointJob(0, std::vector<float>(3, 0));
+        case Job::MOTION_WALK:
+            return new WalkJob(0, 0, 0);
+        case Job::MOTION_WALK_PARAMETERS:
+            return new WalkParametersJob(WalkParameters());
+        case Job::MOTION_WALK_PERTURBATION:
+            return new WalkPerturbationJob(0, 0);
+        case Job::MOTION_KICK:
+            return new KickJob(0, std::vector<float>(2, 0), std::vector<float>(2, 0));
+        case Job::MOTION_BLOCK:
+            return new BlockJob(0, 0, 0);
+        case Job::MOTION_SAVE:
+            return new SaveJob(0, std::vector<float>(3, 0));
+        case Job::MOTION_SCRIPT:
+            return new ScriptJob(0, std::string());
+        case Job::MOTION_HEAD:
+            return new HeadJob(0, std::vector<float>(3, 0));
+        case Job::MOTION_TRACK:
+            return new HeadTrackJob(0, 0);
+        case Job::MOTION_NOD:
+            return new HeadNodJob(HeadNodJob::Ball);
+        case Job::MOTION_PAN:
+            return new HeadPanJob(HeadPanJob::Ball);
+        case Job::MOTION_FREEZE:
+            return new MotionFreezeJob();
+        case Job::MOTION_KILL:
+            return new MotionKillJob();
+        case Job::CAMERA_CHANGE_SETTINGS:
+            return new ChangeCameraSettingsJob(CameraSettings());
+        case Job::VISION_SAVE_IMAGES:
+            return new SaveImagesJob(false);
+        default:
+            return NULL;
+    }
+}
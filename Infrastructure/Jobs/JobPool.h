@@ -0,0 +1,52 @@
+/*! @file JobPool.h
+    @brief Declaration of JobPool class.
+
+    @class JobPool
+    @brief A store of finished jobs, kept by job id so they can be reused instead of deleted and re-created
+
+    Jobs received from the network are decoded into jobs taken from the pool, and jobs removed from the
+    JobList are returned to it, so once the pool has warmed up a steady stream of jobs does not touch the heap.
+    Only a few jobs of each id are kept; any more are deleted.
+
+    The pool is shared by the thread receiving the jobs and the thread processing them, so it is locked.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JOBPOOL_H
+#define JOBPOOL_H
+
+#include "Job.h"
+
+#include <vector>
+#include <pthread.h>
+
+class JobPool
+{
+public:
+    JobPool();
+    ~JobPool();
+
+    Job* acquire(Job::job_id_t jobid);
+    void release(Job* job);
+private:
+    static Job* create(Job::job_id_t jobid);
+private:
+    static const unsigned int MaxFree = 8;                  //!< the maximum number of jobs of each id kept for reuse
+
+    pthread_mutex_t m_mutex;                                //!< lock protecting m_free
+    std::vector<Job*> m_free[Job::ID_UNDEFINED];            //!< the jobs waiting to be reused, indexed by job id
+};
+
+#endif
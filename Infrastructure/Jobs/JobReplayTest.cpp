@@ -0,0 +1,331 @@
+/*! @file JobReplayTest.cpp
+    @brief A replay test, fuzz test and benchmark of the stream and binary job formats
+
+    A stream of job packets like the ones NUView and the team send to a robot is captured twice:
+    once written with operator<< as the old stream format, and once with JobList::encode as the binary
+    format. Both captures are replayed into fresh JobLists, the way JobPort receives them, and every
+    decoded frame is compared against the jobs that were sent. The jobs are compared through toStream,
+    so every member a job writes must survive both paths. The test also checks that
+        - a job with an id the receiver does not know is skipped, and the rest of the packet kept
+        - truncated and corrupted packets are rejected, by their job lengths and the packet's checksum
+        - encode refuses a buffer that is too small
+    and then times and counts the heap allocations of each replay. Once the job pool is warm the binary format should
+    not allocate at all.
+
+    Build and run from this directory with
+    @code
+        make JobReplayTest && ./JobReplayTest
+    @endcode
+    It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "JobList.h"
+#include "JobCodec.h"
+#include "Jobs.h"
+#include "NUPlatform/NUCamera/CameraSettings.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+static const int NumFrames = 2000;
+static const int PacketSize = 4096;         //!< the size of JobPort's send buffer
+
+static unsigned long allocations = 0;
+
+void* operator new(size_t size)
+{
+    allocations++;
+    void* p = malloc(size ? size : 1);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) throw()
+{
+    free(p);
+}
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t random32()
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static float randomFloat(float range)
+{
+    return range*(static_cast<int>(random32() % 20001) - 10000)/10000.0f;
+}
+
+static std::vector<float> randomFloats(int size, float range)
+{
+    std::vector<float> values(size);
+    for (int i=0; i<size; i++)
+        values[i] = randomFloat(range);
+    return values;
+}
+
+/*! @brief Returns a random job of each of the kinds that are sent to a robot */
+static Job* randomJob()
+{
+    double time = 1000*(random32() % 100000);
+    switch (random32() % 13)
+    {
+        case 0: return new WalkJob(randomFloat(10), randomFloat(5), randomFloat(1));
+        case 1: return new WalkToPointJob(time, randomFloats(3, 300));
+        case 2: return new WalkPerturbationJob(randomFloat(1), randomFloat(3.14));
+        case 3:
+        {
+            std::vector<Parameter> parameters;
+            parameters.push_back(Parameter("StepFrequency", randomFloat(2), 0.2, 4.0));
+            parameters.push_back(Parameter("StepHeight", randomFloat(5), 0, 10));
+            WalkParameters walkparameters("JWalk");
+            walkparameters.setParameters(parameters);
+            walkparameters.setMaxSpeeds(randomFloats(3, 20));
+            walkparameters.setMaxAccelerations(randomFloats(3, 50));
+            return new WalkParametersJob(walkparameters);
+        }
+        case 4: return new KickJob(time, randomFloats(3, 30), randomFloats(3, 300));
+        case 5: return new BlockJob(time, randomFloat(30), randomFloat(30));
+        case 6: return new SaveJob(time, randomFloats(3, 30));
+        case 7: return new HeadJob(time, randomFloats(2, 1.5));
+        case 8: return new HeadNodJob(HeadNodJob::BallAndLocalisation, randomFloat(1));
+        case 9: return new HeadPanJob(HeadPanJob::Ball, randomFloat(1), randomFloat(1), randomFloat(1), randomFloat(1));
+        case 10: return new HeadTrackJob(randomFloat(1), randomFloat(1), randomFloat(0.5), randomFloat(0.5));
+        case 11: return new SaveImagesJob(random32() % 2, random32() % 2);
+        default:
+        {
+            CameraSettings settings;
+            settings.brightness = random32() % 256;
+            settings.contrast = random32() % 256;
+            settings.exposure = random32() % 1000;
+            settings.gain = random32() % 256;
+            return new ChangeCameraSettingsJob(settings);
+        }
+    }
+}
+
+/*! @brief Removes every job from the list, the way the modules consume their jobs each cycle */
+static void consume(JobList& jobs)
+{
+    for (std::list<Job*>::iterator it = jobs.vision_begin(); it != jobs.vision_end();)
+        it = jobs.removeVisionJob(it);
+    for (std::list<Job*>::iterator it = jobs.motion_begin(); it != jobs.motion_end();)
+        it = jobs.removeMotionJob(it);
+    for (std::list<Job*>::iterator it = jobs.camera_begin(); it != jobs.camera_end();)
+        it = jobs.removeCameraJob(it);
+}
+
+/*! @brief Returns the jobs written in the stream format, which includes every member of every job */
+static std::string contents(JobList& jobs)
+{
+    std::stringstream stream;
+    stream << jobs;
+    return stream.str();
+}
+
+struct Capture
+{
+    std::vector<std::string> Streams;       //!< each frame in the stream format, which is also what the replays are compared with
+    std::vector<std::string> Packets;       //!< each frame in the binary format
+};
+
+static Capture capture()
+{
+    Capture captured;
+    JobList jobs;
+    char buffer[PacketSize];
+    for (int i=0; i<NumFrames; i++)
+    {
+        int numjobs = 1 + random32() % 6;
+        for (int j=0; j<numjobs; j++)
+            jobs.addJob(randomJob());
+        captured.Streams.push_back(contents(jobs));
+        captured.Packets.push_back(std::string(buffer, jobs.encode(buffer, sizeof(buffer))));
+        consume(jobs);
+    }
+    return captured;
+}
+
+static void testReplay(const Capture& captured)
+{
+    printf("Replay of %d frames:\n", NumFrames);
+    JobList streamjobs, binaryjobs;
+    int streammismatched = 0, binarymismatched = 0, rejected = 0;
+    for (int i=0; i<NumFrames; i++)
+    {
+        std::stringstream stream(captured.Streams[i]);
+        stream >> streamjobs;
+        if (contents(streamjobs) != captured.Streams[i])
+            streammismatched++;
+        consume(streamjobs);
+
+        const std::string& packet = captured.Packets[i];
+        if (not JobList::isEncoded(packet.data(), packet.size()) or not binaryjobs.decode(packet.data(), packet.size()))
+            rejected++;
+        if (contents(binaryjobs) != captured.Streams[i])
+            binarymismatched++;
+        consume(binaryjobs);
+    }
+    check(streammismatched == 0, "frames that differ after the stream format", streammismatched);
+    check(rejected == 0, "binary packets that were rejected", rejected);
+    check(binarymismatched == 0, "frames that differ after the binary format", binarymismatched);
+
+    // replace the first job's id with one the receiver does not know; the rest of the packet must still be decoded
+    std::string packet;
+    for (int i=0; i<NumFrames and packet.empty(); i++)
+        if (captured.Packets[i][10] == 2)
+            packet = captured.Packets[i];
+    int secondid = static_cast<unsigned char>(packet[12 + 2 + JobReader(packet.data() + 12, 2).getUint16() + 2]);
+    packet[14] = static_cast<char>(250);
+    JobWriter(&packet[6], 4).putUint32(JobList::checksum(packet.data() + 10, packet.size() - 10));
+    JobList decoded;
+    bool skipped = decoded.decode(packet.data(), packet.size()) and decoded.size() == 1 and (*decoded.begin())->getID() == secondid;
+    check(skipped, "a packet with an unknown job is decoded without it (jobs decoded)", decoded.size());
+    consume(decoded);
+}
+
+static void testMalformed(const Capture& captured)
+{
+    printf("Malformed packets:\n");
+    JobList jobs;
+    int truncatedaccepted = 0, corruptaccepted = 0;
+    for (int i=0; i<NumFrames; i++)
+    {
+        // every packet cut short somewhere inside its jobs
+        const std::string& packet = captured.Packets[i];
+        int size = JobList::HeaderSize + random32() % (packet.size() - JobList::HeaderSize);
+        truncatedaccepted += jobs.decode(packet.data(), size);
+        consume(jobs);
+
+        // and 100 copies with random bytes after the version overwritten
+        for (int j=0; j<100; j++)
+        {
+            std::string corrupt = packet;
+            int numbytes = 1 + random32() % 4;
+            for (int k=0; k<numbytes; k++)
+                corrupt[6 + random32() % (corrupt.size() - 6)] = random32();
+            if (corrupt == packet)
+                continue;           // every overwritten byte happened to keep its value
+            corruptaccepted += jobs.decode(corrupt.data(), corrupt.size());
+            consume(jobs);
+        }
+    }
+    check(truncatedaccepted == 0, "truncated packets accepted", truncatedaccepted);
+    check(corruptaccepted == 0, "corrupted packets accepted", corruptaccepted);
+
+    // a packet that does not fit in the buffer is not sent
+    for (int i=0; i<20; i++)
+        jobs.addJob(randomJob());
+    std::vector<char> buffer(PacketSize);
+    int size = jobs.encode(&buffer[0], buffer.size());
+    check(size > 0 and jobs.encode(&buffer[0], size - 1) == 0, "encoding into a short buffer returns 0", size);
+    consume(jobs);
+}
+
+static void benchmark(const Capture& captured)
+{
+    printf("Benchmark:\n");
+    JobList jobs;
+    const int repeats = 10;
+    unsigned long checksum = 0;
+
+    // warm up the job pools, then time the replays after the way each port receives them
+    for (int i=0; i<NumFrames; i++)
+    {
+        jobs.decode(captured.Packets[i].data(), captured.Packets[i].size());
+        consume(jobs);
+    }
+
+    unsigned long startallocations = allocations;
+    double start = now();
+    for (int r=0; r<repeats; r++)
+    {
+        for (int i=0; i<NumFrames; i++)
+        {
+            std::stringstream stream(captured.Streams[i]);
+            stream >> jobs;
+            checksum += jobs.size();
+            consume(jobs);
+        }
+    }
+    double streamtime = (now() - start)/(repeats*NumFrames);
+    double streamallocations = static_cast<double>(allocations - startallocations)/(repeats*NumFrames);
+
+    startallocations = allocations;
+    start = now();
+    for (int r=0; r<repeats; r++)
+    {
+        for (int i=0; i<NumFrames; i++)
+        {
+            jobs.decode(captured.Packets[i].data(), captured.Packets[i].size());
+            checksum += jobs.size();
+            consume(jobs);
+        }
+    }
+    double binarytime = (now() - start)/(repeats*NumFrames);
+    double binaryallocations = static_cast<double>(allocations - startallocations)/(repeats*NumFrames);
+
+    size_t streambytes = 0, binarybytes = 0;
+    for (int i=0; i<NumFrames; i++)
+    {
+        streambytes += captured.Streams[i].size();
+        binarybytes += captured.Packets[i].size();
+    }
+    printf("  stream format:  %.2fus and %.1f allocations per frame, %.0f bytes per frame\n", 1e6*streamtime, streamallocations, static_cast<double>(streambytes)/NumFrames);
+    printf("  binary format:  %.2fus and %.1f allocations per frame, %.0f bytes per frame (checksum %lu)\n", 1e6*binarytime, binaryallocations, static_cast<double>(binarybytes)/NumFrames, checksum);
+    check(binarytime < streamtime, "decoding the binary format is faster than the stream (speed up)", streamtime/binarytime);
+    check(binarybytes < streambytes, "the binary format is smaller than the stream (bytes saved per frame)", (static_cast<double>(streambytes) - binarybytes)/NumFrames);
+    check(binaryallocations == 0, "decoding the binary format does not allocate once the pool is warm (allocations per frame)", binaryallocations);
+}
+
+int main()
+{
+    Capture captured = capture();
+    testReplay(captured);
+    testMalformed(captured);
+    benchmark(captured);
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
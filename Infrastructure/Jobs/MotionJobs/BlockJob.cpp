@@ -20,6 +20,7 @@
  */
 
 #include "BlockJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -143,6 +144,24 @@ void BlockJob::toStream(std::ostream& output) const
         output.write((char*) &m_block_position[i], sizeof(m_block_position[i]));
 }
 
+/*! @brief Writes the BlockJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void BlockJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putFloats(m_block_position);
+}
+
+/*! @brief Reads the BlockJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void BlockJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    input.getFloats(m_block_position);
+}
+
 /*! @relates BlockJob
     @brief Stream insertion operator for a BlockJob
 
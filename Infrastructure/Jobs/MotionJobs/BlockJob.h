@@ -47,6 +47,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const BlockJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     std::vector<float> m_block_position;                 //!< the block position [x (cm), y (cm), theta (rad)]
 };
@@ -20,6 +20,7 @@
  */
 
 #include "HeadJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -186,6 +187,39 @@ void HeadJob::toStream(std::ostream& output) const
     }
 }
 
+/*! @brief Writes the HeadJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void HeadJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putUint16(m_times.size());
+    for (unsigned int i=0; i<m_times.size(); i++)
+    {
+        output.putDouble(m_times[i]);
+        output.putFloats(m_head_positions[i]);
+    }
+}
+
+/*! @brief Reads the HeadJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void HeadJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    // the vectors are resized rather than reconstructed, so a recycled job keeps its storage
+    unsigned int times_size = input.getUint16();
+    if (times_size > static_cast<unsigned int>(input.remaining()))
+        times_size = 0;                     // each position takes at least 9 bytes, so this can only be a corrupt size
+    m_times.resize(times_size);
+    m_head_positions.resize(times_size);
+    for (unsigned int i=0; i<times_size; i++)
+    {
+        m_times[i] = input.getDouble();
+        input.getFloats(m_head_positions[i]);
+    }
+}
+
 /*! @relates HeadJob
     @brief Stream insertion operator for a HeadJob
 
@@ -49,6 +49,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const HeadJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     std::vector<double> m_times;                                 //!< the times for each head position in the sequence
     std::vector<std::vector<float> > m_head_positions;                //!< the head position [[roll0, pitch0, yaw0], [roll1, pitch1, yaw1], ... ,[rollN, pitchN, yawN]]
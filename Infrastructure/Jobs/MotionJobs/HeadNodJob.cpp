@@ -20,6 +20,7 @@
  */
 
 #include "HeadNodJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -133,6 +134,26 @@ void HeadNodJob::toStream(std::ostream& output) const
     output.write((char*) &m_centre_angle, sizeof(m_centre_angle));
 }
 
+/*! @brief Writes the HeadNodJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void HeadNodJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putUint8(m_nod_type);
+    output.putFloat(m_centre_angle);
+}
+
+/*! @brief Reads the HeadNodJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void HeadNodJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_nod_type = static_cast<head_nod_t>(input.getUint8());
+    m_centre_angle = input.getFloat();
+}
+
 /*! @relates HeadNodJob
     @brief Stream insertion operator for a HeadNodJob
 
@@ -58,6 +58,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const HeadNodJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     head_nod_t m_nod_type;
     float m_centre_angle;
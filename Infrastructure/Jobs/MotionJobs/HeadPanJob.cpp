@@ -20,6 +20,7 @@
  */
 
 #include "HeadPanJob.h"
+#include "../JobCodec.h"
 #include "Infrastructure/NUBlackboard.h"
 #include "Infrastructure/FieldObjects/FieldObjects.h"
 #include "Infrastructure/FieldObjects/MobileObject.h"
@@ -257,6 +258,34 @@ void HeadPanJob::toStream(std::ostream& output) const
     output.write((char*) &m_yaw_max, sizeof(m_yaw_max));
 }
 
+/*! @brief Writes the HeadPanJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void HeadPanJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putUint8(m_pan_type);
+    output.putBool(m_use_default);
+    output.putFloat(m_x_min);
+    output.putFloat(m_x_max);
+    output.putFloat(m_yaw_min);
+    output.putFloat(m_yaw_max);
+}
+
+/*! @brief Reads the HeadPanJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void HeadPanJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_pan_type = static_cast<head_pan_t>(input.getUint8());
+    m_use_default = input.getBool();
+    m_x_min = input.getFloat();
+    m_x_max = input.getFloat();
+    m_yaw_min = input.getFloat();
+    m_yaw_max = input.getFloat();
+}
+
 /*! @relates HeadPanJob
     @brief Stream insertion operator for a HeadPanJob
 
@@ -69,6 +69,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const HeadPanJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     head_pan_t m_pan_type;              //!< the type of pan
     bool m_use_default;                 //!< true if the head should use the default values
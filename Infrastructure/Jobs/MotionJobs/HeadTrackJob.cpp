@@ -20,6 +20,7 @@
  */
 
 #include "HeadTrackJob.h"
+#include "../JobCodec.h"
 #include "Infrastructure/FieldObjects/Object.h"
 
 #include "debug.h"
@@ -141,6 +142,30 @@ void HeadTrackJob::toStream(std::ostream& output) const
     output.write((char*) &m_centre_bearing, sizeof(m_centre_bearing));
 }
 
+/*! @brief Writes the HeadTrackJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void HeadTrackJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putFloat(m_elevation);
+    output.putFloat(m_bearing);
+    output.putFloat(m_centre_elevation);
+    output.putFloat(m_centre_bearing);
+}
+
+/*! @brief Reads the HeadTrackJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void HeadTrackJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_elevation = input.getFloat();
+    m_bearing = input.getFloat();
+    m_centre_elevation = input.getFloat();
+    m_centre_bearing = input.getFloat();
+}
+
 /*! @relates HeadTrackJob
     @brief Stream insertion operator for a HeadTrackJob
 
@@ -49,6 +49,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const HeadTrackJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     float m_elevation;
     float m_bearing;
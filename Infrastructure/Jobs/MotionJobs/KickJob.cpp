@@ -20,6 +20,7 @@
  */
 
 #include "KickJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -192,6 +193,26 @@ void KickJob::toStream(std::ostream& output) const
         output.write((char*) &m_kick_target[i], sizeof(m_kick_target[i]));
 }
 
+/*! @brief Writes the KickJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void KickJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putFloats(m_kick_position);
+    output.putFloats(m_kick_target);
+}
+
+/*! @brief Reads the KickJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void KickJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    input.getFloats(m_kick_position);
+    input.getFloats(m_kick_target);
+}
+
 /*! @relates KickJob
     @brief Stream insertion operator for a KickJob
 
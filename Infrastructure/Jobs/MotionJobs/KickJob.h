@@ -50,6 +50,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const KickJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     std::vector<float> m_kick_position;                 //!< the kick position [x(cm), y(cm)]
     std::vector<float> m_kick_target;                   //!< the kick target relative from the *current* position [x(cm) y(cm)]
@@ -20,6 +20,7 @@
  */
 
 #include "SaveJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -131,6 +132,24 @@ void SaveJob::toStream(std::ostream& output) const
         output.write((char*) &m_save_position[i], sizeof(m_save_position[i]));
 }
 
+/*! @brief Writes the SaveJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void SaveJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putFloats(m_save_position);
+}
+
+/*! @brief Reads the SaveJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void SaveJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    input.getFloats(m_save_position);
+}
+
 /*! @relates SaveJob
     @brief Stream insertion operator for a SaveJob
  
@@ -46,6 +46,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const SaveJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     std::vector<float> m_save_position;                 //!< the save position [x (cm), y (cm), theta (rad)]
 };
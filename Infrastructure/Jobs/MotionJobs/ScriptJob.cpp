@@ -20,6 +20,7 @@
  */
 
 #include "ScriptJob.h"
+#include "../JobCodec.h"
 
 #include "debug.h"
 #include "debugverbosityjobs.h"
@@ -118,6 +119,24 @@ void ScriptJob::toStream(std::ostream& output) const
     // output << m_script;
 }
 
+/*! @brief Writes the ScriptJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void ScriptJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putString(m_name);
+}
+
+/*! @brief Reads the ScriptJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void ScriptJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    input.getString(m_name);
+}
+
 /*! @relates ScriptJob
     @brief Stream insertion operator for a ScriptJob
  
@@ -49,6 +49,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const ScriptJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     std::string m_name;
     MotionScript2013* m_script;                  // the motion script attached to the job
@@ -20,6 +20,7 @@
  */
 
 #include "WalkJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -117,6 +118,28 @@ void WalkJob::toStream(std::ostream& output) const
     output.write((char*) &m_rotation_speed, sizeof(m_rotation_speed));
 }
 
+/*! @brief Writes the WalkJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void WalkJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putFloat(m_translation_speed);
+    output.putFloat(m_direction);
+    output.putFloat(m_rotation_speed);
+}
+
+/*! @brief Reads the WalkJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void WalkJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_translation_speed = input.getFloat();
+    m_direction = input.getFloat();
+    m_rotation_speed = input.getFloat();
+}
+
 /*! @relates WalkJob
     @brief Stream insertion operator for a WalkJob
 
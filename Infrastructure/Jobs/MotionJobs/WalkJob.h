@@ -47,6 +47,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const WalkJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     float m_translation_speed;          //!< the translational speed between 0 and 1
     float m_direction;                  //!< the translational direction of the walk    
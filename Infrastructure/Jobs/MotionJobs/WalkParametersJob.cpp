@@ -20,6 +20,7 @@
  */
 
 #include "WalkParametersJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -107,6 +108,24 @@ void WalkParametersJob::toStream(std::ostream& output) const
     output << m_walk_parameters;
 }
 
+/*! @brief Writes the WalkParametersJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void WalkParametersJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    m_walk_parameters.toBuffer(output);
+}
+
+/*! @brief Reads the WalkParametersJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void WalkParametersJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_walk_parameters.fromBuffer(input);
+}
+
 /*! @relates WalkParametersJob
     @brief Stream insertion operator for a WalkParametersJob
 
@@ -48,6 +48,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const WalkParametersJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     WalkParameters m_walk_parameters;               //!< the walk parameters to give to the walk engine
 };
@@ -20,6 +20,7 @@
  */
 
 #include "WalkPerturbationJob.h"
+#include "../JobCodec.h"
 
 #include "debug.h"
 #include "debugverbosityjobs.h"
@@ -37,7 +38,7 @@ WalkPerturbationJob::WalkPerturbationJob(float magnitude, float direction) : Mot
 /*! @brief Constructs a WalkParameterJob from stream data
     @param walkparameters the walk parameters associated with the job
  */
-WalkPerturbationJob::WalkPerturbationJob(std::istream& input) : MotionJob(Job::MOTION_WALK_PARAMETERS)
+WalkPerturbationJob::WalkPerturbationJob(std::istream& input) : MotionJob(Job::MOTION_WALK_PERTURBATION)
 {
     m_job_time = 0;
     float floatBuffer;
@@ -107,6 +108,26 @@ void WalkPerturbationJob::toStream(std::ostream& output) const
     output.write((char*) &m_direction, sizeof(m_direction));
 }
 
+/*! @brief Writes the WalkPerturbationJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void WalkPerturbationJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putFloat(m_magnitude);
+    output.putFloat(m_direction);
+}
+
+/*! @brief Reads the WalkPerturbationJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void WalkPerturbationJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_magnitude = input.getFloat();
+    m_direction = input.getFloat();
+}
+
 /*! @relates WalkPerturbationJob
     @brief Stream insertion operator for a WalkPerturbationJob
 
@@ -47,6 +47,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const WalkPerturbationJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     float m_magnitude;                  //!< the magnitude of the perturbation (0 to 100)
     float m_direction;                  //!< the direction to perturbed the robot in radians
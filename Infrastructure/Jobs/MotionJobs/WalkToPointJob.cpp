@@ -20,6 +20,7 @@
  */
 
 #include "WalkToPointJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -130,6 +131,24 @@ void WalkToPointJob::toStream(std::ostream& output) const
         output.write((char*) &m_walk_position[i], sizeof(m_walk_position[i]));
 }
 
+/*! @brief Writes the WalkToPointJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void WalkToPointJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putFloats(m_walk_position);
+}
+
+/*! @brief Reads the WalkToPointJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void WalkToPointJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    input.getFloats(m_walk_position);
+}
+
 /*! @relates WalkToPointJob
     @brief Stream insertion operator for a WalkToPointJob
 
@@ -46,6 +46,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const WalkToPointJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     std::vector<float> m_walk_position;                 //!< the walk position x (cm), y (cm) and theta (rad)
 };
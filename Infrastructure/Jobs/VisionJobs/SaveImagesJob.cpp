@@ -20,6 +20,7 @@
  */
 
 #include "SaveImagesJob.h"
+#include "../JobCodec.h"
 #include "debug.h"
 #include "debugverbosityjobs.h"
 
@@ -121,6 +122,26 @@ void SaveImagesJob::toStream(std::ostream& output) const
     output.write((char*) &m_vary_settings, sizeof(m_vary_settings));
 }
 
+/*! @brief Writes the SaveImagesJob into a buffer for the binary job format
+    @param output the writer to put the job in
+ */
+void SaveImagesJob::toBuffer(JobWriter& output) const
+{
+    Job::toBuffer(output);
+    output.putBool(m_save_images);
+    output.putBool(m_vary_settings);
+}
+
+/*! @brief Reads the SaveImagesJob's members out of a buffer written by toBuffer
+    @param input the reader from which to take the job
+ */
+void SaveImagesJob::fromBuffer(JobReader& input)
+{
+    Job::fromBuffer(input);
+    m_save_images = input.getBool();
+    m_vary_settings = input.getBool();
+}
+
 /*! @relates SaveImagesJob
     @brief Stream insertion operator for a SaveImagesJob
 
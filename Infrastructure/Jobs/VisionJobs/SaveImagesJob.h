@@ -44,6 +44,8 @@ public:
     friend std::ostream& operator<<(std::ostream& output, const SaveImagesJob* job);
 protected:
     virtual void toStream(std::ostream& output) const;
+    virtual void toBuffer(JobWriter& output) const;
+    virtual void fromBuffer(JobReader& input);
 private:
     bool m_save_images;         //!< true if the job is to start saving images, false if the job is to stop saving images
     bool m_vary_settings;       //!< true if the job is to saving images with varying camera settings
@@ -21,6 +21,8 @@ ENDIF()
 
 ########## List your source files here! ############################################
 SET (YOUR_SRCS  JobList.cpp JobList.h
+		JobPool.cpp JobPool.h
+		JobCodec.h
 		Job.cpp Job.h
 		VisionJob.h
 		VisionJobs/SaveImagesJob.h VisionJobs/SaveImagesJob.cpp
@@ -190,14 +190,25 @@ void NUActionatorsData::postProcess()
  	@param gains will be updated with the gains for the next cycle
  */
 void NUActionatorsData::getNextServos(std::vector<float>& positions, std::vector<float>& gains)
+{
+    getNextServos(Blackboard->Sensors, positions, gains);
+}
+
+/*! @brief Gets the next servo targets, interpolating from the targets and stiffnesses in the given sensor data.
+           This is used where there is no Blackboard, or there are several robots in the one process.
+    @param sensors the sensor data containing the current servo targets and stiffnesses
+    @param positions will be updated with the next servo positions
+    @param gains will be updated with the next servo gains
+ */
+void NUActionatorsData::getNextServos(const NUSensorsData* sensors, std::vector<float>& positions, std::vector<float>& gains)
 {
     #if DEBUG_NUACTIONATORS_VERBOSITY > 0
         debug << "NUActionatorsData::getNextServos" << std::endl;
     #endif
     // get the sensor positions and gains
     std::vector<float> positions_current, gains_current;
-    Blackboard->Sensors->getTarget(All, positions_current);
-    Blackboard->Sensors->getStiffness(All, gains_current);
+    sensors->getTarget(All, positions_current);
+    sensors->getStiffness(All, gains_current);
     
     // check that positions and gains are of the correct size; if they are not then 'resize' them
     if (positions.size() != positions_current.size())
@@ -431,6 +442,23 @@ void NUActionatorsData::add(const id_t& actionatorid, double time, float data, f
     add(actionatorid, time, d);
 }
 
+/*! @brief Adds a [time, [data,gain]] tuple to a single member of a group
+    @param groupid the id of the group
+    @param member the index of the actionator within the group
+    @param time the time in ms associated with the data,gain point
+    @param data the data
+    @param gain the gain
+ */
+void NUActionatorsData::add(const id_t& groupid, size_t member, double time, float data, float gain)
+{
+    const std::vector<int>& ids = mapIdToIndices(groupid);
+    if (member >= ids.size())
+        return;
+    std::vector<float> d(2,data);
+    d[1] = gain;
+    m_actionators[ids[member]].add(time, d);
+}
+
 /*! @brief Adds the data to the actionatorid with a single time. 
  
            If the size of the data matches the number of actionators in actionatorid
@@ -26,6 +26,7 @@
 #ifndef NUACTIONATORSDATA_H
 #define NUACTIONATORSDATA_H
 class Actionator;
+class NUSensorsData;
 #include "Infrastructure/NUData.h"
 
 #include <vector>
@@ -58,6 +59,7 @@ public:
     
     void preProcess(double currenttime);
     void getNextServos(std::vector<float>& positions, std::vector<float>& gains);
+    void getNextServos(const NUSensorsData* sensors, std::vector<float>& positions, std::vector<float>& gains);
     void getNextLeds(std::vector<std::vector<std::vector<float> > >& leds);
     void getNextSounds(std::vector<std::string>& sounds);
     void postProcess();
@@ -67,6 +69,7 @@ public:
     
     void add(const id_t& actionatorid, double time, float data);
     void add(const id_t& actionatorid, double time, float data, float gain);
+    void add(const id_t& groupid, size_t member, double time, float data, float gain);
     void add(const id_t& actionatorid, double time, const std::vector<float>& data);
     void add(const id_t& actionatorid, double time, const std::vector<float>& data, float gain);
     void add(const id_t& actionatorid, double time, const std::vector<float>& data, const std::vector<float>& gain);
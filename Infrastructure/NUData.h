@@ -98,7 +98,9 @@ public:
         friend std::ostream& operator <<(std::ostream& output, const id_t* id);
         friend std::istream& operator >>(std::istream& input, id_t* id);
     };
-        
+
+    virtual ~NUData() {}
+
     // Common aliases
     const static id_t All;							//!< alias for 'all', can be used in a number of ways for getting all sensors or actionators in a group
     const static id_t Head;							//!< alias for 'head', can be used to get sensors or actionators in the head
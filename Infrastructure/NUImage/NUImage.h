@@ -142,6 +142,8 @@ public:
     */
     friend std::istream& operator>> (std::istream& input, NUImage& p_nuimage);
 
+    friend class NUImageCodec;
+
     /*!
     @brief Get the width of the current image.
     @return The image width.
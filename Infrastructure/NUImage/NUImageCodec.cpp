@@ -0,0 +1,428 @@
+/*! @file NUImageCodec.cpp
+    @brief Implementation of the NUImageCodec class.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NUImageCodec.h"
+#include "NUImage.h"
+#include "ColorModelConversions.h"
+#include "lib/jpge.h"
+#include "debug.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+const char NUImageCodec::Magic[4] = {'N', 'U', 'i', 'c'};
+
+static const unsigned int MaxDimension = 4096;      //!< records claiming a larger image are treated as corrupt
+static const unsigned int EscapeLength = 16;        //!< residuals with a longer unary part are written as 8 raw bits instead
+static const unsigned int MaxBytesPerPixel = 4*(EscapeLength + 8)/8;
+
+static void putUint32(unsigned char* buffer, uint32_t value)
+{
+    for (int i=0; i<4; i++)
+        buffer[i] = static_cast<unsigned char>(value >> (8*i));
+}
+
+static uint32_t getUint32(const unsigned char* buffer)
+{
+    return buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | (static_cast<uint32_t>(buffer[3]) << 24);
+}
+
+/*! @brief The adaptive Golomb-Rice parameter for one of the four bytes of a Pixel.
+           It tracks the mean residual, and uses the k that would code that mean in about k+1 bits.
+ */
+class RiceContext
+{
+public:
+    RiceContext() : m_sum(16), m_count(1) {}
+    unsigned int k() const
+    {
+        unsigned int k = 0;
+        while ((m_count << k) < m_sum and k < 7)
+            k++;
+        return k;
+    }
+    void update(unsigned int value)
+    {
+        m_sum += value;
+        if (++m_count == 64)
+        {
+            m_sum >>= 1;
+            m_count >>= 1;
+        }
+    }
+private:
+    unsigned int m_sum;
+    unsigned int m_count;
+};
+
+/*! @brief Writes Golomb-Rice coded residuals into a buffer that must be large enough for the worst case */
+class ResidualWriter
+{
+public:
+    ResidualWriter(unsigned char* buffer) : m_start(buffer), m_next(buffer), m_bits(0), m_count(0) {}
+
+    /*! @brief Codes value, predicted to be prediction, with the context's parameter */
+    inline void code(RiceContext& context, int prediction, unsigned char& value)
+    {
+        // the residual wraps around 256, so that it fits in a byte, and is zigzagged so small residuals of either sign are small
+        int residual = static_cast<signed char>(value - prediction);
+        unsigned int mapped = residual >= 0 ? 2*residual : -2*residual - 1;
+        unsigned int k = context.k();
+        unsigned int quotient = mapped >> k;
+        if (quotient < EscapeLength)
+        {
+            put(1, quotient + 1);
+            put(mapped & ((1 << k) - 1), k);
+        }
+        else
+        {
+            put(0, EscapeLength);
+            put(mapped, 8);
+        }
+        context.update(mapped);
+    }
+
+    /*! @brief Writes the last partial byte, and returns the number of bytes written */
+    size_t finish()
+    {
+        if (m_count > 0)
+            put(0, 8 - m_count);
+        return m_next - m_start;
+    }
+private:
+    inline void put(uint32_t value, unsigned int length)
+    {
+        m_bits = (m_bits << length) | value;
+        m_count += length;
+        while (m_count >= 8)
+        {
+            m_count -= 8;
+            *m_next++ = static_cast<unsigned char>(m_bits >> m_count);
+        }
+    }
+
+    unsigned char* m_start;
+    unsigned char* m_next;
+    uint64_t m_bits;
+    unsigned int m_count;
+};
+
+/*! @brief Reads the residuals written by a ResidualWriter back into the values */
+class ResidualReader
+{
+public:
+    ResidualReader(const unsigned char* buffer, size_t size) : m_next(buffer), m_end(buffer + size), m_bits(0), m_count(0), m_overrun(false) {}
+
+    /*! @brief Sets value to the one that was coded with this prediction and context */
+    inline void code(RiceContext& context, int prediction, unsigned char& value)
+    {
+        unsigned int k = context.k();
+        unsigned int quotient = 0;
+        while (quotient < EscapeLength and get(1) == 0)
+            quotient++;
+        unsigned int mapped;
+        if (quotient < EscapeLength)
+            mapped = (quotient << k) | get(k);
+        else
+            mapped = get(8);
+        context.update(mapped);
+        int residual = (mapped & 1) ? -static_cast<int>((mapped + 1) >> 1) : static_cast<int>(mapped >> 1);
+        value = static_cast<unsigned char>(prediction + residual);
+    }
+
+    bool overrun() const {return m_overrun;}
+private:
+    inline uint32_t get(unsigned int length)
+    {
+        while (m_count < length)
+        {
+            unsigned char byte = 0;
+            if (m_next < m_end)
+                byte = *m_next++;
+            else
+                m_overrun = true;
+            m_bits = (m_bits << 8) | byte;
+            m_count += 8;
+        }
+        m_count -= length;
+        return static_cast<uint32_t>(m_bits >> m_count) & ((1u << length) - 1);
+    }
+
+    const unsigned char* m_next;
+    const unsigned char* m_end;
+    uint64_t m_bits;
+    unsigned int m_count;
+    bool m_overrun;
+};
+
+/*! @brief The LOCO-I median edge detector; a is to the left, b above and c above-left */
+static inline int predict(int a, int b, int c)
+{
+    if (c >= std::max(a, b))
+        return std::min(a, b);
+    else if (c <= std::min(a, b))
+        return std::max(a, b);
+    else
+        return a + b - c;
+}
+
+/*! @brief Codes every byte of the image in raw order with the coder, which is either a ResidualWriter or a ResidualReader.
+           Sharing this loop guarantees the decoder makes exactly the predictions the encoder made.
+
+    The chroma bytes are predicted from the same byte of the neighbouring pixels. The two luma bytes of a pixel are
+    horizontally adjacent samples in the camera image, so the luma is treated as a single plane twice as wide:
+    the padding byte (the first luma) is predicted from the second luma of the pixel to its left, and the second
+    from the first.
+ */
+template <typename Coder> static void codeImage(Pixel** rows, int width, int height, Coder& coder)
+{
+    RiceContext contexts[4];
+    for (int y = 0; y < height; y++)
+    {
+        Pixel* row = rows[y];
+        const Pixel* up = y > 0 ? rows[y-1] : NULL;
+        for (int x = 0; x < width; x++)
+        {
+            Pixel& p = row[x];
+            if (up != NULL and x > 0)
+            {
+                const Pixel& left = row[x-1];
+                const Pixel& above = up[x];
+                const Pixel& aboveleft = up[x-1];
+                coder.code(contexts[0], predict(left.y, above.yCbCrPadding, aboveleft.y), p.yCbCrPadding);
+                coder.code(contexts[2], predict(p.yCbCrPadding, above.y, above.yCbCrPadding), p.y);
+                coder.code(contexts[1], predict(left.cb, above.cb, aboveleft.cb), p.cb);
+                coder.code(contexts[3], predict(left.cr, above.cr, aboveleft.cr), p.cr);
+            }
+            else if (up != NULL)
+            {
+                const Pixel& above = up[x];
+                coder.code(contexts[0], above.yCbCrPadding, p.yCbCrPadding);
+                coder.code(contexts[2], predict(p.yCbCrPadding, above.y, above.yCbCrPadding), p.y);
+                coder.code(contexts[1], above.cb, p.cb);
+                coder.code(contexts[3], above.cr, p.cr);
+            }
+            else if (x > 0)
+            {
+                const Pixel& left = row[x-1];
+                coder.code(contexts[0], left.y, p.yCbCrPadding);
+                coder.code(contexts[2], p.yCbCrPadding, p.y);
+                coder.code(contexts[1], left.cb, p.cb);
+                coder.code(contexts[3], left.cr, p.cr);
+            }
+            else
+            {
+                coder.code(contexts[0], 128, p.yCbCrPadding);
+                coder.code(contexts[2], p.yCbCrPadding, p.y);
+                coder.code(contexts[1], 128, p.cb);
+                coder.code(contexts[3], 128, p.cr);
+            }
+        }
+    }
+}
+
+NUImageCodec::NUImageCodec()
+{
+    m_jpeg_quality = 90;
+}
+
+/*! @brief Sets the quality of the jpegs
+    @param quality the quality from 1 to 100
+ */
+void NUImageCodec::setJpegQuality(int quality)
+{
+    m_jpeg_quality = std::max(1, std::min(quality, 100));
+}
+
+/*! @brief Compresses an image into a record
+    @param image the image to compress
+    @param format the format to compress it in; either LosslessFormat or JpegFormat
+    @param record will be replaced with the record. Its memory is reused, so pass the same vector each time.
+    @return true if the image was compressed
+ */
+bool NUImageCodec::encode(const NUImage& image, Format format, std::vector<unsigned char>& record)
+{
+    if (image.getWidth() <= 0 or image.getHeight() <= 0)
+        return false;
+    if (format == LosslessFormat)
+    {
+        encodeLossless(image, record);
+        return true;
+    }
+    else if (format == JpegFormat)
+        return encodeJpeg(image, record);
+
+    errorlog << "NUImageCodec::encode(). " << getFormatName(format) << " images are not written by the codec." << std::endl;
+    return false;
+}
+
+void NUImageCodec::encodeLossless(const NUImage& image, std::vector<unsigned char>& record)
+{
+    const int width = image.getWidth();
+    const int height = image.getHeight();
+    record.resize(HeaderSize + MaxBytesPerPixel*width*height + 8);
+
+    ResidualWriter writer(&record[HeaderSize]);
+    codeImage(image.m_image, width, height, writer);       // the writer only reads the pixels
+    size_t size = writer.finish();
+
+    record.resize(HeaderSize + size);
+    encodeHeader(&record[0], LosslessFormat, image, size);
+}
+
+bool NUImageCodec::encodeJpeg(const NUImage& image, std::vector<unsigned char>& record)
+{
+    const int width = image.getWidth();
+    const int height = image.getHeight();
+    m_rgb.resize(3*width*height);
+    unsigned char* rgb = &m_rgb[0];
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            const Pixel& pixel = image(x, y);
+            ColorModelConversions::fromYCbCrToRGB(pixel.y, pixel.cb, pixel.cr, rgb[0], rgb[1], rgb[2]);
+            rgb += 3;
+        }
+    }
+
+    int size = std::max(1024, 3*width*height);
+    record.resize(HeaderSize + size);
+    jpge::params params;
+    params.m_quality = m_jpeg_quality;
+    if (not jpge::compress_image_to_jpeg_file_in_memory(&record[HeaderSize], size, width, height, 3, &m_rgb[0], params))
+    {
+        errorlog << "NUImageCodec::encodeJpeg(). Failed to compress the image." << std::endl;
+        return false;
+    }
+    record.resize(HeaderSize + size);
+    encodeHeader(&record[0], JpegFormat, image, size);
+    return true;
+}
+
+void NUImageCodec::encodeHeader(unsigned char* buffer, Format format, const NUImage& image, unsigned int size)
+{
+    memcpy(buffer, Magic, 4);
+    buffer[4] = static_cast<unsigned char>(format);
+    buffer[5] = image.flipped ? 1 : 0;
+    buffer[6] = 0;
+    buffer[7] = 0;
+    putUint32(buffer + 8, image.getWidth());
+    putUint32(buffer + 12, image.getHeight());
+    double timestamp = image.GetTimestamp();
+    uint64_t bits;
+    memcpy(&bits, &timestamp, sizeof(bits));
+    putUint32(buffer + 16, static_cast<uint32_t>(bits));
+    putUint32(buffer + 20, static_cast<uint32_t>(bits >> 32));
+    putUint32(buffer + 24, size);
+}
+
+/*! @brief Decompresses a lossless record back into exactly the image that was encoded
+    @param record the record
+    @param size the size of the record in bytes
+    @param image will be updated with the image
+    @return true if the record was a valid lossless record
+ */
+bool NUImageCodec::decode(const unsigned char* record, size_t size, NUImage& image)
+{
+    if (size < HeaderSize or memcmp(record, Magic, 4) != 0)
+    {
+        errorlog << "NUImageCodec::decode(). Not an image record." << std::endl;
+        return false;
+    }
+    if (record[4] != LosslessFormat)
+    {
+        errorlog << "NUImageCodec::decode(). Can not decode " << getFormatName(static_cast<Format>(record[4])) << " records." << std::endl;
+        return false;
+    }
+    uint32_t width = getUint32(record + 8);
+    uint32_t height = getUint32(record + 12);
+    uint32_t datasize = getUint32(record + 24);
+    if (width == 0 or height == 0 or width > MaxDimension or height > MaxDimension or datasize > size - HeaderSize)
+    {
+        errorlog << "NUImageCodec::decode(). The record is corrupt." << std::endl;
+        return false;
+    }
+    uint64_t bits = getUint32(record + 16) | (static_cast<uint64_t>(getUint32(record + 20)) << 32);
+    double timestamp;
+    memcpy(&timestamp, &bits, sizeof(timestamp));
+
+    image.setImageDimensions(width, height);
+    image.useInternalBuffer(true);
+    image.setTimestamp(timestamp);
+    image.flipped = record[5] != 0;
+
+    ResidualReader reader(record + HeaderSize, datasize);
+    codeImage(image.m_image, width, height, reader);
+    if (reader.overrun())
+    {
+        errorlog << "NUImageCodec::decode(). The record is truncated." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/*! @brief Reads the next record from a file of records
+    @param input the file
+    @param record will be replaced with the record, including its header
+    @return true if a whole record was read
+ */
+bool NUImageCodec::readRecord(std::istream& input, std::vector<unsigned char>& record)
+{
+    record.resize(HeaderSize);
+    input.read(reinterpret_cast<char*>(&record[0]), HeaderSize);
+    if (static_cast<unsigned int>(input.gcount()) != HeaderSize or memcmp(&record[0], Magic, 4) != 0)
+        return false;
+    uint32_t size = getUint32(&record[24]);
+    record.resize(HeaderSize + size);
+    if (size == 0)
+        return true;
+    input.read(reinterpret_cast<char*>(&record[HeaderSize]), size);
+    return static_cast<uint32_t>(input.gcount()) == size;
+}
+
+/*! @brief Returns the format with the given name (RAW, LOSSLESS or JPEG), or RawFormat if there isn't one */
+NUImageCodec::Format NUImageCodec::getFormatFromName(const std::string& name)
+{
+    if (name.compare("LOSSLESS") == 0)
+        return LosslessFormat;
+    else if (name.compare("JPEG") == 0)
+        return JpegFormat;
+    else
+        return RawFormat;
+}
+
+std::string NUImageCodec::getFormatName(Format format)
+{
+    switch (format)
+    {
+        case RawFormat:         return "RAW";
+        case LosslessFormat:    return "LOSSLESS";
+        case JpegFormat:        return "JPEG";
+        default:                return "INVALID";
+    }
+}
+
+/*! @brief Returns the extension of the file images in the format are saved to. Raw images go in the usual stream file */
+std::string NUImageCodec::getFileExtension(Format format)
+{
+    if (format == RawFormat)
+        return "strm";
+    else
+        return "nuic";
+}
@@ -0,0 +1,82 @@
+/*! @file NUImageCodec.h
+    @brief Declaration of the NUImageCodec class.
+
+    @class NUImageCodec
+    @brief Compresses NUImages into self-describing records, either losslessly or as a jpeg.
+
+    Each record is a fixed size header followed by the compressed image:
+        - magic "NUic" (4 bytes)
+        - format (1 byte), flipped (1 byte), 2 reserved bytes
+        - width, height (4 bytes each)
+        - timestamp (8 byte double)
+        - size of the compressed image in bytes (4 bytes)
+    All numbers are little-endian. Records can be written back to back into a file and read with readRecord().
+
+    The lossless format keeps all four bytes of every Pixel, so decode() gives back exactly the buffer that was
+    encoded (the padding byte holds the luma of the other half of each YUYV pair). Each byte is predicted from its
+    neighbours with the LOCO-I median edge detector, and the residuals are Golomb-Rice coded with a parameter that
+    adapts separately for each of the four bytes. There is no zlib on the robot, and this is fast enough to keep up
+    with the camera on a single encoder thread.
+
+    The jpeg format uses jpge, and converts the image to rgb in display order first, so it is lossy and can't be
+    decoded back into a NUImage here.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NUIMAGECODEC_H
+#define NUIMAGECODEC_H
+
+#include <istream>
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+class NUImage;
+
+class NUImageCodec
+{
+public:
+    enum Format
+    {
+        RawFormat = 0,          //!< uncompressed; written with NUImage's operator<< rather than by the codec
+        LosslessFormat = 1,
+        JpegFormat = 2
+    };
+
+    static const char Magic[4];
+    static const unsigned int HeaderSize = 28;
+
+    NUImageCodec();
+
+    void setJpegQuality(int quality);
+    bool encode(const NUImage& image, Format format, std::vector<unsigned char>& record);
+    static bool decode(const unsigned char* record, size_t size, NUImage& image);
+    static bool readRecord(std::istream& input, std::vector<unsigned char>& record);
+
+    static Format getFormatFromName(const std::string& name);
+    static std::string getFormatName(Format format);
+    static std::string getFileExtension(Format format);
+
+private:
+    void encodeLossless(const NUImage& image, std::vector<unsigned char>& record);
+    bool encodeJpeg(const NUImage& image, std::vector<unsigned char>& record);
+    static void encodeHeader(unsigned char* buffer, Format format, const NUImage& image, unsigned int size);
+
+private:
+    int m_jpeg_quality;                     //!< the jpeg quality from 1 to 100
+    std::vector<unsigned char> m_rgb;       //!< the image converted to rgb for the jpeg encoder
+};
+
+#endif // NUIMAGECODEC_H
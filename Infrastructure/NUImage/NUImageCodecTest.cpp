@@ -0,0 +1,259 @@
+/*! @file NUImageCodecTest.cpp
+    @brief A bit-exact round trip test of NUImageCodec's lossless format
+
+    Images are encoded losslessly and decoded again, and every byte of every Pixel (the padding byte included),
+    the size, the timestamp and the flipped flag must come back unchanged. The images are
+        - flat, smooth and noisy camera-like frames at 320x240 and 640x480
+        - every byte random, which the predictor can't help with
+        - alternating 0 and 255, the largest residuals there are
+        - odd sizes down to a single pixel, so that the predictor's edges are covered
+    It also checks that records written back to back are read back by readRecord, that truncated or corrupt
+    records are rejected rather than decoded, and that a jpeg record is refused by decode. It prints the
+    compressed size and the time to encode and decode a 320x240 frame.
+
+    Build and run from this directory with
+    @code
+        make NUImageCodecTest && ./NUImageCodecTest
+    @endcode
+    It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NUImageCodec.h"
+#include "NUImage.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+/*! @brief Returns the time in ms */
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return 1e3*time.tv_sec + 1e-6*time.tv_nsec;
+}
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t random32()
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+enum Pattern {Flat, Smooth, Noisy, Random, Extremes};
+static const char* PatternNames[] = {"flat", "smooth", "noisy", "random", "extremes"};
+
+static unsigned char clamp(int value)
+{
+    return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+/*! @brief Returns an image filled with the pattern. The padding byte is filled too, because the codec keeps it. */
+static NUImage makeImage(Pattern pattern, int width, int height, bool flipped)
+{
+    NUImage image(width, height, true);
+    image.flipped = false;
+    for (int y=0; y<height; y++)
+    {
+        for (int x=0; x<width; x++)
+        {
+            Pixel pixel;
+            switch (pattern)
+            {
+                case Flat:
+                    pixel.y = 90; pixel.cb = 110; pixel.cr = 120; pixel.yCbCrPadding = 91;
+                    break;
+                case Smooth:
+                    pixel.y = clamp(40 + x/3 + y/2); pixel.cb = clamp(128 + (x - y)/8); pixel.cr = clamp(100 + y/4);
+                    pixel.yCbCrPadding = clamp(41 + x/3 + y/2);
+                    break;
+                case Noisy:
+                    pixel.y = clamp(80 + 60*sin(0.05*x)*cos(0.07*y) + static_cast<int>(random32() % 17) - 8);
+                    pixel.cb = clamp(120 + (x > width/2 ? 20 : -10) + static_cast<int>(random32() % 9) - 4);
+                    pixel.cr = clamp(130 + (y > height/3 ? -30 : 5) + static_cast<int>(random32() % 9) - 4);
+                    pixel.yCbCrPadding = clamp(pixel.y + static_cast<int>(random32() % 11) - 5);
+                    break;
+                case Random:
+                    for (int i=0; i<4; i++)
+                        pixel.channel[i] = random32();
+                    break;
+                case Extremes:
+                    for (int i=0; i<4; i++)
+                        pixel.channel[i] = ((x + y + i) & 1) ? 255 : 0;
+                    break;
+            }
+            image.setPixel(x, y, pixel);
+        }
+    }
+    image.flipped = flipped;
+    image.setTimestamp(1e6*random32() + 0.123456789);
+    return image;
+}
+
+/*! @brief Returns true if the two images are bit for bit the same, including their size, timestamp and flipped flag */
+static bool sameImage(const NUImage& a, const NUImage& b)
+{
+    if (a.getWidth() != b.getWidth() or a.getHeight() != b.getHeight() or a.flipped != b.flipped)
+        return false;
+    double ta = a.GetTimestamp(), tb = b.GetTimestamp();
+    if (memcmp(&ta, &tb, sizeof(double)) != 0)
+        return false;
+    for (int y=0; y<a.getHeight(); y++)
+    {
+        if (memcmp(&a.at(0, y), &b.at(0, y), a.getWidth()*sizeof(Pixel)) != 0)
+            return false;
+    }
+    return true;
+}
+
+static void testRoundTrip()
+{
+    printf("Round trip:\n");
+    NUImageCodec codec;
+    std::vector<unsigned char> record;
+    const int sizes[][2] = {{320, 240}, {640, 480}, {1, 1}, {1, 17}, {17, 1}, {2, 2}, {7, 5}, {33, 3}};
+    const int numsizes = sizeof(sizes)/sizeof(*sizes);
+    int images = 0, mismatched = 0;
+    for (int pattern=Flat; pattern<=Extremes; pattern++)
+    {
+        for (int s=0; s<numsizes; s++)
+        {
+            NUImage image = makeImage(static_cast<Pattern>(pattern), sizes[s][0], sizes[s][1], (s + pattern) % 2 == 1);
+            NUImage decoded;
+            if (not codec.encode(image, NUImageCodec::LosslessFormat, record) or not NUImageCodec::decode(&record[0], record.size(), decoded) or not sameImage(image, decoded))
+            {
+                printf("  %s %dx%d did not survive the round trip\n", PatternNames[pattern], sizes[s][0], sizes[s][1]);
+                mismatched++;
+            }
+            images++;
+        }
+    }
+    check(mismatched == 0, "images that did not decode bit for bit", mismatched);
+
+    // a decoded image must not depend on what the image it is decoded into held before
+    NUImage small = makeImage(Random, 5, 3, false);
+    NUImage large = makeImage(Noisy, 320, 240, true);
+    NUImage decoded;
+    codec.encode(large, NUImageCodec::LosslessFormat, record);
+    NUImageCodec::decode(&record[0], record.size(), decoded);
+    codec.encode(small, NUImageCodec::LosslessFormat, record);
+    bool reused = NUImageCodec::decode(&record[0], record.size(), decoded) and sameImage(small, decoded);
+    check(reused, "decoding into an image that held a larger frame", reused);
+}
+
+static void testRecords()
+{
+    printf("Records:\n");
+    NUImageCodec codec;
+    std::vector<unsigned char> record;
+    std::vector<NUImage> images;
+    std::ostringstream file;
+    for (int i=0; i<10; i++)
+    {
+        images.push_back(makeImage(i % 3 == 0 ? Random : Noisy, 160 + i, 120 - i, i % 2 == 0));
+        codec.encode(images.back(), NUImageCodec::LosslessFormat, record);
+        file.write(reinterpret_cast<const char*>(&record[0]), record.size());
+    }
+
+    std::istringstream input(file.str());
+    int read = 0, mismatched = 0;
+    NUImage decoded;
+    while (NUImageCodec::readRecord(input, record))
+    {
+        if (read >= static_cast<int>(images.size()) or not NUImageCodec::decode(&record[0], record.size(), decoded) or not sameImage(images[read], decoded))
+            mismatched++;
+        read++;
+    }
+    check(read == static_cast<int>(images.size()) and mismatched == 0, "records written back to back read and decoded", read - mismatched);
+
+    // the end of the file cut off part way through the last record
+    std::string contents = file.str();
+    std::istringstream cut(contents.substr(0, contents.size() - 10));
+    read = 0;
+    while (NUImageCodec::readRecord(cut, record))
+        read++;
+    check(read == static_cast<int>(images.size()) - 1, "records read from a file missing the end of the last one", read);
+
+    codec.encode(images[1], NUImageCodec::LosslessFormat, record);
+    int accepted = NUImageCodec::decode(&record[0], record.size() - 1, decoded);
+    accepted += NUImageCodec::decode(&record[0], NUImageCodec::HeaderSize - 1, decoded);
+    std::vector<unsigned char> shortened(record.begin(), record.begin() + NUImageCodec::HeaderSize + (record.size() - NUImageCodec::HeaderSize)/2);
+    uint32_t datasize = shortened.size() - NUImageCodec::HeaderSize;
+    for (int i=0; i<4; i++)
+        shortened[24 + i] = datasize >> (8*i);
+    accepted += NUImageCodec::decode(&shortened[0], shortened.size(), decoded);
+    std::vector<unsigned char> corrupt(record);
+    corrupt[0] = 'X';
+    accepted += NUImageCodec::decode(&corrupt[0], corrupt.size(), decoded);
+    corrupt = record;
+    corrupt[8] = corrupt[9] = corrupt[10] = corrupt[11] = 0xff;
+    accepted += NUImageCodec::decode(&corrupt[0], corrupt.size(), decoded);
+    check(accepted == 0, "truncated, shortened, wrong magic or impossible size records decoded", accepted);
+
+    bool jpeg = codec.encode(images[1], NUImageCodec::JpegFormat, record) and record.size() > NUImageCodec::HeaderSize;
+    check(jpeg and not NUImageCodec::decode(&record[0], record.size(), decoded), "a jpeg record is encoded, and refused by decode", record.size());
+
+}
+
+static void benchmark()
+{
+    printf("Benchmark, 320x240:\n");
+    NUImageCodec codec;
+    std::vector<unsigned char> record;
+    NUImage decoded;
+    for (int pattern=Smooth; pattern<=Random; pattern++)
+    {
+        NUImage image = makeImage(static_cast<Pattern>(pattern), 320, 240, false);
+        const int count = 20;
+        double start = now();
+        for (int i=0; i<count; i++)
+            codec.encode(image, NUImageCodec::LosslessFormat, record);
+        double encodetime = (now() - start)/count;
+        start = now();
+        for (int i=0; i<count; i++)
+            NUImageCodec::decode(&record[0], record.size(), decoded);
+        double decodetime = (now() - start)/count;
+        printf("  %-8s %6.1f KB (%3.0f%% of raw), encode %5.2f ms, decode %5.2f ms\n", PatternNames[pattern], record.size()/1024.0,
+               100.0*record.size()/(sizeof(Pixel)*image.getTotalPixels()), encodetime, decodetime);
+    }
+}
+
+int main()
+{
+    testRoundTrip();
+    testRecords();
+    benchmark();
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
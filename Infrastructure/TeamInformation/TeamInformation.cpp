@@ -30,6 +30,7 @@
 #include "Tools/FileFormats/FileFormatException.h"
 
 #include <memory.h>
+#include <stdint.h>
 
 #include "debug.h"
 #include "debugverbositynetwork.h"
@@ -232,6 +233,132 @@ std::istream& TeamPacket::fromFile(std::istream& input)
     return input;
 }
 
+// Little-endian packing of the team packet fields, independent of the host's byte order and struct padding
+static inline void putUint32(char* buffer, uint32_t value)
+{
+    buffer[0] = static_cast<char>(value);
+    buffer[1] = static_cast<char>(value >> 8);
+    buffer[2] = static_cast<char>(value >> 16);
+    buffer[3] = static_cast<char>(value >> 24);
+}
+
+static inline uint32_t getUint32(const char* buffer)
+{
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(buffer);
+    return b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+}
+
+static inline void putFloat(char* buffer, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    putUint32(buffer, bits);
+}
+
+static inline float getFloat(const char* buffer)
+{
+    uint32_t bits = getUint32(buffer);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline void putDouble(char* buffer, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    putUint32(buffer, static_cast<uint32_t>(bits));
+    putUint32(buffer + 4, static_cast<uint32_t>(bits >> 32));
+}
+
+static inline double getDouble(const char* buffer)
+{
+    uint64_t bits = getUint32(buffer) | (static_cast<uint64_t>(getUint32(buffer + 4)) << 32);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*! @brief Encodes the packet for sending to team mates. The ReceivedTime is not sent.
+
+    The layout is, with every field little-endian:
+        0   char[4]     header "NUtm"
+        4   uint8       version
+        5   int8        player number
+        6   int8        team number
+        7   uint8       reserved (0)
+        8   uint32      ID
+        12  double      sent time
+        20  float       time to ball
+        24  float[6]    ball: time since last seen, x, y, srxx, srxy, sryy
+        48  float[6]    self: x, y, heading, sdx, sdy, sdheading
+
+    @param buffer the buffer to encode the packet into
+    @param size the size of the buffer in bytes
+    @return the number of bytes used, or 0 if the buffer is too small
+ */
+int TeamPacket::encode(char* buffer, int size) const
+{
+    if (size < EncodedSize)
+        return 0;
+    memcpy(buffer, Header, 4);
+    buffer[4] = TEAM_PACKET_STRUCT_VERSION;
+    buffer[5] = PlayerNumber;
+    buffer[6] = TeamNumber;
+    buffer[7] = 0;
+    putUint32(buffer + 8, static_cast<uint32_t>(ID));
+    putDouble(buffer + 12, SentTime);
+    putFloat(buffer + 20, TimeToBall);
+
+    putFloat(buffer + 24, Ball.TimeSinceLastSeen);
+    putFloat(buffer + 28, Ball.X);
+    putFloat(buffer + 32, Ball.Y);
+    putFloat(buffer + 36, Ball.SRXX);
+    putFloat(buffer + 40, Ball.SRXY);
+    putFloat(buffer + 44, Ball.SRYY);
+
+    putFloat(buffer + 48, Self.X);
+    putFloat(buffer + 52, Self.Y);
+    putFloat(buffer + 56, Self.Heading);
+    putFloat(buffer + 60, Self.SDX);
+    putFloat(buffer + 64, Self.SDY);
+    putFloat(buffer + 68, Self.SDHeading);
+    return EncodedSize;
+}
+
+/*! @brief Decodes a packet received from a team mate. The packet is only updated if the buffer holds a valid packet.
+    @param buffer the received data
+    @param size the number of bytes received
+    @return false if the data is the wrong length, or does not have the team packet header and version
+ */
+bool TeamPacket::decode(const char* buffer, int size)
+{
+    if (size != EncodedSize or memcmp(buffer, TEAM_PACKET_STRUCT_HEADER, 4) != 0 or buffer[4] != TEAM_PACKET_STRUCT_VERSION)
+        return false;
+    memcpy(Header, buffer, 4);
+    PlayerNumber = buffer[5];
+    TeamNumber = buffer[6];
+    ID = getUint32(buffer + 8);
+    SentTime = getDouble(buffer + 12);
+    ReceivedTime = 0;
+    TimeToBall = getFloat(buffer + 20);
+
+    Ball.TimeSinceLastSeen = getFloat(buffer + 24);
+    Ball.X = getFloat(buffer + 28);
+    Ball.Y = getFloat(buffer + 32);
+    Ball.SRXX = getFloat(buffer + 36);
+    Ball.SRXY = getFloat(buffer + 40);
+    Ball.SRYY = getFloat(buffer + 44);
+
+    Self.X = getFloat(buffer + 48);
+    Self.Y = getFloat(buffer + 52);
+    Self.Heading = getFloat(buffer + 56);
+    Self.SDX = getFloat(buffer + 60);
+    Self.SDY = getFloat(buffer + 64);
+    Self.SDHeading = getFloat(buffer + 68);
+    return true;
+}
+
 std::string TeamPacket::toString() const
 {
     std::stringstream result;
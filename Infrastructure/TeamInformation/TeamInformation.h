@@ -36,10 +36,18 @@ class FieldObjects;
 
 
 #define TEAM_PACKET_STRUCT_HEADER "NUtm"
+#define TEAM_PACKET_STRUCT_VERSION 2
 
+/*! @brief The information shared with team mates
+
+    Over the network the packet is sent in a fixed little-endian layout (see encode()), so robots with different
+    compilers and word sizes can talk to each other, and so it can be encoded and decoded without allocating.
+ */
 class TeamPacket
 {
 public:
+    static const int EncodedSize = 72;          //!< the size of an encoded team packet in bytes
+
     struct SharedBall 
     {
         float TimeSinceLastSeen;
@@ -68,6 +76,9 @@ public:
     SharedBall Ball;
     SharedSelf Self;
 
+    int encode(char* buffer, int size) const;
+    bool decode(const char* buffer, int size);
+
     std::string toString() const;
     std::ostream& toFile(std::ostream& output) const;
     std::istream& fromFile(std::istream& input);
@@ -0,0 +1,245 @@
+/*! @file TeamPacketTest.cpp
+    @brief A round trip and fuzz test, and a benchmark, of the team packet network encoding
+
+    The test checks that
+        - random packets (including NaN and infinite fields) survive encode and decode bit for bit
+        - encode refuses a buffer that is too small
+        - truncated, extended, wrong header and wrong version packets are rejected, and leave the packet untouched
+        - random buffers, a quarter of them starting with a valid header, never crash decode, and only
+          correctly sized ones with the header and version are accepted
+    and then times encode plus decode against the stringstream path the packets used to take.
+
+    Build and run from this directory with
+    @code
+        make TeamPacketTest && ./TeamPacketTest
+    @endcode
+    It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TeamInformation.h"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <sstream>
+#include <vector>
+#include <stdint.h>
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t random32()
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+/*! @brief Returns a random float, occasionally a NaN, infinity or denormal, as a malicious or broken team mate might send */
+static float randomFloat()
+{
+    switch (random32() % 16)
+    {
+        case 0: return std::numeric_limits<float>::quiet_NaN();
+        case 1: return -std::numeric_limits<float>::infinity();
+        case 2: return std::numeric_limits<float>::denorm_min();
+        default: return (static_cast<int>(random32() % 200001) - 100000)/100.0f;
+    }
+}
+
+static TeamPacket randomPacket()
+{
+    TeamPacket packet;
+    memset(&packet, 0, sizeof(packet));
+    memcpy(packet.Header, TEAM_PACKET_STRUCT_HEADER, 4);
+    packet.ID = random32();
+    packet.SentTime = random32()*1e-3 + random32();
+    packet.ReceivedTime = 0;
+    packet.PlayerNumber = random32() % 256;
+    packet.TeamNumber = random32() % 256;
+    packet.TimeToBall = randomFloat();
+    float* ball = &packet.Ball.TimeSinceLastSeen;
+    float* self = &packet.Self.X;
+    for (int i=0; i<6; i++)
+    {
+        ball[i] = randomFloat();
+        self[i] = randomFloat();
+    }
+    return packet;
+}
+
+/*! @brief Returns true if every sent field of the packets is bit for bit identical */
+static bool samePacket(const TeamPacket& a, const TeamPacket& b)
+{
+    return memcmp(a.Header, b.Header, 4) == 0 and a.ID == b.ID and memcmp(&a.SentTime, &b.SentTime, sizeof(double)) == 0
+       and a.PlayerNumber == b.PlayerNumber and a.TeamNumber == b.TeamNumber and memcmp(&a.TimeToBall, &b.TimeToBall, sizeof(float)) == 0
+       and memcmp(&a.Ball, &b.Ball, sizeof(a.Ball)) == 0 and memcmp(&a.Self, &b.Self, sizeof(a.Self)) == 0;
+}
+
+static void testRoundTrip()
+{
+    printf("Round trip:\n");
+    const int count = 100000;
+    char buffer[128];
+    int mismatched = 0, badsize = 0;
+    for (int i=0; i<count; i++)
+    {
+        TeamPacket sent = randomPacket();
+        TeamPacket received;
+        int size = sent.encode(buffer, sizeof(buffer));
+        if (size != TeamPacket::EncodedSize)
+            badsize++;
+        if (not received.decode(buffer, size) or not samePacket(sent, received))
+            mismatched++;
+    }
+    check(badsize == 0, "encoded packets that were not EncodedSize bytes", badsize);
+    check(mismatched == 0, "random packets that did not survive the round trip", mismatched);
+
+    // the layout is fixed, so check a few fields at their documented offsets
+    TeamPacket packet = randomPacket();
+    packet.ID = 0x04030201;
+    packet.PlayerNumber = 3;
+    packet.Self.SDHeading = 1.0f;
+    packet.encode(buffer, sizeof(buffer));
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(buffer);
+    bool layout = memcmp(buffer, "NUtm", 4) == 0 and bytes[4] == TEAM_PACKET_STRUCT_VERSION and bytes[5] == 3
+              and bytes[8] == 1 and bytes[9] == 2 and bytes[10] == 3 and bytes[11] == 4
+              and bytes[68] == 0x00 and bytes[69] == 0x00 and bytes[70] == 0x80 and bytes[71] == 0x3f;
+    check(layout, "fields are little-endian at their documented offsets", layout);
+
+    check(packet.encode(buffer, TeamPacket::EncodedSize - 1) == 0, "encoding into a short buffer returns 0", 0);
+}
+
+static void testMalformed()
+{
+    printf("Malformed packets:\n");
+    char buffer[256];
+    TeamPacket original = randomPacket();
+    original.encode(buffer, sizeof(buffer));
+
+    TeamPacket packet = randomPacket();
+    TeamPacket before = packet;
+    int accepted = 0;
+    accepted += packet.decode(buffer, TeamPacket::EncodedSize - 1);
+    accepted += packet.decode(buffer, TeamPacket::EncodedSize + 1);
+    accepted += packet.decode(buffer, 0);
+    accepted += packet.decode(buffer, -TeamPacket::EncodedSize);
+
+    char wrong[TeamPacket::EncodedSize];
+    memcpy(wrong, buffer, sizeof(wrong));
+    wrong[0] = 'X';
+    accepted += packet.decode(wrong, sizeof(wrong));
+    memcpy(wrong, buffer, sizeof(wrong));
+    wrong[4] = TEAM_PACKET_STRUCT_VERSION + 1;
+    accepted += packet.decode(wrong, sizeof(wrong));
+    check(accepted == 0, "truncated, extended, empty, wrong header or wrong version packets accepted", accepted);
+    check(samePacket(packet, before), "a rejected packet leaves the packet untouched", 0);
+
+    // random buffers; a quarter start with a valid header and version, and a quarter of those are the right size
+    const int count = 1000000;
+    int valid = 0, decoded = 0, wronglyaccepted = 0;
+    for (int i=0; i<count; i++)
+    {
+        int size = random32() % 201;
+        uint32_t kind = random32() % 16;
+        if (kind < 4)
+        {
+            if (kind == 0)
+                size = TeamPacket::EncodedSize;
+            if (size >= 5)
+            {
+                memcpy(buffer, TEAM_PACKET_STRUCT_HEADER, 4);
+                buffer[4] = TEAM_PACKET_STRUCT_VERSION;
+            }
+        }
+        for (int j=(kind < 4 ? 5 : 0); j<size; j++)
+            buffer[j] = random32();
+
+        bool shouldaccept = size == TeamPacket::EncodedSize and memcmp(buffer, TEAM_PACKET_STRUCT_HEADER, 4) == 0 and buffer[4] == TEAM_PACKET_STRUCT_VERSION;
+        bool accepted = packet.decode(buffer, size);
+        valid += shouldaccept;
+        decoded += accepted;
+        if (accepted != shouldaccept)
+            wronglyaccepted++;
+    }
+    check(wronglyaccepted == 0, "random buffers where decode disagreed with the size, header and version", wronglyaccepted);
+    check(decoded == valid and valid > 0, "random buffers decoded, all with the right size, header and version", decoded);
+}
+
+static void benchmark()
+{
+    printf("Benchmark:\n");
+    const int count = 200000;
+    std::vector<TeamPacket> packets;
+    for (int i=0; i<1024; i++)
+        packets.push_back(randomPacket());
+
+    char buffer[TeamPacket::EncodedSize];
+    TeamPacket received;
+    unsigned long checksum = 0;
+    double start = now();
+    for (int i=0; i<count; i++)
+    {
+        int size = packets[i & 1023].encode(buffer, sizeof(buffer));
+        received.decode(buffer, size);
+        checksum += received.ID;
+    }
+    double encodetime = (now() - start)/count;
+
+    // the path the packets took before encode and decode: into a stringstream, out to a string, and back through a stringstream
+    const int streamcount = count/10;
+    start = now();
+    for (int i=0; i<streamcount; i++)
+    {
+        std::stringstream out;
+        out << packets[i & 1023];
+        std::stringstream in(out.str());
+        in >> received;
+        checksum += received.ID;
+    }
+    double streamtime = (now() - start)/streamcount;
+
+    printf("  encode and decode:  %.1fns per packet\n", 1e9*encodetime);
+    printf("  stringstreams:      %.1fns per packet (checksum %lu)\n", 1e9*streamtime, checksum);
+    check(encodetime < streamtime, "encode and decode is faster than the stringstreams (speed up)", streamtime/encodetime);
+}
+
+int main()
+{
+    testRoundTrip();
+    testMalformed();
+    benchmark();
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+#include "AttitudeHistory.h"
+
+/*! @brief Returns the attitude history shared by the sensors and vision */
+AttitudeHistory& AttitudeHistory::Instance()
+{
+    static AttitudeHistory history;
+    return history;
+}
+
+AttitudeHistory::AttitudeHistory()
+{
+    pthread_mutex_init(&m_mutex, NULL);
+    m_newest = -1;
+    m_size = 0;
+}
+
+AttitudeHistory::~AttitudeHistory()
+{
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/*! @brief Adds an attitude estimate. Samples must be added in time order; older samples are ignored.
+    @param time the time of the estimate in ms
+    @param roll the body roll in radians
+    @param pitch the body pitch in radians
+ */
+void AttitudeHistory::add(double time, float roll, float pitch)
+{
+    pthread_mutex_lock(&m_mutex);
+    if (m_size == 0 or time > m_samples[m_newest].time)
+    {
+        m_newest = (m_newest + 1) % Capacity;
+        m_samples[m_newest].time = time;
+        m_samples[m_newest].roll = roll;
+        m_samples[m_newest].pitch = pitch;
+        if (m_size < Capacity)
+            m_size++;
+    }
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/*! @brief Gets the attitude at the given time, by interpolating between the samples either side of it.
+           Times after the most recent sample get the most recent sample.
+    @param time the time in ms
+    @param roll will be updated with the body roll
+    @param pitch will be updated with the body pitch
+    @return false if there are no samples, or the time is older than the history
+ */
+bool AttitudeHistory::get(double time, float& roll, float& pitch) const
+{
+    bool found = false;
+    pthread_mutex_lock(&m_mutex);
+    if (m_size > 0)
+    {
+        const Sample& newest = m_samples[m_newest];
+        if (time >= newest.time)
+        {
+            roll = newest.roll;
+            pitch = newest.pitch;
+            found = true;
+        }
+        else
+        {
+            for (int n=1; n<m_size; n++)
+            {   // walk backwards until the sample before the time is found
+                const Sample& after = m_samples[(m_newest - n + 1 + Capacity) % Capacity];
+                const Sample& before = m_samples[(m_newest - n + Capacity) % Capacity];
+                if (before.time <= time)
+                {
+                    const float t = (time - before.time)/(after.time - before.time);
+                    roll = before.roll + t*(after.roll - before.roll);
+                    pitch = before.pitch + t*(after.pitch - before.pitch);
+                    found = true;
+                    break;
+                }
+            }
+        }
+    }
+    pthread_mutex_unlock(&m_mutex);
+    return found;
+}
+
+/*! @brief Removes all of the samples */
+void AttitudeHistory::clear()
+{
+    pthread_mutex_lock(&m_mutex);
+    m_newest = -1;
+    m_size = 0;
+    pthread_mutex_unlock(&m_mutex);
+}
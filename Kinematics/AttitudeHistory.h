@@ -0,0 +1,46 @@
+#ifndef ATTITUDEHISTORY_H
+#define ATTITUDEHISTORY_H
+
+/*!
+    @file AttitudeHistory.h
+    @brief Declaration of AttitudeHistory class
+    @class AttitudeHistory
+    @brief A short, timestamped history of the body attitude shared between the sensor and vision threads.
+
+    The orientation filter adds an estimate for every sensor update. Images are captured between sensor
+    updates, and are processed some time later, so vision uses get() to interpolate the attitude at the
+    time the image was captured rather than using the latest sensor data.
+ */
+
+#include <pthread.h>
+
+class AttitudeHistory
+{
+public:
+    static AttitudeHistory& Instance();
+
+    void add(double time, float roll, float pitch);
+    bool get(double time, float& roll, float& pitch) const;
+    void clear();
+private:
+    AttitudeHistory();
+    ~AttitudeHistory();
+    AttitudeHistory(const AttitudeHistory&);
+    AttitudeHistory& operator=(const AttitudeHistory&);
+private:
+    /*! @brief A single attitude estimate */
+    struct Sample
+    {
+        double time;                            //!< the time of the estimate in ms
+        float roll;                             //!< the body roll in radians
+        float pitch;                            //!< the body pitch in radians
+    };
+    static const int Capacity = 128;            //!< the number of samples kept; about a second of sensor updates
+
+    Sample m_samples[Capacity];                 //!< a ring buffer of samples in time order
+    int m_newest;                               //!< the index of the most recent sample
+    int m_size;                                 //!< the number of valid samples
+    mutable pthread_mutex_t m_mutex;
+};
+
+#endif
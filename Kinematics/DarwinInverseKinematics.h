@@ -19,6 +19,7 @@
 
 #include "Tools/Math/Matrix.h"
 #include "NUInverseKinematics.h"
+#include "DarwinLegIK.h"
 #include "Kinematics.h"
 #include "Tools/Math/TransformMatrices.h"
 #include "Tools/Math/General.h"
@@ -129,12 +130,31 @@ public:
     }
     bool calculateLegJoints(const Matrix& leftPosition, const Matrix& rightPosition, std::vector<float>& jointPositions)
     {
-        bool targetReachable = true;
+        float left[4][4], right[4][4];
+        toTransform(leftPosition, left);
+        toTransform(rightPosition, right);
+        return calculateLegJoints(left, right, jointPositions);
+    }
 
-        if(!calculateLeg(leftPosition, jointPositions, true))
-          targetReachable = false;
-        if(!calculateLeg(rightPosition, jointPositions, false))
-          targetReachable = false;
+    bool calculateLegJoints(const float leftPosition[4][4], const float rightPosition[4][4], std::vector<float>& jointPositions)
+    {
+        DarwinLegIK::LegJoints left, right;
+        bool targetReachable = m_leg_solver.solve(leftPosition, true, left);
+        targetReachable = m_leg_solver.solve(rightPosition, false, right) and targetReachable;
+
+        jointPositions[DarwinJoint::LHipYaw] = left.hipYaw;
+        jointPositions[DarwinJoint::LHipRoll] = left.hipRoll;
+        jointPositions[DarwinJoint::LHipPitch] = left.hipPitch;
+        jointPositions[DarwinJoint::LKneePitch] = left.knee;
+        jointPositions[DarwinJoint::LAnklePitch] = left.anklePitch;
+        jointPositions[DarwinJoint::LAnkleRoll] = left.ankleRoll;
+
+        jointPositions[DarwinJoint::RHipYaw] = right.hipYaw;
+        jointPositions[DarwinJoint::RHipRoll] = right.hipRoll;
+        jointPositions[DarwinJoint::RHipPitch] = right.hipPitch;
+        jointPositions[DarwinJoint::RKneePitch] = right.knee;
+        jointPositions[DarwinJoint::RAnklePitch] = right.anklePitch;
+        jointPositions[DarwinJoint::RAnkleRoll] = right.ankleRoll;
         return targetReachable;
     }
 
@@ -144,11 +164,22 @@ public:
         return targetReachable;
     }
 private:
+    DarwinLegIK m_leg_solver;
+
+    static void toTransform(const Matrix& position, float transform[4][4])
+    {
+        for (int i=0; i<4; i++)
+            for (int j=0; j<4; j++)
+                transform[i][j] = position[i][j];
+    }
+
     bool isInside(float t, float min, float max) const
     {return min <= max ? t >= min && t <= max : t >= min || t <= max;}
     float limit(float t, float min, float max) const {return t < min ? min : t > max ? max : t;}
 
 
+protected:
+    /*! @brief The Matrix implementation of the leg solution. Kept as the reference for DarwinLegIK (see DarwinLegIKTest.cpp). */
     bool calculateLeg(const Matrix& position, std::vector<float>& jointPositions, bool isLeft)
     {
         const float lengthBetweenLegs = 74.0f;
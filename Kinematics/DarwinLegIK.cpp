@@ -0,0 +1,146 @@
+#include "DarwinLegIK.h"
+#include "Tools/Math/General.h"
+
+#include <cmath>
+#include <cstring>
+
+/*! @brief Creates a solver
+    @param resolution the size in mm of the cells foot positions are quantised into for the cache
+    @param angleresolution the size of the cells the foot rotation matrix elements are quantised into
+ */
+DarwinLegIK::DarwinLegIK(float resolution, float angleresolution)
+{
+    m_position_scale = 1.0f/resolution;
+    m_rotation_scale = 1.0f/angleresolution;
+    clearCache();
+}
+
+void DarwinLegIK::clearCache()
+{
+    for (int i=0; i<CacheSize; i++)
+        m_cache[i].valid = false;
+    m_hits = 0;
+    m_misses = 0;
+}
+
+/*! @brief Calculates the joint angles for a leg, reusing the solution of a recently solved pose if the
+           foot target is the same to within the cache resolution.
+    @param position the transform from the hip centre to the ankle
+    @param isLeft true if the position is for the left leg
+    @param joints will be updated with the solution
+    @return the reachability of the target, as returned by DarwinInverseKinematics
+ */
+bool DarwinLegIK::solve(const float position[4][4], bool isLeft, LegJoints& joints)
+{
+    int32_t key[KeySize];
+    quantise(position, key);
+    CacheEntry& entry = m_cache[hash(key, isLeft) & (CacheSize - 1)];
+    if (entry.valid and entry.isLeft == isLeft and memcmp(entry.key, key, sizeof(key)) == 0)
+    {
+        m_hits++;
+        joints = entry.joints;
+        return entry.reachable;
+    }
+
+    m_misses++;
+    bool reachable = solveUncached(position, isLeft, joints);
+    entry.valid = true;
+    entry.isLeft = isLeft;
+    memcpy(entry.key, key, sizeof(key));
+    entry.reachable = reachable;
+    entry.joints = joints;
+    return reachable;
+}
+
+/*! @brief Calculates the joint angles for a leg
+    @param position the transform from the hip centre to the ankle
+    @param isLeft true if the position is for the left leg
+    @param joints will be updated with the solution
+ */
+bool DarwinLegIK::solveUncached(const float position[4][4], bool isLeft, LegJoints& joints)
+{
+    const float lengthBetweenLegs = 74.0f;
+    const float upperLeg = 93.0f;
+    const float lowerLeg = 93.0f;
+    const float sign = isLeft ? -1.0f : 1.0f;
+
+    // Shift to the leg offset, and invert the rigid transform: R' = R^T, p' = -R^T p
+    const float px = position[0][3];
+    const float py = position[1][3] + sign * lengthBetweenLegs * 0.5f;
+    const float pz = position[2][3];
+    float r[3][3];
+    for (int i=0; i<3; i++)
+        for (int j=0; j<3; j++)
+            r[i][j] = position[j][i];
+    const float tx = -(r[0][0]*px + r[0][1]*py + r[0][2]*pz);
+    const float ty = -(r[1][0]*px + r[1][1]*py + r[1][2]*pz);
+    const float tz = -(r[2][0]*px + r[2][1]*py + r[2][2]*pz);
+
+    const float sqrLength = tx*tx + ty*ty + tz*tz;
+    const float length = sqrtf(sqrLength);
+    float cosLowerLeg = (lowerLeg*lowerLeg + sqrLength - upperLeg*upperLeg) / (2 * lowerLeg * length);
+    float cosKnee = (upperLeg*upperLeg + lowerLeg*lowerLeg - sqrLength) / (2 * upperLeg * lowerLeg);
+
+    bool targetReachable = true;
+    // The condition of DarwinInverseKinematics::calculateLeg. The legs are the same length, so cosLowerLeg is
+    // length/(2*lowerLeg), inside [-1, 1] whenever cosKnee is; every target is therefore reported unreachable, and the
+    // clamp changes nothing for a reachable one. BWalk's centre of mass refinement has only run with this, so it is kept
+    // rather than inverted. DarwinLegIKTest checks that no target is reported reachable.
+    const bool kneeInside = cosKnee >= -1.0f and cosKnee <= 1.0f;
+    const bool lowerLegInside = cosLowerLeg >= -1.0f and cosLowerLeg <= 1.0f;
+    if (!kneeInside || lowerLegInside)
+    {
+        cosKnee = cosKnee < -1.0f ? -1.0f : (cosKnee > 1.0f ? 1.0f : cosKnee);
+        cosLowerLeg = cosLowerLeg < -1.0f ? -1.0f : (cosLowerLeg > 1.0f ? 1.0f : cosLowerLeg);
+        targetReachable = false;
+    }
+
+    const float joint3 = mathGeneral::PI - acosf(cosKnee);
+    const float joint4 = -acosf(cosLowerLeg) - atan2f(tx, sqrtf(ty*ty + tz*tz));
+    const float joint5 = atan2f(ty, tz) * sign;
+
+    // the rotation for the hip is RotY(joint3 + joint4) * RotX(sign*joint5) * R'. Only the five elements
+    // needed for the euler angles are calculated.
+    const float sa = sinf(sign*joint5);
+    const float ca = cosf(sign*joint5);
+    const float sb = sinf(joint3 + joint4);
+    const float cb = cosf(joint3 + joint4);
+    const float hip10 = ca*r[1][0] - sa*r[2][0];
+    const float hip11 = ca*r[1][1] - sa*r[2][1];
+    const float hip12 = ca*r[1][2] - sa*r[2][2];
+    const float hip02 = cb*r[0][2] + sb*(sa*r[1][2] + ca*r[2][2]);
+    const float hip22 = -sb*r[0][2] + cb*(sa*r[1][2] + ca*r[2][2]);
+
+    const float joint1 = asinf(-hip12) * -sign;
+    const float joint2 = -atan2f(hip02, hip22);
+    const float joint0 = -atan2f(hip10, hip11);
+
+    joints.hipYaw = joint0;
+    joints.hipRoll = isLeft ? -joint1 : joint1;
+    joints.hipPitch = joint2;
+    joints.knee = joint3;
+    joints.anklePitch = joint4;
+    joints.ankleRoll = isLeft ? -joint5 : joint5;
+    return targetReachable;
+}
+
+void DarwinLegIK::quantise(const float position[4][4], int32_t key[KeySize]) const
+{
+    int k = 0;
+    for (int i=0; i<3; i++)
+        for (int j=0; j<3; j++)
+            key[k++] = static_cast<int32_t>(floorf(position[i][j]*m_rotation_scale + 0.5f));
+    for (int i=0; i<3; i++)
+        key[k++] = static_cast<int32_t>(floorf(position[i][3]*m_position_scale + 0.5f));
+}
+
+uint32_t DarwinLegIK::hash(const int32_t key[KeySize], bool isLeft)
+{   // FNV-1a over the key
+    uint32_t h = isLeft ? 2166136261u : 2166136261u ^ 0x9e3779b9u;
+    for (int i=0; i<KeySize; i++)
+    {
+        h ^= static_cast<uint32_t>(key[i]);
+        h *= 16777619u;
+    }
+    return h ^ (h >> 15);
+}
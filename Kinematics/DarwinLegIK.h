@@ -0,0 +1,66 @@
+#ifndef H_DARWINLEGIK_H_DEFINED
+#define H_DARWINLEGIK_H_DEFINED
+
+/*!
+    @file DarwinLegIK.h
+
+    @brief Declaration of DarwinLegIK class
+    @class DarwinLegIK
+    @brief Closed form inverse kinematics for the six degree of freedom Darwin legs.
+
+    This is the same solution as DarwinInverseKinematics::calculateLeg, written with fixed size
+    float arrays so that it does not allocate. The walk engines solve the same foot targets
+    several times within a cycle (BWalk refines its centre of mass up to eight times), so the
+    solutions are kept in a small direct mapped cache keyed on the quantised foot pose.
+ */
+
+#include <stdint.h>
+
+class DarwinLegIK
+{
+public:
+
+    /*! @brief The solution for a single leg. The angles are in the order they are solved. */
+    struct LegJoints
+    {
+        float hipYaw;
+        float hipRoll;
+        float hipPitch;
+        float knee;
+        float anklePitch;
+        float ankleRoll;
+    };
+
+    DarwinLegIK(float resolution = 0.01f, float angleresolution = 1e-4f);
+
+    bool solve(const float position[4][4], bool isLeft, LegJoints& joints);
+    static bool solveUncached(const float position[4][4], bool isLeft, LegJoints& joints);
+
+    void clearCache();
+    unsigned int getCacheHits() const {return m_hits;}
+    unsigned int getCacheMisses() const {return m_misses;}
+private:
+    static const int CacheSize = 32;        //!< the number of cached solutions, must be a power of two
+    static const int KeySize = 12;
+
+    /*! @brief A cached solution */
+    struct CacheEntry
+    {
+        bool valid;
+        bool isLeft;
+        int32_t key[KeySize];
+        bool reachable;
+        LegJoints joints;
+    };
+
+    void quantise(const float position[4][4], int32_t key[KeySize]) const;
+    static uint32_t hash(const int32_t key[KeySize], bool isLeft);
+
+    CacheEntry m_cache[CacheSize];
+    float m_position_scale;                 //!< one over the translation quantisation in mm
+    float m_rotation_scale;                 //!< one over the rotation quantisation
+    unsigned int m_hits;
+    unsigned int m_misses;
+};
+
+#endif
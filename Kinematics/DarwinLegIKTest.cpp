@@ -0,0 +1,209 @@
+/*! @file DarwinLegIKTest.cpp
+    @brief Accuracy test and benchmark of DarwinLegIK against the Matrix leg solution in DarwinInverseKinematics
+
+    Build and run from this directory with
+    @code
+        make DarwinLegIKTest && ./DarwinLegIKTest
+    @endcode
+    It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DarwinInverseKinematics.h"
+#include "DarwinLegIK.h"
+
+#include <cstdio>
+#include <ctime>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+/*! @brief Gives the test access to the Matrix leg solution */
+class ReferenceKinematics : public DarwinInverseKinematics
+{
+public:
+    bool solveReference(const Matrix& left, const Matrix& right, std::vector<float>& joints)
+    {
+        bool reachable = calculateLeg(left, joints, true);
+        return calculateLeg(right, joints, false) and reachable;
+    }
+};
+
+struct Target
+{
+    Matrix left;
+    Matrix right;
+    float leftarray[4][4];
+    float rightarray[4][4];
+};
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static void toArray(const Matrix& position, float array[4][4])
+{
+    for (int i=0; i<4; i++)
+        for (int j=0; j<4; j++)
+            array[i][j] = position[i][j];
+}
+
+/*! @brief The grid of foot targets, covering the walk's range of step lengths, heights, turns and tilts */
+static std::vector<Target> makeTargets()
+{
+    std::vector<Target> targets;
+    for (float x = -60; x <= 60; x += 20)
+    {
+        for (float z = -186; z <= -130; z += 8)
+        {
+            for (float yaw = -0.6f; yaw <= 0.6f; yaw += 0.3f)
+            {
+                for (float roll = -0.2f; roll <= 0.2f; roll += 0.1f)
+                {
+                    Target target;
+                    target.left = TransformMatrices::RotZ(yaw) * TransformMatrices::RotX(roll);
+                    target.left[0][3] = x;
+                    target.left[1][3] = 37;
+                    target.left[2][3] = z;
+                    target.right = TransformMatrices::RotZ(-yaw) * TransformMatrices::RotX(-roll);
+                    target.right[0][3] = x;
+                    target.right[1][3] = -37;
+                    target.right[2][3] = z;
+                    toArray(target.left, target.leftarray);
+                    toArray(target.right, target.rightarray);
+                    targets.push_back(target);
+                }
+            }
+        }
+    }
+    return targets;
+}
+
+static float maxLegError(const std::vector<float>& a, const std::vector<float>& b)
+{
+    float error = 0;
+    for (size_t i=DarwinJoint::LHipRoll; i<a.size(); i++)
+        error = std::max(error, static_cast<float>(fabs(mathGeneral::normaliseAngle(a[i] - b[i]))));
+    return error;
+}
+
+static void testAccuracy(const std::vector<Target>& targets)
+{
+    printf("Accuracy over %d targets:\n", static_cast<int>(targets.size()));
+    ReferenceKinematics reference;
+    DarwinInverseKinematics solver;
+    std::vector<float> expected(20, 0.0f), uncached(20, 0.0f), cached(20, 0.0f);
+    float maxerror = 0, maxcachederror = 0;
+    int mismatched = 0, numreachable = 0;
+    for (size_t t=0; t<targets.size(); t++)
+    {
+        const Target& target = targets[t];
+        bool expectedreachable = reference.solveReference(target.left, target.right, expected);
+
+        DarwinLegIK::LegJoints left, right;
+        bool reachable = DarwinLegIK::solveUncached(target.leftarray, true, left);
+        reachable = DarwinLegIK::solveUncached(target.rightarray, false, right) and reachable;
+        solver.calculateLegJoints(target.leftarray, target.rightarray, cached);     // fills the cache
+        bool cachedreachable = solver.calculateLegJoints(target.leftarray, target.rightarray, cached);
+
+        uncached[DarwinJoint::LHipYaw] = left.hipYaw;
+        uncached[DarwinJoint::LHipRoll] = left.hipRoll;
+        uncached[DarwinJoint::LHipPitch] = left.hipPitch;
+        uncached[DarwinJoint::LKneePitch] = left.knee;
+        uncached[DarwinJoint::LAnklePitch] = left.anklePitch;
+        uncached[DarwinJoint::LAnkleRoll] = left.ankleRoll;
+        uncached[DarwinJoint::RHipYaw] = right.hipYaw;
+        uncached[DarwinJoint::RHipRoll] = right.hipRoll;
+        uncached[DarwinJoint::RHipPitch] = right.hipPitch;
+        uncached[DarwinJoint::RKneePitch] = right.knee;
+        uncached[DarwinJoint::RAnklePitch] = right.anklePitch;
+        uncached[DarwinJoint::RAnkleRoll] = right.ankleRoll;
+
+        maxerror = std::max(maxerror, maxLegError(uncached, expected));
+        maxcachederror = std::max(maxcachederror, maxLegError(cached, expected));
+        if (reachable != expectedreachable or cachedreachable != expectedreachable)
+            mismatched++;
+        numreachable += reachable;
+    }
+    check(maxerror < 1e-4, "max joint error of the fixed size solver (rad)", maxerror);
+    check(maxcachederror < 1e-4, "max joint error of a cached solution (rad)", maxcachederror);
+    check(mismatched == 0, "targets where reachability differs", mismatched);
+    check(numreachable == 0, "targets reported reachable, none with equal leg lengths (see DarwinLegIK::solveUncached)", numreachable);
+}
+
+/*! @brief Times the solvers when each target is solved repeats times in a row, as BWalk does while it refines its centre of mass */
+static void benchmark(const std::vector<Target>& targets, int repeats)
+{
+    const int rounds = 20;
+    ReferenceKinematics reference;
+    DarwinInverseKinematics solver;
+    std::vector<float> joints(20, 0.0f);
+    DarwinLegIK::LegJoints left, right;
+    int count = rounds*targets.size()*repeats;
+
+    double start = now();
+    for (int r=0; r<rounds; r++)
+        for (size_t t=0; t<targets.size(); t++)
+            for (int k=0; k<repeats; k++)
+                reference.solveReference(targets[t].left, targets[t].right, joints);
+    double referencetime = now() - start;
+
+    start = now();
+    for (int r=0; r<rounds; r++)
+        for (size_t t=0; t<targets.size(); t++)
+            for (int k=0; k<repeats; k++)
+            {
+                DarwinLegIK::solveUncached(targets[t].leftarray, true, left);
+                DarwinLegIK::solveUncached(targets[t].rightarray, false, right);
+            }
+    double uncachedtime = now() - start;
+
+    start = now();
+    for (int r=0; r<rounds; r++)
+        for (size_t t=0; t<targets.size(); t++)
+            for (int k=0; k<repeats; k++)
+                solver.calculateLegJoints(targets[t].leftarray, targets[t].rightarray, joints);
+    double cachedtime = now() - start;
+
+    printf("Time per pair of legs, each target solved %d times:\n", repeats);
+    printf("  Matrix solver:              %.3fus\n", 1e6*referencetime/count);
+    printf("  fixed size solver:          %.3fus\n", 1e6*uncachedtime/count);
+    printf("  fixed size solver, cached:  %.3fus\n", 1e6*cachedtime/count);
+    if (repeats > 1)
+        check(cachedtime < referencetime, "the cached solver is faster than the Matrix solver (speed up)", referencetime/cachedtime);
+}
+
+int main()
+{
+    std::vector<Target> targets = makeTargets();
+    testAccuracy(targets);
+    benchmark(targets, 1);
+    benchmark(targets, 8);
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,238 @@
+#include "IMUFilter.h"
+#include "Tools/Math/General.h"
+
+#include <cmath>
+
+/*! @brief Creates a filter with the given unscented transform parameters
+    @param alpha the spread of the sigma points about the mean
+    @param kappa the secondary scaling parameter
+    @param beta incorporates prior knowledge of the distribution (2 is optimal for gaussians)
+ */
+IMUFilter::IMUFilter(double alpha, double kappa, double beta)
+{
+    const double lambda = alpha*alpha*(NumStates + kappa) - NumStates;
+    m_sigma_weight = NumStates + lambda;
+    m_mean_weight0 = lambda/(NumStates + lambda);
+    m_covariance_weight0 = m_mean_weight0 + (1.0 - alpha*alpha + beta);
+    m_weight = 1.0/(2.0*(NumStates + lambda));
+
+    double mean[NumStates] = {0, 0, 0, 0};
+    double variance[NumStates] = {1e-4, 1e-4, 9.0, 9.0};
+    initialise(mean, variance);
+}
+
+/*! @brief Resets the filter to the given estimate, with an uncorrelated covariance
+    @param mean the initial state
+    @param variance the initial variance of each state
+ */
+void IMUFilter::initialise(const double mean[NumStates], const double variance[NumStates])
+{
+    for (int i=0; i<NumStates; i++)
+    {
+        m_mean[i] = mean[i];
+        for (int j=0; j<NumStates; j++)
+            m_covariance[i][j] = 0;
+        m_covariance[i][i] = variance[i];
+    }
+}
+
+/*! @brief Integrates the gyros over deltat
+    @param deltat the time since the previous update in seconds
+    @param gyrox the roll rate in rad/s
+    @param gyroy the pitch rate in rad/s
+    @param processnoise the variance added to each state over this update
+ */
+void IMUFilter::timeUpdate(double deltat, float gyrox, float gyroy, const double processnoise[NumStates])
+{
+    double points[NumSigmaPoints][NumStates];
+    generateSigmaPoints(points);
+
+    double mean[NumStates] = {0, 0, 0, 0};
+    for (int p=0; p<NumSigmaPoints; p++)
+    {
+        double* s = points[p];
+        s[BodyAngleX] += (gyrox - s[GyroOffsetX])*deltat;
+        s[BodyAngleY] += (gyroy - s[GyroOffsetY])*deltat;
+        limitState(s);
+
+        const double w = p == 0 ? m_mean_weight0 : m_weight;
+        for (int i=0; i<NumStates; i++)
+            mean[i] += w*s[i];
+    }
+
+    for (int i=0; i<NumStates; i++)
+        for (int j=0; j<NumStates; j++)
+            m_covariance[i][j] = 0;
+    for (int p=0; p<NumSigmaPoints; p++)
+    {
+        const double w = p == 0 ? m_covariance_weight0 : m_weight;
+        double d[NumStates];
+        for (int i=0; i<NumStates; i++)
+            d[i] = points[p][i] - mean[i];
+        for (int i=0; i<NumStates; i++)
+            for (int j=0; j<NumStates; j++)
+                m_covariance[i][j] += w*d[i]*d[j];
+    }
+    for (int i=0; i<NumStates; i++)
+        m_covariance[i][i] += processnoise[i];
+
+    limitState(mean);
+    for (int i=0; i<NumStates; i++)
+        m_mean[i] = mean[i];
+}
+
+/*! @brief Corrects the estimate using the direction of gravity measured by the accelerometers
+    @param accelx the x acceleration in cm/s/s
+    @param accely the y acceleration in cm/s/s
+    @param accelz the z acceleration in cm/s/s
+    @param noise the variance of each accelerometer reading
+ */
+void IMUFilter::measurementUpdate(float accelx, float accely, float accelz, double noise)
+{
+    double points[NumSigmaPoints][NumStates];
+    double predicted[NumSigmaPoints][NumMeasurements];
+    generateSigmaPoints(points);
+
+    double ymean[NumMeasurements] = {0, 0, 0};
+    for (int p=0; p<NumSigmaPoints; p++)
+    {
+        accelerometerMeasurement(points[p], predicted[p]);
+        const double w = p == 0 ? m_mean_weight0 : m_weight;
+        for (int i=0; i<NumMeasurements; i++)
+            ymean[i] += w*predicted[p][i];
+    }
+
+    // the innovation covariance Pyy and the cross covariance Pxy
+    double pyy[NumMeasurements][NumMeasurements] = {{noise, 0, 0}, {0, noise, 0}, {0, 0, noise}};
+    double pxy[NumStates][NumMeasurements];
+    for (int i=0; i<NumStates; i++)
+        for (int j=0; j<NumMeasurements; j++)
+            pxy[i][j] = 0;
+    for (int p=0; p<NumSigmaPoints; p++)
+    {
+        const double w = p == 0 ? m_covariance_weight0 : m_weight;
+        double dy[NumMeasurements];
+        for (int i=0; i<NumMeasurements; i++)
+            dy[i] = predicted[p][i] - ymean[i];
+        for (int i=0; i<NumMeasurements; i++)
+            for (int j=0; j<NumMeasurements; j++)
+                pyy[i][j] += w*dy[i]*dy[j];
+        for (int i=0; i<NumStates; i++)
+        {
+            const double dx = points[p][i] - m_mean[i];
+            for (int j=0; j<NumMeasurements; j++)
+                pxy[i][j] += w*dx*dy[j];
+        }
+    }
+
+    // invert the 3x3 Pyy using its cofactors
+    double inv[NumMeasurements][NumMeasurements];
+    inv[0][0] = pyy[1][1]*pyy[2][2] - pyy[1][2]*pyy[2][1];
+    inv[0][1] = pyy[0][2]*pyy[2][1] - pyy[0][1]*pyy[2][2];
+    inv[0][2] = pyy[0][1]*pyy[1][2] - pyy[0][2]*pyy[1][1];
+    inv[1][0] = pyy[1][2]*pyy[2][0] - pyy[1][0]*pyy[2][2];
+    inv[1][1] = pyy[0][0]*pyy[2][2] - pyy[0][2]*pyy[2][0];
+    inv[1][2] = pyy[0][2]*pyy[1][0] - pyy[0][0]*pyy[1][2];
+    inv[2][0] = pyy[1][0]*pyy[2][1] - pyy[1][1]*pyy[2][0];
+    inv[2][1] = pyy[0][1]*pyy[2][0] - pyy[0][0]*pyy[2][1];
+    inv[2][2] = pyy[0][0]*pyy[1][1] - pyy[0][1]*pyy[1][0];
+    const double det = pyy[0][0]*inv[0][0] + pyy[0][1]*inv[1][0] + pyy[0][2]*inv[2][0];
+    if (det == 0 or not std::isfinite(det))
+        return;
+    for (int i=0; i<NumMeasurements; i++)
+        for (int j=0; j<NumMeasurements; j++)
+            inv[i][j] /= det;
+
+    // K = Pxy * Pyy^-1, x = x + K*(y - ymean), P = P - K*Pxy^T
+    const double innovation[NumMeasurements] = {accelx - ymean[0], accely - ymean[1], accelz - ymean[2]};
+    double gain[NumStates][NumMeasurements];
+    for (int i=0; i<NumStates; i++)
+        for (int j=0; j<NumMeasurements; j++)
+            gain[i][j] = pxy[i][0]*inv[0][j] + pxy[i][1]*inv[1][j] + pxy[i][2]*inv[2][j];
+
+    for (int i=0; i<NumStates; i++)
+    {
+        m_mean[i] += gain[i][0]*innovation[0] + gain[i][1]*innovation[1] + gain[i][2]*innovation[2];
+        for (int j=0; j<NumStates; j++)
+            m_covariance[i][j] -= gain[i][0]*pxy[j][0] + gain[i][1]*pxy[j][1] + gain[i][2]*pxy[j][2];
+    }
+    limitState(m_mean);
+}
+
+/*! @brief Generates the sigma points for the current estimate
+    @param points will be updated with the sigma points; the mean, then the positive and then the negative deviations
+ */
+void IMUFilter::generateSigmaPoints(double points[NumSigmaPoints][NumStates]) const
+{
+    double weighted[NumStates][NumStates];
+    for (int i=0; i<NumStates; i++)
+        for (int j=0; j<NumStates; j++)
+            weighted[i][j] = m_sigma_weight*m_covariance[i][j];
+    double l[NumStates][NumStates];
+    cholesky(weighted, l);
+
+    for (int i=0; i<NumStates; i++)
+        points[0][i] = m_mean[i];
+    for (int c=0; c<NumStates; c++)
+    {
+        for (int i=0; i<NumStates; i++)
+        {
+            points[1 + c][i] = m_mean[i] + l[i][c];
+            points[1 + NumStates + c][i] = m_mean[i] - l[i][c];
+        }
+    }
+}
+
+/*! @brief The lower triangular cholesky decomposition, a = l*l^T. Small negative pivots (from rounding) are
+           replaced by a small positive number, as in cholesky(Matrix)
+ */
+void IMUFilter::cholesky(const double a[NumStates][NumStates], double l[NumStates][NumStates])
+{
+    const double eps = 1e-6;
+    for (int i=0; i<NumStates; i++)
+    {
+        for (int j=0; j<NumStates; j++)
+            l[i][j] = 0;
+        for (int j=0; j<i; j++)
+        {
+            double s = a[i][j];
+            for (int k=0; k<j; k++)
+                s -= l[i][k]*l[j][k];
+            l[i][j] = s/l[j][j];
+        }
+        double s = a[i][i];
+        for (int k=0; k<i; k++)
+            s -= l[i][k]*l[i][k];
+        if (s < 0)
+            s = eps;
+        l[i][i] = sqrt(s);
+    }
+}
+
+/*! @brief Keeps the body angles in [-pi, pi], and unwraps a large roll and a large pitch back to upright */
+void IMUFilter::limitState(double state[NumStates])
+{
+    const double pi_2 = 0.5*mathGeneral::PI;
+    if (fabs(state[BodyAngleX]) > pi_2 and fabs(state[BodyAngleY]) > pi_2)
+    {
+        state[BodyAngleX] -= mathGeneral::sign(state[BodyAngleX])*mathGeneral::PI;
+        state[BodyAngleY] -= mathGeneral::sign(state[BodyAngleY])*mathGeneral::PI;
+    }
+    state[BodyAngleX] = mathGeneral::normaliseAngle(state[BodyAngleX]);
+    state[BodyAngleY] = mathGeneral::normaliseAngle(state[BodyAngleY]);
+}
+
+/*! @brief The accelerations expected for the body angles, that is gravity rotated by the pitch then the roll */
+void IMUFilter::accelerometerMeasurement(const double state[NumStates], double measurement[NumMeasurements])
+{
+    const double g = 980.7;
+    const float sinroll = sin(state[BodyAngleX]);
+    const float cosroll = cos(state[BodyAngleX]);
+    const float sinpitch = sin(state[BodyAngleY]);
+    const float cospitch = cos(state[BodyAngleY]);
+
+    // RotX(roll) * RotY(pitch) * [0, 0, -g]^T
+    measurement[0] = g*sinpitch;
+    measurement[1] = -g*sinroll*cospitch;
+    measurement[2] = -g*cosroll*cospitch;
+}
@@ -0,0 +1,54 @@
+#ifndef IMUFILTER_H
+#define IMUFILTER_H
+
+/*!
+    @file IMUFilter.h
+    @brief Declaration of IMUFilter class
+    @class IMUFilter
+    @brief A fixed size unscented Kalman filter estimating the body roll and pitch from the gyros and accelerometers.
+
+    This uses the same model as the IMUModel (the gyro offsets and body angles, with the gyros integrated in the
+    time update and the accelerometers as the measurement), and gives the same estimate as SeqUKF with that model.
+    All of the storage is fixed size, so each update has a constant cost of a few microseconds and does not
+    allocate, and it can be run for every sensor update.
+ */
+
+class IMUFilter
+{
+public:
+    enum State
+    {
+        GyroOffsetX,
+        GyroOffsetY,
+        BodyAngleX,
+        BodyAngleY,
+        NumStates
+    };
+
+    IMUFilter(double alpha = 1e-2, double kappa = 0.0, double beta = 2.0);
+
+    void initialise(const double mean[NumStates], const double variance[NumStates]);
+    void timeUpdate(double deltat, float gyrox, float gyroy, const double processnoise[NumStates]);
+    void measurementUpdate(float accelx, float accely, float accelz, double noise);
+
+    double getMean(State state) const {return m_mean[state];}
+    double getVariance(State state) const {return m_covariance[state][state];}
+private:
+    static const int NumSigmaPoints = 2*NumStates + 1;
+    static const int NumMeasurements = 3;
+
+    void generateSigmaPoints(double points[NumSigmaPoints][NumStates]) const;
+    static void cholesky(const double a[NumStates][NumStates], double l[NumStates][NumStates]);
+    static void limitState(double state[NumStates]);
+    static void accelerometerMeasurement(const double state[NumStates], double measurement[NumMeasurements]);
+private:
+    double m_mean[NumStates];                           //!< the current estimate
+    double m_covariance[NumStates][NumStates];          //!< the covariance of the current estimate
+
+    double m_sigma_weight;                              //!< the scale (L + lambda) applied to the covariance for the sigma points
+    double m_mean_weight0;                              //!< the mean weight of the central sigma point
+    double m_covariance_weight0;                        //!< the covariance weight of the central sigma point
+    double m_weight;                                    //!< the mean and covariance weight of the remaining sigma points
+};
+
+#endif
@@ -0,0 +1,245 @@
+/*! @file IMUFilterTest.cpp
+    @brief Accuracy test and benchmark of IMUFilter against the filters it replaced
+
+    Synthetic gyro and accelerometer readings, from a body swaying as it does while walking with
+    constant gyro offsets and sensor noise, are fed to IMUFilter and to SeqUKF with the IMUModel,
+    with the noise NUSensors::calculateOrientation uses. The test checks that the two estimates of
+    the body angles agree, that both follow the true angles, and that IMUFilter is faster and does
+    not allocate. The cost of an update of OrientationUKF, the older filter NUSensors still
+    constructs, is printed for reference.
+
+    Build and run from this directory with
+    @code
+        make IMUFilterTest && ./IMUFilterTest
+    @endcode
+    It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IMUFilter.h"
+#include "OrientationUKF.h"
+#include "Localisation/Filters/SeqUKF.h"
+#include "Localisation/Filters/IMUModel.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <new>
+#include <vector>
+#include <algorithm>
+
+static unsigned long allocations = 0;
+
+void* operator new(size_t size)
+{
+    allocations++;
+    void* p = malloc(size ? size : 1);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) throw()
+{
+    free(p);
+}
+
+/*! @brief A frame of sensor readings, and the body angles they were made from */
+struct Reading
+{
+    double Time;                //!< in ms
+    float Gyros[2];             //!< roll and pitch rates in rad/s
+    float Accelerations[3];     //!< in cm/s/s
+    float Roll;
+    float Pitch;
+};
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+/*! @brief A sample from a zero mean gaussian, using the Box-Muller transform on rand() */
+static double gaussian(double deviation)
+{
+    const double u = (rand() + 1.0)/(RAND_MAX + 2.0);
+    const double v = (rand() + 1.0)/(RAND_MAX + 2.0);
+    return deviation*sqrt(-2*log(u))*cos(2*M_PI*v);
+}
+
+/*! @brief 20s of readings at the Darwin's 8ms sensor period. The body rolls and pitches at the step and stride
+           frequencies, the gyros have a constant offset, and all of the sensors have noise */
+static std::vector<Reading> makeReadings()
+{
+    srand(1);
+    const double g = 980.7;
+    std::vector<Reading> readings;
+    for (int i=0; i<2500; i++)
+    {
+        const double t = 0.008*i;
+        Reading r;
+        r.Time = 1000*t;
+        r.Roll = 0.08*sin(2*M_PI*1.6*t);
+        r.Pitch = 0.05 + 0.04*sin(2*M_PI*0.8*t);
+        r.Gyros[0] = 0.08*2*M_PI*1.6*cos(2*M_PI*1.6*t) + 0.02 + gaussian(0.02);
+        r.Gyros[1] = 0.04*2*M_PI*0.8*cos(2*M_PI*0.8*t) - 0.01 + gaussian(0.02);
+        r.Accelerations[0] = g*sin(r.Pitch) + gaussian(5);
+        r.Accelerations[1] = -g*sin(r.Roll)*cos(r.Pitch) + gaussian(5);
+        r.Accelerations[2] = -g*cos(r.Roll)*cos(r.Pitch) + gaussian(5);
+        readings.push_back(r);
+    }
+    return readings;
+}
+
+/*! @brief SeqUKF with the IMUModel, set up and updated as NUSensors::calculateOrientation did */
+class ReferenceFilter
+{
+public:
+    ReferenceFilter() : m_filter(new IMUModel()), m_gyros(2, 1, false), m_accelerations(3, 1, false),
+                        m_process_noise(4, 4, false), m_gyro_noise(2, 2, false), m_accel_noise(3, 3, false)
+    {
+        Matrix mean(IMUModel::kstates_total, 1, false);
+        Matrix covariance(IMUModel::kstates_total, IMUModel::kstates_total, false);
+        covariance[IMUModel::kstates_gyro_offset_x][IMUModel::kstates_gyro_offset_x] = 0.0001;
+        covariance[IMUModel::kstates_gyro_offset_y][IMUModel::kstates_gyro_offset_y] = 0.0001;
+        covariance[IMUModel::kstates_body_angle_x][IMUModel::kstates_body_angle_x] = 9.0;
+        covariance[IMUModel::kstates_body_angle_y][IMUModel::kstates_body_angle_y] = 9.0;
+        m_filter.initialiseEstimate(MultivariateGaussian(mean, covariance));
+        for (int i=0; i<4; i++)
+            m_process_noise[i][i] = 1e-6;
+        m_gyro_noise[0][0] = m_gyro_noise[1][1] = 0.25;
+        m_accel_noise[0][0] = m_accel_noise[1][1] = m_accel_noise[2][2] = 10.0;
+    }
+
+    void update(double deltat, const Reading& r)
+    {
+        m_gyros[0][0] = r.Gyros[0];
+        m_gyros[1][0] = r.Gyros[1];
+        for (int i=0; i<3; i++)
+            m_accelerations[i][0] = r.Accelerations[i];
+        m_filter.timeUpdate(deltat, m_gyros, m_process_noise*deltat, m_gyro_noise);
+        m_filter.measurementUpdate(m_accelerations, m_accel_noise, Matrix(), IMUModel::kmeasurement_accelerometer);
+    }
+
+    double roll() const {return m_filter.estimate().mean(IMUModel::kstates_body_angle_x);}
+    double pitch() const {return m_filter.estimate().mean(IMUModel::kstates_body_angle_y);}
+private:
+    SeqUKF m_filter;
+    Matrix m_gyros;
+    Matrix m_accelerations;
+    Matrix m_process_noise;
+    Matrix m_gyro_noise;
+    Matrix m_accel_noise;
+};
+
+static void updateIMUFilter(IMUFilter& filter, double deltat, const Reading& r)
+{
+    const double processnoise[IMUFilter::NumStates] = {1e-6*deltat, 1e-6*deltat, 1e-6*deltat, 1e-6*deltat};
+    filter.timeUpdate(deltat, r.Gyros[0], r.Gyros[1], processnoise);
+    filter.measurementUpdate(r.Accelerations[0], r.Accelerations[1], r.Accelerations[2], 10.0);
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size()/2];
+}
+
+int main()
+{
+    std::vector<Reading> readings = makeReadings();
+
+    printf("Agreement with SeqUKF and the IMUModel:\n");
+    IMUFilter filter;
+    ReferenceFilter reference;
+    double maxdifference = 0, maxfiltererror = 0, maxreferenceerror = 0;
+    for (size_t i=0; i<readings.size(); i++)
+    {
+        const double deltat = i == 0 ? 0 : (readings[i].Time - readings[i-1].Time)/1000.0;
+        updateIMUFilter(filter, deltat, readings[i]);
+        reference.update(deltat, readings[i]);
+
+        const double roll = filter.getMean(IMUFilter::BodyAngleX);
+        const double pitch = filter.getMean(IMUFilter::BodyAngleY);
+        maxdifference = std::max(maxdifference, std::max(fabs(roll - reference.roll()), fabs(pitch - reference.pitch())));
+        if (i >= 125)           // after the first second, once the offsets have settled
+        {
+            maxfiltererror = std::max(maxfiltererror, std::max(fabs(roll - readings[i].Roll), fabs(pitch - readings[i].Pitch)));
+            maxreferenceerror = std::max(maxreferenceerror, std::max(fabs(reference.roll() - readings[i].Roll), fabs(reference.pitch() - readings[i].Pitch)));
+        }
+    }
+    check(maxdifference < 1e-4, "largest difference in the body angles over 20s (rad)", maxdifference);
+    check(maxfiltererror < 0.05, "largest error of IMUFilter after 1s (rad)", maxfiltererror);
+    check(maxreferenceerror < 0.05, "largest error of SeqUKF after 1s (rad)", maxreferenceerror);
+
+    printf("Cost of an update (a time and a measurement update):\n");
+    std::vector<double> filtertimes, referencetimes, orientationtimes;
+    filtertimes.reserve(readings.size());
+    IMUFilter timedfilter;
+    ReferenceFilter timedreference;
+    OrientationUKF orientation;
+    std::vector<float> gyros(2), accelerations(3), kinematics(3, 0);
+    unsigned long filterallocations = 0;
+    for (size_t i=0; i<readings.size(); i++)
+    {
+        const Reading& r = readings[i];
+        const double deltat = i == 0 ? 0 : (r.Time - readings[i-1].Time)/1000.0;
+        gyros.assign(r.Gyros, r.Gyros + 2);
+        accelerations.assign(r.Accelerations, r.Accelerations + 3);
+        kinematics[0] = r.Roll;
+        kinematics[1] = r.Pitch;
+
+        unsigned long before = allocations;
+        double start = now();
+        updateIMUFilter(timedfilter, deltat, r);
+        filtertimes.push_back(now() - start);
+        filterallocations += allocations - before;
+
+        start = now();
+        timedreference.update(deltat, r);
+        referencetimes.push_back(now() - start);
+
+        if (not orientation.Initialised())
+            orientation.initialise(r.Time, gyros, accelerations, true, kinematics);
+        else
+        {
+            start = now();
+            orientation.TimeUpdate(gyros, r.Time);
+            orientation.MeasurementUpdate(accelerations, false, kinematics);
+            orientationtimes.push_back(now() - start);
+        }
+    }
+    const double filtertime = 1e6*median(filtertimes);
+    const double referencetime = 1e6*median(referencetimes);
+    printf("  IMUFilter %.2fus, SeqUKF with the IMUModel %.2fus, OrientationUKF %.2fus (medians)\n",
+           filtertime, referencetime, orientationtimes.empty() ? 0.0 : 1e6*median(orientationtimes));
+    check(filtertime*5 < referencetime, "speed up over SeqUKF", referencetime/filtertime);
+    check(filterallocations == 0, "allocations by IMUFilter", filterallocations);
+
+    printf(failures == 0 ? "PASSED\n" : "FAILED\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -17,6 +17,20 @@ class NUInverseKinematics
 {
 public:
     virtual bool calculateLegJoints(const Matrix& leftPosition, const Matrix& rightPosition, std::vector<float>& jointPositions)=0;
+    /*! @brief Calculates the leg joints from fixed size [row][column] transforms. Models without a fixed size solver use the Matrix version. */
+    virtual bool calculateLegJoints(const float leftPosition[4][4], const float rightPosition[4][4], std::vector<float>& jointPositions)
+    {
+        Matrix left(4,4,false), right(4,4,false);
+        for (int i=0; i<4; i++)
+        {
+            for (int j=0; j<4; j++)
+            {
+                left[i][j] = leftPosition[i][j];
+                right[i][j] = rightPosition[i][j];
+            }
+        }
+        return calculateLegJoints(left, right, jointPositions);
+    }
     virtual bool calculateArmJoints(const Matrix& leftPosition, const Matrix& rightPosition, std::vector<float>& jointPositions)=0;
 };
 
@@ -28,6 +28,12 @@ EndEffector.cpp
 OrientationUKF.cpp
 NUInverseKinematics.h
 NAOInverseKinematics.h
+DarwinLegIK.cpp
+DarwinLegIK.h
+IMUFilter.cpp
+IMUFilter.h
+AttitudeHistory.cpp
+AttitudeHistory.h
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
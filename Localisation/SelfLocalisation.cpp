@@ -336,24 +336,14 @@ void SelfLocalisation::process(NUSensorsData* sensor_data, FieldObjects* fobs, c
     {
         #if LOC_SUMMARY_LEVEL > 0
         m_frame_log << "Observation Update:" << std::endl;
+        const FieldObjectsTable& table = fobs->table();
         int objseen = 0;
-        bool seen;
-        std::vector<StationaryObject>::iterator s_it = fobs->stationaryFieldObjects.begin();
-        while(s_it != fobs->stationaryFieldObjects.end())
+        for (int i=0; i < table.numVisible(); i++)
         {
-            seen = s_it->isObjectVisible();
-            if(seen)
-                ++objseen;
-            ++s_it;
+            if(table.visibleIndex(i) < FieldObjects::NUM_STAT_FIELD_OBJECTS) ++objseen;
         }
         m_frame_log << "Stationary Objects: " << objseen << std::endl;
-
-        objseen = 0;
-        for (unsigned int i=0; i < fobs->mobileFieldObjects.size(); i++)
-        {
-            if(fobs->mobileFieldObjects[i].isObjectVisible()) ++objseen;
-        }
-        m_frame_log << "Mobile Objects: " << objseen << std::endl;
+        m_frame_log << "Mobile Objects: " << table.numVisible() - objseen << std::endl;
         m_frame_log << "Ambiguous Objects: " << fobs->ambiguousFieldObjects.size() << std::endl;
         #endif
 
@@ -402,8 +392,12 @@ void SelfLocalisation::IndividualStationaryObjectUpdate(FieldObjects* fobs, floa
     unsigned int objectsAdded = 0;
     unsigned int totalSuccessfulUpdates = 0;
 
-    BOOST_FOREACH(StationaryObject& currStat, fobs->stationaryFieldObjects)
+    // only the objects vision saw this frame are visited; one may have been hidden since.
+    const FieldObjectsTable& table = fobs->table();
+    for (int i=0; i < table.numVisible(); i++)
     {
+        if(table.visibleIndex(i) >= FieldObjects::NUM_STAT_FIELD_OBJECTS) continue;
+        StationaryObject& currStat = fobs->stationaryFieldObjects[table.visibleIndex(i)];
         if(currStat.isObjectVisible() == false) continue; // Skip objects that were not seen.
 #if CENTER_CIRCLE_ON
         totalSuccessfulUpdates += landmarkUpdate(currStat);
@@ -439,8 +433,10 @@ void SelfLocalisation::IndividualStationaryObjectUpdate(FieldObjects* fobs, floa
             doSingleReset();
         }
         // reapply the updates.
-        BOOST_FOREACH(StationaryObject& currStat, fobs->stationaryFieldObjects)
+        for (int i=0; i < table.numVisible(); i++)
         {
+            if(table.visibleIndex(i) >= FieldObjects::NUM_STAT_FIELD_OBJECTS) continue;
+            StationaryObject& currStat = fobs->stationaryFieldObjects[table.visibleIndex(i)];
             if(currStat.isObjectVisible() == false) continue; // Skip objects that were not seen.
     #if CENTER_CIRCLE_ON
             totalSuccessfulUpdates += landmarkUpdate(currStat);
@@ -23,7 +23,6 @@
 #include "NUHead.h"
 #include "Infrastructure/NUSensorsData/NUSensorsData.h"
 #include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
-#include "Tools/MotionCurves.h"
 #include "Tools/MotionFileTools.h"
 
 #include "Infrastructure/NUBlackboard.h"
@@ -205,7 +204,11 @@ void NUHead::process(HeadNodJob* job, bool currentprovider)
     }
 }
 
-/*! @brief Calculates a motion curve for the given times and positions, then gives the curves to the actionators
+/*! @brief Gives the times and positions to the actionators
+ 
+    The head moves are linear, so the points are given directly to the actionators and the
+    linear interpolation of the hardware layer is used between them.
+ 
     @param times the times in ms for each point on the motion sequence
     @param positions the motion sequence [[roll,pitch,yaw], [roll,pitch,yaw], ...[roll,pitch,yaw]]
  */
@@ -214,14 +217,9 @@ void NUHead::moveTo(const std::vector<double>& times, const std::vector<std::vec
     if (m_data == NULL || m_actions == NULL)
         return;
 
-    std::vector<float> sensorpositions;
-    m_data->getPosition(NUSensorsData::Head, sensorpositions);
-    
-    std::vector<std::vector<double> > curvetimes;
-    std::vector<std::vector<float> > curvepositions;
-    std::vector<std::vector<float> > curvevelocities;
-    MotionCurves::calculate(m_data->CurrentTime, times, sensorpositions, positions, 0.0, 20, curvetimes, curvepositions, curvevelocities);
-    m_actions->add(NUActionatorsData::Head, curvetimes, curvepositions, m_default_gains);
+    size_t numpoints = std::min(times.size(), positions.size());
+    for (size_t i=0; i<numpoints; i++)
+        m_actions->add(NUActionatorsData::Head, times[i], positions[i], m_default_gains);
     
     if (times.size() > 0)
         m_move_end_time = times.back();
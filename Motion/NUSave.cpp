@@ -159,6 +159,11 @@ void NUSave::process(NUSensorsData* data, NUActionatorsData* actions)
 #endif
     if (not isActive() and m_block_time > m_data->CurrentTime)
         playSave();
+    else if (isActive())
+    {
+        m_block_left.process(m_data, m_actions);
+        m_block_right.process(m_data, m_actions);
+    }
 }
 
 void NUSave::playSave()
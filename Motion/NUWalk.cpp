@@ -68,7 +68,7 @@ class NUInverseKinematics;
 NUWalk* NUWalk::getWalkEngine(NUSensorsData* data, NUActionatorsData* actions, NUInverseKinematics* ik)
 {
     #ifdef USE_JWALK
-        return new JWalk();
+        return new JWalk(data, actions);
     #endif
 
     #ifdef USE_BWALK
@@ -122,6 +122,7 @@ NUWalk::NUWalk(NUSensorsData* data, NUActionatorsData* actions) : NUMotionProvid
     m_perturbation_start_time = -1000;
     m_perturbation_magnitude = 0;
     m_perturbation_direction = 0;
+    m_initial_move_completion_time = -100;
 }
 
 /*! @brief Destructor for motion module
@@ -490,10 +491,9 @@ void NUWalk::moveToInitialPosition()
 {
     static const float movespeed = 0.8;
     //static const float movespeed = 0.6;
-    static double movecompletiontime = -100;
-    if (movecompletiontime >= m_current_time)                // if there is already a move happening let it finish
+    if (m_initial_move_completion_time >= m_current_time)                // if there is already a move happening let it finish
         return; 
-    else if (movecompletiontime >= m_current_time - 100)     // if a move has just finished don't start another one, just enable the walk (to avoid infinite loop)
+    else if (m_initial_move_completion_time >= m_current_time - 100)     // if a move has just finished don't start another one, just enable the walk (to avoid infinite loop)
     {
         m_walk_enabled = true;
         setArmEnabled(true, true);
@@ -519,7 +519,7 @@ void NUWalk::moveToInitialPosition()
         double time_rleg = 1000*(maxDifference(sensor_rleg, m_initial_rleg)/movespeed);
         
         // set the move complettion to be the maximum of each limb
-        movecompletiontime = m_current_time + std::max(std::max(time_larm, time_rarm), std::max(time_lleg, time_rleg)) + 100;
+        m_initial_move_completion_time = m_current_time + std::max(std::max(time_larm, time_rarm), std::max(time_lleg, time_rleg)) + 100;
         
         const float c_leg_stiffness = 75.f;
         const float c_arm_stiffness = 20.f;
@@ -56,6 +56,9 @@ public:
     bool requiresHead() {return false;}
     bool requiresArms() {return (m_larm_enabled or m_rarm_enabled);}
     bool requiresLegs() {return true;}
+    /*! @brief Returns false if the walk keeps state outside of the instance (a singleton, a global or a function's statics),
+               so that two instances can not run at the same time. WalkSimulator runs these one at a time. */
+    virtual bool isReentrant() const {return true;}
     
     void process(NUSensorsData* data, NUActionatorsData* actions);
     void process(WalkJob* job, bool currentprovider = false);
@@ -111,6 +114,7 @@ protected:
     std::vector<float> m_initial_rarm;
     std::vector<float> m_initial_lleg;
     std::vector<float> m_initial_rleg;
+    double m_initial_move_completion_time;          //!< the time the current move to the initial position will be completed
 };
 
 #endif
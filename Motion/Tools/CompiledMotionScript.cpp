@@ -0,0 +1,462 @@
+/*! @file CompiledMotionScript.cpp
+    @brief Implementation of a pre-interpolated motion script
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CompiledMotionScript.h"
+
+#include "debug.h"
+#include "debugverbositynumotion.h"
+
+#include <fstream>
+#include <cstring>
+#include <cmath>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*! @brief The header at the start of a .numc file. The joint index and then the segment table follow it directly */
+struct CompiledMotionScriptHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t numjoints;
+    uint32_t numsegments;
+    float smoothness;
+    int32_t cycletime;
+};
+
+static const char COMPILED_SCRIPT_MAGIC[4] = {'N', 'U', 'M', 'C'};
+static const uint32_t COMPILED_SCRIPT_VERSION = 1;
+
+static float calculateAvgVelocity(float starttime, float stoptime, float startposition, float stopposition)
+{
+    if (fabs(starttime - stoptime) > 0.01)
+        return (stopposition - startposition)/(stoptime - starttime);
+    else
+        return (stopposition - startposition)/0.01;
+}
+
+CompiledMotionScript::CompiledMotionScript()
+{
+    m_mapped = NULL;
+    m_mapped_size = 0;
+    m_joints = NULL;
+    m_num_joints = 0;
+    m_segments = NULL;
+    m_num_segments = 0;
+    m_smoothness = 0;
+    m_cycle_time = 10;
+    m_start_time = 0;
+    m_play_speed = 1;
+}
+
+CompiledMotionScript::CompiledMotionScript(const CompiledMotionScript& other)
+{
+    m_mapped = NULL;
+    m_mapped_size = 0;
+    m_joints = NULL;
+    m_num_joints = 0;
+    m_segments = NULL;
+    m_num_segments = 0;
+    *this = other;
+}
+
+CompiledMotionScript::~CompiledMotionScript()
+{
+    clear();
+}
+
+/*! @brief Copies the tables of another script. A mapped script is copied into memory */
+CompiledMotionScript& CompiledMotionScript::operator=(const CompiledMotionScript& other)
+{
+    if (this == &other)
+        return *this;
+    clear();
+    m_smoothness = other.m_smoothness;
+    m_cycle_time = other.m_cycle_time;
+    m_start_time = other.m_start_time;
+    m_play_speed = other.m_play_speed;
+    if (other.isValid())
+    {
+        m_joint_storage.assign(other.m_joints, other.m_joints + other.m_num_joints);
+        m_segment_storage.assign(other.m_segments, other.m_segments + other.m_num_segments);
+        setTables(m_joint_storage.empty() ? NULL : &m_joint_storage[0], m_joint_storage.size(), m_segment_storage.empty() ? NULL : &m_segment_storage[0], m_segment_storage.size());
+    }
+    return *this;
+}
+
+/*! @brief Returns true if the script has been compiled or loaded */
+bool CompiledMotionScript::isValid() const
+{
+    return m_joints != NULL;
+}
+
+/*! @brief Returns the number of joints (columns) in the script */
+size_t CompiledMotionScript::size() const
+{
+    return m_num_joints;
+}
+
+/*! @brief Returns true if the script has any keyframes for the given joint */
+bool CompiledMotionScript::uses(size_t joint) const
+{
+    return joint < m_num_joints and m_joints[joint].firsttime >= 0;
+}
+
+void CompiledMotionScript::clear()
+{
+    if (m_mapped)
+        munmap(m_mapped, m_mapped_size);
+    m_mapped = NULL;
+    m_mapped_size = 0;
+    m_joint_storage.clear();
+    m_segment_storage.clear();
+    m_joints = NULL;
+    m_num_joints = 0;
+    m_segments = NULL;
+    m_num_segments = 0;
+}
+
+void CompiledMotionScript::setTables(const Joint* joints, size_t numjoints, const Segment* segments, size_t numsegments)
+{
+    m_joints = joints;
+    m_num_joints = numjoints;
+    m_segments = segments;
+    m_num_segments = numsegments;
+
+    Playback empty;
+    memset(&empty, 0, sizeof(empty));
+    m_playback.assign(numjoints, empty);
+}
+
+/*! @brief Compiles the keyframes of a script into the segment table
+    @param times the keyframe times in ms for each joint [[time0, time1, ...], [time0, time1, ...], ...]
+    @param positions the keyframe positions for each joint
+    @param gains the keyframe gains for each joint
+    @param smoothness a fraction indicating the smoothness of the motion: 0 means linear motion curve, 1 minimises the acceleration and jerk
+    @param cycletime the motion cycle time in ms, curves shorter than 8 cycles are left linear
+    @return true if the script was compiled
+ */
+bool CompiledMotionScript::compile(const std::vector<std::vector<double> >& times, const std::vector<std::vector<float> >& positions, const std::vector<std::vector<float> >& gains, float smoothness, int cycletime)
+{
+    clear();
+    if (positions.size() != times.size() or gains.size() != times.size())
+    {
+        errorlog << "CompiledMotionScript::compile(). The times, positions and gains have a different number of joints" << std::endl;
+        return false;
+    }
+    m_smoothness = smoothness;
+    m_cycle_time = cycletime;
+
+    size_t numsegments = 0;
+    for (size_t i=0; i<times.size(); i++)
+        numsegments += 3*times[i].size();
+    m_segment_storage.reserve(numsegments);
+    m_joint_storage.resize(times.size());
+
+    Segment segments[3];
+    for (size_t i=0; i<times.size(); i++)
+    {
+        const std::vector<double>& t = times[i];
+        const std::vector<float>& p = positions[i];
+        const std::vector<float>& g = gains[i];
+        Joint& joint = m_joint_storage[i];
+        joint.first = m_segment_storage.size();
+        joint.count = 0;
+        if (t.empty() or p.size() < t.size() or g.size() < t.size())
+        {   // the joint is not used by the script
+            joint.firsttime = -1;
+            joint.firstposition = joint.firstvelocity = joint.firstgain = 0;
+            joint.lasttime = joint.lastposition = joint.lastgain = 0;
+            continue;
+        }
+
+        size_t n = t.size();
+        joint.firsttime = t[0];
+        joint.firstposition = p[0];
+        joint.firstgain = g[0];
+        joint.lasttime = t[n-1];
+        joint.lastposition = p[n-1];
+        joint.lastgain = g[n-1];
+        // the first keyframe's velocity is calculated as though the robot is already at the first keyframe,
+        // so that it doesn't depend on where the script is started from
+        joint.firstvelocity = (n > 1) ? 0.5*calculateAvgVelocity(t[0], t[1], p[0], p[1]) : 0;
+
+        float velocity = joint.firstvelocity;
+        for (size_t k=1; k<n; k++)
+        {
+            float finalvelocity = 0;
+            if (k < n-1)
+                finalvelocity = 0.5*(calculateAvgVelocity(t[k-1], t[k], p[k-1], p[k]) + calculateAvgVelocity(t[k], t[k+1], p[k], p[k+1]));
+            int count = calculateSegments(t[k-1], t[k], p[k-1], p[k], velocity, finalvelocity, g[k], smoothness, cycletime, segments, velocity);
+            m_segment_storage.insert(m_segment_storage.end(), segments, segments + count);
+            joint.count += count;
+        }
+    }
+
+    setTables(m_joint_storage.empty() ? NULL : &m_joint_storage[0], m_joint_storage.size(), m_segment_storage.empty() ? NULL : &m_segment_storage[0], m_segment_storage.size());
+    return true;
+}
+
+/*! @brief Saves the compiled script so that it can be mapped with load()
+    @param filename the name of the .numc file
+ */
+bool CompiledMotionScript::save(const std::string& filename) const
+{
+    if (not isValid())
+        return false;
+
+    std::ofstream file(filename.c_str(), std::ios_base::binary | std::ios_base::trunc);
+    if (not file.is_open())
+    {
+        errorlog << "CompiledMotionScript::save(). Unable to open " << filename << std::endl;
+        return false;
+    }
+
+    CompiledMotionScriptHeader header;
+    memcpy(header.magic, COMPILED_SCRIPT_MAGIC, sizeof(header.magic));
+    header.version = COMPILED_SCRIPT_VERSION;
+    header.numjoints = m_num_joints;
+    header.numsegments = m_num_segments;
+    header.smoothness = m_smoothness;
+    header.cycletime = m_cycle_time;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_joints), m_num_joints*sizeof(Joint));
+    if (m_num_segments > 0)
+        file.write(reinterpret_cast<const char*>(m_segments), m_num_segments*sizeof(Segment));
+    return file.good();
+}
+
+/*! @brief Maps a compiled script saved with save(). The tables are used directly from the mapping.
+    @param filename the name of the .numc file
+ */
+bool CompiledMotionScript::load(const std::string& filename)
+{
+    clear();
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 or static_cast<size_t>(info.st_size) < sizeof(CompiledMotionScriptHeader))
+    {
+        close(fd);
+        errorlog << "CompiledMotionScript::load(). " << filename << " is too short" << std::endl;
+        return false;
+    }
+
+    void* mapped = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        errorlog << "CompiledMotionScript::load(). Unable to map " << filename << std::endl;
+        return false;
+    }
+    m_mapped = mapped;
+    m_mapped_size = info.st_size;
+
+    const CompiledMotionScriptHeader* header = static_cast<const CompiledMotionScriptHeader*>(mapped);
+    size_t expectedsize = sizeof(CompiledMotionScriptHeader) + header->numjoints*sizeof(Joint) + header->numsegments*sizeof(Segment);
+    if (memcmp(header->magic, COMPILED_SCRIPT_MAGIC, sizeof(header->magic)) != 0 or header->version != COMPILED_SCRIPT_VERSION or expectedsize != m_mapped_size)
+    {
+        errorlog << "CompiledMotionScript::load(). " << filename << " is not a valid compiled script" << std::endl;
+        clear();
+        return false;
+    }
+
+    const char* data = static_cast<const char*>(mapped) + sizeof(CompiledMotionScriptHeader);
+    const Joint* joints = reinterpret_cast<const Joint*>(data);
+    const Segment* segments = reinterpret_cast<const Segment*>(data + header->numjoints*sizeof(Joint));
+    for (size_t i=0; i<header->numjoints; i++)
+    {
+        if (joints[i].first < 0 or joints[i].count < 0 or static_cast<size_t>(joints[i].first + joints[i].count) > header->numsegments)
+        {
+            errorlog << "CompiledMotionScript::load(). " << filename << " has an invalid segment index" << std::endl;
+            clear();
+            return false;
+        }
+    }
+    m_smoothness = header->smoothness;
+    m_cycle_time = header->cycletime;
+    setTables(joints, header->numjoints, header->numsegments > 0 ? segments : NULL, header->numsegments);
+    return true;
+}
+
+/*! @brief Prepares the script to be played from the current position of the joints
+    @param starttime the time in ms the script starts
+    @param playspeed the play speed (1 = normal speed)
+    @param startpositions the current position of each joint in the script
+ */
+void CompiledMotionScript::start(double starttime, float playspeed, const std::vector<float>& startpositions)
+{
+    m_start_time = starttime;
+    m_play_speed = playspeed;
+    for (size_t i=0; i<m_num_joints; i++)
+    {
+        Playback& playback = m_playback[i];
+        const Joint& joint = m_joints[i];
+        playback.cursor = joint.first;
+        playback.numleadin = 0;
+        playback.numback = 0;
+        if (not uses(i) or i >= startpositions.size())
+            continue;
+
+        float finalvelocity = (joint.count > 0) ? joint.firstvelocity : 0;
+        float velocity;
+        playback.numleadin = calculateSegments(0, joint.firsttime, startpositions[i], joint.firstposition, 0, finalvelocity, joint.firstgain, m_smoothness, m_cycle_time, playback.leadin, velocity);
+    }
+}
+
+/*! @brief Adds a move from the last keyframe back to the given position
+    @param joint the index of the joint
+    @param position the position to return to
+    @param stoptime the time in ms to reach the position
+ */
+void CompiledMotionScript::setReturn(size_t joint, float position, double stoptime)
+{
+    if (not uses(joint))
+        return;
+    const Joint& j = m_joints[joint];
+    float stop = (stoptime - m_start_time)*m_play_speed;
+    float velocity;
+    m_playback[joint].numback = calculateSegments(j.lasttime, stop, j.lastposition, position, 0, 0, j.lastgain, m_smoothness, m_cycle_time, m_playback[joint].back, velocity);
+}
+
+/*! @brief Evaluates the script for a joint at the given time
+    @param joint the index of the joint
+    @param time the time in ms
+    @param position will be updated with the joint position at that time
+    @param gain will be updated with the joint gain at that time
+    @return false if the script does not use the joint
+ */
+bool CompiledMotionScript::evaluate(size_t joint, double time, float& position, float& gain)
+{
+    if (not uses(joint))
+        return false;
+
+    const Joint& j = m_joints[joint];
+    Playback& playback = m_playback[joint];
+    float t = (time - m_start_time)*m_play_speed;
+
+    const Segment* segment;
+    if (t < j.firsttime and playback.numleadin > 0)
+    {
+        int i = 0;
+        while (i < playback.numleadin - 1 and playback.leadin[i].end < t)
+            i++;
+        segment = &playback.leadin[i];
+    }
+    else if (t <= j.lasttime and j.count > 0)
+    {
+        size_t last = j.first + j.count - 1;
+        if (playback.cursor < static_cast<size_t>(j.first) or playback.cursor > last or m_segments[playback.cursor].start > t)
+            playback.cursor = j.first;
+        while (playback.cursor < last and m_segments[playback.cursor].end < t)
+            playback.cursor++;
+        segment = &m_segments[playback.cursor];
+    }
+    else if (t > j.lasttime and playback.numback > 0)
+    {
+        int i = 0;
+        while (i < playback.numback - 1 and playback.back[i].end < t)
+            i++;
+        segment = &playback.back[i];
+    }
+    else
+    {
+        position = j.lastposition;
+        gain = j.lastgain;
+        return true;
+    }
+
+    position = evaluate(*segment, t);
+    gain = segment->gain;
+    return true;
+}
+
+float CompiledMotionScript::evaluate(const Segment& segment, float t)
+{
+    if (t < segment.start)
+        t = segment.start;
+    else if (t > segment.end)
+        t = segment.end;
+    float dt = t - segment.start;
+    return segment.c0 + dt*(segment.c1 + dt*segment.c2);
+}
+
+/*! @brief Calculates the segments of a trapezoidal velocity curve. This is the piecewise form of MotionCurves::calculateTrapezoidalCurve
+    @param segments will be updated with the segments; there must be room for three
+    @param finalvelocity will be updated with the velocity at the end of the curve
+    @return the number of segments used
+ */
+int CompiledMotionScript::calculateSegments(float starttime, float stoptime, float startposition, float stopposition, float startvelocity, float stopvelocity, float gain, float smoothness, int cycletime, Segment* segments, float& finalvelocity)
+{
+    if (smoothness < 0)
+        smoothness = - smoothness;
+    if (smoothness > 1)
+        smoothness = 1;
+
+    float g0 = startposition;
+    float gf = stopposition;
+    float v0 = startvelocity;
+    float vf = stopvelocity;
+
+    // if the time is short or the movement is small or the smoothness is low, the curve is just linear
+    if (stoptime - starttime < 8*cycletime || fabs(g0 - gf) < 0.05 || smoothness < 0.05)
+    {
+        finalvelocity = calculateAvgVelocity(starttime, stoptime, g0, gf);
+        segments[0].start = starttime;
+        segments[0].end = stoptime;
+        segments[0].c0 = g0;
+        segments[0].c1 = finalvelocity;
+        segments[0].c2 = 0;
+        segments[0].gain = gain;
+        return 1;
+    }
+
+    // work relative to the start of the curve
+    float t1 = 0.5*smoothness*(stoptime - starttime);
+    float t2 = (stoptime - starttime)*(1 - 0.5*smoothness);
+    float tf = stoptime - starttime;
+
+    // Calculate the required acceleration magnitudes
+    float Af = 2*(gf - g0 - vf*tf + 0.5*t1*(vf - v0))/(t2*t2 - tf*tf - t1*(t2 - tf));
+    float As = (vf - v0 - Af*tf + Af*t2)/t1;
+    float v1 = As*t1 + v0;
+
+    segments[0].start = starttime;
+    segments[0].end = starttime + t1;
+    segments[0].c0 = g0;
+    segments[0].c1 = v0;
+    segments[0].c2 = 0.5*As;
+
+    segments[1].start = segments[0].end;
+    segments[1].end = starttime + t2;
+    segments[1].c0 = g0 + v0*t1 + 0.5*As*t1*t1;
+    segments[1].c1 = v1;
+    segments[1].c2 = 0;
+
+    segments[2].start = segments[1].end;
+    segments[2].end = stoptime;
+    segments[2].c0 = segments[1].c0 + v1*(t2 - t1);
+    segments[2].c1 = v1;
+    segments[2].c2 = 0.5*Af;
+
+    segments[0].gain = segments[1].gain = segments[2].gain = gain;
+    finalvelocity = vf;
+    return 3;
+}
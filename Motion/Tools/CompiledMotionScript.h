@@ -0,0 +1,115 @@
+/*! @file CompiledMotionScript.h
+    @brief Declaration of a pre-interpolated motion script
+
+    @class CompiledMotionScript
+    @brief A motion script compiled into per-joint tables of curve segments
+
+    The keyframes of a script are turned into the same trapezoidal velocity curves that
+    MotionCurves produces, but instead of sampling them every cycle up front each curve is
+    stored as (at most three) quadratic segments. All segments for all joints are kept in a
+    single contiguous table, which can be saved to and mapped back from a .numc file.
+
+    Only the move from the current position to the first keyframe, and the optional return
+    to the start position, depend on the robot's state when the script is played. These are
+    calculated in start() into a small fixed slot per joint, so playing a script costs
+    O(joints) and each cycle only evaluates the current segment of each joint.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMPILEDMOTIONSCRIPT_H
+#define COMPILEDMOTIONSCRIPT_H
+
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+class CompiledMotionScript
+{
+public:
+    /*! @brief A single piece of a motion curve, p(t) = c0 + c1*(t - start) + c2*(t - start)^2 */
+    struct Segment
+    {
+        float start;                //!< the script relative time in ms the segment starts
+        float end;                  //!< the script relative time in ms the segment ends
+        float c0, c1, c2;           //!< the polynomial coefficients
+        float gain;                 //!< the gain to use over the segment
+    };
+
+    /*! @brief The index into the segment table for a single joint */
+    struct Joint
+    {
+        int32_t first;              //!< the index of the joint's first segment in the table
+        int32_t count;              //!< the number of segments belonging to the joint
+        float firsttime;            //!< the time in ms of the first keyframe
+        float firstposition;        //!< the position of the first keyframe
+        float firstvelocity;        //!< the velocity the curve has at the first keyframe
+        float firstgain;            //!< the gain at the first keyframe
+        float lasttime;             //!< the time in ms of the last keyframe
+        float lastposition;         //!< the position of the last keyframe
+        float lastgain;             //!< the gain of the last keyframe
+    };
+public:
+    CompiledMotionScript();
+    CompiledMotionScript(const CompiledMotionScript& other);
+    ~CompiledMotionScript();
+    CompiledMotionScript& operator=(const CompiledMotionScript& other);
+
+    bool compile(const std::vector<std::vector<double> >& times, const std::vector<std::vector<float> >& positions, const std::vector<std::vector<float> >& gains, float smoothness, int cycletime);
+    bool save(const std::string& filename) const;
+    bool load(const std::string& filename);
+
+    bool isValid() const;
+    size_t size() const;
+    bool uses(size_t joint) const;
+
+    void start(double starttime, float playspeed, const std::vector<float>& startpositions);
+    void setReturn(size_t joint, float position, double stoptime);
+    bool evaluate(size_t joint, double time, float& position, float& gain);
+
+    static int calculateSegments(float starttime, float stoptime, float startposition, float stopposition, float startvelocity, float stopvelocity, float gain, float smoothness, int cycletime, Segment* segments, float& finalvelocity);
+private:
+    void clear();
+    void setTables(const Joint* joints, size_t numjoints, const Segment* segments, size_t numsegments);
+    static float evaluate(const Segment& segment, float t);
+private:
+    /*! @brief The per joint playback state. The runtime segments are fixed size, so start() never allocates */
+    struct Playback
+    {
+        size_t cursor;              //!< the index of the segment last evaluated
+        Segment leadin[3];          //!< the move from the start position to the first keyframe
+        int numleadin;
+        Segment back[3];            //!< the move from the last keyframe back to the start position
+        int numback;
+    };
+
+    std::vector<Joint> m_joint_storage;         //!< the joint index when the script was compiled in memory
+    std::vector<Segment> m_segment_storage;     //!< the segment table when the script was compiled in memory
+    void* m_mapped;                             //!< the mapped .numc file, if the script was loaded from disk
+    size_t m_mapped_size;
+
+    const Joint* m_joints;                      //!< the joint index (either in the storage or the mapped file)
+    size_t m_num_joints;
+    const Segment* m_segments;                  //!< the segment table (either in the storage or the mapped file)
+    size_t m_num_segments;
+
+    float m_smoothness;
+    int m_cycle_time;
+
+    std::vector<Playback> m_playback;
+    double m_start_time;
+    float m_play_speed;
+};
+
+#endif
@@ -22,7 +22,6 @@
 #include "MotionScript.h"
 #include "MotionFileTools.h"
 #include "Tools/Math/StlVector.h"
-#include "MotionCurves.h"
 
 #include "Infrastructure/NUSensorsData/NUSensorsData.h"
 #include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
@@ -34,12 +33,15 @@
 
 #include <sstream>
 #include <cmath>
+#include <algorithm>
+#include <sys/stat.h>
 
 MotionScript::MotionScript()
 {
     m_is_valid = false;
     setUses();
     m_play_start_time = 0;
+    m_last_process_time = 0;
 }
 
 MotionScript::MotionScript(std::string filename)
@@ -48,6 +50,7 @@ MotionScript::MotionScript(std::string filename)
     m_is_valid = load();
 	setUses();
     m_play_start_time = 0;
+    m_last_process_time = 0;
 }
 
 std::string& MotionScript::getName()
@@ -158,12 +161,17 @@ void MotionScript::setPlaySpeed(float speed)
     m_playspeed = speed;
 }
 
+/*! @brief Starts playing the script from the current position of the joints. The setpoints are given to the
+           actionators one cycle at a time by process(), which the caller must call every cycle until the
+           script has finished. The script starts at the current time (there is no longer a 100ms head start,
+           because nothing needs to be calculated ahead of the first setpoint).
+ */
 void MotionScript::play(NUSensorsData* data, NUActionatorsData* actions)
 {
     if (not m_is_valid)
         return;
     
-    m_play_start_time = data->CurrentTime + 100;        // I add 100ms here because it can take upto 100ms to calculate a long and detailed motion curve
+    m_play_start_time = data->CurrentTime;
     vector<vector<double> > times = m_times;
     for (size_t i=0; i<times.size(); i++)
         for (size_t j=0; j<times[i].size(); j++)
@@ -176,8 +184,15 @@ void MotionScript::play(NUSensorsData* data, NUActionatorsData* actions)
     
     updateLastUses(times);
     
-    MotionCurves::calculate(m_play_start_time, times, sensorpositions, m_positions, m_gains, m_smoothness, 10, m_curvetimes, m_curvepositions, m_curvevelocities, m_curvegains);
-    actions->add(NUActionatorsData::All, m_curvetimes, m_curvepositions, m_curvegains);
+    m_compiled.start(m_play_start_time, m_playspeed, sensorpositions);
+    if (m_return_to_start)
+    {
+        for (size_t i=0; i<times.size(); i++)
+            if (not times[i].empty())
+                m_compiled.setReturn(i, m_positions[i].back(), times[i].back());
+    }
+    m_last_process_time = 0;
+    process(data, actions);
     
     #if DEBUG_NUMOTION_VERBOSITY > 0
         debug << "MotionScript::play. Playing " << m_name << ". It uses ";
@@ -193,18 +208,39 @@ void MotionScript::play(NUSensorsData* data, NUActionatorsData* actions)
             debug << "RLeg until " << timeFinishedWithRLeg() << ", ";
         debug << "runs from " << m_play_start_time << " to " << timeFinished() << std::endl;
     #endif
+}
+
+/*! @brief Gives the actionators the setpoints for the next motion cycle while the script is playing.
     
-    #if DEBUG_NUMOTION_VERBOSITY > 1
-        debug << MotionFileTools::fromMatrix(m_curvetimes) << std::endl;
-        debug << MotionFileTools::fromMatrix(m_curvepositions) << std::endl;
-        debug << MotionFileTools::fromMatrix(m_curvevelocities) << std::endl;
-        debug << MotionFileTools::fromMatrix(m_curvegains) << std::endl;
-    #endif
+    Each joint is given a single point one cycle ahead of the current time. The cycle time is
+    measured from successive calls so the script plays correctly at any motion rate.
+ */
+void MotionScript::process(NUSensorsData* data, NUActionatorsData* actions)
+{
+    if (not m_is_valid or m_play_start_time <= 0)
+        return;
+    
+    double currenttime = data->CurrentTime;
+    double cycletime = 10;
+    if (m_last_process_time > 0 and currenttime > m_last_process_time)
+        cycletime = std::min(currenttime - m_last_process_time, 100.0);
+    if (currenttime - cycletime > m_uses_last)
+        return;
+    m_last_process_time = currenttime;
+    
+    double time = currenttime + cycletime;
+    float position, gain;
+    for (size_t i=0; i<m_compiled.size(); i++)
+    {
+        if (m_compiled.evaluate(i, time, position, gain))
+            actions->add(NUActionatorsData::All, i, time, position, gain);
+    }
 }
 
 bool MotionScript::load()
 {
-    std::ifstream file((CONFIG_DIR + "Motion/Scripts/" + m_name + ".num").c_str());
+    std::string sourcename = CONFIG_DIR + "Motion/Scripts/" + m_name + ".num";
+    std::ifstream file(sourcename.c_str());
     if (!file.is_open())
     {
         errorlog << "MotionScript::load(). Unable to open " << m_name << std::endl;
@@ -262,6 +298,14 @@ bool MotionScript::load()
         }
         file.close();
         
+        // the script is compiled once, then mapped from the .numc file until the .num is changed
+        std::string compiledname = CONFIG_DIR + "Motion/Scripts/" + m_name + ".numc";
+        if (not loadCompiled(sourcename, compiledname, numjoints))
+        {
+            m_compiled.compile(m_times, m_positions, m_gains, m_smoothness, 10);
+            m_compiled.save(compiledname);
+        }
+        
         if (m_return_to_start)
         {   // Now a bit of hackery. When we want to return to start we need to add the placeholders for the return move
             for (size_t i=0; i<m_times.size(); i++)
@@ -278,6 +322,28 @@ bool MotionScript::load()
     }
 }
 
+/*! @brief Maps the compiled script if it is up to date
+    @param sourcename the name of the .num file
+    @param compiledname the name of the .numc file
+    @param numjoints the number of joints in the .num file
+    @return true if the compiled script was loaded, false if it needs to be compiled again
+ */
+bool MotionScript::loadCompiled(const std::string& sourcename, const std::string& compiledname, size_t numjoints)
+{
+    struct stat source, compiled;
+    if (stat(sourcename.c_str(), &source) != 0 or stat(compiledname.c_str(), &compiled) != 0)
+        return false;
+    if (compiled.st_mtime < source.st_mtime)
+        return false;
+    
+    if (not m_compiled.load(compiledname) or m_compiled.size() != numjoints)
+        return false;
+    #if DEBUG_NUMOTION_VERBOSITY > 0
+        debug << "MotionScript::loadCompiled(). Mapped " << compiledname << std::endl;
+    #endif
+    return true;
+}
+
 /*! @brief Sets all of the variables to keep track of when a script requires each limb.
  */
 void MotionScript::setUses()
@@ -11,6 +11,9 @@
            interpolation of the hardware layer is used.
         3. Joints that have no entries in the .num file can be used by other modules/scripts
         4. The play speed can be specified online with setPlaySpeed
+        5. The script is compiled into curve segments when it is loaded. play() only
+           starts the script; process() must then be called every motion cycle to give
+           the actionators the setpoints for that cycle.
  
     TODO:
         1. 'Conditions'. In particular premature exit of the script
@@ -37,6 +40,7 @@
 #define MOTIONSCRIPT_H
 
 #include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
+#include "CompiledMotionScript.h"
 class NUSensorsData;
 
 #include <string>
@@ -50,6 +54,7 @@ public:
     ~MotionScript();
     
     void play(NUSensorsData* data, NUActionatorsData* actions);
+    void process(NUSensorsData* data, NUActionatorsData* actions);
     void setPlaySpeed(float speed);
     
     bool isValid();
@@ -76,6 +81,7 @@ public:
     std::vector<std::vector<float> > m_gains;      		//!< the gains read in from the script file
 protected:
     bool load();
+    bool loadCompiled(const std::string& sourcename, const std::string& compiledname, size_t numjoints);
     void setUses();
     bool checkIfUses(const std::vector<int>& ids);
     void updateLastUses(const std::vector<std::vector<double> >& times);
@@ -119,11 +125,9 @@ protected:
     float m_smoothness;                  		//!< the smoothness loaded from the script file
     bool m_return_to_start;              		//!< a flag to specify whether the script should return to the position when the script started playing
     
-    // smoothed script data
-    std::vector<std::vector<double> > m_curvetimes;		//!< the times to be given to the actionators
-    std::vector<std::vector<float> > m_curvepositions;	//!< the positions to be given to the actionators
-    std::vector<std::vector<float> > m_curvevelocities;	//!< the velocities
-    std::vector<std::vector<float> > m_curvegains;		//!< the gains to be given to the actionators
+    // compiled script data
+    CompiledMotionScript m_compiled;            		//!< the script compiled into curve segments
+    double m_last_process_time;                 		//!< the time in ms process() was last called
 };
 
 #endif
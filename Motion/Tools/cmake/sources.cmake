@@ -20,7 +20,8 @@ IF(DEBUG)
 ENDIF()
 
 ########## List your source files here! ############################################
-SET (YOUR_SRCS  MotionCurves.cpp MotionCurves.h
+SET (YOUR_SRCS  CompiledMotionScript.cpp CompiledMotionScript.h
+                MotionCurves.cpp MotionCurves.h
                 MotionFileTools.cpp MotionFileTools.h
                 MotionScript.cpp MotionScript.h
                 PIDController.cpp PIDController.h
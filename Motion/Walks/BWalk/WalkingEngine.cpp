@@ -250,6 +250,7 @@ void WalkingEngine::init()
   nu_nextRightArmJoints.resize(m_actions->getSize(NUActionatorsData::RArm), 0.0f);  // Right Arm
   nu_nextLeftLegJoints.resize(m_actions->getSize(NUActionatorsData::LLeg), 0.0f);   // Left Leg
   nu_nextRightLegJoints.resize(m_actions->getSize(NUActionatorsData::RLeg), 0.0f);  // Right Leg
+  m_joint_positions.resize(m_actions->getSize(NUActionatorsData::All), 0.0f);       // Measured joints
 }
 
 void WalkingEngine::setWalkParameters(const WalkParameters& walkparameters)
@@ -381,15 +382,13 @@ void WalkingEngine::writeParameters()
 
 void WalkingEngine::doWalk()
 {
-    static std::vector<float> joints(m_actions->getSize(NUActionatorsData::All), 0.0f);
-
 //    m_cycle_time = 0.001 * (m_data->CurrentTime - m_prev_time);
 //    m_prev_time = m_data->CurrentTime;
     m_cycle_time = 0.02; // time in seconds.
-    bool validJoints = m_data->getPosition(NUSensorsData::All, joints);
+    bool validJoints = m_data->getPosition(NUSensorsData::All, m_joint_positions);
     if(validJoints)
     {
-        theRobotModel.setJointData(joints, theMassCalibration);
+        theRobotModel.setJointData(m_joint_positions, theMassCalibration);
         update();
     }
     else
@@ -917,7 +916,9 @@ void WalkingEngine::generateJointRequest()
   Pose3D bodyToLeftAnkle(comToLeftAnkle.rotation, bodyToCom + comToLeftAnkle.translation);
 
   Pose3D bodyToRightAnkle(comToRightAnkle.rotation, bodyToCom + comToRightAnkle.translation);
-  bool reachable = m_ik->calculateLegJoints(Pose2Matrix(bodyToLeftAnkle), Pose2Matrix(bodyToRightAnkle), joint_positions);
+  Pose2Transform(bodyToLeftAnkle, m_left_transform);
+  Pose2Transform(bodyToRightAnkle, m_right_transform);
+  bool reachable = m_ik->calculateLegJoints(m_left_transform, m_right_transform, joint_positions);
 
   for(int i = 0; i < 7; ++i)
   {
@@ -951,7 +952,9 @@ void WalkingEngine::generateJointRequest()
     bodyToLeftAnkle.translation = bodyToCom + comToLeftAnkle.translation;
     bodyToRightAnkle.translation = bodyToCom + comToRightAnkle.translation;
 
-    reachable = m_ik->calculateLegJoints(Pose2Matrix(bodyToLeftAnkle), Pose2Matrix(bodyToRightAnkle), joint_positions);
+    Pose2Transform(bodyToLeftAnkle, m_left_transform);
+    Pose2Transform(bodyToRightAnkle, m_right_transform);
+    reachable = m_ik->calculateLegJoints(m_left_transform, m_right_transform, joint_positions);
     RobotModel robotModel(joint_positions, theMassCalibration);
 
     if(std::abs(bodyToComOffset.x) < 0.05 && std::abs(bodyToComOffset.y) < 0.05 && std::abs(bodyToComOffset.z) < 0.05)
@@ -1023,8 +1026,8 @@ void WalkingEngine::generateOutput(/*WalkingEngineOutput& walkingEngineOutput*/)
 
     float default_arm_stifness = 30.0f;
     // Set the arm positions.
-    m_actions->add(NUActionatorsData::RArm, Platform->getTime(), nu_nextRightArmJoints, default_arm_stifness);
-    m_actions->add(NUActionatorsData::LArm, Platform->getTime(), nu_nextLeftArmJoints, default_arm_stifness);
+    m_actions->add(NUActionatorsData::RArm, m_current_time, nu_nextRightArmJoints, default_arm_stifness);
+    m_actions->add(NUActionatorsData::LArm, m_current_time, nu_nextLeftArmJoints, default_arm_stifness);
 
     float default_leg_stifness = 75.0f;
 
@@ -1036,8 +1039,10 @@ void WalkingEngine::generateOutput(/*WalkingEngineOutput& walkingEngineOutput*/)
 
     // Set the leg positions.
     std::vector<float> legstiffness(m_actions->getSize(NUActionatorsData::LLeg), default_leg_stifness);
-    legstiffness[5] = p.standHardnessAnkleRoll;
-    legstiffness[6] = p.standHardnessAnklePitch;
+    const unsigned int ankle_roll_index = 4;        // HipRoll, HipPitch, HipYaw, KneePitch, AnkleRoll, AnklePitch
+    const unsigned int ankle_pitch_index = 5;
+    legstiffness[ankle_roll_index] = p.standHardnessAnkleRoll;
+    legstiffness[ankle_pitch_index] = p.standHardnessAnklePitch;
 
     m_actions->add(NUActionatorsData::RLeg, 0, nu_nextRightLegJoints, legstiffness);
     m_actions->add(NUActionatorsData::LLeg, 0, nu_nextLeftLegJoints, legstiffness);
@@ -2149,3 +2154,26 @@ Matrix WalkingEngine::Pose2Matrix(const Pose3D& pose)
 
     return result;
 }
+
+void WalkingEngine::Pose2Transform(const Pose3D& pose, float transform[4][4])
+{
+    transform[0][0] = pose.rotation.c0.x;
+    transform[1][0] = pose.rotation.c0.y;
+    transform[2][0] = pose.rotation.c0.z;
+    transform[3][0] = 0;
+
+    transform[0][1] = pose.rotation.c1.x;
+    transform[1][1] = pose.rotation.c1.y;
+    transform[2][1] = pose.rotation.c1.z;
+    transform[3][1] = 0;
+
+    transform[0][2] = pose.rotation.c2.x;
+    transform[1][2] = pose.rotation.c2.y;
+    transform[2][2] = pose.rotation.c2.z;
+    transform[3][2] = 0;
+
+    transform[0][3] = pose.translation.x;
+    transform[1][3] = pose.translation.y;
+    transform[2][3] = pose.translation.z;
+    transform[3][3] = 1;
+}
@@ -50,6 +50,7 @@ private:
   std::vector<float> nu_nextRightArmJoints;  // Right Arm
   std::vector<float> nu_nextLeftLegJoints;   // Left Leg
   std::vector<float> nu_nextRightLegJoints;  // Right Leg
+  std::vector<float> m_joint_positions;      // the measured joint positions
 
   class PIDCorrector
   {
@@ -358,7 +359,7 @@ private:
     float t; /**< current time */
     PendulumParameters next;
 
-    PendulumPlayer() : walkingEngine(0), active(false) {}
+    PendulumPlayer() : walkingEngine(0), supportLeg(left), active(false), launching(false), t(0.f) {}
 
     void seek(float deltaT);
     inline bool isActive() const {return active;}
@@ -502,4 +503,7 @@ private:
   bool upcomingOdometryOffsetValid;
 
   Matrix Pose2Matrix(const Pose3D& pose);
+  void Pose2Transform(const Pose3D& pose, float transform[4][4]);
+  float m_left_transform[4][4];
+  float m_right_transform[4][4];
 };
@@ -285,13 +285,13 @@ void DarwinWalk::updateActionatorsData()
     nu_nextRightLegJoints.assign(joints.begin()+14, joints.begin()+20);
 
     //UPDATE ARMS:
-    static std::vector<std::vector<float> >& armgains = m_walk_parameters.getArmGains();
-    m_actions->add(NUActionatorsData::RArm, Platform->getTime(), nu_nextRightArmJoints, armgains[0]);
-    m_actions->add(NUActionatorsData::LArm, Platform->getTime(), nu_nextLeftArmJoints, armgains[0]);
+    std::vector<std::vector<float> >& armgains = m_walk_parameters.getArmGains();
+    m_actions->add(NUActionatorsData::RArm, m_current_time, nu_nextRightArmJoints, armgains[0]);
+    m_actions->add(NUActionatorsData::LArm, m_current_time, nu_nextLeftArmJoints, armgains[0]);
 
     //UPDATE LEGS:
-    static std::vector<std::vector<float> >& leggains = m_walk_parameters.getLegGains();
-    m_actions->add(NUActionatorsData::RLeg, Platform->getTime(), nu_nextRightLegJoints, leggains[0]);
-    m_actions->add(NUActionatorsData::LLeg, Platform->getTime(), nu_nextLeftLegJoints, leggains[0]);
+    std::vector<std::vector<float> >& leggains = m_walk_parameters.getLegGains();
+    m_actions->add(NUActionatorsData::RLeg, m_current_time, nu_nextRightLegJoints, leggains[0]);
+    m_actions->add(NUActionatorsData::LLeg, m_current_time, nu_nextLeftLegJoints, leggains[0]);
     return;
 }
@@ -53,6 +53,7 @@ public:
     void doWalk();
     void setWalkParameters(const WalkParameters& walkparameters);
     void writeParameters();
+    bool isReentrant() const {return false;}
 
 protected:
     void setDarwinSensor(int id,float joint);
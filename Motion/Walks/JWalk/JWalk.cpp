@@ -27,7 +27,6 @@
 #include "JWalkSwing.h"
 #include "JWalkAccept.h"
 
-#include "Infrastructure/NUBlackboard.h"
 #include "Infrastructure/NUSensorsData/NUSensorsData.h"
 #include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
 
@@ -36,7 +35,7 @@
 
 JWalk* JWalkBlackboard = 0;
 
-JWalk::JWalk() : NUWalk(Blackboard->Sensors, Blackboard->Actions)
+JWalk::JWalk(NUSensorsData* data, NUActionatorsData* actions) : NUWalk(data, actions)
 {
     JWalkBlackboard = this;
     m_walk_parameters.load("JWalkStart");
@@ -47,6 +46,7 @@ JWalk::JWalk() : NUWalk(Blackboard->Sensors, Blackboard->Actions)
     WalkFrequency = 0.6;			// a constant for now
     
     Parameters = &m_walk_parameters;
+    Sensors = m_data;
     
     LArmEnabled = false;
     RArmEnabled = false;
@@ -70,8 +70,8 @@ JWalk::JWalk() : NUWalk(Blackboard->Sensors, Blackboard->Actions)
     
     
     // Initialise the leg values
-    m_initial_lleg = std::vector<float>(Blackboard->Actions->getSize(NUActionatorsData::LLeg), 0);
-    m_initial_rleg = std::vector<float>(Blackboard->Actions->getSize(NUActionatorsData::RLeg), 0);
+    m_initial_lleg = std::vector<float>(m_actions->getSize(NUActionatorsData::LLeg), 0);
+    m_initial_rleg = std::vector<float>(m_actions->getSize(NUActionatorsData::RLeg), 0);
     
     // Initialise the arm values
     float larm[] = {0.1, 1.57, 0.15, -1.57};
@@ -96,7 +96,7 @@ JWalk::~JWalk()
 
 void JWalk::doWalk()
 {
-    CurrentTime = Blackboard->Sensors->CurrentTime;
+    CurrentTime = m_data->CurrentTime;
 
     updateJWalkBlackboard();
     calculateGaitPhase();
@@ -54,8 +54,9 @@ class JWalkState;
 class JWalk : public NUWalk
 {
 public:
-    JWalk();
+    JWalk(NUSensorsData* data, NUActionatorsData* actions);
     ~JWalk();
+    bool isReentrant() const {return false;}
 protected:
     void doWalk();
 private:
@@ -71,6 +72,7 @@ public:
     float WalkFrequency;				//!< the current walk frequency in Hz (1.0Hz means one left and one right step in 1 second)
     
     WalkParameters* Parameters;			//!< the current set of walk parameters
+    NUSensorsData* Sensors;				//!< the sensor data the walk was given
     
     bool LArmEnabled;					//!< true if we have control of the left arm
     bool RArmEnabled;					//!< true if we have control of the right arm
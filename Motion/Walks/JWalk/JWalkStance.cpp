@@ -49,7 +49,7 @@ JWalkState* JWalkStance::next()
     else if (JWalkBlackboard->LeftState == JWalkBlackboard->LeftStance and JWalkBlackboard->RightState == JWalkBlackboard->RightStance)
     {	// if we are standing, and we now have a non-zero speed; its time to start walking
         float thisforce, otherforce;
-        if (Blackboard->Sensors->getForce(m_leg, thisforce) and Blackboard->Sensors->getForce(m_other_leg, otherforce))
+        if (JWalkBlackboard->Sensors->getForce(m_leg, thisforce) and JWalkBlackboard->Sensors->getForce(m_other_leg, otherforce))
         {	// a nice quirk is to have the foot with the least amount of weight on it lift first
             if (thisforce < otherforce)
                 return *m_push;
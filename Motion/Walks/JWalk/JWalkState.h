@@ -25,7 +25,6 @@
 #ifndef JWALKSTATE_H
 #define JWALKSTATE_H
 
-#include "Infrastructure/NUBlackboard.h"
 #include "Infrastructure/NUSensorsData/NUSensorsData.h"
 #include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
 #include "JWalk.h"
@@ -355,11 +355,11 @@ void NBWalk::updateActionatorsData()
     
     applyPerturbation(nu_nextLeftLegJoints, leggains[0], nu_nextRightLegJoints, leggains[0]);
     
-    m_actions->add(NUActionatorsData::LLeg, Platform->getTime(), nu_nextLeftLegJoints, leggains[0]);
-    m_actions->add(NUActionatorsData::RLeg, Platform->getTime(), nu_nextRightLegJoints, leggains[0]);
+    m_actions->add(NUActionatorsData::LLeg, m_current_time, nu_nextLeftLegJoints, leggains[0]);
+    m_actions->add(NUActionatorsData::RLeg, m_current_time, nu_nextRightLegJoints, leggains[0]);
     if (m_larm_enabled)
-        m_actions->add(NUActionatorsData::LArm, Platform->getTime(), nu_nextLeftArmJoints, armgains[0]);
+        m_actions->add(NUActionatorsData::LArm, m_current_time, nu_nextLeftArmJoints, armgains[0]);
     if (m_rarm_enabled)
-        m_actions->add(NUActionatorsData::RArm, Platform->getTime(), nu_nextRightArmJoints, armgains[0]);
+        m_actions->add(NUActionatorsData::RArm, m_current_time, nu_nextRightArmJoints, armgains[0]);
 }
 
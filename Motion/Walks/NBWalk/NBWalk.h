@@ -51,6 +51,7 @@ public:
     ~NBWalk();
     
     void kill();
+    bool isReentrant() const {return false;}
 
     void setWalkParameters(const WalkParameters& walkparameters);
 protected:
@@ -599,8 +599,11 @@ bool WalkingLeg::shouldSwitchStates()
     bool shouldswitch = false;
     // NUbots: Im going to had a hack in here to switch states when the foot hits the ground
     // ie go from SWINGING to DOUBLE_SUPPORT when the contact occurs on this foot
+    // Without a Blackboard (eg. in WalkSimulator) there is no contact, and the states switch on time alone
     bool contact = false;
-    if (leg_name.compare("left") == 0)
+    if (Blackboard == NULL or Blackboard->Sensors == NULL)
+        contact = false;
+    else if (leg_name.compare("left") == 0)
         Blackboard->Sensors->getContact(NUSensorsData::LFoot, contact);
     else if (leg_name.compare("right") == 0)
         Blackboard->Sensors->getContact(NUSensorsData::RFoot, contact);
@@ -0,0 +1,154 @@
+/*! @file WalkSimulationPool.cpp
+    @brief Implementation of a pool of threads to evaluate walk parameters offline
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WalkSimulationPool.h"
+
+#include "debug.h"
+#include "debugverbositynumotion.h"
+
+#include <sstream>
+
+/*! @brief Creates a pool of walk simulators
+    @param factory the function used to create the walk engine for each run
+    @param jointnames the hardware names of the joints of the simulated robot
+    @param numworkers the number of worker threads (at least one will be used)
+    @param cycletime the simulated time between motion cycles in ms
+ */
+WalkSimulationPool::WalkSimulationPool(WalkSimulator::WalkFactory factory, const std::vector<std::string>& jointnames, unsigned int numworkers, double cycletime)
+{
+    if (numworkers == 0)
+        numworkers = 1;
+    for (unsigned int i=0; i<numworkers; i++)
+        m_simulators.push_back(new WalkSimulator(factory, jointnames, cycletime));
+
+    pthread_mutex_init(&m_mutex, NULL);
+    m_next_index = 0;
+    m_parameters = NULL;
+    m_results = NULL;
+    m_duration = 0;
+}
+
+WalkSimulationPool::~WalkSimulationPool()
+{
+    for (size_t i=0; i<m_simulators.size(); i++)
+        delete m_simulators[i];
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/*! @brief Sets the walk commands given during each run */
+void WalkSimulationPool::setCommands(const std::vector<WalkSimulator::Command>& commands)
+{
+    for (size_t i=0; i<m_simulators.size(); i++)
+        m_simulators[i]->setCommands(commands);
+}
+
+/*! @brief Sets the joint positions of the synthetic robot at the start of each run */
+void WalkSimulationPool::setInitialPositions(const std::vector<float>& positions)
+{
+    for (size_t i=0; i<m_simulators.size(); i++)
+        m_simulators[i]->setInitialPositions(positions);
+}
+
+/*! @brief Sets the noise added to the synthetic balance sensors. Every worker uses the same seed. */
+void WalkSimulationPool::setSensorNoise(float gyrosigma, float accelsigma, uint32_t seed)
+{
+    for (size_t i=0; i<m_simulators.size(); i++)
+        m_simulators[i]->setSensorNoise(gyrosigma, accelsigma, seed);
+}
+
+/*! @brief Sets the recorded sensor data to replay. The log is only read, so it is shared by all workers. */
+void WalkSimulationPool::setSensorLog(const std::vector<NUSensorsData>* frames)
+{
+    for (size_t i=0; i<m_simulators.size(); i++)
+        m_simulators[i]->setSensorLog(frames);
+}
+
+/*! @brief Simulates each set of walk parameters, blocking until they have all been evaluated
+    @param parameters the sets of walk parameters to evaluate
+    @param duration the simulated time of each run in ms
+    @param results will be updated with the result for each set of parameters
+ */
+void WalkSimulationPool::evaluate(const std::vector<WalkParameters>& parameters, double duration, std::vector<WalkSimulator::Result>& results)
+{
+    results.resize(parameters.size());
+    m_parameters = &parameters;
+    m_results = &results;
+    m_duration = duration;
+    m_next_index = 0;
+
+    std::vector<Worker*> workers;
+    for (size_t i=0; i<m_simulators.size() and i<parameters.size(); i++)
+    {
+        std::stringstream name;
+        name << "WalkSimulationWorker" << i;
+        workers.push_back(new Worker(this, m_simulators[i], name.str()));
+        workers.back()->start();
+    }
+    for (size_t i=0; i<workers.size(); i++)
+    {
+        workers[i]->join();
+        delete workers[i];
+    }
+
+    m_parameters = NULL;
+    m_results = NULL;
+}
+
+/*! @brief Returns the number of worker threads */
+unsigned int WalkSimulationPool::getNumWorkers() const
+{
+    return m_simulators.size();
+}
+
+/*! @brief Gets the index of the next set of parameters to evaluate
+    @param index will be updated with the index
+    @return false if there are no parameters left to evaluate
+ */
+bool WalkSimulationPool::next(size_t& index)
+{
+    pthread_mutex_lock(&m_mutex);
+    index = m_next_index;
+    if (m_next_index < m_parameters->size())
+        m_next_index++;
+    pthread_mutex_unlock(&m_mutex);
+    return index < m_parameters->size();
+}
+
+WalkSimulationPool::Worker::Worker(WalkSimulationPool* pool, WalkSimulator* simulator, const std::string& name) : Thread(name, 0)
+{
+    m_pool = pool;
+    m_simulator = simulator;
+}
+
+WalkSimulationPool::Worker::~Worker()
+{
+}
+
+void WalkSimulationPool::Worker::run()
+{
+    size_t index;
+    while (m_pool->next(index))
+    {
+        // each worker only ever writes to its own elements of the results
+        WalkSimulator::Result& result = (*m_pool->m_results)[index];
+        m_simulator->run((*m_pool->m_parameters)[index], m_pool->m_duration, result);
+        #if DEBUG_NUMOTION_VERBOSITY > 1
+            debug << m_name << " evaluated " << index << " ";
+            result.summaryTo(debug);
+        #endif
+    }
+}
@@ -0,0 +1,79 @@
+/*! @file WalkSimulationPool.h
+    @brief Declaration of a pool of threads to evaluate walk parameters offline
+
+    @class WalkSimulationPool
+    @brief Evaluates many sets of walk parameters in parallel, each with its own WalkSimulator
+
+    Each worker thread owns a WalkSimulator, and takes the next unevaluated set of parameters
+    until there are none left. The results are returned in the same order as the parameters,
+    and because each run starts from a fresh walk engine with the same seed the results do not
+    depend on the number of workers.
+
+    A walk that keeps state outside of the instance (see NUWalk::isReentrant) is run one simulation
+    at a time whatever the number of workers, so extra workers do not speed it up. If that state
+    outlives the instance (NBWalk) the results also depend on the order of the runs.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WALKSIMULATIONPOOL_H
+#define WALKSIMULATIONPOOL_H
+
+#include "WalkSimulator.h"
+#include "Tools/Threading/Thread.h"
+
+#include <vector>
+#include <string>
+#include <pthread.h>
+
+class WalkSimulationPool
+{
+public:
+    WalkSimulationPool(WalkSimulator::WalkFactory factory, const std::vector<std::string>& jointnames, unsigned int numworkers, double cycletime = 20);
+    ~WalkSimulationPool();
+
+    void setCommands(const std::vector<WalkSimulator::Command>& commands);
+    void setInitialPositions(const std::vector<float>& positions);
+    void setSensorNoise(float gyrosigma, float accelsigma, uint32_t seed);
+    void setSensorLog(const std::vector<NUSensorsData>* frames);
+
+    void evaluate(const std::vector<WalkParameters>& parameters, double duration, std::vector<WalkSimulator::Result>& results);
+    unsigned int getNumWorkers() const;
+private:
+    /*! @brief A thread that runs simulations until the pool has no parameters left */
+    class Worker : public Thread
+    {
+    public:
+        Worker(WalkSimulationPool* pool, WalkSimulator* simulator, const std::string& name);
+        ~Worker();
+    protected:
+        void run();
+    private:
+        WalkSimulationPool* m_pool;
+        WalkSimulator* m_simulator;
+    };
+
+    bool next(size_t& index);
+private:
+    std::vector<WalkSimulator*> m_simulators;   //!< a simulator for each worker
+
+    pthread_mutex_t m_mutex;                    //!< protects m_next_index
+    size_t m_next_index;                        //!< the index of the next set of parameters to be evaluated
+    const std::vector<WalkParameters>* m_parameters;    //!< the parameters for the current evaluation
+    std::vector<WalkSimulator::Result>* m_results;      //!< the results for the current evaluation
+    double m_duration;                          //!< the simulated time of each run in the current evaluation
+};
+
+#endif
+
@@ -0,0 +1,308 @@
+/*! @file WalkSimulationTest.cpp
+    @brief A test and driver of WalkSimulator and WalkSimulationPool
+
+    The simulator is run with a small sinusoidal walk engine defined here, whose response to the walk
+    parameters is known. The test checks that
+        - a run simulates the requested number of cycles and the walk responds to the commands
+        - runs with the same parameters and seed produce identical targets
+        - a faster step frequency is measured as a rougher walk
+        - the pool returns the same results in the same order regardless of the number of workers
+    and prints the cost of the simulation itself. It then runs BWalk, with Config/Darwin/Motion/Walks/BWalk.cfg,
+    and checks that it walks when commanded, gives finite targets, is repeatable, and gives the same results
+    from a pool of workers as from one.
+
+    Build and run from this directory with
+    @code
+        make WalkSimulationTest && ./WalkSimulationTest
+    @endcode
+    It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WalkSimulator.h"
+#include "WalkSimulationPool.h"
+#include "Motion/NUWalk.h"
+#include "Infrastructure/NUSensorsData/NUSensorsData.h"
+#include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
+#include "Motion/Walks/BWalk/WalkingEngine.h"
+#include "Kinematics/DarwinInverseKinematics.h"
+
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <ctime>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <unistd.h>
+
+class NUBlackboard;
+NUBlackboard* Blackboard = NULL;        // the simulator never uses the Blackboard, but NUActionatorsData refers to it
+
+/*! @brief A walk that swings each leg sinusoidally. The walk parameters are the step frequency in Hz and
+           the step amplitude in rad; the amplitude is scaled by the current forward speed.
+ */
+class SineWalk : public NUWalk
+{
+public:
+    SineWalk(NUSensorsData* data, NUActionatorsData* actions) : NUWalk(data, actions)
+    {
+        m_initial_larm = std::vector<float>(3, 0);
+        m_initial_rarm = std::vector<float>(3, 0);
+        m_initial_lleg = std::vector<float>(6, 0);
+        m_initial_rleg = std::vector<float>(6, 0);
+    }
+protected:
+    void doWalk()
+    {
+        std::vector<Parameter>& parameters = m_walk_parameters.getParameters();
+        float frequency = parameters[0].get();
+        float amplitude = parameters[1].get()*m_speed_x/10;
+        float phase = 2*M_PI*frequency*m_current_time/1000;
+
+        std::vector<float> left(6, 0), right(6, 0);
+        left[1] = amplitude*sin(phase);
+        left[3] = amplitude*(1 - cos(phase));
+        right[1] = -left[1];
+        right[3] = amplitude*(1 + cos(phase));
+        m_actions->add(NUActionatorsData::LLeg, m_current_time, left, 75);
+        m_actions->add(NUActionatorsData::RLeg, m_current_time, right, 75);
+    }
+};
+
+static NUWalk* createSineWalk(NUSensorsData* data, NUActionatorsData* actions)
+{
+    return new SineWalk(data, actions);
+}
+
+/*! @brief The leg solver of a SimulatedBWalk, a base so that it is constructed before the walk */
+struct LegSolver
+{
+    DarwinInverseKinematics Solver;
+};
+
+/*! @brief BWalk with its own leg solver, as NUMotion gives it one */
+class SimulatedBWalk : private LegSolver, public WalkingEngine
+{
+public:
+    SimulatedBWalk(NUSensorsData* data, NUActionatorsData* actions) : WalkingEngine(data, actions, &Solver) {}
+};
+
+static NUWalk* createBWalk(NUSensorsData* data, NUActionatorsData* actions)
+{
+    return new SimulatedBWalk(data, actions);
+}
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static std::vector<std::string> darwinJoints()
+{
+    const char* names[] = {"HeadPitch", "HeadYaw",
+                           "LShoulderRoll", "LShoulderPitch", "LElbowPitch",
+                           "RShoulderRoll", "RShoulderPitch", "RElbowPitch",
+                           "LHipRoll", "LHipPitch", "LHipYaw", "LKneePitch", "LAnkleRoll", "LAnklePitch",
+                           "RHipRoll", "RHipPitch", "RHipYaw", "RKneePitch", "RAnkleRoll", "RAnklePitch"};
+    return std::vector<std::string>(names, names + sizeof(names)/sizeof(*names));
+}
+
+static std::vector<WalkSimulator::Command> forwardCommands()
+{
+    std::vector<WalkSimulator::Command> commands;
+    WalkSimulator::Command go = {100, 1.0f, 0, 0};
+    WalkSimulator::Command stop = {4000, 0, 0, 0};
+    commands.push_back(stop);       // out of order on purpose; the simulator sorts them
+    commands.push_back(go);
+    return commands;
+}
+
+static WalkParameters sineParameters(float frequency)
+{
+    WalkParameters parameters("SineWalk");
+    std::vector<Parameter> values;
+    values.push_back(Parameter("StepFrequency", frequency, 0.2, 4.0));
+    values.push_back(Parameter("StepAmplitude", 0.2, 0.0, 0.5));
+    parameters.setParameters(values);
+    parameters.setMaxSpeeds(std::vector<float>(3, 10));
+    parameters.setMaxAccelerations(std::vector<float>(3, 100));
+    return parameters;
+}
+
+static bool sameResult(const WalkSimulator::Result& a, const WalkSimulator::Result& b)
+{
+    return a.Cycles == b.Cycles and a.RmsJointAcceleration == b.RmsJointAcceleration
+       and a.MaxJointStep == b.MaxJointStep and a.InvalidTargets == b.InvalidTargets;
+}
+
+static void testSimulator()
+{
+    printf("WalkSimulator:\n");
+    WalkSimulator simulator(createSineWalk, darwinJoints(), 20);
+    simulator.setCommands(forwardCommands());
+    simulator.setSensorNoise(0.02, 5, 7);
+    simulator.setCapture(true);
+
+    WalkSimulator::Result first, second;
+    bool created = simulator.run(sineParameters(1.0), 5000, first);
+    check(created, "the walk engine was created", created);
+    check(first.Cycles == 250, "cycles simulated in 5s", first.Cycles);
+    check(first.InvalidTargets == 0, "non-finite targets", first.InvalidTargets);
+    check(first.MaxJointStep > 0.01, "the walk moves after the command (max step in rad)", first.MaxJointStep);
+    check(first.Targets.size() == first.Cycles, "captured target frames", first.Targets.size());
+
+    // after the stop command the walk decelerates to a standstill
+    float laststep = 0;
+    const std::vector<float>& last = first.Targets.back();
+    const std::vector<float>& previous = first.Targets[first.Targets.size() - 2];
+    for (size_t i=0; i<last.size(); i++)
+        laststep = std::max(laststep, static_cast<float>(fabs(last[i] - previous[i])));
+    check(laststep < 1e-3, "the walk stops after the stop command (last step in rad)", laststep);
+
+    simulator.run(sineParameters(1.0), 5000, second);
+    check(sameResult(first, second) and first.Targets == second.Targets, "a second run with the same seed is identical", 0);
+
+    WalkSimulator::Result fast;
+    simulator.run(sineParameters(3.0), 5000, fast);
+    check(fast.RmsJointAcceleration > 2*first.RmsJointAcceleration, "tripling the step frequency is measured as rougher (ratio of rms acceleration)", fast.RmsJointAcceleration/first.RmsJointAcceleration);
+    printf("  ");
+    first.summaryTo(std::cout);
+}
+
+static void testPool()
+{
+    printf("WalkSimulationPool:\n");
+    std::vector<WalkParameters> parameters;
+    for (int i=0; i<24; i++)
+        parameters.push_back(sineParameters(0.5 + 0.1*i));
+
+    std::vector<WalkSimulator::Result> serial, parallel;
+    WalkSimulationPool one(createSineWalk, darwinJoints(), 1);
+    one.setCommands(forwardCommands());
+    one.setSensorNoise(0.02, 5, 7);
+    double start = now();
+    one.evaluate(parameters, 10000, serial);
+    double serialtime = now() - start;
+
+    WalkSimulationPool four(createSineWalk, darwinJoints(), 4);
+    four.setCommands(forwardCommands());
+    four.setSensorNoise(0.02, 5, 7);
+    start = now();
+    four.evaluate(parameters, 10000, parallel);
+    double paralleltime = now() - start;
+
+    size_t matching = 0;
+    for (size_t i=0; i<serial.size() and i<parallel.size(); i++)
+        if (sameResult(serial[i], parallel[i]))
+            matching++;
+    check(serial.size() == parameters.size() and parallel.size() == parameters.size(), "a result for every set of parameters", parallel.size());
+    check(matching == parameters.size(), "results with 4 workers that match 1 worker", matching);
+
+    bool ordered = true;
+    for (size_t i=1; i<parallel.size(); i++)
+        ordered = ordered and parallel[i].RmsJointAcceleration > parallel[i-1].RmsJointAcceleration;
+    check(ordered, "results are in the order of the parameters", ordered);
+
+    double simulated = parameters.size()*10.0;
+    printf("  %d runs of 10s: 1 worker %.3fs (%.0fx real time), 4 workers %.3fs (%.0fx real time)\n",
+           static_cast<int>(parameters.size()), serialtime, simulated/serialtime, paralleltime, simulated/paralleltime);
+}
+
+static void testBWalk()
+{
+    printf("BWalk:\n");
+    WalkParameters parameters;
+    parameters.load("BWalk");
+    std::vector<WalkParameters> sets;
+    for (int i=0; i<4; i++)
+    {
+        sets.push_back(parameters);
+        std::vector<Parameter>& values = sets.back().getParameters();
+        for (size_t j=0; j<values.size(); j++)
+            if (values[j].name() == "walkStepDuration")
+                values[j].set(values[j].get()*(0.9f + 0.1f*i));
+    }
+
+    WalkSimulator simulator(createBWalk, darwinJoints(), 20);
+    simulator.setCommands(forwardCommands());
+    simulator.setSensorNoise(0.02, 5, 7);
+    simulator.setCapture(true);
+    WalkSimulator::Result first, second;
+    bool created = simulator.run(parameters, 5000, first);
+    check(created and first.Cycles == 250, "cycles simulated in 5s", first.Cycles);
+    check(first.InvalidTargets == 0, "non-finite targets", first.InvalidTargets);
+
+    // the legs move more while walking than while standing before the command
+    float standing = 0, walking = 0;
+    for (size_t c=1; c<first.Targets.size(); c++)
+    {
+        float step = 0;
+        for (size_t i=0; i<first.Targets[c].size(); i++)
+            step = std::max(step, static_cast<float>(fabs(first.Targets[c][i] - first.Targets[c-1][i])));
+        if (c < 5)
+            standing = std::max(standing, step);
+        else if (c > 50 and c < 200)
+            walking = std::max(walking, step);
+    }
+    check(walking > 0.005 and walking > standing, "the legs move after the command (max step in rad)", walking);
+
+    simulator.run(parameters, 5000, second);
+    check(sameResult(first, second) and first.Targets == second.Targets, "a second run with the same seed is identical", 0);
+    printf("  ");
+    first.summaryTo(std::cout);
+
+    std::vector<WalkSimulator::Result> serial, parallel;
+    WalkSimulationPool one(createBWalk, darwinJoints(), 1);
+    one.setCommands(forwardCommands());
+    one.setSensorNoise(0.02, 5, 7);
+    one.evaluate(sets, 5000, serial);
+    WalkSimulationPool four(createBWalk, darwinJoints(), 4);
+    four.setCommands(forwardCommands());
+    four.setSensorNoise(0.02, 5, 7);
+    four.evaluate(sets, 5000, parallel);
+    size_t matching = 0;
+    for (size_t i=0; i<serial.size() and i<parallel.size(); i++)
+        if (sameResult(serial[i], parallel[i]))
+            matching++;
+    check(matching == sets.size(), "step durations whose results with 4 workers match 1 worker", matching);
+}
+
+int main()
+{
+    // BWalk reads its parameters and masses from $HOME/nubot/Config/Darwin, so point that at the repository's
+    if (access("nubot", F_OK) != 0 and symlink("../../..", "nubot") != 0)
+        printf("Unable to link ./nubot to the repository, so BWalk has no configuration\n");
+    setenv("HOME", ".", 1);
+
+    testSimulator();
+    testPool();
+    testBWalk();
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
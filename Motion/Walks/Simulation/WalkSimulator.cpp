@@ -0,0 +1,404 @@
+/*! @file WalkSimulator.cpp
+    @brief Implementation of a headless walk engine simulator
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WalkSimulator.h"
+#include "Motion/NUWalk.h"
+#include "Infrastructure/NUSensorsData/NUSensorsData.h"
+#include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
+#include "Infrastructure/Jobs/MotionJobs/WalkJob.h"
+#include "Tools/FileFormats/LogContainer.h"
+
+#include "debug.h"
+#include "debugverbositynumotion.h"
+
+#include <fstream>
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <time.h>
+
+pthread_mutex_t WalkSimulator::m_construction_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*! @brief Returns the thread time in ms */
+static double threadTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return now.tv_nsec/1e6 + now.tv_sec*1e3;
+}
+
+/*! @brief Returns the real time in ms */
+static double realTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_nsec/1e6 + now.tv_sec*1e3;
+}
+
+/*! @brief Creates a walk simulator
+    @param factory the function used to create the walk engine at the start of each run
+    @param jointnames the hardware names of the joints of the simulated robot
+    @param cycletime the simulated time between motion cycles in ms
+ */
+WalkSimulator::WalkSimulator(WalkFactory factory, const std::vector<std::string>& jointnames, double cycletime)
+{
+    m_factory = factory;
+    m_joint_names = jointnames;
+    m_cycle_time = cycletime;
+
+    m_initial_positions = std::vector<float>(jointnames.size(), 0);
+    m_sensor_log = NULL;
+    m_capture = false;
+    m_gyro_sigma = 0;
+    m_accel_sigma = 0;
+    m_seed = 1;
+    m_random_state = m_seed;
+
+    m_data = NULL;
+    m_actions = NULL;
+}
+
+WalkSimulator::~WalkSimulator()
+{
+}
+
+/*! @brief Sets the walk commands given during each run
+    @param commands the commands; they will be given in order of their time
+ */
+void WalkSimulator::setCommands(const std::vector<Command>& commands)
+{
+    m_commands = commands;
+    for (size_t i=1; i<m_commands.size(); i++)
+    {   // an insertion sort is plenty for a handful of commands
+        Command c = m_commands[i];
+        size_t j = i;
+        for (; j > 0 and m_commands[j-1].Time > c.Time; j--)
+            m_commands[j] = m_commands[j-1];
+        m_commands[j] = c;
+    }
+}
+
+/*! @brief Sets the joint positions of the synthetic robot at the start of each run
+    @param positions the joint positions, in the same order as the joint names
+ */
+void WalkSimulator::setInitialPositions(const std::vector<float>& positions)
+{
+    if (positions.size() != m_joint_names.size())
+        errorlog << "WalkSimulator::setInitialPositions(). Expected " << m_joint_names.size() << " positions not " << positions.size() << std::endl;
+    else
+        m_initial_positions = positions;
+}
+
+/*! @brief Sets the noise added to the synthetic balance sensors. The noise is seeded, so runs with the same
+           parameters will produce the same result.
+    @param gyrosigma the standard deviation of the gyro noise in rad/s
+    @param accelsigma the standard deviation of the accelerometer noise in cm/s/s
+    @param seed the seed for the noise
+ */
+void WalkSimulator::setSensorNoise(float gyrosigma, float accelsigma, uint32_t seed)
+{
+    m_gyro_sigma = gyrosigma;
+    m_accel_sigma = accelsigma;
+    m_seed = seed == 0 ? 1 : seed;
+}
+
+/*! @brief Sets the recorded sensor data to replay instead of the synthetic sensors
+    @param frames the sensor log (see loadSensorLog), which must outlive the simulator, or NULL for synthetic sensors.
+ */
+void WalkSimulator::setSensorLog(const std::vector<NUSensorsData>* frames)
+{
+    if (frames != NULL and frames->empty())
+        m_sensor_log = NULL;
+    else
+        m_sensor_log = frames;
+}
+
+/*! @brief Sets whether the servo targets for each cycle are kept in the result
+ */
+void WalkSimulator::setCapture(bool capture)
+{
+    m_capture = capture;
+}
+
+/*! @brief Loads the sensor frames of a log recorded on the robot. This is either the log container written by the
+           LogRecorder (<robot>_log.nulog), or a sensor stream file converted from one by LogContainer::toStreams
+    @param filename the path to the log
+    @param frames will be updated with each frame in the log
+    @return true if at least one frame was read
+ */
+bool WalkSimulator::loadSensorLog(const std::string& filename, std::vector<NUSensorsData>& frames)
+{
+    const std::string extension = ".nulog";
+    bool iscontainer = filename.size() > extension.size() and filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+
+    pthread_mutex_lock(&m_construction_mutex);
+    frames.clear();
+    NUSensorsData frame;
+    if (iscontainer)
+    {
+        LogContainer container;
+        if (not container.open(filename))
+            errorlog << "WalkSimulator::loadSensorLog(). Unable to open " << filename << std::endl;
+        std::vector<char> data;
+        for (unsigned int i=0; i<container.getNumRecords(); i++)
+        {
+            if (container.getRecord(i).stream != LogContainer::SensorStream or not container.readRecord(i, data))
+                continue;
+            try
+            {
+                std::stringstream record(std::string(data.begin(), data.end()));
+                record >> frame;
+                frames.push_back(frame);
+            }
+            catch (std::exception& e)
+            {
+                errorlog << "WalkSimulator::loadSensorLog(). Skipping a malformed sensor record in " << filename << std::endl;
+            }
+        }
+    }
+    else
+    {
+        std::ifstream file(filename.c_str(), std::ios_base::in | std::ios_base::binary);
+        if (not file.is_open())
+            errorlog << "WalkSimulator::loadSensorLog(). Unable to open " << filename << std::endl;
+        try
+        {
+            while (file.good() and file.peek() != EOF)
+            {
+                file >> frame;
+                frames.push_back(frame);
+            }
+        }
+        catch (std::exception& e)
+        {   // the last frame of a log is often incomplete
+            #if DEBUG_NUMOTION_VERBOSITY > 0
+                debug << "WalkSimulator::loadSensorLog(). Stopped reading " << filename << " after " << frames.size() << " frames" << std::endl;
+            #endif
+        }
+    }
+    pthread_mutex_unlock(&m_construction_mutex);
+    return not frames.empty();
+}
+
+/*! @brief Simulates the walk engine with the given parameters
+    @param parameters the walk parameters to give to the walk engine
+    @param duration the simulated time in ms
+    @param result will be updated with the measurements made during the run
+    @return false if a walk engine could not be created
+ */
+bool WalkSimulator::run(const WalkParameters& parameters, double duration, Result& result)
+{
+    result.Cycles = 0;
+    result.MeanCycleTime = 0;
+    result.MaxCycleTime = 0;
+    result.RealTimeFactor = 0;
+    result.RmsJointAcceleration = 0;
+    result.MaxJointStep = 0;
+    result.InvalidTargets = 0;
+    result.Targets.clear();
+
+    // the data and walk are created fresh for every run so that runs are independent of each other
+    pthread_mutex_lock(&m_construction_mutex);
+    m_data = new NUSensorsData();
+    m_data->addSensors(m_joint_names);
+    m_actions = new NUActionatorsData();
+    m_actions->addActionators(m_joint_names);
+    NUWalk* walk = m_factory(m_data, m_actions);
+    // a walk that is not reentrant keeps the mutex until it is deleted, so that no other walk is made or run meanwhile
+    bool exclusive = walk != NULL and not walk->isReentrant();
+    if (not exclusive)
+        pthread_mutex_unlock(&m_construction_mutex);
+    if (walk == NULL)
+    {
+        errorlog << "WalkSimulator::run(). Failed to create a walk engine" << std::endl;
+        delete m_data;
+        delete m_actions;
+        return false;
+    }
+    walk->setWalkParameters(parameters);
+
+    m_random_state = m_seed;
+    m_positions = m_initial_positions;
+    m_gains = std::vector<float>(m_joint_names.size(), 0);
+    m_previous_positions = m_positions;
+    m_previous_velocities = std::vector<float>(m_joint_names.size(), 0);
+
+    double sumsqracceleration = 0;
+    size_t numaccelerations = 0;
+    std::vector<float> previoustargets, previousvelocities;
+
+    size_t nextcommand = 0;
+    size_t numcycles = static_cast<size_t>(duration/m_cycle_time);
+    double realstart = realTime();
+    for (size_t cycle=0; cycle<numcycles; cycle++)
+    {
+        double time = (cycle + 1)*m_cycle_time;
+        updateSensors(cycle, time);
+
+        double start = threadTime();
+        while (nextcommand < m_commands.size() and m_commands[nextcommand].Time <= time)
+        {
+            const Command& c = m_commands[nextcommand++];
+            WalkJob job(c.TranslationSpeed, c.Direction, c.RotationSpeed);
+            walk->process(&job, true);
+        }
+        walk->process(m_data, m_actions);
+        double cycletime = threadTime() - start;
+
+        // what NUActionators would send to the hardware
+        m_actions->preProcess(time);
+        m_actions->getNextServos(m_data, m_positions, m_gains);
+        m_actions->postProcess();
+
+        result.Cycles++;
+        result.MeanCycleTime += cycletime;
+        if (cycletime > result.MaxCycleTime)
+            result.MaxCycleTime = cycletime;
+
+        // smoothness of the targets
+        if (previoustargets.size() == m_positions.size())
+        {
+            std::vector<float> velocities(m_positions.size(), 0);
+            for (size_t i=0; i<m_positions.size(); i++)
+            {
+                float step = m_positions[i] - previoustargets[i];
+                if (not std::isfinite(m_positions[i]))
+                {
+                    result.InvalidTargets++;
+                    continue;
+                }
+                if (fabs(step) > result.MaxJointStep)
+                    result.MaxJointStep = fabs(step);
+                velocities[i] = 1000*step/m_cycle_time;
+                if (previousvelocities.size() == velocities.size())
+                {
+                    float acceleration = 1000*(velocities[i] - previousvelocities[i])/m_cycle_time;
+                    sumsqracceleration += acceleration*acceleration;
+                    numaccelerations++;
+                }
+            }
+            previousvelocities = velocities;
+        }
+        previoustargets = m_positions;
+        if (m_capture)
+            result.Targets.push_back(m_positions);
+    }
+    double realduration = realTime() - realstart;
+
+    if (result.Cycles > 0)
+        result.MeanCycleTime /= result.Cycles;
+    if (realduration > 0)
+        result.RealTimeFactor = numcycles*m_cycle_time/realduration;
+    if (numaccelerations > 0)
+        result.RmsJointAcceleration = sqrt(sumsqracceleration/numaccelerations);
+
+    if (not exclusive)
+        pthread_mutex_lock(&m_construction_mutex);
+    delete walk;
+    delete m_actions;
+    delete m_data;
+    pthread_mutex_unlock(&m_construction_mutex);
+    m_actions = NULL;
+    m_data = NULL;
+    return true;
+}
+
+/*! @brief Updates the sensor data for the cycle. The synthetic servos are assumed to have reached the targets
+           from the previous cycle.
+    @param cycle the cycle number
+    @param time the simulated time of the cycle in ms
+ */
+void WalkSimulator::updateSensors(size_t cycle, double time)
+{
+    if (m_sensor_log != NULL)
+    {
+        *m_data = (*m_sensor_log)[cycle % m_sensor_log->size()];
+        m_data->PreviousTime = time - m_cycle_time;
+        m_data->CurrentTime = time;
+        return;
+    }
+
+    m_data->PreviousTime = m_data->CurrentTime;
+    m_data->CurrentTime = time;
+
+    static const float NaN = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> joint(NUSensorsData::NumJointSensorIndices, NaN);
+    std::vector<NUData::id_t*> ids = m_data->mapIdToIds(NUSensorsData::All);
+    float dt = m_cycle_time/1000;
+    for (size_t i=0; i<ids.size() and i<m_positions.size(); i++)
+    {
+        joint[NUSensorsData::PositionId] = m_positions[i];
+        joint[NUSensorsData::VelocityId] = (m_positions[i] - m_previous_positions[i])/dt;
+        joint[NUSensorsData::AccelerationId] = (joint[NUSensorsData::VelocityId] - m_previous_velocities[i])/dt;
+        joint[NUSensorsData::TargetId] = m_positions[i];
+        joint[NUSensorsData::StiffnessId] = m_gains[i];
+        m_data->set(*ids[i], time, joint);
+
+        m_previous_positions[i] = joint[NUSensorsData::PositionId];
+        m_previous_velocities[i] = joint[NUSensorsData::VelocityId];
+    }
+
+    std::vector<float> gyro(3, 0);
+    std::vector<float> accel(3, 0);
+    accel[2] = -981;
+    for (size_t i=0; i<3; i++)
+    {
+        gyro[i] += normalDistribution(m_gyro_sigma);
+        accel[i] += normalDistribution(m_accel_sigma);
+    }
+    m_data->set(NUSensorsData::Gyro, time, gyro);
+    m_data->set(NUSensorsData::Accelerometer, time, accel);
+    m_data->set(NUSensorsData::Orientation, time, std::vector<float>(3, 0));
+}
+
+/*! @brief Returns a sample from a zero mean normal distribution, using the simulator's own generator so that
+           runs are repeatable, and simulators in different threads do not share state.
+    @param sigma the standard deviation of the distribution
+ */
+float WalkSimulator::normalDistribution(float sigma)
+{
+    if (sigma == 0)
+        return 0;
+    // xorshift32 for two uniform samples, then Box-Muller
+    float u[2];
+    for (int i=0; i<2; i++)
+    {
+        m_random_state ^= m_random_state << 13;
+        m_random_state ^= m_random_state >> 17;
+        m_random_state ^= m_random_state << 5;
+        u[i] = (m_random_state + 1.0f)/4294967297.0f;
+    }
+    return sigma*sqrt(-2*log(u[0]))*cos(2*M_PI*u[1]);
+}
+
+/*! @brief Prints a human readable summary of the result */
+void WalkSimulator::Result::summaryTo(std::ostream& output) const
+{
+    output << "Cycles: " << Cycles;
+    output << " Cycle time: " << MeanCycleTime << "ms (max " << MaxCycleTime << "ms)";
+    output << " Real time factor: " << RealTimeFactor;
+    output << " Rms joint acceleration: " << RmsJointAcceleration << "rad/s/s";
+    output << " Max joint step: " << MaxJointStep << "rad";
+    output << " Invalid targets: " << InvalidTargets << std::endl;
+}
+
+/*! @brief Prints the result as a line of comma separated values */
+void WalkSimulator::Result::csvTo(std::ostream& output) const
+{
+    output << Cycles << ", " << MeanCycleTime << ", " << MaxCycleTime << ", " << RealTimeFactor << ", ";
+    output << RmsJointAcceleration << ", " << MaxJointStep << ", " << InvalidTargets << std::endl;
+}
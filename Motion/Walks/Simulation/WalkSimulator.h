@@ -0,0 +1,125 @@
+/*! @file WalkSimulator.h
+    @brief Declaration of a headless walk engine simulator
+
+    @class WalkSimulator
+    @brief Drives a walk engine offline with synthetic or recorded sensor data
+
+    The simulator owns its own NUSensorsData and NUActionatorsData, so it does not need a
+    Platform or a Blackboard, and neither must the walk engine. Each cycle it updates the sensor
+    data, passes any scheduled walk commands to the walk, runs NUWalk::process and then collects
+    the servo targets that would have been sent to the hardware. Cycles are run back to back, so a simulation runs
+    as fast as the walk engine can compute.
+
+    The sensor data is either synthetic, where the servos are assumed to perfectly track their
+    targets and the balance sensors see (seeded, and hence repeatable) noise, or replayed from
+    a sensor log recorded on the robot.
+
+    For each run the compute cost of every cycle, and the smoothness of the servo targets are
+    measured. The targets themselves can optionally be captured.
+
+    JWalk, NBWalk and DarwinWalk keep state outside of the instance (see NUWalk::isReentrant), so
+    the simulator runs them one at a time, holding m_construction_mutex from their construction to
+    their deletion. NBWalk's function statics also outlive the instance, so its runs are not
+    independent of each other, and without a Blackboard it ignores the foot contacts.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WALKSIMULATOR_H
+#define WALKSIMULATOR_H
+
+#include "Motion/Walks/WalkParameters.h"
+class NUWalk;
+class NUSensorsData;
+class NUActionatorsData;
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include <stdint.h>
+
+class WalkSimulator
+{
+public:
+    /*! @brief A function to create the walk engine under test using the given data */
+    typedef NUWalk* (*WalkFactory)(NUSensorsData* data, NUActionatorsData* actions);
+
+    /*! @brief A walk command, given to the walk as a WalkJob at Time */
+    struct Command
+    {
+        double Time;                            //!< the simulation time in ms to give the command
+        float TranslationSpeed;                 //!< the translational speed between 0 and 1
+        float Direction;                        //!< the translational direction in radians
+        float RotationSpeed;                    //!< the rotational speed in rad/s
+    };
+
+    /*! @brief The measurements made during a single simulation */
+    struct Result
+    {
+        unsigned int Cycles;                    //!< the number of cycles simulated
+        double MeanCycleTime;                   //!< the average thread time in ms spent in the walk per cycle
+        double MaxCycleTime;                    //!< the largest thread time in ms spent in the walk in a single cycle
+        double RealTimeFactor;                  //!< the simulated time divided by the real time taken
+        float RmsJointAcceleration;             //!< the rms of the joint target accelerations in rad/s/s
+        float MaxJointStep;                     //!< the largest change in a joint target in a single cycle in rad
+        unsigned int InvalidTargets;            //!< the number of targets that were not finite
+        std::vector<std::vector<float> > Targets;   //!< the servo targets for each cycle (only if capture is enabled)
+
+        void summaryTo(std::ostream& output) const;
+        void csvTo(std::ostream& output) const;
+    };
+public:
+    WalkSimulator(WalkFactory factory, const std::vector<std::string>& jointnames, double cycletime = 20);
+    ~WalkSimulator();
+
+    void setCommands(const std::vector<Command>& commands);
+    void setInitialPositions(const std::vector<float>& positions);
+    void setSensorNoise(float gyrosigma, float accelsigma, uint32_t seed);
+    void setSensorLog(const std::vector<NUSensorsData>* frames);
+    void setCapture(bool capture);
+
+    bool run(const WalkParameters& parameters, double duration, Result& result);
+
+    static bool loadSensorLog(const std::string& filename, std::vector<NUSensorsData>& frames);
+private:
+    void updateSensors(size_t cycle, double time);
+    void measure(const std::vector<float>& targets, Result& result);
+    float normalDistribution(float sigma);
+private:
+    WalkFactory m_factory;                      //!< creates a new walk engine for each run
+    std::vector<std::string> m_joint_names;     //!< the hardware names of the joints
+    double m_cycle_time;                        //!< the simulated time between cycles in ms
+
+    std::vector<Command> m_commands;            //!< the walk commands, in time order
+    std::vector<float> m_initial_positions;     //!< the joint positions at the start of each run
+    const std::vector<NUSensorsData>* m_sensor_log;  //!< the recorded sensor data, or NULL for synthetic sensors
+    bool m_capture;                             //!< true if the targets should be kept in the result
+    float m_gyro_sigma;                         //!< the standard deviation of the synthetic gyro noise in rad/s
+    float m_accel_sigma;                        //!< the standard deviation of the synthetic accelerometer noise in cm/s/s
+    uint32_t m_seed;                            //!< the seed for the noise at the start of each run
+    uint32_t m_random_state;                    //!< the current state of the noise generator
+
+    NUSensorsData* m_data;                      //!< the sensor data for the current run
+    NUActionatorsData* m_actions;               //!< the actionator data for the current run
+    std::vector<float> m_positions;             //!< the servo positions (and the targets in the previous cycle)
+    std::vector<float> m_gains;                 //!< the servo gains
+    std::vector<float> m_previous_positions;
+    std::vector<float> m_previous_velocities;
+
+    static pthread_mutex_t m_construction_mutex; //!< the sensor, actionator and walk constructors share static state, so only one may be running. It is held for the whole run of a walk that is not reentrant
+};
+
+#endif
+
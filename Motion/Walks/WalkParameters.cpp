@@ -21,6 +21,7 @@
 
 #include "WalkParameters.h"
 #include "../Tools/MotionFileTools.h"
+#include "Infrastructure/Jobs/JobCodec.h"
 
 #include "debug.h"
 #include "debugverbositynumotion.h"
@@ -431,6 +432,7 @@ std::istream& operator>> (std::istream& input, WalkParameters& p_walkparameters)
         {
             p_walkparameters.m_leg_gains = MotionFileTools::toFloatMatrix(input);
             p_walkparameters.m_num_leg_gains = MotionFileTools::size(p_walkparameters.m_leg_gains);
+            break;                      // the leg gains are written last, and anything after them (ie. the next job) is not ours
         }
         input >> label;
     }
@@ -446,6 +448,66 @@ std::istream& operator>> (std::istream& input, WalkParameters* p_walkparameters)
     return input;
 }
 
+/*! @brief Writes a matrix of gains as a uint8 number of rows followed by each row */
+static void putGains(JobWriter& output, const std::vector<std::vector<float> >& gains)
+{
+    output.putUint8(gains.size() > 255 ? 255 : gains.size());
+    for (size_t i=0; i<gains.size() and i<255; i++)
+        output.putFloats(gains[i]);
+}
+
+/*! @brief Reads a matrix of gains written by putGains, reusing the storage of gains, and returns the number of gains */
+static unsigned int getGains(JobReader& input, std::vector<std::vector<float> >& gains)
+{
+    unsigned int numgains = 0;
+    gains.resize(input.getUint8());
+    for (size_t i=0; i<gains.size(); i++)
+    {
+        input.getFloats(gains[i]);
+        numgains += gains[i].size();
+    }
+    return numgains;
+}
+
+/*! @brief Writes the entire contents of the WalkParameters into a buffer for the binary job format
+    @param output the writer to put the walk parameters in
+ */
+void WalkParameters::toBuffer(JobWriter& output) const
+{
+    output.putString(m_name);
+    output.putFloats(m_max_speeds);
+    output.putFloats(m_max_accelerations);
+    output.putUint16(m_parameters.size());
+    for (size_t i=0; i<m_parameters.size(); i++)
+        m_parameters[i].toBuffer(output);
+    putGains(output, m_arm_gains);
+    putGains(output, m_torso_gains);
+    putGains(output, m_leg_gains);
+}
+
+/*! @brief Reads walk parameters written by toBuffer. The storage of the current parameters is reused,
+           so reading a set of the same shape does not allocate.
+    @param input the reader from which to take the walk parameters
+ */
+void WalkParameters::fromBuffer(JobReader& input)
+{
+    input.getString(m_name);
+    input.getFloats(m_max_speeds);
+    input.getFloats(m_max_accelerations);
+    unsigned int numparameters = input.getUint16();
+    if (numparameters > static_cast<unsigned int>(input.remaining())/16)      // each parameter takes at least 16 bytes
+    {
+        numparameters = 0;
+        input.take(input.remaining() + 1);                                  // too many to be real, so fail the read
+    }
+    m_parameters.resize(numparameters);
+    for (size_t i=0; i<m_parameters.size(); i++)
+        m_parameters[i].fromBuffer(input);
+    m_num_arm_gains = getGains(input, m_arm_gains);
+    m_num_torso_gains = getGains(input, m_torso_gains);
+    m_num_leg_gains = getGains(input, m_leg_gains);
+}
+
 /*! @brief Saves the walk parameters to a file
  */
 void WalkParameters::save()
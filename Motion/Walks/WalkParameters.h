@@ -33,6 +33,8 @@
 #define WALKPARAMETERS_H
 
 #include "Tools/Optimisation/Parameter.h"
+class JobWriter;
+class JobReader;
 
 #include <vector>
 #include <string>
@@ -77,6 +79,8 @@ public:
     friend std::ostream& operator<< (std::ostream& output, const WalkParameters* p_walkparameters);
     friend std::istream& operator>> (std::istream& input, WalkParameters& p_walkparameters);
     friend std::istream& operator>> (std::istream& input, WalkParameters* p_walkparameters);
+    void toBuffer(JobWriter& output) const;
+    void fromBuffer(JobReader& input);
     void save();
     void saveAs(const std::string& name);
     void load(const std::string& name);
@@ -54,6 +54,9 @@ ENDIF()
 IF(NUBOT_USE_MOTION_WALK_DARWINWALK)
 	LIST(APPEND YOUR_DIRS DarwinWalk)
 ENDIF()
+IF(NUBOT_USE_MOTION_WALK_SIMULATION)
+	LIST(APPEND YOUR_DIRS Simulation)
+ENDIF()
 
 ####################################################################################
 
@@ -101,6 +101,13 @@ SET( NUBOT_USE_MOTION_WALK_DARWINWALK
      CACHE BOOL
      "Set to ON to use darwinwalk, set to OFF use something else")
 
+############################ offline walk tools
+
+SET( NUBOT_USE_MOTION_WALK_SIMULATION
+     OFF
+     CACHE BOOL
+     "Set to ON to build the offline walk simulator, set to OFF to leave it out")
+
 MARK_AS_ADVANCED(
 	NUBOT_USE_MOTION_WALK_JWALK
 	NUBOT_USE_MOTION_WALK_BWALK
@@ -111,6 +118,7 @@ MARK_AS_ADVANCED(
 	NUBOT_USE_MOTION_WALK_ALWALK
     	NUBOT_USE_MOTION_WALK_BEARWALK
 	NUBOT_USE_MOTION_WALK_DARWINWALK
+	NUBOT_USE_MOTION_WALK_SIMULATION
 )
 	
 
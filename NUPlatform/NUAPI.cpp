@@ -1,6 +1,11 @@
 #include "NUAPI.h"
 #include "../Tools/Math/Vector3.h"
+#include "nubotdataconfig.h"
+#include "debug.h"
 #include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include <boost/algorithm/string.hpp>
 //#include <png++/png.hpp>
 #include <boost/foreach.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -13,10 +18,55 @@ NUAPI::NUAPI() : context(1), publisher(context, ZMQ_PUB)
 	publisher.setsockopt(ZMQ_HWM, &hwm, sizeof (hwm));
 	publisher.bind("tcp://*:12000");
 
+	vision_encoder = new VisionEncoderThread();
+	vision_period = 200;
+	vision_time = -1e9;
+	vision_frames_skipped = 0;
+	loadConfig(std::string(CONFIG_DIR) + "API.cfg");
 }
 
 NUAPI::~NUAPI()
 {
+	delete vision_encoder;
+}
+
+/*! @brief Sets the rate the vision telemetry is sent
+	@param rate the number of vision messages per second, or 0 to not send them
+ */
+void NUAPI::setVisionRate(float rate)
+{
+	vision_period = rate > 0 ? 1000.0/rate : 0;
+}
+
+/*! @brief Sets the jpeg quality of the image in the vision telemetry
+	@param quality the quality from 1 to 100, or 0 to only send the classified scan lines and field objects
+ */
+void NUAPI::setImageQuality(int quality)
+{
+	vision_encoder->setImageQuality(quality);
+}
+
+/*! @brief Loads the vision rate and image quality from a config file of NAME: value lines
+	@param filename the path to the config file (normally API.cfg); if it can not be read the defaults are kept
+ */
+void NUAPI::loadConfig(const std::string& filename)
+{
+	std::ifstream in(filename.c_str());
+	if (not in.is_open())
+	{
+		errorlog << "NUAPI::loadConfig(). Unable to load " << filename << ", using the default vision rate and image quality" << std::endl;
+		return;
+	}
+	std::string name, value;
+	while (getline(in, name, ':') and getline(in, value))
+	{
+		boost::trim(name);
+		boost::to_upper(name);
+		if (name == "VISION_RATE")
+			setVisionRate(atof(value.c_str()));
+		else if (name == "IMAGE_QUALITY")
+			setImageQuality(atoi(value.c_str()));
+	}
 }
 
 void NUAPI::sendAll()
@@ -25,7 +75,7 @@ void NUAPI::sendAll()
 	//static unsigned int sum = 0;
 
 	//boost::posix_time::ptime t1 = microsec_clock::local_time();
-    //sendVisionData();
+    sendVisionData();
     //sendSensorData();
 	sendLocalisationData();
 	/*boost::posix_time::ptime t2 = microsec_clock::local_time();
@@ -40,12 +90,29 @@ void NUAPI::sendAll()
 	counter++;*/
 }
 
+/*! @brief Sends the vision telemetry, at most at the vision rate
+
+	The field objects and the run-length encoded scan lines are put into the message here, and then the message and a
+	copy of the image are handed to the encoder thread to compress. The message is published on a later frame, once
+	the encoder has finished. If the encoder is still busy with the previous message the frame is skipped, so this
+	never waits for the encoder.
+ */
 void NUAPI::sendVisionData()
 {
-	static unsigned char* pBuf[320 * 240 * 3];
+	std::string output;
+	if (vision_encoder->getEncoded(output))
+		s_send(publisher, output);
 
 	NUImage* image = Blackboard->Image;
 	FieldObjects* fieldObjects = Blackboard->Objects;
+	if (vision_period <= 0 or image == NULL or image->GetTimestamp() - vision_time < vision_period)
+		return;
+	if (not vision_encoder->isReady())
+	{
+		vision_frames_skipped++;
+		return;
+	}
+	vision_time = image->GetTimestamp();
 
 	API::Message api_message;
 
@@ -53,74 +120,7 @@ void NUAPI::sendVisionData()
 	api_message.set_utc_timestamp(std::time(0));
 
 	API::Vision* api_vision = api_message.mutable_vision();
-	/*API::Image* api_image = api_vision->mutable_image();
-
-	unsigned int image_width = image->getWidth();
-	unsigned int image_height = image->getHeight();
-	
-	unsigned int image_size = 0;
-
-	jpge::uint8* data = new jpge::uint8[image_width * image_height * 3]();
-
-	int index = 0;
-	for (int y = image_height - 1; y >= 0; y--)
-	{
-		for (int x = image_width - 1; x >= 0; x--)
-		{
-			Pixel pixel = image->at(x, y);
-
-			unsigned char r, g, b;
-			ColorModelConversions::fromYCbCrToRGB((unsigned char) pixel.y, (unsigned char) pixel.cb, (unsigned char) pixel.cr, r, g, b);
-
-			data[index] = r;
-			data[index + 1] = g;
-			data[index + 2] = b;
-
-			index += 3;
-		}
-	}
-
-	//int orig_buf_size = image_width * image_height * 3; // allocate a buffer that's hopefully big enough (this is way overkill for jpeg)
-	//if (orig_buf_size < 1024) orig_buf_size = 1024;
-	//void *pBuf = malloc(orig_buf_size);
-	int c_size = sizeof(pBuf);
-	jpge::params params;
-	params.m_quality = 100;
-	jpge::compress_image_to_jpeg_file_in_memory(pBuf, c_size, image_width, image_height, 3, data, params);
-
-	delete[] data;
-	
-	image_size = c_size;
-
-	//free(pBuf);*/
-
-	/*png::image< png::rgb_pixel > png_image(image_width, image_height);
-	for (int y = 0; y < image_height; y++) {
-		for (int x = 0; x< image_width; x++) {
-			Pixel pixel = image->at(x, y);
-
-			unsigned char r, g, b;
-			ColorModelConversions::fromYCbCrToRGB(
-					(unsigned char) pixel.y,
-					(unsigned char) pixel.cb,
-					(unsigned char) pixel.cr, r, g, b);
-			
-			png_image[image_height-1-y][image_width-1-x] = png::rgb_pixel(r, g, b);
-		}
-	}
-	std::stringstream image_data;
-	
-	png_image.write_stream(image_data);
-	image_data.seekg(0, std::ios::end);
-	image_size = image_data.tellg();
-	//std::cout << image_data.tellp() << " ";*/
-
-	/*api_image->set_width(image_width);
-	api_image->set_height(image_height);
-	api_image->set_data(pBuf, image_size);
-	//api_image->set_data(image_data.str().c_str(), image_size);
-	
-	//std::cout << image_size << std::endl;*/
+	api_vision->set_frames_skipped(vision_frames_skipped);
 
 	MobileObject& ball = fieldObjects->mobileFieldObjects[FieldObjects::FO_BALL];
 
@@ -129,9 +129,6 @@ void NUAPI::sendVisionData()
 
 	if (Blackboard->horizontalScans != NULL && Blackboard->verticalScans != NULL)
 	{
-		const vector<vector<ColourSegment> >& hColourSegments = Blackboard->horizontalScans->getSegments();
-		const vector<vector<ColourSegment> >& vColourSegments = Blackboard->verticalScans->getSegments();
-
 		for (auto& ambiguous_object : fieldObjects->ambiguousFieldObjects)
 		{
 			API::VisionFieldObject* api_field_object = api_vision->add_field_object();
@@ -141,44 +138,11 @@ void NUAPI::sendVisionData()
 		}
 
 		API::VisionClassifiedImage* api_classified_image = api_vision->mutable_classified_image();
-
-		for (auto& rowColourSegments : hColourSegments)
-		{
-
-			for (auto& colorSegment : rowColourSegments)
-			{
-				const Point& start = colorSegment.getStart();
-				const Point& end = colorSegment.getEnd();
-				Colour colour = colorSegment.getColour();
-
-				API::VisionClassifiedSegment* api_segment = api_classified_image->add_segment();
-				api_segment->set_start_x(start[0]);
-				api_segment->set_start_y(start[1]);
-				api_segment->set_end_x(end[0]);
-				api_segment->set_end_y(end[1]);
-				api_segment->set_colour(colour);
-			}
-		}
-
-		for (auto& columnColourSegments : vColourSegments)
-		{
-			for (auto& colorSegment : columnColourSegments)
-			{
-				const Point& start = colorSegment.getStart();
-				const Point& end = colorSegment.getEnd();
-				Colour colour = colorSegment.getColour();
-
-				API::VisionClassifiedSegment* api_segment = api_classified_image->add_segment();
-				api_segment->set_start_x(start[0]);
-				api_segment->set_start_y(start[1]);
-				api_segment->set_end_x(end[0]);
-				api_segment->set_end_y(end[1]);
-				api_segment->set_colour(colour);
-			}
-		}
+		encode_runs(*Blackboard->horizontalScans, *api_classified_image->mutable_horizontal_runs());
+		encode_runs(*Blackboard->verticalScans, *api_classified_image->mutable_vertical_runs());
 	}
 
-	send(api_message);
+	vision_encoder->encode(api_message, *image);
 }
 
 void NUAPI::sendSensorData()
@@ -333,3 +297,46 @@ void NUAPI::api_add_vector(API::Vector* api_vector, vector<T>& vec)
 		api_vector->add_float_value(value);
 	}
 }
+
+/*! @brief Run-length encodes the segments of each scan line in the region, in the format described in NUAPI.proto
+	@param region the horizontal or vertical scan lines
+	@param runs will be updated with the encoded scan lines
+ */
+void NUAPI::encode_runs(const SegmentedRegion& region, std::string& runs)
+{
+	const bool horizontal = region.getDirection() == Vision::HORIZONTAL;
+	const vector<vector<ColourSegment> >& lines = region.getSegments();
+
+	runs.clear();
+	runs.reserve(16*lines.size());
+	auto put_varint = [&runs](unsigned int value)
+	{
+		while (value >= 0x80)
+		{
+			runs.push_back(static_cast<char>((value & 0x7F) | 0x80));
+			value >>= 7;
+		}
+		runs.push_back(static_cast<char>(value));
+	};
+
+	for (auto& line : lines)
+	{
+		if (line.empty())
+			continue;
+		const Point& first = line.front().getStart();
+		put_varint(static_cast<unsigned int>(horizontal ? first.y : first.x));
+		put_varint(line.size());
+
+		int previous_end = 0;
+		for (auto& segment : line)
+		{
+			int start = static_cast<int>(horizontal ? segment.getStart().x : segment.getStart().y);
+			int end = static_cast<int>(horizontal ? segment.getEnd().x : segment.getEnd().y);
+			int gap = start - previous_end;
+			put_varint((static_cast<unsigned int>(gap) << 1) ^ static_cast<unsigned int>(gap >> 31));
+			put_varint(static_cast<unsigned int>(std::max(end - start, 0)));
+			runs.push_back(static_cast<char>(segment.getColour()));
+			previous_end = end;
+		}
+	}
+}
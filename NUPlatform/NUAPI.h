@@ -45,6 +45,7 @@
 #include "../Infrastructure/NUData.h"
 
 #include "NUAPI/proto/NUAPI.pb.h"
+#include "NUAPI/VisionEncoderThread.h"
 
 #ifndef NUAPI_H
 #define	NUAPI_H
@@ -66,11 +67,22 @@ public:
 	//void get_jpeg_image(void*& image, unsigned int& size);
 	//void get_png_image(std::stringstream& image, unsigned int& size);
 
+	void setVisionRate(float rate);
+	void setImageQuality(int quality);
+
 	void send(API::Message api_message);
 private:
+	void loadConfig(const std::string& filename);
+
 	zmq::context_t context;
 	zmq::socket_t publisher;
 
+	VisionEncoderThread* vision_encoder;		//!< compresses and serialises the vision messages off the see-think thread
+	double vision_period;						//!< the time between vision messages in ms, or 0 to not send them
+	double vision_time;							//!< the image time of the last vision message in ms
+	unsigned int vision_frames_skipped;			//!< the number of vision messages skipped because the encoder was busy
+
+	void encode_runs(const SegmentedRegion& region, std::string& runs);
 	void populate_vision_field_object(std::string name, Object& field_object, API::VisionFieldObject* api_field_object, API::VisionFieldObject::Type type);
 
 	template <typename T>
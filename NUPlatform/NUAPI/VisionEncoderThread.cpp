@@ -0,0 +1,194 @@
+/*! @file VisionEncoderThread.cpp
+    @brief Implementation of a low priority thread for compressing vision telemetry
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VisionEncoderThread.h"
+
+#include "Infrastructure/NUImage/NUImage.h"
+#include "Infrastructure/NUImage/ColorModelConversions.h"
+#include "Infrastructure/NUImage/lib/jpge.h"
+
+#include "debug.h"
+#include "debugverbositynetwork.h"
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+/*! @brief Creates and starts the encoder thread. The thread is not real-time, so it only uses the time left over by the real-time threads.
+ */
+VisionEncoderThread::VisionEncoderThread() : ConditionalThread(std::string("VisionEncoderThread"), 0)
+{
+    #if DEBUG_NETWORK_VERBOSITY > 0
+        debug << "VisionEncoderThread::VisionEncoderThread() with priority " << static_cast<int>(m_priority) << std::endl;
+    #endif
+    pthread_mutex_init(&m_mutex, NULL);
+    m_busy = false;
+    m_has_encoded = false;
+    m_encode_time = 0;
+    m_width = 0;
+    m_height = 0;
+    m_quality = 50;
+    start();
+}
+
+VisionEncoderThread::~VisionEncoderThread()
+{
+    #if DEBUG_NETWORK_VERBOSITY > 0
+        debug << "VisionEncoderThread::~VisionEncoderThread()" << std::endl;
+    #endif
+    stop();
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/*! @brief Returns true if the encoder has finished the previous message, and can take another
+ */
+bool VisionEncoderThread::isReady()
+{
+    pthread_mutex_lock(&m_mutex);
+    bool ready = not m_busy;
+    pthread_mutex_unlock(&m_mutex);
+    return ready;
+}
+
+/*! @brief Starts encoding a message. The image is copied, so it can be reused as soon as this returns. This must only be called when isReady().
+    @param message the vision message, with everything but the image filled in
+    @param image the image to compress into the message
+ */
+void VisionEncoderThread::encode(const API::Message& message, const NUImage& image)
+{
+    m_message = message;
+    m_width = image.getWidth();
+    m_height = image.getHeight();
+    m_pixels.resize(m_width*m_height);
+    for (int y = 0; y < m_height; y++)
+        memcpy(&m_pixels[y*m_width], &image.at(0, y), m_width*sizeof(Pixel));
+
+    pthread_mutex_lock(&m_mutex);
+    m_busy = true;
+    pthread_mutex_unlock(&m_mutex);
+    signal(true);           // the encoder is not busy, so at worst this waits for it to get back to wait()
+}
+
+/*! @brief Gets the most recently encoded message, if it has not been collected already
+    @param output will be updated with the serialised message
+    @return true if there was a new message
+ */
+bool VisionEncoderThread::getEncoded(std::string& output)
+{
+    bool encoded = false;
+    pthread_mutex_lock(&m_mutex);
+    if (m_has_encoded)
+    {
+        output.swap(m_encoded);
+        m_has_encoded = false;
+        encoded = true;
+    }
+    pthread_mutex_unlock(&m_mutex);
+    return encoded;
+}
+
+/*! @brief Sets the jpeg quality of the image
+    @param quality the quality from 1 to 100, or 0 to leave the image out of the message
+ */
+void VisionEncoderThread::setImageQuality(int quality)
+{
+    pthread_mutex_lock(&m_mutex);
+    m_quality = std::max(0, std::min(quality, 100));
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/*! @brief Returns the thread time taken to encode the most recent message in ms
+ */
+double VisionEncoderThread::getEncodeTime()
+{
+    pthread_mutex_lock(&m_mutex);
+    double time = m_encode_time;
+    pthread_mutex_unlock(&m_mutex);
+    return time;
+}
+
+/*! @brief The encoder's main loop
+ */
+void VisionEncoderThread::run()
+{
+    #if DEBUG_NETWORK_VERBOSITY > 0
+        debug << "VisionEncoderThread::run()" << std::endl;
+    #endif
+
+    int err = 0;
+    while (err == 0 && errno != EINTR)
+    {
+        wait();
+        // -----------------------------------------------------------------------------------------------------------------------------------------------------------------
+        struct timespec start, end;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+
+        compress();
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+        double encodetime = 1e3*(end.tv_sec - start.tv_sec) + 1e-6*(end.tv_nsec - start.tv_nsec);
+        m_message.mutable_vision()->set_encode_time(static_cast<unsigned int>(1e3*encodetime));
+
+        std::string output;
+        m_message.SerializeToString(&output);
+
+        pthread_mutex_lock(&m_mutex);
+        m_encoded.swap(output);
+        m_has_encoded = true;
+        m_encode_time = encodetime;
+        m_busy = false;
+        pthread_mutex_unlock(&m_mutex);
+        // -----------------------------------------------------------------------------------------------------------------------------------------------------------------
+    }
+    errorlog << "VisionEncoderThread is exiting. err: " << err << " errno: " << errno << std::endl;
+}
+
+/*! @brief Compresses the copy of the image into the message
+ */
+void VisionEncoderThread::compress()
+{
+    pthread_mutex_lock(&m_mutex);
+    int quality = m_quality;
+    pthread_mutex_unlock(&m_mutex);
+    if (quality <= 0 or m_width <= 0 or m_height <= 0)
+        return;
+
+    // the raw image is upside down, so it is converted starting from the last pixel
+    m_rgb.resize(3*m_width*m_height);
+    unsigned char* rgb = &m_rgb[0];
+    for (int i = m_width*m_height - 1; i >= 0; i--)
+    {
+        const Pixel& pixel = m_pixels[i];
+        ColorModelConversions::fromYCbCrToRGB(pixel.y, pixel.cb, pixel.cr, rgb[0], rgb[1], rgb[2]);
+        rgb += 3;
+    }
+
+    // the jpeg will be much smaller than the raw image; if it somehow isn't the image is left out
+    int size = std::max(1024, 3*m_width*m_height);
+    m_jpeg.resize(size);
+    jpge::params params;
+    params.m_quality = quality;
+    if (jpge::compress_image_to_jpeg_file_in_memory(&m_jpeg[0], size, m_width, m_height, 3, &m_rgb[0], params))
+    {
+        API::Image* api_image = m_message.mutable_vision()->mutable_image();
+        api_image->set_width(m_width);
+        api_image->set_height(m_height);
+        api_image->set_data(&m_jpeg[0], size);
+    }
+    else
+        errorlog << "VisionEncoderThread::compress(). Failed to compress the image." << std::endl;
+}
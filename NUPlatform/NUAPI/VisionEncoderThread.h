@@ -0,0 +1,70 @@
+/*! @file VisionEncoderThread.h
+    @brief Declaration of a low priority thread for compressing vision telemetry
+
+    @class VisionEncoderThread
+    @brief A low priority thread that compresses the image with jpge and serialises the vision telemetry message
+
+    The see-think thread checks isReady(), hands over a message and a copy of the image with encode(), and collects
+    the result on a later frame with getEncoded(). It never waits for the encoder: if the encoder is still busy
+    the frame is simply not sent.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VISIONENCODERTHREAD_H
+#define VISIONENCODERTHREAD_H
+
+#include "Tools/Threading/ConditionalThread.h"
+#include "Infrastructure/NUImage/Pixel.h"
+#include "proto/NUAPI.pb.h"
+
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+class NUImage;
+
+class VisionEncoderThread : public ConditionalThread
+{
+public:
+    VisionEncoderThread();
+    ~VisionEncoderThread();
+
+    bool isReady();
+    void encode(const API::Message& message, const NUImage& image);
+    bool getEncoded(std::string& output);
+
+    void setImageQuality(int quality);
+    double getEncodeTime();
+protected:
+    void run();
+private:
+    void compress();
+private:
+    pthread_mutex_t m_mutex;                //!< lock protecting m_busy, m_encoded, m_has_encoded and m_encode_time
+    bool m_busy;                            //!< true from encode() until the message has been serialised
+    std::string m_encoded;                  //!< the most recent serialised message
+    bool m_has_encoded;                     //!< true if m_encoded has not been collected yet
+    double m_encode_time;                   //!< the thread time taken to encode the most recent message in ms
+
+    API::Message m_message;                 //!< the message being encoded. Only the caller touches it while not busy, and only the encoder while busy
+    std::vector<Pixel> m_pixels;            //!< the copy of the image being encoded, in raw order
+    int m_width;                            //!< the width of the image being encoded
+    int m_height;                           //!< the height of the image being encoded
+    int m_quality;                          //!< the jpeg quality 1-100, or 0 to not send the image
+    std::vector<unsigned char> m_rgb;       //!< the image converted to rgb for the encoder
+    std::vector<unsigned char> m_jpeg;      //!< the compressed image
+};
+
+#endif
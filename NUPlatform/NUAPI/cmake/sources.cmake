@@ -20,7 +20,7 @@ IF(DEBUG)
 ENDIF()
 
 ########## List your source files here! ############################################
-SET (YOUR_SRCS  
+SET (YOUR_SRCS  VisionEncoderThread.cpp VisionEncoderThread.h
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
@@ -1,5 +1,6 @@
 #include "CameraSettings.h"
 #include "Tools/FileFormats/Parse.h"
+#include "Infrastructure/Jobs/JobCodec.h"
 #include "debug.h"
 #include <fstream>
 
@@ -333,3 +334,33 @@ std::istream& operator>> (std::istream& input, CameraSettings& p_cameraSetting)
     return input;
 }
 
+/*! @brief The settings in the order they are written, which is the order of getAsVector */
+static Parameter CameraSettings::* const BufferedSettings[] = {
+    &CameraSettings::p_brightness, &CameraSettings::p_contrast, &CameraSettings::p_saturation, &CameraSettings::p_gain,
+    &CameraSettings::p_exposure, &CameraSettings::p_autoWhiteBalance, &CameraSettings::p_hue, &CameraSettings::p_redChroma,
+    &CameraSettings::p_blueChroma, &CameraSettings::p_autoExposure, &CameraSettings::p_autoGain, &CameraSettings::p_powerLineFrequency,
+    &CameraSettings::p_whiteBalanceTemperature, &CameraSettings::p_sharpness, &CameraSettings::p_exposureAuto,
+    &CameraSettings::p_exposureAbsolute, &CameraSettings::p_exposureAutoPriority};
+static const int NumBufferedSettings = sizeof(BufferedSettings)/sizeof(*BufferedSettings);
+
+/*! @brief Put the settings into a buffer. Like the stream format only the values are sent; every setting's range
+           (-180 to 10000) fits in an int16.
+ */
+void CameraSettings::toBuffer(JobWriter& output) const
+{
+    for (int i=0; i<NumBufferedSettings; i++)
+        output.putUint16(static_cast<int16_t>((this->*BufferedSettings[i]).get()));
+    output.putBool(p_valid);
+    output.putUint8(activeCamera);
+}
+
+/*! @brief Get the settings out of a buffer written by toBuffer
+ */
+void CameraSettings::fromBuffer(JobReader& input)
+{
+    for (int i=0; i<NumBufferedSettings; i++)
+        (this->*BufferedSettings[i]).set(static_cast<int16_t>(input.getUint16()));
+    p_valid = input.getBool();
+    activeCamera = CameraSettings::Camera(input.getUint8());
+    copyParams();
+}
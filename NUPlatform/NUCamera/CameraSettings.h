@@ -12,6 +12,9 @@
 #include <iostream>
 #include "Tools/Optimisation/Parameter.h"
 
+class JobWriter;
+class JobReader;
+
 /*!
     @brief Class used to store camera settings.
   */
@@ -152,6 +155,15 @@ class CameraSettings
         friend std::ostream& operator<< (std::ostream& output, const CameraSettings& p_cameraSetting);
         friend std::istream& operator>> (std::istream& input, CameraSettings& p_cameraSetting);
 
+        /*!
+            @brief Writes the same settings as the stream format into a buffer for the binary job format
+        */
+        void toBuffer(JobWriter& output) const;
+
+        /*!
+            @brief Reads settings written by toBuffer, and copies them into the int members
+        */
+        void fromBuffer(JobReader& input);
 
 };
 #endif
@@ -180,16 +180,13 @@ void NUIO::setJobToBroadcast()
 NUIO& operator<<(NUIO& io, NUbot& p_nubot)
 {
     #ifdef USE_NETWORK_DEBUGSTREAM
-        network_data_t netdata = io.m_vision_port->receiveData();
-        if(netdata.size > 0)
+        if(io.m_vision_port->hasRequests())
         {
-	   
             io.m_vision_port->sendData(*(Blackboard->Image), *(Blackboard->Sensors));
         }
         if(io.m_localisation_port)
         {
-            network_data_t locnetdata = io.m_localisation_port->receiveData();
-            if(locnetdata.size > 0)
+            if(io.m_localisation_port->hasRequests())
             {
                 #ifdef USE_LOCALISATION
                     io.m_localisation_port->sendData(*(p_nubot.GetLocWm()),*(Blackboard->Objects));
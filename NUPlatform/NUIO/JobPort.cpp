@@ -35,6 +35,7 @@ JobPort::JobPort(JobList* nubotjobs): UdpPort(std::string("JobPort"), JOBS_PORT,
         debug << "JobPort::JobPort(" << nubotjobs << ")" << std::endl;
     #endif
     m_jobs = nubotjobs;
+    m_send_buffer.resize(MaxPacketSize);
 }
 
 /*! @brief Closes the job port
@@ -76,9 +77,7 @@ void JobPort::setBroadcast()
  */
 JobPort& operator<<(JobPort& port, JobList& jobs)
 {   
-    std::stringstream buffer;
-    buffer << jobs;
-    port.sendData(buffer);
+    port.sendJobs(jobs);
     return port;
 }
 
@@ -88,12 +87,43 @@ JobPort& operator<<(JobPort& port, JobList& jobs)
  */
 JobPort& operator<<(JobPort& port, JobList* jobs)
 {
-    std::stringstream buffer;
-    buffer << *jobs;
-    port.sendData(buffer);
+    port.sendJobs(*jobs);
     return port;
 }
 
+/*! @brief Sends the jobs over the network in the binary job format
+    @param jobs the job list to send
+ */
+void JobPort::sendJobs(JobList& jobs)
+{
+    int size = jobs.encode(&m_send_buffer[0], m_send_buffer.size());
+    if (size > 0)
+        sendData(&m_send_buffer[0], size);
+    else
+        errorlog << "JobPort::sendJobs(). The " << jobs.size() << " jobs are too large to send." << std::endl;
+}
+
+/*! @brief Decodes the received jobs straight into the public nubot joblist. Packets in the
+           old stream format are still accepted, and are passed to handleNewData(std::stringstream&).
+    @param data the received data
+    @param size the number of bytes received
+ */
+void JobPort::handleNewData(const char* data, int size)
+{
+    if (not JobList::isEncoded(data, size))
+    {
+        UdpPort::handleNewData(data, size);
+        return;
+    }
+    #if DEBUG_NETWORK_VERBOSITY > 0
+        debug << "JobPort::handleNewData()" << std::endl;
+    #endif
+    m_jobs->decode(data, size);
+    #if DEBUG_NETWORK_VERBOSITY > 0
+        m_jobs->summaryTo(debug);
+    #endif
+}
+
 /*! @brief Copies the received data into the public nubot joblist
     @param buffer containing the joblist
 */
@@ -26,6 +26,7 @@
 
 #include "UdpPort.h"
 #include <string>
+#include <vector>
 
 class JobList;
 
@@ -42,9 +43,13 @@ public:
     friend JobPort& operator<<(JobPort& port, JobList* jobs);
 private:
     void handleNewData(std::stringstream& buffer);
+    void handleNewData(const char* data, int size);
+    void sendJobs(JobList& jobs);
 public:
 private:
+    static const int MaxPacketSize = 10*1024;       //!< the largest packet the UdpPort will receive
     JobList* m_jobs;
+    std::vector<char> m_send_buffer;                //!< the buffer the outgoing jobs are encoded into
 };
 
 #endif
@@ -1,14 +1,10 @@
 /*! @file TCPPort.cpp
     @brief Implementation of TcpPort class.
-    
-    Note: This does not support simultaneous connections, and does not close sockets properly.
-    
-    Someone please rewrite me.
 
     @author Aaron Wong, Jason Kulk
- 
+
  Copyright (c) 2009 Aaron Wong, Jason Kulk
- 
+
     This file is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
     the Free Software Foundation, either version 3 of the License, or
@@ -35,9 +31,27 @@
 #endif
 #include "Infrastructure/FieldObjects/FieldObjects.h"
 
-/*! @brief Constructs a tcp port on the specified port
- 
+#ifndef WIN32
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/uio.h>
+    #include <sys/select.h>
+#endif
+#if defined(__linux__)
+    #include <sys/epoll.h>
+#endif
+#include <algorithm>
 
+#ifdef WIN32
+    #define closeSocket(fd) closesocket(fd)
+#else
+    #define closeSocket(fd) close(fd)
+#endif
+
+const unsigned int TcpPort::MaxQueuedFrames;
+const int TcpPort::MaxRequests;
+
+/*! @brief Constructs a tcp port on the specified port, and starts listening for clients
     @param portnumber the port number the data will be sent and received on
  */
 TcpPort::TcpPort(int portnumber): Thread(std::string("Tcp Thread"), 0)
@@ -54,7 +68,7 @@ TcpPort::TcpPort(int portnumber): Thread(std::string("Tcp Thread"), 0)
     debug << "TcpPort::TcpPort(" << portnumber << ")" << std::endl;
 #endif
     m_port_number = portnumber;
-    if ((m_sockfd = socket(AF_INET, SOCK_STREAM, 0)) == -1) 
+    if ((m_sockfd = socket(AF_INET, SOCK_STREAM, 0)) == -1)
         errorlog << "TcpPort::TcpPort(" << m_port_number << "). Failed to create socket file descriptor." << std::endl;
 
     // Set the reuse address flag
@@ -65,235 +79,575 @@ TcpPort::TcpPort(int portnumber): Thread(std::string("Tcp Thread"), 0)
     #endif
     if (setsockopt(m_sockfd, SOL_SOCKET, SO_REUSEADDR, &reuseflag, sizeof(reuseflag)) == -1)
         errorlog << "TcpPort::TcpPort(). Failed to set reuseaddr socket options, errno: " << errno << std::endl;
-      
+
     m_address.sin_family = AF_INET;                             // host byte order
     m_address.sin_port = htons(m_port_number);                  // short, network byte order
     m_address.sin_addr.s_addr = htonl(INADDR_ANY);                     // automatically fill with my IP
     memset(m_address.sin_zero, '\0', sizeof m_address.sin_zero);
-    
-    m_broadcast_address.sin_family = AF_INET;                   // host byte order
-    m_broadcast_address.sin_port = htons(m_port_number);        // short, network byte order 
-    m_broadcast_address.sin_addr.s_addr = htonl(INADDR_BROADCAST);     // automatically fill with my local Broadcast IP
-    memset(m_broadcast_address.sin_zero, '\0', sizeof m_broadcast_address.sin_zero);
-    
+
 #if DEBUG_NETWORK_VERBOSITY > 4
     debug << "TcpPort::TcpPort(). Binding socket." << std::endl;
 #endif
     if (::bind(m_sockfd, (struct sockaddr *)&m_address, sizeof m_address) == -1)
         errorlog << "TcpPort::TcpPort(" << portnumber << "). Failed to bind socket." << std::endl;
-    
-    m_time_last_receive = 0;           //!< @todo TODO: change the initial value for this to something -3000ms!
-    
-    m_message_size = 0;
-    m_has_data = false;
-    m_clientSockfd = -1;
-    pthread_mutex_init(&m_socket_mutex, NULL);
-    
+    if (::listen(m_sockfd, 5) == -1)
+        errorlog << "TcpPort::TcpPort(" << portnumber << "). Failed to listen on socket." << std::endl;
+
+    #ifndef WIN32
+        fcntl(m_sockfd, F_SETFL, fcntl(m_sockfd, F_GETFL, 0) | O_NONBLOCK);
+        if (pipe(m_wake_fds) == -1)
+            errorlog << "TcpPort::TcpPort(" << portnumber << "). Failed to create wake pipe, errno: " << errno << std::endl;
+        fcntl(m_wake_fds[0], F_SETFL, fcntl(m_wake_fds[0], F_GETFL, 0) | O_NONBLOCK);
+        fcntl(m_wake_fds[1], F_SETFL, fcntl(m_wake_fds[1], F_GETFL, 0) | O_NONBLOCK);
+    #else
+        u_long nonblocking = 1;
+        ioctlsocket(m_sockfd, FIONBIO, &nonblocking);
+        m_wake_fds[0] = -1;                                     // there are no selectable pipes on windows, so select times out instead
+        m_wake_fds[1] = -1;
+    #endif
+
+    m_poll_fd = -1;
+    #if defined(__linux__)
+        m_poll_fd = epoll_create(16);
+        if (m_poll_fd == -1)
+            errorlog << "TcpPort::TcpPort(" << portnumber << "). Failed to create epoll instance, errno: " << errno << std::endl;
+        watch(m_sockfd, false, true);
+        watch(m_wake_fds[0], false, true);
+    #endif
+
+    m_next_frame = NULL;
+    m_num_requests = 0;
+    m_num_clients = 0;
+    m_stopping = false;
+    pthread_mutex_init(&m_mutex, NULL);
+
     start();
 }
 
-/*! @brief Closes the udp port
+/*! @brief Stops the port's thread, and closes all of the sockets
  */
 TcpPort::~TcpPort()
 {
-#ifdef WIN32
-    closesocket(m_sockfd);
-    WSACleanup();
-#endif
-#ifndef WIN32
-    close(m_sockfd);
-#endif
-    pthread_mutex_destroy(&m_socket_mutex);
+    pthread_mutex_lock(&m_mutex);
+    m_stopping = true;
+    pthread_mutex_unlock(&m_mutex);
+    wake();
+    join();
+
+    while (not m_clients.empty())
+        closeClient(m_clients.back());
+    if (m_next_frame != NULL)
+        release(m_next_frame);
+
+    closeSocket(m_sockfd);
+    #ifndef WIN32
+        close(m_wake_fds[0]);
+        close(m_wake_fds[1]);
+    #else
+        WSACleanup();
+    #endif
+    if (m_poll_fd != -1)
+        close(m_poll_fd);
+    pthread_mutex_destroy(&m_mutex);
 }
 
-/*! @brief Run the TCP port's main loop
- 
-    Waits until data is received on the appropriate port.
-    Then copies it to m_data, setting m_message_size, m_has_data and m_time_last_receive in the process
+/*! @brief Returns true if a client is waiting for a frame. There is no point creating a frame when this is false, sendData will discard it.
  */
-void TcpPort::run()
+bool TcpPort::hasRequests()
 {
-#if DEBUG_NETWORK_VERBOSITY > 4
-    debug << "TcpPort::run(). Starting udpport:" << m_port_number << "'s mainloop" << std::endl;
-#endif
-    struct sockaddr_in local_their_addr; // connector's address information
-    socklen_t local_addr_len = sizeof(local_their_addr);
-    char localdata[10*1024];
-    int localnumBytes = 0;
-    ::listen(m_sockfd,5);     //Start Listening for Clients
-	
-	// a horrible hack to close the last connection.
-	// idealy should be rewritten to properly support multiple
-	// connections and handle edge cases
-	int m_oldClientSockfd = m_clientSockfd;
-
-    while(1)
-    {
-		m_oldClientSockfd = m_clientSockfd;
-		
-        m_clientSockfd = accept(m_sockfd, (struct sockaddr *)&local_their_addr, &local_addr_len);
-		
-		// close the last connection if it exists
-		if (m_oldClientSockfd != -1)
-		{
-			#ifdef WIN32
-				closesocket(m_oldClientSockfd);
-				WSACleanup();
-			#endif
-			#ifndef WIN32
-				close(m_oldClientSockfd);
-			#endif
-		}
-		
-        #ifdef WIN32
-            localnumBytes = recv(m_clientSockfd, localdata, sizeof(localdata),0);
-        #endif
-        #ifndef WIN32
-            localnumBytes = read(m_clientSockfd, localdata,sizeof(localdata));
-        #endif
-        if ( localnumBytes != -1 && local_their_addr.sin_addr.s_addr != m_address.sin_addr.s_addr && local_their_addr.sin_addr.s_addr != m_broadcast_address.sin_addr.s_addr)
-        {   //!< @todo TODO: This doesn't work. You need to discard packets that you have sent yourself
-            #if DEBUG_NETWORK_VERBOSITY > 3
-                debug << "TcpPort::run()." << m_port_number <<" Received " << localnumBytes << " bytes from " << inet_ntoa(local_their_addr.sin_addr) << std::endl;
-            #endif
-            #if DEBUG_NETWORK_VERBOSITY > 4
-                debug << "TcpPort::run(). Received ";
-                for (int i=0; i<localnumBytes; i++)
-                    debug << localdata[i];
-                debug << std::endl;
-            #endif
-
-            pthread_mutex_lock(&m_socket_mutex);
-            memcpy(m_data, localdata, 10*1024);
-            m_message_size = localnumBytes; 
-            m_has_data = true;
-            pthread_mutex_unlock(&m_socket_mutex);
-        }
-        
-    }
-    return;
+    pthread_mutex_lock(&m_mutex);
+    bool requests = m_num_requests > 0;
+    pthread_mutex_unlock(&m_mutex);
+    return requests;
 }
 
-/*! @brief Wraps the received data (m_data) into a network_data_t and returns it
-        
-    @return the data received is returned. If there is not data then the returned object will have a size of -1
+/*! @brief Returns the number of connected clients
  */
-network_data_t TcpPort::receiveData()
+int TcpPort::getNumClients()
 {
-    network_data_t netdata;
-    netdata.size = -1;
-    netdata.data = NULL; 
-    
-    pthread_mutex_lock(&m_socket_mutex);
-    if (m_has_data == true)
-    {
-        netdata.size = m_message_size;
-        netdata.data = new char[m_message_size];
-        memcpy(netdata.data, m_data, m_message_size);
-        m_has_data = false;
-    }
-    pthread_mutex_unlock(&m_socket_mutex);
-    #if DEBUG_NETWORK_VERBOSITY > 4
-    debug << "TCP Recieved: " << netdata.size;
-    #endif
-    return netdata;
+    pthread_mutex_lock(&m_mutex);
+    int clients = m_num_clients;
+    pthread_mutex_unlock(&m_mutex);
+    return clients;
 }
 
-/*! @brief Sends the network data (netdata) to all local hosts provided I think someone is listening
+/*! @brief Sends a copy of the network data (netdata) as a single frame to each client waiting for a frame
  */
 void TcpPort::sendData(network_data_t netdata)
 {
-    pthread_mutex_lock(&m_socket_mutex);
-    if (m_clientSockfd == -1)
-    {   
-        #if DEBUG_NETWORK_VERBOSITY > 4
-        debug << "TcpPort::sendData(). No connected client "<< std::endl;
-        #endif
+    if (not hasRequests() or netdata.size <= 0)
         return;
-    }
-    #if DEBUG_NETWORK_VERBOSITY > 4
-        debug << "TcpPort::sendData(). Sending " << netdata.size << " bytes to Requested"  << std::endl;
-
-        //debug << "DATA 1st 4 bytes: "<< (int)netdata.data[0] << ","<<(int)netdata.data[1] << "," << (int)netdata.data[2] << "," << (int)netdata.data[3];
-    #endif
-    int localnumBytes(0);
-    #ifdef WIN32
-        localnumBytes = send(m_clientSockfd, netdata.data, netdata.size,0);
-    #else
-        localnumBytes = write(m_clientSockfd, netdata.data, netdata.size);
-    #endif
-    #if DEBUG_NETWORK_VERBOSITY > 4
-        if(localnumBytes < 0)
-            debug << "TcpPort::sendData(). Sending Error "<< std::endl;
-    #endif
-		
-    pthread_mutex_unlock(&m_socket_mutex);
-    return;
+    Frame* frame = new Frame();
+    frame->segments.push_back(std::vector<char>(netdata.data, netdata.data + netdata.size));
+    frame->size = netdata.size;
+    post(frame);
 }
 
+/*! @brief Sends an image and the sensor data as a single frame to each client waiting for a frame
+
+    The frame is the sensor data size, the image header, width, height, timestamp and flipped flag, then the raw pixels
+    row by row, and then the sensor data as text.
+ */
 void TcpPort::sendData(const NUImage& p_image, const NUSensorsData &p_sensors)
 {
-    network_data_t netdata;
-    std::stringstream buffer;
-    network_data_t sensordata;
+    if (not hasRequests())
+        return;
+
     std::stringstream sensorsbuffer;
     sensorsbuffer << p_sensors;
     std::string sensorsString = sensorsbuffer.str();
-    sensordata.data = (char*) sensorsString.c_str();
-    sensordata.size = sensorsString.size();
-    
-    int sensorsSize = sensordata.size;
+
+    int sensorsSize = sensorsString.size();
     NUImage::Header image_header = NUImage::currentVersionHeader();
     int imagewidth = p_image.getWidth();
     int imageheight = p_image.getHeight();
     double timeStamp = p_image.GetTimestamp();
     bool flipped = p_image.flipped;
+    std::stringstream buffer;
     buffer.write(reinterpret_cast<char*>(&sensorsSize), sizeof(sensorsSize));
     buffer.write(reinterpret_cast<char*>(&image_header), sizeof(image_header));
     buffer.write(reinterpret_cast<char*>(&imagewidth), sizeof(imagewidth));
     buffer.write(reinterpret_cast<char*>(&imageheight), sizeof(imageheight));
     buffer.write(reinterpret_cast<char*>(&timeStamp), sizeof(timeStamp));
     buffer.write(reinterpret_cast<char*>(&flipped), sizeof(flipped));
-    
-    std::string s = buffer.str();
-    netdata.data = (char*) s.c_str();
-    netdata.size = s.size();
-    
-    sendData(netdata);
-    
+    std::string header = buffer.str();
+
+    Frame* frame = new Frame();
+    frame->segments.resize(3);
+    frame->segments[0].assign(header.begin(), header.end());
+
+    const size_t linesize = sizeof(Pixel)*imagewidth;
+    std::vector<char>& pixels = frame->segments[1];
+    pixels.resize(linesize*imageheight);
     for(int y = 0; y < imageheight; y++)
     {
         const Pixel& line_start = p_image.at(0, y);    // We want to transmit the raw data, so use the at() access function or lines may get out of order.
-        network_data_t linedata;
-        linedata.data = (char*) &line_start;
-        linedata.size = sizeof(line_start)*imagewidth;
-        sendData(linedata);
+        memcpy(&pixels[y*linesize], &line_start, linesize);
     }
-    sendData(sensordata);
-    
+
+    frame->segments[2].assign(sensorsString.begin(), sensorsString.end());
+    frame->size = frame->segments[0].size() + frame->segments[1].size() + frame->segments[2].size();
+    post(frame);
 }
 
 #if defined(USE_LOCALISATION)
+    /*! @brief Sends the world model and the field objects as a single frame to each client waiting for a frame
+
+        The frame is the size of the data followed by the data.
+     */
     void TcpPort::sendData(const SelfLocalisation& p_locwm, const FieldObjects& p_objects)
     {
         #if DEBUG_NETWORK_VERBOSITY > 4
             debug << "Sending worldmodel packet" << std::endl;
         #endif
-        network_data_t netdata;
-        network_data_t sizedata;
+        if (not hasRequests())
+            return;
         std::stringstream buffer;
         p_locwm.writeStreamBinary(buffer);
         buffer << p_objects;
+        std::string data = buffer.str();
 
-        std::string string = buffer.str();
-        netdata.data = (char*) string.c_str();
-        netdata.size = string.size();
+        int totalsize = data.size();
+        Frame* frame = new Frame();
+        frame->segments.resize(2);
+        frame->segments[0].assign(reinterpret_cast<char*>(&totalsize), reinterpret_cast<char*>(&totalsize) + sizeof(totalsize));
+        frame->segments[1].assign(data.begin(), data.end());
+        frame->size = sizeof(totalsize) + data.size();
+        post(frame);
+    }
+#endif
 
-        int totalsize = netdata.size;
-        sizedata.data = reinterpret_cast<char*>(&totalsize);
-        sizedata.size = sizeof(totalsize);
+/*! @brief Hands a frame to the port's thread. If the thread has not yet queued the previous frame, the previous frame is stale and is dropped.
+ */
+void TcpPort::post(Frame* frame)
+{
+    frame->references = 0;
+    pthread_mutex_lock(&m_mutex);
+    Frame* stale = m_next_frame;
+    m_next_frame = frame;
+    pthread_mutex_unlock(&m_mutex);
+    if (stale != NULL)
+        delete stale;
+    wake();
+}
 
-        sendData(sizedata);
-        sendData(netdata);
-    }
+/*! @brief Wakes the port's thread from its wait
+ */
+void TcpPort::wake()
+{
+    #ifndef WIN32
+        char c = 0;
+        if (write(m_wake_fds[1], &c, 1) == -1 and errno != EAGAIN)
+            errorlog << "TcpPort::wake(). Failed to wake thread, errno: " << errno << std::endl;
+    #endif
+}
+
+/*! @brief Run the TCP port's main loop
+
+    Waits until there is a new client, a request, a new frame to send, or room to send more of a frame
+    and then deals with it. Nothing here blocks except the wait.
+ */
+void TcpPort::run()
+{
+#if DEBUG_NETWORK_VERBOSITY > 4
+    debug << "TcpPort::run(). Starting tcpport:" << m_port_number << "'s mainloop" << std::endl;
 #endif
+    std::vector<int> readable, writable;
+    while (true)
+    {
+        wait(readable, writable);
+
+        pthread_mutex_lock(&m_mutex);
+        bool stopping = m_stopping;
+        Frame* frame = m_next_frame;
+        m_next_frame = NULL;
+        pthread_mutex_unlock(&m_mutex);
+        if (stopping)
+        {
+            if (frame != NULL)
+                delete frame;
+            break;
+        }
+
+        for (size_t i=0; i<readable.size(); i++)
+        {
+            if (readable[i] == m_sockfd)
+                acceptClients();
+            else if (readable[i] == m_wake_fds[0])
+            {
+                #ifndef WIN32
+                    char buffer[64];
+                    while (read(m_wake_fds[0], buffer, sizeof(buffer)) > 0);
+                #endif
+            }
+            else
+            {
+                for (size_t j=0; j<m_clients.size(); j++)
+                {
+                    if (m_clients[j]->sockfd == readable[i])
+                    {
+                        if (not readClient(m_clients[j]))
+                            closeClient(m_clients[j]);
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (frame != NULL)
+            queueFrame(frame);
+
+        // write to the clients with queued frames. Clients that were waiting for room are only written to once they are writable
+        for (size_t j=0; j<m_clients.size(); j++)
+        {
+            Client* client = m_clients[j];
+            if (client->queue.empty())
+                continue;
+            if (client->waiting and std::find(writable.begin(), writable.end(), client->sockfd) == writable.end())
+                continue;
+            if (not writeClient(client))
+            {
+                closeClient(client);
+                j--;
+            }
+        }
+        updateRequests();
+    }
+    return;
+}
+
+/*! @brief Accepts all of the pending connections
+ */
+void TcpPort::acceptClients()
+{
+    struct sockaddr_in their_addr; // connector's address information
+    socklen_t addr_len = sizeof(their_addr);
+    int sockfd;
+    while ((sockfd = accept(m_sockfd, (struct sockaddr *)&their_addr, &addr_len)) != -1)
+    {
+        #if DEBUG_NETWORK_VERBOSITY > 3
+            debug << "TcpPort::acceptClients()." << m_port_number << " Connection from " << inet_ntoa(their_addr.sin_addr) << std::endl;
+        #endif
+        #ifndef WIN32
+            fcntl(sockfd, F_SETFL, fcntl(sockfd, F_GETFL, 0) | O_NONBLOCK);
+        #else
+            u_long nonblocking = 1;
+            ioctlsocket(sockfd, FIONBIO, &nonblocking);
+        #endif
+        #if defined(SO_NOSIGPIPE)
+            int nosigpipe = 1;
+            setsockopt(sockfd, SOL_SOCKET, SO_NOSIGPIPE, &nosigpipe, sizeof(nosigpipe));
+        #endif
+        Client* client = new Client();
+        client->sockfd = sockfd;
+        client->requests = 0;
+        client->offset = 0;
+        client->waiting = false;
+        m_clients.push_back(client);
+        watch(sockfd, false, true);
+        addr_len = sizeof(their_addr);
+    }
+    pthread_mutex_lock(&m_mutex);
+    m_num_clients = m_clients.size();
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/*! @brief Reads the requests from a client. Each byte received is a request for a frame.
+    @return false if the client has disconnected
+ */
+bool TcpPort::readClient(Client* client)
+{
+    char buffer[1024];
+    int received;
+    #ifdef WIN32
+        received = recv(client->sockfd, buffer, sizeof(buffer), 0);
+    #else
+        received = read(client->sockfd, buffer, sizeof(buffer));
+    #endif
+    if (received == 0)
+        return false;
+    else if (received < 0)
+        return errno == EAGAIN or errno == EWOULDBLOCK or errno == EINTR;
+
+    #if DEBUG_NETWORK_VERBOSITY > 3
+        debug << "TcpPort::readClient()." << m_port_number << " Received " << received << " bytes from client " << client->sockfd << std::endl;
+    #endif
+    client->requests = std::min(client->requests + received, MaxRequests);
+    return true;
+}
+
+/*! @brief Queues a new frame for the clients. Clients with an outstanding request get the frame added to their queue.
+           Clients that already have a frame waiting that has not been started get it replaced with the new one.
+ */
+void TcpPort::queueFrame(Frame* frame)
+{
+    for (size_t i=0; i<m_clients.size(); i++)
+    {
+        Client* client = m_clients[i];
+        size_t started = client->offset > 0 ? 1 : 0;
+        if (client->requests > 0 and client->queue.size() < MaxQueuedFrames)
+        {
+            client->requests--;
+            client->queue.push_back(frame);
+            frame->references++;
+        }
+        else if (client->queue.size() > started)
+        {   // the newest queued frame is stale
+            release(client->queue.back());
+            client->queue.back() = frame;
+            frame->references++;
+        }
+    }
+    if (frame->references == 0)
+        delete frame;
+}
+
+/*! @brief Writes as much of the client's queued frames as the socket will take with a single gathered write
+    @return false if the client has disconnected
+ */
+bool TcpPort::writeClient(Client* client)
+{
+    while (not client->queue.empty())
+    {
+        #ifndef WIN32
+            static const int MaxSegments = 16;
+            struct iovec iov[MaxSegments];
+            int count = 0;
+            size_t skip = client->offset;
+            for (size_t f=0; f<client->queue.size() and count < MaxSegments; f++)
+            {
+                const std::vector<std::vector<char> >& segments = client->queue[f]->segments;
+                for (size_t s=0; s<segments.size() and count < MaxSegments; s++)
+                {
+                    if (skip >= segments[s].size())
+                    {
+                        skip -= segments[s].size();
+                        continue;
+                    }
+                    iov[count].iov_base = const_cast<char*>(&segments[s][skip]);
+                    iov[count].iov_len = segments[s].size() - skip;
+                    skip = 0;
+                    count++;
+                }
+            }
+            #if defined(MSG_NOSIGNAL)
+                struct msghdr message;
+                memset(&message, 0, sizeof(message));
+                message.msg_iov = iov;
+                message.msg_iovlen = count;
+                ssize_t sent = sendmsg(client->sockfd, &message, MSG_NOSIGNAL);
+            #else
+                ssize_t sent = writev(client->sockfd, iov, count);
+            #endif
+        #else
+            const Frame* front = client->queue.front();
+            size_t skip = client->offset;
+            size_t s = 0;
+            while (skip >= front->segments[s].size())
+                skip -= front->segments[s++].size();
+            int sent = send(client->sockfd, &front->segments[s][skip], front->segments[s].size() - skip, 0);
+        #endif
+
+        if (sent < 0)
+        {
+            if (errno == EAGAIN or errno == EWOULDBLOCK)
+                break;
+            else if (errno == EINTR)
+                continue;
+            #if DEBUG_NETWORK_VERBOSITY > 3
+                debug << "TcpPort::writeClient()." << m_port_number << " Failed to send to client " << client->sockfd << ", errno: " << errno << std::endl;
+            #endif
+            return false;
+        }
+
+        // pop the frames that have been completely sent
+        client->offset += sent;
+        while (not client->queue.empty() and client->offset >= client->queue.front()->size)
+        {
+            client->offset -= client->queue.front()->size;
+            release(client->queue.front());
+            client->queue.pop_front();
+        }
+    }
+    updateClient(client);
+    return true;
+}
+
+/*! @brief Disconnects a client, and releases its queued frames
+ */
+void TcpPort::closeClient(Client* client)
+{
+    #if DEBUG_NETWORK_VERBOSITY > 3
+        debug << "TcpPort::closeClient()." << m_port_number << " Closing client " << client->sockfd << std::endl;
+    #endif
+    unwatch(client->sockfd);
+    closeSocket(client->sockfd);
+    for (size_t i=0; i<client->queue.size(); i++)
+        release(client->queue[i]);
+    m_clients.erase(std::find(m_clients.begin(), m_clients.end(), client));
+    delete client;
+
+    pthread_mutex_lock(&m_mutex);
+    m_num_clients = m_clients.size();
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/*! @brief Waits for the client's socket to become writable if there is still data queued, otherwise only waits for requests
+ */
+void TcpPort::updateClient(Client* client)
+{
+    bool waiting = not client->queue.empty();
+    if (waiting != client->waiting)
+    {
+        client->waiting = waiting;
+        watch(client->sockfd, waiting, false);
+    }
+}
+
+/*! @brief Updates the total number of outstanding requests
+ */
+void TcpPort::updateRequests()
+{
+    int requests = 0;
+    for (size_t i=0; i<m_clients.size(); i++)
+        requests += m_clients[i]->requests;
+    pthread_mutex_lock(&m_mutex);
+    m_num_requests = requests;
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/*! @brief Removes a client queue's reference to a frame, deleting the frame when no queue has it
+ */
+void TcpPort::release(Frame* frame)
+{
+    frame->references--;
+    if (frame->references <= 0)
+        delete frame;
+}
+
+/*! @brief Adds a socket to the set of sockets the port's thread waits on, or changes what it is waited for
+    @param sockfd the socket
+    @param writable true to also wait for the socket to become writable
+    @param add true if the socket is new to the set
+ */
+void TcpPort::watch(int sockfd, bool writable, bool add)
+{
+    #if defined(__linux__)
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        uint32_t events = EPOLLIN;
+        if (writable)
+            events |= EPOLLOUT;
+        event.events = events;
+        event.data.fd = sockfd;
+        if (epoll_ctl(m_poll_fd, add ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, sockfd, &event) == -1)
+            errorlog << "TcpPort::watch(" << sockfd << "). Failed to update epoll set, errno: " << errno << std::endl;
+    #endif
+}
+
+/*! @brief Removes a socket from the set of sockets the port's thread waits on */
+void TcpPort::unwatch(int sockfd)
+{
+    #if defined(__linux__)
+        struct epoll_event event;
+        epoll_ctl(m_poll_fd, EPOLL_CTL_DEL, sockfd, &event);
+    #endif
+}
+
+/*! @brief Waits until there is something for the port's thread to do
+    @param readable will be updated with the sockets with data to read (or connections to accept)
+    @param writable will be updated with the sockets that can be written to
+    @return the number of ready sockets
+ */
+int TcpPort::wait(std::vector<int>& readable, std::vector<int>& writable)
+{
+    readable.clear();
+    writable.clear();
+    #if defined(__linux__)
+        static const int MaxEvents = 32;
+        struct epoll_event events[MaxEvents];
+        int n = epoll_wait(m_poll_fd, events, MaxEvents, -1);
+        for (int i=0; i<n; i++)
+        {
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                readable.push_back(events[i].data.fd);
+            if (events[i].events & EPOLLOUT)
+                writable.push_back(events[i].data.fd);
+        }
+    #else
+        fd_set readset, writeset;
+        FD_ZERO(&readset);
+        FD_ZERO(&writeset);
+        int maxfd = m_sockfd;
+        FD_SET(m_sockfd, &readset);
+        if (m_wake_fds[0] != -1)
+        {
+            FD_SET(m_wake_fds[0], &readset);
+            maxfd = std::max(maxfd, m_wake_fds[0]);
+        }
+        for (size_t i=0; i<m_clients.size(); i++)
+        {
+            FD_SET(m_clients[i]->sockfd, &readset);
+            if (m_clients[i]->waiting)
+                FD_SET(m_clients[i]->sockfd, &writeset);
+            maxfd = std::max(maxfd, m_clients[i]->sockfd);
+        }
+        struct timeval timeout = {0, 10000};
+        int n = select(maxfd + 1, &readset, &writeset, NULL, m_wake_fds[0] != -1 ? NULL : &timeout);
+        if (n > 0)
+        {
+            if (FD_ISSET(m_sockfd, &readset))
+                readable.push_back(m_sockfd);
+            if (m_wake_fds[0] != -1 and FD_ISSET(m_wake_fds[0], &readset))
+                readable.push_back(m_wake_fds[0]);
+            for (size_t i=0; i<m_clients.size(); i++)
+            {
+                if (FD_ISSET(m_clients[i]->sockfd, &readset))
+                    readable.push_back(m_clients[i]->sockfd);
+                if (FD_ISSET(m_clients[i]->sockfd, &writeset))
+                    writable.push_back(m_clients[i]->sockfd);
+            }
+        }
+    #endif
+    return readable.size() + writable.size();
+}
@@ -1,13 +1,21 @@
-/*! @file UdpPort.h
-    @brief Declaration of UdpPort class.
+/*! @file TcpPort.h
+    @brief Declaration of TcpPort class.
 
-    @class UdpPort
-    @brief UdpPort class encapsulating a udp socket
+    @class TcpPort
+    @brief A tcp server streaming frames (images and sensors, or the world model) to any number of clients
+
+    Each byte a client sends is a request for one frame. The frames are written by the port's thread
+    without blocking the caller; sendData only has to copy the frame once, however many clients there are.
+    Each client has a short queue of frames, and when a client is slower than the robot the newest queued
+    frame that has not been started is replaced, so slow clients get fewer, fresher frames, and never
+    hold up the robot or the other clients.
+
+    On linux the port waits on an epoll set, elsewhere it falls back to select.
+
+    @author Aaron Wong, Jason Kulk
 
-    @author Aaron Wong
- 
  Copyright (c) 2009 Aaron Wong
- 
+
     This file is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
     the Free Software Foundation, either version 3 of the License, or
@@ -22,6 +30,9 @@
     along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef TCPPORT_H
+#define TCPPORT_H
+
 #ifdef WIN32
 
 #include <winsock.h>
@@ -42,6 +53,9 @@ class SelfLocalisation;
 class FieldObjects;
 
 #include <sstream>
+#include <vector>
+#include <deque>
+#include <string>
 
 
 typedef unsigned char byte;
@@ -59,29 +73,64 @@ class TcpPort : public Thread
 public:
     TcpPort(int portnumber);
     virtual ~TcpPort();
+    bool hasRequests();
+    int getNumClients();
     void sendData(network_data_t netData);
     void sendData(const NUImage& p_image, const NUSensorsData& p_sensors);
     #if defined(USE_LOCALISATION)
         void sendData(const SelfLocalisation& p_locwm, const FieldObjects& p_objects);
     #endif
-    network_data_t receiveData();
 private:
+    /*! @brief A frame to be sent to the clients. The frame is stored as segments so that it can be written with a single gathered write,
+               and is shared by every client it is queued for */
+    struct Frame
+    {
+        std::vector<std::vector<char> > segments;   //!< the data of the frame, in order
+        size_t size;                                //!< the total number of bytes in the frame
+        int references;                             //!< the number of client queues this frame is in
+    };
+    /*! @brief A connected client */
+    struct Client
+    {
+        int sockfd;                                 //!< the client's socket
+        int requests;                               //!< the number of frames the client has asked for that have not yet been queued
+        std::deque<Frame*> queue;                   //!< the frames waiting to be sent to this client; the front may be partially sent
+        size_t offset;                              //!< the number of bytes of the front frame already sent
+        bool waiting;                               //!< true if the socket is full and we are waiting for it to become writable
+    };
+    static const unsigned int MaxQueuedFrames = 2;  //!< the maximum number of frames queued for each client
+    static const int MaxRequests = 64;              //!< the maximum number of outstanding requests for each client
+
     void run();
-public:
+    void post(Frame* frame);
+    void wake();
+
+    void acceptClients();
+    bool readClient(Client* client);
+    bool writeClient(Client* client);
+    void queueFrame(Frame* frame);
+    void closeClient(Client* client);
+    void updateClient(Client* client);
+    void updateRequests();
+    static void release(Frame* frame);
+
+    void watch(int sockfd, bool writable, bool add);
+    void unwatch(int sockfd);
+    int wait(std::vector<int>& readable, std::vector<int>& writable);
 private:
-    int m_sockfd;                       //!< the socket
+    int m_sockfd;                       //!< the listening socket
     int m_port_number;                  //!< the port number of the socket
     sockaddr_in m_address;              //!< the socket address
-    sockaddr_in m_broadcast_address;    //!< the socket broadcast address
-    double m_time_last_receive;         //!< the time in milliseconds the last packet was received
-    
-    char m_data[10*1024];               //!< the data buffer for received data
-    int m_message_size;                 //!< the number of bytes received (ie the number of valid bytes in m_data)
-    bool m_has_data;                    //!< flag indicating whether new data has been received
 
-    pthread_mutex_t m_socket_mutex;     //!< lock to prevent simultaneous reading and writing on the same port
-
-    int m_clientSockfd;                 //!< Connected Clients socket
+    int m_poll_fd;                      //!< the epoll instance waiting on all of the sockets (linux only)
+    int m_wake_fds[2];                  //!< a pipe used to wake the port's thread when there is a new frame, or it needs to stop
+    std::vector<Client*> m_clients;     //!< the connected clients; only touched by the port's thread
 
+    pthread_mutex_t m_mutex;            //!< lock protecting the members shared with the port's thread (below)
+    Frame* m_next_frame;                //!< the newest frame posted but not yet queued for the clients
+    int m_num_requests;                 //!< the total number of outstanding requests over all clients
+    int m_num_clients;                  //!< the number of connected clients
+    bool m_stopping;                    //!< true when the port's thread should exit
 };
 
+#endif
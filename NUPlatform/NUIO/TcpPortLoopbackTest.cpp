@@ -0,0 +1,259 @@
+/*! @file TcpPortLoopbackTest.cpp
+    @brief A loopback throughput test of TcpPort with several fast and slow clients
+
+    Frames the size of a camera image are sent through a TcpPort to clients on 127.0.0.1. The fast
+    clients read as quickly as they can. The slow clients have a small receive buffer and pause after
+    every read, like NUView on a poor wireless link. Every client keeps two requests outstanding, and
+    checks the sequence number and contents of every frame it receives.
+
+    The test is run twice: at the camera's 30 Hz, where it checks that sendData never waits for a client
+    and that the fast clients get every frame, and then unthrottled, to measure the port's throughput.
+
+    Build and run from this directory with
+    @code
+        make TcpPortLoopbackTest && ./TcpPortLoopbackTest [port]
+    @endcode
+    It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TcpPort.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+static const int FrameSize = 311296;        //!< a 640x480 yuyv image plus the sensor data
+static const int NumFastClients = 3;
+static const int NumSlowClients = 2;
+static const int SlowReceiveBuffer = 16384; //!< the slow clients' receive buffer in bytes
+static const int SlowPause = 2000;          //!< the slow clients' pause after each read in us
+static const double PhaseDuration = 3;      //!< the length of each phase in s
+
+static int port = 10099;
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+/*! @brief A client thread; each frame starts with its sequence number, and every other byte is the sequence number mod 251 */
+struct Client
+{
+    bool slow;
+    volatile bool running;
+    volatile int frames;
+    volatile int corrupt;
+    int fd;
+    pthread_t thread;
+};
+
+static bool readAll(int fd, char* buffer, int size, bool slow)
+{
+    int received = 0;
+    while (received < size)
+    {
+        int chunk = slow ? std::min(size - received, 4096) : size - received;
+        int n = recv(fd, buffer + received, chunk, 0);
+        if (n <= 0)
+            return false;
+        received += n;
+        if (slow)
+            usleep(SlowPause);
+    }
+    return true;
+}
+
+static void* runClient(void* arg)
+{
+    Client* client = static_cast<Client*>(arg);
+    std::vector<char> frame(FrameSize);
+    char requests[2] = {1, 1};
+    send(client->fd, requests, 2, MSG_NOSIGNAL);
+    while (client->running)
+    {
+        if (not readAll(client->fd, &frame[0], FrameSize, client->slow))
+            break;
+        int sequence;
+        memcpy(&sequence, &frame[0], sizeof(sequence));
+        char expected = sequence % 251;
+        for (int i=sizeof(sequence); i<FrameSize; i += 997)
+        {
+            if (frame[i] != expected)
+            {
+                client->corrupt++;
+                break;
+            }
+        }
+        client->frames++;
+        send(client->fd, requests, 1, MSG_NOSIGNAL);
+    }
+    return NULL;
+}
+
+static Client* connectClient(bool slow)
+{
+    Client* client = new Client();
+    client->slow = slow;
+    client->running = true;
+    client->frames = 0;
+    client->corrupt = 0;
+    client->fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (slow)
+        setsockopt(client->fd, SOL_SOCKET, SO_RCVBUF, &SlowReceiveBuffer, sizeof(SlowReceiveBuffer));
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(client->fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        printf("Unable to connect to port %d\n", port);
+        exit(1);
+    }
+    pthread_create(&client->thread, NULL, runClient, client);
+    return client;
+}
+
+static void stopClient(Client* client)
+{
+    client->running = false;
+    shutdown(client->fd, SHUT_RDWR);
+    pthread_join(client->thread, NULL);
+    close(client->fd);
+}
+
+/*! @brief Sends frames for PhaseDuration at rate Hz (or as fast as possible if rate is 0), and reports what the clients received */
+static void runPhase(TcpPort& tcpport, double rate, std::vector<Client*>& clients)
+{
+    std::vector<char> data(FrameSize);
+    network_data_t netdata;
+    netdata.size = FrameSize;
+    netdata.data = &data[0];
+
+    std::vector<int> startframes;
+    for (size_t i=0; i<clients.size(); i++)
+        startframes.push_back(static_cast<int>(clients[i]->frames));
+
+    int sent = 0;
+    double totalsendtime = 0, maxsendtime = 0;
+    double start = now();
+    for (int cycle=0; now() - start < PhaseDuration; cycle++)
+    {
+        if (rate > 0)
+        {
+            double wait = start + cycle/rate - now();
+            if (wait > 0)
+                usleep(static_cast<useconds_t>(1e6*wait));
+        }
+        if (not tcpport.hasRequests())
+        {
+            if (rate == 0)
+                usleep(50);
+            continue;
+        }
+
+        memcpy(&data[0], &sent, sizeof(sent));
+        memset(&data[sizeof(sent)], sent % 251, FrameSize - sizeof(sent));
+        double sendstart = now();
+        tcpport.sendData(netdata);
+        double sendtime = now() - sendstart;
+        totalsendtime += sendtime;
+        maxsendtime = std::max(maxsendtime, sendtime);
+        sent++;
+    }
+    usleep(200000);         // let the clients finish reading the last frames
+
+    double duration = now() - start;
+    int fastmin = sent, fastmax = 0, slowmin = sent, slowmax = 0, corrupt = 0;
+    for (size_t i=0; i<clients.size(); i++)
+    {
+        int received = clients[i]->frames - startframes[i];
+        if (clients[i]->slow)
+        {
+            slowmin = std::min(slowmin, received);
+            slowmax = std::max(slowmax, received);
+        }
+        else
+        {
+            fastmin = std::min(fastmin, received);
+            fastmax = std::max(fastmax, received);
+        }
+        corrupt += clients[i]->corrupt;
+    }
+
+    printf("  %d frames given to sendData in %.2fs, it took %.3fms on average and at most %.3fms\n", sent, duration, 1e3*totalsendtime/std::max(sent, 1), 1e3*maxsendtime);
+    printf("  the fast clients received %d-%d frames, the slow clients %d-%d, %.0f MB/s in total\n", fastmin, fastmax, slowmin, slowmax,
+           (NumFastClients*fastmin + NumSlowClients*slowmin)*(FrameSize/1e6)/duration);
+    check(corrupt == 0, "corrupt frames", corrupt);
+    check(slowmin > 0, "every slow client received frames", slowmin);
+    if (rate > 0)
+    {
+        check(fastmin >= sent - 2, "the fast clients received every frame (fewest received)", fastmin);
+        check(maxsendtime < 0.5/rate, "sendData never waits for a client (longest call in ms)", 1e3*maxsendtime);
+    }
+    else
+        check(fastmin > slowmax, "the slow clients do not hold back the fast clients (fewest frames to a fast client)", fastmin);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+        port = atoi(argv[1]);
+
+    TcpPort tcpport(port);
+    std::vector<Client*> clients;
+    for (int i=0; i<NumFastClients; i++)
+        clients.push_back(connectClient(false));
+    for (int i=0; i<NumSlowClients; i++)
+        clients.push_back(connectClient(true));
+    for (int attempt=0; tcpport.getNumClients() < NumFastClients + NumSlowClients and attempt < 100; attempt++)
+        usleep(10000);
+    check(tcpport.getNumClients() == NumFastClients + NumSlowClients, "clients connected", tcpport.getNumClients());
+
+    printf("At 30 Hz:\n");
+    runPhase(tcpport, 30, clients);
+    printf("Unthrottled:\n");
+    runPhase(tcpport, 0, clients);
+
+    for (size_t i=0; i<clients.size(); i++)
+    {
+        stopClient(clients[i]);
+        delete clients[i];
+    }
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
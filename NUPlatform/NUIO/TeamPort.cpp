@@ -48,22 +48,27 @@ TeamPort::~TeamPort()
     delete m_team_transmission_thread;
 }
 
-/*! @brief Copies the received data into the public nubot joblist
-    @param buffer containing the joblist
+/*! @brief Decodes a received team packet and adds it to the team information
+    @param buffer containing the team packet
 */
 void TeamPort::handleNewData(std::stringstream& buffer)
+{
+    std::string s_buffer = buffer.str();
+    handleNewData(s_buffer.data(), s_buffer.size());
+}
+
+/*! @brief Decodes a received team packet and adds it to the team information
+    @param data the received datagram
+    @param size the number of bytes in the datagram
+*/
+void TeamPort::handleNewData(const char* data, int size)
 {
     #if DEBUG_NETWORK_VERBOSITY > 0
         debug << "TeamPort::handleNewData()." << std::endl;
     #endif
-    std::string s_buffer = buffer.str();
-    if (s_buffer.size() == sizeof(TeamPacket))
-    {   // discard team packets that are the wrong size
-        TeamPacket temp;
-        buffer >> temp;
+    TeamPacket temp;
+    if (temp.decode(data, size))
         m_team_information->addReceivedTeamPacket(temp);
-    }
     else
-        debug << "TeamPort::handleNewData(). The received packet does not have the correct length: " << s_buffer.size() << " instead of " << sizeof(TeamPacket) << std::endl;
+        debug << "TeamPort::handleNewData(). The received packet is not a valid team packet, its length is " << size << " instead of " << TeamPacket::EncodedSize << std::endl;
 }
-
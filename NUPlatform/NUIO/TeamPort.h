@@ -37,6 +37,7 @@ public:
     
 private:
     void handleNewData(std::stringstream& buffer);
+    void handleNewData(const char* data, int size);
 public:
 private:
     TeamInformation* m_team_information;
@@ -51,8 +51,8 @@ void TeamTransmissionThread::periodicFunction()
 {
     if (m_port->m_team_information->getPlayerNumber() > 0)
     {
-        std::stringstream buffer;
-        buffer << m_port->m_team_information->generateTeamTransmissionPacket();
-        m_port->sendData(buffer);
+        char buffer[TeamPacket::EncodedSize];
+        int size = m_port->m_team_information->generateTeamTransmissionPacket().encode(buffer, sizeof(buffer));
+        m_port->sendData(buffer, size);
     }
 }
@@ -188,29 +188,44 @@ void UdpPort::run()
             #if DEBUG_NETWORK_VERBOSITY > 0
                 debug << "UdpPort::run()." << m_port_number << " Received " << localnumBytes << " bytes from " << inet_ntoa(local_their_addr.sin_addr) << std::endl;
             #endif
-            std::stringstream buffer;
-            buffer.write(reinterpret_cast<char*>(localdata), localnumBytes);
             #if DEBUG_NETWORK_VERBOSITY > 4
-                std::string s = buffer.str();
-                for (size_t i=0; i<s.size(); i++)
-                    debug << s[i];
+                for (int i=0; i<localnumBytes; i++)
+                    debug << localdata[i];
                 debug << std::endl;
             #endif
-            handleNewData(buffer);
+            handleNewData(localdata, localnumBytes);
         }
     }
     return;
 }
 
+/*! @brief Handles a received datagram. By default the data is copied into a stream for handleNewData(std::stringstream&);
+           ports with a binary format can override this to decode the data in place.
+    @param data the received data
+    @param size the number of bytes received
+ */
+void UdpPort::handleNewData(const char* data, int size)
+{
+    std::stringstream buffer;
+    buffer.write(data, size);
+    handleNewData(buffer);
+}
+
 /*! @brief Sends a string stream over the network
     @param stream the stream containing the information to be sent over the network
  */
 void UdpPort::sendData(const std::stringstream& stream)
 {
-    char* data;
-    int numbytes;
-    numbytes = stream.str().size();
-    data = (char*) stream.str().c_str();
+    std::string s = stream.str();
+    sendData(s.c_str(), s.size());
+}
+
+/*! @brief Sends a buffer over the network
+    @param data the data to send
+    @param numbytes the number of bytes to send
+ */
+void UdpPort::sendData(const char* data, int numbytes)
+{
     #if DEBUG_NETWORK_VERBOSITY > 4
         debug << "UdpPort::sendData(). Sending " << numbytes << " bytes to " << inet_ntoa(m_target_address.sin_addr) << std::endl;
     #endif
@@ -31,6 +31,8 @@
 #include "Kinematics/Horizon.h"
 #include "Kinematics/Kinematics.h"
 #include "Kinematics/OrientationUKF.h"
+#include "Kinematics/IMUFilter.h"
+#include "Kinematics/AttitudeHistory.h"
 
 #include "Tools/Math/General.h"
 #include "Tools/Math/StlVector.h"
@@ -41,9 +43,6 @@
 #include "debugverbositynusensors.h"
 #include "nubotdataconfig.h"
 
-#include "../Localisation/Filters/SeqUKF.h"
-#include "../Localisation/Filters/IMUModel.h"
-
 #include <math.h>
 #include <limits>
 
@@ -66,20 +65,8 @@ NUSensors::NUSensors(): m_initialised(false)
     m_orientationFilter = new OrientationUKF();
     m_odometry = new OdometryEstimator();
 
-    IMUModel* imu_model = new IMUModel();
-    m_orientation_filter = new SeqUKF(imu_model);
-    Matrix init_imu_mean(IMUModel::kstates_total, 1, false);
-    init_imu_mean[IMUModel::kstates_gyro_offset_x][0] = 0.0;
-    init_imu_mean[IMUModel::kstates_gyro_offset_y][0] = 0.0;
-    init_imu_mean[IMUModel::kstates_body_angle_x][0] = 0.0;
-    init_imu_mean[IMUModel::kstates_body_angle_y][0] = 0.0;
-    Matrix init_imu_cov(IMUModel::kstates_total, IMUModel::kstates_total, false);
-    init_imu_cov[IMUModel::kstates_gyro_offset_x][IMUModel::kstates_gyro_offset_x] = 0.0001;
-    init_imu_cov[IMUModel::kstates_gyro_offset_y][IMUModel::kstates_gyro_offset_y] = 0.0001;
-    init_imu_cov[IMUModel::kstates_body_angle_x][IMUModel::kstates_body_angle_x] = 9.0;
-    init_imu_cov[IMUModel::kstates_body_angle_y][IMUModel::kstates_body_angle_y] = 9.0;
-    MultivariateGaussian init_imu_est(init_imu_mean, init_imu_cov);
-    m_orientation_filter->initialiseEstimate(init_imu_est);
+    m_orientation_filter = new IMUFilter();
+    m_orientation_time = -1;
 }
 
 /*! @brief Destructor for parent NUSensors class.
@@ -249,7 +236,6 @@ void NUSensors::initialise()
  */
 void NUSensors::calculateOrientation()
 {
-    static double prev_time = 0.0;
 #if DEBUG_NUSENSORS_VERBOSITY > 4
     debug << "NUSensors::calculateOrientation()" << std::endl;
 #endif
@@ -263,6 +249,7 @@ void NUSensors::calculateOrientation()
     {
         std::cout << "NUSensors::calculateOrientation() NUSensorsData failed orientation hardware "<<std::endl;
         m_data->set(NUSensorsData::Orientation, m_current_time, orientationhardware);
+        AttitudeHistory::Instance().add(m_current_time, orientationhardware[0], orientationhardware[1]);
     }
     else if (m_data->get(NUSensorsData::Gyro, gyros) && m_data->get(NUSensorsData::Accelerometer, acceleration))
     {
@@ -298,67 +285,29 @@ void NUSensors::calculateOrientation()
 //            m_data->set(NUSensorsData::GyroOffset, m_current_time, gyroOffset);
 //        }
 
-        Matrix gyro_matrix(2,1,false);
-        gyro_matrix[0][0] = gyros[0];
-        gyro_matrix[1][0] = gyros[1];
-
-        Matrix accel_matrix(3,1,false);
-        accel_matrix[0][0] = acceleration[0];
-        accel_matrix[1][0] = acceleration[1];
-        accel_matrix[2][0] = acceleration[2];
-
-        const double delta_t_ms = m_current_time - prev_time;
-        const double delta_t_s = delta_t_ms / 1000.0;
-
-        Matrix process_noise(4,4,false);
-        process_noise[0][0] = 1e-6;
-        process_noise[1][1] = 1e-6;
-        process_noise[2][2] = 1e-6;
-        process_noise[3][3] = 1e-6;
-
-        Matrix gyro_measurement_noise(2,2,false);
-        gyro_measurement_noise[0][0] = 0.25;
-        gyro_measurement_noise[1][1] = 0.25;
-
-        Matrix accel_measurement_noise(3,3,false);
-        accel_measurement_noise[0][0] = 10.0;
-        accel_measurement_noise[1][1] = 10.0;
-        accel_measurement_noise[2][2] = 10.0;
-
-        m_orientation_filter->timeUpdate(delta_t_s, gyro_matrix, process_noise*delta_t_s, gyro_measurement_noise);
-        m_orientation_filter->measurementUpdate(accel_matrix, accel_measurement_noise, Matrix(), IMUModel::kmeasurement_accelerometer);
-
-        MultivariateGaussian estimate = m_orientation_filter->estimate();
-//        std::cout << "## Sensor Values:" << std::endl;
-//        std::cout << "Gyros:\n" << gyro_matrix << std::endl;
-//        std::cout << "Accelerometers:\n" << accel_matrix << std::endl;
-
-//        std::cout << "## Old filter results:" << std::endl;
-//        std::cout << "X offset: " << m_orientationFilter->getMean(OrientationUKF::rollGyroOffset) << std::endl;
-//        std::cout << "Y offset: " << m_orientationFilter->getMean(OrientationUKF::pitchGyroOffset) << std::endl;
-//        std::cout << "X angle: " << m_orientationFilter->getMean(OrientationUKF::rollAngle) << std::endl;
-//        std::cout << "Y angle: " << m_orientationFilter->getMean(OrientationUKF::pitchAngle) << std::endl;
-
-//        std::cout << "## New filter results:" << std::endl;
-//        std::cout << "X offset: " << estimate.mean(IMUModel::kstates_gyro_offset_x) << std::endl;
-//        std::cout << "Y offset: " << estimate.mean(IMUModel::kstates_gyro_offset_y) << std::endl;
-//        std::cout << "X angle: " << estimate.mean(IMUModel::kstates_body_angle_x) << std::endl;
-//        std::cout << "Y angle: " << estimate.mean(IMUModel::kstates_body_angle_y) << std::endl;
+        // the time since the last estimate; on the first update the gyros have nothing to integrate
+        const double delta_t_s = m_orientation_time < 0 ? 0.0 : (m_current_time - m_orientation_time)/1000.0;
+        const double process_noise[IMUFilter::NumStates] = {1e-6*delta_t_s, 1e-6*delta_t_s, 1e-6*delta_t_s, 1e-6*delta_t_s};
+        const double accel_measurement_noise = 10.0;
+
+        m_orientation_filter->timeUpdate(delta_t_s, gyros[0], gyros[1], process_noise);
+        m_orientation_filter->measurementUpdate(acceleration[0], acceleration[1], acceleration[2], accel_measurement_noise);
+        m_orientation_time = m_current_time;
 
         // Set orientation
-        orientation[0] = estimate.mean(IMUModel::kstates_body_angle_x);
-        orientation[1] = estimate.mean(IMUModel::kstates_body_angle_y);
+        orientation[0] = m_orientation_filter->getMean(IMUFilter::BodyAngleX);
+        orientation[1] = m_orientation_filter->getMean(IMUFilter::BodyAngleY);
         orientation[2] = 0.0f;
 
         m_data->set(NUSensorsData::Orientation, m_current_time, orientation);
+        AttitudeHistory::Instance().add(m_current_time, orientation[0], orientation[1]);
 
         // Set gyro offset values
-        gyroOffset[0] = estimate.mean(IMUModel::kstates_gyro_offset_x);
-        gyroOffset[1] = estimate.mean(IMUModel::kstates_gyro_offset_y);
+        gyroOffset[0] = m_orientation_filter->getMean(IMUFilter::GyroOffsetX);
+        gyroOffset[1] = m_orientation_filter->getMean(IMUFilter::GyroOffsetY);
         gyroOffset[2] = 0.0f;
         m_data->set(NUSensorsData::GyroOffset, m_current_time, gyroOffset);
     }
-    prev_time = m_current_time;
 }
 
 /*! @brief Updates the Horizon Line using the current sensor data
@@ -39,7 +39,7 @@ class EndEffectorTouch;
 class Kinematics;
 class OrientationUKF;
 class OdometryEstimator;
-class IKalmanFilter;
+class IMUFilter;
 
 #include <vector>
 
@@ -100,7 +100,8 @@ protected:
 //    std::vector< std::vector<const NUData::id_t*> > m_kinematics_joint_map;   //!< Vector matching the joint ordering in the Kinematics model to the joint is used by NUSensorData for each effector.
 //    std::vector<const NUData::id_t*> m_kinematics_transform_ids;         //!< Vector matching the transform of the above effectors to the ids used bu NUSensorsData.
 //    std::vector<const NUData::id_t*> m_kinematics_effector_ids;          //!< Vector matching the above effectors to the ids used bu NUSensorsData.
-    IKalmanFilter* m_orientation_filter;
+    IMUFilter* m_orientation_filter;                 //!< the fixed size filter estimating the body roll and pitch
+    double m_orientation_time;                       //!< the time of the last orientation estimate, or -1 if there has not been one
 private:
 };
 
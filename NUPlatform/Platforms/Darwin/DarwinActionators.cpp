@@ -25,6 +25,7 @@
 #include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
 #include "DarwinJointMapping.h"
 #include "DarwinPlatform.h"
+#include "Framework/darwin/Framework/include/CM730BusScheduler.h"
 #include <cmath>
 
 #include "debug.h"
@@ -164,10 +165,12 @@ void DarwinActionators::copyToServos()
     }
 
     // Send new servo data to all motors at once:
-    int error_code = cm730->SyncWrite(Robot::MX28::P_D_GAIN,
-                                      Robot::MX28::PARAM_BYTES,
-                                      num_joints,
-                                      sync_write_tx_packet);
+    // (the bus scheduler first ends the bulk read that has been in flight
+    //  while the packet was built)
+    int error_code = cm730->bus_scheduler()->SyncWrite(Robot::MX28::P_D_GAIN,
+                                                       Robot::MX28::PARAM_BYTES,
+                                                       num_joints,
+                                                       sync_write_tx_packet);
 }
 
 void DarwinActionators::copyToLeds()
@@ -32,6 +32,7 @@
 #include "debugverbositynusensors.h"
 
 #include "Framework/darwin/Framework/include/CM730.h"
+#include "Framework/darwin/Framework/include/CM730BusScheduler.h"
 #include "Framework/darwin/Framework/include/FSR.h"
 #include "Framework/darwin/Framework/include/JointData.h"
 #include "Framework/darwin/Framework/include/SensorReadManager.h"
@@ -88,6 +89,7 @@ DarwinSensors::DarwinSensors(DarwinPlatform* darwin, Robot::CM730* subboard)
     m_data->set(NUSensorsData::LLegEndEffector, m_data->CurrentTime, invalid);
 
     sensor_read_manager_ = cm730->sensor_read_manager();
+    bus_scheduler_ = cm730->bus_scheduler();
 }
 
 /*! @brief Destructor for DarwinSensors
@@ -104,7 +106,14 @@ DarwinSensors::~DarwinSensors()
  */
 void DarwinSensors::copyFromHardwareCommunications()
 {
-    // 1. Copy data from last bulk read of the CM730.
+    // 1. Wait for the bulk read started in the last cycle.
+    //    (It is normally over already: the actionators end it before their
+    //     SyncWrite)
+    static bool last_read_was_successful = false;
+    int bulk_read_error_code = 0;
+    bool significant_bulk_read_error_occurred = bus_scheduler_->CompleteRead(&bulk_read_error_code);
+
+    // 2. Copy data from last bulk read of the CM730.
 
     //Control Board Data:
     copyFromAccelerometerAndGyro();
@@ -122,19 +131,6 @@ void DarwinSensors::copyFromHardwareCommunications()
     // errorlog << "Motor error: " << std::endl;
     // cm730->DXLPowerOff(); platform->msleep(500); cm730->DXLPowerOn();
     
-    // 2. Read data in bulk from the CM730 controller board 
-    //    (i.e. read all sensor and motor data for the next iteration)
-    //    Note: Repeating the bulk read on failure doesn't appear to benefit
-    //          the function of the robot much.
-    // int debug_count = 0;
-    // while(cm730->BulkRead())
-    // {
-    //     std::cout << "Repeat: " << ++debug_count << ";" << std::endl;
-    static bool last_read_was_successful = false;
-    int bulk_read_error_code = 0;
-    bool significant_bulk_read_error_occurred = cm730->BulkRead(&bulk_read_error_code);
-    
-
     if(bulk_read_error_code == Robot::CM730::SUCCESS)
     {
         if(!last_read_was_successful)
@@ -172,6 +168,24 @@ void DarwinSensors::copyFromHardwareCommunications()
 //            }
         }
     }
+
+    // 3. Start reading data in bulk from the CM730 controller board
+    //    (i.e. read all sensor and motor data for the next iteration)
+    //    The response arrives while motion runs.
+    //    Note: Repeating the bulk read on failure doesn't appear to benefit
+    //          the function of the robot much.
+    bus_scheduler_->StartRead();
+
+    #if DEBUG_NUSENSORS_VERBOSITY > 0
+        const Robot::CM730BusScheduler::Statistics& bus = bus_scheduler_->statistics();
+        if(bus.cycles % 1000 == 0)
+        {
+            debug << "DarwinSensors::copyFromHardwareCommunications(). Bus cycle time: " << bus.mean_cycle_time
+                  << "ms (max " << bus.max_cycle_time << "ms), waiting for reads: " << bus.mean_wait_time
+                  << "ms, reads timed out: " << bus.timeouts << ", corrupt: " << bus.corrupt << std::endl;
+            bus_scheduler_->ResetStatistics();
+        }
+    #endif
 }
 
 /*! @brief Copys the joint sensor data
@@ -35,6 +35,7 @@ class DarwinPlatform;
 namespace Robot
 {
     class CM730;
+    class CM730BusScheduler;
     class SensorReadManager;
 }
 
@@ -65,6 +66,9 @@ protected:
     //! Manages sensor read descriptors
     Robot::SensorReadManager* sensor_read_manager_;
 
+    //! Schedules the bulk reads (and the actionators' writes) on the CM730 bus
+    Robot::CM730BusScheduler* bus_scheduler_;
+
 private:
     static const unsigned int NUM_MOTORS = 20;
 };
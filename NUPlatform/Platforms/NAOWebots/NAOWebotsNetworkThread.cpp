@@ -62,23 +62,21 @@ void NAOWebotsNetworkThread::periodicFunction()
             convertToGamePacket((RoboCupGameControlDataWebots*)data);
             (*m_game_info) << m_game_packet;
         }
-        else if (memcmp(data, TEAM_PACKET_STRUCT_HEADER, sizeof(TEAM_PACKET_STRUCT_HEADER)-1) == 0 and m_receiver->getDataSize() == sizeof(TeamPacket))
+        else if (memcmp(data, TEAM_PACKET_STRUCT_HEADER, sizeof(TEAM_PACKET_STRUCT_HEADER)-1) == 0 and m_receiver->getDataSize() == TeamPacket::EncodedSize)
         {   // if it is a team packet
-            std::stringstream ss;
-            ss.write((char*) data, sizeof(TeamPacket));
             TeamPacket temp;
-            ss >> temp;
-            m_team_info->addReceivedTeamPacket(temp);
+            if (temp.decode(data, m_receiver->getDataSize()))
+                m_team_info->addReceivedTeamPacket(temp);
         }
         else
-            std::cout << "Received " << m_receiver->getDataSize() << " unknown bytes. Want " << sizeof(RoboCupGameControlDataWebots) << " or " << sizeof(TeamPacket) << std::endl;
+            std::cout << "Received " << m_receiver->getDataSize() << " unknown bytes. Want " << sizeof(RoboCupGameControlDataWebots) << " or " << TeamPacket::EncodedSize << std::endl;
         m_receiver->nextPacket();
     };
     
     // Do transmitting
-    std::stringstream ss;
-    ss << m_team_info->generateTeamTransmissionPacket();
-    m_emitter->send(ss.str().c_str(), ss.str().size());
+    char buffer[TeamPacket::EncodedSize];
+    int size = m_team_info->generateTeamTransmissionPacket().encode(buffer, sizeof(buffer));
+    m_emitter->send(buffer, size);
 }
 
 void NAOWebotsNetworkThread::convertToGamePacket(const RoboCupGameControlDataWebots* data)
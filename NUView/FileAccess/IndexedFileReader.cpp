@@ -1,6 +1,14 @@
 #include "IndexedFileReader.h"
+#include <algorithm>
 #include <cmath>
-IndexedFileReader::IndexedFileReader(): m_fileEndLocation(0)
+#include <cstring>
+#include <sys/stat.h>
+#include <QDebug>
+
+static const char IndexFileHeader[4] = {'N','U','s','i'};
+static const unsigned int IndexFileVersion = 1;        //!< Change this whenever the way a file is indexed changes, so old index files are rebuilt.
+static const int ReadAheadFrames = 8;                  //!< The number of frames read ahead at once when stepping through a file.
+IndexedFileReader::IndexedFileReader(): m_file(NULL), m_fileEndLocation(0), m_readAheadStart(0), m_readAheadEnd(0)
 {
     m_selectedFrame = m_index.end();
 }
@@ -29,13 +37,24 @@ bool IndexedFileReader::IsValid()
 bool IndexedFileReader::OpenFile(const std::string& filename)
 {
     CloseFile();
-    m_file.open(filename.c_str(),std::ios_base::in | std::ios_base::binary);
-    if(m_file.good())
+    if(m_mappedFile.Open(filename))
+        m_file.rdbuf(&m_mappedFile);
+    else if(m_plainFile.open(filename.c_str(),std::ios_base::in | std::ios_base::binary))
+        m_file.rdbuf(&m_plainFile);
+
+    if(IsOpen() && m_file.good())
     {
         m_file.seekg(0,std::ios_base::end);
         m_fileEndLocation = m_file.tellg();
+        m_file.seekg(0,std::ios_base::beg);
         m_filename = filename;
-        IndexFile();
+        if(!LoadIndex())
+        {
+            m_mappedFile.SetSequential(true);
+            IndexFile();
+            m_mappedFile.SetSequential(false);
+            if(IsValid()) SaveIndex();
+        }
     }
     if(!IsValid()) m_filename.clear();
     return IsValid();
@@ -46,12 +65,23 @@ bool IndexedFileReader::OpenFile(const std::string& filename)
   */
 void IndexedFileReader::CloseFile()
 {
-    m_file.close();
+    m_file.rdbuf(NULL);
+    m_mappedFile.Close();
+    if(m_plainFile.is_open()) m_plainFile.close();
     m_fileEndLocation = 0;
     ClearIndex();
     m_filename.clear();
 }
 
+/**
+  *     Determine if a file is currently open.
+  *     @return True if a file is open. False if it is not.
+  */
+bool IndexedFileReader::IsOpen()
+{
+    return m_mappedFile.IsOpen() || m_plainFile.is_open();
+}
+
 /**
   *     Gets the timestamp of the currently buffered data. This function should only be called after data has been requested.
   *     @return The timestamp in milliseconds.
@@ -85,7 +115,7 @@ unsigned int IndexedFileReader::CurrentFrameSequenceNumber()
   */
 unsigned int IndexedFileReader::TotalFrames()
 {
-    if(m_file.is_open())
+    if(IsOpen())
     {
         return m_index.size();
     }
@@ -202,4 +232,152 @@ void IndexedFileReader::ClearIndex()
 {
     m_index.clear();
     m_timeIndex.clear();
+    m_readAheadStart = m_readAheadEnd = 0;
+}
+
+/**
+  *     Finds the position of the end of a frame, which is the start of the next frame in the file.
+  *     @param entry Iterator pointing to the frame.
+  *     @return The position of the end of the frame.
+  */
+IndexedFileReader::Position IndexedFileReader::EndOfFrame(IndexIterator entry)
+{
+    unsigned int next = (*entry).second.frameSequenceNumber + 1;
+    if(next <= m_timeIndex.size())
+    {
+        IndexIterator nextEntry = m_index.find(m_timeIndex[next-1]);
+        if(ValidEntry(nextEntry)) return (*nextEntry).second.position;
+    }
+    return m_fileEndLocation;
+}
+
+/**
+  *     Asks for a whole frame to be read from disk in the background. Reading a mapped file that is not
+  *     in memory otherwise goes to the disk a few pages at a time, which is much slower for large frames.
+  *     @param entry Iterator pointing to the frame.
+  */
+void IndexedFileReader::WillNeed(IndexIterator entry)
+{
+    if(!ValidEntry(entry) || !m_mappedFile.IsOpen()) return;
+    std::streamoff start = (*entry).second.position;
+    std::streamoff end = EndOfFrame(entry);
+    if(start >= m_readAheadStart && end <= m_readAheadEnd) return;
+    m_mappedFile.WillNeed(start, end - start);
+}
+
+/**
+  *     Starts reading the next frames in the direction of travel from disk in the background, so that
+  *     stepping on from the frame does not have to wait for the disk. This does not block. After a jump only
+  *     the next frame is read ahead; once the frame read was one read ahead, ReadAheadFrames are. Nothing is
+  *     done while the next frame is still within the frames last read ahead, so most steps make no system call.
+  *     @param entry Iterator pointing to the frame that has just been read.
+  *     @param direction 1 if stepping forwards through the file, -1 if stepping backwards.
+  */
+void IndexedFileReader::ReadAhead(IndexIterator entry, int direction)
+{
+    if(!ValidEntry(entry) || !m_mappedFile.IsOpen()) return;
+    std::streamoff start = (*entry).second.position;
+    bool stepping = start >= m_readAheadStart && start < m_readAheadEnd;
+    int next = (*entry).second.frameSequenceNumber + direction;
+    if(next < 1 || next > static_cast<int>(m_timeIndex.size())) return;
+    IndexIterator nextEntry = m_index.find(m_timeIndex[next-1]);
+    if(!ValidEntry(nextEntry)) return;
+    std::streamoff nextStart = (*nextEntry).second.position;
+    if(nextStart >= m_readAheadStart && EndOfFrame(nextEntry) <= m_readAheadEnd) return;
+
+    int last = stepping ? next + direction*(ReadAheadFrames - 1) : next;
+    last = std::max(1, std::min(last, static_cast<int>(m_timeIndex.size())));
+    IndexIterator lastEntry = m_index.find(m_timeIndex[last-1]);
+    if(!ValidEntry(lastEntry)) return;
+    IndexIterator lowest = direction > 0 ? nextEntry : lastEntry;
+    IndexIterator highest = direction > 0 ? lastEntry : nextEntry;
+    m_readAheadStart = (*lowest).second.position;
+    m_readAheadEnd = EndOfFrame(highest);
+    m_mappedFile.WillNeed(m_readAheadStart, m_readAheadEnd - m_readAheadStart);
+}
+
+/**
+  *     Loads the index saved by SaveIndex() for the open file. The saved index is only used if it
+  *     was made for a file with the same size and modification time as the open file.
+  *     @return True if the index was loaded. False if there is no usable saved index, in which case the index is left empty.
+  */
+bool IndexedFileReader::LoadIndex()
+{
+    struct stat info;
+    if(stat(m_filename.c_str(), &info) != 0) return false;
+
+    std::ifstream file((m_filename + ".idx").c_str(), std::ios_base::in | std::ios_base::binary);
+    if(!file.is_open()) return false;
+
+    char header[4];
+    unsigned int version = 0, count = 0;
+    long long size = 0, modified = 0;
+    file.read(header, sizeof(header));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    file.read(reinterpret_cast<char*>(&modified), sizeof(modified));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if(!file.good() || memcmp(header, IndexFileHeader, sizeof(header)) != 0 || version != IndexFileVersion
+       || size != static_cast<long long>(info.st_size) || modified != static_cast<long long>(info.st_mtime) || count == 0)
+        return false;
+
+    ClearIndex();
+    m_timeIndex.resize(count, -1.0);
+    FrameEntry temp;
+    double timestamp;
+    long long position;
+    for(unsigned int i = 0; i < count; i++)
+    {
+        file.read(reinterpret_cast<char*>(&timestamp), sizeof(timestamp));
+        file.read(reinterpret_cast<char*>(&temp.frameSequenceNumber), sizeof(temp.frameSequenceNumber));
+        file.read(reinterpret_cast<char*>(&position), sizeof(position));
+        temp.position = position;
+        if(!file.good() || temp.frameSequenceNumber < 1 || temp.frameSequenceNumber > count
+           || m_timeIndex[temp.frameSequenceNumber-1] >= 0.0 || !ValidStartingLocation(temp.position))
+        {
+            qDebug("File: %s - Ignoring damaged index file.", m_filename.c_str());
+            ClearIndex();
+            return false;
+        }
+        m_index.insert(IndexEntry(timestamp,temp));
+        m_timeIndex[temp.frameSequenceNumber-1] = timestamp;
+    }
+    if(m_index.size() != count)
+    {
+        ClearIndex();
+        return false;
+    }
+    return true;
+}
+
+/**
+  *     Saves the index of the open file next to it, so the file does not need to be indexed again the next
+  *     time it is opened. Nothing is saved if the file's directory can not be written to.
+  *     @return True if the index was saved.
+  */
+bool IndexedFileReader::SaveIndex()
+{
+    struct stat info;
+    if(stat(m_filename.c_str(), &info) != 0) return false;
+
+    std::ofstream file((m_filename + ".idx").c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if(!file.is_open()) return false;
+
+    unsigned int version = IndexFileVersion;
+    unsigned int count = m_index.size();
+    long long size = info.st_size;
+    long long modified = info.st_mtime;
+    file.write(IndexFileHeader, sizeof(IndexFileHeader));
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(&modified), sizeof(modified));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for(IndexIterator entry = m_index.begin(); entry != m_index.end(); ++entry)
+    {
+        long long position = static_cast<std::streamoff>((*entry).second.position);
+        file.write(reinterpret_cast<const char*>(&(*entry).first), sizeof((*entry).first));
+        file.write(reinterpret_cast<const char*>(&(*entry).second.frameSequenceNumber), sizeof((*entry).second.frameSequenceNumber));
+        file.write(reinterpret_cast<const char*>(&position), sizeof(position));
+    }
+    return file.good();
 }
@@ -8,6 +8,11 @@
     data within a file. Classes which inherit from this class must define the
     indexing method as well as any data reading methods required.
 
+    The file is mapped into memory rather than read, so opening it does not read
+    anything but the index, and seeking within it is free. Because indexing a large
+    file means reading all of it, the index is saved next to the file (with ".idx"
+    appended to its name) and reused the next time the same file is opened.
+
     @author Steven Nicklin
 
   Copyright (c) 2010 Steven Nicklin
@@ -30,15 +35,17 @@
 #define INDEXEDFILEREADER_H
 #include <string>
 #include <fstream>
+#include <istream>
 #include <map>
 #include <vector>
+#include "MappedFileBuffer.h"
 class IndexedFileReader
 {
 
 public:
 
     // Declare types and structures used in class.
-    typedef std::fstream::pos_type Position;
+    typedef std::istream::pos_type Position;
     struct FrameEntry
     {
         unsigned int frameSequenceNumber;
@@ -55,6 +62,7 @@ public:
 
     // Public File Access Functions
     bool IsValid();
+    bool IsOpen();
     bool OpenFile(const std::string& filename);
     void CloseFile();
 
@@ -78,14 +86,23 @@ protected:
     bool ValidEntry(IndexIterator entry);
     IndexIterator GetIndexFromTime(double time);
     void ClearIndex();
+    bool LoadIndex();
+    bool SaveIndex();
+    void WillNeed(IndexIterator entry);
+    void ReadAhead(IndexIterator entry, int direction);
+    Position EndOfFrame(IndexIterator entry);
 
     // Protected member variables
     FileIndex m_index;                  //!< Index mapping timestamp to Frame entries.
     TimeIndex m_timeIndex;              //!< Index mapping sequence number to timestamp.
-    std::fstream m_file;                //!< The file.
+    MappedFileBuffer m_mappedFile;      //!< The file mapped into memory.
+    std::filebuf m_plainFile;           //!< The file, if it could not be mapped.
+    std::istream m_file;                //!< Stream reading the file through either m_mappedFile or m_plainFile.
     Position m_fileEndLocation;         //!< The end position of the file.
     IndexIterator m_selectedFrame;      //!< Reference to the currently selected frame in the FileIndex.
     std::string m_filename;             //!< The name of the open file.
+    std::streamoff m_readAheadStart;    //!< The start of the frames last read ahead.
+    std::streamoff m_readAheadEnd;      //!< The end of the frames last read ahead.
 };
 
 #endif // FILEREADER_H
@@ -2,6 +2,8 @@
 #include "nifVersion1FormatReader.h"
 #include "nulVersion1FormatReader.h"
 #include "SplitStreamFileFormatReader.h"
+#include "Tools/FileFormats/LogContainer.h"
+#include <QDir>
 #include <QFileInfo>
 #include <QDebug>
 #include "debug.h"
@@ -35,6 +37,12 @@ int LogFileReader::openFile(QString fileName)
         {
            currentFileReader = new nulVersion1FormatReader(fileName);
         }
+        else if(ext == "nulog")
+        {
+            QString streamDirectory = unpackLogContainer(fileInfo);
+            if(!streamDirectory.isEmpty())
+                currentFileReader = new SplitStreamFileFormatReader(streamDirectory + "/");
+        }
         else
         {
             currentFileReader = new SplitStreamFileFormatReader(fileName);
@@ -71,6 +79,31 @@ int LogFileReader::openFile(QString fileName)
     return availableFrames;
 }
 
+/*! @brief Unpacks a log container recorded on a robot into the stream files NUView reads.
+
+    The streams are written to a directory beside the container, named after it, so that
+    the streams of different containers do not overwrite each other. A container that has
+    already been unpacked is not unpacked again.
+
+    @param containerInfo the container
+    @return the directory holding the streams, or an empty string if the container could not be read
+ */
+QString LogFileReader::unpackLogContainer(const QFileInfo& containerInfo)
+{
+    QDir directory(containerInfo.absolutePath());
+    QString streamDirectory = directory.filePath(containerInfo.completeBaseName());
+    QFileInfo unpacked(streamDirectory);
+    if(unpacked.isDir() && unpacked.lastModified() >= containerInfo.lastModified())
+        return streamDirectory;
+
+    LogContainer container;
+    if(!directory.mkpath(containerInfo.completeBaseName()) || !container.open(containerInfo.absoluteFilePath().toStdString()))
+        return QString();
+    if(!container.toStreams(streamDirectory.toStdString() + "/"))
+        qDebug() << "Some records of" << containerInfo.fileName() << "could not be read.";
+    return streamDirectory;
+}
+
 bool LogFileReader::closeFile()
 {
     if(currentFileReader)
@@ -97,6 +97,7 @@ protected:
 
 private:
     void emitControlAvailability();
+    static QString unpackLogContainer(const QFileInfo& containerInfo);
 };
 
 #endif // LOGFILEREADER_H
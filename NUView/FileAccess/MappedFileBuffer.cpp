@@ -0,0 +1,140 @@
+#include "MappedFileBuffer.h"
+#include <algorithm>
+
+#ifndef WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+MappedFileBuffer::MappedFileBuffer(): m_data(NULL), m_size(0)
+{
+}
+
+MappedFileBuffer::~MappedFileBuffer()
+{
+    Close();
+}
+
+/**
+  *     Maps a file into memory. Any previously mapped file is unmapped first.
+  *     @param filename The file path and name of the file.
+  *     @return True if the file was mapped. False if it could not be, in which case nothing is mapped.
+  */
+bool MappedFileBuffer::Open(const std::string& filename)
+{
+    Close();
+#ifndef WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0) return false;
+    struct stat info;
+    if(fstat(fd, &info) == 0 && info.st_size > 0 && static_cast<unsigned long long>(info.st_size) <= static_cast<size_t>(-1))
+    {
+        void* data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data != MAP_FAILED)
+        {
+            m_data = static_cast<char*>(data);
+            m_size = info.st_size;
+            setg(m_data, m_data, m_data + m_size);
+        }
+    }
+    close(fd);              // the mapping keeps its own reference to the file
+#endif
+    return IsOpen();
+}
+
+/**
+  *     Unmaps the current file.
+  */
+void MappedFileBuffer::Close()
+{
+#ifndef WIN32
+    if(m_data != NULL)
+        munmap(m_data, m_size);
+#endif
+    m_data = NULL;
+    m_size = 0;
+    setg(NULL, NULL, NULL);
+}
+
+/**
+  *     Asks the operating system to start reading part of the file from disk in the background,
+  *     so that it is already in memory when it is read. This does not wait for the read. Nothing is
+  *     asked for if the data is already in memory.
+  *     @param position The position of the start of the data in the file.
+  *     @param length The length of the data in bytes.
+  */
+void MappedFileBuffer::WillNeed(std::streamoff position, std::streamoff length)
+{
+#ifndef WIN32
+    if(m_data == NULL || position < 0 || length <= 0 || position >= m_size) return;
+    if(position + length > m_size) length = m_size - position;
+    // madvise needs a page aligned start
+    const std::streamoff page = sysconf(_SC_PAGESIZE);
+    std::streamoff start = position - (position % page);
+    if(!IsResident(start, length + (position - start))) madvise(m_data + start, length + (position - start), MADV_WILLNEED);
+#endif
+}
+
+/**
+  *     Determines whether every page of part of the file is in memory.
+  *     @param start The page aligned position of the start of the data in the file.
+  *     @param length The length of the data in bytes.
+  *     @return True if all of it is in memory. False if any of it is not, or this can not be told.
+  */
+bool MappedFileBuffer::IsResident(std::streamoff start, std::streamoff length) const
+{
+#ifndef WIN32
+    const std::streamoff page = sysconf(_SC_PAGESIZE);
+    const std::streamoff chunk = 64;            // pages looked at by each mincore
+    unsigned char resident[chunk];
+    std::streamoff numpages = (length + page - 1)/page;
+    for(std::streamoff first = 0; first < numpages; first += chunk)
+    {
+        std::streamoff count = std::min(chunk, numpages - first);
+        if(mincore(m_data + start + first*page, count*page, resident) != 0) return false;
+        for(std::streamoff i = 0; i < count; i++)
+            if(!(resident[i] & 1)) return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+  *     Tells the operating system whether the file is about to be read from start to end, so that it
+  *     reads ahead aggressively, or randomly, so that it doesn't.
+  *     @param sequential True if the file will be read from start to end.
+  */
+void MappedFileBuffer::SetSequential(bool sequential)
+{
+#ifndef WIN32
+    if(m_data != NULL)
+        madvise(m_data, m_size, sequential ? MADV_SEQUENTIAL : MADV_NORMAL);
+#endif
+}
+
+std::streambuf::pos_type MappedFileBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which)
+{
+    if(m_data == NULL || !(which & std::ios_base::in))
+        return pos_type(off_type(-1));
+
+    off_type base = 0;
+    if(direction == std::ios_base::cur)
+        base = gptr() - eback();
+    else if(direction == std::ios_base::end)
+        base = m_size;
+
+    off_type target = base + offset;
+    if(target < 0 || target > m_size)
+        return pos_type(off_type(-1));
+    setg(m_data, m_data + target, m_data + m_size);
+    return pos_type(target);
+}
+
+std::streambuf::pos_type MappedFileBuffer::seekpos(pos_type position, std::ios_base::openmode which)
+{
+    return seekoff(off_type(position), std::ios_base::beg, which);
+}
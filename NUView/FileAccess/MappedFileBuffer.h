@@ -0,0 +1,61 @@
+/*! @file MappedFileBuffer.h
+    @brief Declaration of the MappedFileBuffer class
+
+    @class MappedFileBuffer
+    @brief A read-only stream buffer over a file that has been mapped into memory.
+
+    The whole file is mapped when it is opened, and pages are only read from disk when they
+    are touched, so opening a file takes the same time whatever its size, and seeking is just
+    moving a pointer. The existing operator>> can be used on an istream built on the buffer.
+
+    Mapping is not available on Windows, and may fail for very large files in a 32 bit build,
+    in which case Open() returns false and the caller should fall back to a std::filebuf.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MAPPEDFILEBUFFER_H
+#define MAPPEDFILEBUFFER_H
+
+#include <streambuf>
+#include <string>
+
+class MappedFileBuffer: public std::streambuf
+{
+public:
+    MappedFileBuffer();
+    ~MappedFileBuffer();
+
+    bool Open(const std::string& filename);
+    void Close();
+    bool IsOpen() const {return m_data != NULL;}
+    std::streamoff Size() const {return m_size;}
+
+    void WillNeed(std::streamoff position, std::streamoff length);
+    bool IsResident(std::streamoff start, std::streamoff length) const;
+    void SetSequential(bool sequential);
+
+protected:
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which = std::ios_base::in);
+    pos_type seekpos(pos_type position, std::ios_base::openmode which = std::ios_base::in);
+
+private:
+    MappedFileBuffer(const MappedFileBuffer&);
+    MappedFileBuffer& operator=(const MappedFileBuffer&);
+
+    char* m_data;                   //!< The start of the mapped file, or NULL if no file is mapped.
+    std::streamoff m_size;          //!< The size of the mapped file in bytes.
+};
+
+#endif // MAPPEDFILEBUFFER_H
@@ -7,9 +7,10 @@
     The stream file reader is used to access time-stamped data stored within a stream file.
     Because of the nature of a stream the file is parsed and each timestamped data objects
     timestamp and location within the file is indexed allowing fast, random access of the
-    stream file.
+    stream file. The index is saved alongside the file, so a file is only parsed the first
+    time it is opened (see IndexedFileReader).
     When reading in the data it is locally buffered and a pointer to the object type read
-    is returned.
+    is returned. The next frame in the direction of travel is then read ahead from disk in the background.
     Because it is a templated class, any timestamped data can be read from a stream file
     containing it. However any class used in the template must implement the abstract class
     TimestampedData found in the /Tools/FileFormats/ directory so as to access timestamps.
@@ -117,7 +118,7 @@ public:
         if(entry != m_index.begin())
         {
             --entry;
-            return ReadFrame(entry);
+            return ReadFrame(entry, -1);
         }
         return NULL;
     }
@@ -152,19 +153,23 @@ private:
     /**
       *     Read the data described by the given entry into the data buffer.
       *     @param entry Iterator pointing to the desired entry.
+      *     @param direction 1 if the frames after this one are likely to be read next, -1 if the ones before are.
       *     @return Pointer to the buffer containing the new object. NULL if the data could not be read.
       */
-    C* ReadFrame(IndexIterator entry)
+    C* ReadFrame(IndexIterator entry, int direction = 1)
     {
         if(ValidEntry(entry))
         {
             Position startingLocation = (*entry).second.position;
-            if(m_file.is_open() && ValidStartingLocation(startingLocation))
+            if(IsOpen() && ValidStartingLocation(startingLocation))
             {
+                WillNeed(entry);
+                m_file.clear();
                 m_file.seekg(startingLocation,std::ios_base::beg);
                 try{
                     m_file >> (*m_dataBuffer);
                     m_selectedFrame = entry;
+                    ReadAhead(entry, direction);
                     return m_dataBuffer;
                 }   catch(...){}
 
@@ -179,7 +184,7 @@ private:
       */
     void IndexFile()
     {
-        if (m_file.is_open())
+        if (IsOpen())
         {
             FrameEntry temp;
             double timestamp = 0.0;
@@ -192,7 +197,7 @@ private:
             const unsigned int min_length = 12;
             while (m_file.good() && ((m_fileEndLocation - m_file.tellg()) > min_length))
             {
-                int pos = m_file.tellg();
+                Position pos = m_file.tellg();
                 //qDebug("Indexing Frame %d at %d", temp.frameSequenceNumber, pos);
                 temp.position = m_file.tellg();
                 try{
@@ -222,7 +227,7 @@ private:
 
                     if(m_timeIndex.back() == timestamp and m_timeIndex.size() >= 2)
                     {
-                        int curr_buffer_pos =  m_file.tellg();
+                        Position curr_buffer_pos =  m_file.tellg();
                         try{
                             m_file >> (*m_dataBuffer);
                             double next_timestamp = (static_cast<TimestampedData*>(m_dataBuffer))->GetTimestamp();
@@ -0,0 +1,240 @@
+/*! @file StreamFileReaderBenchmark.cpp
+    @brief A benchmark of opening and reading a multi-GB image stream with StreamFileReader
+
+    A synthetic image.strm of 320x240 frames is written (10000 frames, about 3 GB, unless told otherwise),
+    with one column of each frame set to the frame's number so that every frame read can be checked. It is
+    then read the way the reader used to, parsing every frame through an fstream to index it and seeking the
+    fstream to read a frame, and with StreamFileReader, which maps the file and saves its index beside it.
+    For each it times
+        - opening the file; for StreamFileReader both the first open, which indexes the file, and the next
+        - reading frames at random
+        - stepping forwards a frame at a time, with 10 ms between frames as NUView spends drawing them
+    The page cache is dropped before each phase when run as root, so that the disk is read as when a log is
+    first opened; otherwise the times are with whatever the cache holds.
+
+    Build and run from this directory with
+    @code
+        make StreamFileReaderBenchmark && ./StreamFileReaderBenchmark [file] [frames]
+    @endcode
+    An existing file of the right size is reused. It returns non-zero if a frame reads back wrong, the two
+    readers disagree on the number of frames, or opening with the saved index is not much faster than indexing.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StreamFileReader.h"
+#include "Infrastructure/NUImage/NUImage.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+static const int Width = 320;
+static const int Height = 240;
+static const int NumRandomReads = 200;
+static const int NumSteps = 300;
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+/*! @brief Returns the time in ms */
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return 1e3*time.tv_sec + 1e-6*time.tv_nsec;
+}
+
+/*! @brief Drops the page cache, so that the next read of the file goes to the disk. This needs root. */
+static bool dropCaches()
+{
+    sync();
+    int fd = open("/proc/sys/vm/drop_caches", O_WRONLY);
+    if (fd < 0)
+        return false;
+    bool dropped = write(fd, "3", 1) == 1;
+    close(fd);
+    return dropped;
+}
+
+/*! @brief Returns true if image is frame number n (counting from 0) of the synthetic stream */
+static bool isFrame(NUImage* image, unsigned int n)
+{
+    return image != NULL and image->at(n % Width, Height/2).y == static_cast<unsigned char>(n);
+}
+
+/*! @brief Writes the synthetic stream, unless a file of the right size is already there */
+static void writeStream(const std::string& path, int numframes)
+{
+    NUImage image(Width, Height, true);
+    std::ostringstream first;
+    first << image;
+    struct stat info;
+    long long size = static_cast<long long>(first.str().size())*numframes;
+    if (stat(path.c_str(), &info) == 0 and info.st_size == size)
+        return;
+
+    printf("Writing %d frames (%.2f GB) to %s\n", numframes, size*1e-9, path.c_str());
+    std::ofstream file(path.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    for (int frame=0; frame<numframes; frame++)
+    {
+        image.setTimestamp(1000 + 33.3*frame);
+        Pixel pixel;
+        pixel.y = frame;
+        pixel.cb = frame >> 8;
+        pixel.cr = 128;
+        pixel.yCbCrPadding = 0;
+        for (int y=0; y<Height; y++)
+            image.setPixel(frame % Width, y, pixel);
+        file << image;
+    }
+}
+
+/*! @brief Times the reader StreamFileReader replaced: every open parses the whole file through an fstream */
+static unsigned int benchmarkFstream(const std::string& path, bool cold)
+{
+    printf("fstream, parsing every frame:\n");
+    NUImage image;
+    std::vector<std::streampos> positions;
+    if (cold)
+        dropCaches();
+    double start = now();
+    std::ifstream file(path.c_str(), std::ios_base::in | std::ios_base::binary);
+    file.seekg(0, std::ios_base::end);
+    std::streampos end = file.tellg();
+    file.seekg(0, std::ios_base::beg);
+    while (file.good() and end - file.tellg() > 12)
+    {
+        positions.push_back(file.tellg());
+        file >> image;
+    }
+    printf("  open:                %8.1f ms\n", now() - start);
+
+    if (cold)
+        dropCaches();
+    int bad = 0;
+    srand(1);
+    start = now();
+    for (int i=0; i<NumRandomReads; i++)
+    {
+        unsigned int n = rand() % positions.size();
+        file.clear();
+        file.seekg(positions[n]);
+        file >> image;
+        if (not isFrame(&image, n))
+            bad++;
+    }
+    printf("  random read:         %8.2f ms per frame\n", (now() - start)/NumRandomReads);
+
+    if (cold)
+        dropCaches();
+    unsigned int n = positions.size()/2;
+    double reading = 0;
+    for (int i=0; i<NumSteps and n < positions.size(); i++, n++)
+    {
+        usleep(10000);
+        start = now();
+        file.clear();
+        file.seekg(positions[n]);
+        file >> image;
+        reading += now() - start;
+        if (not isFrame(&image, n))
+            bad++;
+    }
+    printf("  step forwards:       %8.2f ms per frame\n", reading/NumSteps);
+    check(bad == 0, "frames read back wrong through the fstream", bad);
+    return positions.size();
+}
+
+/*! @brief Times StreamFileReader, opening the file once without a saved index and once with it */
+static void benchmarkStreamFileReader(const std::string& path, bool cold, unsigned int numframes)
+{
+    printf("StreamFileReader:\n");
+    remove((path + ".idx").c_str());
+    double opentimes[2];
+    for (int i=0; i<2; i++)
+    {
+        if (cold)
+            dropCaches();
+        double start = now();
+        StreamFileReader<NUImage> reader(path);
+        opentimes[i] = now() - start;
+        check(reader.TotalFrames() == numframes, i == 0 ? "frames found indexing the file" : "frames in the saved index", reader.TotalFrames());
+    }
+    printf("  first open:          %8.1f ms\n", opentimes[0]);
+    printf("  open with the index: %8.1f ms\n", opentimes[1]);
+    check(opentimes[1] < 0.1*opentimes[0], "opening with the saved index is at least 10 times faster (speed up)", opentimes[0]/opentimes[1]);
+
+    StreamFileReader<NUImage> reader(path);
+    if (cold)
+        dropCaches();
+    int bad = 0;
+    srand(1);
+    double start = now();
+    for (int i=0; i<NumRandomReads; i++)
+    {
+        unsigned int n = rand() % numframes;
+        if (not isFrame(reader.ReadFrameNumber(n + 1), n))
+            bad++;
+    }
+    printf("  random read:         %8.2f ms per frame\n", (now() - start)/NumRandomReads);
+
+    if (cold)
+        dropCaches();
+    unsigned int n = numframes/2;
+    reader.ReadFrameNumber(n);
+    double reading = 0;
+    for (int i=0; i<NumSteps and n < numframes; i++, n++)
+    {
+        usleep(10000);
+        start = now();
+        NUImage* image = reader.ReadNextFrame();
+        reading += now() - start;
+        if (not isFrame(image, n))
+            bad++;
+    }
+    printf("  step forwards:       %8.2f ms per frame\n", reading/NumSteps);
+    check(bad == 0, "frames read back wrong through StreamFileReader", bad);
+}
+
+int main(int argc, char** argv)
+{
+    std::string path = argc > 1 ? argv[1] : "image.strm";
+    int numframes = argc > 2 ? atoi(argv[2]) : 10000;
+
+    writeStream(path, numframes);
+    bool cold = dropCaches();
+    if (not cold)
+        printf("Unable to drop the page cache (run as root to), so these are times with the file partly in memory\n");
+
+    unsigned int found = benchmarkFstream(path, cold);
+    check(found == static_cast<unsigned int>(numframes), "frames found by the fstream", found);
+    benchmarkStreamFileReader(path, cold, found);
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -48,6 +48,22 @@ DEFINES += TARGET_IS_NUVIEW
 INCLUDEPATH += ../
 INCLUDEPATH += ../NUview/
 INCLUDEPATH += NUViewConfig/
+
+# NUIO includes NUAPI.h, so generate the NUAPI protocol buffer classes next to the .proto like the cmake build does
+PROTOS = ../NUPlatform/NUAPI/proto/NUAPI.proto
+protobuf_decl.name = protobuf headers
+protobuf_decl.input = PROTOS
+protobuf_decl.output = ${QMAKE_FILE_IN_PATH}/${QMAKE_FILE_BASE}.pb.h
+protobuf_decl.commands = protoc --cpp_out=${QMAKE_FILE_IN_PATH} --proto_path=${QMAKE_FILE_IN_PATH} ${QMAKE_FILE_NAME}
+protobuf_decl.variable_out = HEADERS
+QMAKE_EXTRA_COMPILERS += protobuf_decl
+protobuf_impl.name = protobuf sources
+protobuf_impl.input = PROTOS
+protobuf_impl.output = ${QMAKE_FILE_IN_PATH}/${QMAKE_FILE_BASE}.pb.cc
+protobuf_impl.depends = ${QMAKE_FILE_IN_PATH}/${QMAKE_FILE_BASE}.pb.h
+protobuf_impl.commands = $$escape_expand(\n)
+protobuf_impl.variable_out = SOURCES
+QMAKE_EXTRA_COMPILERS += protobuf_impl
 HEADERS += ui_mainwindow.h \
     mainwindow.h \
     connectionwidget.h \
@@ -65,6 +81,7 @@ HEADERS += ui_mainwindow.h \
     openglmanager.h \
     GLDisplay.h \
     ../Infrastructure/NUImage/NUImage.h \
+    ../Infrastructure/NUImage/NUImageCodec.h \
     ../Infrastructure/NUImage/ClassifiedImage.h \
     #../VisionOld/ClassifiedSection.h \
     #../VisionOld/ScanLine.h \
@@ -82,6 +99,8 @@ HEADERS += ui_mainwindow.h \
     ../Infrastructure/FieldObjects/AmbiguousObject.h \
     ../Infrastructure/FieldObjects/FieldObjects.h \
     ../Vision/Threads/SaveImagesThread.h \
+    ../Vision/Threads/ImageEncoderThread.h \
+    ../Vision/Threads/ImageCapture.h \
     #../VisionOld/ObjectCandidate.h \
     ../Localisation/WMPoint.h \
     ../Localisation/WMLine.h \
@@ -162,11 +181,14 @@ HEADERS += ui_mainwindow.h \
     #../VisionOld/fitellipsethroughcircle.h \
     ../Localisation/LocWmFrame.h \
     FileAccess/IndexedFileReader.h \
+    FileAccess/MappedFileBuffer.h \
     LUTGlDisplay.h \
     ../NUPlatform/NUSensors/EndEffectorTouch.h \
     ../NUPlatform/NUSensors/OdometryEstimator.h \
     ../Tools/Math/StlVector.h \
     ../Tools/Profiling/Profiler.h \
+    ../Tools/Profiling/Tracer.h \
+    ../Tools/Profiling/TraceRegistry.h \
     MotionWidgets/WalkParameterWidget.h \
     MotionWidgets/KickWidget.h \
     MotionWidgets/MotionFileEditor.h \
@@ -181,6 +203,9 @@ HEADERS += ui_mainwindow.h \
     GameInformationDisplayWidget.h \
     ../Infrastructure/TeamInformation/TeamInformation.h \
     ../Tools/FileFormats/LogRecorder.h \
+    ../Tools/FileFormats/LogContainer.h \
+    ../Tools/FileFormats/LogWriterThread.h \
+    ../Tools/FileFormats/LogRing.h \
     ../Tools/FileFormats/FileFormatException.h \
     offlinelocalisationdialog.h \
     ../Tools/Math/MultivariateGaussian.h \
@@ -208,6 +233,7 @@ HEADERS += ui_mainwindow.h \
     ../ConfigSystem/ConfigRange.h \
     ../ConfigSystem/ConfigStorageManager.h \
     ../ConfigSystem/ConfigTree.h \
+    ../ConfigSystem/ConfigValueStore.h \
     ../ConfigSystem/Configurable.h \
     ../Localisation/Filters/IKalmanFilter.h \
     ../Localisation/Filters/IKFModel.h \
@@ -248,6 +274,8 @@ SOURCES += mainwindow.cpp \
     openglmanager.cpp \
     GLDisplay.cpp \
     ../Infrastructure/NUImage/NUImage.cpp \
+    ../Infrastructure/NUImage/NUImageCodec.cpp \
+    ../Infrastructure/NUImage/lib/jpge.cpp \
     ../Infrastructure/NUImage/ClassifiedImage.cpp \
     #../VisionOld/ClassifiedSection.cpp \
     #../VisionOld/ScanLine.cpp \
@@ -324,11 +352,13 @@ SOURCES += mainwindow.cpp \
     ../NUPlatform/NUCamera.cpp \
     #../VisionOld/fitellipsethroughcircle.cpp \
     FileAccess/IndexedFileReader.cpp \
+    FileAccess/MappedFileBuffer.cpp \
     LUTGlDisplay.cpp \
     ../NUPlatform/NUSensors/EndEffectorTouch.cpp \
     ../Tools/Math/FieldCalculations.cpp \
     ../NUPlatform/NUSensors/OdometryEstimator.cpp \
     ../Tools/Profiling/Profiler.cpp \
+    ../Tools/Profiling/Tracer.cpp \
     MotionWidgets/WalkParameterWidget.cpp \
     MotionWidgets/KickWidget.cpp \
     MotionWidgets/MotionFileEditor.cpp \
@@ -340,6 +370,8 @@ SOURCES += mainwindow.cpp \
     TeamInformationDisplayWidget.cpp \
     GameInformationDisplayWidget.cpp \
     ../Tools/FileFormats/LogRecorder.cpp \
+    ../Tools/FileFormats/LogContainer.cpp \
+    ../Tools/FileFormats/LogWriterThread.cpp \
     offlinelocalisationdialog.cpp \
     ../Tools/Math/MultivariateGaussian.cpp \
     ../Localisation/SelfLocalisation.cpp \
@@ -362,6 +394,7 @@ SOURCES += mainwindow.cpp \
     ../ConfigSystem/ConfigParameter.cpp \
     ../ConfigSystem/ConfigStorageManager.cpp \
     ../ConfigSystem/ConfigTree.cpp \
+    ../ConfigSystem/ConfigValueStore.cpp \
     ../ConfigSystem/Configurable.cpp \
     ../Localisation/Filters/MobileObjectModel.cpp \
     ../Localisation/Filters/RobotModel.cpp \
@@ -413,6 +446,7 @@ SOURCES += \
     ../Vision/visionblackboard.cpp \
     ../Vision/visioncontroller.cpp \
     ../Vision/visionconstants.cpp \
+    ../Vision/visioncontext.cpp \
     ../Vision/basicvisiontypes.cpp \
     ../Vision/VisionWrapper/visioncontrolwrappernuview.cpp \
     ../Vision/VisionWrapper/datawrappernuview.cpp \
@@ -542,7 +542,7 @@ void MainWindow::openLog()
     }
     QString fileName = QFileDialog::getOpenFileName(this,
                             tr("Open Replay File"), intial_directory,
-                            tr("All NUbot Image Files(*.nul *.nif *.nurf *.strm);;NUbot Log Files (*.nul);;NUbot Image Files (*.nif);;NUbot Replay Files (*.nurf);;Stream File(*.strm);;All Files(*.*)"));
+                            tr("All NUbot Image Files(*.nul *.nif *.nurf *.strm *.nulog);;NUbot Log Files (*.nul);;Robot Log Containers (*.nulog);;NUbot Image Files (*.nif);;NUbot Replay Files (*.nurf);;Stream File(*.strm);;All Files(*.*)"));
     if(!fileName.isEmpty())
     {
         QFileInfo file_info(fileName);
@@ -63,6 +63,10 @@ using ConfigSystem::ConfigManager;
 #endif
 #include "NUbot/SenseMoveThread.h"
 #include "NUbot/WatchDogThread.h"
+#ifdef USE_TRACER
+    #include "Tools/Profiling/TraceDrainThread.h"
+    #include "nubotdataconfig.h"
+#endif
 
 // --------------------------------------------------------------- NUPlatform header files
 #if defined(TARGET_IS_NAOWEBOTS)
@@ -349,6 +353,10 @@ void NUbot::createThreads()
     debug << "NUbot::createThreads(). Constructing threads." << std::endl;
 #endif
     
+    #ifdef USE_TRACER
+        m_trace_thread = new TraceDrainThread(std::string(DATA_DIR) + "trace.json", std::string(DATA_DIR) + "trace_histograms.txt");
+    #endif
+    
     #if defined(USE_VISION) or defined(USE_LOCALISATION)
         m_seethink_thread = new SeeThinkThread(this);
     #endif
@@ -397,6 +405,11 @@ void NUbot::destroyThreads()
         delete m_seethink_thread;
         m_seethink_thread = 0;
     #endif
+    
+    #ifdef USE_TRACER
+        delete m_trace_thread;          // last, so it collects everything the other threads traced
+        m_trace_thread = 0;
+    #endif
 }
 
 /*! @brief The nubot's main loop
@@ -88,6 +88,9 @@ class NUIO;
 #endif
 class SenseMoveThread;
 class WatchDogThread;
+#ifdef USE_TRACER
+    class TraceDrainThread;
+#endif
 
 #include <exception>
 
@@ -156,6 +159,10 @@ public:         //! @todo TODO: this door should be closed. It is open atm becau
     
     friend class WatchDogThread;
     WatchDogThread* m_watchdog_thread;
+    
+    #ifdef USE_TRACER
+        TraceDrainThread* m_trace_thread;
+    #endif
 };
 
 #endif
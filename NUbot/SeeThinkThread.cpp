@@ -52,6 +52,7 @@
     #include "Motion/NUMotion.h"
 #endif
 
+#include "Tools/Profiling/Tracer.h"
 #include "debug.h"
 #include "debugverbositynubot.h"
 #include "debugverbositythreading.h"
@@ -93,6 +94,7 @@ SeeThinkThread::~SeeThinkThread()
         debug << "SeeThinkThread::~SeeThinkThread()" << std::endl;
     #endif
     stop();
+    delete m_logrecorder;           // finishes writing the log, including its index
 }
 
 /*! @brief The sense->move main loop
@@ -113,6 +115,8 @@ void SeeThinkThread::run()
     #ifdef THREAD_SEETHINK_PROFILE
         Profiler prof = Profiler("SeeThinkThread");
     #endif
+    TraceSplits trace;                  // each stage of the loop
+    TraceSplits frame;                  // the whole loop
 #ifdef LOGGING_ENABLED
     ofstream locfile((std::string(DATA_DIR) + std::string("selflocwm.strm")).c_str(), ios_base::trunc);
 #endif
@@ -134,7 +138,10 @@ void SeeThinkThread::run()
             // else 
             //     std::cout << "SeeThinkThread::run(): autoUpdateTest FAIL!" << std::endl;
             // // #endif
+            trace.start();
+            frame.start();
             Blackboard->Config->UpdateConfiguration();
+            TRACE_SPLIT(trace, "seethink config");
             // -----------------------------------------
 
             #ifdef THREAD_SEETHINK_PROFILE
@@ -148,12 +155,14 @@ void SeeThinkThread::run()
             #ifdef THREAD_SEETHINK_PROFILE
                 prof.split("frame grab");
             #endif
+            TRACE_SPLIT(trace, "seethink frame grab");
             // -----------------------------------------------------------------------------------------------------------------------------------------------------------------
             #ifdef USE_VISION
                 m_nubot->m_vision->runFrame();
                 #ifdef THREAD_SEETHINK_PROFILE
                     prof.split("vision");
                 #endif
+                TRACE_SPLIT(trace, "seethink vision");
             #endif
 
             double current_time = Blackboard->Sensors->GetTimestamp();
@@ -164,12 +173,14 @@ void SeeThinkThread::run()
             #ifdef THREAD_SEETHINK_PROFILE
                 prof.split("time update");
             #endif
+            TRACE_SPLIT(trace, "seethink time update");
 
             #ifdef USE_LOCALISATION
                 m_nubot->m_localisation->process(Blackboard->Sensors, Blackboard->Objects, Blackboard->GameInfo, Blackboard->TeamInfo);
                 #ifdef THREAD_SEETHINK_PROFILE
                     prof.split("localisation");
                 #endif
+                TRACE_SPLIT(trace, "seethink localisation");
             #endif
             
             #if defined(USE_BEHAVIOUR)
@@ -177,6 +188,7 @@ void SeeThinkThread::run()
                 #ifdef THREAD_SEETHINK_PROFILE
                     prof.split("behaviour");
                 #endif
+                TRACE_SPLIT(trace, "seethink behaviour");
             #endif
             
             #if DEBUG_VERBOSITY > 0
@@ -193,17 +205,21 @@ void SeeThinkThread::run()
                 #ifdef THREAD_SEETHINK_PROFILE
                     prof.split("vision_jobs");
                 #endif
+                TRACE_SPLIT(trace, "seethink vision jobs");
             #endif
             #ifdef USE_MOTION
                 m_nubot->m_motion->process(Blackboard->Jobs);
                 #ifdef THREAD_SEETHINK_PROFILE
                     prof.split("motion_jobs");
                 #endif
+                TRACE_SPLIT(trace, "seethink motion jobs");
             #endif
 
 					
             //std::cout << m_nubot->m_platform->getRealTime() << std::endl << Blackboard->Image->GetTimestamp() << std::endl << std::endl;
             m_nubot->m_api->sendAll();
+            TRACE_SPLIT(trace, "seethink send");
+            TRACE_SPLIT(frame, "seethink");
 			
 #ifdef LOGGING_ENABLED
             locfile << *m_nubot->m_localisation;
@@ -38,6 +38,7 @@
     #include "Infrastructure/Jobs/Jobs.h"
 #endif
 
+#include "Tools/Profiling/Tracer.h"
 #include "debug.h"
 #include "debugverbositynubot.h"
 #include "debugverbositythreading.h"
@@ -94,6 +95,8 @@ void SenseMoveThread::run()
         Profiler prof = Profiler("SenseMoveThread");
         Profiler waitprof = Profiler("SenseMoveThreadWait");
     #endif
+    TraceSplits trace;                  // each stage of the loop
+    TraceSplits frame;                  // the whole loop
     
     int err = 0;
     while (err == 0 && errno != EINTR)
@@ -113,26 +116,32 @@ void SenseMoveThread::run()
             #ifdef THREAD_SENSEMOVE_PROFILE
                 prof.start();
             #endif
+            trace.start();
+            frame.start();
             m_nubot->m_platform->updateSensors();
             #ifdef THREAD_SENSEMOVE_PROFILE
                 prof.split("sensors");
             #endif
+            TRACE_SPLIT(trace, "sensemove sensors");
             #ifdef USE_MOTION
                 m_nubot->m_motion->process(Blackboard->Sensors, Blackboard->Actions);
                 #ifdef THREAD_SENSEMOVE_PROFILE
                     prof.split("motion");
                 #endif
+                TRACE_SPLIT(trace, "sensemove motion");
             #endif
             #if defined(USE_BEHAVIOUR) and not defined(USE_VISION) and not defined(USE_LOCALISATION)        // This is a special clause. When there is no vision or localisation we reduce down to a single thread; ie the behaviour is no called from this thread.
                 m_nubot->m_behaviour->process(Blackboard->Jobs, Blackboard->Sensors, Blackboard->Actions, Blackboard->Objects, Blackboard->GameInfo, Blackboard->TeamInfo);
                 #ifdef THREAD_SENSEMOVE_PROFILE
                     prof.split("behaviour");
                 #endif
+                TRACE_SPLIT(trace, "sensemove behaviour");
                 #if defined(USE_MOTION)
                     m_nubot->m_motion->process(Blackboard->Jobs);
                     #ifdef THREAD_SENSEMOVE_PROFILE
                     prof.split("motion_jobs");
                     #endif
+                    TRACE_SPLIT(trace, "sensemove motion jobs");
                 #endif
             #endif
             m_nubot->m_platform->processActions();
@@ -140,6 +149,8 @@ void SenseMoveThread::run()
                 prof.split("actionators");
                 debug << prof;
             #endif
+            TRACE_SPLIT(trace, "sensemove actionators");
+            TRACE_SPLIT(frame, "sensemove");
             // -----------------------------------------------------------------------------------------------------------------------------------------------------------------
         }
         catch (std::exception& e) 
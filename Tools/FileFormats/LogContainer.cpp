@@ -0,0 +1,291 @@
+/*! @file LogContainer.cpp
+    @brief Implementation of the LogContainer class.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogContainer.h"
+#include "debug.h"
+
+#include <string.h>
+
+const char LogContainer::Header[4] = {'N', 'U', 'l', 'g'};
+const char LogContainer::IndexMarker[4] = {'N', 'U', 'i', 'x'};
+
+static const char* StreamNames[LogContainer::NumStreams] = {"sensor", "locsensor", "image", "object", "teaminfo", "gameinfo"};
+
+static void putUint32(char* buffer, uint32_t value)
+{
+    for (int i=0; i<4; i++)
+        buffer[i] = static_cast<char>(value >> (8*i));
+}
+
+static void putUint64(char* buffer, uint64_t value)
+{
+    putUint32(buffer, static_cast<uint32_t>(value));
+    putUint32(buffer + 4, static_cast<uint32_t>(value >> 32));
+}
+
+static void putDouble(char* buffer, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    putUint64(buffer, bits);
+}
+
+static uint32_t getUint32(const char* buffer)
+{
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(buffer);
+    return b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+}
+
+static uint64_t getUint64(const char* buffer)
+{
+    return getUint32(buffer) | (static_cast<uint64_t>(getUint32(buffer + 4)) << 32);
+}
+
+static double getDouble(const char* buffer)
+{
+    uint64_t bits = getUint64(buffer);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*! @brief Returns the name of the stream, as used in the name of its stream file */
+std::string LogContainer::getStreamName(stream_t stream)
+{
+    if (stream < 0 or stream >= NumStreams)
+        return "unknown";
+    return StreamNames[stream];
+}
+
+/*! @brief Returns the stream with the given name, or NumStreams if there isn't one */
+LogContainer::stream_t LogContainer::getStream(const std::string& name)
+{
+    for (int i=0; i<NumStreams; i++)
+    {
+        if (name == StreamNames[i])
+            return static_cast<stream_t>(i);
+    }
+    return NumStreams;
+}
+
+/*! @brief Writes the HeaderSize bytes at the start of the container */
+void LogContainer::encodeHeader(char* buffer)
+{
+    memcpy(buffer, Header, 4);
+    putUint32(buffer + 4, Version);
+}
+
+/*! @brief Writes the RecordHeaderSize bytes in front of each record */
+void LogContainer::encodeRecordHeader(char* buffer, stream_t stream, uint32_t size, double time)
+{
+    buffer[0] = static_cast<char>(stream);
+    buffer[1] = buffer[2] = buffer[3] = 0;
+    putUint32(buffer + 4, size);
+    putDouble(buffer + 8, time);
+}
+
+/*! @brief Writes the IndexEntrySize bytes of an entry in the index footer */
+void LogContainer::encodeIndexEntry(char* buffer, const IndexEntry& entry)
+{
+    putUint64(buffer, entry.offset);
+    putDouble(buffer + 8, entry.time);
+    putUint32(buffer + 16, entry.size);
+    buffer[20] = static_cast<char>(entry.stream);
+    buffer[21] = buffer[22] = buffer[23] = 0;
+}
+
+/*! @brief Writes the TrailerSize bytes at the very end of the container */
+void LogContainer::encodeTrailer(char* buffer, uint64_t indexoffset, uint32_t numentries)
+{
+    putUint64(buffer, indexoffset);
+    putUint32(buffer + 8, numentries);
+    memcpy(buffer + 12, IndexMarker, 4);
+}
+
+LogContainer::LogContainer() : m_indexed(false)
+{
+}
+
+LogContainer::~LogContainer()
+{
+    close();
+}
+
+/*! @brief Opens a container and loads its index
+    @param path the path to the container
+    @return true if the file is a container. It is still opened if it does not have an index footer.
+ */
+bool LogContainer::open(const std::string& path)
+{
+    close();
+    m_file.open(path.c_str(), std::ios_base::in | std::ios_base::binary);
+    if (not m_file.is_open())
+    {
+        errorlog << "LogContainer::open(). Unable to open " << path << std::endl;
+        return false;
+    }
+
+    char header[HeaderSize];
+    m_file.read(header, HeaderSize);
+    if (not m_file.good() or memcmp(header, Header, 4) != 0 or getUint32(header + 4) != Version)
+    {
+        errorlog << "LogContainer::open(). " << path << " is not a version " << Version << " log container" << std::endl;
+        close();
+        return false;
+    }
+
+    m_file.seekg(0, std::ios_base::end);
+    uint64_t filesize = m_file.tellg();
+    m_indexed = readIndex(filesize);
+    if (not m_indexed)
+    {
+        debug << "LogContainer::open(). " << path << " has no index. Walking the records instead." << std::endl;
+        scanRecords(filesize);
+    }
+    return true;
+}
+
+void LogContainer::close()
+{
+    if (m_file.is_open())
+        m_file.close();
+    m_file.clear();
+    m_index.clear();
+    m_indexed = false;
+}
+
+/*! @brief Reads the data of a record
+    @param i the position of the record in the index
+    @param data will be updated with the record's data; the bytes written by the stream's operator<<
+    @return true if the record was read
+ */
+bool LogContainer::readRecord(unsigned int i, std::vector<char>& data)
+{
+    if (i >= m_index.size())
+        return false;
+    const IndexEntry& entry = m_index[i];
+    data.resize(entry.size);
+    m_file.clear();
+    m_file.seekg(entry.offset + RecordHeaderSize);
+    if (entry.size > 0)
+        m_file.read(&data[0], entry.size);
+    return m_file.good();
+}
+
+/*! @brief Converts the container back into the per-type stream files the LogRecorder used to write
+    @param prefix the start of each file's path. The stream name and ".strm" are appended to it, so a prefix
+                  of "<data dir><robot number>_" gives the file names in LogRecorder::GetLogPath.
+    @return true if every record was converted
+ */
+bool LogContainer::toStreams(const std::string& prefix)
+{
+    std::ofstream files[NumStreams];
+    std::vector<char> data;
+    bool ok = true;
+    for (unsigned int i=0; i<m_index.size(); i++)
+    {
+        int stream = m_index[i].stream;
+        if (stream >= NumStreams or not readRecord(i, data))
+        {
+            ok = false;
+            continue;
+        }
+        if (not files[stream].is_open())
+        {
+            std::string path = prefix + StreamNames[stream] + ".strm";
+            files[stream].open(path.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+            if (not files[stream].is_open())
+                errorlog << "LogContainer::toStreams(). Unable to open " << path << std::endl;
+        }
+        if (not data.empty())
+            files[stream].write(&data[0], data.size());
+        ok = ok and files[stream].good();
+    }
+    return ok;
+}
+
+/*! @brief Loads the index footer
+    @return false if the container does not have a valid footer
+ */
+bool LogContainer::readIndex(uint64_t filesize)
+{
+    if (filesize < HeaderSize + TrailerSize)
+        return false;
+
+    char trailer[TrailerSize];
+    m_file.clear();
+    m_file.seekg(filesize - TrailerSize);
+    m_file.read(trailer, TrailerSize);
+    if (not m_file.good() or memcmp(trailer + 12, IndexMarker, 4) != 0)
+        return false;
+
+    uint64_t indexoffset = getUint64(trailer);
+    uint32_t numentries = getUint32(trailer + 8);
+    if (indexoffset < HeaderSize or indexoffset + static_cast<uint64_t>(numentries)*IndexEntrySize + TrailerSize != filesize)
+        return false;
+
+    std::vector<char> buffer(static_cast<size_t>(numentries)*IndexEntrySize);
+    m_file.seekg(indexoffset);
+    if (not buffer.empty())
+        m_file.read(&buffer[0], buffer.size());
+    if (not m_file.good())
+        return false;
+
+    m_index.resize(numentries);
+    for (uint32_t i=0; i<numentries; i++)
+    {
+        const char* b = &buffer[i*IndexEntrySize];
+        IndexEntry& entry = m_index[i];
+        entry.offset = getUint64(b);
+        entry.time = getDouble(b + 8);
+        entry.size = getUint32(b + 16);
+        entry.stream = static_cast<uint8_t>(b[20]);
+        if (entry.offset < HeaderSize or entry.offset + RecordHeaderSize + entry.size > indexoffset)
+        {
+            m_index.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+/*! @brief Rebuilds the index by walking the record headers from the start of the container. Used when there is no footer.
+ */
+void LogContainer::scanRecords(uint64_t filesize)
+{
+    m_index.clear();
+    uint64_t offset = HeaderSize;
+    char header[RecordHeaderSize];
+    while (offset + RecordHeaderSize <= filesize)
+    {
+        m_file.clear();
+        m_file.seekg(offset);
+        m_file.read(header, RecordHeaderSize);
+        if (not m_file.good())
+            break;
+
+        IndexEntry entry;
+        entry.offset = offset;
+        entry.stream = static_cast<uint8_t>(header[0]);
+        entry.size = getUint32(header + 4);
+        entry.time = getDouble(header + 8);
+        if (entry.stream >= NumStreams or offset + RecordHeaderSize + entry.size > filesize)
+            break;              // the last record was only partly written
+        m_index.push_back(entry);
+        offset += RecordHeaderSize + entry.size;
+    }
+}
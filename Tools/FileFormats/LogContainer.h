@@ -0,0 +1,134 @@
+/*! @file LogContainer.h
+    @brief Declaration of the LogContainer and LogRecordBuffer classes.
+
+    @class LogContainer
+    @brief Reads the binary log container written by the LogRecorder, and converts it back into the per-type stream files
+
+    The container holds every logged stream in a single file:
+        - a header: "NUlg" followed by the uint32 version
+        - the records, each a 16 byte record header (uint8 stream, 3 reserved bytes, uint32 size, double time)
+          followed by the size bytes written by the stream's operator<<
+        - an index footer: one 24 byte entry per record (uint64 offset of the record header, double time,
+          uint32 size, uint8 stream, 3 reserved bytes)
+        - a 16 byte trailer: the uint64 offset of the index, the uint32 number of entries and "NUix"
+
+    All numbers are little-endian. The footer is only written when the recorder is shut down cleanly; if it is
+    missing (ie. the robot lost power) the index is rebuilt by walking the records, and any partly written record
+    at the end of the file is ignored.
+
+    @class LogRecordBuffer
+    @brief A streambuf that appends everything written to it to a vector, so records can be serialised with the existing
+           operator<< without a stringstream allocating a new buffer every time
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOGCONTAINER_H
+#define LOGCONTAINER_H
+
+#include <stdint.h>
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+class LogContainer
+{
+public:
+    enum stream_t
+    {
+        SensorStream = 0,
+        LocSensorStream,
+        ImageStream,
+        ObjectStream,
+        TeamInfoStream,
+        GameInfoStream,
+        NumStreams
+    };
+
+    struct IndexEntry
+    {
+        uint64_t offset;            //!< the position of the record header in the file
+        double time;                //!< the time of the record in ms
+        uint32_t size;              //!< the size of the record's data in bytes
+        uint8_t stream;             //!< the stream_t of the record
+    };
+
+    static const char Header[4];
+    static const char IndexMarker[4];
+    static const uint32_t Version = 1;
+    static const int HeaderSize = 8;
+    static const int RecordHeaderSize = 16;
+    static const int IndexEntrySize = 24;
+    static const int TrailerSize = 16;
+
+    static std::string getStreamName(stream_t stream);
+    static stream_t getStream(const std::string& name);
+
+    static void encodeHeader(char* buffer);
+    static void encodeRecordHeader(char* buffer, stream_t stream, uint32_t size, double time);
+    static void encodeIndexEntry(char* buffer, const IndexEntry& entry);
+    static void encodeTrailer(char* buffer, uint64_t indexoffset, uint32_t numentries);
+public:
+    LogContainer();
+    ~LogContainer();
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isIndexed() const {return m_indexed;}
+    unsigned int getNumRecords() const {return m_index.size();}
+    const IndexEntry& getRecord(unsigned int i) const {return m_index[i];}
+    bool readRecord(unsigned int i, std::vector<char>& data);
+
+    bool toStreams(const std::string& prefix);
+private:
+    bool readIndex(uint64_t filesize);
+    void scanRecords(uint64_t filesize);
+private:
+    std::ifstream m_file;                   //!< the open container
+    std::vector<IndexEntry> m_index;        //!< an entry for each complete record in the container, in file order
+    bool m_indexed;                         //!< true if m_index was read from the footer, false if it was rebuilt by walking the records
+};
+
+class LogRecordBuffer : public std::streambuf
+{
+public:
+    LogRecordBuffer() : m_target(NULL) {}
+
+    /*! @brief Clears target, and appends everything written from now on to it */
+    void setTarget(std::vector<char>* target)
+    {
+        m_target = target;
+        m_target->clear();
+    }
+protected:
+    int_type overflow(int_type c)
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof()))
+            return traits_type::not_eof(c);
+        m_target->push_back(traits_type::to_char_type(c));
+        return c;
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize numbytes)
+    {
+        m_target->insert(m_target->end(), data, data + numbytes);
+        return numbytes;
+    }
+private:
+    std::vector<char>* m_target;            //!< the vector being appended to
+};
+
+#endif
@@ -1,181 +1,265 @@
 #include "LogRecorder.h"
+#include "LogWriterThread.h"
 #include "debug.h"
-#include "Infrastructure/NUSensorsData/NUSensorsData.h"
-#include "Infrastructure/NUImage/NUImage.h"
 #include "Infrastructure/TeamInformation/TeamInformation.h"
 #include "Infrastructure/GameInformation/GameInformation.h"
-#include "Infrastructure/FieldObjects/FieldObjects.h"
 
-LogFileWriter::LogFileWriter(std::string data_type)
+LogRecorder::LogRecorder(int playerNumber) : m_info_stream(&m_info_buffer), m_record_stream(&m_record_buffer), m_stopping(false)
 {
-    m_data_name = data_type;
-    m_status = lf_UNKNOWN;
-}
-
-
-LogFileWriter::~LogFileWriter()
-{
-    m_file_stream.close();
+    m_player_number = playerNumber;
+    for (int i = 0; i < LogContainer::NumStreams; i++)
+    {
+        m_enabled[i] = false;
+        m_dropped[i] = 0;
+    }
+    m_file_offset = 0;
+    m_writer = new LogWriterThread(this);
 }
 
-std::string LogFileWriter::toString()
+/*! @brief Stops the writer, writes everything still queued and the index footer, and closes the container.
+ */
+LogRecorder::~LogRecorder()
 {
-    std::stringstream result;
-    return result.str();
-}
+    m_stopping.store(true);
+    m_writer->signal(true);         // wait for the writer to get back to wait(), so the signal can't be missed
+    m_writer->join();
+    delete m_writer;
+    CloseContainer();
 
-bool LogFileWriter::Open(std::string file_path)
-{
-    debug << "LW:Opening log file: " << file_path << " - ";
-    m_file_stream.open(file_path.c_str(),std::ios_base::out | std::ios_base::trunc);
-    if(m_file_stream.is_open() && m_file_stream.good())
+    for (int i = 0; i < LogContainer::NumStreams; i++)
     {
-        m_file_name = file_path;
-        m_status = lf_OPEN;
-        debug << "SUCCESS" << std::endl;
-        return true;
-    }
-    else
-    {
-        m_status = lf_UNAVAILABLE;
-        debug << "FAILED" << std::endl;
-        return false;
+        if (m_dropped[i] > 0)
+            debug << "LogRecorder dropped " << m_dropped[i] << " " << LogContainer::getStreamName(static_cast<LogContainer::stream_t>(i)) << " records" << std::endl;
     }
 }
 
-bool LogFileWriter::Close()
+/*! @brief Turns the recording of a stream on or off
+    @param dataType the name of the stream; sensor, locsensor, image, object, teaminfo or gameinfo
+    @param enabled true to record the stream
+    @return true if the stream is now in the requested state
+ */
+bool LogRecorder::SetLogging(std::string dataType, bool enabled)
 {
-    m_file_stream.close();
-    if(!m_file_stream.is_open())
-    {
-        m_status = lf_CLOSED;
-        return true;
-    }
-    else
-    {
-        m_status = lf_UNKNOWN;
+    LogContainer::stream_t stream = LogContainer::getStream(dataType);
+    if (stream == LogContainer::NumStreams)
         return false;
-    }
+    if (enabled and not OpenContainer())
+        return false;
+    m_enabled[stream] = enabled;
+    return true;
 }
 
-LogRecorder::LogRecorder(int playerNumber)
+/*! @brief Returns the number of records of a stream that have been dropped because the writer fell behind
+ */
+unsigned int LogRecorder::GetNumDropped(std::string dataType)
 {
-    m_player_number = playerNumber;
-    m_log_writers.push_back(new LogFileWriter("sensor"));
-    m_log_writers.push_back(new LogFileWriter("locsensor"));
-    m_log_writers.push_back(new LogFileWriter("image"));
-    m_log_writers.push_back(new LogFileWriter("object"));
-    m_log_writers.push_back(new LogFileWriter("teaminfo"));
-    m_log_writers.push_back(new LogFileWriter("gameinfo"));
+    LogContainer::stream_t stream = LogContainer::getStream(dataType);
+    if (stream == LogContainer::NumStreams)
+        return 0;
+    return m_dropped[stream];
 }
 
-LogRecorder::~LogRecorder()
+/*! @brief Queues a record of each enabled stream to be written by the writer thread. This does not wait for the writer.
+ */
+bool LogRecorder::WriteData(NUBlackboard* theBlackboard)
 {
-    std::vector<LogFileWriter*>::iterator it;
-    for(it = m_log_writers.begin(); it != m_log_writers.end(); ++it)
-    {
-        delete (*it);
-    }
-    m_log_writers.clear();
-    return;
-}
+    double time = theBlackboard->Sensors->GetTimestamp();
+    bool queued = false;
 
-bool LogRecorder::SetLogging(std::string dataType, bool enabled)
-{
-    LogFileWriter* target = GetDataWriter(dataType);
-    if(target == NULL) return false;
-    bool success = false;
-    bool log_reset_required = false;
-    switch(target->GetFileStatus())
+    if (m_enabled[LogContainer::SensorStream])
     {
-    case lf_CLOSED:
-        if(enabled)
+        NUSensorsData* slot = m_sensors.beginWrite();
+        if (slot != NULL)
         {
-            target->Open(GetLogPath(m_player_number, dataType));
-            log_reset_required = true;
-            success = (target->GetFileStatus() == lf_OPEN);
+            *slot = *(theBlackboard->Sensors);
+            m_sensors.endWrite(time);
+            queued = true;
         }
         else
+            m_dropped[LogContainer::SensorStream]++;
+    }
+    if (m_enabled[LogContainer::LocSensorStream])
+    {
+        NULocalisationSensors* slot = m_locsensors.beginWrite();
+        if (slot != NULL)
         {
-            success = true;
+            *slot = theBlackboard->Sensors->getLocSensors();
+            m_locsensors.endWrite(time);
+            queued = true;
         }
-        break;
-    case lf_OPEN:
-        if(enabled)
+        else
+            m_dropped[LogContainer::LocSensorStream]++;
+    }
+    if (m_enabled[LogContainer::ImageStream] and theBlackboard->Image != NULL)
+    {
+        NUImage* slot = m_images.beginWrite();
+        if (slot != NULL)
         {
-            success = true;
+            slot->copyFromExisting(*(theBlackboard->Image));
+            m_images.endWrite(time);
+            queued = true;
         }
         else
+            m_dropped[LogContainer::ImageStream]++;
+    }
+    if (m_enabled[LogContainer::ObjectStream] and theBlackboard->Objects != NULL)
+    {
+        FieldObjects* slot = m_objects.beginWrite();
+        if (slot != NULL)
         {
-            target->Close();
-            log_reset_required = true;
-            success = (target->GetFileStatus() == lf_CLOSED);
+            *slot = *(theBlackboard->Objects);
+            m_objects.endWrite(time);
+            queued = true;
         }
-        break;
-    case lf_UNAVAILABLE:
-        success = false;
-        break;
-    case lf_UNKNOWN:
-        if(enabled)
+        else
+            m_dropped[LogContainer::ObjectStream]++;
+    }
+    if (m_enabled[LogContainer::TeamInfoStream] and theBlackboard->TeamInfo != NULL)
+    {
+        std::vector<char>* slot = m_teaminfo.beginWrite();
+        if (slot != NULL)
         {
-            target->Open(GetLogPath(m_player_number,dataType));
-            log_reset_required = true;
-            success = (target->GetFileStatus() == lf_OPEN);
+            m_info_buffer.setTarget(slot);
+            m_info_stream << *(theBlackboard->TeamInfo);
+            m_teaminfo.endWrite(time);
+            queued = true;
         }
         else
+            m_dropped[LogContainer::TeamInfoStream]++;
+    }
+    if (m_enabled[LogContainer::GameInfoStream] and theBlackboard->GameInfo != NULL)
+    {
+        std::vector<char>* slot = m_gameinfo.beginWrite();
+        if (slot != NULL)
         {
-            target->Close();
-            log_reset_required = true;
-            success = (target->GetFileStatus() == lf_CLOSED);
+            m_info_buffer.setTarget(slot);
+            m_info_stream << *(theBlackboard->GameInfo);
+            m_gameinfo.endWrite(time);
+            queued = true;
         }
-        break;
-    default:
-        success = false;
+        else
+            m_dropped[LogContainer::GameInfoStream]++;
     }
-    return success;
+
+    if (queued)
+        m_writer->signal(false);    // if the writer is still busy it will pick these up on the next frame
+    return true;
 }
 
-bool LogRecorder::HasDataType(std::string dataType)
+/*! @brief Opens the container, if it is not already open, and writes its header
+    @return true if the container is open
+ */
+bool LogRecorder::OpenContainer()
 {
-    std::vector<LogFileWriter*>::iterator it;
-    for(it = m_log_writers.begin(); it != m_log_writers.end(); ++it)
+    if (m_file.is_open())
+        return true;
+
+    std::string path = GetContainerPath(m_player_number);
+    debug << "LogRecorder: Opening log container: " << path << " - ";
+    m_file.open(path.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if (not m_file.is_open() or not m_file.good())
     {
-        if((*it)->GetDataType() == dataType) return true;
+        debug << "FAILED" << std::endl;
+        return false;
     }
-    return false;
+    debug << "SUCCESS" << std::endl;
+
+    char header[LogContainer::HeaderSize];
+    LogContainer::encodeHeader(header);
+    m_file.write(header, LogContainer::HeaderSize);
+    m_file.flush();
+    m_file_offset = LogContainer::HeaderSize;
+    return true;
 }
 
-LogFileWriter* LogRecorder::GetDataWriter(std::string dataType)
+/*! @brief Writes anything left in the rings and the index footer, and closes the container. The writer must have been stopped.
+ */
+void LogRecorder::CloseContainer()
 {
-    std::vector<LogFileWriter*>::iterator it;
-    for(it = m_log_writers.begin(); it != m_log_writers.end(); it++)
+    if (not m_file.is_open())
+        return;
+    writePending();
+
+    uint64_t indexoffset = m_file_offset;
+    char entry[LogContainer::IndexEntrySize];
+    for (size_t i = 0; i < m_index.size(); i++)
     {
-        if((*it)->GetDataType() == dataType) return *it;
+        LogContainer::encodeIndexEntry(entry, m_index[i]);
+        m_file.write(entry, LogContainer::IndexEntrySize);
     }
-    return NULL;
+    char trailer[LogContainer::TrailerSize];
+    LogContainer::encodeTrailer(trailer, indexoffset, m_index.size());
+    m_file.write(trailer, LogContainer::TrailerSize);
+    m_file.close();
 }
 
-bool LogRecorder::WriteData(NUBlackboard* theBlackboard)
+/*! @brief Writes every queued record to the container. The streams are taken in turn, a record at a time,
+           so the records in the container stay in roughly the order they were recorded.
+ */
+void LogRecorder::writePending()
 {
-    std::vector<LogFileWriter*>::iterator it;
-    for(it = m_log_writers.begin(); it != m_log_writers.end(); ++it)
+    if (not m_file.is_open())
+        return;
+
+    bool wrote = true;
+    while (wrote)
     {
-        if((*it)->GetFileStatus() == lf_OPEN)
-        {
-            std::string data_type = (*it)->GetDataType();
-            if(data_type == "sensor")
-                (*it)->GetFile() << *(theBlackboard->Sensors) << std::flush;
-            else if(data_type == "locsensor")
-                (*it)->GetFile() << theBlackboard->Sensors->getLocSensors() << std::flush;
-            else if(data_type == "image")
-                (*it)->GetFile() << *(theBlackboard->Image) << std::flush;
-            else if(data_type == "object")
-                (*it)->GetFile() << *(theBlackboard->Objects) << std::flush;
-            else if(data_type == "gameinfo")
-                (*it)->GetFile() << *(theBlackboard->GameInfo) << std::flush;
-            else if(data_type == "teaminfo")
-                (*it)->GetFile() << *(theBlackboard->TeamInfo) << std::flush;
-        }
+        wrote = false;
+        wrote |= writeNext(m_sensors, LogContainer::SensorStream);
+        wrote |= writeNext(m_locsensors, LogContainer::LocSensorStream);
+        wrote |= writeNext(m_images, LogContainer::ImageStream);
+        wrote |= writeNext(m_objects, LogContainer::ObjectStream);
+        wrote |= writeNext(m_teaminfo, LogContainer::TeamInfoStream);
+        wrote |= writeNext(m_gameinfo, LogContainer::GameInfoStream);
     }
+    m_file.flush();                 // so that as little as possible is lost if the robot loses power
+}
+
+/*! @brief Serialises the oldest record in a ring with its operator<<, and writes it to the container
+    @return true if there was a record to write
+ */
+template <typename T, unsigned int N> bool LogRecorder::writeNext(LogRing<T, N>& ring, LogContainer::stream_t stream)
+{
+    double time;
+    const T* data = ring.beginRead(time);
+    if (data == NULL)
+        return false;
+    m_record_buffer.setTarget(&m_record);
+    m_record_stream << *data;
+    ring.endRead();
+    writeRecord(stream, time, m_record);
     return true;
 }
+
+/*! @brief Writes the oldest record in a ring that was serialised by the caller
+    @return true if there was a record to write
+ */
+template <unsigned int N> bool LogRecorder::writeNext(LogRing<std::vector<char>, N>& ring, LogContainer::stream_t stream)
+{
+    double time;
+    const std::vector<char>* data = ring.beginRead(time);
+    if (data == NULL)
+        return false;
+    writeRecord(stream, time, *data);
+    ring.endRead();
+    return true;
+}
+
+/*! @brief Writes a record header and data to the container, and adds the record to the index
+ */
+void LogRecorder::writeRecord(LogContainer::stream_t stream, double time, const std::vector<char>& data)
+{
+    LogContainer::IndexEntry entry;
+    entry.offset = m_file_offset;
+    entry.time = time;
+    entry.size = data.size();
+    entry.stream = stream;
+
+    char header[LogContainer::RecordHeaderSize];
+    LogContainer::encodeRecordHeader(header, stream, entry.size, time);
+    m_file.write(header, LogContainer::RecordHeaderSize);
+    if (not data.empty())
+        m_file.write(&data[0], data.size());
+    m_file_offset += LogContainer::RecordHeaderSize + data.size();
+    m_index.push_back(entry);
+}
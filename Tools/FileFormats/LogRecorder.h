@@ -1,6 +1,7 @@
 #ifndef LOGRECORDER_H
 #define LOGRECORDER_H
 
+#include <atomic>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -8,83 +9,88 @@
 #include "nubotdataconfig.h"
 #include "targetconfig.h"
 #include "Infrastructure/NUBlackboard.h"
+#include "Infrastructure/NUSensorsData/NUSensorsData.h"
+#include "Infrastructure/NUSensorsData/NULocalisationSensors.h"
+#include "Infrastructure/NUImage/NUImage.h"
+#include "Infrastructure/FieldObjects/FieldObjects.h"
+#include "LogContainer.h"
+#include "LogRing.h"
 
-enum LogFileStatus
-{
-    lf_CLOSED,
-    lf_OPEN,
-    lf_UNAVAILABLE,
-    lf_UNKNOWN
-};
-
-// Wrapper for log file writer class. One of these is required for each data type.
-class LogFileWriter
-{
-public:
-    LogFileWriter(std::string data_type);
-    ~LogFileWriter();
-
-    bool Open(std::string log_path);
-    bool Close();
-
-    std::string GetDataType()
-    {
-        return m_data_name;
-    };
-
-    std::string GetFileName()
-    {
-        return m_file_name;
-    };
-
-    LogFileStatus GetFileStatus()
-    {
-        return m_status;
-    }
-
-    std::fstream& GetFile()
-    {
-        return m_file_stream;
-    }
-
-    std::string toString();
-
-private:
-    std::string m_data_name;
-    std::string m_file_name;
-    LogFileStatus m_status;
-    std::fstream m_file_stream;
-
-};
+class LogWriterThread;
 
+// Records the blackboard's streams into a single log container (see LogContainer). WriteData() runs in the see-think
+// thread, so it only copies each enabled stream into a LogRing for the LogWriterThread; it never waits for the disk.
 class LogRecorder
 {
-
 public:
     LogRecorder(int playerNumber);
     ~LogRecorder();
     bool SetLogging(std::string dataType, bool enabled);
     bool WriteData(NUBlackboard* theBlackboard);
-    static std::string GetLogPath(int robot_number, std::string data_name)
+    unsigned int GetNumDropped(std::string dataType);
+
+    static std::string GetDataDir()
     {
-        const std::string extension = "strm";
-        const std::string seperator = ".";
 #ifdef TARGET_IS_NAO
-        const std::string data_dir = "/var/volatile/";
+        return "/var/volatile/";
 #else
-        const std::string data_dir = std::string(DATA_DIR);
+        return std::string(DATA_DIR);
 #endif
+    };
+
+    static std::string GetLogPath(int robot_number, std::string data_name)
+    {
+        const std::string extension = "strm";
+        const std::string seperator = ".";
         std::stringstream filename;
-        filename << data_dir << robot_number << "_" << data_name << seperator << extension;
+        filename << GetDataDir() << robot_number << "_" << data_name << seperator << extension;
+        return filename.str();
+    };
+
+    static std::string GetContainerPath(int robot_number)
+    {
+        std::stringstream filename;
+        filename << GetDataDir() << robot_number << "_log.nulog";
         return filename.str();
     };
 
 private:
-    int m_player_number;
-    bool HasDataType(std::string dataType);
-    LogFileWriter* GetDataWriter(std::string dataType);
-    std::vector<LogFileWriter*> m_log_writers;
+    friend class LogWriterThread;
+    bool isStopping() const {return m_stopping.load();}
+    void writePending();
+
+    bool OpenContainer();
+    void CloseContainer();
+    template <typename T, unsigned int N> bool writeNext(LogRing<T, N>& ring, LogContainer::stream_t stream);
+    template <unsigned int N> bool writeNext(LogRing<std::vector<char>, N>& ring, LogContainer::stream_t stream);
+    void writeRecord(LogContainer::stream_t stream, double time, const std::vector<char>& data);
 
+private:
+    static const unsigned int RingSize = 8;             //!< the number of records of each stream that can be waiting to be written
+    static const unsigned int ImageRingSize = 4;        //!< the number of images that can be waiting to be written
+
+    int m_player_number;
+    bool m_enabled[LogContainer::NumStreams];           //!< true if the stream is being recorded. Only used by the caller
+    unsigned int m_dropped[LogContainer::NumStreams];   //!< the number of records dropped because the writer fell behind. Only used by the caller
+    LogRecordBuffer m_info_buffer;                      //!< the buffer the game and team information are serialised through by the caller
+    std::ostream m_info_stream;                         //!< the stream writing into m_info_buffer
+
+    LogRing<NUSensorsData, RingSize> m_sensors;
+    LogRing<NULocalisationSensors, RingSize> m_locsensors;
+    LogRing<NUImage, ImageRingSize> m_images;
+    LogRing<FieldObjects, RingSize> m_objects;
+    LogRing<std::vector<char>, RingSize> m_teaminfo;
+    LogRing<std::vector<char>, RingSize> m_gameinfo;
+
+    std::ofstream m_file;                               //!< the container. Only used by the writer once it is open
+    uint64_t m_file_offset;                             //!< the number of bytes written to the container
+    std::vector<LogContainer::IndexEntry> m_index;      //!< an entry for each record written, to go in the footer
+    LogRecordBuffer m_record_buffer;                    //!< the buffer records are serialised through by the writer
+    std::ostream m_record_stream;                       //!< the stream writing into m_record_buffer
+    std::vector<char> m_record;                         //!< the record being written
+
+    std::atomic<bool> m_stopping;                       //!< set when the recorder is being destroyed, to stop the writer
+    LogWriterThread* m_writer;                          //!< the thread writing the records
 };
 
 #endif // LOGRECORDER_H
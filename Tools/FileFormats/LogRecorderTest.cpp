@@ -0,0 +1,294 @@
+/*! @file LogRecorderTest.cpp
+    @brief A test that logging does not slow down the see-think frame, and that the log container holds what was logged
+
+    Frames are run at 30 Hz from a SCHED_FIFO thread, like the see-think thread on the robot, first with logging
+    off and then with every stream except locsensor logged. Each frame does about 5 ms of work and then calls
+    LogRecorder::WriteData. The test checks that
+        - the frame is never held up by logging; the writer thread, being low priority, does all of its serialising
+          and writing in the time the frame leaves over. This is measured as the time in the frame that the frame's
+          thread was not running, rather than by comparing frame times, which vary by several percent between runs
+          on a virtual machine.
+        - WriteData stays within a budget for each stream it copies, and the wake of the writer
+        - no records are dropped
+        - the container converts back into stream files identical to writing each stream with operator<<
+        - a container that lost its footer and part of its last record still has every complete record
+    It then logs each stream on its own and checks each against its budget. Each of those includes waking the writer,
+    about 15 us. The image is the known limit: WriteData copies the whole 320x240 image into a ring slot that is not
+    in the cache, which costs about 60 us of the roughly 110 us WriteData takes with every stream on. Only logging
+    a smaller image, or handing the writer the camera's buffer instead of a copy, would bring that down.
+    The locsensor stream is left out because getLocSensors() needs a NUSensorsData set up by a platform.
+
+    Build and run from this directory with
+    @code
+        make LogRecorderTest && ./LogRecorderTest [frames]
+    @endcode
+    It returns non-zero if any check fails. The container and stream files are written to ./nubot.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogRecorder.h"
+#include "LogContainer.h"
+#include "Infrastructure/NUBlackboard.h"
+#include "Infrastructure/NUSensorsData/NUSensorsData.h"
+#include "Infrastructure/NUImage/NUImage.h"
+#include "Infrastructure/FieldObjects/FieldObjects.h"
+#include "Infrastructure/GameInformation/GameInformation.h"
+#include "Infrastructure/TeamInformation/TeamInformation.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+static const double FramePeriod = 33333;    //!< the see-think period in us
+static const int PlayerNumber = 2;
+
+static int failures = 0;
+
+static void check(bool condition, const char* description, double value)
+{
+    printf("  %s %s (%g)\n", condition ? "ok:    " : "FAILED:", description, value);
+    if (not condition)
+        failures++;
+}
+
+/*! @brief Returns the time in us */
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return 1e6*time.tv_sec + 1e-3*time.tv_nsec;
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size()/2];
+}
+
+static double percentile99(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size()*99/100];
+}
+
+/*! @brief Returns the cpu time used by the calling thread in us */
+static double threadTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return 1e6*time.tv_sec + 1e-3*time.tv_nsec;
+}
+
+/*! @brief A fixed amount of work standing in for the rest of the frame */
+static volatile double sink;
+static void work()
+{
+    double sum = 0;
+    for (int i=0; i<4000000; i++)
+        sum += i*1e-9*(i & 7);
+    sink = sum;
+}
+
+/*! @brief Changes the blackboard a little each frame, so that no two records are the same */
+static void updateBlackboard(int frame)
+{
+    double time = FramePeriod*1e-3*frame;
+    Blackboard->Sensors->CurrentTime = time;
+    Blackboard->Sensors->set(NUSensorsData::HeadYaw, time, 0.01f*frame);
+    Blackboard->Sensors->set(NUSensorsData::Odometry, time, std::vector<float>(3, 0.1f*frame));
+    Blackboard->Image->setTimestamp(time);
+    for (int y=0; y<Blackboard->Image->getHeight(); y += 7)
+    {
+        Pixel pixel = Blackboard->Image->at(frame % Blackboard->Image->getWidth(), y);
+        pixel.y = frame;
+        Blackboard->Image->setPixel(frame % Blackboard->Image->getWidth(), y, pixel);
+    }
+    Blackboard->Objects->m_timestamp = time;
+}
+
+struct Pass
+{
+    std::vector<double> FrameTimes;         //!< the time of the work and WriteData in us
+    std::vector<double> WaitTimes;          //!< the time in the frame that the frame's thread was not running in us
+    std::vector<double> WriteTimes;         //!< the time of WriteData in us
+    unsigned int Dropped;
+    std::string Expected[LogContainer::NumStreams];
+};
+
+static const char* LoggedStreams[] = {"sensor", "image", "object", "teaminfo", "gameinfo"};
+static const int NumLoggedStreams = sizeof(LoggedStreams)/sizeof(*LoggedStreams);
+static const double StreamBudgets[] = {30, 100, 30, 30, 30};   //!< the median cost of copying each stream in WriteData in us
+static const double WakeBudget = 20;                            //!< the median cost of waking the writer in us
+
+/*! @brief Runs numframes frames logging the given streams
+    @param streams the names of the streams to log
+    @param numstreams the number of streams to log, 0 for logging off
+    @param numframes the number of frames to run
+    @param verbose print the frame and WriteData times
+ */
+static Pass run(const char** streams, int numstreams, int numframes, bool verbose = true)
+{
+    Pass pass;
+    pass.Dropped = 0;
+    bool logging = numstreams > 0;
+    LogRecorder* recorder = new LogRecorder(PlayerNumber);
+    for (int i=0; i<numstreams; i++)
+    {
+        if (not recorder->SetLogging(streams[i], true))
+            printf("  Unable to log %s\n", streams[i]);
+    }
+
+    std::ostringstream expected[LogContainer::NumStreams];
+    for (int frame=0; frame<numframes; frame++)
+    {
+        updateBlackboard(frame);
+        double start = now();
+        double startcpu = threadTime();
+        work();
+        double write = now();
+        recorder->WriteData(Blackboard);
+        double end = now();
+        pass.FrameTimes.push_back(end - start);
+        pass.WaitTimes.push_back(std::max(0.0, (end - start) - (threadTime() - startcpu)));
+        pass.WriteTimes.push_back(end - write);
+
+        if (logging and numstreams == NumLoggedStreams)
+        {
+            expected[LogContainer::SensorStream] << *Blackboard->Sensors;
+            expected[LogContainer::ImageStream] << *Blackboard->Image;
+            expected[LogContainer::ObjectStream] << *Blackboard->Objects;
+            expected[LogContainer::TeamInfoStream] << *Blackboard->TeamInfo;
+            expected[LogContainer::GameInfoStream] << *Blackboard->GameInfo;
+        }
+        double remaining = FramePeriod - (now() - start);
+        if (remaining > 0)
+            usleep(static_cast<useconds_t>(remaining));
+    }
+    for (int i=0; i<numstreams; i++)
+        pass.Dropped += recorder->GetNumDropped(streams[i]);
+    delete recorder;
+    for (int i=0; i<LogContainer::NumStreams; i++)
+        pass.Expected[i] = expected[i].str();
+
+    if (verbose)
+    {
+        printf("  frame:      median %6.1fus  99th percentile %6.1fus\n", median(pass.FrameTimes), percentile99(pass.FrameTimes));
+        printf("  held up:    median %6.1fus  99th percentile %6.1fus\n", median(pass.WaitTimes), percentile99(pass.WaitTimes));
+        printf("  WriteData:  median %6.1fus  99th percentile %6.1fus\n", median(pass.WriteTimes), percentile99(pass.WriteTimes));
+    }
+    return pass;
+}
+
+static std::string readFile(const std::string& path)
+{
+    std::ifstream file(path.c_str(), std::ios_base::in | std::ios_base::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+static void testContainer(const Pass& logged)
+{
+    printf("Container:\n");
+    LogContainer container;
+    std::string path = LogRecorder::GetContainerPath(PlayerNumber);
+    bool opened = container.open(path);
+    check(opened and container.isIndexed(), "the container has its index", container.getNumRecords());
+
+    std::string prefix = LogRecorder::GetDataDir() + "converted_";
+    check(container.toStreams(prefix), "every record converted", 0);
+    int different = 0;
+    for (int i=0; i<NumLoggedStreams; i++)
+    {
+        LogContainer::stream_t stream = LogContainer::getStream(LoggedStreams[i]);
+        if (readFile(prefix + LoggedStreams[i] + ".strm") != logged.Expected[stream])
+            different++;
+    }
+    check(different == 0, "converted streams that differ from writing operator<< directly", different);
+
+    // lose the footer and the end of the last record, as when the robot loses power
+    std::string contents = readFile(path);
+    uint64_t indexoffset = 0;
+    for (int i=7; i>=0; i--)
+        indexoffset = (indexoffset << 8) | static_cast<unsigned char>(contents[contents.size() - LogContainer::TrailerSize + i]);
+    std::string tornpath = LogRecorder::GetDataDir() + "torn.nulog";
+    std::ofstream torn(tornpath.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    torn.write(contents.data(), indexoffset - 100);
+    torn.close();
+
+    LogContainer recovered;
+    recovered.open(tornpath);
+    check(not recovered.isIndexed() and recovered.getNumRecords() == container.getNumRecords() - 1, "records recovered from a torn container", recovered.getNumRecords());
+}
+
+int main(int argc, char** argv)
+{
+    int numframes = argc > 1 ? atoi(argv[1]) : 300;
+
+    // keep the container out of the real data directory
+    setenv("HOME", ".", 1);
+    mkdir("nubot", 0755);
+
+    sched_param parameters;
+    parameters.sched_priority = 45;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) != 0)
+        printf("Unable to make the test real-time, so the writer thread competes with the frames\n");
+
+    Blackboard = new NUBlackboard();
+    Blackboard->add(new NUSensorsData());
+    Blackboard->add(new NUImage(320, 240, true));
+    Blackboard->add(new FieldObjects());
+    Blackboard->add(new GameInformation(PlayerNumber, 13));
+    Blackboard->add(new TeamInformation(PlayerNumber, 13));
+
+    printf("Logging off, %d frames:\n", numframes);
+    Pass off = run(LoggedStreams, 0, numframes);
+    printf("Logging on, %d frames:\n", numframes);
+    Pass on = run(LoggedStreams, NumLoggedStreams, numframes);
+
+    double writetime = median(on.WriteTimes);
+    double writebudget = WakeBudget;
+    for (int i=0; i<NumLoggedStreams; i++)
+        writebudget += StreamBudgets[i];
+    // the writer runs after every frame, so if it could preempt the frame it would hold up most frames, not a few
+    check(median(on.WaitTimes) < 10, "the frame is not held up by the writer thread (median in us)", median(on.WaitTimes));
+    check(writetime < writebudget, "WriteData is within the budget of its streams (median in us)", writetime);
+    check(median(off.WriteTimes) < 5, "WriteData with logging off costs nothing (median in us)", median(off.WriteTimes));
+    check(on.Dropped == 0, "dropped records", on.Dropped);
+
+    testContainer(on);
+
+    printf("Logging each stream on its own, %d frames:\n", numframes/3);
+    for (int i=0; i<NumLoggedStreams; i++)
+    {
+        Pass alone = run(LoggedStreams + i, 1, numframes/3, false);
+        char description[64];
+        sprintf(description, "%-10s WriteData within %.0fus (median in us)", LoggedStreams[i], WakeBudget + StreamBudgets[i]);
+        check(median(alone.WriteTimes) < WakeBudget + StreamBudgets[i], description, median(alone.WriteTimes));
+    }
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
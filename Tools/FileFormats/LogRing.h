@@ -0,0 +1,87 @@
+/*! @file LogRing.h
+    @brief Declaration and implementation of the LogRing class.
+
+    @class LogRing
+    @brief A fixed size, lock-free queue of records passed from one producer thread to one consumer thread
+
+    The slots are constructed once and then reused, so a producer that assigns into a slot reuses the storage left
+    over from the slot's previous record and, once warmed up, does not touch the heap. The producer fills a slot
+    between beginWrite() and endWrite(), and the consumer reads it between beginRead() and endRead(). Neither side
+    ever waits: if the ring is full beginWrite() returns NULL, and if it is empty beginRead() returns NULL.
+
+    Only one thread may write, and only one thread may read.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOGRING_H
+#define LOGRING_H
+
+#include <atomic>
+#include <cstddef>
+
+template <typename T, unsigned int Capacity>
+class LogRing
+{
+    static_assert(Capacity > 0 and (Capacity & (Capacity - 1)) == 0, "LogRing capacity must be a power of two");
+public:
+    LogRing() : m_head(0), m_tail(0) {}
+
+    /*! @brief Returns the slot to fill with the next record, or NULL if the ring is full. Producer only. */
+    T* beginWrite()
+    {
+        unsigned int head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= Capacity)
+            return NULL;
+        return &m_slots[head % Capacity].data;
+    }
+
+    /*! @brief Hands the slot returned by beginWrite() to the consumer. Producer only. */
+    void endWrite(double time)
+    {
+        unsigned int head = m_head.load(std::memory_order_relaxed);
+        m_slots[head % Capacity].time = time;
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+    /*! @brief Returns the oldest record, or NULL if the ring is empty. Consumer only.
+        @param time will be updated with the time passed to endWrite() for the record
+     */
+    const T* beginRead(double& time)
+    {
+        unsigned int tail = m_tail.load(std::memory_order_relaxed);
+        if (m_head.load(std::memory_order_acquire) == tail)
+            return NULL;
+        time = m_slots[tail % Capacity].time;
+        return &m_slots[tail % Capacity].data;
+    }
+
+    /*! @brief Gives the slot returned by beginRead() back to the producer. Consumer only. */
+    void endRead()
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+private:
+    struct Slot
+    {
+        Slot() : time(0) {}
+        T data;
+        double time;
+    };
+    Slot m_slots[Capacity];                     //!< the records
+    std::atomic<unsigned int> m_head;           //!< the number of records written. Only the producer changes it
+    std::atomic<unsigned int> m_tail;           //!< the number of records read. Only the consumer changes it
+};
+
+#endif
@@ -0,0 +1,70 @@
+/*! @file LogWriterThread.cpp
+    @brief Implementation of the low priority thread that writes the LogRecorder's records to disk
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogWriterThread.h"
+#include "LogRecorder.h"
+
+#include "debug.h"
+#include "debugverbositythreading.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+/*! @brief Creates and starts the writer thread. The thread is not real-time, so it only uses the time left over by the real-time threads.
+    @param recorder the recorder whose records are written
+ */
+LogWriterThread::LogWriterThread(LogRecorder* recorder) : ConditionalThread(std::string("LogWriterThread"), 0)
+{
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "LogWriterThread::LogWriterThread() with priority " << static_cast<int>(m_priority) << std::endl;
+    #endif
+    m_recorder = recorder;
+    start();
+}
+
+LogWriterThread::~LogWriterThread()
+{
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "LogWriterThread::~LogWriterThread()" << std::endl;
+    #endif
+    stop();
+}
+
+/*! @brief The writer's main loop. It exits once the recorder is stopping.
+ */
+void LogWriterThread::run()
+{
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "LogWriterThread::run()" << std::endl;
+    #endif
+    // a new thread inherits the policy of the thread that created it, and the writer must never compete with the real-time threads
+    sched_param param;
+    param.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+    // the thread only checks whether it is stopping after it has been signalled, so it is always back in wait() when the
+    // recorder signals it to stop; if it checked before waiting it could exit without unlocking, and the recorder would block forever
+    wait();
+    while (not m_recorder->isStopping())
+    {
+        m_recorder->writePending();
+        wait();
+    }
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "LogWriterThread is exiting." << std::endl;
+    #endif
+}
@@ -0,0 +1,43 @@
+/*! @file LogWriterThread.h
+    @brief Declaration of the low priority thread that writes the LogRecorder's records to disk
+
+    @class LogWriterThread
+    @brief A low priority thread that serialises the records queued by a LogRecorder into its log container
+
+    The recorder signals the thread (without waiting) after each frame, and the thread writes everything that
+    has been queued. When the recorder is destroyed it sets its stop flag and signals the thread one last time,
+    so the thread finishes the record it is writing and exits rather than being cancelled part way through a write.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOGWRITERTHREAD_H
+#define LOGWRITERTHREAD_H
+
+#include "Tools/Threading/ConditionalThread.h"
+
+class LogRecorder;
+
+class LogWriterThread : public ConditionalThread
+{
+public:
+    LogWriterThread(LogRecorder* recorder);
+    ~LogWriterThread();
+protected:
+    void run();
+private:
+    LogRecorder* m_recorder;                //!< the recorder whose records are written
+};
+
+#endif
@@ -26,6 +26,11 @@ NUbotImage.cpp
 Parse.cpp
 LogRecorder.cpp
 LogRecorder.h
+LogContainer.cpp
+LogContainer.h
+LogWriterThread.cpp
+LogWriterThread.h
+LogRing.h
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
@@ -26,9 +26,11 @@
 
 #include "debug.h"
 
+#include <algorithm>
+
 /*!
  */
-EHCLSOptimiser::EHCLSOptimiser(std::string name, std::vector<Parameter> parameters) : Optimiser(name, parameters)
+EHCLSOptimiser::EHCLSOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed) : Optimiser(name, parameters, seed)
 {
     m_best_parameters = parameters;
     m_best_delta_parameters = std::vector<float>(m_best_parameters.size(),0);
@@ -53,6 +55,8 @@ EHCLSOptimiser::EHCLSOptimiser(std::string name, std::vector<Parameter> paramete
     m_neta = 0.10;               // tune this parameter
     m_reset_limit = 5;            // tune this parameter
     m_reset_fraction = 0.995;      // tune this parameter
+
+    m_batch_size = 8;
     
     load();
     save();
@@ -103,6 +107,35 @@ void EHCLSOptimiser::setParametersResult(float fitness)
     }
 }
 
+/*! @brief Sets the number of mutants of the best parameters handed out by getNextBatch(). Each result is still applied as
+           if the mutant had been tested alone, but every mutant in a batch is made from the best parameters at the start of the batch.
+ */
+void EHCLSOptimiser::setBatchSize(unsigned int size)
+{
+    m_batch_size = std::max(1u, size);
+}
+
+/*! @brief Returns m_batch_size mutants of the current best parameters */
+std::vector<std::vector<float> > EHCLSOptimiser::generateBatch()
+{
+    m_batch_parameters.assign(m_batch_size, m_best_parameters);      // so the mutants keep the limits of each parameter
+    std::vector<std::vector<float> > batch;
+    for (size_t i=0; i<m_batch_parameters.size(); i++)
+    {
+        mutateBestParameters(m_batch_parameters[i]);
+        batch.push_back(Parameter::getAsVector(m_batch_parameters[i]));
+    }
+    return batch;
+}
+
+/*! @brief Makes the mutant the current parameters, as getNextParameters() would have, before applying its fitness */
+void EHCLSOptimiser::applyBatchResult(unsigned int index, const std::vector<float>& fitness)
+{
+    m_previous_parameters = m_current_parameters;
+    m_current_parameters = m_batch_parameters[index];
+    Optimiser::applyBatchResult(index, fitness);
+}
+
 /*! @brief Gets a new set of parameters to test based on the current best parameters
  @param walkparameters will be updated to contain the new paramters that we want to test
  */
@@ -30,7 +30,7 @@
 class EHCLSOptimiser : public Optimiser
 {
 public:
-    EHCLSOptimiser(std::string name, std::vector<Parameter> parameters);
+    EHCLSOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed = 0);
     ~EHCLSOptimiser();
     
     std::vector<float> getNextParameters();
@@ -39,6 +39,12 @@ public:
     void summaryTo(std::ostream& stream);
 
     std::vector<Parameter> getBest() const { return m_real_best_parameters;}
+
+    void setBatchSize(unsigned int size);
+
+protected:
+    std::vector<std::vector<float> > generateBatch();
+    void applyBatchResult(unsigned int index, const std::vector<float>& fitness);
 private:
     void mutateBestParameters(std::vector<Parameter>& parameters);
     void mutateParameters(std::vector<Parameter>& base_parameters, std::vector<float>& basedelta_parameters, std::vector<Parameter>& parameters);
@@ -62,6 +68,9 @@ private:
     float m_neta;                                   //!< a parameter that controls the breadth of the search
     int m_reset_limit;	                            //!< a parameter that controls how quickly we give up searching along a line
     float m_reset_fraction;                         //!< a parameter that controls how much we reset
+
+    unsigned int m_batch_size;                                  //!< the number of mutants of the best parameters in each batch
+    std::vector<std::vector<Parameter> > m_batch_parameters;    //!< the mutants in the current batch
 };
 
 #endif
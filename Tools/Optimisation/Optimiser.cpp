@@ -24,23 +24,31 @@
 
 #include <boost/random.hpp>
 
+#include <fstream>
+#include <ctime>
+#include <unistd.h>
+
 #include "debug.h"
 #include "nubotdataconfig.h"
 
 /*! @brief Constructor for abstract optimiser
  	@param name the name of the optimiser. The name is used in debug logs, and is used for load/save filenames by default
  	@param parameters the initial seed for the optimisation
+ 	@param seed the seed for the optimiser's random numbers, so that a run can be repeated. If 0 the optimiser is seeded from the time and process
  */
-Optimiser::Optimiser(std::string name, std::vector<Parameter> parameters)
+Optimiser::Optimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed)
 {
     m_name = name;
     m_initial_parameters = parameters;
+    m_batch_applied = 0;
 
     #ifdef TARGET_IS_TRAINING
         m_microsec_starttime = boost::posix_time::microsec_clock::local_time();
     #endif
 
-    srand(static_cast<unsigned int> (1e6*getRealTime()*getRealTime()*getRealTime()));
+    if (seed == 0)      // I am hoping that at least one of these is different for each process
+        seed = static_cast<unsigned int>(time(0)) ^ (static_cast<unsigned int>(getpid()) << 16) ^ static_cast<unsigned int>(1e6*getRealTime()*getRealTime()*getRealTime());
+    m_random_generator.seed(seed);
 }
 
 /*! @brief Destructor for the abstract optimiser */
@@ -57,6 +65,71 @@ void Optimiser::setParametersResult(const std::vector<float>& fitness)
 		setParametersResult(fitness[0]);
 }
 
+/*! @brief Returns the next generation of candidates, all of which can be evaluated at once. Until every result of
+           the batch has been given to setBatchResult() the same batch is returned.
+    @return the candidates; the index of each is used to give its result
+ */
+const std::vector<std::vector<float> >& Optimiser::getNextBatch()
+{
+    if (m_batch_applied == m_batch.size())
+    {
+        m_batch = generateBatch();
+        m_batch_fitness = std::vector<std::vector<float> >(m_batch.size());
+        m_batch_received = std::vector<bool>(m_batch.size(), false);
+        m_batch_applied = 0;
+    }
+    return m_batch;
+}
+
+/*! @brief Gives the fitness of a candidate from the last batch. The results may be given in any order.
+    @param index the candidate's index in the batch
+    @param fitness the fitness of the candidate. The higher the fitness the better the parameters.
+ */
+void Optimiser::setBatchResult(unsigned int index, float fitness)
+{
+    setBatchResult(index, std::vector<float>(1, fitness));
+}
+
+/*! @brief Gives the fitnesses of a candidate from the last batch for a multi-objective optimiser. The results may be given in any order.
+    @param index the candidate's index in the batch
+    @param fitness a std::vector of fitnesses, one entry for each of the objectives
+ */
+void Optimiser::setBatchResult(unsigned int index, const std::vector<float>& fitness)
+{
+    if (index >= m_batch.size() or m_batch_received[index])
+    {
+        errorlog << "Optimiser::setBatchResult(). " << m_name << " has no outstanding candidate " << index << " in its batch of " << m_batch.size() << std::endl;
+        return;
+    }
+    m_batch_fitness[index] = fitness;
+    m_batch_received[index] = true;
+    while (m_batch_applied < m_batch.size() and m_batch_received[m_batch_applied])
+    {
+        applyBatchResult(m_batch_applied, m_batch_fitness[m_batch_applied]);
+        m_batch_applied++;
+    }
+}
+
+/*! @brief Returns the candidates that can be evaluated before the optimiser needs any of their results.
+           By default this is the single candidate from getNextParameters().
+ */
+std::vector<std::vector<float> > Optimiser::generateBatch()
+{
+    return std::vector<std::vector<float> >(1, getNextParameters());
+}
+
+/*! @brief Passes the result of a candidate in the batch on to the optimiser. It is called in the batch's order.
+    @param index the candidate's index in the batch
+    @param fitness the candidate's fitnesses
+ */
+void Optimiser::applyBatchResult(unsigned int index, const std::vector<float>& fitness)
+{
+    if (fitness.size() == 1)
+        setParametersResult(fitness[0]);
+    else
+        setParametersResult(fitness);
+}
+
 /*! @brief Returns the optimiser's name
     @return the optimiser's name
 */
@@ -146,10 +219,8 @@ void Optimiser::load()
  */
 float Optimiser::normalDistribution(float mean, float sigma)
 {
-    static unsigned int seed = 1e6*getRealTime()*getRealTime()*getRealTime();          // I am hoping that at least one of the three calls is different for each process
-    static boost::mt19937 generator(seed);                       // you need to seed it here with an unsigned int!
-    static boost::normal_distribution<float> distribution(0,1);
-    static boost::variate_generator<boost::mt19937, boost::normal_distribution<float> > standardnorm(generator, distribution);
+    boost::normal_distribution<float> distribution(0,1);
+    boost::variate_generator<boost::mt19937&, boost::normal_distribution<float> > standardnorm(m_random_generator, distribution);
     
     float z = standardnorm();       // take a random variable from the standard normal distribution
     float x = mean + z*sigma;       // then scale it to belong to the specified normal distribution
@@ -165,7 +236,15 @@ float Optimiser::normalDistribution(float mean, float sigma)
 float Optimiser::uniformDistribution(float min, float max)
 {
 	// We can't use boost's uniform distribution because it is buggy.
-	return (max - min)*rand()/RAND_MAX + min;
+	return (max - min)*(m_random_generator()/4294967295.0) + min;
+}
+
+/*! @brief Returns a random integer from 0 to n-1
+ *	@param n the number of possible values
+ */
+unsigned int Optimiser::uniformIndex(unsigned int n)
+{
+	return static_cast<unsigned int>((m_random_generator()/4294967296.0)*n);
 }
 
 double Optimiser::getRealTime()
@@ -3,6 +3,11 @@
  
     @class Optimiser
     @brief An abstract optimiser class
+
+    Candidates can be evaluated one at a time with getNextParameters() and setParametersResult(), or a
+    generation at a time with getNextBatch() and setBatchResult(). The results of a batch can be given in
+    any order, but they are passed on to the optimiser in the batch's order, so the search does not depend
+    on which evaluation finishes first. The two interfaces should not be mixed within a batch.
  
     @author Jason Kulk
  
@@ -31,6 +36,8 @@ class Parameter;
 #include <vector>
 #include <iostream>
 
+#include <boost/random/mersenne_twister.hpp>
+
 #ifdef TARGET_IS_TRAINING
     #include <boost/date_time/posix_time/posix_time.hpp>
 #else
@@ -42,12 +49,16 @@ class Parameter;
 class Optimiser
 {
 public:
-    Optimiser(std::string name, std::vector<Parameter> parameters);
-    ~Optimiser();
+    Optimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed = 0);
+    virtual ~Optimiser();
     
     virtual std::vector<float> getNextParameters() = 0;
     virtual void setParametersResult(float fitness) = 0;
     virtual void setParametersResult(const std::vector<float>& fitness);
+
+    const std::vector<std::vector<float> >& getNextBatch();
+    void setBatchResult(unsigned int index, float fitness);
+    void setBatchResult(unsigned int index, const std::vector<float>& fitness);
     
     std::string& getName();
     virtual void summaryTo(std::ostream& stream) = 0;
@@ -62,8 +73,12 @@ public:
     virtual std::vector<Parameter> getBest() const = 0;
 
 protected:
+    virtual std::vector<std::vector<float> > generateBatch();
+    virtual void applyBatchResult(unsigned int index, const std::vector<float>& fitness);
+
     float normalDistribution(float mean, float sigma);
     float uniformDistribution(float min, float max);
+    unsigned int uniformIndex(unsigned int n);
     double getRealTime();
     virtual void toStream(std::ostream& o) const = 0;
     virtual void fromStream(std::istream& i) = 0;
@@ -74,6 +89,13 @@ protected:
     #ifdef TARGET_IS_TRAINING
         boost::posix_time::ptime m_microsec_starttime;  //!< the program's start time according to boost::posix_time
     #endif
+
+private:
+    boost::mt19937 m_random_generator;                      //!< the source of every random number the optimiser uses, so a seeded optimiser repeats its search
+    std::vector<std::vector<float> > m_batch;               //!< the candidates handed out by getNextBatch()
+    std::vector<std::vector<float> > m_batch_fitness;       //!< the fitnesses received for m_batch
+    std::vector<bool> m_batch_received;                     //!< whether each candidate's fitness has been received
+    unsigned int m_batch_applied;                           //!< the number of results passed on to the optimiser, always a prefix of the batch
 };
 
 #endif
@@ -0,0 +1,239 @@
+/*! @file OptimiserBenchmark.cpp
+    @brief Runs the optimisers on the Rosenbrock and Rastrigin functions with an OptimiserPool, checks that the batch
+           interface repeats the serial one and that seeded runs are the same with any number of threads, and times
+           a batch of expensive evaluations on one and several threads.
+
+    Build and run from this directory with
+    @code
+        make OptimiserBenchmark && ./OptimiserBenchmark
+    @endcode
+    It returns non-zero if any check fails.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "OptimiserPool.h"
+#include "Optimiser.h"
+#include "PSOOptimiser.h"
+#include "PGAOptimiser.h"
+#include "PGRLOptimiser.h"
+#include "EHCLSOptimiser.h"
+#include "Parameter.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <time.h>
+#include <unistd.h>
+
+static const unsigned int Dimensions = 4;
+static const unsigned int Seed = 1234;
+
+//! The Rosenbrock function, with its minimum of 0 at (1,...,1), as a fitness in (0,1]
+class Rosenbrock : public FitnessFunction
+{
+public:
+    std::vector<float> evaluate(const std::vector<float>& x, unsigned int seed) const
+    {
+        double sum = 0;
+        for (size_t i=0; i+1<x.size(); i++)
+            sum += 100*(x[i+1] - x[i]*x[i])*(x[i+1] - x[i]*x[i]) + (1 - x[i])*(1 - x[i]);
+        return std::vector<float>(1, 1/(1 + sum));
+    }
+};
+
+//! The Rastrigin function, with its minimum of 0 at the origin, as a fitness in (0,1], and with noise from the seed as a simulated fitness would have
+class Rastrigin : public FitnessFunction
+{
+public:
+    std::vector<float> evaluate(const std::vector<float>& x, unsigned int seed) const
+    {
+        double sum = 10*x.size();
+        for (size_t i=0; i<x.size(); i++)
+            sum += x[i]*x[i] - 10*cos(2*M_PI*x[i]);
+        double noise = 0.01*(OptimiserPool::mixSeed(seed, 0)/4294967296.0 - 0.5);
+        return std::vector<float>(1, 1/(1 + sum) + noise);
+    }
+};
+
+//! A fitness function that takes about as long as a short simulation
+class Expensive : public FitnessFunction
+{
+public:
+    std::vector<float> evaluate(const std::vector<float>& x, unsigned int seed) const
+    {
+        volatile double sum = 0;
+        for (unsigned int i=0; i<2000000; i++)
+            sum += sin(i*x[0] + seed);
+        return std::vector<float>(1, 1/(2 + sum*1e-9));
+    }
+};
+
+static std::vector<Parameter> parameters(float min, float max)
+{
+    std::vector<Parameter> p;
+    for (unsigned int i=0; i<Dimensions; i++)
+    {
+        std::stringstream name;
+        name << "x" << i;
+        p.push_back(Parameter(name.str(), min + 0.3*(max - min), min, max));
+    }
+    return p;
+}
+
+static Optimiser* create(const std::string& type, float min, float max)
+{
+    if (type == "PSO")
+        return new PSOOptimiser("Benchmark" + type, parameters(min, max), Seed);
+    else if (type == "PGA")
+        return new PGAOptimiser("Benchmark" + type, parameters(min, max), Seed);
+    else if (type == "PGRL")
+        return new PGRLOptimiser("Benchmark" + type, parameters(min, max), Seed);
+    else
+        return new EHCLSOptimiser("Benchmark" + type, parameters(min, max), Seed);
+}
+
+static std::string state(const Optimiser* optimiser)
+{
+    std::stringstream stream;
+    stream << optimiser;
+    return stream.str();
+}
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+//! Evaluates num_evaluations candidates one at a time, with the seed a pool would have used for each
+static std::string runSerial(const std::string& type, const FitnessFunction& function, unsigned int num_evaluations, float min, float max)
+{
+    Optimiser* optimiser = create(type, min, max);
+    unsigned int batch = 0;
+    unsigned int index = 0;
+    unsigned int batch_size = optimiser->getNextBatch().size();     // only to find the size, so the serial run starts afresh
+    delete optimiser;
+
+    optimiser = create(type, min, max);
+    for (unsigned int i=0; i<num_evaluations; i++)
+    {
+        std::vector<float> candidate = optimiser->getNextParameters();
+        optimiser->setParametersResult(function.evaluate(candidate, OptimiserPool::mixSeed(OptimiserPool::mixSeed(Seed, batch), index))[0]);
+        if (++index == batch_size)
+        {
+            index = 0;
+            batch++;
+        }
+    }
+    std::string result = state(optimiser);
+    delete optimiser;
+    return result;
+}
+
+//! Evaluates num_batches batches, giving the results of each in reverse order
+static std::string runReversed(const std::string& type, const FitnessFunction& function, unsigned int num_batches, float min, float max)
+{
+    Optimiser* optimiser = create(type, min, max);
+    for (unsigned int b=0; b<num_batches; b++)
+    {
+        std::vector<std::vector<float> > batch = optimiser->getNextBatch();
+        for (int i=batch.size()-1; i>=0; i--)
+            optimiser->setBatchResult(i, function.evaluate(batch[i], OptimiserPool::mixSeed(OptimiserPool::mixSeed(Seed, b), i)));
+    }
+    std::string result = state(optimiser);
+    delete optimiser;
+    return result;
+}
+
+static std::string runPool(OptimiserPool& pool, const std::string& type, const FitnessFunction& function, unsigned int num_batches, float min, float max, float& best, unsigned int& evaluations)
+{
+    Optimiser* optimiser = create(type, min, max);
+    evaluations = pool.run(*optimiser, function, num_batches, Seed);
+    best = function.evaluate(Parameter::getAsVector(optimiser->getBest()), 0)[0];
+    std::string result = state(optimiser);
+    delete optimiser;
+    return result;
+}
+
+int main()
+{
+    // the optimisers load and save themselves in $HOME/nubot/Optimisation; this directory does not exist, so they start afresh every time
+    setenv("HOME", "/nonexistent/OptimiserBenchmark", 1);
+    // and they write their progress to debug, which is std::cout in this build
+    std::streambuf* report = std::cout.rdbuf(NULL);
+
+    bool ok = true;
+    const char* types[] = {"PSO", "PGA", "PGRL", "EHCLS"};
+    const unsigned int batches[] = {50, 150, 300, 120};
+    Rosenbrock rosenbrock;
+    Rastrigin rastrigin;
+    const FitnessFunction* functions[] = {&rosenbrock, &rastrigin};
+    const char* function_names[] = {"Rosenbrock", "Rastrigin"};
+    const float mins[] = {-2, -5.12};
+    const float maxs[] = {2, 5.12};
+
+    OptimiserPool one(1);
+    OptimiserPool several(4);
+    std::stringstream table;
+    table << std::setw(12) << "function" << std::setw(7) << "type" << std::setw(8) << "evals" << std::setw(12) << "best f(x)";
+    table << std::setw(8) << "serial" << std::setw(10) << "reversed" << std::setw(10) << "threads" << std::endl;
+    for (unsigned int f=0; f<2; f++)
+    {
+        for (unsigned int t=0; t<4; t++)
+        {
+            float best;
+            unsigned int evaluations;
+            std::string pooled = runPool(several, types[t], *functions[f], batches[t], mins[f], maxs[f], best, evaluations);
+            float best_one;
+            std::string single = runPool(one, types[t], *functions[f], batches[t], mins[f], maxs[f], best_one, evaluations);
+            std::string reversed = runReversed(types[t], *functions[f], batches[t], mins[f], maxs[f]);
+            bool same_threads = pooled == single;
+            bool same_reversed = pooled == reversed;
+            // the EHCLS batch is several mutants of one best, which is not the serial search
+            bool serial_applies = std::string(types[t]) != "EHCLS";
+            bool same_serial = not serial_applies or pooled == runSerial(types[t], *functions[f], evaluations, mins[f], maxs[f]);
+            ok = ok and same_threads and same_reversed and same_serial;
+
+            table << std::setw(12) << function_names[f] << std::setw(7) << types[t] << std::setw(8) << evaluations;
+            table << std::setw(12) << std::setprecision(4) << (1/best - 1);
+            table << std::setw(8) << (serial_applies ? (same_serial ? "same" : "DIFF") : "-");
+            table << std::setw(10) << (same_reversed ? "same" : "DIFF") << std::setw(10) << (same_threads ? "same" : "DIFF") << std::endl;
+        }
+    }
+
+    Expensive expensive;
+    double start = now();
+    float best;
+    unsigned int evaluations;
+    runPool(one, "PSO", expensive, 1, -1, 1, best, evaluations);
+    double one_time = now() - start;
+    start = now();
+    runPool(several, "PSO", expensive, 1, -1, 1, best, evaluations);
+    double several_time = now() - start;
+
+    std::cout.rdbuf(report);
+    std::cout.clear();
+    std::cout << table.str();
+    std::cout << std::endl << "One PSO batch of " << evaluations << " expensive evaluations on " << sysconf(_SC_NPROCESSORS_ONLN) << " processors: ";
+    std::cout << std::fixed << std::setprecision(3) << one_time << "s on 1 thread, " << several_time << "s on " << several.getNumThreads() << " threads" << std::endl;
+    std::cout << (ok ? "All checks passed" : "Checks FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,172 @@
+/*! @file OptimiserPool.cpp
+    @brief Implementation of a pool of threads that evaluates an optimiser's batches
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "OptimiserPool.h"
+#include "Optimiser.h"
+
+#include <unistd.h>
+#include <algorithm>
+
+#include "debug.h"
+
+/*! @brief Creates the pool and starts its threads
+    @param num_threads the number of threads, or 0 for one per processor
+ */
+OptimiserPool::OptimiserPool(unsigned int num_threads)
+{
+    if (num_threads == 0)
+        num_threads = std::max(1L, sysconf(_SC_NPROCESSORS_ONLN));
+
+    pthread_mutex_init(&m_mutex, NULL);
+    pthread_cond_init(&m_task_ready, NULL);
+    pthread_cond_init(&m_task_done, NULL);
+    m_stopping = false;
+    m_function = NULL;
+    m_seed = 0;
+    m_next_candidate = 0;
+
+    for (unsigned int i=0; i<num_threads; i++)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, runThread, this) == 0)
+            m_threads.push_back(thread);
+        else
+            errorlog << "OptimiserPool::OptimiserPool(). Failed to create thread " << i << std::endl;
+    }
+}
+
+/*! @brief Waits for the threads to finish their current candidate and exit */
+OptimiserPool::~OptimiserPool()
+{
+    pthread_mutex_lock(&m_mutex);
+    m_stopping = true;
+    pthread_cond_broadcast(&m_task_ready);
+    pthread_mutex_unlock(&m_mutex);
+
+    for (unsigned int i=0; i<m_threads.size(); i++)
+        pthread_join(m_threads[i], NULL);
+
+    pthread_cond_destroy(&m_task_done);
+    pthread_cond_destroy(&m_task_ready);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/*! @brief Evaluates the optimiser's next batch, giving each result to the optimiser as it is finished
+    @param optimiser the optimiser
+    @param function the fitness function, which is evaluated on the pool's threads
+    @param seed the seed for the batch. Candidate i is evaluated with the seed mixSeed(seed, i)
+    @return the number of candidates evaluated
+ */
+unsigned int OptimiserPool::evaluateBatch(Optimiser& optimiser, const FitnessFunction& function, unsigned int seed)
+{
+    const std::vector<std::vector<float> >& batch = optimiser.getNextBatch();
+    unsigned int size = batch.size();
+
+    pthread_mutex_lock(&m_mutex);
+    m_function = &function;
+    m_candidates = batch;
+    m_seed = seed;
+    m_results.assign(size, std::vector<float>());
+    m_finished.clear();
+    m_next_candidate = 0;
+    if (m_threads.empty())
+    {   // without any threads the candidates are evaluated here
+        for (unsigned int i=0; i<size; i++)
+        {
+            m_results[i] = function.evaluate(m_candidates[i], mixSeed(seed, i));
+            m_finished.push_back(i);
+        }
+        m_next_candidate = size;
+    }
+    pthread_cond_broadcast(&m_task_ready);
+
+    for (unsigned int given=0; given<size; given++)
+    {
+        while (m_finished.empty())
+            pthread_cond_wait(&m_task_done, &m_mutex);
+        unsigned int index = m_finished.front();
+        m_finished.pop_front();
+        pthread_mutex_unlock(&m_mutex);
+
+        optimiser.setBatchResult(index, m_results[index]);
+
+        pthread_mutex_lock(&m_mutex);
+    }
+    m_function = NULL;
+    pthread_mutex_unlock(&m_mutex);
+    return size;
+}
+
+/*! @brief Evaluates num_batches of the optimiser's batches, one after the other
+    @param optimiser the optimiser
+    @param function the fitness function, which is evaluated on the pool's threads
+    @param num_batches the number of batches
+    @param seed the seed for the run. Batch b is evaluated with the seed mixSeed(seed, b)
+    @return the number of candidates evaluated
+ */
+unsigned int OptimiserPool::run(Optimiser& optimiser, const FitnessFunction& function, unsigned int num_batches, unsigned int seed)
+{
+    unsigned int evaluations = 0;
+    for (unsigned int b=0; b<num_batches; b++)
+        evaluations += evaluateBatch(optimiser, function, mixSeed(seed, b));
+    return evaluations;
+}
+
+/*! @brief Returns a seed for the index'th part of something seeded with seed. Nearby seeds and indices give unrelated results */
+unsigned int OptimiserPool::mixSeed(unsigned int seed, unsigned int index)
+{
+    unsigned int h = seed*0x9E3779B1u ^ (index + 0x7F4A7C15u);
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+void* OptimiserPool::runThread(void* arg)
+{
+    static_cast<OptimiserPool*>(arg)->run();
+    return NULL;
+}
+
+/*! @brief A thread's main loop. It takes the next candidate of the batch, and evaluates it without holding the lock */
+void OptimiserPool::run()
+{
+    pthread_mutex_lock(&m_mutex);
+    while (true)
+    {
+        while (not m_stopping and m_next_candidate >= m_candidates.size())
+            pthread_cond_wait(&m_task_ready, &m_mutex);
+        if (m_stopping)
+            break;
+
+        unsigned int index = m_next_candidate++;
+        const FitnessFunction* function = m_function;
+        const std::vector<float>& candidate = m_candidates[index];
+        unsigned int seed = mixSeed(m_seed, index);
+        pthread_mutex_unlock(&m_mutex);
+
+        std::vector<float> fitness = function->evaluate(candidate, seed);
+
+        pthread_mutex_lock(&m_mutex);
+        m_results[index].swap(fitness);
+        m_finished.push_back(index);
+        pthread_cond_signal(&m_task_done);
+    }
+    pthread_mutex_unlock(&m_mutex);
+}
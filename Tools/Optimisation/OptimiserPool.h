@@ -0,0 +1,86 @@
+/*! @file OptimiserPool.h
+    @brief Declaration of a pool of threads that evaluates an optimiser's batches
+
+    @class FitnessFunction
+    @brief The interface of a fitness function evaluated by an OptimiserPool
+
+    @class OptimiserPool
+    @brief Evaluates each batch of an Optimiser's candidates on several threads
+
+    The candidates of a batch are taken by the threads one at a time, and each result is given to the
+    optimiser as soon as it is finished. Each candidate is evaluated with a seed made from the batch's seed
+    and the candidate's index, and the optimiser applies the results in the batch's order, so a run with
+    a seeded optimiser gives the same result whatever the number of threads.
+
+    The pool must only be used from one thread, which is the only thread to touch the optimiser.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPTIMISER_POOL_H
+#define OPTIMISER_POOL_H
+
+#include <vector>
+#include <deque>
+
+#include <pthread.h>
+
+class Optimiser;
+
+class FitnessFunction
+{
+public:
+    virtual ~FitnessFunction() {}
+
+    /*! @brief Returns the fitnesses of a candidate, one for each objective. The higher the fitness the better the parameters.
+        It is called from several threads at once, so it must not change shared state, and any randomness must come from seed.
+        @param parameters the candidate
+        @param seed the seed for the evaluation's random numbers
+     */
+    virtual std::vector<float> evaluate(const std::vector<float>& parameters, unsigned int seed) const = 0;
+};
+
+class OptimiserPool
+{
+public:
+    explicit OptimiserPool(unsigned int num_threads = 0);
+    ~OptimiserPool();
+
+    unsigned int getNumThreads() const {return m_threads.size();}
+
+    unsigned int evaluateBatch(Optimiser& optimiser, const FitnessFunction& function, unsigned int seed);
+    unsigned int run(Optimiser& optimiser, const FitnessFunction& function, unsigned int num_batches, unsigned int seed);
+
+    static unsigned int mixSeed(unsigned int seed, unsigned int index);
+
+private:
+    static void* runThread(void* arg);
+    void run();
+
+    std::vector<pthread_t> m_threads;
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_task_ready;                    //!< signalled when a batch is started, or the pool is stopping
+    pthread_cond_t m_task_done;                     //!< signalled when a candidate is finished
+    bool m_stopping;
+
+    //! the current batch, which is only changed while no candidates are being evaluated
+    const FitnessFunction* m_function;
+    std::vector<std::vector<float> > m_candidates;
+    unsigned int m_seed;
+    unsigned int m_next_candidate;                  //!< the next candidate to be taken by a thread
+    std::vector<std::vector<float> > m_results;     //!< the fitnesses of each candidate
+    std::deque<unsigned int> m_finished;            //!< the candidates finished, but not yet given to the optimiser
+};
+
+#endif
@@ -35,8 +35,9 @@ using namespace boost::accumulators;
 /*! @brief Constructor for abstract optimiser
  	@param name the name of the optimiser. The name is used in debug logs, and is used for load/save filenames by default
  	@param parameters the initial seed for the optimisation
+ 	@param seed the seed for the random numbers, or 0 to seed from the time
  */
-PGAOptimiser::PGAOptimiser(std::string name, std::vector<Parameter> parameters) : Optimiser(name, parameters)
+PGAOptimiser::PGAOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed) : Optimiser(name, parameters, seed)
 {
     m_step_size = 0.01;        	   // Tune this
     m_epsilon = 0.01;              // Tune this
@@ -100,6 +101,12 @@ std::vector<float> PGAOptimiser::getNextParameters()
     return m_random_policies[m_random_policies_index];
 }
 
+/*! @brief Returns the policies that have not been evaluated in this estimate of the gradient */
+std::vector<std::vector<float> > PGAOptimiser::generateBatch()
+{
+    return std::vector<std::vector<float> >(m_random_policies.begin() + m_random_policies_index, m_random_policies.end());
+}
+
 /*! @brief Generates a set of policies from the seed to estimate the gradient
  */
 void PGAOptimiser::generatePolicies()
@@ -127,7 +134,7 @@ std::vector<float> PGAOptimiser::calculateStep()
     //calculate probability contributions
     for (int j=0; j<m_random_policies.size(); j++)\
         deltas[j] = exp( -10.f*(m_fitnesses[j]-minfit)/(maxfit-minfit+0.00000001) );
-    float delta_sum;
+    float delta_sum = 0;
     for (int j=0; j<m_random_policies.size(); j++)
         delta_sum += deltas[j];
     for (int j=0; j<m_random_policies.size(); j++)
@@ -185,7 +192,7 @@ std::vector<float> PGAOptimiser::generateRandomPolicy(const std::vector<Paramete
  */
 int PGAOptimiser::getRandomDirection()
 {
-    return rand()%3 - 1;
+    return static_cast<int>(uniformIndex(3)) - 1;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------------------------------- Shuffled Policies
@@ -247,7 +254,8 @@ std::vector<float> PGAOptimiser::generateSigns()
 		signs[3*i+1] = 0;
 		signs[3*i+2] = -1;
 	}
-	random_shuffle(signs.begin(), signs.end());
+	for (size_t i=size; i>1; i--)
+		std::swap(signs[i-1], signs[uniformIndex(i)]);
 	return signs;
 }
 
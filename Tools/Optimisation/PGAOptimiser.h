@@ -35,7 +35,7 @@
 class PGAOptimiser : public Optimiser
 {
 public:
-    PGAOptimiser(std::string name, std::vector<Parameter> parameters);
+    PGAOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed = 0);
     ~PGAOptimiser();
     
     std::vector<float> getNextParameters();
@@ -46,6 +46,9 @@ public:
 
     std::vector<Parameter> getBest() const { return m_current_parameters;}
 
+protected:
+    std::vector<std::vector<float> > generateBatch();
+
 private:
     void generatePolicies();
     std::vector<float> calculateStep();
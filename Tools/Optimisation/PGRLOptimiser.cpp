@@ -35,8 +35,9 @@ using namespace boost::accumulators;
 /*! @brief Constructor for abstract optimiser
  	@param name the name of the optimiser. The name is used in debug logs, and is used for load/save filenames by default
  	@param parameters the initial seed for the optimisation
+ 	@param seed the seed for the random numbers, or 0 to seed from the time
  */
-PGRLOptimiser::PGRLOptimiser(std::string name, std::vector<Parameter> parameters) : Optimiser(name, parameters)
+PGRLOptimiser::PGRLOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed) : Optimiser(name, parameters, seed)
 {
     m_step_size = 0.01;        	   // Tune this
     m_epsilon = 0.03;              // Tune this
@@ -100,6 +101,12 @@ std::vector<float> PGRLOptimiser::getNextParameters()
     return m_random_policies[m_random_policies_index];
 }
 
+/*! @brief Returns the policies that have not been evaluated in this estimate of the gradient */
+std::vector<std::vector<float> > PGRLOptimiser::generateBatch()
+{
+    return std::vector<std::vector<float> >(m_random_policies.begin() + m_random_policies_index, m_random_policies.end());
+}
+
 /*! @brief Generates a set of policies from the seed to estimate the gradient
  */
 void PGRLOptimiser::generatePolicies()
@@ -195,7 +202,7 @@ std::vector<float> PGRLOptimiser::generateRandomPolicy(const std::vector<Paramet
  */
 int PGRLOptimiser::getRandomDirection()
 {
-    return rand()%3 - 1;
+    return static_cast<int>(uniformIndex(3)) - 1;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------------------------------- Shuffled Policies
@@ -251,7 +258,8 @@ std::vector<float> PGRLOptimiser::generateSigns()
 		signs[3*i+1] = 0;
 		signs[3*i+2] = -1;
 	}
-	random_shuffle(signs.begin(), signs.end());
+	for (size_t i=size; i>1; i--)
+		std::swap(signs[i-1], signs[uniformIndex(i)]);
 	return signs;
 }
 
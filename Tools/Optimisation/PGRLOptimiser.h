@@ -35,7 +35,7 @@
 class PGRLOptimiser : public Optimiser
 {
 public:
-    PGRLOptimiser(std::string name, std::vector<Parameter> parameters);
+    PGRLOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed = 0);
     ~PGRLOptimiser();
     
     std::vector<float> getNextParameters();
@@ -45,6 +45,9 @@ public:
     void summaryTo(std::ostream& stream);
 
     std::vector<Parameter> getBest() const { return m_current_parameters;}
+protected:
+    std::vector<std::vector<float> > generateBatch();
+
 private:
     void generatePolicies();
     std::vector<float> calculateStep();
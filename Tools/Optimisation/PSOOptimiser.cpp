@@ -34,8 +34,9 @@
 /*! @brief Constructor for abstract optimiser
  	@param name the name of the optimiser. The name is used in debug logs, and is used for load/save filenames by default
  	@param parameters the initial seed for the optimisation
+ 	@param seed the seed for the random numbers, or 0 to seed from the time
  */
-PSOOptimiser::PSOOptimiser(std::string name, std::vector<Parameter> parameters) : Optimiser(name, parameters)
+PSOOptimiser::PSOOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed) : Optimiser(name, parameters, seed)
 {
     //doesn't do anything
     m_inertia = 0.60;       // tune this: this must be less than 1, and can be used to control how long it takes for the algorithm to converge (0.7 converges after about 2000)
@@ -51,8 +52,6 @@ PSOOptimiser::PSOOptimiser(std::string name, std::vector<Parameter> parameters)
 
     m_num_dimensions = parameters.size();
 
-    srand(static_cast<unsigned int> (1e6*getRealTime()*getRealTime()*getRealTime()));
-
     load();
     if (m_swarm_position.empty())
     	initSwarm();
@@ -105,6 +104,15 @@ std::vector<float> PSOOptimiser::getNextParameters()
     return Parameter::getAsVector(m_swarm_position[m_swarm_fitness.size()]);
 }
 
+/*! @brief Returns the particles that have not been evaluated in this iteration of the swarm */
+std::vector<std::vector<float> > PSOOptimiser::generateBatch()
+{
+    std::vector<std::vector<float> > batch;
+    for (size_t i=m_swarm_fitness.size(); i<m_swarm_position.size(); i++)
+        batch.push_back(Parameter::getAsVector(m_swarm_position[i]));
+    return batch;
+}
+
 void PSOOptimiser::updateSwarm()
 {
     debug << "Fitnesses: " << m_swarm_fitness << std::endl;
@@ -36,7 +36,7 @@
 class PSOOptimiser : public Optimiser
 {
 public:
-    PSOOptimiser(std::string name, std::vector<Parameter> parameters);
+    PSOOptimiser(std::string name, std::vector<Parameter> parameters, unsigned int seed = 0);
     ~PSOOptimiser();
     
     std::vector<float> getNextParameters();
@@ -46,6 +46,9 @@ public:
 
     std::vector<Parameter> getBest() const { return m_best;}
 
+protected:
+    std::vector<std::vector<float> > generateBatch();
+
 private:
     void initSwarm();
     void updateSwarm();
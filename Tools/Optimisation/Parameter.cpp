@@ -27,6 +27,7 @@
 #include "debug.h"
 
 #include "Tools/Math/StlVector.h"
+#include "Infrastructure/Jobs/JobCodec.h"
 
 /*! @brief Default constructor for a parameter. Everything is initialised to 0/blank */
 Parameter::Parameter() 
@@ -447,3 +448,26 @@ std::istream& operator>> (std::istream& input, std::vector<Parameter>& p)
 	return input;
 }
 
+/*! @brief Writes the parameter into a buffer for the binary job format
+    @param output the writer to put the parameter in
+ */
+void Parameter::toBuffer(JobWriter& output) const
+{
+    output.putString(Name);
+    output.putFloat(Value);
+    output.putFloat(Min);
+    output.putFloat(Max);
+    output.putString(Description);
+}
+
+/*! @brief Reads a parameter written by toBuffer. The strings' storage is reused, so this only allocates if they grow.
+    @param input the reader from which to take the parameter
+ */
+void Parameter::fromBuffer(JobReader& input)
+{
+    input.getString(Name);
+    Value = input.getFloat();
+    Min = input.getFloat();
+    Max = input.getFloat();
+    input.getString(Description);
+}
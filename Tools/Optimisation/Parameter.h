@@ -30,6 +30,9 @@
 #include <iostream>
 #include "Tools/Math/StlVector.h"
 
+class JobWriter;
+class JobReader;
+
 class Parameter 
 {
 public:
@@ -81,6 +84,10 @@ public:
     
     friend std::istream& operator>> (std::istream& input, Parameter& p);
     friend std::istream& operator>> (std::istream& input, std::vector<Parameter>& p);
+    
+    // binary job format
+    void toBuffer(JobWriter& output) const;
+    void fromBuffer(JobReader& input);
 
 private:
     std::string Name;
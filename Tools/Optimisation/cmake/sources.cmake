@@ -26,6 +26,7 @@ SET (YOUR_SRCS Optimiser.h  Optimiser.cpp
                PGRLOptimiser.h PGRLOptimiser.cpp	
                PSOOptimiser.h PSOOptimiser.cpp
                Parameter.h  Parameter.cpp
+               OptimiserPool.h OptimiserPool.cpp
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
@@ -0,0 +1,331 @@
+/*! @file TraceCollector.cpp
+    @brief Implementation of TraceCollector class
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TraceCollector.h"
+#include "TraceRegistry.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <algorithm>
+
+/*! @brief Returns a string with the characters that JSON does not allow in strings escaped */
+static std::string jsonEscape(const char* text)
+{
+    std::string escaped;
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' or *text == '\\')
+            escaped += '\\';
+        if (static_cast<unsigned char>(*text) >= 0x20)
+            escaped += *text;
+    }
+    return escaped;
+}
+
+/*! @brief Returns the CLOCK_MONOTONIC time in ns */
+static double monotonicTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec*1e9 + time.tv_nsec;
+}
+
+/*! @brief Creates a collector, which does not write a trace until setTrace() is called.
+
+    When the tracer uses the TSC the length of a tick is measured over the first 10ms, and then refined on every collect.
+ */
+TraceCollector::TraceCollector()
+{
+    m_start_ticks = Tracer::now();
+    m_start_time = monotonicTime();
+    m_ns_per_tick = 1;
+    #ifndef TRACER_USE_CLOCK
+        struct timespec wait = {0, 10000000};
+        nanosleep(&wait, NULL);
+        calibrate();
+    #endif
+
+    m_trace = NULL;
+    m_trace_bytes = 0;
+    m_trace_max_bytes = 0;
+    m_trace_full = false;
+    m_trace_empty = true;
+    m_num_collected = 0;
+    m_num_dropped = 0;
+}
+
+TraceCollector::~TraceCollector()
+{
+}
+
+/*! @brief Sets where the trace is written, and starts the JSON array
+    @param trace the stream to write to, which must remain valid until finishTrace() or the collector is destroyed
+    @param max_bytes the size after which no more spans are written (they are still added to the histograms)
+ */
+void TraceCollector::setTrace(std::ostream* trace, unsigned long long max_bytes)
+{
+    m_trace = trace;
+    m_trace_bytes = 0;
+    m_trace_max_bytes = max_bytes;
+    m_trace_full = false;
+    m_trace_empty = true;
+    m_thread_names.clear();
+    if (m_trace != NULL)
+        m_trace->write("[", 1);
+}
+
+/*! @brief Closes the JSON array and stops writing the trace */
+void TraceCollector::finishTrace()
+{
+    if (m_trace == NULL)
+        return;
+    m_trace->write("\n]\n", 3);
+    m_trace->flush();
+    m_trace = NULL;
+}
+
+/*! @brief Takes every span from the rings, adding each to its histogram and to the trace.
+
+    The registry is only locked while the spans are copied out, so threads being created
+    do not wait for the trace to be written.
+ */
+void TraceCollector::collect()
+{
+    calibrate();
+    m_collected.clear();
+    std::vector<std::pair<unsigned int, std::string> > renamed;
+
+    TraceRegistry& registry = TraceRegistry::get();
+    pthread_mutex_lock(&registry.mutex);
+    for (size_t i = 0; i < registry.buffers.size(); i++)
+    {
+        TraceBuffer* buffer = registry.buffers[i];
+        unsigned int head = buffer->m_head.load(std::memory_order_acquire);
+        unsigned int tail = buffer->m_tail.load(std::memory_order_relaxed);
+        if (head == tail and buffer->m_retired.load(std::memory_order_relaxed))
+            continue;
+
+        std::map<unsigned int, std::string>::iterator name = m_thread_names.find(buffer->m_id);
+        if (name == m_thread_names.end() or name->second != buffer->m_name)
+            renamed.push_back(std::make_pair(buffer->m_id, std::string(buffer->m_name)));
+
+        for (; tail != head; tail++)
+        {
+            Collected collected;
+            collected.event = buffer->m_events[tail % TraceBuffer::Capacity];
+            collected.thread = buffer->m_id;
+            m_collected.push_back(collected);
+        }
+        buffer->m_tail.store(tail, std::memory_order_release);
+
+        unsigned int dropped = buffer->m_dropped.load(std::memory_order_relaxed);
+        unsigned int& previous = m_thread_dropped[buffer->m_id];
+        m_num_dropped += dropped - previous;
+        previous = dropped;
+    }
+    unsigned int num_spans = registry.num_spans.load(std::memory_order_acquire);
+    pthread_mutex_unlock(&registry.mutex);
+
+    for (size_t i = 0; i < renamed.size(); i++)
+    {
+        m_thread_names[renamed[i].first] = renamed[i].second;
+        writeThreadName(renamed[i].first, renamed[i].second);
+    }
+
+    if (m_histograms.size() < num_spans)
+        m_histograms.resize(num_spans);
+    for (unsigned int i = m_span_names.size(); i < num_spans; i++)
+        m_span_names.push_back(jsonEscape(Tracer::getSpanName(i)));
+    for (size_t i = 0; i < m_collected.size(); i++)
+    {
+        const TraceEvent& event = m_collected[i].event;
+        unsigned long long duration = 0;
+        if (event.end > event.begin)
+            duration = static_cast<unsigned long long>((event.end - event.begin)*m_ns_per_tick + 0.5);
+        m_histograms[event.span].add(duration);
+        writeEvent(m_collected[i], duration);
+    }
+    m_num_collected += m_collected.size();
+    if (m_trace != NULL)
+        m_trace->flush();
+}
+
+/*! @brief Writes a table of each span's count, mean and percentiles in microseconds, followed by the non-empty buckets of each histogram */
+void TraceCollector::writeHistograms(std::ostream& output) const
+{
+    output << "spans: " << m_num_collected << " dropped: " << m_num_dropped << std::endl;
+    output << std::left << std::setw(32) << "span" << std::right;
+    output << std::setw(10) << "count" << std::setw(12) << "mean" << std::setw(12) << "min" << std::setw(12) << "p50";
+    output << std::setw(12) << "p90" << std::setw(12) << "p99" << std::setw(12) << "max" << std::endl;
+    output << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < m_histograms.size(); i++)
+    {
+        const Histogram& histogram = m_histograms[i];
+        if (histogram.count == 0)
+            continue;
+        output << std::left << std::setw(32) << Tracer::getSpanName(i) << std::right;
+        output << std::setw(10) << histogram.count;
+        output << std::setw(12) << 1e-3*histogram.total/histogram.count;
+        output << std::setw(12) << 1e-3*histogram.min;
+        output << std::setw(12) << 1e-3*histogram.percentile(0.5);
+        output << std::setw(12) << 1e-3*histogram.percentile(0.9);
+        output << std::setw(12) << 1e-3*histogram.percentile(0.99);
+        output << std::setw(12) << 1e-3*histogram.max << std::endl;
+    }
+
+    for (size_t i = 0; i < m_histograms.size(); i++)
+    {
+        const Histogram& histogram = m_histograms[i];
+        if (histogram.count == 0)
+            continue;
+        output << std::endl << Tracer::getSpanName(i) << " (us)" << std::endl;
+        for (unsigned int b = 0; b < Histogram::NumBuckets; b++)
+        {
+            if (histogram.buckets[b] == 0)
+                continue;
+            output << "    [" << std::setw(12) << 1e-3*Histogram::bucketStart(b) << ", " << std::setw(12) << 1e-3*Histogram::bucketStart(b + 1) << ")";
+            output << std::setw(10) << histogram.buckets[b] << std::endl;
+        }
+    }
+    output.unsetf(std::ios::floatfield);
+    output << std::setprecision(6);
+}
+
+/*! @brief Empties the histograms and the counts */
+void TraceCollector::resetHistograms()
+{
+    m_histograms.assign(m_histograms.size(), Histogram());
+    m_num_collected = 0;
+    m_num_dropped = 0;
+}
+
+/*! @brief Refines the length of a tick using the time since the collector was created. Does nothing when the ticks are already ns */
+void TraceCollector::calibrate()
+{
+    #ifndef TRACER_USE_CLOCK
+        unsigned long long ticks = Tracer::now();
+        double time = monotonicTime();
+        if (ticks > m_start_ticks)
+            m_ns_per_tick = (time - m_start_time)/(ticks - m_start_ticks);
+    #endif
+}
+
+/*! @brief Converts ticks to ns since the collector was created */
+double TraceCollector::toNanoseconds(unsigned long long ticks) const
+{
+    return static_cast<double>(static_cast<long long>(ticks - m_start_ticks))*m_ns_per_tick;
+}
+
+/*! @brief Writes a span to the trace as a complete event, with its times in microseconds */
+void TraceCollector::writeEvent(const Collected& collected, unsigned long long duration)
+{
+    if (m_trace == NULL or m_trace_full)
+        return;
+    char record[256];
+    int length = snprintf(record, sizeof(record), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                          m_span_names[collected.event.span].c_str(), collected.thread, 1e-3*toNanoseconds(collected.event.begin), 1e-3*duration);
+    writeRecord(record, length);
+}
+
+/*! @brief Writes a metadata event naming a thread */
+void TraceCollector::writeThreadName(unsigned int thread, const std::string& name)
+{
+    if (m_trace == NULL or m_trace_full)
+        return;
+    char record[128];
+    int length = snprintf(record, sizeof(record), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", thread, jsonEscape(name.c_str()).c_str());
+    writeRecord(record, length);
+}
+
+/*! @brief Writes a record on a new line, separated from the previous one by a comma */
+void TraceCollector::writeRecord(const char* record, int length)
+{
+    if (length < 0)
+        return;
+    length = std::min<int>(length, strlen(record));
+    if (not m_trace_empty)
+        m_trace->write(",", 1);
+    m_trace->write("\n", 1);
+    m_trace->write(record, length);
+    m_trace_empty = false;
+    m_trace_bytes += length + 2;
+    if (m_trace_max_bytes > 0 and m_trace_bytes >= m_trace_max_bytes)
+        m_trace_full = true;
+}
+
+TraceCollector::Histogram::Histogram()
+{
+    count = 0;
+    total = 0;
+    min = 0;
+    max = 0;
+    memset(buckets, 0, sizeof(buckets));
+}
+
+/*! @brief Adds a duration in ns */
+void TraceCollector::Histogram::add(unsigned long long duration)
+{
+    if (count == 0 or duration < min)
+        min = duration;
+    if (duration > max)
+        max = duration;
+    count++;
+    total += duration;
+    buckets[bucket(duration)]++;
+}
+
+/*! @brief Returns the duration in ns below which the given fraction of the durations lie, interpolating within the bucket */
+double TraceCollector::Histogram::percentile(double fraction) const
+{
+    if (count == 0)
+        return 0;
+    double rank = fraction*count;
+    unsigned long long seen = 0;
+    for (unsigned int b = 0; b < NumBuckets; b++)
+    {
+        if (seen + buckets[b] >= rank and buckets[b] > 0)
+        {
+            double start = std::max<double>(bucketStart(b), min);
+            double end = std::min<double>(bucketStart(b + 1), max);
+            return start + (end - start)*(rank - seen)/buckets[b];
+        }
+        seen += buckets[b];
+    }
+    return max;
+}
+
+/*! @brief Returns the bucket for a duration. Durations under 4ns have a bucket each, after that each power of two is split into four */
+unsigned int TraceCollector::Histogram::bucket(unsigned long long duration)
+{
+    if (duration < 4)
+        return duration;
+    unsigned int octave = 63 - __builtin_clzll(duration);
+    unsigned int quarter = (duration >> (octave - 2)) & 3;
+    return 4*(octave - 1) + quarter;
+}
+
+/*! @brief Returns the shortest duration in a bucket */
+unsigned long long TraceCollector::Histogram::bucketStart(unsigned int bucket)
+{
+    if (bucket < 4)
+        return bucket;
+    if (bucket >= 252)
+        return ~0ULL;                   // the last power of two that fits in 64 bits ends at bucket 251
+    unsigned int octave = bucket/4 + 1;
+    return static_cast<unsigned long long>(4 + bucket%4) << (octave - 2);
+}
@@ -0,0 +1,109 @@
+/*! @file TraceCollector.h
+    @brief Declaration of TraceCollector class
+
+    @class TraceCollector
+    @brief Empties the Tracer's rings, writing the spans as a Chrome trace and keeping a histogram for each span
+
+    The trace is written in the Chrome trace event JSON array format, which both chrome://tracing and
+    ui.perfetto.dev load. Each span is a complete ("X") event, and each thread is named with a metadata
+    event. The closing bracket is written by finishTrace(), but both viewers also load a trace that was
+    cut off part way through (eg. by the robot being switched off).
+
+    The histograms have four buckets per power of two of nanoseconds, so the percentiles written by
+    writeHistograms() are interpolated within a bucket a quarter of an octave wide.
+
+    Only one collector should be collecting at a time, because each span is given to whichever collects it first.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TRACECOLLECTOR_H
+#define TRACECOLLECTOR_H
+
+#include "Tracer.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+class TraceCollector
+{
+public:
+    TraceCollector();
+    ~TraceCollector();
+
+    void setTrace(std::ostream* trace, unsigned long long max_bytes);
+    void finishTrace();
+
+    void collect();
+
+    void writeHistograms(std::ostream& output) const;
+    void resetHistograms();
+
+    unsigned long long getNumCollected() const {return m_num_collected;}
+    unsigned long long getNumDropped() const {return m_num_dropped;}
+    bool isTraceFull() const {return m_trace_full;}
+
+private:
+    //! The distribution of one span's durations
+    struct Histogram
+    {
+        static const unsigned int NumBuckets = 256;
+        Histogram();
+        void add(unsigned long long duration);
+        double percentile(double fraction) const;
+        static unsigned int bucket(unsigned long long duration);
+        static unsigned long long bucketStart(unsigned int bucket);
+
+        unsigned long long count;
+        unsigned long long total;           //!< the sum of the durations in ns
+        unsigned long long min;
+        unsigned long long max;
+        unsigned int buckets[NumBuckets];   //!< the number of durations in each bucket
+    };
+
+    //! A collected span and the thread that recorded it
+    struct Collected
+    {
+        TraceEvent event;
+        unsigned int thread;
+    };
+
+    void calibrate();
+    double toNanoseconds(unsigned long long ticks) const;
+    void writeEvent(const Collected& collected, unsigned long long duration);
+    void writeThreadName(unsigned int thread, const std::string& name);
+    void writeRecord(const char* record, int length);
+
+    unsigned long long m_start_ticks;           //!< the Tracer::now() ticks when the collector was created
+    double m_start_time;                        //!< the CLOCK_MONOTONIC time in ns when the collector was created
+    double m_ns_per_tick;                       //!< the length of a tick, measured against CLOCK_MONOTONIC
+
+    std::ostream* m_trace;                      //!< where the trace is written, or NULL if it isn't
+    unsigned long long m_trace_bytes;           //!< the number of bytes written to the trace
+    unsigned long long m_trace_max_bytes;       //!< the trace stops growing once it reaches this size
+    bool m_trace_full;
+    bool m_trace_empty;                         //!< true until the first record is written, which isn't preceded by a comma
+
+    std::vector<Collected> m_collected;         //!< the spans taken from the rings, kept to reuse their storage
+    std::map<unsigned int, std::string> m_thread_names;     //!< the name written to the trace for each thread
+    std::map<unsigned int, unsigned int> m_thread_dropped;  //!< the number of spans each thread had dropped at the last collect
+    std::vector<Histogram> m_histograms;        //!< indexed by span id
+    std::vector<std::string> m_span_names;      //!< the span names escaped for the trace, indexed by span id
+    unsigned long long m_num_collected;
+    unsigned long long m_num_dropped;
+};
+
+#endif
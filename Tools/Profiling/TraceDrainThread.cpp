@@ -0,0 +1,118 @@
+/*! @file TraceDrainThread.cpp
+    @brief Implementation of the low priority thread that empties the Tracer's rings
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TraceDrainThread.h"
+
+#include "debug.h"
+#include "debugverbositythreading.h"
+
+#include <sched.h>
+#include <time.h>
+#include <errno.h>
+
+/*! @brief Creates and starts the drain thread. The thread is not real-time, so it only uses the time left over by the real-time threads.
+    @param trace_name the file the Chrome trace is written to
+    @param histogram_name the file the histograms are written to
+    @param period the time in ms between collections. It must be short enough that no ring fills in that time
+    @param max_trace_bytes the size at which the trace stops growing. The histograms are kept for the whole run
+ */
+TraceDrainThread::TraceDrainThread(const std::string& trace_name, const std::string& histogram_name, int period, unsigned long long max_trace_bytes) :
+    Thread(std::string("TraceDrainThread"), 0), m_histogram_name(histogram_name), m_period(period), m_stopping(false)
+{
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "TraceDrainThread::TraceDrainThread(" << trace_name << ", " << histogram_name << ", " << period << ")" << std::endl;
+    #endif
+    pthread_mutex_init(&m_mutex, NULL);
+    pthread_cond_init(&m_stop, NULL);
+
+    m_trace.open(trace_name.c_str(), std::ios_base::trunc);
+    if (m_trace.is_open())
+        m_collector.setTrace(&m_trace, max_trace_bytes);
+    else
+        errorlog << "TraceDrainThread::TraceDrainThread(). Unable to open " << trace_name << ". Only the histograms will be written." << std::endl;
+    start();
+}
+
+/*! @brief Stops the thread, and then collects the last spans and writes the final trace and histograms */
+TraceDrainThread::~TraceDrainThread()
+{
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "TraceDrainThread::~TraceDrainThread()" << std::endl;
+    #endif
+    pthread_mutex_lock(&m_mutex);
+    m_stopping = true;
+    pthread_cond_signal(&m_stop);
+    pthread_mutex_unlock(&m_mutex);
+    join();
+
+    m_collector.collect();
+    m_collector.finishTrace();
+    writeHistograms();
+    if (m_collector.getNumDropped() > 0)
+        errorlog << "TraceDrainThread. " << m_collector.getNumDropped() << " spans were dropped because a ring was full." << std::endl;
+
+    pthread_cond_destroy(&m_stop);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/*! @brief The drain's main loop. It collects every period, and rewrites the histograms every ten collections */
+void TraceDrainThread::run()
+{
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "TraceDrainThread::run()" << std::endl;
+    #endif
+    // a new thread inherits the policy of the thread that created it, and the drain must never compete with the real-time threads
+    sched_param param;
+    param.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+    unsigned int count = 0;
+    pthread_mutex_lock(&m_mutex);
+    while (not m_stopping)
+    {
+        struct timespec timeout;
+        clock_gettime(CLOCK_REALTIME, &timeout);
+        timeout.tv_sec += m_period/1000;
+        timeout.tv_nsec += (m_period%1000)*1000000L;
+        if (timeout.tv_nsec >= 1000000000)
+        {
+            timeout.tv_sec++;
+            timeout.tv_nsec -= 1000000000;
+        }
+        if (pthread_cond_timedwait(&m_stop, &m_mutex, &timeout) != ETIMEDOUT)
+            continue;
+        pthread_mutex_unlock(&m_mutex);
+
+        m_collector.collect();
+        if (++count%10 == 0)
+            writeHistograms();
+
+        pthread_mutex_lock(&m_mutex);
+    }
+    pthread_mutex_unlock(&m_mutex);
+    #if DEBUG_THREADING_VERBOSITY > 0
+        debug << "TraceDrainThread is exiting." << std::endl;
+    #endif
+}
+
+/*! @brief Replaces the histogram file with the histograms so far */
+void TraceDrainThread::writeHistograms()
+{
+    std::ofstream file(m_histogram_name.c_str(), std::ios_base::trunc);
+    if (file.is_open())
+        m_collector.writeHistograms(file);
+}
@@ -0,0 +1,53 @@
+/*! @file TraceDrainThread.h
+    @brief Declaration of the low priority thread that empties the Tracer's rings
+
+    @class TraceDrainThread
+    @brief A low priority thread that periodically collects the traced spans, writing them to a Chrome trace and a histogram file
+
+    The histogram file is rewritten every few seconds, so it always holds the distributions so far. When the thread
+    is destroyed it collects one last time, closes the trace and writes the final histograms, so destroy it after
+    the threads being traced have stopped.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRACEDRAINTHREAD_H
+#define TRACEDRAINTHREAD_H
+
+#include "Tools/Threading/Thread.h"
+#include "TraceCollector.h"
+
+#include <fstream>
+#include <string>
+
+class TraceDrainThread : public Thread
+{
+public:
+    TraceDrainThread(const std::string& trace_name, const std::string& histogram_name, int period = 500, unsigned long long max_trace_bytes = 256ULL << 20);
+    ~TraceDrainThread();
+protected:
+    void run();
+private:
+    void writeHistograms();
+
+    TraceCollector m_collector;
+    std::ofstream m_trace;                  //!< the Chrome trace
+    std::string m_histogram_name;           //!< the file the histograms are written to
+    int m_period;                           //!< the time in ms between collections
+    bool m_stopping;                        //!< set, with m_mutex held, when the thread should collect one last time and exit
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_stop;                  //!< signalled when m_stopping is set, so the thread does not sleep out its period
+};
+
+#endif
@@ -0,0 +1,42 @@
+/*! @file TraceRegistry.h
+    @brief Declaration of the tracer's process-wide state, shared by the Tracer and the TraceCollector
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TRACEREGISTRY_H
+#define TRACEREGISTRY_H
+
+#include "Tracer.h"
+
+#include <vector>
+#include <pthread.h>
+
+/*! @brief The span names and every thread's ring. The mutex is only taken when interning, registering and collecting, never when recording. */
+struct TraceRegistry
+{
+    static TraceRegistry& get();
+
+    pthread_mutex_t mutex;
+    pthread_key_t key;                                  //!< used to retire a thread's ring when the thread exits
+    const char* names[Tracer::MaxSpans];                //!< the interned span names, indexed by id
+    std::atomic<unsigned int> num_spans;
+    std::vector<TraceBuffer*> buffers;                  //!< every ring ever created; rings are reused, never freed
+    unsigned int next_thread_id;
+
+private:
+    TraceRegistry();
+};
+
+#endif
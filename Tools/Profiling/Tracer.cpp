@@ -0,0 +1,134 @@
+/*! @file Tracer.cpp
+    @brief Implementation of the span tracer's name table and thread registry
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Tracer.h"
+#include "TraceRegistry.h"
+
+#include <cstring>
+#include <cstdio>
+
+__thread TraceBuffer* Tracer::m_buffer = 0;
+__thread char Tracer::m_thread_name[32] = "";
+
+/*! @brief Returns the process' registry, creating it on first use so that spans may be interned during static initialisation */
+TraceRegistry& TraceRegistry::get()
+{
+    static TraceRegistry registry;
+    return registry;
+}
+
+TraceRegistry::TraceRegistry() : num_spans(0), next_thread_id(1)
+{
+    pthread_mutex_init(&mutex, NULL);
+    pthread_key_create(&key, Tracer::retireThread);
+}
+
+/*! @brief Returns the id of the span with the given name, adding it if this is the first time the name has been seen
+    @param name the span's name. The string is not copied, so it must outlive the process (eg. a literal)
+ */
+unsigned short Tracer::intern(const char* name)
+{
+    TraceRegistry& registry = TraceRegistry::get();
+    pthread_mutex_lock(&registry.mutex);
+    unsigned int count = registry.num_spans.load(std::memory_order_relaxed);
+    unsigned int id = 0;
+    while (id < count and strcmp(registry.names[id], name) != 0)
+        id++;
+    if (id == count)
+    {
+        if (count < MaxSpans - 1)
+            registry.names[id] = name;
+        else
+        {   // the table is full, so every new name is recorded as the last entry
+            id = MaxSpans - 1;
+            registry.names[id] = "other";
+        }
+        registry.num_spans.store(id + 1, std::memory_order_release);
+    }
+    pthread_mutex_unlock(&registry.mutex);
+    return static_cast<unsigned short>(id);
+}
+
+/*! @brief Returns the number of span names interned so far */
+unsigned int Tracer::getNumSpans()
+{
+    return TraceRegistry::get().num_spans.load(std::memory_order_acquire);
+}
+
+/*! @brief Returns the name of an interned span */
+const char* Tracer::getSpanName(unsigned short span)
+{
+    return TraceRegistry::get().names[span];
+}
+
+/*! @brief Sets the name of the calling thread in the trace. Threads that do not set a name are numbered instead.
+    @param name the name, which is copied (and truncated to 31 characters)
+ */
+void Tracer::setThreadName(const char* name)
+{
+    strncpy(m_thread_name, name, sizeof(m_thread_name) - 1);
+    m_thread_name[sizeof(m_thread_name) - 1] = '\0';
+    if (m_buffer != 0)
+    {
+        TraceRegistry& registry = TraceRegistry::get();
+        pthread_mutex_lock(&registry.mutex);
+        strcpy(m_buffer->m_name, m_thread_name);
+        pthread_mutex_unlock(&registry.mutex);
+    }
+}
+
+/*! @brief Gives the calling thread a ring, reusing one left by an exited thread if there is one.
+
+    Any spans still in a reused ring are discarded, so they are lost only if nothing has collected
+    them since their thread exited.
+ */
+TraceBuffer* Tracer::registerThread()
+{
+    TraceRegistry& registry = TraceRegistry::get();
+    pthread_mutex_lock(&registry.mutex);
+    TraceBuffer* buffer = 0;
+    for (size_t i = 0; i < registry.buffers.size() and buffer == 0; i++)
+    {
+        if (registry.buffers[i]->m_retired.load(std::memory_order_acquire))
+            buffer = registry.buffers[i];
+    }
+    if (buffer == 0)
+    {
+        buffer = new TraceBuffer();
+        registry.buffers.push_back(buffer);
+    }
+    buffer->m_head.store(0, std::memory_order_relaxed);
+    buffer->m_tail.store(0, std::memory_order_relaxed);
+    buffer->m_dropped.store(0, std::memory_order_relaxed);
+    buffer->m_retired.store(false, std::memory_order_relaxed);
+    buffer->m_id = registry.next_thread_id++;
+    if (m_thread_name[0] != '\0')
+        strcpy(buffer->m_name, m_thread_name);
+    else
+        snprintf(buffer->m_name, sizeof(buffer->m_name), "thread %u", buffer->m_id);
+    pthread_mutex_unlock(&registry.mutex);
+
+    pthread_setspecific(registry.key, buffer);
+    m_buffer = buffer;
+    return buffer;
+}
+
+/*! @brief Marks an exiting thread's ring as free. Called by pthreads when a thread with a ring exits (or is cancelled). */
+void Tracer::retireThread(void* buffer)
+{
+    static_cast<TraceBuffer*>(buffer)->m_retired.store(true, std::memory_order_release);
+}
@@ -0,0 +1,194 @@
+/*! @file Tracer.h
+    @brief Declaration of the always-on span tracer
+
+    @class Tracer
+    @brief Records timed spans into a lock-free ring buffer owned by each thread
+
+    Unlike the Profiler, recording a span never allocates, formats or locks. Span names are interned once
+    per call site into a small integer (the static in TRACE_SCOPE and TRACE_SPLIT), and a span is written
+    into the calling thread's ring as the id and two raw timestamps. On x86 the timestamps are read from
+    the TSC, elsewhere (or with TRACER_USE_CLOCK defined) from clock_gettime(CLOCK_MONOTONIC). This keeps
+    a span to a few tens of nanoseconds, so the tracer can be left on during games.
+
+    The rings are emptied by a TraceCollector, usually owned by a TraceDrainThread, which converts the
+    timestamps to time, writes the spans as a Chrome trace (chrome://tracing or ui.perfetto.dev) and keeps
+    a histogram of each span's durations. If nothing empties a ring it fills and further spans are counted
+    as dropped, so tracing without a collector costs the same and uses no more memory.
+
+    A span can be recorded for a whole scope:
+    @code
+        TRACE_SCOPE("vision");
+    @endcode
+    or as consecutive splits, in the same way as the Profiler:
+    @code
+        TraceSplits trace;
+        trace.start();
+        ...
+        TRACE_SPLIT(trace, "frame grab");
+    @endcode
+    Names must be string literals (or otherwise outlive the process), and names are shared between call sites.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <atomic>
+#include <time.h>
+
+#if not defined(TRACER_USE_CLOCK) and not (defined(__i386__) or defined(__x86_64__))
+    #define TRACER_USE_CLOCK
+#endif
+
+/*! @brief A span in a thread's ring buffer. The times are in Tracer::now() ticks */
+struct TraceEvent
+{
+    unsigned long long begin;
+    unsigned long long end;
+    unsigned short span;
+};
+
+/*! @brief A fixed size, lock-free queue of spans from the thread that owns it to the collector */
+class TraceBuffer
+{
+public:
+    static const unsigned int Capacity = 8192;          //!< the number of spans held, enough for several seconds of every thread
+
+    TraceBuffer() : m_head(0), m_tail(0), m_dropped(0), m_retired(false), m_id(0) {m_name[0] = '\0';}
+
+    /*! @brief Adds a span to the ring, or counts it as dropped if the ring is full. Owning thread only. */
+    void push(unsigned short span, unsigned long long begin, unsigned long long end)
+    {
+        unsigned int head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= Capacity)
+        {
+            m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        TraceEvent& event = m_events[head % Capacity];
+        event.begin = begin;
+        event.end = end;
+        event.span = span;
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+private:
+    friend class Tracer;
+    friend class TraceCollector;
+
+    TraceEvent m_events[Capacity];
+    std::atomic<unsigned int> m_head;       //!< the number of spans written. Only the owning thread changes it
+    std::atomic<unsigned int> m_tail;       //!< the number of spans read. Only the collector changes it
+    std::atomic<unsigned int> m_dropped;    //!< the number of spans lost because the ring was full
+    std::atomic<bool> m_retired;            //!< true once the owning thread has exited, so the buffer can be reused
+    unsigned int m_id;                      //!< the thread's id in the trace; a reused buffer gets a new one
+    char m_name[32];                        //!< the thread's name in the trace
+};
+
+class Tracer
+{
+public:
+    static const unsigned short MaxSpans = 1024;        //!< the number of distinct span names; later names share the last id
+
+    static unsigned short intern(const char* name);
+    static unsigned int getNumSpans();
+    static const char* getSpanName(unsigned short span);
+
+    static void setThreadName(const char* name);
+
+    static unsigned long long now();
+    static void record(unsigned short span, unsigned long long begin, unsigned long long end);
+
+private:
+    friend class TraceCollector;
+    friend struct TraceRegistry;
+
+    static TraceBuffer* registerThread();
+    static void retireThread(void* buffer);
+
+    static __thread TraceBuffer* m_buffer;              //!< the calling thread's ring, created by its first span
+    static __thread char m_thread_name[32];             //!< the name the thread's ring will be given
+};
+
+/*! @brief Returns the current time in ticks. The ticks are converted to time by the collector. */
+inline unsigned long long Tracer::now()
+{
+    #ifdef TRACER_USE_CLOCK
+        struct timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return time.tv_sec*1000000000ULL + time.tv_nsec;
+    #else
+        unsigned int low, high;
+        __asm__ __volatile__("rdtsc" : "=a" (low), "=d" (high));
+        return (static_cast<unsigned long long>(high) << 32) | low;
+    #endif
+}
+
+/*! @brief Records a span in the calling thread's ring
+    @param span the id returned by intern()
+    @param begin the time the span started, from now()
+    @param end the time the span ended, from now()
+ */
+inline void Tracer::record(unsigned short span, unsigned long long begin, unsigned long long end)
+{
+    TraceBuffer* buffer = m_buffer;
+    if (buffer == 0)
+        buffer = registerThread();
+    buffer->push(span, begin, end);
+}
+
+/*! @brief Records a span from its construction to its destruction. Use TRACE_SCOPE rather than this directly */
+class TraceScope
+{
+public:
+    explicit TraceScope(unsigned short span) : m_span(span), m_begin(Tracer::now()) {}
+    ~TraceScope() {Tracer::record(m_span, m_begin, Tracer::now());}
+private:
+    unsigned short m_span;
+    unsigned long long m_begin;
+};
+
+/*! @brief Records consecutive spans, each from the previous split (or start) to the next. Use with TRACE_SPLIT */
+class TraceSplits
+{
+public:
+    TraceSplits() : m_last(0) {}
+    void start() {m_last = Tracer::now();}
+    void split(unsigned short span)
+    {
+        unsigned long long time = Tracer::now();
+        Tracer::record(span, m_last, time);
+        m_last = time;
+    }
+private:
+    unsigned long long m_last;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+//! Records a span named name until the end of the enclosing scope
+#define TRACE_SCOPE(name) \
+    static const unsigned short TRACE_CONCAT(trace_span_, __LINE__) = Tracer::intern(name); \
+    TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(TRACE_CONCAT(trace_span_, __LINE__))
+
+//! Records a span named name since the last split (or start) of splits
+#define TRACE_SPLIT(splits, name) \
+    do { \
+        static const unsigned short trace_span = Tracer::intern(name); \
+        (splits).split(trace_span); \
+    } while (0)
+
+#endif
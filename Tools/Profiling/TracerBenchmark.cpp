@@ -0,0 +1,252 @@
+/*! @file TracerBenchmark.cpp
+    @brief Measures the cost of recording a span with the Tracer, and compares it with a Profiler split
+
+    Build from this directory with
+    @code
+        make TracerBenchmark
+    @endcode
+    or make TracerBenchmarkClock to measure the clock_gettime timestamps rather than the TSC. Run it with a
+    file name to also write the benchmark's own trace there, and its histograms to the standard output.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Tracer.h"
+#include "TraceCollector.h"
+
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include <pthread.h>
+#include <time.h>
+
+static const unsigned int Iterations = 2000000;
+static const unsigned int NumThreads = 3;
+
+static const unsigned int Batch = TraceBuffer::Capacity/2;
+
+static TraceCollector* collector = NULL;
+static pthread_mutex_t collector_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static double threadTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return time.tv_sec*1e9 + time.tv_nsec;
+}
+
+static double processTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+    return time.tv_sec*1e9 + time.tv_nsec;
+}
+
+static double realTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec*1e9 + time.tv_nsec;
+}
+
+/*! @brief Empties the rings, as the TraceDrainThread would. It is called between timed batches, so the spans are
+           always recorded into a ring with room, and the time to collect them is not counted.
+ */
+static void collect()
+{
+    pthread_mutex_lock(&collector_mutex);
+    collector->collect();
+    pthread_mutex_unlock(&collector_mutex);
+}
+
+//! The work timed in each iteration, small enough that the measurement is dominated by the instrumentation
+static inline void work(unsigned int i)
+{
+    __asm__ __volatile__("" : : "r" (i) : "memory");
+}
+
+static double benchmarkEmpty()
+{
+    double start = threadTime();
+    for (unsigned int i = 0; i < Iterations; i++)
+        work(i);
+    return (threadTime() - start)/Iterations;
+}
+
+static double benchmarkNow()
+{
+    unsigned long long sum = 0;
+    double start = threadTime();
+    for (unsigned int i = 0; i < Iterations; i++)
+        sum += Tracer::now();
+    double elapsed = threadTime() - start;
+    work(sum);
+    return elapsed/Iterations;
+}
+
+static double benchmarkScope()
+{
+    double elapsed = 0;
+    for (unsigned int b = 0; b < Iterations/Batch; b++)
+    {
+        double start = threadTime();
+        for (unsigned int i = 0; i < Batch; i++)
+        {
+            TRACE_SCOPE("benchmark scope");
+            work(i);
+        }
+        elapsed += threadTime() - start;
+        collect();
+    }
+    return elapsed/((Iterations/Batch)*Batch);
+}
+
+static double benchmarkSplit()
+{
+    double elapsed = 0;
+    TraceSplits trace;
+    trace.start();
+    for (unsigned int b = 0; b < Iterations/Batch; b++)
+    {
+        double start = threadTime();
+        for (unsigned int i = 0; i < Batch; i++)
+        {
+            work(i);
+            TRACE_SPLIT(trace, "benchmark split");
+        }
+        elapsed += threadTime() - start;
+        collect();
+    }
+    return elapsed/((Iterations/Batch)*Batch);
+}
+
+//! What a Profiler::split() does, without the Platform: reads three clocks, names the split with a std::string and appends to seven vectors
+static double benchmarkProfilerSplit()
+{
+    const unsigned int splits_per_frame = 10;
+    std::vector<double> thread_times, diff_thread_times, process_times, diff_process_times, real_times, diff_real_times;
+    std::vector<std::string> names;
+    double start = threadTime();
+    for (unsigned int i = 0; i < Iterations/10; i++)
+    {
+        if (i%splits_per_frame == 0)
+        {   // a new Profiler each frame, as the threads do
+            thread_times.clear(); diff_thread_times.clear(); process_times.clear(); diff_process_times.clear();
+            real_times.clear(); diff_real_times.clear(); names.clear();
+        }
+        work(i);
+        double threadtime = threadTime();
+        double processtime = processTime();
+        double realtime = realTime();
+        diff_thread_times.push_back(threadtime - (thread_times.empty() ? 0 : thread_times.back()));
+        diff_process_times.push_back(processtime - (process_times.empty() ? 0 : process_times.back()));
+        diff_real_times.push_back(realtime - (real_times.empty() ? 0 : real_times.back()));
+        names.push_back(std::string("benchmark profiler split"));
+        thread_times.push_back(threadtime);
+        process_times.push_back(processtime);
+        real_times.push_back(realtime);
+    }
+    return (threadTime() - start)/(Iterations/10);
+}
+
+//! Records spans with no collector, so after the first TraceBuffer::Capacity the ring is full and every span is dropped
+static double benchmarkFull()
+{
+    double start = threadTime();
+    for (unsigned int i = 0; i < Iterations; i++)
+    {
+        TRACE_SCOPE("benchmark full");
+        work(i);
+    }
+    return (threadTime() - start)/Iterations;
+}
+
+static void* concurrentThread(void* result)
+{
+    Tracer::setThreadName("benchmark worker");
+    *static_cast<double*>(result) = benchmarkScope();
+    return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+    std::ofstream trace;
+    collector = new TraceCollector();
+    if (argc > 1)
+    {
+        trace.open(argv[1], std::ios_base::trunc);
+        collector->setTrace(&trace, 64ULL << 20);
+    }
+    Tracer::setThreadName("benchmark main");
+    #ifdef TRACER_USE_CLOCK
+        std::cout << "timestamps: clock_gettime(CLOCK_MONOTONIC)" << std::endl;
+    #else
+        std::cout << "timestamps: TSC" << std::endl;
+    #endif
+
+    // a thread that records without a collector fills its ring, so the full case runs first, on its own thread
+    pthread_t full_thread;
+    double full = 0;
+    struct FullRunner
+    {
+        static void* run(void* result) {*static_cast<double*>(result) = benchmarkFull(); return NULL;}
+    };
+    pthread_create(&full_thread, NULL, FullRunner::run, &full);
+    pthread_join(full_thread, NULL);
+    collector->collect();               // counts the dropped spans
+    unsigned long long dropped = collector->getNumDropped();
+    collector->resetHistograms();
+
+    double empty = benchmarkEmpty();
+    double now = benchmarkNow();
+    double scope = benchmarkScope();
+    double split = benchmarkSplit();
+    double profiler = benchmarkProfilerSplit();
+
+    std::vector<pthread_t> threads(NumThreads);
+    std::vector<double> concurrent(NumThreads);
+    for (unsigned int i = 0; i < NumThreads; i++)
+        pthread_create(&threads[i], NULL, concurrentThread, &concurrent[i]);
+    double concurrent_total = 0;
+    for (unsigned int i = 0; i < NumThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+        concurrent_total += concurrent[i];
+    }
+
+    collector->collect();
+    collector->finishTrace();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "ns per iteration (thread cpu time, " << Iterations << " iterations)" << std::endl;
+    std::cout << "    empty loop                      " << std::setw(8) << empty << std::endl;
+    std::cout << "    Tracer::now()                   " << std::setw(8) << now << std::endl;
+    std::cout << "    TRACE_SCOPE                     " << std::setw(8) << scope << std::endl;
+    std::cout << "    TRACE_SPLIT                     " << std::setw(8) << split << std::endl;
+    std::cout << "    TRACE_SCOPE, " << NumThreads << " threads         " << std::setw(8) << concurrent_total/NumThreads << std::endl;
+    std::cout << "    TRACE_SCOPE, ring full          " << std::setw(8) << full << "  (" << dropped << " dropped)" << std::endl;
+    std::cout << "    Profiler::split equivalent      " << std::setw(8) << profiler << std::endl;
+    std::cout << "spans collected: " << collector->getNumCollected() << " dropped: " << collector->getNumDropped() << std::endl;
+
+    if (argc > 1)
+    {
+        std::cout << std::endl;
+        collector->writeHistograms(std::cout);
+    }
+    delete collector;
+    return 0;
+}
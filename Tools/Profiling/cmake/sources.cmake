@@ -21,6 +21,10 @@ ENDIF()
 
 ########## List your source files here! ############################################
 SET (YOUR_SRCS  Profiler.cpp Profiler.h
+                Tracer.cpp Tracer.h
+                TraceRegistry.h
+                TraceCollector.cpp TraceCollector.h
+                TraceDrainThread.cpp TraceDrainThread.h
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
@@ -21,104 +21,187 @@
 
 #include "DictionaryApproximator.h"
 
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+//! The first bytes of a binary save file, followed by the format's version
+static const char SaveMagic[4] = {'N', 'U', 'D', 'A'};
+static const int SaveVersion = 1;
+
 void DictionaryApproximator::initialiseApproximator(int numberOfInputs, int numberOfOutputs, int numberOfHiddens, float max_parameter_range) {
     numInputs = numberOfInputs;
     numOutputs = numberOfOutputs;
     tileMultiplier = numberOfHiddens;
+    approximator.initialise(numInputs, numOutputs);
+    key.assign(numInputs, 0);
    //Debug: std::cout<<"Approx init"<<std::endl;
 }
     
 void DictionaryApproximator::doLearningEpisode(std::vector<std::vector<float> > const& observations, std::vector< std::vector<float> > const& values, float stepSize, int iterations) {
-    std::string tmp;
     for (int i = 0; i < observations.size(); i++) {
        //for each observation
+        float* row = approximator.insert(getRepresentation(observations[i]));
         for (int j = 0; j < numOutputs; j++) {
           //for each possible action
-            tmp = getRepresentation(observations[i],j);
-            approximator[tmp] = values[i][j];//Assign the value function to be the input values.
+            row[j] = values[i][j];//Assign the value function to be the input values.
         }
     }
 }
     
+/*! @brief Returns the value of each action for the observations; a state that has never been learnt has a value of 0 for every action.
+*/
 std::vector<float> DictionaryApproximator::getValues(std::vector<float> const& observations) {
-    std::vector<float> result;
-    
-    for (int i = 0; i < numOutputs; i++) {//For expectation_function from MRLAgent, i represents the ith entry of the predicted state.
-        result.push_back(getValue(observations,i));
-    }
-    return result;
+    const float* row = approximator.find(getRepresentation(observations));
+    if (row == NULL)
+        return std::vector<float>(numOutputs, 0);
+    return std::vector<float>(row, row + numOutputs);//For expectation_function from MRLAgent, i represents the ith entry of the predicted state.
 }
 
+/*! @brief Saves the table as a header of ints (the version, tileMultiplier, numInputs, numOutputs and the number of states),
+           followed by every key and then every row, in the machine's byte order.
+*/
 void DictionaryApproximator::saveApproximator(std::string agentName) {
     std::ofstream save_file;
     std::stringstream file_name;
     file_name<<save_location<<agentName;
-    save_file.open(file_name.str().c_str(),std::fstream::out);
-
-    std::string tempstr;
-    
-    save_file << approximator.size();
-    
-    for (std::map<std::string,float>::iterator iter = approximator.begin(); iter != approximator.end(); iter++) {
-        save_file << "\n" << iter->first << " " << iter->second;
-        //std::cout<< "Saved ("<< iter->first << "," << iter->second<<")"<<std::endl;
-    }
+    save_file.open(file_name.str().c_str(),std::fstream::out | std::fstream::binary);
+
+    int header[5] = {SaveVersion, tileMultiplier, numInputs, numOutputs, approximator.size()};
+    save_file.write(SaveMagic, sizeof(SaveMagic));
+    save_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    const std::vector<int>& keys = approximator.getKeys();
+    const std::vector<float>& rows = approximator.getRows();
+    if (not keys.empty())
+        save_file.write(reinterpret_cast<const char*>(keys.data()), keys.size()*sizeof(int));
+    if (not rows.empty())
+        save_file.write(reinterpret_cast<const char*>(rows.data()), rows.size()*sizeof(float));
 
     save_file.close();
     
 }
 
-std::map<std::string,float>* DictionaryApproximator::getMap(){
+DictionaryTable* DictionaryApproximator::getTable(){
     return (&approximator);
 }
 
     
+/*! @brief Loads a table saved by saveApproximator, or imports a text table saved by an earlier version.
+*/
 void DictionaryApproximator::loadApproximator(std::string agentName) {
     std::ifstream save_file;
     std::stringstream file_name;
     file_name<<save_location<<agentName;
-    save_file.open(file_name.str().c_str(),std::fstream::out);
+    save_file.open(file_name.str().c_str(),std::fstream::in | std::fstream::binary);
     if(!save_file.good()) {
         throw std::string("DictionaryApproximator::loadApproximator - file not found: ") + file_name.str();
     }
-    std::string tempstr;
-    float tempval;
-    int numvals;
-    
-    //get the number of values
-    save_file >> numvals;
-    
-    for (int i = 0; i < numvals; i++) {
-        save_file >> tempstr;
-        save_file >> tempval;
-        approximator[tempstr] = tempval;
-        //Debug
-        //std::cout<<"Loading: (s,a) = "<<tempstr<<", v = "<< tempval<<std::endl;
+    char magic[sizeof(SaveMagic)];
+    save_file.read(magic, sizeof(magic));
+    if (save_file.gcount() == sizeof(magic) and memcmp(magic, SaveMagic, sizeof(magic)) == 0) {
+        loadBinary(save_file, file_name.str());
     }
+    else {
+        save_file.clear();
+        save_file.seekg(0);
+        loadText(save_file, file_name.str());
+    }
+    key.assign(numInputs, 0);
 
     save_file.close();
 }
 
-
-std::string DictionaryApproximator::getRepresentation(std::vector<float> const& observations,int action) {
-    std::stringstream result;
-    
-    for (int i = 0; i < observations.size(); i++) {
-        result << (int)(observations[i]*tileMultiplier) << "_";//Changed seperator to underscore to avoid interfering with the save feature.
+void DictionaryApproximator::loadBinary(std::istream& save_file, std::string const& file_name) {
+    int header[5];
+    save_file.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!save_file.good() or header[0] != SaveVersion or header[2] < 0 or header[3] < 0 or header[4] < 0) {
+        throw std::string("DictionaryApproximator::loadApproximator - file corrupt ") + file_name;
+    }
+    tileMultiplier = header[1];
+    numInputs = header[2];
+    numOutputs = header[3];
+    int numvals = header[4];
+
+    std::vector<int> keys(numvals*numInputs);
+    std::vector<float> rows(numvals*numOutputs);
+    if (not keys.empty())
+        save_file.read(reinterpret_cast<char*>(keys.data()), keys.size()*sizeof(int));
+    if (not rows.empty())
+        save_file.read(reinterpret_cast<char*>(rows.data()), rows.size()*sizeof(float));
+    if (!save_file.good()) {
+        throw std::string("DictionaryApproximator::loadApproximator - file corrupt ") + file_name;
     }
-    result << action;
-    return result.str();
+    approximator.initialise(numInputs, numOutputs);
+    approximator.assign(numvals, keys, rows);
 }
 
-float DictionaryApproximator::getValue(std::vector<float> const& observations,int action) {
+/*! @brief Imports the text format, a count followed by one "tile_tile_..._action value" line per state-action.
+           If the approximator has not been initialised, the number of inputs is taken from the keys and the number of outputs from the largest action.
+*/
+void DictionaryApproximator::loadText(std::istream& save_file, std::string const& file_name) {
+    std::stringstream contents;
+    contents << save_file.rdbuf();
+    const std::string text = contents.str();
+    const char* position = text.c_str();
+    char* end;
+
+    //get the number of values
+    int numvals = strtol(position, &end, 10);
+    if (end == position or numvals < 0) {
+        throw std::string("DictionaryApproximator::loadApproximator - file corrupt ") + file_name;
+    }
+    position = end;
+
+    std::vector<int> cells;
+    std::vector<int> keys;
+    std::vector<int> actions(numvals);
+    std::vector<float> values(numvals);
+    int key_length = -1;
+    int max_action = numOutputs - 1;
+    for (int i = 0; i < numvals; i++) {
+        cells.clear();
+        while (true) {
+            int cell = strtol(position, &end, 10);
+            if (end == position) {
+                throw std::string("DictionaryApproximator::loadApproximator - file corrupt ") + file_name;
+            }
+            cells.push_back(cell);
+            position = end;
+            if (*position != '_')
+                break;
+            position++;
+        }
+        if (key_length < 0)
+            key_length = cells.size() - 1;
+        if ((int)cells.size() - 1 != key_length or cells.back() < 0) {
+            throw std::string("DictionaryApproximator::loadApproximator - file corrupt ") + file_name;
+        }
+        keys.insert(keys.end(), cells.begin(), cells.end() - 1);
+        actions[i] = cells.back();
+        max_action = std::max(max_action, actions[i]);
 
-    std::string val = getRepresentation(observations,action);
-    float result = approximator[val];
+        values[i] = strtof(position, &end);
+        if (end == position) {
+            throw std::string("DictionaryApproximator::loadApproximator - file corrupt ") + file_name;
+        }
+        position = end;
+    }
 
-    return result;
+    if (key_length >= 0)
+        numInputs = key_length;
+    numOutputs = max_action + 1;
+    approximator.initialise(numInputs, numOutputs, numvals);
+    for (int i = 0; i < numvals; i++) {
+        approximator.insert(keys.data() + i*numInputs)[actions[i]] = values[i];
+    }
 }
 
-float DictionaryApproximator::setValue(std::vector<float> const& observations,int action,float value) {
-    std::string val = getRepresentation(observations,action);
-    approximator[val] = value;
+
+/*! @brief Discretises the observations into the key, and returns it. The key is overwritten by the next call.
+*/
+const int* DictionaryApproximator::getRepresentation(std::vector<float> const& observations) {
+    for (int i = 0; i < numInputs; i++) {
+        key[i] = (int)(observations[i]*tileMultiplier);
+    }
+    return key.data();
 }
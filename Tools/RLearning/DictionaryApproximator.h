@@ -27,22 +27,26 @@
 #include <fstream>
 #include <vector>
 
-#include <map>
 #include <string>
-#include <vector>
 #include <iostream>
 #include "ApproximatorInterface.h"
+#include "DictionaryTable.h"
 
 
 
+/*! The observations are discretised into a key of one tile index per input, (int)(observation*tileMultiplier), and the
+    table stores a row of numOutputs values for each key. Saved tables are binary; the text files saved by earlier
+    versions, with one "tile_tile_..._action value" line per state-action, are still loaded.
+*/
 class DictionaryApproximator: public ApproximatorInterface {
 
 private:
     int tileMultiplier,numInputs,numOutputs;
-    std::map<std::string,float> approximator;
-    float getValue(std::vector<float> const& observations,int action);
-    float setValue(std::vector<float> const& observations,int action,float value);
-    std::string getRepresentation(std::vector<float> const& observations,int action);
+    DictionaryTable approximator;
+    std::vector<int> key;               //!< the key of the last discretised observation, kept so lookups do not allocate
+    const int* getRepresentation(std::vector<float> const& observations);
+    void loadBinary(std::istream& save_file, std::string const& file_name);
+    void loadText(std::istream& save_file, std::string const& file_name);
     
 public:
     /*! @brief numberOfHiddens represents the tileMultiplier variable. This variable controls the resolution of the discretisation of the lookup table.
@@ -58,9 +62,9 @@ public:
     
     virtual void loadApproximator(std::string agentName);
     
-    std::map<std::string,float>* getMap();
+    DictionaryTable* getTable();
 
-    DictionaryApproximator():ApproximatorInterface(){}
+    DictionaryApproximator():ApproximatorInterface(),tileMultiplier(1),numInputs(0),numOutputs(0){}
     
 };
 
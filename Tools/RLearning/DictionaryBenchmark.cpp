@@ -0,0 +1,234 @@
+/*! @file DictionaryBenchmark.cpp
+    @brief Checks DictionaryApproximator against the previous string keyed std::map, including loading the text files it
+           saved, and times lookups, learning episodes, saving and loading across table sizes.
+
+    Build and run from this directory with
+    @code
+        make DictionaryBenchmark && ./DictionaryBenchmark
+    @endcode
+    The save files are written to the current directory. It returns non-zero if any check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "DictionaryApproximator.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <vector>
+#include <time.h>
+
+/*! @brief The previous DictionaryApproximator: a std::map keyed by the tiles and action formatted into a string.
+*/
+class ReferenceDictionaryApproximator: public ApproximatorInterface {
+public:
+    ReferenceDictionaryApproximator() {save_location = "";}
+    void initialiseApproximator(int numberOfInputs, int numberOfOutputs, int numberOfHiddens, float max_parameter_range = 1)
+    {
+        numInputs = numberOfInputs;
+        numOutputs = numberOfOutputs;
+        tileMultiplier = numberOfHiddens;
+    }
+    void doLearningEpisode(std::vector< std::vector<float> > const& observations, std::vector< std::vector<float> > const& values, float stepSize=0.1, int iterations=1)
+    {
+        for (unsigned int i = 0; i < observations.size(); i++)
+            for (int j = 0; j < numOutputs; j++)
+                approximator[getRepresentation(observations[i],j)] = values[i][j];
+    }
+    std::vector<float> getValues(std::vector<float> const& observations)
+    {
+        std::vector<float> result;
+        for (int i = 0; i < numOutputs; i++)
+            result.push_back(approximator[getRepresentation(observations,i)]);
+        return result;
+    }
+    void saveApproximator(std::string agentName)
+    {
+        std::ofstream save_file((save_location + agentName).c_str());
+        save_file << approximator.size();
+        for (std::map<std::string,float>::iterator iter = approximator.begin(); iter != approximator.end(); iter++)
+            save_file << "\n" << iter->first << " " << iter->second;
+    }
+    void loadApproximator(std::string agentName)
+    {
+        std::ifstream save_file((save_location + agentName).c_str());
+        std::string tempstr;
+        float tempval;
+        int numvals;
+        save_file >> numvals;
+        for (int i = 0; i < numvals; i++) {
+            save_file >> tempstr;
+            save_file >> tempval;
+            approximator[tempstr] = tempval;
+        }
+    }
+
+private:
+    std::string getRepresentation(std::vector<float> const& observations,int action)
+    {
+        std::stringstream result;
+        for (unsigned int i = 0; i < observations.size(); i++)
+            result << (int)(observations[i]*tileMultiplier) << "_";
+        result << action;
+        return result.str();
+    }
+    int tileMultiplier,numInputs,numOutputs;
+    std::map<std::string,float> approximator;
+};
+
+/*! @brief Writes save files to the current directory */
+class LocalDictionaryApproximator: public DictionaryApproximator {
+public:
+    LocalDictionaryApproximator() {save_location = "";}
+};
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static std::vector<float> randomVector(int n, float range)
+{
+    std::vector<float> v(n);
+    for (int i = 0; i < n; i++)
+        v[i] = range*(2.0f*rand()/RAND_MAX - 1.0f);
+    return v;
+}
+
+/*! @brief The largest difference between the values of the two approximators over the observations */
+template <typename A, typename B>
+static float largestDifference(A& a, B& b, std::vector<std::vector<float> > const& observations)
+{
+    float worst = 0;
+    for (unsigned int i = 0; i < observations.size(); i++) {
+        std::vector<float> x = a.getValues(observations[i]);
+        std::vector<float> y = b.getValues(observations[i]);
+        if (x.size() != y.size())
+            return 1e9;
+        for (unsigned int j = 0; j < x.size(); j++)
+            worst = std::max(worst, fabsf(x[j] - y[j]));
+    }
+    return worst;
+}
+
+static long fileSize(const char* name)
+{
+    FILE* file = fopen(name, "rb");
+    if (file == NULL)
+        return 0;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+int main()
+{
+    srand(42);
+    bool ok = true;
+    const int num_inputs = 4;
+    const int num_outputs = 5;
+    const int tiles = 10;
+    const int sizes[] = {1000, 10000, 100000, 1000000};
+
+    std::cout << "Time in us, for " << num_inputs << " inputs, " << num_outputs << " actions and " << tiles << " tiles per unit" << std::endl;
+    std::cout << std::setw(9) << "states" << std::setw(12) << "old lookup" << std::setw(10) << "lookup";
+    std::cout << std::setw(12) << "old learn" << std::setw(10) << "learn";
+    std::cout << std::setw(12) << "old save" << std::setw(10) << "save" << std::setw(12) << "old load" << std::setw(10) << "load";
+    std::cout << std::setw(12) << "import" << std::setw(12) << "old bytes" << std::setw(10) << "bytes" << std::endl;
+    for (int si = 0; si < 4; si++) {
+        int n = sizes[si];
+        float range = 0.5f*pow(2.0*n, 1.0/num_inputs)/tiles;      //about twice as many tiles as samples, so most samples are new states
+        std::vector<std::vector<float> > observations, values;
+        for (int i = 0; i < n; i++) {
+            observations.push_back(randomVector(num_inputs, range));
+            values.push_back(randomVector(num_outputs, 1));
+        }
+
+        ReferenceDictionaryApproximator reference;
+        LocalDictionaryApproximator dictionary;
+        reference.initialiseApproximator(num_inputs, num_outputs, tiles);
+        dictionary.initialiseApproximator(num_inputs, num_outputs, tiles);
+
+        double start = now();
+        reference.doLearningEpisode(observations, values);
+        double old_learn = 1e6*(now() - start)/n;
+        start = now();
+        dictionary.doLearningEpisode(observations, values);
+        double learn = 1e6*(now() - start)/n;
+
+        //half of the lookups are of unseen states
+        std::vector<std::vector<float> > queries(observations.begin(), observations.begin() + n/2);
+        for (int i = 0; i < n/2; i++)
+            queries.push_back(randomVector(num_inputs, range));
+        volatile float sink = 0;
+        start = now();
+        for (int i = 0; i < n; i++)
+            sink += dictionary.getValues(queries[i])[0];
+        double lookup = 1e6*(now() - start)/n;
+        start = now();
+        for (int i = 0; i < n; i++)
+            sink += reference.getValues(queries[i])[0];
+        double old_lookup = 1e6*(now() - start)/n;      //after the dictionary, as the reference inserts what it looks up
+
+        float difference = largestDifference(reference, dictionary, queries);
+
+        start = now();
+        reference.saveApproximator("DictionaryBenchmark_text");
+        double old_save = 1e6*(now() - start);
+        start = now();
+        dictionary.saveApproximator("DictionaryBenchmark_binary");
+        double save = 1e6*(now() - start);
+
+        ReferenceDictionaryApproximator old_loaded;
+        old_loaded.initialiseApproximator(num_inputs, num_outputs, tiles);
+        start = now();
+        old_loaded.loadApproximator("DictionaryBenchmark_text");
+        double old_load = 1e6*(now() - start);
+        LocalDictionaryApproximator loaded;
+        loaded.initialiseApproximator(num_inputs, num_outputs, tiles);
+        start = now();
+        loaded.loadApproximator("DictionaryBenchmark_binary");
+        double load = 1e6*(now() - start);
+        LocalDictionaryApproximator imported;        //not initialised, as RLAgent::loadAgent loads
+        start = now();
+        imported.loadApproximator("DictionaryBenchmark_text");
+        double import = 1e6*(now() - start);
+        imported.initialiseApproximator(num_inputs, num_outputs, tiles);
+        imported.loadApproximator("DictionaryBenchmark_text");
+
+        float load_difference = largestDifference(dictionary, loaded, queries);
+        float import_difference = largestDifference(old_loaded, imported, queries);
+        bool passed = difference == 0 and load_difference == 0 and import_difference < 1e-5
+                      and loaded.getTable()->size() == dictionary.getTable()->size();
+        ok = ok and passed;
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << std::setw(9) << dictionary.getTable()->size() << std::setw(12) << old_lookup << std::setw(10) << lookup;
+        std::cout << std::setw(12) << old_learn << std::setw(10) << learn;
+        std::cout << std::setprecision(0) << std::setw(12) << old_save << std::setw(10) << save << std::setw(12) << old_load << std::setw(10) << load;
+        std::cout << std::setw(12) << import << std::setw(12) << fileSize("DictionaryBenchmark_text") << std::setw(10) << fileSize("DictionaryBenchmark_binary");
+        std::cout << (passed ? "" : "  FAIL") << std::endl;
+    }
+    remove("DictionaryBenchmark_text");
+    remove("DictionaryBenchmark_binary");
+
+    std::cout << (ok ? "All checks passed" : "Checks FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
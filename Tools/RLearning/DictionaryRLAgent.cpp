@@ -44,5 +44,5 @@
 
 DictionaryRLAgent::DictionaryRLAgent():RLAgent()
 {
-    FunctionApproximator = (ApproximatorInterface*)(new DictionaryRLAgent());
+    FunctionApproximator = (ApproximatorInterface*)(new DictionaryApproximator());
 }
@@ -0,0 +1,147 @@
+/*! @file DictionaryTable.cpp
+    @brief An open addressing hash table from a discretised state to a row of values, one per action. Used in: DictionaryApproximator.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DictionaryTable.h"
+
+static const int MinimumSlots = 16;
+
+DictionaryTable::DictionaryTable() {
+    key_length = 0;
+    row_length = 0;
+    num_entries = 0;
+    mask = 0;
+}
+
+/*! @brief Empties the table and sets the shape of its entries.
+    @param key_length_ = the number of ints in a key
+           row_length_ = the number of values stored for each key
+           expected_size = the number of entries to make room for, so they can be inserted without growing the table
+*/
+void DictionaryTable::initialise(int key_length_, int row_length_, int expected_size) {
+    key_length = key_length_;
+    row_length = row_length_;
+    clear();
+    reserve(expected_size);
+}
+
+/*! @brief Removes every entry, keeping the table's storage */
+void DictionaryTable::clear() {
+    num_entries = 0;
+    keys.clear();
+    rows.clear();
+    if (slots.empty())
+        rehash(MinimumSlots);
+    else
+        for (unsigned int i = 0; i < slots.size(); i++)
+            slots[i].entry = -1;
+}
+
+/*! @brief Makes room for expected_size entries */
+void DictionaryTable::reserve(int expected_size) {
+    keys.reserve(expected_size*key_length);
+    rows.reserve(expected_size*row_length);
+    int num_slots = slots.size();
+    while (num_slots < 2*expected_size)
+        num_slots *= 2;
+    if (num_slots > (int)slots.size())
+        rehash(num_slots);
+}
+
+/*! @brief Returns the row of values for key, or NULL if key has never been inserted */
+const float* DictionaryTable::find(const int* key) const {
+    int slot = findSlot(key, hash(key));
+    int entry = slots[slot].entry;
+    if (entry < 0)
+        return 0;
+    return rows.data() + entry*row_length;
+}
+
+/*! @brief Returns the row of values for key, adding a row of zeros if key has never been inserted. The pointer is valid until the next insert. */
+float* DictionaryTable::insert(const int* key) {
+    unsigned int h = hash(key);
+    int slot = findSlot(key, h);
+    if (slots[slot].entry >= 0)
+        return rows.data() + slots[slot].entry*row_length;
+
+    if (2*(num_entries + 1) > (int)slots.size()) {
+        rehash(2*slots.size());
+        slot = findSlot(key, h);
+    }
+    slots[slot].hash = h;
+    slots[slot].entry = num_entries;
+    keys.insert(keys.end(), key, key + key_length);
+    rows.resize(rows.size() + row_length, 0);
+    return rows.data() + (num_entries++)*row_length;
+}
+
+/*! @brief Replaces the contents of the table with the num_entries_ entries in keys_ and rows_, which are swapped into the table.
+           The keys must be distinct.
+*/
+void DictionaryTable::assign(int num_entries_, std::vector<int>& keys_, std::vector<float>& rows_) {
+    keys.swap(keys_);
+    rows.swap(rows_);
+    num_entries = num_entries_;
+    int num_slots = MinimumSlots;
+    while (num_slots < 2*num_entries)
+        num_slots *= 2;
+    rehash(num_slots);
+}
+
+/*! @brief Hashes the ints of a key by multiplying each into a 64 bit state, and keeps the well mixed high bits */
+unsigned int DictionaryTable::hash(const int* key) const {
+    unsigned long long h = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < key_length; i++) {
+        h ^= (unsigned int)key[i];
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 29;
+    }
+    return (unsigned int)(h >> 32);
+}
+
+/*! @brief Returns the slot holding key, or the empty slot where it would be inserted */
+int DictionaryTable::findSlot(const int* key, unsigned int h) const {
+    unsigned int slot = h & mask;
+    while (true) {
+        const Slot& s = slots[slot];
+        if (s.entry < 0 or (s.hash == h and keyEquals(s.entry, key)))
+            return slot;
+        slot = (slot + 1) & mask;
+    }
+}
+
+bool DictionaryTable::keyEquals(int entry, const int* key) const {
+    const int* stored = keys.data() + entry*key_length;
+    for (int i = 0; i < key_length; i++)
+        if (stored[i] != key[i])
+            return false;
+    return true;
+}
+
+/*! @brief Rebuilds the slots with num_slots slots, which must be a power of two larger than twice the number of entries */
+void DictionaryTable::rehash(int num_slots) {
+    Slot empty = {0, -1};
+    slots.assign(num_slots, empty);
+    mask = num_slots - 1;
+    for (int i = 0; i < num_entries; i++) {
+        unsigned int h = hash(keys.data() + i*key_length);
+        unsigned int slot = h & mask;
+        while (slots[slot].entry >= 0)
+            slot = (slot + 1) & mask;
+        slots[slot].hash = h;
+        slots[slot].entry = i;
+    }
+}
@@ -0,0 +1,72 @@
+/*! @file DictionaryTable.h
+    @brief An open addressing hash table from a discretised state to a row of values, one per action. Used in: DictionaryApproximator.
+
+    A state is a key of key_length ints (the tile index of each input). The keys and rows are stored
+    contiguously in the order they were inserted, and the slots of the table only hold a 32 bit hash
+    and the entry's index, so a probe touches one small array and finding an entry does not allocate.
+    Slots are probed linearly, and the table doubles when it is half full.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DICTIONARYTABLE_H
+#define DICTIONARYTABLE_H
+
+#include <vector>
+
+class DictionaryTable {
+
+public:
+    DictionaryTable();
+    void initialise(int key_length_, int row_length_, int expected_size = 0);
+    void clear();
+    void reserve(int expected_size);
+
+    int size() const {return num_entries;}
+    int getKeyLength() const {return key_length;}
+    int getRowLength() const {return row_length;}
+
+    const float* find(const int* key) const;
+    float* insert(const int* key);
+
+    /*! @brief The key and row of the i'th entry inserted, 0 <= i < size() */
+    const int* getKey(int i) const {return keys.data() + i*key_length;}
+    const float* getRow(int i) const {return rows.data() + i*row_length;}
+    float* getRow(int i) {return rows.data() + i*row_length;}
+
+    const std::vector<int>& getKeys() const {return keys;}
+    const std::vector<float>& getRows() const {return rows;}
+    void assign(int num_entries_, std::vector<int>& keys_, std::vector<float>& rows_);
+
+private:
+    struct Slot {
+        unsigned int hash;
+        int entry;          //-1 when the slot is empty
+    };
+
+    unsigned int hash(const int* key) const;
+    int findSlot(const int* key, unsigned int h) const;
+    bool keyEquals(int entry, const int* key) const;
+    void rehash(int num_slots);
+
+    int key_length;
+    int row_length;
+    int num_entries;
+    unsigned int mask;
+    std::vector<Slot> slots;
+    std::vector<int> keys;      //the i'th key at [i*key_length]
+    std::vector<float> rows;    //the i'th row at [i*row_length]
+};
+
+#endif
@@ -114,22 +114,34 @@ void FourierApproximator::initialiseApproximator(int numberOfInputs, int numberO
 */
 void FourierApproximator::doLearningEpisode(std::vector<std::vector<float> > const& observations, std::vector< std::vector<float> > const& values, float stepSize, int iterations)
 {
-
+    if(num_outputs == 0)
+        return;
     for(int obs = 0; obs<observations.size();obs++){
+        computeFeatures(observations[obs]);
+        float norm_squared = FourierBasis::normSquared(&phi[0], phi.size());
         for(int i = 0; i<num_outputs;i++){
-            value_action_functions[i].learn(observations[obs],values[obs][i],iterations);
+            value_action_functions[i].learnFeatures(&phi[0], norm_squared, values[obs][i], iterations);
         }
     }
 
 }
-/*! @brief Evaluates each output function
+/*! @brief Evaluates each output function, computing the features of the observation once for all of them
 */
 std::vector<float> FourierApproximator::getValues(std::vector<float> const& observations)
 {
-    std::vector<float> result;
+    std::vector<float> result(num_outputs);
+    if(num_outputs == 0)
+        return result;
+    computeFeatures(observations);
     for(int i = 0; i<num_outputs;i++){
-        result.push_back(value_action_functions[i].evaluate(observations));
+        result[i] = value_action_functions[i].evaluateFeatures(&phi[0]);
     }
     return result;
 
 }
+/*! @brief Computes phi for an observation. Every output function has the same order, inputs, coupling and period, so they share one basis.
+*/
+void FourierApproximator::computeFeatures(std::vector<float> const& observations)
+{
+    value_action_functions[0].getBasis().computeFeatures(observations, phi);
+}
@@ -59,6 +59,9 @@ protected:
     float learning_rate;
 
     std::vector<FourierFunction> value_action_functions;
+    std::vector<float> phi;     //the features of the last observation, shared by every output function
+
+    void computeFeatures(std::vector<float> const& observations);
 
 };
 
@@ -0,0 +1,155 @@
+/*! @file FourierBasis.cpp
+    @brief Computes the feature vector phi of a Fourier basis, shared by every function over the same inputs.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "FourierBasis.h"
+
+#include <cmath>
+#include <algorithm>
+
+FourierBasis::FourierBasis()
+{
+    order_k = 0;
+    num_inputs_m = 0;
+    number_of_basis_functions_n = 0;
+    fully_coupled = false;
+    max_period = 1;
+}
+
+/*! @brief Sets up the basis and allocates the working storage, so computeFeatures() does not allocate.
+    @param  int order_k_ = order of the basis, the highest multiple of each input's angle
+            int num_inputs_m_ = number of inputs
+            bool fully_coupled_ = true for (k+1)^m basis functions of every combination of inputs, false for m*(k+1) functions of one input each
+            float max_period_ = the largest of the expected ranges of the input data
+*/
+void FourierBasis::initialise(int order_k_, int num_inputs_m_, bool fully_coupled_, float max_period_)
+{
+    order_k = order_k_;
+    num_inputs_m = num_inputs_m_;
+    fully_coupled = fully_coupled_;
+    max_period = max_period_;
+
+    int per_input = order_k + 1;
+    if(fully_coupled){
+        number_of_basis_functions_n = 1;
+        for(int d = 0; d<num_inputs_m; d++)
+            number_of_basis_functions_n *= per_input;
+    }else{
+        number_of_basis_functions_n = num_inputs_m*per_input;
+    }
+
+    cos_table.assign(num_inputs_m*per_input, 0);
+    sin_table.assign(num_inputs_m*per_input, 0);
+
+    //the partial sums never include the fastest input, which is added straight into phi
+    int partial_size = fully_coupled ? std::max(1, number_of_basis_functions_n/per_input) : 1;
+    partial_cos.assign(partial_size, 0);
+    partial_sin.assign(partial_size, 0);
+    next_cos.assign(partial_size, 0);
+    next_sin.assign(partial_size, 0);
+}
+
+/*! @brief Calculates the value of every basis function at input.
+    @param input = the point in R^m
+           phi = resized to size() and filled with the basis function values, in the order of the weights
+*/
+void FourierBasis::computeFeatures(std::vector<float> const& input, std::vector<float>& phi)
+{
+    const int per_input = order_k + 1;
+    const double PI = atan(1)*4;
+    phi.resize(number_of_basis_functions_n);
+
+    //cos(j*theta) and sin(j*theta) by the Chebyshev recurrence f(j+1) = 2cos(theta)f(j) - f(j-1), in double so the error does not grow with j
+    for(int d = 0; d<num_inputs_m; d++){
+        double theta = PI*input[d]/max_period;
+        double c1 = cos(theta);
+        double s1 = sin(theta);
+        double c_prev = 1, s_prev = 0;
+        double c = c1, s = s1;
+        float* cos_d = &cos_table[d*per_input];
+        float* sin_d = &sin_table[d*per_input];
+        cos_d[0] = 1;
+        sin_d[0] = 0;
+        for(int j = 1; j<per_input; j++){
+            cos_d[j] = c;
+            sin_d[j] = s;
+            double c_next = 2*c1*c - c_prev;
+            double s_next = 2*c1*s - s_prev;
+            c_prev = c; s_prev = s;
+            c = c_next; s = s_next;
+        }
+    }
+
+    if(not fully_coupled){
+        for(int i = 0; i<number_of_basis_functions_n; i++)
+            phi[i] = cos_table[i];
+        return;
+    }
+    if(num_inputs_m == 0){
+        phi[0] = 1;
+        return;
+    }
+
+    //Add the inputs from the slowest digit of the constants to the fastest:
+    //cos(a + j*theta) = cos(a)cos(j*theta) - sin(a)sin(j*theta), sin(a + j*theta) = sin(a)cos(j*theta) + cos(a)sin(j*theta)
+    int partial_size = 1;
+    partial_cos[0] = 1;
+    partial_sin[0] = 0;
+    for(int d = num_inputs_m-1; d>0; d--){
+        const float* cos_d = &cos_table[d*per_input];
+        const float* sin_d = &sin_table[d*per_input];
+        for(int a = 0; a<partial_size; a++){
+            const float ca = partial_cos[a];
+            const float sa = partial_sin[a];
+            float* out_cos = &next_cos[a*per_input];
+            float* out_sin = &next_sin[a*per_input];
+            for(int j = 0; j<per_input; j++){
+                out_cos[j] = ca*cos_d[j] - sa*sin_d[j];
+                out_sin[j] = sa*cos_d[j] + ca*sin_d[j];
+            }
+        }
+        partial_size *= per_input;
+        partial_cos.swap(next_cos);
+        partial_sin.swap(next_sin);
+    }
+
+    //only the cosine of the full sum is needed
+    const float* cos_0 = &cos_table[0];
+    const float* sin_0 = &sin_table[0];
+    for(int a = 0; a<partial_size; a++){
+        const float ca = partial_cos[a];
+        const float sa = partial_sin[a];
+        float* out = &phi[a*per_input];
+        for(int j = 0; j<per_input; j++)
+            out[j] = ca*cos_0[j] - sa*sin_0[j];
+    }
+}
+
+/*! @brief Calculates the dot product of two arrays of length n
+*/
+float FourierBasis::dotProd(const float* x, const float* y, int n)
+{
+    float result = 0;
+    for(int i = 0; i<n; i++)
+        result += x[i]*y[i];
+    return result;
+}
+
+/*! @brief Calculates the squared euclidean norm of an array of length n
+*/
+float FourierBasis::normSquared(const float* x, int n)
+{
+    return dotProd(x, x, n);
+}
@@ -0,0 +1,58 @@
+/*! @file FourierBasis.h
+    @brief Computes the feature vector phi of a Fourier basis, shared by every function over the same inputs.
+
+    The i'th basis function is cos(c_i.x*PI/max_period), where the constant vectors c_i count through
+    {0..k}^m in base k+1 (c_i[0] the fastest digit) when fully coupled, or are j*e_d for each input d
+    and 0<=j<=k otherwise; this is the ordering of the weights saved by FourierFunction.
+
+    Rather than one cos per basis function, phi is built from cos(j*theta_d) and sin(j*theta_d) for each
+    input (theta_d = x_d*PI/max_period), which come from a Chebyshev recurrence after one cos and sin per
+    input. A fully coupled basis then adds one input at a time with the angle addition formulae, so each
+    basis function costs a few multiply-adds over contiguous arrays, which the compiler can vectorise.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef FOURIERBASIS_H
+#define FOURIERBASIS_H
+
+#include <vector>
+
+class FourierBasis
+{
+public:
+    FourierBasis();
+    void initialise(int order_k_, int num_inputs_m_, bool fully_coupled_, float max_period_);
+
+    int size() const {return number_of_basis_functions_n;}
+
+    void computeFeatures(std::vector<float> const& input, std::vector<float>& phi);
+    static float dotProd(const float* x, const float* y, int n);
+    static float normSquared(const float* x, int n);
+
+private:
+    int order_k;
+    int num_inputs_m;
+    int number_of_basis_functions_n;
+    bool fully_coupled;
+    float max_period;
+
+    std::vector<float> cos_table;       //cos(j*theta_d) at [d*(k+1)+j]
+    std::vector<float> sin_table;       //sin(j*theta_d) at [d*(k+1)+j]
+    std::vector<float> partial_cos;     //cos and sin of the angles summed over the inputs added so far
+    std::vector<float> partial_sin;
+    std::vector<float> next_cos;
+    std::vector<float> next_sin;
+};
+
+#endif // FOURIERBASIS_H
@@ -0,0 +1,298 @@
+/*! @file FourierBenchmark.cpp
+    @brief Checks FourierBasis against the direct evaluation of every cosine, and times FourierFunction and
+           FourierApproximator against the previous implementation across orders and input dimensions.
+
+    Build and run from this directory with
+    @code
+        make FourierBenchmark && ./FourierBenchmark
+    @endcode
+    It returns non-zero if any accuracy check fails.
+
+ This file is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This file is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "FourierBasis.h"
+#include "FourierFunction.h"
+#include "FourierApproximator.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <time.h>
+
+/*! @brief The previous FourierFunction: one cos per basis function, with the constants stored as vectors and the
+    phi vector rebuilt on every learning iteration.
+*/
+class ReferenceFourierFunction
+{
+public:
+    void initialiseFunction(int order_k_, int num_inputs_m_, bool fully_coupled_, float learning_rate_alpha_, float max_period_)
+    {
+        PI = atan(1)*4;
+        order_k = order_k_;
+        num_inputs_m = num_inputs_m_;
+        fully_coupled = fully_coupled_;
+        generateConstants();
+        number_of_basis_functions_n = basis_constants_c.size();
+        learning_rate_alpha = learning_rate_alpha_;
+        weights_w = std::vector<float>(number_of_basis_functions_n,0);
+        max_period = max_period_;
+    }
+    float evaluate(std::vector<float> const& input)
+    {
+        float result = 0;
+        for(int i = 0; i<number_of_basis_functions_n;i++){
+            result+= weights_w[i]*cos(PI*dotProd(basis_constants_c[i],input)/max_period);
+        }
+        return result;
+    }
+    void learn(std::vector<float> input, float value, int iterations = 1)
+    {
+        for(int i = 0; i<iterations; i++){
+            float delta = value - evaluate(input);
+            std::vector<float> phi;
+            for(int j = 0; j<number_of_basis_functions_n;j++){
+                phi.push_back(cos(PI*dotProd(basis_constants_c[j],input)/max_period));
+            }
+            float norm_squared = 0;
+            for(unsigned int j = 0; j<phi.size();j++){
+                norm_squared+=phi[j]*phi[j];
+            }
+            if(norm_squared!=0)
+                for (int j = 0; j< number_of_basis_functions_n; j++){
+                    weights_w[j]+=learning_rate_alpha*phi[j]*delta/norm_squared;
+                }
+        }
+    }
+    float dotProd(std::vector<float> x, std::vector<float> y)
+    {
+        float result = 0;
+        for (unsigned int i = 0; i<x.size(); i++){
+            result += x[i]*y[i];
+        }
+        return result;
+    }
+
+    int order_k;
+    int num_inputs_m;
+    int number_of_basis_functions_n;
+    float max_period;
+    bool fully_coupled;
+    float learning_rate_alpha;
+    std::vector<float> weights_w;
+    std::vector<std::vector<float> > basis_constants_c;
+    float PI;
+
+private:
+    void generateConstants()
+    {
+        basis_constants_c.clear();
+        if(fully_coupled){
+            std::vector<float> constant(num_inputs_m,0);
+            int num = (int)pow((double)order_k+1,(double)num_inputs_m);
+            for(int i = 0; i<num;i++){
+                basis_constants_c.push_back(constant);
+                getNextConstant(constant);
+            }
+        }else{
+            for(int i = 0; i<num_inputs_m;i++){
+                for(int j = 0; j<=order_k;j++){
+                    std::vector<float> constant(num_inputs_m,0);
+                    constant[i] = j;
+                    basis_constants_c.push_back(constant);
+                }
+            }
+        }
+    }
+    void getNextConstant(std::vector<float> &c)
+    {
+        c[0]=((int)c[0]+1)%(order_k+1);
+        unsigned int i = 0;
+        while((int)c[i]==0){
+            i++;
+            if(i>=c.size()) break;
+            c[i]=((int)c[i]+1)%(order_k+1);
+        }
+    }
+};
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static std::vector<float> randomInput(int m, float range)
+{
+    std::vector<float> input(m);
+    for(int d = 0; d<m; d++)
+        input[d] = range*(2.0f*rand()/RAND_MAX - 1.0f);
+    return input;
+}
+
+/*! @brief Compares every basis function with cos evaluated in double precision, returning the largest error over random inputs */
+static double basisError(int k, int m, bool coupled, float max_period)
+{
+    ReferenceFourierFunction reference;
+    reference.initialiseFunction(k, m, coupled, 0.01, max_period);
+    FourierBasis basis;
+    basis.initialise(k, m, coupled, max_period);
+    if(basis.size() != reference.number_of_basis_functions_n)
+        return 1e9;
+
+    const double PI = atan(1)*4;
+    double worst = 0;
+    std::vector<float> phi;
+    for(int sample = 0; sample<200; sample++){
+        std::vector<float> input = randomInput(m, max_period);
+        basis.computeFeatures(input, phi);
+        for(int i = 0; i<basis.size(); i++){
+            double angle = 0;
+            for(int d = 0; d<m; d++)
+                angle += reference.basis_constants_c[i][d]*input[d];
+            worst = std::max(worst, fabs(phi[i] - cos(PI*angle/max_period)));
+        }
+    }
+    return worst;
+}
+
+/*! @brief Trains both implementations on the same samples and returns the largest difference in their predictions, relative to the target range */
+static double learningError(int k, int m, bool coupled, float max_period)
+{
+    ReferenceFourierFunction reference;
+    reference.initialiseFunction(k, m, coupled, 0.1, max_period);
+    FourierFunction function;
+    function.initialiseFunction(k, m, coupled, 0.1, max_period);
+
+    for(int sample = 0; sample<300; sample++){
+        std::vector<float> input = randomInput(m, max_period);
+        float target = sin(input[0]) + (m > 1 ? 0.5f*cos(input[1]) : 0.0f);
+        reference.learn(input, target, 2);
+        function.learn(input, target, 2);
+    }
+    double worst = 0;
+    for(int sample = 0; sample<100; sample++){
+        std::vector<float> input = randomInput(m, max_period);
+        worst = std::max(worst, fabs(reference.evaluate(input) - function.evaluate(input))/1.5);
+    }
+    return worst;
+}
+
+/*! @brief Returns the time in us of evaluating num_actions functions (as getValues does), and of one learning update of each */
+template <typename Function>
+static void timeFunctions(int k, int m, bool coupled, int num_actions, int repeats, double& evaluate_us, double& learn_us)
+{
+    std::vector<Function> functions(num_actions);
+    for(int a = 0; a<num_actions; a++)
+        functions[a].initialiseFunction(k, m, coupled, 0.01, 10);
+    std::vector<std::vector<float> > inputs;
+    for(int r = 0; r<repeats; r++)
+        inputs.push_back(randomInput(m, 10));
+
+    volatile float sink = 0;
+    double start = now();
+    for(int r = 0; r<repeats; r++)
+        for(int a = 0; a<num_actions; a++)
+            sink += functions[a].evaluate(inputs[r]);
+    evaluate_us = 1e6*(now() - start)/repeats;
+
+    start = now();
+    for(int r = 0; r<repeats; r++)
+        for(int a = 0; a<num_actions; a++)
+            functions[a].learn(inputs[r], 1.0f, 1);
+    learn_us = 1e6*(now() - start)/repeats;
+}
+
+/*! @brief Returns the time in us of FourierApproximator::getValues and of a one observation learning episode, which share phi between the actions */
+static void timeApproximator(int k, int m, bool coupled, int num_actions, int repeats, double& evaluate_us, double& learn_us)
+{
+    FourierApproximator approximator(coupled, 0.01);
+    approximator.initialiseApproximator(m, num_actions, k, 10);
+    std::vector<std::vector<float> > inputs;
+    for(int r = 0; r<repeats; r++)
+        inputs.push_back(randomInput(m, 10));
+    std::vector<std::vector<float> > values(1, std::vector<float>(num_actions, 1.0f));
+
+    volatile float sink = 0;
+    double start = now();
+    for(int r = 0; r<repeats; r++)
+        sink += approximator.getValues(inputs[r])[0];
+    evaluate_us = 1e6*(now() - start)/repeats;
+
+    start = now();
+    for(int r = 0; r<repeats; r++)
+        approximator.doLearningEpisode(std::vector<std::vector<float> >(1, inputs[r]), values);
+    learn_us = 1e6*(now() - start)/repeats;
+}
+
+int main()
+{
+    srand(42);
+    bool ok = true;
+    const int orders[] = {1, 2, 3, 5, 8};
+    const int max_bases = 100000;
+
+    std::cout << "Accuracy: largest |phi - cos| over 200 inputs, and largest prediction difference after 300 updates" << std::endl;
+    std::cout << std::setw(8) << "coupled" << std::setw(4) << "k" << std::setw(4) << "m" << std::setw(10) << "bases";
+    std::cout << std::setw(14) << "phi error" << std::setw(14) << "learn error" << std::endl;
+    for(int coupled = 1; coupled >= 0; coupled--){
+        for(int oi = 0; oi<5; oi++){
+            for(int m = 1; m<=6; m++){
+                int k = orders[oi];
+                double bases = coupled ? pow(k + 1.0, m) : m*(k + 1.0);
+                if(bases > max_bases)
+                    continue;
+                double phi_error = basisError(k, m, coupled, 10);
+                double learn_error = bases <= 5000 ? learningError(k, m, coupled, 10) : 0;
+                bool passed = phi_error < 1e-5 and learn_error < 1e-3;
+                ok = ok and passed;
+                std::cout << std::setw(8) << coupled << std::setw(4) << k << std::setw(4) << m << std::setw(10) << bases;
+                std::cout << std::setw(14) << phi_error;
+                if(bases <= 5000)
+                    std::cout << std::setw(14) << learn_error;
+                else
+                    std::cout << std::setw(14) << "-";      //too slow to train the old implementation
+                std::cout << (passed ? "" : "  FAIL") << std::endl;
+            }
+        }
+    }
+
+    const int num_actions = 4;
+    std::cout << std::endl << "Time in us per observation for " << num_actions << " actions (fully coupled)" << std::endl;
+    std::cout << std::setw(4) << "k" << std::setw(4) << "m" << std::setw(10) << "bases";
+    std::cout << std::setw(14) << "old evaluate" << std::setw(14) << "evaluate" << std::setw(14) << "getValues";
+    std::cout << std::setw(14) << "old learn" << std::setw(14) << "learn" << std::setw(14) << "episode" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for(int oi = 0; oi<5; oi++){
+        for(int m = 1; m<=5; m++){
+            int k = orders[oi];
+            double bases = pow(k + 1.0, m);
+            if(bases < 8 or bases > 20000)
+                continue;
+            int repeats = std::max(3, static_cast<int>(200000/bases));
+            double old_evaluate, old_learn, evaluate, learn, values, episode;
+            timeFunctions<ReferenceFourierFunction>(k, m, true, num_actions, std::max(1, repeats/20), old_evaluate, old_learn);
+            timeFunctions<FourierFunction>(k, m, true, num_actions, repeats, evaluate, learn);
+            timeApproximator(k, m, true, num_actions, repeats, values, episode);
+            std::cout << std::setw(4) << k << std::setw(4) << m << std::setw(10) << static_cast<int>(bases);
+            std::cout << std::setw(14) << old_evaluate << std::setw(14) << evaluate << std::setw(14) << values;
+            std::cout << std::setw(14) << old_learn << std::setw(14) << learn << std::setw(14) << episode << std::endl;
+        }
+    }
+
+    std::cout << (ok ? "All accuracy checks passed" : "Accuracy checks FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
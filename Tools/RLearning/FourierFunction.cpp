@@ -22,7 +22,6 @@
 #include "FourierFunction.h"
 
 FourierFunction::FourierFunction(){
- PI= atan(1)*4;
 }
 /*! @brief Initialises fourier function. Must be called before using a new function. If function loaded, this method should NOT be called as it will reset parameters and learnt function.
     @param  int order_k_ = order of fourier approximator, determines the highest frequency wave in the function pool.
@@ -38,11 +37,11 @@ void FourierFunction::initialiseFunction(int order_k_, int num_inputs_m_, bool f
     order_k = order_k_;
     num_inputs_m = num_inputs_m_;
     fully_coupled = fully_coupled_;
-    generateConstants();
-    number_of_basis_functions_n = basis_constants_c.size();
+    max_period = max_period_;
+    basis.initialise(order_k, num_inputs_m, fully_coupled, max_period);
+    number_of_basis_functions_n = basis.size();
     learning_rate_alpha = learning_rate_alpha_;
     weights_w = std::vector<float>(number_of_basis_functions_n,0);
-    max_period = max_period_;
 }
 /*! @brief Returns string of info about function which can then be saved to disk and reloaded using loadSaveData(..)
 */
@@ -79,8 +78,8 @@ void FourierFunction::loadSaveData(std::string save_data_)
 
     save_data >> learning_rate_alpha;
 
-    generateConstants();
-    number_of_basis_functions_n = basis_constants_c.size();
+    basis.initialise(order_k, num_inputs_m, fully_coupled, max_period);
+    number_of_basis_functions_n = basis.size();
     weights_w = std::vector<float>(number_of_basis_functions_n,0);
 
     for (unsigned int i = 0; i<weights_w.size();i++){
@@ -93,36 +92,38 @@ void FourierFunction::loadSaveData(std::string save_data_)
 */
 float FourierFunction::evaluate(std::vector<float> const& input)
 {
-    float result = 0;
-    for(int i = 0; i<number_of_basis_functions_n;i++){
-        result+= weights_w[i]*cos(PI*dotProd(basis_constants_c[i],input)/max_period);
-
-    }
-    return result;
+    basis.computeFeatures(input, phi);
+    return evaluateFeatures(&phi[0]);
+}
+/*! @brief Evaluates the function given the features of a point, as computed by this function's basis.
+    Functions over the same basis can share one feature vector.
+*/
+float FourierFunction::evaluateFeatures(const float* features) const
+{
+    return FourierBasis::dotProd(&weights_w[0], features, number_of_basis_functions_n);
 }
 /*! @brief Moves the function closer the desired value at the given sample points using gradient descent update rule.
     @param input = sample point
            value = desired value
            iterations = number of learning iterations to take
 */
-void FourierFunction::learn(std::vector<float> input, float value, int iterations)
+void FourierFunction::learn(std::vector<float> const& input, float value, int iterations)
+{
+    basis.computeFeatures(input, phi);
+    learnFeatures(&phi[0], FourierBasis::normSquared(&phi[0], number_of_basis_functions_n), value, iterations);
+}
+/*! @brief The learning update given the features of the sample point and their squared norm, so that functions over the same basis
+    can share them. The features do not change between iterations, so only the error is recalculated.
+*/
+void FourierFunction::learnFeatures(const float* features, float norm_squared, float value, int iterations)
 {
+    if(norm_squared==0)
+        return;
     for(int i = 0; i<iterations; i++){
-        float delta = value - evaluate(input);
-        //calculate the phi std::vector and its norm for learning:
-        std::vector<float> phi;
-        for(int j = 0; j<number_of_basis_functions_n;j++){
-            phi.push_back(cos(PI*dotProd(basis_constants_c[j],input)/max_period));
-        }
-        float norm_squared = 0;
-        for(unsigned int j = 0; j<phi.size();j++){
-            norm_squared+=phi[j]*phi[j];
+        float step = learning_rate_alpha*(value - evaluateFeatures(features))/norm_squared;
+        for (int j = 0; j< number_of_basis_functions_n; j++){
+            weights_w[j]+=step*features[j];
         }
-
-        if(norm_squared!=0)
-            for (int j = 0; j< number_of_basis_functions_n; j++){
-                weights_w[j]+=learning_rate_alpha*phi[j]*delta/norm_squared;
-            }
     }
 }
 
@@ -130,7 +131,7 @@ void FourierFunction::learn(std::vector<float> input, float value, int iteration
 
 /*! @brief Calculates the dot product of two vectors
 */
-float FourierFunction::dotProd(std::vector<float> x, std::vector<float> y)
+float FourierFunction::dotProd(std::vector<float> const& x, std::vector<float> const& y)
 {
     float result = 0;
     for (unsigned int i = 0; i<x.size(); i++){
@@ -138,41 +139,3 @@ float FourierFunction::dotProd(std::vector<float> x, std::vector<float> y)
     }
     return result;
 }
-/*! @brief Generates the constant coefficients for the inputs to the function.
-*/
-void FourierFunction::generateConstants()
-{
-    basis_constants_c.clear();
-
-    if(fully_coupled){
-        std::vector<float> constant(num_inputs_m,0);//Create initial vector of zeros
-        int num = (int)pow((double)order_k+1,(double)num_inputs_m);
-        for(int i = 0; i<num;i++){
-            basis_constants_c.push_back(constant);
-            getNextConstant(constant);//Iterates as a base k+1 counter
-        }
-    }else{
-        //Uncoupled: simply generate linearly independant constant vectors
-        for(int i = 0; i<num_inputs_m;i++){
-            for(int j = 0; j<=order_k;j++){
-                std::vector<float> constant(num_inputs_m,0);
-                constant[i] = j;
-                basis_constants_c.push_back(constant);
-            }
-        }
-    }
-}
-/*! @brief Iterates a length n vector as if it is a base k+1 number, with each entry representing one digit.
-*/
-void FourierFunction::getNextConstant(std::vector<float> &c)
-{
-
-    //Increments through number of length m in base k+1
-    c[0]=((int)c[0]+1)%(order_k+1);//k is included by convention
-    unsigned int i = 0;
-    while((int)c[i]==0){
-        i++;
-        if(i>=c.size()) break;
-        c[i]=((int)c[i]+1)%(order_k+1);
-    }
-}
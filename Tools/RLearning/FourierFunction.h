@@ -31,18 +31,24 @@
 #include <vector>
 #include <iostream>
 
+#include "FourierBasis.h"
+
 class FourierFunction
 {
 public:
     FourierFunction();
     void initialiseFunction(int order_k_, int num_inputs_m_, bool fully_coupled_, float learning_rate_alpha_, float max_period_);
     float evaluate(std::vector<float> const& input);
+    float evaluateFeatures(const float* features) const;
+
+    void learn(std::vector<float> const& input, float value, int iterations = 1);
+    void learnFeatures(const float* features, float norm_squared, float value, int iterations = 1);
 
-    void learn(std::vector<float> input, float value, int iterations = 1);
+    FourierBasis& getBasis() {return basis;}
 
     std::string getSaveData();
     void loadSaveData(std::string save_data);
-    float dotProd(std::vector<float> x, std::vector<float> y);
+    float dotProd(std::vector<float> const& x, std::vector<float> const& y);
 
 
 private:
@@ -57,11 +63,8 @@ private:
     float learning_rate_alpha;
 
     std::vector<float> weights_w;
-    std::vector<std::vector<float> > basis_constants_c;
-
-    float PI;
-    void generateConstants();
-    void getNextConstant(std::vector<float> &c);
+    FourierBasis basis;
+    std::vector<float> phi;     //the features of the last input, kept to reuse the storage
 };
 
 #endif // FOURIERFUNCTION_H
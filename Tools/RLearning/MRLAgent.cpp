@@ -197,11 +197,12 @@ float MRLAgent::wundtFunction(float N){
 
 }
 
-/*! @brief Gets the map from the dictionary approximator.
+/*! @brief Gets the table from the dictionary approximator, or NULL if the agent's function approximator is not a DictionaryApproximator.
  */
-std::map<std::string, float>* MRLAgent::getMap()
+DictionaryTable* MRLAgent::getTable()
 {
-	return ((DictionaryApproximator*) FunctionApproximator)->getMap();
+	DictionaryApproximator* dictionary = dynamic_cast<DictionaryApproximator*>(FunctionApproximator);
+	return dictionary ? dictionary->getTable() : NULL;
 }
 
  /*! @brief Main loop for MRLAgent. Returns the agents decision as an integer as to which action to take. Also performs the learning for the second last state-action pair.
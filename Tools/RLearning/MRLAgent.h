@@ -58,7 +58,7 @@ public:
     void saveMRLAgent(std::string agentName);
     void loadMRLAgent(std::string agentName);
 
-    std::map<std::string,float>* getMap();
+    DictionaryTable* getTable();
     ApproximatorInterface* expectation_map;
 
     float average_novelty;
@@ -23,9 +23,11 @@ ENDIF()
 SET (YOUR_SRCS
 ApproximatorInterface.h
 DictionaryApproximator.h
+DictionaryTable.h
 MRLAgent.h
 RLAgent.h
 DictionaryApproximator.cpp
+DictionaryTable.cpp
 MRLAgent.cpp
 RLAgent.cpp
 
@@ -33,11 +35,13 @@ RLearningInterface.h
 
 FourierApproximator.h
 FourierFunction.h
+FourierBasis.h
 LinearApproximator.h
 DictionaryRLAgent.h
 
 FourierApproximator.cpp
 FourierFunction.cpp
+FourierBasis.cpp
 LinearApproximator.cpp
 DictionaryRLAgent.cpp
 
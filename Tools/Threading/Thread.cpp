@@ -20,6 +20,7 @@
  */
 
 #include "Thread.h"
+#include "Tools/Profiling/Tracer.h"
 #include "debug.h"
 #include "debugverbositythreading.h"
 
@@ -29,7 +30,7 @@
     @param name the name of the thread (used entirely for debug purposes)
     @param priority the priority of the thread. If non-zero the thread will be a bona fide real-time thread.
  */
-Thread::Thread(std::string name, unsigned char priority) : m_name(name), running(false), m_priority(priority)
+Thread::Thread(std::string name, unsigned char priority) : m_name(name), running(false), m_priority(priority), m_joined(false)
 {
     #if DEBUG_THREADING_VERBOSITY > 2
         debug << "Thread::Thread(" << m_name << ", " << static_cast<int>(m_priority) << ")" << std::endl;
@@ -93,7 +94,10 @@ int Thread::start()
  */
 int Thread::join()
 {
-    return pthread_join(m_pthread, NULL); 
+    int err = pthread_join(m_pthread, NULL);
+    if (err == 0)
+        m_joined = true;
+    return err;
 }
 
 /*! @brief Cancels the threads execution, and sets the running flag to false
@@ -103,14 +107,16 @@ void Thread::stop()
     #if DEBUG_THREADING_VERBOSITY > 0
         debug << "Thread::stop(): " << m_name << std::endl;
     #endif
-    pthread_cancel(m_pthread);
-	running = false;
+    if (not m_joined)
+        pthread_cancel(m_pthread);
+    running = false;
 }
 
 /*! @brief The static wrapper function to call the underlying run function.
  */
 void* Thread::runThread(void* thread)
 {
+    Tracer::setThreadName(reinterpret_cast<Thread*>(thread)->m_name.c_str());
 	reinterpret_cast<Thread*>(thread)->run();
     pthread_exit(NULL);
     return thread;
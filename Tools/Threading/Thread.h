@@ -53,5 +53,6 @@ class Thread
         const unsigned char m_priority;         //!< the priority of the thread. A priority of zero means this thread is not real-time
     private:
         pthread_t m_pthread;                    //!< the underlying pthread instance
+        bool m_joined;                          //!< true if the thread has been joined, and hence can not be cancelled
 };
 #endif
@@ -1,4 +1,8 @@
+#ifndef RANSAC_H
+#define RANSAC_H
+
 #include <vector>
+#include <stdlib.h>
 //#include "Tools/Math/LSFittedLine.h"
 
 using std::vector;
@@ -33,6 +37,28 @@ namespace RANSAC
 
     template<class Model, typename DataPoint>
     Model generateRandomModel(const std::vector<DataPoint>& points);
+
+    //! @brief The calling thread's seed for selecting points, or NULL if it uses rand().
+    inline unsigned int*& threadSeed()
+    {
+        static __thread unsigned int* seed = NULL;
+        return seed;
+    }
+
+    /*! @brief Gives the calling thread its own sequence of selections, so that its models don't depend on
+               what other threads have drawn from rand(). Pass NULL to go back to rand().
+        @param seed The seed, which must stay valid while it is in use.
+    */
+    inline void setThreadSeed(unsigned int* seed) {threadSeed() = seed;}
+
+    //! @brief Returns a random number for selecting points.
+    inline int nextRandom()
+    {
+        unsigned int* seed = threadSeed();
+        return seed ? rand_r(seed) : rand();
+    }
 }
 
 #include "ransac.template"
+
+#endif // RANSAC_H
@@ -0,0 +1,511 @@
+/*! @file BallCandidateBenchmark.cpp
+    @brief Times the ball detection of BallDetectorShannon on cluttered frames, with the single geometric mean
+           candidate it used to evaluate and with the BallCandidateEvaluator cascade, and checks what each finds.
+
+    The frames are read from the image streams given as arguments (image.strm, as recorded on the robot), or, without
+    arguments, generated: a field seen from a robot's camera with the ball in most frames, and clutter that grows
+    through the frames up to five orange jerseys and forty field edge artifacts. The orange segments are found on
+    scanlines spaced as in Config/Darwin/VisionOptions.cfg, and the green horizon is the upper convex hull of the first
+    run of green down each green horizon scan. Distances come from a flat ground pinhole camera; the generated frames
+    use the same camera, so their balls are the size a ball standing there would be. A generated ball more than a
+    quarter hidden behind a robot may or may not be found, so that frame is not scored. Segment finding is not timed.
+
+    Build and run from this directory with
+    @code
+        make BallCandidateBenchmark && ./BallCandidateBenchmark [image.strm ...]
+    @endcode
+    It reads Config/Darwin/VisionOptions.cfg and Config/Darwin/default.lut. On generated frames it returns non-zero if
+    the cascade finds fewer of the balls than the single candidate, misses more than one in ten, or finds more balls
+    where there are none than the single candidate.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ballcandidateevaluator.h"
+#include "Vision/visionconstants.h"
+
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/mean.hpp>
+#include <boost/accumulators/statistics/variance.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include <time.h>
+
+using namespace boost::accumulators;
+
+static const int WIDTH = 320;
+static const int HEIGHT = 240;
+static const double FOCAL_LENGTH = 300;        // pixels
+static const double CAMERA_HEIGHT = 45;        // cm
+static const double HORIZON_ROW = 20;          // the row level with the camera
+static const int REPEATS = 5;                  // each frame is timed this many times, and the fastest kept
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+//! The distance along the ray to the ground at the given row.
+static double groundDistance(double row)
+{
+    if(row <= HORIZON_ROW)
+        return 0;
+    double d = CAMERA_HEIGHT*FOCAL_LENGTH/(row - HORIZON_ROW);
+    return std::sqrt(d*d + CAMERA_HEIGHT*CAMERA_HEIGHT);
+}
+
+class PinholeBallCandidateEvaluator : public BallCandidateEvaluator
+{
+protected:
+    double distanceToPoint(const Point& pixel) const
+    {
+        return groundDistance(pixel.y);
+    }
+
+    double distanceFromWidth(double diameter) const
+    {
+        return VisionConstants::get().BALL_WIDTH*FOCAL_LENGTH/diameter;
+    }
+};
+
+//! BallDetectorShannon as it was: the geometric mean of the orange segment ends within one standard deviation
+static bool referenceRun(const NUImage& img, const LookUpTable& lut, const GreenHorizon& green_horizon,
+                         const std::vector<ColourSegment>& h_segments, const std::vector<ColourSegment>& v_segments,
+                         Point& center, double& diameter)
+{
+    std::list<Point> edges;
+    const std::vector<ColourSegment>* all[2] = {&h_segments, &v_segments};
+    for(int s=0; s<2; s++) {
+        for(size_t i=0; i<all[s]->size(); i++) {
+            if(green_horizon.isBelowHorizon((*all[s])[i].getStart()))
+                edges.push_back((*all[s])[i].getStart());
+            if(green_horizon.isBelowHorizon((*all[s])[i].getEnd()))
+                edges.push_back((*all[s])[i].getEnd());
+        }
+    }
+
+    int height = img.getHeight();
+    int width = img.getWidth();
+
+    Point avg, stddev;
+    Vector2<accumulator_set<double, stats<tag::mean, tag::variance> > > acc;
+    for(std::list<Point>::iterator it = edges.begin(); it != edges.end(); it++) {
+        acc.x(it->x);
+        acc.y(it->y);
+    }
+    avg.x = mean(acc.x);
+    avg.y = mean(acc.y);
+    stddev.x = std::sqrt(variance(acc.x));
+    stddev.y = std::sqrt(variance(acc.y));
+
+    std::list<Point>::iterator it = edges.begin();
+    while (it != edges.end()) {
+        if (std::abs(it->x - avg.x) > stddev.x || std::abs(it->y - avg.y) > stddev.y)
+            it = edges.erase(it);
+        else
+            it++;
+    }
+    if(edges.empty())
+        return false;
+
+    Vector2<long double> pos(1.0, 1.0);
+    long double root_order = 1.0 / edges.size();
+    for(it = edges.begin(); it != edges.end(); it++) {
+        pos.x *= std::pow(it->x, root_order);
+        pos.y *= std::pow(it->y, root_order);
+    }
+    pos.x = std::min(pos.x, width - 1.0L);
+    pos.y = std::min(pos.y, height - 1.0L);
+
+    const VisionConstants& constants = VisionConstants::get();
+    int top, bottom, left, right;
+    int not_orange_count = 0;
+    for(top = pos.y; top > 0 && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; top--)
+        not_orange_count = lut.classifyPixel(img((int)pos.x, top)) != orange ? not_orange_count + 1 : 0;
+    top += not_orange_count;
+    not_orange_count = 0;
+    for(bottom = pos.y; bottom < height && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; bottom++)
+        not_orange_count = lut.classifyPixel(img((int)pos.x, bottom)) != orange ? not_orange_count + 1 : 0;
+    bottom -= not_orange_count;
+    not_orange_count = 0;
+    for(left = pos.x; left > 0 && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; left--)
+        not_orange_count = lut.classifyPixel(img(left, (int)pos.y)) != orange ? not_orange_count + 1 : 0;
+    left += not_orange_count;
+    not_orange_count = 0;
+    for(right = pos.x; right < width && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; right++)
+        not_orange_count = lut.classifyPixel(img(right, (int)pos.y)) != orange ? not_orange_count + 1 : 0;
+    right -= not_orange_count;
+
+    bool top_edge = false, bottom_edge = false, left_edge = false, right_edge = false;
+    for (int i = left; i > left - constants.BALL_EDGE_THRESHOLD && i >= 0; i--)
+        if (lut.classifyPixel(img(i, (int)pos.y)) == green) { left_edge = true; break; }
+    for (int i = right; i < right + constants.BALL_EDGE_THRESHOLD && i < width; i++)
+        if (lut.classifyPixel(img(i, (int)pos.y)) == green) { right_edge = true; break; }
+    for (int i = bottom; i < bottom + constants.BALL_EDGE_THRESHOLD && i < height; i++)
+        if (lut.classifyPixel(img((int)pos.x, i)) == green) { bottom_edge = true; break; }
+    for (int i = top; i > top - constants.BALL_EDGE_THRESHOLD && i >= 0; i--)
+        if (lut.classifyPixel(img((int)pos.x, i)) == green) { top_edge = true; break; }
+    top_edge = true;
+
+    if (left_edge && right_edge && top_edge && !bottom_edge)
+        center = Point((right+left)/2, std::min((top+(top+right-left))/2, height-1));
+    else if (left_edge && right_edge && !top_edge && bottom_edge)
+        center = Point((right+left)/2, std::max((bottom+(bottom-right+left))/2, 0));
+    else if (left_edge && !right_edge && top_edge && bottom_edge)
+        center = Point(std::min((left+(left+bottom-top))/2, width-1),(top+bottom)/2);
+    else if (!left_edge && right_edge && top_edge && bottom_edge)
+        center = Point(std::max((right+(right-bottom+top))/2, 0),(top+bottom)/2);
+    else
+        center = Point((right+left)/2,(top+bottom)/2);
+
+    if (center == Point(1, 1) || bottom <= top || right <= left)
+        return false;
+
+    int count = 0;
+    double min_dimension = std::min(right-left, bottom-top);
+    int box_left = std::max(center.x - min_dimension/2, 0.0);
+    int box_right = std::min(center.x + min_dimension/2, width-1.0);
+    int box_top = std::max(center.y - min_dimension/2, 0.0);
+    int box_bottom = std::min(center.y + min_dimension/2, height-1.0);
+    for (int i = box_left; i < box_right; i++)
+        for (int j = box_top; j < box_bottom; j++)
+            if (lut.classifyPixel(img(i, j)) == orange)
+                count++;
+    if (count/(min_dimension*min_dimension) < constants.BALL_MIN_PERCENT_ORANGE)
+        return false;
+
+    diameter = std::max(right-left, bottom-top);
+    // Ball::check's size throwout, which the blackboard's ball would fail
+    return !(constants.THROWOUT_SMALL_BALLS && diameter < constants.MIN_BALL_DIAMETER_PIXELS);
+}
+
+//! A frame, its segments, and where its ball is, if it is known
+struct Frame
+{
+    NUImage image;
+    GreenHorizon green_horizon;
+    std::vector<ColourSegment> h_segments;
+    std::vector<ColourSegment> v_segments;
+    bool generated;
+    bool has_ball;
+    bool scored;                // whether what is found is counted
+    Point ball;
+    double ball_diameter;
+};
+
+//! A pixel of the given colour well inside its region of the LUT
+static Pixel findPixel(const LookUpTable& lut, Colour colour)
+{
+    Pixel p, q;
+    p.yCbCrPadding = q.yCbCrPadding = 0;
+    for(int y=8; y<248; y+=2) {
+        for(int cb=8; cb<248; cb+=2) {
+            for(int cr=8; cr<248; cr+=2) {
+                p.y = y; p.cb = cb; p.cr = cr;
+                if(lut.classifyPixel(p) != colour)
+                    continue;
+                bool inside = true;
+                for(int d=-6; d<=6 && inside; d+=12) {
+                    q = p; q.y += d; inside = inside && lut.classifyPixel(q) == colour;
+                    q = p; q.cb += d; inside = inside && lut.classifyPixel(q) == colour;
+                    q = p; q.cr += d; inside = inside && lut.classifyPixel(q) == colour;
+                }
+                if(inside)
+                    return p;
+            }
+        }
+    }
+    std::cout << "No " << getColourName(colour) << " in the LUT" << std::endl;
+    exit(1);
+}
+
+static int randomInt(int low, int high)
+{
+    return low + rand() % (high - low + 1);
+}
+
+static void fillRect(NUImage& img, int left, int top, int right, int bottom, const Pixel& p)
+{
+    for(int y=std::max(top, 0); y<=std::min(bottom, HEIGHT-1); y++)
+        for(int x=std::max(left, 0); x<=std::min(right, WIDTH-1); x++)
+            img.setPixel(x, y, p);
+}
+
+//! The field, up to jerseys robots in orange and artifacts orange specks along the field edge
+static void generateFrame(Frame& frame, int jerseys, int artifacts, bool ball, const Pixel* colours)
+{
+    const Pixel& background = colours[0];
+    const Pixel& grass = colours[1];
+    const Pixel& line = colours[2];
+    const Pixel& ball_orange = colours[3];
+    const Pixel& robot = colours[4];
+    frame.image.copyFromExisting(NUImage(WIDTH, HEIGHT, true));
+
+    // the field's edge undulates a little
+    int edge = randomInt(40, 70);
+    for(int x=0; x<WIDTH; x++) {
+        int edge_x = edge + 3*std::sin(x*0.05);
+        fillRect(frame.image, x, 0, x, edge_x - 1, background);
+        fillRect(frame.image, x, edge_x, x, HEIGHT - 1, grass);
+    }
+    int line_row = randomInt(edge + 20, HEIGHT - 20);
+    fillRect(frame.image, 0, line_row, WIDTH - 1, line_row + 2, line);
+    int line_col = randomInt(20, WIDTH - 20);
+    fillRect(frame.image, line_col, edge, line_col + 2, HEIGHT - 1, line);
+
+    // specks where the field meets the background, from reflections and the edge of the carpet
+    for(int i=0; i<artifacts; i++) {
+        int x = randomInt(0, WIDTH - 1);
+        int y = edge + 3*std::sin(x*0.05) + randomInt(-2, 6);
+        int size = randomInt(0, 1);
+        fillRect(frame.image, x, y, x + size, y + size, ball_orange);
+    }
+
+    // robots and the ball, far ones first; each robot has an orange jersey 20 to 35cm above its feet
+    std::vector<int> feet(jerseys);
+    for(int i=0; i<jerseys; i++)
+        feet[i] = randomInt(edge + 15, HEIGHT + 40);
+    std::sort(feet.begin(), feet.end());
+    int base = ball ? randomInt(edge + 25, HEIGHT - 1) : HEIGHT + 100;
+    double r = VisionConstants::get().BALL_WIDTH*FOCAL_LENGTH/groundDistance(base)/2;
+    frame.ball = Point(randomInt(r, WIDTH - 1 - r), base - r);
+    frame.ball_diameter = 2*r;
+    std::vector<Point> disc;
+    for(int y=frame.ball.y - r; y<=frame.ball.y + r; y++)
+        for(int x=frame.ball.x - r; x<=frame.ball.x + r; x++)
+            if((x - frame.ball.x)*(x - frame.ball.x) + (y - frame.ball.y)*(y - frame.ball.y) <= r*r && x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT)
+                disc.push_back(Point(x, y));
+
+    size_t hidden = 0;
+    bool drawn = !ball;
+    for(int i=0; i<=jerseys; i++) {
+        if(!drawn && (i == jerseys || feet[i] > base)) {
+            for(size_t j=0; j<disc.size(); j++)
+                frame.image.setPixel(disc[j].x, disc[j].y, ball_orange);
+            drawn = true;
+        }
+        if(i == jerseys)
+            break;
+        double scale = FOCAL_LENGTH/groundDistance(feet[i]);
+        int x = randomInt(0, WIDTH - 1);
+        int half_width = 10*scale;
+        int top = feet[i] - 50*scale;
+        fillRect(frame.image, x - half_width, top, x + half_width, feet[i], robot);
+        fillRect(frame.image, x - half_width, feet[i] - 35*scale, x + half_width, feet[i] - 20*scale, ball_orange);
+        if(drawn && ball) {
+            for(size_t j=0; j<disc.size(); j++)
+                if(disc[j].x >= x - half_width && disc[j].x <= x + half_width && disc[j].y >= top && disc[j].y <= feet[i]) {
+                    disc[j] = disc.back();
+                    disc.pop_back();
+                    hidden++;
+                    j--;
+                }
+        }
+    }
+
+    // a ball that is partly hidden may or may not be found, so it is not scored
+    frame.has_ball = ball && hidden < 0.25*(disc.size() + hidden);
+    frame.scored = !ball || frame.has_ball || disc.empty();
+}
+
+//! The runs of orange along a scanline
+static void appendRuns(const NUImage& img, const LookUpTable& lut, Point start, Point step, int length, std::vector<ColourSegment>& segments)
+{
+    int run = -1;
+    for(int i=0; i<=length; i++) {
+        Point p = start + step*i;
+        bool is_orange = i < length && lut.classifyPixel(img((int)p.x, (int)p.y)) == orange;
+        if(is_orange && run < 0)
+            run = i;
+        else if(!is_orange && run >= 0) {
+            segments.push_back(ColourSegment(start + step*run, p - step, orange));
+            run = -1;
+        }
+    }
+}
+
+//! The green horizon and the orange segments, as the vision pipeline would find them before the ball detector
+static void findSegments(Frame& frame, const LookUpTable& lut)
+{
+    const VisionConstants& constants = VisionConstants::get();
+    const NUImage& img = frame.image;
+    int width = img.getWidth();
+    int height = img.getHeight();
+
+    // the upper convex hull of the first green on each scanline, as GreenHorizonCH finds it, so robots are below it
+    std::vector<Point> hull;
+    for(int x=0; x<width; x+=constants.GREEN_HORIZON_SCAN_SPACING) {
+        unsigned int run = 0;
+        int y;
+        for(y=0; y<height && run < constants.GREEN_HORIZON_MIN_GREEN_PIXELS; y++)
+            run = lut.classifyPixel(img(x, y)) == green ? run + 1 : 0;
+        Point p(x, y < height ? y - run : height - 1);
+        while(hull.size() >= 2) {
+            const Point& a = hull[hull.size() - 2];
+            const Point& b = hull.back();
+            if((b.x - a.x)*(p.y - a.y) - (b.y - a.y)*(p.x - a.x) > 0)
+                break;
+            hull.pop_back();
+        }
+        hull.push_back(p);
+    }
+    if(hull.back().x != width - 1)
+        hull.push_back(Point(width - 1, hull.back().y));
+    frame.green_horizon.set(hull, Point(width, height));
+
+    frame.h_segments.clear();
+    frame.v_segments.clear();
+    for(int y=height-1; y>=0; y-=constants.HORIZONTAL_SCANLINE_SPACING)
+        appendRuns(img, lut, Point(0, y), Point(1, 0), width, frame.h_segments);
+    for(int x=0; x<width; x+=constants.VERTICAL_SCANLINE_SPACING) {
+        int top = std::max(0, (int)frame.green_horizon.getYFromX(x));
+        appendRuns(img, lut, Point(x, top), Point(0, 1), height - top, frame.v_segments);
+    }
+}
+
+struct Score
+{
+    int found;
+    int correct;
+    int false_positives;
+    std::vector<double> times;
+};
+
+static bool correct(const Frame& frame, const Point& centre)
+{
+    return frame.has_ball && (centre - frame.ball).abs() < std::max(3.0, 0.3*frame.ball_diameter);
+}
+
+static void report(const char* name, Score& score, int with_ball, int no_ball, bool generated)
+{
+    std::vector<double> times = score.times;
+    std::sort(times.begin(), times.end());
+    double total = 0;
+    for(size_t i=0; i<times.size(); i++)
+        total += times[i];
+    std::cout << name << 1e6*total/times.size() << " us mean, " << 1e6*times[times.size()*99/100] << " us 99th percentile, "
+              << 1e6*times.back() << " us worst";
+    if(generated)
+        std::cout << "; found " << score.correct << " of " << with_ball << " balls, " << score.false_positives << " false positives in "
+                  << no_ball << " frames without one";
+    else
+        std::cout << "; found " << score.found << " balls";
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << std::fixed << std::setprecision(1);
+    VisionConstants::get().loadFromFile("../../../Config/Darwin/VisionOptions.cfg");
+    LookUpTable lut;
+    if(!lut.loadLUTFromFile("../../../Config/Darwin/default.lut"))
+        return 1;
+
+    std::vector<Frame> frames;
+    for(int a=1; a<argc; a++) {
+        std::ifstream file(argv[a], std::ios::binary);
+        while(file.good() && file.peek() != EOF) {
+            Frame frame;
+            try {
+                file >> frame.image;
+            }
+            catch(std::exception&) {
+                break;
+            }
+            frame.generated = false;
+            frame.has_ball = false;
+            frame.scored = false;
+            frames.push_back(frame);
+        }
+    }
+    bool generated = frames.empty();
+    if(generated) {
+        Pixel colours[5] = {findPixel(lut, unclassified), findPixel(lut, green), findPixel(lut, white),
+                            findPixel(lut, orange), findPixel(lut, blue)};
+        srand(1234);
+        // the clutter grows through the frames
+        for(int f=0; f<400; f++) {
+            Frame frame;
+            frame.generated = true;
+            generateFrame(frame, f*6/400, f*41/400, f % 5 != 0, colours);
+            frames.push_back(frame);
+        }
+    }
+
+    PinholeBallCandidateEvaluator evaluator;
+    Score reference = Score(), cascade = Score();
+    int with_ball = 0, no_ball = 0;
+    long candidates = 0, evaluated = 0, rejected_colour = 0, rejected_size = 0, fitted = 0;
+    for(size_t f=0; f<frames.size(); f++) {
+        Frame& frame = frames[f];
+        findSegments(frame, lut);
+        with_ball += frame.scored && frame.has_ball;
+        no_ball += frame.scored && !frame.has_ball;
+
+        Point centre;
+        double diameter;
+        double fastest = 1e9;
+        bool found = false;
+        for(int r=0; r<REPEATS; r++) {
+            double start = now();
+            found = referenceRun(frame.image, lut, frame.green_horizon, frame.h_segments, frame.v_segments, centre, diameter);
+            fastest = std::min(fastest, now() - start);
+        }
+        reference.times.push_back(fastest);
+        reference.found += found;
+        reference.correct += found && frame.scored && correct(frame, centre);
+        reference.false_positives += found && frame.scored && !frame.has_ball;
+
+        fastest = 1e9;
+        for(int r=0; r<REPEATS; r++) {
+            double start = now();
+            found = evaluator.run(frame.image, lut, frame.green_horizon, frame.h_segments, frame.v_segments, centre, diameter);
+            fastest = std::min(fastest, now() - start);
+        }
+        cascade.times.push_back(fastest);
+        cascade.found += found;
+        cascade.correct += found && frame.scored && correct(frame, centre);
+        cascade.false_positives += found && frame.scored && !frame.has_ball;
+
+        candidates += evaluator.getCandidates().size();
+        evaluated += evaluator.getCandidates().size() - evaluator.getCount(BallCandidateEvaluator::NotEvaluated);
+        rejected_colour += evaluator.getCount(BallCandidateEvaluator::RejectedColour);
+        rejected_size += evaluator.getCount(BallCandidateEvaluator::RejectedSize);
+        fitted += evaluator.getCount(BallCandidateEvaluator::RejectedFit) + evaluator.getCount(BallCandidateEvaluator::Fitted);
+    }
+
+    std::cout << frames.size() << (generated ? " generated" : " recorded") << " frames, at most "
+              << VisionConstants::get().BALL_MAX_CANDIDATES << " candidates evaluated per frame" << std::endl;
+    report("single candidate: ", reference, with_ball, no_ball, generated);
+    report("cascade:          ", cascade, with_ball, no_ball, generated);
+    std::cout << "per frame: " << double(candidates)/frames.size() << " candidates, " << double(evaluated)/frames.size()
+              << " evaluated, " << double(rejected_colour)/frames.size() << " rejected on colour, "
+              << double(rejected_size)/frames.size() << " on size, " << double(fitted)/frames.size() << " fitted" << std::endl;
+
+    if(!generated)
+        return 0;
+    bool ok = cascade.correct >= reference.correct && cascade.correct*10 >= with_ball*9 && cascade.false_positives <= reference.false_positives;
+    std::cout << (ok ? "The cascade finds the balls" : "The cascade MISSES balls or finds false ones") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,327 @@
+#include "ballcandidateevaluator.h"
+#include "Vision/visionconstants.h"
+#include "debug.h"
+#include "debugverbosityvision.h"
+
+#include <algorithm>
+
+//! Candidates with more orange, and squarer boxes, are evaluated first.
+static bool higherPrior(const BallCandidateEvaluator::Candidate& a, const BallCandidateEvaluator::Candidate& b)
+{
+    return a.prior > b.prior;
+}
+
+//! The number of scanlines, spaced spacing apart from the first, in [first, last].
+static int scanlinesBetween(int first, int last, int spacing)
+{
+    if(last < 0)
+        return 0;
+    first = std::max(first, 0);
+    return last/spacing - (first + spacing - 1)/spacing + 1;
+}
+
+BallCandidateEvaluator::BallCandidateEvaluator() {}
+
+BallCandidateEvaluator::~BallCandidateEvaluator() {}
+
+bool BallCandidateEvaluator::run(const NUImage& img, const LookUpTable& lut, const GreenHorizon& green_horizon,
+                                 const std::vector<ColourSegment>& h_segments, const std::vector<ColourSegment>& v_segments,
+                                 Point& centre, double& diameter)
+{
+    findCandidates(green_horizon, h_segments, v_segments, img.getHeight());
+
+    m_stages.assign(m_candidates.size(), NotEvaluated);
+    size_t evaluated = std::min(m_candidates.size(), (size_t)std::max(VisionConstants::get().BALL_MAX_CANDIDATES, 0));
+
+    #if VISION_BALL_VERBOSITY > 1
+    debug << "BallCandidateEvaluator::run() - candidates: " << m_candidates.size() << " evaluating: " << evaluated << std::endl;
+    #endif
+
+    for(size_t i=0; i<evaluated; i++) {
+        m_stages[i] = evaluate(m_candidates[i], img, lut, centre, diameter);
+        if(m_stages[i] == Fitted)
+            return true;
+    }
+    return false;
+}
+
+int BallCandidateEvaluator::getCount(Stage stage) const
+{
+    return std::count(m_stages.begin(), m_stages.end(), stage);
+}
+
+/*!
+  @brief Groups the orange segments below the green horizon into candidates and orders them by prior.
+
+  A segment joins a candidate when it is within a scanline spacing of the candidate's box, and
+  candidates that the segment bridges are merged.
+*/
+void BallCandidateEvaluator::findCandidates(const GreenHorizon& green_horizon, const std::vector<ColourSegment>& h_segments, const std::vector<ColourSegment>& v_segments, int height)
+{
+    const VisionConstants& constants = VisionConstants::get();
+    int gap = std::max(constants.HORIZONTAL_SCANLINE_SPACING, constants.VERTICAL_SCANLINE_SPACING);
+
+    m_candidates.clear();
+    for(size_t i=0; i<v_segments.size(); i++)
+        addSegment(v_segments[i], green_horizon, gap);
+    for(size_t i=0; i<h_segments.size(); i++)
+        addSegment(h_segments[i], green_horizon, gap);
+
+    for(size_t i=0; i<m_candidates.size(); i++) {
+        Candidate& c = m_candidates[i];
+        int width = c.right - c.left + 1;
+        int h = c.bottom - c.top + 1;
+        // vertical scanlines are at multiples of their spacing, horizontal ones up from the bottom row
+        c.scanned = scanlinesBetween(c.left, c.right, constants.VERTICAL_SCANLINE_SPACING)*h +
+                    scanlinesBetween(height - 1 - c.bottom, height - 1 - c.top, constants.HORIZONTAL_SCANLINE_SPACING)*width;
+        c.prior = c.orange*double(std::min(width, h))/std::max(width, h);
+    }
+
+    std::sort(m_candidates.begin(), m_candidates.end(), higherPrior);
+}
+
+void BallCandidateEvaluator::addSegment(const ColourSegment& segment, const GreenHorizon& green_horizon, int gap)
+{
+    const Point& start = segment.getStart();
+    const Point& end = segment.getEnd();
+    if(!green_horizon.isBelowHorizon(start) && !green_horizon.isBelowHorizon(end))
+        return;
+
+    int left = std::min(start.x, end.x),
+        right = std::max(start.x, end.x),
+        top = std::min(start.y, end.y),
+        bottom = std::max(start.y, end.y);
+
+    // the most recent candidates are the most likely to be adjacent, since segments come in scan order
+    int joined = -1;
+    for(int i=m_candidates.size()-1; i>=0; i--) {
+        Candidate& c = m_candidates[i];
+        if(left > c.right + gap || right < c.left - gap || top > c.bottom + gap || bottom < c.top - gap)
+            continue;
+
+        if(joined < 0) {
+            c.left = std::min(c.left, left);
+            c.right = std::max(c.right, right);
+            c.top = std::min(c.top, top);
+            c.bottom = std::max(c.bottom, bottom);
+            c.orange += segment.getLength();
+            joined = i;
+        }
+        else {
+            // the segment bridges two candidates
+            Candidate& j = m_candidates[joined];
+            j.left = std::min(j.left, c.left);
+            j.right = std::max(j.right, c.right);
+            j.top = std::min(j.top, c.top);
+            j.bottom = std::max(j.bottom, c.bottom);
+            j.orange += c.orange;
+            if(joined == (int)m_candidates.size() - 1)
+                joined = i;
+            c = m_candidates.back();
+            m_candidates.pop_back();
+        }
+    }
+
+    if(joined < 0) {
+        Candidate c;
+        c.left = left;
+        c.right = right;
+        c.top = top;
+        c.bottom = bottom;
+        c.orange = segment.getLength();
+        c.scanned = 0;
+        c.prior = 0;
+        m_candidates.push_back(c);
+    }
+}
+
+/*!
+  @brief Runs a candidate through the stages, cheapest first.
+  @return The stage it was rejected at, or Fitted.
+*/
+BallCandidateEvaluator::Stage BallCandidateEvaluator::evaluate(const Candidate& candidate, const NUImage& img, const LookUpTable& lut, Point& centre, double& diameter) const
+{
+    const VisionConstants& constants = VisionConstants::get();
+
+    // COLOUR RATIO
+    if(candidate.scanned > 0 && candidate.orange < constants.BALL_MIN_PERCENT_ORANGE*candidate.scanned) {
+        #if VISION_BALL_VERBOSITY > 1
+        debug << "BallCandidateEvaluator::evaluate - candidate thrown out on scanline orange: " << candidate.orange << "/" << candidate.scanned << std::endl;
+        #endif
+        return RejectedColour;
+    }
+
+    // PROJECTED SIZE - a candidate may be smaller than a ball at its base through occlusion, but not much larger
+    double width = std::max(candidate.right - candidate.left, candidate.bottom - candidate.top) + 1;
+    if(!consistentSize(Point((candidate.left + candidate.right)*0.5, candidate.bottom), width))
+        return RejectedSize;
+
+    // EDGE FIT - the fit may grow past the candidate, so its size is checked again
+    if(!fit(candidate, img, lut, centre, diameter) || !consistentSize(Point(centre.x, centre.y + diameter*0.5), diameter))
+        return RejectedFit;
+    return Fitted;
+}
+
+bool BallCandidateEvaluator::consistentSize(const Point& base, double diameter) const
+{
+    double ratio = VisionConstants::get().BALL_MAX_SIZE_RATIO;
+    if(ratio <= 0)
+        return true;
+    double d2p = distanceToPoint(base);
+    double width_dist = distanceFromWidth(diameter);
+    if(d2p > ratio*width_dist) {
+        #if VISION_BALL_VERBOSITY > 1
+        debug << "BallCandidateEvaluator::consistentSize - thrown out on size: d2p: " << d2p << " width_dist: " << width_dist << std::endl;
+        #endif
+        return false;
+    }
+    return true;
+}
+
+/*!
+  @brief Finds the ball's extent by scanning out from the centre of the candidate, compensates for
+  occlusion, and checks the pixel density of orange in the result.
+*/
+bool BallCandidateEvaluator::fit(const Candidate& candidate, const NUImage& img, const LookUpTable& lut, Point& centre, double& diameter) const
+{
+    const VisionConstants& constants = VisionConstants::get();
+    int height = img.getHeight();
+    int width = img.getWidth();
+    Point pos((candidate.left + candidate.right)/2, (candidate.top + candidate.bottom)/2);
+
+    // the scans stay within a scanline gap of the candidate, orange beyond that is another candidate
+    int gap = std::max(constants.HORIZONTAL_SCANLINE_SPACING, constants.VERTICAL_SCANLINE_SPACING);
+    int min_y = std::max(candidate.top - gap, 0),
+        max_y = std::min(candidate.bottom + gap, height - 1),
+        min_x = std::max(candidate.left - gap, 0),
+        max_x = std::min(candidate.right + gap, width - 1);
+
+    // Find ball centre (not occluded)
+    int top = pos.y,
+        bottom = pos.y,
+        left = pos.x,
+        right = pos.x;
+    int not_orange_count = 0;
+
+    // FIND BALL CENTRE (single iteration approach; doesn't deal great with occlusion)
+    for(top = pos.y; top > min_y && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; top--) {
+        if(lut.classifyPixel(img((int)pos.x, top)) != orange)
+            not_orange_count++;
+        else
+            not_orange_count = 0;
+    }
+    top += not_orange_count;
+
+    not_orange_count = 0;
+    for(bottom = pos.y; bottom <= max_y && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; bottom++) {
+        if(lut.classifyPixel(img((int)pos.x, bottom)) != orange)
+            not_orange_count++;
+        else
+            not_orange_count = 0;
+    }
+    bottom -= not_orange_count;
+
+    not_orange_count = 0;
+    for(left = pos.x; left > min_x && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; left--) {
+        if(lut.classifyPixel(img(left, (int)pos.y)) != orange)
+            not_orange_count++;
+        else
+            not_orange_count = 0;
+    }
+    left += not_orange_count;
+
+    not_orange_count = 0;
+    for(right = pos.x; right <= max_x && not_orange_count <= constants.BALL_ORANGE_TOLERANCE; right++) {
+        if(lut.classifyPixel(img(right, (int)pos.y)) != orange)
+            not_orange_count++;
+        else
+            not_orange_count = 0;
+    }
+    right -= not_orange_count;
+
+    #if VISION_BALL_VERBOSITY > 1
+    debug << "BallCandidateEvaluator::fit() - \n\ttop: " << top << " bottom: " << bottom << " left: " << left << " right: " << right << std::endl;
+    #endif
+
+    // CHECK IF POINT IS ON EDGE OF BALL (OR OCCLUDED)
+    // OCCLUSION CHECK / COMPENSATION
+    bool top_edge = false,
+         bottom_edge = false,
+         left_edge = false,
+         right_edge = false;
+
+    for(int i = left; i > left - constants.BALL_EDGE_THRESHOLD && i >= 0; i--) {
+        if(lut.classifyPixel(img(i, (int)pos.y)) == green) {
+            left_edge = true;
+            break;
+        }
+    }
+    for(int i = right; i < right + constants.BALL_EDGE_THRESHOLD && i < width; i++) {
+        if(lut.classifyPixel(img(i, (int)pos.y)) == green) {
+            right_edge = true;
+            break;
+        }
+    }
+    for(int i = bottom; i < bottom + constants.BALL_EDGE_THRESHOLD && i < height; i++) {
+        if(lut.classifyPixel(img((int)pos.x, i)) == green) {
+            bottom_edge = true;
+            break;
+        }
+    }
+    // the top of the ball is assumed to be an edge
+    top_edge = true;
+
+    // DETERMINE CENTRE
+    if (left_edge && right_edge && top_edge && !bottom_edge)        // only bottom occluded
+        centre = Point((right+left)/2, std::min((top+(top+right-left))/2, height-1));
+    else if (left_edge && right_edge && !top_edge && bottom_edge)   // only top occluded
+        centre = Point((right+left)/2, std::max((bottom+(bottom-right+left))/2, 0));
+    else if (left_edge && !right_edge && top_edge && bottom_edge)   // only right occluded
+        centre = Point(std::min((left+(left+bottom-top))/2, width-1),(top+bottom)/2);
+    else if (!left_edge && right_edge && top_edge && bottom_edge)   // only left occluded
+        centre = Point(std::max((right+(right-bottom+top))/2, 0),(top+bottom)/2);
+    else
+        centre = Point((right+left)/2,(top+bottom)/2);
+
+    // CHECK FOR SUCCESS
+    if(centre == Point(1, 1) || bottom <= top || right <= left) {
+        #if VISION_BALL_VERBOSITY > 1
+        debug << "BallCandidateEvaluator::fit - (1,1) ball thrown out" << std::endl;
+        #endif
+        return false;
+    }
+
+    // CHECK FOR PIXEL DENSITY
+    if(constants.BALL_MIN_PERCENT_ORANGE > 0) {
+        int count = 0;
+        double min_dimension = std::min(right-left, bottom-top);
+
+        int box_left = std::max(centre.x - min_dimension/2, 0.0);
+        int box_right = std::min(centre.x + min_dimension/2, width-1.0);
+        int box_top = std::max(centre.y - min_dimension/2, 0.0);
+        int box_bottom = std::min(centre.y + min_dimension/2, height-1.0);
+
+        for(int j = box_top; j < box_bottom; j++) {
+            for(int i = box_left; i < box_right; i++) {
+                if(lut.classifyPixel(img(i, j)) == orange)
+                    count++;
+            }
+        }
+
+        if(count < constants.BALL_MIN_PERCENT_ORANGE*min_dimension*min_dimension) {
+            #if VISION_BALL_VERBOSITY > 1
+            debug << "BallCandidateEvaluator::fit - ball thrown out on percentage contained orange" << std::endl;
+            #endif
+            return false;
+        }
+    }
+
+    diameter = std::max(right-left, bottom-top);
+    if(constants.THROWOUT_SMALL_BALLS && diameter < constants.MIN_BALL_DIAMETER_PIXELS) {
+        #if VISION_BALL_VERBOSITY > 1
+        debug << "BallCandidateEvaluator::fit - ball thrown out: too small" << std::endl;
+        #endif
+        return false;
+    }
+    return true;
+}
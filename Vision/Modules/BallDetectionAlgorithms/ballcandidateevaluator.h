@@ -0,0 +1,101 @@
+/*!
+ * @file ballcandidateevaluator.h
+ * @class BallCandidateEvaluator
+ *
+ * @brief Finds the regions of orange that may be the ball and evaluates them most likely first,
+ * rejecting each as early and as cheaply as possible.
+ *
+ * The orange segments below the green horizon are grouped into candidates, one per patch of
+ * orange. Candidates are ordered by their prior (the orange they contain, weighted by how square
+ * their bounding box is) and at most BALL_MAX_CANDIDATES are evaluated, each through three stages:
+ *  - colour: the proportion of the scanline pixels inside the box that are orange, counted from the
+ *    segments' lengths without reading the image, against BALL_MIN_PERCENT_ORANGE.
+ *  - size: the distance given by the box's width against the distance to its base on the ground.
+ *    A candidate more than BALL_MAX_SIZE_RATIO times the size of a ball standing there (a robot's
+ *    jersey, an orange patch off the field) is rejected.
+ *  - fit: the edge scan, occlusion compensation and pixel density check of the original detector,
+ *    and the MIN_BALL_DIAMETER_PIXELS throwout, so a small patch does not hide the ball behind it.
+ *    The scans stay within a scanline gap of the candidate, and the fitted ball is checked against
+ *    its size again.
+ * Evaluation stops at the first candidate that is fitted, so only the survivors of the cheap
+ * stages pay for reading pixels.
+ *
+ * The distances are given by the derived class, so the evaluator can be run without the
+ * VisionBlackboard (see BallCandidateBenchmark.cpp).
+ */
+
+#ifndef BALLCANDIDATEEVALUATOR_H
+#define BALLCANDIDATEEVALUATOR_H
+
+#include <vector>
+
+#include "Vision/basicvisiontypes.h"
+#include "Vision/VisionTypes/greenhorizon.h"
+#include "Vision/VisionTypes/coloursegment.h"
+#include "Vision/VisionTools/lookuptable.h"
+#include "Infrastructure/NUImage/NUImage.h"
+
+class BallCandidateEvaluator
+{
+public:
+    //! A patch of orange segments that may be the ball.
+    struct Candidate
+    {
+        int left, right, top, bottom;   //! @variable The bounding box of the segments (inclusive).
+        int orange;                     //! @variable The orange pixels in the segments.
+        int scanned;                    //! @variable The scanline pixels inside the bounding box.
+        double prior;                   //! @variable The order of evaluation, highest first.
+    };
+
+    //! The stage a candidate was rejected at, or Fitted.
+    enum Stage {
+        NotEvaluated,
+        RejectedColour,
+        RejectedSize,
+        RejectedFit,
+        Fitted
+    };
+
+    BallCandidateEvaluator();
+    virtual ~BallCandidateEvaluator();
+
+    /*!
+      @brief Finds the candidates in this frame's orange segments and evaluates them.
+      @param centre Set to the centre of the ball if one is found.
+      @param diameter Set to the diameter of the ball in pixels if one is found.
+      @return Whether a ball was found.
+    */
+    bool run(const NUImage& img, const LookUpTable& lut, const GreenHorizon& green_horizon,
+             const std::vector<ColourSegment>& h_segments, const std::vector<ColourSegment>& v_segments,
+             Point& centre, double& diameter);
+
+    //! Returns the candidates of the last run in order of evaluation, including those beyond the cap.
+    const std::vector<Candidate>& getCandidates() const { return m_candidates; }
+    //! Returns the stage each candidate of the last run reached.
+    const std::vector<Stage>& getStages() const { return m_stages; }
+    //! Returns the number of candidates of the last run that reached the given stage.
+    int getCount(Stage stage) const;
+
+protected:
+    /*!
+      @brief The distance to a point on the ground.
+      @param pixel The point in the image.
+      @return The distance in cm, or a value <= 0 if the point is not on the ground.
+    */
+    virtual double distanceToPoint(const Point& pixel) const = 0;
+    //! The distance in cm at which a ball would appear with the given diameter in pixels.
+    virtual double distanceFromWidth(double diameter) const = 0;
+
+private:
+    void findCandidates(const GreenHorizon& green_horizon, const std::vector<ColourSegment>& h_segments, const std::vector<ColourSegment>& v_segments, int height);
+    void addSegment(const ColourSegment& segment, const GreenHorizon& green_horizon, int gap);
+    Stage evaluate(const Candidate& candidate, const NUImage& img, const LookUpTable& lut, Point& centre, double& diameter) const;
+    bool fit(const Candidate& candidate, const NUImage& img, const LookUpTable& lut, Point& centre, double& diameter) const;
+    //! Whether a ball of the given diameter with its base at the given point is at most BALL_MAX_SIZE_RATIO too large.
+    bool consistentSize(const Point& base, double diameter) const;
+
+    std::vector<Candidate> m_candidates;
+    std::vector<Stage> m_stages;
+};
+
+#endif // BALLCANDIDATEEVALUATOR_H
@@ -122,7 +122,7 @@ std::vector<Ball> BallDetectorDave::run()
 
         // FIND BALL CENTRE (single iteration approach; doesn't deal great with occlusion)
 
-        while (top > 0 && not_orange_count <= VisionConstants::BALL_ORANGE_TOLERANCE) {
+        while (top > 0 && not_orange_count <= VisionConstants::get().BALL_ORANGE_TOLERANCE) {
             if (getColourFromIndex(lut.classifyPixel(img((int)x_pos, top))) != orange) {
                 not_orange_count++;
             }
@@ -134,7 +134,7 @@ std::vector<Ball> BallDetectorDave::run()
         top += not_orange_count;
         not_orange_count = 0;
 
-        while (bottom < img.getHeight() && not_orange_count <= VisionConstants::BALL_ORANGE_TOLERANCE) {
+        while (bottom < img.getHeight() && not_orange_count <= VisionConstants::get().BALL_ORANGE_TOLERANCE) {
             if (getColourFromIndex(lut.classifyPixel(img((int)x_pos, bottom))) != orange) {
                 not_orange_count++;
             }
@@ -146,7 +146,7 @@ std::vector<Ball> BallDetectorDave::run()
         bottom -= not_orange_count;
         not_orange_count = 0;
 
-        while (left > 0 && not_orange_count <= VisionConstants::BALL_ORANGE_TOLERANCE) {
+        while (left > 0 && not_orange_count <= VisionConstants::get().BALL_ORANGE_TOLERANCE) {
             if (getColourFromIndex(lut.classifyPixel(img(left, (int)y_pos))) != orange) {
                 not_orange_count++;
             }
@@ -158,7 +158,7 @@ std::vector<Ball> BallDetectorDave::run()
         left += not_orange_count;
         not_orange_count = 0;
 
-        while (right < img.getWidth() && not_orange_count <= VisionConstants::BALL_ORANGE_TOLERANCE) {
+        while (right < img.getWidth() && not_orange_count <= VisionConstants::get().BALL_ORANGE_TOLERANCE) {
             if (getColourFromIndex(lut.classifyPixel(img(right, (int)y_pos))) != orange) {
                 not_orange_count++;
             }
@@ -203,7 +203,7 @@ std::vector<Ball> BallDetectorDave::run()
         // CHECK IF POINT IS ON EDGE OF BALL (OR OCCLUDED)
         // OCCLUSION CHECK / COMPENSATION
 
-        for (int i = left; i > left - VisionConstants::BALL_EDGE_THRESHOLD; i--) {
+        for (int i = left; i > left - VisionConstants::get().BALL_EDGE_THRESHOLD; i--) {
             if (i <= 0)
                 break;
             else if (getColourFromIndex(lut.classifyPixel(img(i, (int)y_pos))) == green) {
@@ -211,7 +211,7 @@ std::vector<Ball> BallDetectorDave::run()
                 break;
             }
         }
-        for (int i = right; i < right + VisionConstants::BALL_EDGE_THRESHOLD; i++) {
+        for (int i = right; i < right + VisionConstants::get().BALL_EDGE_THRESHOLD; i++) {
             if (i >= img.getWidth()-1)
                 break;
             else if (getColourFromIndex(lut.classifyPixel(img(i, (int)y_pos))) == green) {
@@ -219,7 +219,7 @@ std::vector<Ball> BallDetectorDave::run()
                 break;
             }
         }
-        for (int i = bottom; i < bottom + VisionConstants::BALL_EDGE_THRESHOLD; i++) {
+        for (int i = bottom; i < bottom + VisionConstants::get().BALL_EDGE_THRESHOLD; i++) {
             if (i >= img.getHeight()-1)
                 break;
             else if (getColourFromIndex(lut.classifyPixel(img((int)x_pos, i))) == green) {
@@ -227,7 +227,7 @@ std::vector<Ball> BallDetectorDave::run()
                 break;
             }
         }
-        for (int i = top; i > top - VisionConstants::BALL_EDGE_THRESHOLD; i--) {
+        for (int i = top; i > top - VisionConstants::get().BALL_EDGE_THRESHOLD; i--) {
             if (i <= 0)
                 break;
             else if (getColourFromIndex(lut.classifyPixel(img((int)x_pos, i))) == green) {
@@ -290,7 +290,7 @@ std::vector<Ball> BallDetectorDave::run()
             }
             //std::cout << "PERCENT ORANGE: " << float(count)/((min*2)*(min*2)) << std::endl;
 
-            if (count/((min*2.0)*(min*2.0)) >= VisionConstants::BALL_MIN_PERCENT_ORANGE) {
+            if (count/((min*2.0)*(min*2.0)) >= VisionConstants::get().BALL_MIN_PERCENT_ORANGE) {
                 balls.push_back(Ball(center, std::max((right-left), (bottom-top))));
             }
             else {
@@ -13,19 +13,24 @@
 #include "Vision/VisionTypes/coloursegment.h"
 #include "Vision/VisionTools/classificationcolours.h"
 #include "Vision/VisionTypes/VisionFieldObjects/ball.h"
+#include "Vision/Modules/BallDetectionAlgorithms/ballcandidateevaluator.h"
 
 class BallDetectorShannon : public BallDetector
 {
 public:
     BallDetectorShannon();
     virtual ~BallDetectorShannon();
-    /*! @brief Detects a single ball from orange transitions using a geometric mean for general location
-      and close classification at the pixel level combined with occlusion detection for refinement.
+    /*! @brief Detects a single ball from orange transitions. The patches of orange are evaluated as candidates
+      most likely first, with cheap colour and size checks before close classification at the pixel level
+      combined with occlusion detection for refinement (see BallCandidateEvaluator).
     */
     virtual std::vector<Ball> run();
 
-protected:
-    void appendEdgesFromSegments(const std::vector<ColourSegment>& segments, std::list<Point>& pointList, const GreenHorizon& gh);
+    //! Returns the candidate evaluator, whose statistics describe the last run.
+    const BallCandidateEvaluator& getCandidateEvaluator() const { return *m_candidate_evaluator; }
+
+private:
+    BallCandidateEvaluator* m_candidate_evaluator;
 };
 
 #endif // BALLDETECTION_H
@@ -23,6 +23,7 @@ ENDIF()
 SET (YOUR_SRCS
 balldetectordave.cpp
 balldetectorshannon.cpp
+ballcandidateevaluator.cpp
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
@@ -28,7 +28,7 @@ std::vector<Goal> GoalDetectorHistogram::run()
 
     // DENSITY CHECK - fix later: use segment lengths and scanline spacing to estimate rather than
     //                 re-accessing the image to calculate fully
-    //DensityCheck(&yellow_posts, &img, &lut, VisionConstants::GOAL_MIN_PERCENT_YELLOW);
+    //DensityCheck(&yellow_posts, &img, &lut, VisionConstants::get().GOAL_MIN_PERCENT_YELLOW);
 
     posts = assignGoals(quads);
 
@@ -43,8 +43,8 @@ std::list<Quad> GoalDetectorHistogram::detectQuads(const std::vector<ColourSegme
 {
     const size_t BINS = 20;
     const double STDDEV_THRESHOLD = 1.5;
-    const double MERGE_THRESHOLD = 50.0 / VisionConstants::HORIZONTAL_SCANLINE_SPACING;
-    const double CANDIDATE_THRESHOLD = 200.0 / VisionConstants::HORIZONTAL_SCANLINE_SPACING;
+    const double MERGE_THRESHOLD = 50.0 / VisionConstants::get().HORIZONTAL_SCANLINE_SPACING;
+    const double CANDIDATE_THRESHOLD = 200.0 / VisionConstants::get().HORIZONTAL_SCANLINE_SPACING;
 
     Histogram1D hist(BINS, VisionBlackboard::getInstance()->getImageWidth()/(double)BINS);
 
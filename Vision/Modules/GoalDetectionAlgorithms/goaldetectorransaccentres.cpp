@@ -14,7 +14,7 @@
 GoalDetectorRANSACCentres::GoalDetectorRANSACCentres()
 {
     //m_n = 10;               //min pts to line essentially
-    m_n = 30 / VisionConstants::HORIZONTAL_SCANLINE_SPACING;               //min pts to line essentially
+    m_n = 30 / VisionConstants::get().HORIZONTAL_SCANLINE_SPACING;               //min pts to line essentially
     m_k = 40;               //number of iterations per fitting attempt
     m_e = 12.0;              //consensus margin
     m_max_iterations = 5;  //hard limit on number of fitting attempts
@@ -12,7 +12,7 @@
 
 GoalDetectorRANSACEdges::GoalDetectorRANSACEdges()
 {
-    m_n = 25 / VisionConstants::HORIZONTAL_SCANLINE_SPACING;    //min pts to line essentially
+    m_n = 25 / VisionConstants::get().HORIZONTAL_SCANLINE_SPACING;    //min pts to line essentially
     m_k = 100;              //number of iterations per fitting attempt
     m_e = 5.0;              //consensus margin
     m_max_iterations = 3;   //hard limit on number of fitting attempts
@@ -59,7 +59,7 @@ std::vector<Goal> GoalDetectorRANSACEdges::run()
     DataWrapper::getInstance()->debugPublish(DBID_GOAL_LINES_END, end_lines);
 
     //Build candidates out of lines - this finds candidates irrespective of rotation - filtering must be done later
-    quads = buildQuadsFromLines(start_lines, end_lines, VisionConstants::GOAL_RANSAC_MATCHING_TOLERANCE);
+    quads = buildQuadsFromLines(start_lines, end_lines, VisionConstants::get().GOAL_RANSAC_MATCHING_TOLERANCE);
 
     // remove posts with invalid aspect ratio : check potential cross bars AND posts
     removeInvalid(quads);
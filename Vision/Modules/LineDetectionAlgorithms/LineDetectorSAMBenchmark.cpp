@@ -0,0 +1,363 @@
+/*! @file LineDetectorSAMBenchmark.cpp
+    @brief Checks that LineDetectorSAM finds exactly the lines the point-vector copying split and merge found,
+           and times both.
+
+    The reference is the previous implementation, kept here. Each frame's FieldLines are compared exactly: the
+    screen and ground line equations, and the end points. The frames are read from the files given as arguments,
+    each frame a point count followed by that many NUPoints (as written by NUPoint's operator<<), or, without
+    arguments, generated: several noisy field lines with clutter and repeated points. The constants are the ones in
+    Config/Darwin/VisionOptions.cfg.
+
+    Build and run from this directory with
+    @code
+        make LineDetectorSAMBenchmark && ./LineDetectorSAMBenchmark [frames ...]
+    @endcode
+    It returns non-zero if any frame differs, or if the detector does not see a constant that is changed.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "linedetectorsam.h"
+#include "Vision/visionconstants.h"
+
+#include <boost/foreach.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <time.h>
+
+//! The split and merge as it was, copying the point vectors at each step
+class ReferenceLineDetectorSAM : public LineDetector
+{
+public:
+    std::vector<FieldLine> run(const std::vector<NUPoint>& points)
+    {
+        std::vector<std::pair<LSFittedLine, LSFittedLine> > linePairs = fitLines(points);
+        std::vector<FieldLine> finalLines;
+        for(size_t i=0; i<linePairs.size(); i++)
+            finalLines.push_back(FieldLine(linePairs[i].second, linePairs[i].first));
+        return finalLines;
+    }
+
+private:
+    unsigned int MAX_LINES;
+    double SPLIT_DISTANCE;
+    unsigned int MIN_POINTS_OVER;
+    unsigned int MIN_POINTS_TO_LINE;
+    double MAX_ANGLE_DIFF_TO_MERGE;
+    double MAX_DISTANCE_TO_MERGE;
+    unsigned int MIN_POINTS_TO_LINE_FINAL;
+    double MIN_LINE_R2_FIT;
+    double MAX_LINE_MSD;
+    bool CLEAR_SMALL;
+    bool CLEAR_DIRTY;
+    std::vector<NUPoint> noisePoints;
+
+    std::vector<std::pair<LSFittedLine, LSFittedLine> > fitLines(const std::vector<NUPoint>& points)
+    {
+        SPLIT_DISTANCE = VisionConstants::get().SAM_SPLIT_DISTANCE;
+        MIN_POINTS_OVER = VisionConstants::get().SAM_MIN_POINTS_OVER;
+        MAX_ANGLE_DIFF_TO_MERGE = VisionConstants::get().SAM_MAX_ANGLE_DIFF_TO_MERGE;
+        MAX_DISTANCE_TO_MERGE = VisionConstants::get().SAM_MAX_DISTANCE_TO_MERGE;
+        MIN_POINTS_TO_LINE = VisionConstants::get().SAM_MIN_POINTS_TO_LINE;
+        MIN_POINTS_TO_LINE_FINAL = VisionConstants::get().SAM_MIN_POINTS_TO_LINE_FINAL;
+        MIN_LINE_R2_FIT = VisionConstants::get().SAM_MIN_LINE_R2_FIT;
+        MAX_LINE_MSD = VisionConstants::get().SAM_MAX_LINE_MSD;
+        MAX_LINES = VisionConstants::get().SAM_MAX_LINES;
+        CLEAR_SMALL = VisionConstants::get().SAM_CLEAR_SMALL;
+        CLEAR_DIRTY = VisionConstants::get().SAM_CLEAR_DIRTY;
+
+        std::vector<std::pair<LSFittedLine, LSFittedLine> > lines;
+        noisePoints.clear();
+        split(lines, points);
+        if(noisePoints.size() >= MIN_POINTS_TO_LINE_FINAL) {
+            std::vector<NUPoint> noiseCopy = noisePoints;
+            noisePoints.clear();
+            split(lines, noiseCopy);
+        }
+        lines = mergeColinear(lines, MAX_ANGLE_DIFF_TO_MERGE, MAX_DISTANCE_TO_MERGE);
+        if(CLEAR_SMALL)
+            clearSmallLines(lines);
+        if(CLEAR_DIRTY)
+            clearDirtyLines(lines);
+        return lines;
+    }
+
+    void split(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines, const std::vector<NUPoint>& points)
+    {
+        if(lines.size() >= MAX_LINES || points.size() < MIN_POINTS_TO_LINE) {
+            addToNoise(points);
+            return;
+        }
+        unsigned int points_over = 0;
+        int greatest_point = 0;
+        std::pair<LSFittedLine, LSFittedLine> line;
+        BOOST_FOREACH(const NUPoint& g, points) {
+            line.first.addPoint(g.groundCartesian);
+            line.second.addPoint(g.screenCartesian);
+        }
+        findPointsOver(line.first, points_over, greatest_point);
+
+        if(points_over >= MIN_POINTS_OVER) {
+            std::vector<NUPoint> left;
+            std::vector<NUPoint> right;
+            if(separate(left, right, points[greatest_point], points, line.first)) {
+                split(lines, left);
+                split(lines, right);
+            }
+            else {
+                std::vector<NUPoint> newlist = points;
+                addToNoise(newlist[greatest_point]);
+                newlist.erase(newlist.begin() + greatest_point);
+                split(lines, newlist);
+            }
+        }
+        else if(points_over > 0) {
+            if(points.size() > MIN_POINTS_TO_LINE_FINAL) {
+                std::vector<NUPoint> newlist = points;
+                addToNoise(newlist[greatest_point]);
+                newlist.erase(newlist.begin() + greatest_point);
+                line.first.clearPoints();
+                line.second.clearPoints();
+                BOOST_FOREACH(const NUPoint& g, newlist) {
+                    line.first.addPoint(g.groundCartesian);
+                    line.second.addPoint(g.screenCartesian);
+                }
+                lines.push_back(line);
+            }
+            else {
+                addToNoise(points);
+            }
+        }
+        else {
+            lines.push_back(line);
+        }
+    }
+
+    void findPointsOver(LSFittedLine& line, unsigned int& points_over, int& furthest_point)
+    {
+        double greatest_distance = 0.0;
+        points_over = 0;
+        furthest_point = -1;
+        std::vector<Point> points = line.getPoints();
+        for(unsigned int current_point = 0; current_point < points.size(); current_point++) {
+            double distance = line.getLinePointDistance(points[current_point]);
+            if(distance > SPLIT_DISTANCE) {
+                points_over++;
+                if(distance > greatest_distance) {
+                    greatest_distance = distance;
+                    furthest_point = current_point;
+                }
+            }
+        }
+    }
+
+    bool separate(std::vector<NUPoint>& left, std::vector<NUPoint>& right, NUPoint split_point, const std::vector<NUPoint>& points, const LSFittedLine& line)
+    {
+        left.push_back(split_point);
+        right.push_back(split_point);
+        double xsplit = line.isHorizontal() ? split_point.groundCartesian.x :
+                        line.isVertical() ? split_point.groundCartesian.y : line.projectOnto(split_point.groundCartesian).x;
+        BOOST_FOREACH(NUPoint pt, points) {
+            if(pt.groundCartesian != split_point.groundCartesian) {
+                double x = line.isHorizontal() ? pt.groundCartesian.x :
+                           line.isVertical() ? pt.groundCartesian.y : line.projectOnto(pt.groundCartesian).x;
+                if(x < xsplit)
+                    left.push_back(pt);
+                else
+                    right.push_back(pt);
+            }
+        }
+        return (left.size() < points.size() && right.size() < points.size());
+    }
+
+    void addToNoise(const NUPoint& point)
+    {
+        BOOST_FOREACH(NUPoint pt, noisePoints) {
+            if(pt.groundCartesian == point.groundCartesian)
+                return;
+        }
+        noisePoints.push_back(point);
+    }
+
+    void addToNoise(const std::vector<NUPoint>& points)
+    {
+        BOOST_FOREACH(NUPoint pt, points)
+            addToNoise(pt);
+    }
+
+    void clearSmallLines(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines)
+    {
+        std::vector<std::pair<LSFittedLine, LSFittedLine> >::iterator it = lines.begin();
+        while(it < lines.end()) {
+            if(it->first.getNumPoints() < MIN_POINTS_TO_LINE_FINAL)
+                it = lines.erase(it);
+            else
+                it++;
+        }
+    }
+
+    void clearDirtyLines(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines)
+    {
+        std::vector<std::pair<LSFittedLine, LSFittedLine> >::iterator it = lines.begin();
+        while(it < lines.end()) {
+            if(it->first.getr2tls() < MIN_LINE_R2_FIT || it->first.getMSD() > MAX_LINE_MSD)
+                it = lines.erase(it);
+            else
+                it++;
+        }
+    }
+};
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1e-9*time.tv_nsec;
+}
+
+static double uniform()
+{
+    return rand()/(RAND_MAX + 1.0);
+}
+
+static double gaussian()
+{
+    return sqrt(-2*log(1 - uniform()))*cos(2*M_PI*uniform());
+}
+
+static NUPoint makePoint(double x, double y)
+{
+    NUPoint p;
+    p.groundCartesian = Vector2<double>(x, y);
+    p.screenCartesian = Vector2<double>(320 + 300*y/(x + 50), 480 - 2000/(x + 50));
+    return p;
+}
+
+//! A frame of num_lines noisy field line segments in front of the robot, with clutter and repeated points, in scan order
+static std::vector<NUPoint> generateFrame(unsigned int num_lines, unsigned int points_per_line)
+{
+    std::vector<NUPoint> points;
+    for(unsigned int l=0; l<num_lines; l++) {
+        double x0 = 20 + 300*uniform(), y0 = -200 + 400*uniform();
+        double angle = M_PI*uniform(), length = 50 + 250*uniform();
+        for(unsigned int i=0; i<points_per_line; i++) {
+            double t = length*i/points_per_line;
+            points.push_back(makePoint(x0 + t*cos(angle) + 0.3*gaussian(), y0 + t*sin(angle) + 0.3*gaussian()));
+            if(uniform() < 0.05)
+                points.push_back(points.back());
+        }
+    }
+    unsigned int clutter = points.size()/10;
+    for(unsigned int i=0; i<clutter; i++)
+        points.push_back(makePoint(20 + 300*uniform(), -200 + 400*uniform()));
+    // interleave as a scan of the image would, rather than line by line
+    for(size_t i=points.size()-1; i>0; i--) {
+        if(uniform() < 0.3)
+            std::swap(points[i], points[rand() % (i + 1)]);
+    }
+    return points;
+}
+
+static bool sameLine(const Line& a, const Line& b)
+{
+    return a.getA() == b.getA() and a.getB() == b.getB() and a.getC() == b.getC();
+}
+
+static bool samePoint(const NUPoint& a, const NUPoint& b)
+{
+    return a.screenCartesian == b.screenCartesian and a.groundCartesian == b.groundCartesian;
+}
+
+static bool same(const std::vector<FieldLine>& a, const std::vector<FieldLine>& b)
+{
+    if(a.size() != b.size())
+        return false;
+    for(size_t i=0; i<a.size(); i++) {
+        if(not sameLine(a[i].getScreenLineEquation(), b[i].getScreenLineEquation()) or
+           not sameLine(a[i].getGroundLineEquation(), b[i].getGroundLineEquation()) or
+           not samePoint(a[i].getEndPoints().x, b[i].getEndPoints().x) or
+           not samePoint(a[i].getEndPoints().y, b[i].getEndPoints().y))
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    // the SAM_ constants are set to their defaults, and then to the robot's options
+    VisionConstants::get().loadFromFile("../../../Config/Darwin/VisionOptions.cfg");
+
+    std::vector<std::vector<NUPoint> > frames;
+    for(int a=1; a<argc; a++) {
+        std::ifstream file(argv[a]);
+        unsigned int count;
+        while(file >> count) {
+            std::vector<NUPoint> frame(count);
+            for(unsigned int i=0; i<count and file >> frame[i]; i++);
+            frames.push_back(frame);
+        }
+    }
+    if(frames.empty()) {
+        srand(1234);
+        const unsigned int sizes[][2] = {{1, 40}, {3, 40}, {5, 60}, {8, 80}, {12, 100}};
+        for(unsigned int s=0; s<5; s++) {
+            for(unsigned int f=0; f<40; f++)
+                frames.push_back(generateFrame(sizes[s][0], sizes[s][1]));
+        }
+    }
+
+    ReferenceLineDetectorSAM reference;
+    LineDetectorSAM detector;
+    unsigned int differences = 0;
+    unsigned int total_points = 0;
+    unsigned int total_lines = 0;
+    double reference_time = 0, detector_time = 0;
+    const unsigned int repeats = 5;
+    for(size_t f=0; f<frames.size(); f++) {
+        std::vector<FieldLine> expected, found;
+        double start = now();
+        for(unsigned int r=0; r<repeats; r++)
+            expected = reference.run(frames[f]);
+        reference_time += now() - start;
+        start = now();
+        for(unsigned int r=0; r<repeats; r++)
+            found = detector.run(frames[f]);
+        detector_time += now() - start;
+
+        if(not same(expected, found)) {
+            differences++;
+            std::cout << "Frame " << f << " (" << frames[f].size() << " points) differs: " << expected.size() << " lines expected, " << found.size() << " found" << std::endl;
+        }
+        total_points += frames[f].size();
+        total_lines += found.size();
+    }
+
+    // the detector only copies the constants again when they change, so check that it sees a change
+    VisionConstants::get().setParameter("SAM_MIN_POINTS_TO_LINE_FINAL", 1000u);
+    if(not same(reference.run(frames.back()), detector.run(frames.back()))) {
+        differences++;
+        std::cout << "LineDetectorSAM did not use SAM_MIN_POINTS_TO_LINE_FINAL after it was changed" << std::endl;
+    }
+
+    std::cout << frames.size() << " frames, " << total_points << " points, " << total_lines << " lines, " << differences << " frames differ" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "reference: " << 1e6*reference_time/(repeats*frames.size()) << " us/frame" << std::endl;
+    std::cout << "LineDetectorSAM: " << 1e6*detector_time/(repeats*frames.size()) << " us/frame" << std::endl;
+    return differences == 0 ? 0 : 1;
+}
@@ -40,7 +40,7 @@ std::vector<FieldLine> LineDetectorRANSAC::run(const std::vector<NUPoint>& point
     }
 
     // merge approximately colinear lines
-    mergeColinear(linePairs, VisionConstants::RANSAC_MAX_ANGLE_DIFF_TO_MERGE, VisionConstants::RANSAC_MAX_DISTANCE_TO_MERGE);
+    mergeColinear(linePairs, VisionConstants::get().RANSAC_MAX_ANGLE_DIFF_TO_MERGE, VisionConstants::get().RANSAC_MAX_DISTANCE_TO_MERGE);
 
     // generate FieldLine type from ground and screen equations
     for(size_t i=0; i<linePairs.size(); i++) {
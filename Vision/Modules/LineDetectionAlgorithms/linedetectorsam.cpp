@@ -7,13 +7,18 @@
 #include "Vision/visionconstants.h"
 
 #include <boost/foreach.hpp>
+#include <algorithm>
+#include <cstring>
 
-LineDetectorSAM::LineDetectorSAM() {}
-LineDetectorSAM::~LineDetectorSAM()
+LineDetectorSAM::LineDetectorSAM()
 {
-    noisePoints.clear();
+    m_points = NULL;
+    m_constants = NULL;
+    m_constants_version = 0;
 }
 
+LineDetectorSAM::~LineDetectorSAM() {}
+
 std::vector<FieldLine> LineDetectorSAM::run(const std::vector<NUPoint>& points)
 {
     std::vector<std::pair<LSFittedLine, LSFittedLine> > linePairs = fitLines(points, true);
@@ -25,29 +30,58 @@ std::vector<FieldLine> LineDetectorSAM::run(const std::vector<NUPoint>& points)
     return finalLines;
 }
 
+/*! @brief Copies the rules from the constants of the calling thread's vision pipeline. They are only copied again
+           when the constants are loaded or set, rather than every frame.
+ */
+void LineDetectorSAM::loadRules()
+{
+    const VisionConstants& constants = VisionConstants::get();
+    if(&constants == m_constants and constants.getVersion() == m_constants_version)
+        return;
+    m_constants = &constants;
+    m_constants_version = constants.getVersion();
+
+    SPLIT_DISTANCE = constants.SAM_SPLIT_DISTANCE;
+    MIN_POINTS_OVER = constants.SAM_MIN_POINTS_OVER;
+    MAX_ANGLE_DIFF_TO_MERGE = constants.SAM_MAX_ANGLE_DIFF_TO_MERGE;
+    MAX_DISTANCE_TO_MERGE = constants.SAM_MAX_DISTANCE_TO_MERGE;
+    MIN_POINTS_TO_LINE = constants.SAM_MIN_POINTS_TO_LINE;
+    MIN_POINTS_TO_LINE_FINAL = constants.SAM_MIN_POINTS_TO_LINE_FINAL;
+    MIN_LINE_R2_FIT = constants.SAM_MIN_LINE_R2_FIT;
+    MAX_LINE_MSD = constants.SAM_MAX_LINE_MSD;
+    //MAX_POINTS = constants.SAM_MAX_POINTS;
+    MAX_LINES = constants.SAM_MAX_LINES;
+    CLEAR_SMALL = constants.SAM_CLEAR_SMALL;
+    CLEAR_DIRTY = constants.SAM_CLEAR_DIRTY;
+}
+
 std::vector< std::pair<LSFittedLine, LSFittedLine> > LineDetectorSAM::fitLines(const std::vector<NUPoint>& points, bool noise) {
     //Performs split-and-merge algorithm with input consisting of a set of point clusters
     // and a set of unclustered points, putting the resulting lines into a reference
     // passed std::vector
-    //Import parameters from constants file
-    SPLIT_DISTANCE = VisionConstants::SAM_SPLIT_DISTANCE;
-    MIN_POINTS_OVER = VisionConstants::SAM_MIN_POINTS_OVER;
-    MAX_ANGLE_DIFF_TO_MERGE = VisionConstants::SAM_MAX_ANGLE_DIFF_TO_MERGE;
-    MAX_DISTANCE_TO_MERGE = VisionConstants::SAM_MAX_DISTANCE_TO_MERGE;
-    MIN_POINTS_TO_LINE = VisionConstants::SAM_MIN_POINTS_TO_LINE;
-    MIN_POINTS_TO_LINE_FINAL = VisionConstants::SAM_MIN_POINTS_TO_LINE_FINAL;
-    MIN_LINE_R2_FIT = VisionConstants::SAM_MIN_LINE_R2_FIT;
-    MAX_LINE_MSD = VisionConstants::SAM_MAX_LINE_MSD;
-    //MAX_POINTS = VisionConstants::SAM_MAX_POINTS;
-    MAX_LINES = VisionConstants::SAM_MAX_LINES;
-    CLEAR_SMALL = VisionConstants::SAM_CLEAR_SMALL;
-    CLEAR_DIRTY = VisionConstants::SAM_CLEAR_DIRTY;
+    loadRules();
 
     std::vector< std::pair<LSFittedLine, LSFittedLine> > lines;
-    noisePoints.clear();
 
-    //splitIterative(lines, points);
-    split(lines, points);
+    //Set up the scratch arrays for this frame
+    m_points = &points;
+    m_ground.resize(points.size());
+    for(size_t i=0; i<points.size(); i++)
+        m_ground[i] = points[i].groundCartesian;
+    findDuplicates();
+    m_in_noise.assign(points.size(), 0);
+    m_noise.clear();
+    m_order.resize(points.size());
+    for(size_t i=0; i<points.size(); i++)
+        m_order[i] = i;
+
+    Range all;
+    all.shared = -1;
+    all.begin = 0;
+    all.end = points.size();
+    Moments moments;
+    calculateMoments(all, moments);
+    split(lines, all, moments);
 
     //Then noise
     if(noise) {
@@ -57,7 +91,6 @@ std::vector< std::pair<LSFittedLine, LSFittedLine> > LineDetectorSAM::fitLines(c
     //Do Centre Circle fitting before merge - To do later
 
     //Then Merge
-    //convertLinesEndPoints(lines, vision, linedetector);
     lines = mergeColinear(lines, MAX_ANGLE_DIFF_TO_MERGE, MAX_DISTANCE_TO_MERGE);
 
     //Then clear unwanted lines
@@ -68,299 +101,100 @@ std::vector< std::pair<LSFittedLine, LSFittedLine> > LineDetectorSAM::fitLines(c
         clearDirtyLines(lines);
     }
 
+    m_points = NULL;
     return lines;
 }
 
-
-
-void LineDetectorSAM::split(std::vector< std::pair<LSFittedLine, LSFittedLine> >& lines, const std::vector<NUPoint>& points) {
-    // Recursive split algorithm
+void LineDetectorSAM::split(std::vector< std::pair<LSFittedLine, LSFittedLine> >& lines, Range range, Moments moments) {
+    // Recursive split algorithm, over a range of m_order with the moments of its points
 
     //Assumes:
     //	- constant detirmined for limit - MIN_POINTS_OVER
     //	- constant for min splitting distance - SAM_THRESHOLD
 
-    //Boundary Conds
-    if(lines.size() >= MAX_LINES) {
-        addToNoise(points);
-        return;
-    }
-    if(points.size() < MIN_POINTS_TO_LINE) {
-        //add points to noise
-        addToNoise(points);
-        return;
-    }
-
-    //temp variables
-    unsigned int points_over = 0; //how many points are further from the line than SAM_THRESHOLD
-    int greatest_point = 0; //which point in vector is the furthest
-
-    //generate new LSFittedLine
-    std::pair<LSFittedLine, LSFittedLine> line;
-    BOOST_FOREACH(const NUPoint& g, points) {
-        line.first.addPoint(g.groundCartesian);
-        line.second.addPoint(g.screenCartesian);
-    }
-
-    //check for points over threshold
-    findPointsOver(line.first, points_over, greatest_point);
-
-    //if num points over threshold > limit -> split at greatest distance point.
-    if(points_over >= MIN_POINTS_OVER) {
-        //there are enough points distant to justify a split
-        std::vector<NUPoint> left;    //holder vectors
-        std::vector<NUPoint> right;
-        if(separate(left, right, points[greatest_point], points, line.first)) {
-            //split was valid - recursively split new lines
-            split(lines, left);
-            split(lines, right);
+    while(true) {
+        //Boundary Conds
+        if(lines.size() >= MAX_LINES) {
+            addToNoise(range);
+            return;
         }
-        else {
-            //remove furthest point and retry
-            vector<NUPoint> newlist = points;
-            addToNoise(newlist[greatest_point]);
-            newlist.erase(newlist.begin() + greatest_point);
-            split(lines, newlist);
+        if(range.size() < MIN_POINTS_TO_LINE) {
+            //add points to noise
+            addToNoise(range);
+            return;
         }
 
-    }
-    else if(points_over > 0) {
-        //not enough points over to split so remove point as noisy, and regen line
-        if(points.size() > MIN_POINTS_TO_LINE_FINAL) {
-            //removal of a point will still leave enough to form a reasonable line
-            vector<NUPoint> newlist = points;
-            addToNoise(newlist[greatest_point]);
-            for(unsigned int i=greatest_point; i<newlist.size()-1; i++) {
-                newlist[i] = newlist[i+1];
+        //temp variables
+        unsigned int points_over = 0; //how many points are further from the line than SAM_THRESHOLD
+        int greatest_point = 0; //which point in the range is the furthest
+
+        //fit the ground line from the moments
+        Line line;
+        fitLine(line, moments);
+
+        //check for points over threshold
+        findPointsOver(line, range, points_over, greatest_point);
+
+        //if num points over threshold > limit -> split at greatest distance point.
+        if(points_over >= MIN_POINTS_OVER) {
+            //there are enough points distant to justify a split
+            Range left, right;
+            Moments left_moments, right_moments;
+            if(separate(range, pointAt(range, greatest_point), line, left, right, left_moments, right_moments)) {
+                //split was valid - recursively split new lines
+                split(lines, left, left_moments);
+                split(lines, right, right_moments);
+                return;
+            }
+            else {
+                //remove furthest point and retry
+                addToNoise(pointAt(range, greatest_point));
+                removePoint(range, greatest_point);
+                calculateMoments(range, moments);
+            }
+        }
+        else if(points_over > 0) {
+            //not enough points over to split so remove point as noisy, and regen line
+            if(range.size() > MIN_POINTS_TO_LINE_FINAL) {
+                //removal of a point will still leave enough to form a reasonable line
+                addToNoise(pointAt(range, greatest_point));
+                removePoint(range, greatest_point);
+                std::pair<LSFittedLine, LSFittedLine> new_line;
+                generateLines(new_line, range);
+                lines.push_back(new_line);
             }
-            newlist.pop_back();
-            line.first.clearPoints();
-            line.second.clearPoints();
-            generateLines(line, newlist);
-            lines.push_back(line);
+            else {
+                //NOT SURE ??
+                //Add points to noise and delete line
+                addToNoise(range);
+            }
+            return;
         }
         else {
-            //NOT SURE ??
-            //Add points to noise and delete line
-            addToNoise(points);
+            //no points over, just push line
+            std::pair<LSFittedLine, LSFittedLine> new_line;
+            generateLines(new_line, range);
+            lines.push_back(new_line);
+            return;
         }
     }
-    else {
-        //no points over, just push line
-        lines.push_back(line);
-    }
 }
 
-//void LineDetectorSAM::splitIterative(std::vector<LSFittedLine>& lines, std::vector<Point>& points) {
-//    //Iterative split algorithm, uses a stack of lines and iterates over it, splitting
-//    //each line or adding it to a final list.
-
-//    //Boundary Conds
-//    if(lines.size() >= MAX_LINES) {
-//        return;
-//    }
-//    if(points.size() < MIN_POINTS_TO_LINE) {
-//        //add points to noise
-//        for(unsigned int i=0; i<points.size(); i++)
-//            addToNoise(points[i]);
-//        return;
-//    }
-
-//    //Locals
-//    std::vector<LSFittedLine> stack;
-//    stack.clear();
-//    int furthest_point;
-//    int points_over;
-//    std::vector<Point> left, right;
-
-//    LSFittedLine* tempLine = new LSFittedLine();
-//    //generate first line
-//    generateLine(*tempLine, points);
-//    //push line onto stack
-//    stack.push_back(tempLine);
-
-//    //Begin iteration
-//    while(!stack.empty() && lines.size() + stack.size() < MAX_LINES) {
-//        //Pop the top line off and split it if warranted
-//        //if not, slap it on the end of lines and go again
-//        //until stack is empty or maximum lines reached
-
-//        //Clear left and right
-//        left.clear();
-//        right.clear();
-
-//        //pop top line
-//        tempLine = stack.back();
-//        stack.pop_back();
-
-//        //check for points over threshold
-//        findFurthestPoint(*tempLine, points_over, furthest_point);
-//        //qDebug() << points_over << furthest_point;
-//        //Options
-//        if((unsigned int)points_over >= MIN_POINTS_OVER) {
-//            //See if separation is an option
-//            //qDebug() << "going to seperate the line: " << furthest_point << (tempLine->getPoints()[furthest_point])->x << (tempLine->getPoints()[furthest_point])->y;
-//            if(separate(left, right, tempLine->getPoints()[furthest_point], *tempLine)) {
-//                //qDebug() << "separating worked";
-//                //clear old line
-//                if(!useTripleSplit)
-//                {
-//                    tempLine->getPoints().clear();
-//                    delete tempLine;
-//                    //check if left is big enough
-//                    if(left.size() >= MIN_POINTS_TO_LINE) {
-//                        //generate line and push it to stack
-//                        tempLine = new LSFittedLine();
-//                        generateLine(*tempLine, left);
-//                        stack.push_back(tempLine);
-//                    }
-//                    else {
-//                        //throw left points to noise
-//                        for(unsigned int i=0; i<left.size(); i++)
-//                            addToNoise(left[i]);
-//                        left.clear();
-//                    }
-//                    //check if right is big enough
-//                    if(right.size() >= MIN_POINTS_TO_LINE) {
-//                        //generate line and push it to stack
-//                        tempLine = new LSFittedLine();
-//                        generateLine(*tempLine, right);
-//                        stack.push_back(tempLine);
-//                    }
-//                    else {
-//                        //throw right points to noise
-//                        for(unsigned int i=0; i<right.size(); i++)
-//                            addToNoise(right[i]);
-//                        right.clear();
-//                    }
-//                }
-//                else //triple split
-//                {
-//                    //qDebug() << "Using the Tripple Split";
-//                    tempLine->getPoints().clear();
-//                    delete tempLine;
-//                    //check if left is big enough
-//                    if(centre.size() >= MIN_POINTS_TO_LINE) {
-//                        //generate line and push it to stack
-//                        tempLine = new LSFittedLine();
-//                        generateLine(*tempLine, centre);
-//                        stack.push_back(tempLine);
-//                    }
-//                    else {
-//                        //throw left points to noise
-//                        for(unsigned int i=0; i<centre.size(); i++)
-//                            addToNoise(centre[i]);
-//                        centre.clear();
-//                    }
-//                    //check if right is big enough
-//                    if(above.size() >= MIN_POINTS_TO_LINE) {
-//                        //generate line and push it to stack
-//                        tempLine = new LSFittedLine();
-//                        generateLine(*tempLine, above);
-//                        stack.push_back(tempLine);
-//                    }
-//                    else {
-//                        //throw right points to noise
-//                        for(unsigned int i=0; i<above.size(); i++)
-//                            addToNoise(above[i]);
-//                        above.clear();
-//                    }
-//                    if(below.size() >= MIN_POINTS_TO_LINE) {
-//                        //generate line and push it to stack
-//                        tempLine = new LSFittedLine();
-//                        generateLine(*tempLine, below);
-//                        stack.push_back(tempLine);
-//                    }
-//                    else {
-//                        //throw right points to noise
-//                        for(unsigned int i=0; i<below.size(); i++)
-//                            addToNoise(below[i]);
-//                        below.clear();
-//                    }
-
-//                }
-//            } //if(separate())
-//            else {
-//                //Separation didn't work
-//                //remove furthest point and push new line
-//                vector<Point> newlist = tempLine->getPoints();
-//                //remove noisy point and update points list
-//                addToNoise(newlist[furthest_point]);
-//                newlist[furthest_point] = newlist[newlist.size() - 1];
-//                newlist[newlist.size()-1] = 0;
-//                newlist.pop_back();
-//                //clear old line
-//                tempLine->getPoints().clear();
-//                delete tempLine;
-//                tempLine = new LSFittedLine();
-//                generateLine(*tempLine, newlist); //make new line
-//                stack.push_back(tempLine); //push it back
-//            }
-//        } //if(points_over >= MIN_POINTS_OVER)
-//        else if(points_over > 0){
-//            //not enough points over to split - but there are points over
-//            if(tempLine->getPoints().size() > MIN_POINTS_TO_LINE_FINAL) {
-//                //i.e. removal of a point will still leave enough to form a reasonable line
-//                //remove noisy point and regen line
-//                vector<Point> newlist = tempLine->getPoints();
-//                //remove noisy point and update points list
-//                addToNoise(newlist[furthest_point]);
-//                newlist[furthest_point] = newlist[newlist.size() - 1];
-//                newlist[newlist.size()-1] = 0;
-//                newlist.pop_back();
-//                tempLine->getPoints().clear();
-//                delete tempLine; //clear memory of old line
-//                tempLine = new LSFittedLine();
-//                generateLine(*tempLine, newlist); //make new line
-//                //qDebug() << "pushing line";
-//                lines.push_back(tempLine); //push it back to finals
-//                noFieldLines++;
-//            }
-//            else {
-//                //Add points to noise and delete line
-//                for(unsigned int i=0; i<tempLine->getPoints().size(); i++)
-//                    addToNoise(tempLine->getPoints()[i]);
-//                tempLine->getPoints().clear();
-//                delete tempLine;
-//            }
-//        } //elseif(points_over > 0)
-//        else {
-//            //no points over, just push line to finals
-//            //qDebug() << "pushing line";
-//            lines.push_back(tempLine);
-//            noFieldLines++;
-//        }
-//    } // While(!stack.empty() && noFieldLines + stack.size() <= MAX_LINES)
-
-
-////qDebug() << stack.size();
-//    //If MAX_LINES reached, but stack is not empty push stack lines to finals
-//    if(noFieldLines + stack.size() == MAX_LINES) {
-//        //qDebug() << "Maximum Lines reached in split";
-//    }
-//    while(!stack.empty()) {
-//        lines.push_back(stack.back());
-//        stack.pop_back();
-//    }
-//}
-
-void LineDetectorSAM::findPointsOver(LSFittedLine& line, unsigned int& points_over, int& furthest_point) {
+void LineDetectorSAM::findPointsOver(const Line& line, const Range& range, unsigned int& points_over, int& furthest_point) const {
     //this method finds the furthest point from a line and returns (via parameters)
-    //the number of points over the SPLIT_DISTANCE threshold and the index of
-    //the furthest point
+    //the number of points over the SPLIT_DISTANCE threshold and the position in
+    //the range of the furthest point
 
     //temp variables
     double distance; 	//holder for calculated PointDistance
     double greatest_distance = 0.0; //saves recalculation of greatest point distance
-    unsigned int current_point = 0;
+    unsigned int size = range.size();
     points_over = 0;
     furthest_point = -1;
-    std::vector<Point> points = line.getPoints();
 
     //check points for perp distance over threshold
-    for(current_point = 0; current_point < points.size(); current_point++) {
-        distance = line.getLinePointDistance(points[current_point]);
-        //qDebug() <<current_point <<distance;
+    for(unsigned int current_point = 0; current_point < size; current_point++) {
+        distance = line.getLinePointDistance(m_ground[pointAt(range, current_point)]);
 
         if(distance > SPLIT_DISTANCE) {
             //potential splitting point
@@ -373,111 +207,219 @@ void LineDetectorSAM::findPointsOver(LSFittedLine& line, unsigned int& points_ov
             }
         }
     }
-    //qDebug() <<furthest_point <<greatest_distance;
 }
 
 void LineDetectorSAM::splitNoise(std::vector<std::pair<LSFittedLine, LSFittedLine> > &lines) {
-    //this method creates a copy of the noisePoints std::vector,
-    //clears the current noisePoints std::vector and runs
-    //the split algorithm on the copy
-
-    if(noisePoints.size() >= MIN_POINTS_TO_LINE_FINAL) {
-        std::vector<NUPoint> noiseCopy;
-
-        noiseCopy = noisePoints;
-        noisePoints.clear();
-        //splitIterative(lines, noiseCopy);
-        split(lines, noiseCopy);
+    //this method moves the noise points into m_order,
+    //clears the current noise and runs
+    //the split algorithm on them
+
+    if(m_noise.size() >= MIN_POINTS_TO_LINE_FINAL) {
+        m_order.assign(m_noise.begin(), m_noise.end());
+        for(size_t i=0; i<m_noise.size(); i++) {
+            if(m_duplicate[m_noise[i]] >= 0)
+                m_in_noise[m_duplicate[m_noise[i]]] = 0;
+        }
+        m_noise.clear();
+
+        Range all;
+        all.shared = -1;
+        all.begin = 0;
+        all.end = m_order.size();
+        Moments moments;
+        calculateMoments(all, moments);
+        split(lines, all, moments);
     }
 }
 
-bool LineDetectorSAM::separate(std::vector<NUPoint> &left, std::vector<NUPoint> &right, NUPoint split_point, const std::vector<NUPoint> &points, const LSFittedLine& line) {
-    /*splits a section of points around a splitting point by rotating and translating onto the line about the splitting point
-     *Pre: left and right should be empty std::vectors
-     *		points contains all the points to be split
-     *		split_point is a valid point in points
-     *		line is the LSFittedLine
+bool LineDetectorSAM::separate(const Range& range, int split_point, const Line& line, Range& left, Range& right, Moments& left_moments, Moments& right_moments) {
+    /*splits a range of points around a splitting point by rotating and translating onto the line about the splitting point
+     *Pre: range contains all the points to be split
+     *		split_point is a valid point in range
+     *		line is the line fitted to range
      *Post: left contains all points with negative transformed x-vals
-     *		right contains all points with non-negative transformed x-vals (note split_point will be in right)
-     *      if left or right is empty, returns false indicating no actual split occurred
+     *		right contains all points with non-negative transformed x-vals
+     *      split_point is shared by left and right, and points at the same position as it are dropped
+     *      the points of the range are partitioned in place, left then right, each in their original order
+     *      left_moments and right_moments are the moments of left and right
+     *      if left or right is empty, returns false indicating no actual split occurred, and the range is unchanged
     */
 
-    //temp holder vars
-    double x_split = split_point.groundCartesian.x;
-    double y_split = split_point.groundCartesian.y;
-
-    left.push_back(split_point);    //splitting point should be included in both groups
-    right.push_back(split_point);
-    if(line.isHorizontal()) {
-        //horizontal line - no rotation
-        BOOST_FOREACH(NUPoint pt, points) {
-            if(pt.groundCartesian != split_point.groundCartesian) {
-                if(pt.groundCartesian.x < x_split) //point is to the left
-                    left.push_back(pt);
-                else
-                    right.push_back(pt);
+    const Vector2<double>& split_position = m_ground[split_point];
+    unsigned int size = range.size();
+    m_left.clear();
+    m_right.clear();
+    left_moments.clear();
+    right_moments.clear();
+    left_moments.add(split_position);   //splitting point should be included in both groups
+    right_moments.add(split_position);
+
+    //classify on the transformed x coordinate: horizontal line - no rotation, vertical line - 90 degree rotation
+    int axis = line.isHorizontal() ? 0 : (line.isVertical() ? 1 : 2);
+    double xsplit = axis == 0 ? split_position.x : (axis == 1 ? split_position.y : line.projectOnto(split_position).x);
+    for(unsigned int i=0; i<size; i++) {
+        int point = pointAt(range, i);
+        const Vector2<double>& pt = m_ground[point];
+        if(pt != split_position) {
+            double x = axis == 0 ? pt.x : (axis == 1 ? pt.y : line.projectOnto(pt).x);
+            if(x < xsplit) {
+                //point is to the left
+                m_left.push_back(point);
+                left_moments.add(pt);
             }
-        }
-    }
-    else if(line.isVertical()) {
-        //vertical line - 90 degree rotation
-        BOOST_FOREACH(NUPoint pt, points) {
-            if(pt.groundCartesian != split_point.groundCartesian) {
-                if(pt.groundCartesian.y < y_split) //point is to the left
-                    left.push_back(pt);
-                else
-                    right.push_back(pt);
+            else {
+                m_right.push_back(point);
+                right_moments.add(pt);
             }
         }
     }
-    else {
-        double xsplit = line.projectOnto(split_point.groundCartesian).x;
-        BOOST_FOREACH(NUPoint pt, points) {
-            //check all points, calculate translated x coord
-            //and place in appropriate std::vector
-            if(pt.groundCartesian != split_point.groundCartesian) {
-                if(line.projectOnto(pt.groundCartesian).x < xsplit) {
-                    //point is to the left
-                    left.push_back(pt);
-                }
-                else {
-                    right.push_back(pt);
-                }
-            }
+
+    if(m_left.size() + 1 >= size || m_right.size() + 1 >= size)
+        return false;
+
+    //the halves fit in the range's slots, as the split point is not in either
+    std::copy(m_left.begin(), m_left.end(), m_order.begin() + range.begin);
+    std::copy(m_right.begin(), m_right.end(), m_order.begin() + range.begin + m_left.size());
+    left.shared = split_point;
+    left.begin = range.begin;
+    left.end = range.begin + m_left.size();
+    right.shared = split_point;
+    right.begin = left.end;
+    right.end = left.end + m_right.size();
+    return true;
+}
+
+void LineDetectorSAM::removePoint(Range& range, unsigned int position) {
+    //removes the point at position from the range, keeping the order of the others
+    if(range.shared >= 0) {
+        if(position == 0) {
+            range.shared = -1;
+            return;
         }
+        position--;
     }
-
-    return (left.size() < points.size() && right.size() < points.size());
+    std::copy(m_order.begin() + range.begin + position + 1, m_order.begin() + range.end, m_order.begin() + range.begin + position);
+    range.end--;
 }
 
-void LineDetectorSAM::generateLines(std::pair<LSFittedLine, LSFittedLine>& lines, const std::vector<NUPoint>& points) {
-    //creates a Least Squared Fitted line
+void LineDetectorSAM::generateLines(std::pair<LSFittedLine, LSFittedLine>& lines, const Range& range) {
+    //creates the Least Squared Fitted lines, ground then screen
 
+    unsigned int size = range.size();
     lines.first.clearPoints();
     lines.second.clearPoints();
-    BOOST_FOREACH(const NUPoint& g, points) {
-        lines.first.addPoint(g.groundCartesian);
-        lines.second.addPoint(g.screenCartesian);
+    m_line_points.resize(size);
+    for(unsigned int i=0; i<size; i++)
+        m_line_points[i] = m_ground[pointAt(range, i)];
+    lines.first.addPoints(m_line_points);
+    for(unsigned int i=0; i<size; i++)
+        m_line_points[i] = (*m_points)[pointAt(range, i)].screenCartesian;
+    lines.second.addPoints(m_line_points);
+}
+
+void LineDetectorSAM::calculateMoments(const Range& range, Moments& moments) const {
+    unsigned int size = range.size();
+    moments.clear();
+    for(unsigned int i=0; i<size; i++)
+        moments.add(m_ground[pointAt(range, i)]);
+}
+
+void LineDetectorSAM::fitLine(Line& line, const Moments& moments) const {
+    //fits the line as LSFittedLine::calcLine does, leaving line as it is if there are
+    //too few points for a line
+    if(moments.n < 2)
+        return;
+
+    double sxx, syy, sxy, Sigma;
+    double A = 0, B = 0, C = 0;
+    unsigned int numPoints = moments.n;
+
+    sxx = moments.sumX2 - moments.sumX*moments.sumX/numPoints;
+    syy = moments.sumY2 - moments.sumY*moments.sumY/numPoints;
+    sxy = moments.sumXY - moments.sumX*moments.sumY/numPoints;
+    Sigma = (sxx+syy-sqrt((sxx-syy)*(sxx-syy)+4*sxy*sxy))/2;
+
+    if (sxx > syy){
+        A = -sxy;
+        B = (sxx-Sigma);
+        C = -(moments.sumX*sxy-(sxx-Sigma)*moments.sumY)/numPoints;
     }
+    else {
+        A = (syy-Sigma);
+        B = -sxy;
+        C = -(moments.sumY*sxy-(syy-Sigma)*moments.sumX)/numPoints;
+    }
+    line.setLine(A, B, C);
+}
+
+void LineDetectorSAM::Moments::clear() {
+    sumX = 0;
+    sumY = 0;
+    sumX2 = 0;
+    sumY2 = 0;
+    sumXY = 0;
+    n = 0;
+}
+
+void LineDetectorSAM::Moments::add(const Vector2<double>& point) {
+    sumX += point.x;
+    sumY += point.y;
+    sumX2 += point.x * point.x;
+    sumY2 += point.y * point.y;
+    sumXY += point.x * point.y;
+    n++;
 }
 
 //GENERIC
 
-void LineDetectorSAM::addToNoise(const NUPoint& point) {
-    //NOT EFFICIENT
-    //O(M) for every insertion - where M is the size of noisePoints
-    BOOST_FOREACH(NUPoint pt, noisePoints) {
-        if(pt.groundCartesian == point.groundCartesian)
-            return;
+void LineDetectorSAM::findDuplicates() {
+    //finds the first point at the same ground position as each point with an open addressing
+    //table, so that the noise can be kept free of repeated positions in constant time per point.
+    //Points whose position is not a number are not equal to any point, so they have no duplicate
+    unsigned int size = m_ground.size();
+    unsigned int num_slots = 16;
+    while(num_slots < 2*size)
+        num_slots *= 2;
+    unsigned int mask = num_slots - 1;
+    m_hash.assign(num_slots, -1);
+    m_duplicate.resize(size);
+
+    for(unsigned int i=0; i<size; i++) {
+        const Vector2<double>& pt = m_ground[i];
+        if(pt.x != pt.x || pt.y != pt.y) {
+            m_duplicate[i] = -1;
+            continue;
+        }
+        //+0.0 so that -0 and 0, which are equal, hash the same
+        double x = pt.x + 0.0, y = pt.y + 0.0;
+        unsigned long long xbits, ybits;
+        memcpy(&xbits, &x, sizeof(x));
+        memcpy(&ybits, &y, sizeof(y));
+        unsigned long long h = (xbits ^ (ybits * 0x9E3779B97F4A7C15ULL)) * 0xBF58476D1CE4E5B9ULL;
+        unsigned int slot = (h >> 32) & mask;
+        while(m_hash[slot] >= 0 && m_ground[m_hash[slot]] != pt)
+            slot = (slot + 1) & mask;
+        if(m_hash[slot] < 0)
+            m_hash[slot] = i;
+        m_duplicate[i] = m_hash[slot];
     }
-    //only occurs if there are not copies of the point in the noise std::list
-    noisePoints.push_back(point);
 }
 
-void LineDetectorSAM::addToNoise(const std::vector<NUPoint > &points) {
-    BOOST_FOREACH(NUPoint pt, points) {
-        addToNoise(pt);
+void LineDetectorSAM::addToNoise(int point) {
+    //only adds the point if there is not already a point at its position in the noise
+    int first = m_duplicate[point];
+    if(first >= 0) {
+        if(m_in_noise[first])
+            return;
+        m_in_noise[first] = 1;
     }
+    m_noise.push_back(point);
+}
+
+void LineDetectorSAM::addToNoise(const Range& range) {
+    unsigned int size = range.size();
+    for(unsigned int i=0; i<size; i++)
+        addToNoise(pointAt(range, i));
 }
 
 void LineDetectorSAM::clearSmallLines(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines) {
@@ -14,12 +14,18 @@
          + splitAndMergeLSClusters() - for clustered input
 
         - If things need to be changed the main decisions are in:
-         + splitLSIterative() - decisions on whether to split, keep or throw away lines
-         + findFurthestPoint() - finds the number of points distant from the line, and the furthest point
-         + separateLS() - divides point set into two subsets based on the line equation and the furthest point
+         + split() - decisions on whether to split, keep or throw away lines
+         + findPointsOver() - finds the number of points distant from the line, and the furthest point
+         + separate() - divides point set into two subsets based on the line equation and the furthest point
                 uses a transform to axis defined by the line itself, and the normal from the furthest point
                 to the line.
-         + shouldMergeLines() - decisions on whether two lines should be merged
+         + mergeColinear() - decisions on whether two lines should be merged
+
+        - The points being split are indices into one array, m_order, and a set of points is a Range of it.
+        separate() partitions a range in place, keeping the order of the points, and sums the least-squares
+        moments of both halves as it goes, so a range's line is fitted without revisiting its points.
+        The arrays are kept between frames, so once they have grown to the largest frame splitting does not
+        allocate; only the lines that are kept copy their points.
 
          - All other methods are trivial or only make simple decisions based on the parameters set
             by initRules()
@@ -35,6 +41,8 @@
 #include "Tools/Math/Vector3.h"
 #include "Vision/Modules/linedetector.h"
 
+class VisionConstants;
+
 using std::vector;
 
 class LineDetectorSAM : public LineDetector
@@ -47,7 +55,11 @@ public:
 
 private:
     std::vector< std::pair<LSFittedLine, LSFittedLine> > fitLines(const std::vector<NUPoint>& points, bool noise=true);
-    //RULES
+    void loadRules();
+
+    //RULES - copied from the VisionConstants by loadRules()
+    const VisionConstants* m_constants;         //!< the constants the rules were copied from
+    unsigned int m_constants_version;           //!< the version of m_constants the rules were copied from
     //maximum field objects rules
     //unsigned int MAX_POINTS; //500
     unsigned int MAX_LINES; //15
@@ -66,25 +78,49 @@ private:
     bool CLEAR_SMALL;
     bool CLEAR_DIRTY;
 
-    std::vector<NUPoint> noisePoints;
+    //! The least-squares moments of a set of points, summed in the order of the points as LSFittedLine does
+    struct Moments {
+        double sumX, sumY, sumX2, sumY2, sumXY;
+        unsigned int n;
+        void clear();
+        void add(const Vector2<double>& point);
+    };
+
+    //! A set of points: the split point it shares with its sibling (or -1), followed by m_order[begin, end)
+    struct Range {
+        int shared;
+        unsigned int begin, end;
+        unsigned int size() const {return end - begin + (shared >= 0 ? 1 : 0);}
+    };
 
     //LEAST-SQUARES FITTING
-    void split(std::vector<std::pair<LSFittedLine, LSFittedLine> > &lines, const std::vector<NUPoint> &points);
-    //void splitIterative(std::vector<LSFittedLine>& lines, std::vector<Point>& points);
+    void split(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines, Range range, Moments moments);
     void splitNoise(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines);
-    void merge(std::vector<LSFittedLine>& lines);
-    void generateLines(std::pair<LSFittedLine, LSFittedLine>& lines, const std::vector<NUPoint>& points);
-    bool separate(std::vector<NUPoint>& left, std::vector<NUPoint>& right, NUPoint split_point, const std::vector<NUPoint>& points, const LSFittedLine& line);
-    //static void sortLinesLS(std::vector<LSFittedLine*>& lines);
-
+    void fitLine(Line& line, const Moments& moments) const;
+    void calculateMoments(const Range& range, Moments& moments) const;
+    void generateLines(std::pair<LSFittedLine, LSFittedLine>& lines, const Range& range);
+    bool separate(const Range& range, int split_point, const Line& line, Range& left, Range& right, Moments& left_moments, Moments& right_moments);
+    void removePoint(Range& range, unsigned int position);
+    int pointAt(const Range& range, unsigned int position) const {return range.shared < 0 ? m_order[range.begin + position] : (position == 0 ? range.shared : m_order[range.begin + position - 1]);}
 
     //GENERIC
-    void findPointsOver(LSFittedLine& line, unsigned int &points_over, int& furthest_point);
-    void addToNoise(const NUPoint& point);
-    void addToNoise(const std::vector<NUPoint>& points);
+    void findPointsOver(const Line& line, const Range& range, unsigned int& points_over, int& furthest_point) const;
+    void findDuplicates();
+    void addToNoise(int point);
+    void addToNoise(const Range& range);
     void clearSmallLines(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines);
     void clearDirtyLines(std::vector<std::pair<LSFittedLine, LSFittedLine> >& lines);
 
+    //SCRATCH - kept between frames
+    const std::vector<NUPoint>* m_points;       //!< the points of the current frame
+    std::vector< Vector2<double> > m_ground;    //!< the ground position of each point
+    std::vector<int> m_order;                   //!< the points being split, each range partitioned in place
+    std::vector<int> m_left, m_right;           //!< the two halves of a range while it is partitioned
+    std::vector<int> m_duplicate;               //!< the first point at the same ground position as each point, or -1 if its position is not a number
+    std::vector<int> m_hash;                    //!< open addressing table of ground positions used by findDuplicates()
+    std::vector<char> m_in_noise;               //!< whether a point at each first position is in the noise
+    std::vector<int> m_noise;                   //!< the noise points in the order they were found
+    std::vector< Vector2<double> > m_line_points;   //!< the points of a line as it is generated
 };
 
 #endif // LINEDETECTORSAM_H
@@ -44,8 +44,8 @@ bool CircleDetector::run(std::vector<NUPoint> &points, CentreCircle &result)
     while(modelfound && i < m_max_iterations) {
         // check if the model is good enough
         if(variance <= m_tolerance*candidate.getRadius() &&
-            candidate.getRadius() <= (1 + m_tolerance)*VisionConstants::CENTRE_CIRCLE_RADIUS &&
-            candidate.getRadius() >= (1 - m_tolerance)*VisionConstants::CENTRE_CIRCLE_RADIUS)
+            candidate.getRadius() <= (1 + m_tolerance)*VisionConstants::get().CENTRE_CIRCLE_RADIUS &&
+            candidate.getRadius() >= (1 - m_tolerance)*VisionConstants::get().CENTRE_CIRCLE_RADIUS)
         {
             //std::cout << __PRETTY_FUNCTION__ << " centre: " << candidate.getCentre() << " radius: " << candidate.getRadius() << std::endl;
             // get outer points to determine screen radius
@@ -84,7 +84,7 @@ void GoalDetector::relabel(std::vector<Goal>& goals) const
         if(avg_dist > 250) {
             const Transformer& tran = VisionBlackboard::getInstance()->getTransformer();
             double pix_dist = (goals[0].m_location.screenCartesian - goals[1].m_location.screenCartesian).abs();
-            double between_dist = VisionConstants::DISTANCE_BETWEEN_POSTS*tran.getCameraDistanceInPixels()/pix_dist;
+            double between_dist = VisionConstants::get().DISTANCE_BETWEEN_POSTS*tran.getCameraDistanceInPixels()/pix_dist;
             double d0 = between_dist + goals[0].width_dist - avg_dist;
             double d1 = between_dist + goals[1].width_dist - avg_dist;
 
@@ -97,7 +97,7 @@ void GoalDetector::relabel(std::vector<Goal>& goals) const
 
         // now label blue and yellow based on white background
         // only if the config parameter is set to
-        if(VisionConstants::WHITE_SIDE_IS_BLUE >= 0) {
+        if(VisionConstants::get().WHITE_SIDE_IS_BLUE >= 0) {
             //std::cout << "GOAL HACK WHITE PART STARTING" << std::endl;
 //            Goal& left_goal = goals[left_index];
 //            Goal& right_goal = goals[right_index];
@@ -121,8 +121,8 @@ void GoalDetector::relabel(std::vector<Goal>& goals) const
             }
             //std::cout << "GOAL HACK WHITE count: " << white_count << std::endl;
 
-            if(white_count > VisionConstants::UPPER_WHITE_THRESHOLD) {
-                if(VisionConstants::WHITE_SIDE_IS_BLUE) {
+            if(white_count > VisionConstants::get().UPPER_WHITE_THRESHOLD) {
+                if(VisionConstants::get().WHITE_SIDE_IS_BLUE) {
                     //std::cout << "GOAL HACK WHITE labelling blue: " << white_count << std::endl;
                     goals[left_index].m_id = GOAL_B_L;
                     goals[right_index].m_id = GOAL_B_R;
@@ -142,7 +142,7 @@ void GoalDetector::removeInvalid(std::list<Quad>& posts)
     std::list<Quad>::iterator it = posts.begin();
     while (it != posts.end()) {
         //remove all posts whos' aspect ratios are too low
-        if ( it->aspectRatio() < VisionConstants::GOAL_HEIGHT_TO_WIDTH_RATIO_MIN)
+        if ( it->aspectRatio() < VisionConstants::get().GOAL_HEIGHT_TO_WIDTH_RATIO_MIN)
             it = posts.erase(it);
         else
             it++;
@@ -203,7 +203,7 @@ std::vector<Goal> GoalDetector::assignGoals(const std::list<Quad>& candidates) c
                pos2 = std::max(post1.getLeft(), post2.getLeft());  // inside left
 
         //only publish if the candidates are far enough apart
-        if(std::abs(pos2 - pos1) >= VisionConstants::MIN_GOAL_SEPARATION) {
+        if(std::abs(pos2 - pos1) >= VisionConstants::get().MIN_GOAL_SEPARATION) {
             //flip if necessary
             if (post1.getCentre().x > post2.getCentre().x) {
                 goals.push_back(Goal(GOAL_L, post2));
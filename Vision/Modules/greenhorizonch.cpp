@@ -35,7 +35,7 @@ void GreenHorizonCH::calculateHorizon()
     int height = img.getHeight();
 
     //makes this fail-safe in the event of improper parameters
-    const int SPACING = std::max(VisionConstants::GREEN_HORIZON_SCAN_SPACING, 1U);
+    const int SPACING = std::max(VisionConstants::get().GREEN_HORIZON_SCAN_SPACING, 1U);
     
     // variable declarations    
     std::vector<Point> horizon_points;
@@ -69,7 +69,7 @@ void GreenHorizonCH::calculateHorizon()
                 }
                 green_count++;
                 // if VER_THRESHOLD green pixels found, add point
-                if (green_count == VisionConstants::GREEN_HORIZON_MIN_GREEN_PIXELS) {
+                if (green_count == VisionConstants::get().GREEN_HORIZON_MIN_GREEN_PIXELS) {
                     horizon_points.push_back(Point(x, green_top));
                     break;
                 }
@@ -84,7 +84,7 @@ void GreenHorizonCH::calculateHorizon()
 //            }
         }
     }
-    static int num_no_green = 0;
+    static __thread int num_no_green = 0;   //per thread, so that pipelines in other contexts don't share it
     if(horizon_points.size() < 2) {
         if(num_no_green < 150) {
             num_no_green++;
@@ -141,7 +141,7 @@ void GreenHorizonCH::calculateHorizon()
 
     std::vector<Point>::iterator p = horizon_points.begin();
     while(p < horizon_points.end()) {
-        if (p->y < mean_y - VisionConstants::GREEN_HORIZON_UPPER_THRESHOLD_MULT*std_dev_y) {
+        if (p->y < mean_y - VisionConstants::get().GREEN_HORIZON_UPPER_THRESHOLD_MULT*std_dev_y) {
             thrown_points.push_back(*p);
             p = horizon_points.erase(p);
         }
@@ -45,7 +45,7 @@ std::vector<Obstacle> ObstacleDetectionCH::run()
            std_dev_y;
 
     //get scan points from BB
-    horizon_points = green_horizon.getInterpolatedSubset(VisionConstants::VERTICAL_SCANLINE_SPACING);
+    horizon_points = green_horizon.getInterpolatedSubset(VisionConstants::get().VERTICAL_SCANLINE_SPACING);
 
     //calculate mean and stddev of vertical positions
     accumulator_set<double, stats<tag::mean, tag::variance> > acc;
@@ -64,7 +64,7 @@ std::vector<Obstacle> ObstacleDetectionCH::run()
 
         // if bottom of image, assume object
         if (p.y == height-1) {
-            if (p.y - green_horizon.getYFromX(p.x) >= VisionConstants::MIN_DISTANCE_FROM_HORIZON) {
+            if (p.y - green_horizon.getYFromX(p.x) >= VisionConstants::get().MIN_DISTANCE_FROM_HORIZON) {
                 obstacle_points.push_back(p);
             }
         }
@@ -80,7 +80,7 @@ std::vector<Obstacle> ObstacleDetectionCH::run()
                     if (green_count == VER_THRESHOLD) {
                         if (green_top > mean_y + OBJECT_THRESHOLD_MULT*std_dev_y + 1) {
                             //only add point if it is outside of minimum distance
-                            if (y - green_horizon.getYFromX(p.x) >= VisionConstants::MIN_DISTANCE_FROM_HORIZON) {
+                            if (y - green_horizon.getYFromX(p.x) >= VisionConstants::get().MIN_DISTANCE_FROM_HORIZON) {
                                 obstacle_points.push_back(Point(p.x, y));
                             }
                         }
@@ -93,7 +93,7 @@ std::vector<Obstacle> ObstacleDetectionCH::run()
 
                 // if bottom reached without green, add bottom point
                 if (y == height - 1) {
-                    if (y - green_horizon.getYFromX(p.x) >= VisionConstants::MIN_DISTANCE_FROM_HORIZON) {
+                    if (y - green_horizon.getYFromX(p.x) >= VisionConstants::get().MIN_DISTANCE_FROM_HORIZON) {
                         obstacle_points.push_back(Point(p.x, y));
                     }
                 }
@@ -117,7 +117,7 @@ std::vector<Obstacle> ObstacleDetectionCH::run()
             bottom = 0;
         }
         else {
-            if (obstacle_points.at(i).x - obstacle_points.at(i-1).x == static_cast<int>(VisionConstants::VERTICAL_SCANLINE_SPACING) && (i < obstacle_points.size()-1))
+            if (obstacle_points.at(i).x - obstacle_points.at(i-1).x == static_cast<int>(VisionConstants::get().VERTICAL_SCANLINE_SPACING) && (i < obstacle_points.size()-1))
             {
                 // count while there are consecutive points
                 count++;
@@ -126,11 +126,11 @@ std::vector<Obstacle> ObstacleDetectionCH::run()
             }
             else {
                 // non consecutive found
-                if (count > VisionConstants::MIN_CONSECUTIVE_POINTS)
+                if (count > VisionConstants::get().MIN_CONSECUTIVE_POINTS)
                 {
                     // if there are enough then make an obstacle
-                    int l = obstacle_points.at(start).x - VisionConstants::VERTICAL_SCANLINE_SPACING;
-                    int r = obstacle_points.at(i-1).x + VisionConstants::VERTICAL_SCANLINE_SPACING;
+                    int l = obstacle_points.at(start).x - VisionConstants::get().VERTICAL_SCANLINE_SPACING;
+                    int r = obstacle_points.at(i-1).x + VisionConstants::get().VERTICAL_SCANLINE_SPACING;
 
                     int centre = (l + r)*0.5;
                     int width = r - l;
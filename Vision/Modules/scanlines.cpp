@@ -34,7 +34,7 @@ void ScanLines::generateScanLines()
     if(bottom_horizontal_scan >= vbb->getImageHeight())
         errorlog << "avg: " << bottom_horizontal_scan << std::endl;
 
-    for (int y = bottom_horizontal_scan; y >= 0; y -= VisionConstants::HORIZONTAL_SCANLINE_SPACING) {
+    for (int y = bottom_horizontal_scan; y >= 0; y -= VisionConstants::get().HORIZONTAL_SCANLINE_SPACING) {
         if(y >= vbb->getImageHeight())
             errorlog << " y: " << y << std::endl;
         horizontal_scan_lines.push_back(y);
@@ -61,7 +61,7 @@ void ScanLines::classifyVerticalScanLines()
 {
     VisionBlackboard* vbb = VisionBlackboard::getInstance();
     const NUImage& img = vbb->getOriginalImage();
-    const std::vector<Vector2<double> >& vertical_start_points = vbb->getGreenHorizon().getInterpolatedSubset(VisionConstants::VERTICAL_SCANLINE_SPACING);
+    const std::vector<Vector2<double> >& vertical_start_points = vbb->getGreenHorizon().getInterpolatedSubset(VisionConstants::get().VERTICAL_SCANLINE_SPACING);
     std::vector< std::vector<ColourSegment> > classifications;
 
     for(unsigned int i=0; i<vertical_start_points.size(); i++) {
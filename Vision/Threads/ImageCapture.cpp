@@ -0,0 +1,336 @@
+/*! @file ImageCapture.cpp
+    @brief Implementation of the ImageCapture class.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ImageCapture.h"
+#include "ImageEncoderThread.h"
+#include "SaveImagesThread.h"
+
+#include "debug.h"
+#include "debugverbosityvision.h"
+
+#include <time.h>
+#include <algorithm>
+
+static double monotonicTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return 1e3*now.tv_sec + 1e-6*now.tv_nsec;
+}
+
+/*! @brief Creates the capture. Its threads are not started until the first start(), so they cost nothing while images aren't saved.
+    @param numEncoders the number of threads compressing frames
+ */
+ImageCapture::ImageCapture(unsigned int numEncoders) : m_stopping(false)
+{
+    pthread_mutex_init(&m_mutex, NULL);
+    pthread_cond_init(&m_written, NULL);
+    for (unsigned int i = 0; i < QueueSize; i++)
+        m_frames[i].state = Frame::Free;
+    m_head = 0;
+    m_tail = 0;
+    m_num_queued = 0;
+
+    m_capturing = false;
+    m_format = NUImageCodec::RawFormat;
+    m_jpeg_quality = 90;
+    m_num_captured = 0;
+    m_num_dropped = 0;
+    m_num_written = 0;
+    m_num_failed = 0;
+    m_bytes_written = 0;
+    m_start_time = 0;
+
+    m_num_encoders = std::max(numEncoders, 1u);
+    m_writer = NULL;
+}
+
+/*! @brief Writes everything still queued, stops the threads and closes the files.
+ */
+ImageCapture::~ImageCapture()
+{
+    stop();
+    m_stopping.store(true);
+    for (size_t i = 0; i < m_encoders.size(); i++)
+    {
+        m_encoders[i]->signal(true);        // wait for the thread to get back to wait(), where it checks whether it is stopping
+        m_encoders[i]->join();
+        delete m_encoders[i];
+    }
+    if (m_writer != NULL)
+    {
+        m_writer->signal(true);
+        m_writer->join();
+        delete m_writer;
+    }
+
+    m_imagefile.close();
+    m_sensorfile.close();
+    pthread_cond_destroy(&m_written);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/*! @brief Starts capturing frames. The files are opened the first time, and later captures are appended to them.
+    @param directory the directory the image and sensor files are written in
+    @param format the format the images are written in
+    @param jpegQuality the quality from 1 to 100 if the format is JpegFormat
+    @return true if the files are open and frames will be captured
+ */
+bool ImageCapture::start(const std::string& directory, NUImageCodec::Format format, int jpegQuality)
+{
+    if (m_capturing)
+        stop();
+
+    // nothing is queued, so the writer won't touch the files until the first frame is captured
+    std::string imagepath = directory + "image." + NUImageCodec::getFileExtension(format);
+    if (m_imagefile.is_open() and imagepath != m_imagepath)
+        m_imagefile.close();
+    if (not m_imagefile.is_open())
+    {
+        m_imagefile.open(imagepath.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        m_imagepath = imagepath;
+    }
+    if (not m_sensorfile.is_open())
+        m_sensorfile.open((directory + "sensor.strm").c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if (not m_imagefile.is_open() or not m_sensorfile.is_open())
+    {
+        errorlog << "ImageCapture::start(). Unable to open " << imagepath << " and " << directory << "sensor.strm" << std::endl;
+        return false;
+    }
+
+    startThreads(format);
+
+    pthread_mutex_lock(&m_mutex);
+    m_format = format;
+    m_jpeg_quality = jpegQuality;
+    m_num_written = 0;
+    m_num_failed = 0;
+    m_bytes_written = 0;
+    pthread_mutex_unlock(&m_mutex);
+    m_num_captured = 0;
+    m_num_dropped = 0;
+    m_start_time = monotonicTime();
+    m_capturing = true;
+
+    #if DEBUG_VISION_VERBOSITY > 0
+        debug << "ImageCapture::start(). Saving " << NUImageCodec::getFormatName(format) << " images to " << imagepath << std::endl;
+    #endif
+    return true;
+}
+
+/*! @brief Starts the threads the format needs, if they haven't been started by an earlier capture. Raw frames
+           are written as they are, so the encoders are only started for the first compressed capture.
+    @param format the format of the capture
+ */
+void ImageCapture::startThreads(NUImageCodec::Format format)
+{
+    if (m_writer == NULL)
+        m_writer = new SaveImagesThread(this);
+    if (format != NUImageCodec::RawFormat and m_encoders.empty())
+    {
+        for (unsigned int i = 0; i < m_num_encoders; i++)
+            m_encoders.push_back(new ImageEncoderThread(this));
+    }
+}
+
+/*! @brief Stops capturing frames, and waits for the frames that are already queued to be written.
+           This only waits for at most a queue of frames to be compressed.
+ */
+void ImageCapture::stop()
+{
+    if (not m_capturing)
+        return;
+    m_capturing = false;
+
+    pthread_mutex_lock(&m_mutex);
+    while (m_num_queued > 0)
+    {
+        // a thread that was just finishing when it was signalled misses the signal, so keep waking them until everything is written
+        pthread_mutex_unlock(&m_mutex);
+        wake();
+        pthread_mutex_lock(&m_mutex);
+
+        struct timespec timeout;
+        clock_gettime(CLOCK_REALTIME, &timeout);
+        timeout.tv_nsec += 20000000;
+        if (timeout.tv_nsec >= 1000000000)
+        {
+            timeout.tv_sec++;
+            timeout.tv_nsec -= 1000000000;
+        }
+        if (m_num_queued > 0)
+            pthread_cond_timedwait(&m_written, &m_mutex, &timeout);
+    }
+    unsigned int written = m_num_written;
+    unsigned int failed = m_num_failed;
+    double megabytes = m_bytes_written/1048576.0;
+    pthread_mutex_unlock(&m_mutex);
+
+    double seconds = std::max(1e-3*(monotonicTime() - m_start_time), 1e-3);
+    debug << "ImageCapture::stop(). Saved " << written << " of " << m_num_captured + m_num_dropped << " frames in " << seconds << "s (";
+    debug << written/seconds << " fps, " << megabytes/seconds << " MB/s, " << megabytes << " MB). ";
+    debug << m_num_dropped << " were dropped because the queue was full, and " << failed << " could not be saved." << std::endl;
+}
+
+/*! @brief Queues a copy of the frame and sensor data to be saved. This never waits for the encoders or the disk.
+    @param image the frame
+    @param sensors the sensor data of the frame
+    @return true if the frame was queued, false if it was dropped because the queue was full or the capture isn't started
+ */
+bool ImageCapture::capture(const NUImage& image, const NUSensorsData& sensors)
+{
+    if (not m_capturing)
+        return false;
+
+    Frame& frame = m_frames[m_head];
+    pthread_mutex_lock(&m_mutex);
+    bool free = frame.state == Frame::Free;
+    pthread_mutex_unlock(&m_mutex);
+    if (not free)
+    {
+        m_num_dropped++;
+        wake();         // in case the threads missed the last signal; otherwise nothing would wake them while the queue is full
+        return false;
+    }
+
+    frame.image.copyFromExisting(image);
+    frame.sensors = sensors;
+    frame.format = m_format;
+
+    pthread_mutex_lock(&m_mutex);
+    frame.state = m_format == NUImageCodec::RawFormat ? Frame::Encoded : Frame::Captured;     // raw frames don't need compressing
+    m_num_queued++;
+    pthread_mutex_unlock(&m_mutex);
+
+    m_head = (m_head + 1) % QueueSize;
+    m_num_captured++;
+    wake();
+    return true;
+}
+
+/*! @brief Returns the number of frames written since start() */
+unsigned int ImageCapture::getNumWritten()
+{
+    pthread_mutex_lock(&m_mutex);
+    unsigned int written = m_num_written;
+    pthread_mutex_unlock(&m_mutex);
+    return written;
+}
+
+/*! @brief Returns the number of frames that could not be compressed or written since start() */
+unsigned int ImageCapture::getNumFailed()
+{
+    pthread_mutex_lock(&m_mutex);
+    unsigned int failed = m_num_failed;
+    pthread_mutex_unlock(&m_mutex);
+    return failed;
+}
+
+/*! @brief Wakes the encoders and the writer. Any that are busy will find the new work when they finish.
+           The threads are only ever signalled from here, on vision's thread, so that once the capture is stopping
+           nothing can wake a thread between the destructor's signal and join.
+ */
+void ImageCapture::wake()
+{
+    for (size_t i = 0; i < m_encoders.size(); i++)
+        m_encoders[i]->signal(false);
+    if (m_writer != NULL)
+        m_writer->signal(false);
+}
+
+/*! @brief Compresses the oldest frame that is waiting to be compressed. This is called by the encoders.
+    @param codec the encoder's codec
+    @return true if there was a frame to compress
+ */
+bool ImageCapture::encodeNext(NUImageCodec& codec)
+{
+    pthread_mutex_lock(&m_mutex);
+    Frame* frame = NULL;
+    for (unsigned int i = 0; i < QueueSize and frame == NULL; i++)
+    {
+        Frame& candidate = m_frames[(m_tail + i) % QueueSize];
+        if (candidate.state == Frame::Captured)
+            frame = &candidate;
+    }
+    if (frame != NULL)
+        frame->state = Frame::Encoding;
+    int quality = m_jpeg_quality;
+    pthread_mutex_unlock(&m_mutex);
+    if (frame == NULL)
+        return false;
+
+    codec.setJpegQuality(quality);
+    if (not codec.encode(frame->image, frame->format, frame->record))
+        frame->record.clear();
+
+    pthread_mutex_lock(&m_mutex);
+    frame->state = Frame::Encoded;
+    pthread_mutex_unlock(&m_mutex);
+    return true;
+}
+
+/*! @brief Writes the frames that have been compressed, in the order they were captured. This is called by the writer.
+ */
+void ImageCapture::writePending()
+{
+    bool wrote = false;
+    while (true)
+    {
+        pthread_mutex_lock(&m_mutex);
+        Frame& frame = m_frames[m_tail];
+        bool ready = frame.state == Frame::Encoded;
+        pthread_mutex_unlock(&m_mutex);
+        if (not ready)
+            break;
+
+        // a frame is only written with its sensor data, so that the two files stay paired
+        unsigned long long bytes = 0;
+        if (frame.format == NUImageCodec::RawFormat)
+        {
+            m_imagefile << frame.image;
+            bytes = sizeof(Pixel)*frame.image.getTotalPixels();
+        }
+        else if (not frame.record.empty())
+        {
+            m_imagefile.write(reinterpret_cast<const char*>(&frame.record[0]), frame.record.size());
+            bytes = frame.record.size();
+        }
+        if (bytes > 0)
+            m_sensorfile << frame.sensors;
+        bool ok = bytes > 0 and m_imagefile.good() and m_sensorfile.good();
+        wrote = true;
+
+        pthread_mutex_lock(&m_mutex);
+        if (ok)
+        {
+            m_num_written++;
+            m_bytes_written += bytes;
+        }
+        else
+            m_num_failed++;
+        frame.state = Frame::Free;
+        m_tail = (m_tail + 1) % QueueSize;
+        m_num_queued--;
+        pthread_cond_broadcast(&m_written);
+        pthread_mutex_unlock(&m_mutex);
+    }
+    if (wrote)
+    {
+        m_imagefile.flush();            // so that as little as possible is lost if the robot loses power
+        m_sensorfile.flush();
+    }
+}
@@ -0,0 +1,114 @@
+/*! @file ImageCapture.h
+    @brief Declaration of the ImageCapture class.
+
+    @class ImageCapture
+    @brief Saves camera frames and their sensor data to disk without holding up vision
+
+    capture() is called by vision every frame while images are being saved. It copies the frame and the sensor
+    data into the next slot of a small ring and returns immediately; if every slot is still waiting to be encoded
+    or written the frame is dropped and counted, so vision is never held up by the disk. A pool of low priority
+    ImageEncoderThreads compress the queued frames in parallel, and a low priority SaveImagesThread writes them
+    in the order they were captured, with each frame's sensor data written to sensor.strm as before. None of
+    the threads exist until images are first saved, and the encoders only once a compressed format is used.
+
+    In RawFormat the frames are written with NUImage's operator<< to image.strm, so the files are the same as the
+    ones NUView already reads. In LosslessFormat and JpegFormat the frames are written as NUImageCodec records to
+    image.nuic; the lossless records decode back into exactly the frames that were captured.
+
+    This file is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This file is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with NUbot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef IMAGECAPTURE_H
+#define IMAGECAPTURE_H
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include "Infrastructure/NUImage/NUImage.h"
+#include "Infrastructure/NUImage/NUImageCodec.h"
+#include "Infrastructure/NUSensorsData/NUSensorsData.h"
+
+class ImageEncoderThread;
+class SaveImagesThread;
+
+class ImageCapture
+{
+public:
+    ImageCapture(unsigned int numEncoders = 2);
+    ~ImageCapture();
+
+    bool start(const std::string& directory, NUImageCodec::Format format, int jpegQuality);
+    void stop();
+    bool isCapturing() const {return m_capturing;}
+    bool capture(const NUImage& image, const NUSensorsData& sensors);
+
+    unsigned int getNumCaptured() const {return m_num_captured;}    //!< Returns the number of frames queued since start()
+    unsigned int getNumDropped() const {return m_num_dropped;}      //!< Returns the number of frames dropped since start() because the queue was full
+    unsigned int getNumWritten();
+    unsigned int getNumFailed();
+
+private:
+    friend class ImageEncoderThread;
+    friend class SaveImagesThread;
+    bool isStopping() const {return m_stopping.load();}
+    void startThreads(NUImageCodec::Format format);
+    bool encodeNext(NUImageCodec& codec);
+    void writePending();
+    void wake();
+
+private:
+    /*! @brief A slot in the ring. A slot is only touched by the thread that owns it in its current state:
+               vision while it is Free, an encoder while it is Encoding and the writer while it is Encoded.
+     */
+    struct Frame
+    {
+        enum state_t {Free, Captured, Encoding, Encoded};
+        state_t state;
+        NUImageCodec::Format format;
+        NUImage image;
+        NUSensorsData sensors;
+        std::vector<unsigned char> record;  //!< the compressed image, or empty if it could not be compressed
+    };
+    static const unsigned int QueueSize = 8;        //!< the number of frames that can be waiting to be encoded or written
+
+    Frame m_frames[QueueSize];
+    pthread_mutex_t m_mutex;                        //!< lock protecting the frame states, m_tail and the writer's counters
+    pthread_cond_t m_written;                       //!< signalled by the writer whenever it frees a slot
+    unsigned int m_head;                            //!< the slot the next frame is captured into. Only used by vision
+    unsigned int m_tail;                            //!< the slot of the next frame to be written
+    unsigned int m_num_queued;                      //!< the number of frames captured but not yet written
+
+    bool m_capturing;                               //!< true between start() and stop(). Only used by vision
+    NUImageCodec::Format m_format;                  //!< the format of this capture
+    int m_jpeg_quality;                             //!< the jpeg quality of this capture
+    unsigned int m_num_captured;                    //!< the number of frames queued since start(). Only used by vision
+    unsigned int m_num_dropped;                     //!< the number of frames dropped since start(). Only used by vision
+    unsigned int m_num_written;                     //!< the number of frames written since start()
+    unsigned int m_num_failed;                      //!< the number of frames that couldn't be compressed or written since start()
+    unsigned long long m_bytes_written;             //!< the number of image bytes written since start()
+    double m_start_time;                            //!< the time start() was called in ms
+
+    std::ofstream m_imagefile;                      //!< the file the images are written to. Only used by the writer once open
+    std::ofstream m_sensorfile;                     //!< the file the sensor data is written to. Only used by the writer once open
+    std::string m_imagepath;                        //!< the path of m_imagefile
+
+    std::atomic<bool> m_stopping;                   //!< set when the capture is being destroyed, to stop the threads
+    unsigned int m_num_encoders;                    //!< the number of threads compressing the frames once they are started
+    std::vector<ImageEncoderThread*> m_encoders;    //!< the threads compressing the frames, or empty until a compressed capture is started
+    SaveImagesThread* m_writer;                     //!< the thread writing the frames, or NULL until the first capture is started
+};
+
+#endif // IMAGECAPTURE_H
@@ -0,0 +1,70 @@
+/*! @file ImageEncoderThread.cpp
+    @brief Implementation of the image encoder thread class.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ImageEncoderThread.h"
+#include "ImageCapture.h"
+
+#include "debug.h"
+#include "debugverbosityvision.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+/*! @brief Creates and starts an encoder. The thread is not real-time, so it only uses the time left over by the real-time threads.
+    @param capture the capture whose frames are compressed
+ */
+ImageEncoderThread::ImageEncoderThread(ImageCapture* capture) : ConditionalThread(std::string("ImageEncoderThread"), 0)
+{
+    #if DEBUG_VISION_VERBOSITY > 0
+        debug << "ImageEncoderThread::ImageEncoderThread(" << capture << ") with priority " << static_cast<int>(m_priority) << std::endl;
+    #endif
+    m_capture = capture;
+    start();
+}
+
+ImageEncoderThread::~ImageEncoderThread()
+{
+    #if DEBUG_VISION_VERBOSITY > 0
+        debug << "ImageEncoderThread::~ImageEncoderThread()" << std::endl;
+    #endif
+    stop();
+}
+
+/*! @brief The encoder's main loop. It compresses frames until there are none left, and exits once the capture is stopping.
+ */
+void ImageEncoderThread::run()
+{
+    #if DEBUG_VISION_VERBOSITY > 0
+        debug << "ImageEncoderThread::run()" << std::endl;
+    #endif
+    // a new thread inherits the policy of the thread that created it, and the encoders must never compete with vision
+    sched_param param;
+    param.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+    // the thread only checks whether it is stopping after it has been signalled, so it is always back in wait() when the capture signals it to stop
+    wait();
+    while (not m_capture->isStopping())
+    {
+        while (m_capture->encodeNext(m_codec))
+            ;
+        wait();
+    }
+    #if DEBUG_VISION_VERBOSITY > 0
+        debug << "ImageEncoderThread is exiting." << std::endl;
+    #endif
+}
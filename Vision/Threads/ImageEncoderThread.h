@@ -0,0 +1,42 @@
+/*! @file ImageEncoderThread.h
+    @brief Declaration of a low priority thread for compressing captured images.
+
+    @class ImageEncoderThread
+    @brief One of the pool of threads compressing the frames queued by an ImageCapture
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef IMAGEENCODER_THREAD_H
+#define IMAGEENCODER_THREAD_H
+
+#include "Tools/Threading/ConditionalThread.h"
+#include "Infrastructure/NUImage/NUImageCodec.h"
+
+class ImageCapture;
+
+class ImageEncoderThread : public ConditionalThread
+{
+public:
+    ImageEncoderThread(ImageCapture* capture);
+    ~ImageEncoderThread();
+protected:
+    void run();
+
+private:
+    ImageCapture* m_capture;
+    NUImageCodec m_codec;           //!< this thread's codec, which keeps its buffers between frames
+};
+
+#endif
@@ -24,19 +24,21 @@
 #include "debug.h"
 #include "debugverbosityvision.h"
 
-#include "Vision/VisionWrapper/visioncontrolwrapperdarwin.h"
+#include "ImageCapture.h"
 
-#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
 
-/*! @brief Constructs the network thread
+/*! @brief Constructs the save images thread. The thread is not real-time, so it only uses the time left over by the real-time threads.
+    @param capture the capture whose images are written
  */
 
-SaveImagesThread::SaveImagesThread(VisionControlWrapper* vision) : ConditionalThread(std::string("SaveImagesThread"), 0)
+SaveImagesThread::SaveImagesThread(ImageCapture* capture) : ConditionalThread(std::string("SaveImagesThread"), 0)
 {
     #if DEBUG_VISION_VERBOSITY > 0
-        debug << "SaveImagesThread::SaveImagesThread(" << vision << ") with priority " << static_cast<int>(m_priority) << std::endl;
+        debug << "SaveImagesThread::SaveImagesThread(" << capture << ") with priority " << static_cast<int>(m_priority) << std::endl;
     #endif
-    m_vision = vision;
+    m_capture = capture;
     start();
 }
 
@@ -45,9 +47,10 @@ SaveImagesThread::~SaveImagesThread()
     #if DEBUG_VISION_VERBOSITY > 0
         debug << "SaveImagesThread::~SaveImagesThread()" << std::endl;
     #endif
+    stop();
 }
 
-/*! @brief The save images main loop
+/*! @brief The save images main loop. It exits once the capture is stopping.
  
  */
 void SaveImagesThread::run()
@@ -55,15 +58,21 @@ void SaveImagesThread::run()
     #if DEBUG_VISION_VERBOSITY > 0
         debug << "SaveImagesThread::run()" << std::endl;
     #endif
-    
-    int err = 0;
-    while (err == 0 && errno != EINTR)
+    // a new thread inherits the policy of the thread that created it, and the writer must never compete with vision
+    sched_param param;
+    param.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+    // the thread only checks whether it is stopping after it has been signalled, so it is always back in wait() when the capture signals it to stop
+    wait();
+    while (not m_capture->isStopping())
     {
-        wait();
         // -----------------------------------------------------------------------------------------------------------------------------------------------------------------
-        m_vision->saveAnImage();
+        m_capture->writePending();
         // -----------------------------------------------------------------------------------------------------------------------------------------------------------------
-        
-    } 
-    errorlog << "SaveImagesThread is exiting. err: " << err << " errno: " << errno << std::endl;
+        wait();
+    }
+    #if DEBUG_VISION_VERBOSITY > 0
+        debug << "SaveImagesThread is exiting." << std::endl;
+    #endif
 }
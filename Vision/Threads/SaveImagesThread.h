@@ -2,7 +2,7 @@
     @brief Declaration of a simple low priority thread for saving images.
 
     @class SaveImagesThread
-    @brief A simple thread to save images when requested
+    @brief A simple thread to write the images queued by an ImageCapture, in the order they were captured
  
     @author Jason Kulk
  
@@ -27,20 +27,20 @@
 
 #include "Tools/Threading/ConditionalThread.h"
 
-class VisionControlWrapper;
+class ImageCapture;
 
 /*! @brief The top-level class
  */
 class SaveImagesThread : public ConditionalThread
 {
 public:
-    SaveImagesThread(VisionControlWrapper* vision);
+    SaveImagesThread(ImageCapture* capture);
     ~SaveImagesThread();
 protected:
     void run();
     
 private:
-    VisionControlWrapper* m_vision;
+    ImageCapture* m_capture;
 };
 
 #endif
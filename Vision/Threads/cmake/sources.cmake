@@ -22,6 +22,8 @@ ENDIF()
 ########## List your source files here! ############################################
 SET (YOUR_SRCS
 SaveImagesThread
+ImageEncoderThread
+ImageCapture
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
@@ -179,6 +179,7 @@ HEADERS += \
     visionblackboard.h \
     visioncontroller.h \
     visionconstants.h \
+    visioncontext.h \
     #Threads/SaveImagesThread.h
     GenericAlgorithms/ransac.h \
     Modules/GoalDetectionAlgorithms/goaldetectorhistogram.h \
@@ -207,6 +208,7 @@ SOURCES += \
     Modules/GoalDetectionAlgorithms/goaldetectorransacedges.cpp \
     Modules/BallDetectionAlgorithms/balldetectordave.cpp \
     Modules/BallDetectionAlgorithms/balldetectorshannon.cpp \
+    Modules/BallDetectionAlgorithms/ballcandidateevaluator.cpp \
     VisionTypes/colourreplacementrule.cpp \
     VisionTypes/coloursegment.cpp \
     VisionTypes/colourtransitionrule.cpp \
@@ -229,6 +231,7 @@ SOURCES += \
     visionblackboard.cpp \
     visioncontroller.cpp \
     visionconstants.cpp \
+    visioncontext.cpp \
     main.cpp \
     basicvisiontypes.cpp \
     GenericAlgorithms/ransac.template \
@@ -243,6 +246,8 @@ SOURCES += \
 HEADERS += \
     ../Tools/FileFormats/LUTTools.h \
     ../Tools/Optimisation/Parameter.h \
+    ../Tools/Profiling/Tracer.h \
+    ../Tools/Profiling/TraceRegistry.h \
     ../Tools/Math/Line.h \
     ../Tools/Math/LSFittedLine.h \
     ../Tools/Math/Matrix.h \
@@ -270,6 +275,7 @@ HEADERS += \
 SOURCES += \
     ../Tools/FileFormats/LUTTools.cpp \
     ../Tools/Optimisation/Parameter.cpp \
+    ../Tools/Profiling/Tracer.cpp \
     ../Tools/Math/Line.cpp \
     ../Tools/Math/LSFittedLine.cpp \
     ../Tools/Math/Matrix.cpp \
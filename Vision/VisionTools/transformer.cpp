@@ -19,28 +19,82 @@ Transformer::Transformer()
     image_centre = Vector2<double>(0,0);
     tan_half_FOV = Vector2<double>(0,0);
     screen_to_radial_factor = Vector2<double>(0,0);
+
+    for(int i=0; i<3; i++) {
+        m_cam_position[i] = 0;
+        for(int j=0; j<3; j++) {
+            m_cam_rotation[i][j] = (i == j) ? 1 : 0;
+            m_ground_homography[i][j] = 0;
+        }
+    }
+
+    m_distortion_lut_size = Vector2<double>(0,0);
+    m_distortion_lut_coefficient = 0;
 }
 
 /**
   * Applies radial distortion correction to the given pixel location.
+  * Integer pixel locations are served from a table built once per image size.
   * @param pt The pixel location to correct.
   */
 Vector2<double> Transformer::correctDistortion(const Vector2<double>& pt)
+{
+    updateDistortionLUT();
+
+    int x = static_cast<int>(pt.x);
+    int y = static_cast<int>(pt.y);
+    if(x == pt.x && y == pt.y && x >= 0 && y >= 0 && x < m_distortion_lut_size.x && y < m_distortion_lut_size.y) {
+        const Vector2<float>& corrected = m_distortion_lut[y*static_cast<int>(m_distortion_lut_size.x) + x];
+        return Vector2<double>(corrected.x, corrected.y);
+    }
+    return calculateDistortion(pt);
+}
+
+/**
+  * Applies radial distortion correction to each of the given pixel locations.
+  * @param pts The pixel locations to correct, modified in place.
+  */
+void Transformer::correctDistortion(std::vector<Point>& pts)
+{
+    for(Point& p : pts) {
+        p = correctDistortion(p);
+    }
+}
+
+Vector2<double> Transformer::calculateDistortion(const Vector2<double>& pt) const
 {
     //get position relative to centre
     Vector2<double> half_size = image_size*0.5;
     Vector2<double> centre_relative = pt - half_size;
     //calculate correction factor -> 1+kr^2
-    double corr_factor = 1 + VisionConstants::RADIAL_CORRECTION_COEFFICIENT*centre_relative.squareAbs();
+    double corr_factor = 1 + VisionConstants::get().RADIAL_CORRECTION_COEFFICIENT*centre_relative.squareAbs();
     //multiply by factor
     Vector2<double> result = centre_relative*corr_factor;
     //scale the edges back out to meet again
-    result.x /= (1+VisionConstants::RADIAL_CORRECTION_COEFFICIENT*half_size.x*half_size.x);
-    result.y /= (1+VisionConstants::RADIAL_CORRECTION_COEFFICIENT*half_size.y*half_size.y);
+    result.x /= (1+VisionConstants::get().RADIAL_CORRECTION_COEFFICIENT*half_size.x*half_size.x);
+    result.y /= (1+VisionConstants::get().RADIAL_CORRECTION_COEFFICIENT*half_size.y*half_size.y);
     //get the original position back from the centre relative position
     return result + half_size;
 }
 
+void Transformer::updateDistortionLUT()
+{
+    if(m_distortion_lut_size == image_size && m_distortion_lut_coefficient == VisionConstants::get().RADIAL_CORRECTION_COEFFICIENT)
+        return;
+
+    int width = static_cast<int>(image_size.x);
+    int height = static_cast<int>(image_size.y);
+    m_distortion_lut.resize(width*height);
+    for(int y=0; y<height; y++) {
+        for(int x=0; x<width; x++) {
+            Vector2<double> corrected = calculateDistortion(Vector2<double>(x, y));
+            m_distortion_lut[y*width + x] = Vector2<float>(corrected.x, corrected.y);
+        }
+    }
+    m_distortion_lut_size = image_size;
+    m_distortion_lut_coefficient = VisionConstants::get().RADIAL_CORRECTION_COEFFICIENT;
+}
+
 void Transformer::preCalculateTransforms()
 {
     // Reminder for axes
@@ -86,6 +140,43 @@ void Transformer::preCalculateTransforms()
 
     camVector = (headV2RobotRotation * camOffsetVec) + neckV;
     camV2RobotRotation = headV2RobotRotation * camera_pitch_rot * camera_roll_rot * camera_yaw_rot;
+
+    for(int i=0; i<3; i++) {
+        m_cam_position[i] = camVector[i][0];
+        for(int j=0; j<3; j++)
+            m_cam_rotation[i][j] = camV2RobotRotation[i][j];
+    }
+    preCalculateProjection();
+}
+
+void Transformer::preCalculateProjection()
+{
+    // The ray through pixel (x,y) in the camera frame is [f, cx - x, cy - y], i.e. K*[x, y, 1] with
+    //      K = | 0  0  f |
+    //          |-1  0 cx |
+    //          | 0 -1 cy |
+    // so the robot relative ray is (R*K)*[x, y, 1]. Store R*K so each point costs a 3x3 multiply.
+    for(int i=0; i<3; i++) {
+        m_ground_homography[i][0] = -m_cam_rotation[i][1];
+        m_ground_homography[i][1] = -m_cam_rotation[i][2];
+        m_ground_homography[i][2] = m_cam_rotation[i][0]*effective_camera_dist_pixels
+                                    + m_cam_rotation[i][1]*image_centre.x
+                                    + m_cam_rotation[i][2]*image_centre.y;
+    }
+}
+
+/**
+  * Intersects the ray through the given pixel with the horizontal plane at object_height.
+  * @return The intersection relative to the neck, in robot cartesian coordinates.
+  */
+Vector3<double> Transformer::projectToPlane(double x, double y, double object_height) const
+{
+    const double dx = m_ground_homography[0][0]*x + m_ground_homography[0][1]*y + m_ground_homography[0][2];
+    const double dy = m_ground_homography[1][0]*x + m_ground_homography[1][1]*y + m_ground_homography[1][2];
+    const double dz = m_ground_homography[2][0]*x + m_ground_homography[2][1]*y + m_ground_homography[2][2];
+
+    const double alpha = (object_height - m_cam_position[2]) / dz;
+    return Vector3<double>(alpha*dx + m_cam_position[0], alpha*dy + m_cam_position[1], object_height - m_cam_position[2]);
 }
 
 void Transformer::calculateRepresentationsFromPixelLocation(NUPoint& pt, bool known_distance, double val) const
@@ -96,24 +187,52 @@ void Transformer::calculateRepresentationsFromPixelLocation(NUPoint& pt, bool kn
 
     if(known_distance) {
         // In this case val represents known distance (for e.g. found by perspective comparison)
-        Matrix image_position_spherical(Vector3<double>(val, pt.screenAngular.x, pt.screenAngular.y));
-        Matrix rel_spherical = mathGeneral::Cartesian2Spherical(camV2RobotRotation * mathGeneral::Spherical2Cartesian(image_position_spherical));
-        pt.neckRelativeRadial = Vector3<double>(rel_spherical[0][0], rel_spherical[1][0], rel_spherical[2][0]);
+        Vector3<double> image_position = mathGeneral::Spherical2Cartesian(Vector3<double>(val, pt.screenAngular.x, pt.screenAngular.y));
+        Vector3<double> rel_position(m_cam_rotation[0][0]*image_position.x + m_cam_rotation[0][1]*image_position.y + m_cam_rotation[0][2]*image_position.z,
+                                     m_cam_rotation[1][0]*image_position.x + m_cam_rotation[1][1]*image_position.y + m_cam_rotation[1][2]*image_position.z,
+                                     m_cam_rotation[2][0]*image_position.x + m_cam_rotation[2][1]*image_position.y + m_cam_rotation[2][2]*image_position.z);
+        pt.neckRelativeRadial = mathGeneral::Cartesian2Spherical(rel_position);
+
+        pt.groundCartesian.x = cos(pt.neckRelativeRadial.z) * cos(pt.neckRelativeRadial.y) * pt.neckRelativeRadial.x;
+        pt.groundCartesian.y = cos(pt.neckRelativeRadial.z) * sin(pt.neckRelativeRadial.y) * pt.neckRelativeRadial.x;
     }
     else {
-        // In this case val represents known height
-        // Calculate the radial position relative to
-        pt.neckRelativeRadial = distanceToPoint(pt.screenCartesian, val);
+        // In this case val represents known height, and the ground position falls straight out of the projection
+        Vector3<double> v = projectToPlane(pt.screenCartesian.x, pt.screenCartesian.y, val);
+        pt.neckRelativeRadial.x = sqrt(v.x*v.x + v.y*v.y + v.z*v.z);
+        pt.neckRelativeRadial.y = atan2(v.y, v.x);
+        pt.neckRelativeRadial.z = asin(v.z / pt.neckRelativeRadial.x);
+
+        pt.groundCartesian.x = v.x;
+        pt.groundCartesian.y = v.y;
     }
-
-    pt.groundCartesian.x = cos(pt.neckRelativeRadial.z) * cos(pt.neckRelativeRadial.y) * pt.neckRelativeRadial.x;
-    pt.groundCartesian.y = cos(pt.neckRelativeRadial.z) * sin(pt.neckRelativeRadial.y) * pt.neckRelativeRadial.x;
 }
 
+/**
+  * Calculates the representations for an array of pixel locations.
+  * The projection is built once per frame in preCalculateTransforms, so this is a tight loop
+  * with no temporaries per point.
+  */
 void Transformer::calculateRepresentationsFromPixelLocation(std::vector<NUPoint>& pts, bool known_distance, double val) const
 {
-    BOOST_FOREACH(NUPoint& p, pts) {
-        calculateRepresentationsFromPixelLocation(p, known_distance, val);
+    if(known_distance) {
+        for(NUPoint& p : pts)
+            calculateRepresentationsFromPixelLocation(p, known_distance, val);
+        return;
+    }
+
+    const size_t n = pts.size();
+    for(size_t i=0; i<n; i++) {
+        NUPoint& p = pts[i];
+        p.screenAngular.x = atan( (image_centre.x-p.screenCartesian.x) * screen_to_radial_factor.x);
+        p.screenAngular.y = atan( (image_centre.y-p.screenCartesian.y) * screen_to_radial_factor.y);
+
+        Vector3<double> v = projectToPlane(p.screenCartesian.x, p.screenCartesian.y, val);
+        p.neckRelativeRadial.x = sqrt(v.x*v.x + v.y*v.y + v.z*v.z);
+        p.neckRelativeRadial.y = atan2(v.y, v.x);
+        p.neckRelativeRadial.z = asin(v.z / p.neckRelativeRadial.x);
+        p.groundCartesian.x = v.x;
+        p.groundCartesian.y = v.y;
     }
 }
 
@@ -187,20 +306,12 @@ void Transformer::calculateRepresentationsFromGroundCartesianLocation(std::vecto
   */
 Vector3<double> Transformer::distanceToPoint(Vector2<double> pixel, double object_height) const
 {
-    Vector3<double> result;
-
-    Matrix vcam(3,1,false);
-    vcam[0][0] = effective_camera_dist_pixels;
-    vcam[1][0] = image_size.x / 2.0 - pixel.x;
-    vcam[2][0] = image_size.y / 2.0 - pixel.y;
-
-    Matrix roboVdir = camV2RobotRotation * vcam;
-    double alpha = (object_height - camVector[2][0]) / roboVdir[2][0];
-    Matrix v2FieldPoint = alpha * roboVdir + camVector;
+    Vector3<double> v = projectToPlane(pixel.x, pixel.y, object_height);
 
-    result.x = std::sqrt(pow(v2FieldPoint[0][0], 2) + std::pow(v2FieldPoint[1][0], 2) + std::pow(object_height - (double)camVector[2][0], 2));
-    result.y = std::atan2((double)v2FieldPoint[1][0], (double)v2FieldPoint[0][0]);
-    result.z = std::asin((object_height - (double)camVector[2][0]) / (double)result.x);
+    Vector3<double> result;
+    result.x = std::sqrt(v.x*v.x + v.y*v.y + v.z*v.z);
+    result.y = std::atan2(v.y, v.x);
+    result.z = std::asin(v.z / result.x);
     return result;
 }
 
@@ -264,6 +375,8 @@ void Transformer::setCamParams(Vector2<double> imagesize, Vector2<double> fov)
 
     effective_camera_dist_pixels = image_centre.x/tan_half_FOV.x;
 
+    preCalculateProjection();
+
 //   cout << "Transformer: imagesize: " << image_size <<
 //            " centre: " << image_centre <<
 //            " FOV: " << FOV <<
@@ -33,6 +33,7 @@ public:
 
     //2D distortion transform
     Vector2<double> correctDistortion(const Vector2<double>& pt);
+    void correctDistortion(std::vector<Point>& pts);
 
     void calculateRepresentationsFromPixelLocation(NUPoint& pt, bool known_distance = false, double val = 0.0) const;
     void calculateRepresentationsFromPixelLocation(std::vector<NUPoint>& pts, bool known_distance = false, double val = 0.0) const;
@@ -53,6 +54,14 @@ private:
     void setSensors(double new_head_pitch, double new_head_yaw, double new_body_roll, double new_body_pitch, Vector3<double> new_neck_position);
 
     void preCalculateTransforms();
+    //! Builds the pixel to ground-ray homography from the cached camera rotation and camera parameters.
+    void preCalculateProjection();
+    //! Rebuilds the undistortion table if the image size or correction coefficient has changed.
+    void updateDistortionLUT();
+    Vector2<double> calculateDistortion(const Vector2<double>& pt) const;
+
+    //! Projects a pixel onto the plane at the given height, returning the camera relative intersection.
+    Vector3<double> projectToPlane(double x, double y, double object_height) const;
 
     void screenToRadial3D(NUPoint &pt, double distance) const;
     NUPoint screenToRadial3D(const Point &pt, double distance) const;
@@ -94,6 +103,16 @@ private:
     double body_roll;
     double body_pitch;
     Vector3<double> neck_position;
+
+    // Per-frame projection cache, rebuilt by preCalculateTransforms and setCamParams.
+    double m_cam_rotation[3][3];    //! @variable camV2RobotRotation as a plain array for the per-point paths.
+    double m_cam_position[3];       //! @variable camVector as a plain array.
+    double m_ground_homography[3][3];   //! @variable Maps homogeneous pixel coordinates to robot relative ray directions.
+
+    // Undistortion lookup table for the current image size.
+    std::vector< Vector2<float> > m_distortion_lut;
+    Vector2<double> m_distortion_lut_size;
+    double m_distortion_lut_coefficient;
 };
 
 #endif // TRANSFORMER_H
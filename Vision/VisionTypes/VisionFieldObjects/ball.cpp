@@ -29,7 +29,7 @@ Ball::Ball(Point centre, double diameter)
     Point right_pt = Point(right, (bottom-top)*0.5);
     Point left_pt = Point(left, (bottom-top)*0.5);
 
-    //    if(VisionConstants::DO_RADIAL_CORRECTION) {
+    //    if(VisionConstants::get().DO_RADIAL_CORRECTION) {
     //        VisionBlackboard* vbb = VisionBlackboard::getInstance();
     //        top_pt = vbb->correctDistortion(top_pt);
     //        bottom_pt = vbb->correctDistortion(bottom_pt);
@@ -86,7 +86,7 @@ bool Ball::check() const
     //various throwouts here
 
     //throwout for below horizon
-    if(VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_BALL and
+    if(VisionConstants::get().THROWOUT_ON_ABOVE_KIN_HOR_BALL and
        not VisionBlackboard::getInstance()->getKinematicsHorizon().IsBelowHorizon(m_location.screenCartesian.x, m_location.screenCartesian.y)) {
         errorlog << "Ball::check() - Ball above horizon: should not occur" << std::endl;
         #if VISION_BALL_VERBOSITY > 1
@@ -96,31 +96,31 @@ bool Ball::check() const
     }
     
     //Distance discrepency throwout - if width method says ball is a lot closer than d2p (by specified value) then discard
-//    if(VisionConstants::THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BALL and
-//            std::abs(width_dist - d2p) > VisionConstants::MAX_DISTANCE_METHOD_DISCREPENCY_BALL) {
+//    if(VisionConstants::get().THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BALL and
+//            std::abs(width_dist - d2p) > VisionConstants::get().MAX_DISTANCE_METHOD_DISCREPENCY_BALL) {
 //        #if VISION_BALL_VERBOSITY > 1
 //        debug << "Ball::check - Ball thrown out: width distance too much smaller than d2p" << std::endl;
-//            debug << "\td2p: " << d2p << " width_dist: " << width_dist << " MAX_DISTANCE_METHOD_DISCREPENCY_BALL: " << VisionConstants::MAX_DISTANCE_METHOD_DISCREPENCY_BALL << std::endl;
+//            debug << "\td2p: " << d2p << " width_dist: " << width_dist << " MAX_DISTANCE_METHOD_DISCREPENCY_BALL: " << VisionConstants::get().MAX_DISTANCE_METHOD_DISCREPENCY_BALL << std::endl;
 //        #endif
 //        return false;
 //    }
 
     //throw out if ball is too small
-    if(VisionConstants::THROWOUT_SMALL_BALLS and 
-        m_diameter < VisionConstants::MIN_BALL_DIAMETER_PIXELS) {
+    if(VisionConstants::get().THROWOUT_SMALL_BALLS and 
+        m_diameter < VisionConstants::get().MIN_BALL_DIAMETER_PIXELS) {
         #if VISION_BALL_VERBOSITY > 1
             debug << "Ball::check - Ball thrown out: too small" << std::endl;
-            debug << "\tdiameter: " << m_diameter << " MIN_BALL_DIAMETER_PIXELS: " << VisionConstants::MIN_BALL_DIAMETER_PIXELS << std::endl;
+            debug << "\tdiameter: " << m_diameter << " MIN_BALL_DIAMETER_PIXELS: " << VisionConstants::get().MIN_BALL_DIAMETER_PIXELS << std::endl;
         #endif
         return false;
     }
     
     //throw out if ball is too far away
-    if(VisionConstants::THROWOUT_DISTANT_BALLS and 
-        m_location.neckRelativeRadial.x > VisionConstants::MAX_BALL_DISTANCE) {
+    if(VisionConstants::get().THROWOUT_DISTANT_BALLS and 
+        m_location.neckRelativeRadial.x > VisionConstants::get().MAX_BALL_DISTANCE) {
         #if VISION_BALL_VERBOSITY > 1
             debug << "Ball::check - Ball thrown out: too far away" << std::endl;
-            debug << "\tdistance: " << m_location.neckRelativeRadial.x << " MAX_BALL_DISTANCE: " << VisionConstants::MAX_BALL_DISTANCE << std::endl;
+            debug << "\tdistance: " << m_location.neckRelativeRadial.x << " MAX_BALL_DISTANCE: " << VisionConstants::get().MAX_BALL_DISTANCE << std::endl;
         #endif
         return false;
     }
@@ -149,12 +149,12 @@ bool Ball::calculatePositions()
     d2p_loc.screenCartesian = m_location.screenCartesian;
     width_loc.screenCartesian = m_location.screenCartesian;
 
-    double width_dist = VisionConstants::BALL_WIDTH*tran.getCameraDistanceInPixels()/m_size_on_screen.x;
+    double width_dist = VisionConstants::get().BALL_WIDTH*tran.getCameraDistanceInPixels()/m_size_on_screen.x;
 
     tran.calculateRepresentationsFromPixelLocation(d2p_loc);
     tran.calculateRepresentationsFromPixelLocation(width_loc, true, width_dist);
 
-    switch(VisionConstants::BALL_DISTANCE_METHOD) {
+    switch(VisionConstants::get().BALL_DISTANCE_METHOD) {
         case D2P:
             m_location = d2p_loc;
             break;
@@ -203,16 +203,16 @@ bool Ball::calculatePositions()
 //            debug << "Ball::distanceToGoal: d2p invalid - combination methods will only return width_dist" << std::endl;
 //    #endif
 //    //get distance from width
-//    width_dist = VisionConstants::BALL_WIDTH*tran.getCameraDistanceInPixels()/m_size_on_screen.x;
+//    width_dist = VisionConstants::get().BALL_WIDTH*tran.getCameraDistanceInPixels()/m_size_on_screen.x;
 
 //    #if VISION_BALL_VERBOSITY > 1
 //        debug << "Ball::distanceToGoal: bearing: " << bearing << " elevation: " << elevation << std::endl;
 //        debug << "Ball::distanceToGoal: d2p: " << d2p << std::endl;
 //        debug << "Ball::distanceToGoal: m_size_on_screen.x: " << m_size_on_screen.x << std::endl;
 //        debug << "Ball::distanceToGoal: width_dist: " << width_dist << std::endl;
-//        debug << "Ball::distanceToGoal: Method: " << getDistanceMethodName(VisionConstants::BALL_DISTANCE_METHOD) << std::endl;
+//        debug << "Ball::distanceToGoal: Method: " << getDistanceMethodName(VisionConstants::get().BALL_DISTANCE_METHOD) << std::endl;
 //    #endif
-//    switch(VisionConstants::BALL_DISTANCE_METHOD) {
+//    switch(VisionConstants::get().BALL_DISTANCE_METHOD) {
 //    case D2P:
 //        distance_valid = d2pvalid && d2p > 0;
 //        result = d2p;
@@ -13,7 +13,7 @@
 //    m_id = id;
 //    m_corners = corners;
     
-//    //    if(VisionConstants::DO_RADIAL_CORRECTION) {
+//    //    if(VisionConstants::get().DO_RADIAL_CORRECTION) {
 //    //        VisionBlackboard* vbb = VisionBlackboard::getInstance();
 //    //        Vector2<float> corr_bottom_centre = vbb->correctDistortion(Vector2<float>(m_bottom_centre.x, m_bottom_centre.y));
 //    //        m_bottom_centre.x = mathGeneral::roundNumberToInt(corr_bottom_centre.x);
@@ -113,7 +113,7 @@
 ////    }
 
 //    //throwout for base below horizon
-//    if(VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_BEACONS and
+//    if(VisionConstants::get().THROWOUT_ON_ABOVE_KIN_HOR_BEACONS and
 //       not VisionBlackboard::getInstance()->getKinematicsHorizon().IsBelowHorizon(m_location_pixels.x, m_location_pixels.y)) {
 //        #if VISION_BEACON_VERBOSITY > 1
 //            debug << "Beacon::check - Beacon thrown out: base above kinematics horizon" << std::endl;
@@ -122,21 +122,21 @@
 //    }
 
 //    //Distance discrepency throwout - if width method says Beacon is a lot closer than d2p (by specified value) then discard
-//    if(VisionConstants::THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BEACONS and
-//            width_dist + VisionConstants::MAX_DISTANCE_METHOD_DISCREPENCY_BEACONS < d2p) {
+//    if(VisionConstants::get().THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BEACONS and
+//            width_dist + VisionConstants::get().MAX_DISTANCE_METHOD_DISCREPENCY_BEACONS < d2p) {
 //        #if VISION_BEACON_VERBOSITY > 1
 //        debug << "Beacon::check - Beacon thrown out: width distance too much smaller than d2p" << std::endl;
-//            debug << "\td2p: " << d2p << " width_dist: " << width_dist << " MAX_DISTANCE_METHOD_DISCREPENCY_BEACONS: " << VisionConstants::MAX_DISTANCE_METHOD_DISCREPENCY_BEACONS << std::endl;
+//            debug << "\td2p: " << d2p << " width_dist: " << width_dist << " MAX_DISTANCE_METHOD_DISCREPENCY_BEACONS: " << VisionConstants::get().MAX_DISTANCE_METHOD_DISCREPENCY_BEACONS << std::endl;
 //        #endif
 //        return false;
 //    }
 
 //    //throw out if Beacon is too far away
-//    if(VisionConstants::THROWOUT_DISTANT_BEACONS and
-//        m_transformed_spherical_pos.x > VisionConstants::MAX_BEACON_DISTANCE) {
+//    if(VisionConstants::get().THROWOUT_DISTANT_BEACONS and
+//        m_transformed_spherical_pos.x > VisionConstants::get().MAX_BEACON_DISTANCE) {
 //        #if VISION_BEACON_VERBOSITY > 1
 //            debug << "Beacon::check - Beacon thrown out: too far away" << std::endl;
-//            debug << "\td2p: " << m_transformed_spherical_pos.x << " MAX_BEACON_DISTANCE: " << VisionConstants::MAX_BEACON_DISTANCE << std::endl;
+//            debug << "\td2p: " << m_transformed_spherical_pos.x << " MAX_BEACON_DISTANCE: " << VisionConstants::get().MAX_BEACON_DISTANCE << std::endl;
 //        #endif
 //        return false;
 //    }
@@ -227,7 +227,7 @@
 //            debug << "Beacon::distanceToBeacon: d2p invalid - combination methods will only return width_dist" << std::endl;
 //    #endif
 //    //get distance from width
-//    width_dist = VisionConstants::BEACON_WIDTH*vbb->getCameraDistanceInPixels()/m_size_on_screen.x;
+//    width_dist = VisionConstants::get().BEACON_WIDTH*vbb->getCameraDistanceInPixels()/m_size_on_screen.x;
 
 //    #if VISION_BEACON_VERBOSITY > 1
 //        debug << "Beacon::distanceToBeacon: bearing: " << bearing << " elevation: " << elevation << std::endl;
@@ -235,20 +235,20 @@
 //        debug << "Beacon::distanceToBeacon: m_size_on_screen.x: " << m_size_on_screen.x << std::endl;
 //        debug << "Beacon::distanceToBeacon: width_dist: " << width_dist << std::endl;
 //    #endif
-//    switch(VisionConstants::BEACON_DISTANCE_METHOD) {
-//    case VisionConstants::D2P:
+//    switch(VisionConstants::get().BEACON_DISTANCE_METHOD) {
+//    case VisionConstants::get().D2P:
 //        #if VISION_BEACON_VERBOSITY > 1
 //            debug << "Beacon::distanceToBeacon: Method: D2P" << std::endl;
 //        #endif
 //        distance_valid = d2pvalid;
 //        return d2p;
-//    case VisionConstants::Width:
+//    case VisionConstants::get().Width:
 //        #if VISION_BEACON_VERBOSITY > 1
 //            debug << "Beacon::distanceToBeacon: Method: Width" << std::endl;
 //        #endif
 //        distance_valid = true;
 //        return width_dist;
-//    case VisionConstants::Average:
+//    case VisionConstants::get().Average:
 //        #if VISION_BEACON_VERBOSITY > 1
 //            debug << "Beacon::distanceToBeacon: Method: Average" << std::endl;
 //        #endif
@@ -258,7 +258,7 @@
 //            return (d2p + width_dist) * 0.5;
 //        else
 //            return width_dist;
-//    case VisionConstants::Least:
+//    case VisionConstants::get().Least:
 //        #if VISION_BEACON_VERBOSITY > 1
 //            debug << "Beacon::distanceToBeacon: Method: Least" << std::endl;
 //        #endif
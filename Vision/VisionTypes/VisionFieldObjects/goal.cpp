@@ -17,7 +17,7 @@ Goal::Goal(VFO_ID id, const Quad &corners, bool known)
     m_location.screenCartesian = corners.getBottomCentre();
     m_size_on_screen = Vector2<double>(corners.getAverageWidth(), corners.getAverageHeight());
 
-//    if(VisionConstants::DO_RADIAL_CORRECTION) {
+//    if(VisionConstants::get().DO_RADIAL_CORRECTION) {
 //        VisionBlackboard* vbb = VisionBlackboard::getInstance();
 //        Vector2<float> corr_bottom_centre = vbb->correctDistortion(Vector2<float>(m_bottom_centre.x, m_bottom_centre.y));
 //        m_bottom_centre.x = mathGeneral::roundNumberToInt(corr_bottom_centre.x);
@@ -149,8 +149,8 @@ bool Goal::addToExternalFieldObjects(FieldObjects *fieldobjects, float timestamp
 bool Goal::check() const
 {
     //various throwouts here
-    if(VisionConstants::THROWOUT_SHORT_GOALS) {
-        if(m_corners.getAverageHeight() <= VisionConstants::MIN_GOAL_HEIGHT) {
+    if(VisionConstants::get().THROWOUT_SHORT_GOALS) {
+        if(m_corners.getAverageHeight() <= VisionConstants::get().MIN_GOAL_HEIGHT) {
             #if VISION_GOAL_VERBOSITY > 1
                 debug << "Goal::check - Goal thrown out: less than 20pix high" << std::endl;
             #endif
@@ -158,17 +158,17 @@ bool Goal::check() const
         }
     }
     
-    if(VisionConstants::THROWOUT_NARROW_GOALS) {
-        if(m_corners.getAverageWidth() <= VisionConstants::MIN_GOAL_WIDTH) {
+    if(VisionConstants::get().THROWOUT_NARROW_GOALS) {
+        if(m_corners.getAverageWidth() <= VisionConstants::get().MIN_GOAL_WIDTH) {
             #if VISION_GOAL_VERBOSITY > 1
-                debug << "Goal::check - Goal thrown out: less than " << VisionConstants::MIN_GOAL_WIDTH << "pix high" << std::endl;
+                debug << "Goal::check - Goal thrown out: less than " << VisionConstants::get().MIN_GOAL_WIDTH << "pix high" << std::endl;
             #endif
             return false;
         }
     }
 
     //throwout for base below horizon
-    if(VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_GOALS and
+    if(VisionConstants::get().THROWOUT_ON_ABOVE_KIN_HOR_GOALS and
        not VisionBlackboard::getInstance()->getKinematicsHorizon().IsBelowHorizon(m_location.screenCartesian.x, m_location.screenCartesian.y)) {
         #if VISION_GOAL_VERBOSITY > 1
             debug << "Goal::check - Goal thrown out: base above kinematics horizon" << std::endl;
@@ -177,11 +177,11 @@ bool Goal::check() const
     }
 
     //throw out if goal is too far away
-    if(VisionConstants::THROWOUT_DISTANT_GOALS and 
-        m_location.neckRelativeRadial.x > VisionConstants::MAX_GOAL_DISTANCE) {
+    if(VisionConstants::get().THROWOUT_DISTANT_GOALS and 
+        m_location.neckRelativeRadial.x > VisionConstants::get().MAX_GOAL_DISTANCE) {
         #if VISION_GOAL_VERBOSITY > 1
             debug << "Goal::check - Goal thrown out: too far away" << std::endl;
-            debug << "\td2p: " << m_location.neckRelativeRadial.x << " MAX_GOAL_DISTANCE: " << VisionConstants::MAX_GOAL_DISTANCE << std::endl;
+            debug << "\td2p: " << m_location.neckRelativeRadial.x << " MAX_GOAL_DISTANCE: " << VisionConstants::get().MAX_GOAL_DISTANCE << std::endl;
         #endif
         return false;
     }
@@ -218,8 +218,8 @@ bool Goal::calculatePositions()
     height_loc.screenCartesian = m_location.screenCartesian;
 
     //get distance from width
-    width_dist = VisionConstants::GOAL_WIDTH*tran.getCameraDistanceInPixels()/m_size_on_screen.x;
-    //height_dist = VisionConstants::GOAL_HEIGHT*tran.getCameraDistanceInPixels()/m_size_on_screen.y;
+    width_dist = VisionConstants::get().GOAL_WIDTH*tran.getCameraDistanceInPixels()/m_size_on_screen.x;
+    //height_dist = VisionConstants::get().GOAL_HEIGHT*tran.getCameraDistanceInPixels()/m_size_on_screen.y;
 
     // D2P
     tran.calculateRepresentationsFromPixelLocation(d2p_loc);
@@ -257,7 +257,7 @@ bool Goal::calculatePositions()
     else
     {
         // use method of choice
-        switch(VisionConstants::GOAL_DISTANCE_METHOD) {
+        switch(VisionConstants::get().GOAL_DISTANCE_METHOD) {
             case D2P:
                 m_location = d2p_loc;
                 break;
@@ -14,7 +14,7 @@ Obstacle::Obstacle(Point position, double width, double height, COLOUR_CLASS col
     m_location.screenCartesian = position;
     m_size_on_screen = Vector2<double>(width, height);
     m_colour = colour;
-//    if(VisionConstants::DO_RADIAL_CORRECTION) {
+//    if(VisionConstants::get().DO_RADIAL_CORRECTION) {
 //        VisionBlackboard* vbb = VisionBlackboard::getInstance();
 //        Vector2<float> bottomcentre = Vector2<float>(position.x, position.y);
 
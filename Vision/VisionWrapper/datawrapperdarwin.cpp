@@ -9,10 +9,12 @@
 #include "Infrastructure/NUActionatorsData/NUActionatorsData.h"
 #include "NUPlatform/NUActionators/NUSounds.h"
 #include "Kinematics/Kinematics.h"
+#include "Kinematics/AttitudeHistory.h"
 
 #include "Vision/VisionTypes/coloursegment.h"
 #include "Vision/basicvisiontypes.h"
 #include "Vision/visionconstants.h"
+#include "Vision/Threads/ImageCapture.h"
 
 #include <boost/foreach.hpp>
 #include <boost/accumulators/accumulators.hpp>
@@ -35,9 +37,10 @@ DataWrapper::DataWrapper()
     Blackboard->lookForGoals = true; //initialise
     isSavingImages = false;
     isSavingImagesWithVaryingSettings = false;
+    m_image_capture = new ImageCapture();
 
     debug << "Loading from: " << std::string(CONFIG_DIR) + std::string("VisionOptions.cfg") << std::endl;
-    VisionConstants::loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
+    VisionConstants::get().loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
 
     std::string sen_calib_name = std::string(CONFIG_DIR) + std::string("SensorCalibration.cfg");
 
@@ -50,6 +53,7 @@ DataWrapper::DataWrapper()
 
 DataWrapper::~DataWrapper()
 {
+    delete m_image_capture;
 }
 
 DataWrapper* DataWrapper::getInstance()
@@ -376,6 +380,13 @@ bool DataWrapper::updateFrame()
         errorlog << "DataWrapperDarwin - updateFrame() - failed to get head yaw from NUSensorsData" << std::endl;
     if(!sensor_data->getOrientation(orientation))
         errorlog << "DataWrapperDarwin - updateFrame() - failed to get orientation from NUSensorsData" << std::endl;
+    // use the body attitude at the time the image was captured, rather than the latest sensor update
+    float roll, pitch;
+    if (AttitudeHistory::Instance().get(m_timestamp, roll, pitch))
+    {
+        orientation[0] = roll;
+        orientation[1] = pitch;
+    }
     m_orientation = Vector3<float>(orientation.at(0), orientation.at(1), orientation.at(2));
 
     vector<float> left, right;
@@ -441,16 +452,13 @@ void DataWrapper::process(JobList* jobs)
                 if(job->saving() == true) {
                     //we weren't saving and now we've started
                     currentSettings = current_frame->getCameraSettings();
-                    if (!imagefile.is_open())
-                        imagefile.open((std::string(DATA_DIR) + std::string("image.strm")).c_str());
-                    if (!sensorfile.is_open())
-                        sensorfile.open((std::string(DATA_DIR) + std::string("sensor.strm")).c_str());
+                    NUImageCodec::Format format = NUImageCodec::getFormatFromName(VisionConstants::get().SAVE_IMAGES_FORMAT);
+                    m_image_capture->start(std::string(DATA_DIR), format, VisionConstants::get().SAVE_IMAGES_JPEG_QUALITY);
                     actions->add(NUActionatorsData::Sound, sensor_data->CurrentTime, NUSounds::START_SAVING_IMAGES);
                 }
                 else {
                     //we were saving and now we've finished
-                    imagefile.flush();
-                    sensorfile.flush();
+                    m_image_capture->stop();
 
                     ChangeCameraSettingsJob* newJob  = new ChangeCameraSettingsJob(currentSettings);
                     jobs->addCameraJob(newJob);
@@ -469,7 +477,10 @@ void DataWrapper::process(JobList* jobs)
 }
 
 /**
-*   @brief Saves an image and the current sensor data to the associated streams.
+*   @brief Queues a copy of the image and the current sensor data to be saved to the associated streams.
+*          The image is compressed and written by the capture's threads, so this never waits for the disk;
+*          if they fall behind the image is dropped. Once SAVE_IMAGES_MAX_IMAGES have been saved no more are, so
+*          that saving can't fill the robot's disk.
 *   @note Taken from original vision system
 */
 void DataWrapper::saveAnImage()
@@ -478,21 +489,8 @@ void DataWrapper::saveAnImage()
         debug << "DataWrapper::SaveAnImage(). Starting..." << std::endl;
     #endif
 
-    if (!imagefile.is_open())
-        imagefile.open((std::string(DATA_DIR) + std::string("image.strm")).c_str());
-    if (!sensorfile.is_open())
-        sensorfile.open((std::string(DATA_DIR) + std::string("sensor.strm")).c_str());
-
-    if (imagefile.is_open() and numSavedImages < 2500)
+    if (numSavedImages < VisionConstants::get().SAVE_IMAGES_MAX_IMAGES and m_image_capture->capture(*current_frame, *sensor_data))
     {
-        if(sensorfile.is_open())
-        {
-            sensorfile << (*sensor_data) << std::flush;
-            //sensorfile << sensor_data_copy << std::flush;
-        }
-        NUImage buffer;
-        buffer.cloneExisting(*current_frame);
-        imagefile << buffer;
         numSavedImages++;
         
         if (isSavingImagesWithVaryingSettings)
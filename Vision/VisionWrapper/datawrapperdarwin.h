@@ -26,11 +26,13 @@
 
 class NUSensorsData;
 class NUActionatorsData;
+class ImageCapture;
 
 class DataWrapper
 {
     friend class VisionController;
     friend class VisionControlWrapper;
+    friend class VisionContext;
     
 public:
     static DataWrapper* getInstance();
@@ -109,8 +111,7 @@ private:
     bool isSavingImages;
     bool isSavingImagesWithVaryingSettings;
     int numSavedImages;
-    std::ofstream imagefile;
-    std::ofstream sensorfile;
+    ImageCapture* m_image_capture;          //! queues the frames to be compressed and written by its own threads
     CameraSettings currentSettings;
 
     SensorCalibration m_sensor_calibration;
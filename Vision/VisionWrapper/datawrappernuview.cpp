@@ -28,7 +28,7 @@ void getPointsAndColoursFromSegments(const std::vector< std::vector<ColourSegmen
 DataWrapper::DataWrapper()
 {
     camera_data.LoadFromConfigFile((std::string(CONFIG_DIR) + std::string("CameraSpecs.cfg")).c_str());
-    VisionConstants::loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
+    VisionConstants::get().loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
 
     std::string sen_calib_name = std::string(CONFIG_DIR) + std::string("SensorCalibration.cfg");
 
@@ -264,7 +264,7 @@ bool DataWrapper::updateFrame()
 {
     // allow dynamic reloading of file values
     camera_data.LoadFromConfigFile((std::string(CONFIG_DIR) + std::string("CameraSpecs.cfg")).c_str());
-    VisionConstants::loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
+    VisionConstants::get().loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
     //should check actions but for some reason it keeps coming in as null
     if (m_current_image == NULL || sensor_data == NULL || field_objects == NULL)
     {
@@ -43,6 +43,7 @@ class DataWrapper : public QObject
     Q_OBJECT
     friend class VisionController;
     friend class VisionControlWrapper;
+    friend class VisionContext;
     friend class virtualNUbot;
 
 public:
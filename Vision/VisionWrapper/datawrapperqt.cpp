@@ -72,7 +72,7 @@ DataWrapper::DataWrapper(MainWindow* ui, bool ok, INPUT_METHOD method, std::stri
 
     configname = cfg;
     debug << "config: " << configname << std::endl;
-    VisionConstants::loadFromFile(configname);
+    VisionConstants::get().loadFromFile(configname);
 
     LUTname = lname;
     if(!loadLUTFromFile(LUTname)){
@@ -674,7 +674,7 @@ bool DataWrapper::updateFrame(bool forward, int frame_no)
             m_current_image = *(m_camera->grabNewImage());   //force get new frame
             break;
         case STREAM:
-            VisionConstants::loadFromFile(configname);
+            VisionConstants::get().loadFromFile(configname);
             if(!imagestrm.is_open()) {
                 errorlog << "No image stream - " << streamname << std::endl;
                 return false;
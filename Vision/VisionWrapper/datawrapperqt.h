@@ -52,6 +52,7 @@ class DataWrapper
 {
     friend class VisionController;
     friend class VisionControlWrapper;
+    friend class VisionContext;
 
 private:
     enum INPUT_METHOD {
@@ -104,7 +104,7 @@ DataWrapper::DataWrapper(bool disp_on, bool cam)
     //set up fake horizon
     kinematics_horizon.setLine(0, 1, 50);
 
-    VisionConstants::loadFromFile(configname);
+    VisionConstants::get().loadFromFile(configname);
 
     if(!loadLUTFromFile(LUTname)){
         errorlog << "DataWrapper::DataWrapper() - failed to load LUT: " << LUTname << std::endl;
@@ -582,7 +582,7 @@ bool DataWrapper::updateFrame()
             out_stream << m_current_image << std::flush;
         break;
     case STREAM:
-        VisionConstants::loadFromFile(configname);
+        VisionConstants::get().loadFromFile(configname);
         if(!imagestrm.is_open()) {
             errorlog << "No image stream" << std::endl;
             return false;
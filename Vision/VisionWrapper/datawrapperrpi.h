@@ -31,6 +31,7 @@ class DataWrapper
 {
     friend class VisionController;
     friend class VisionControlWrapper;
+    friend class VisionContext;
 
 public:
     enum PIN_MAP {
@@ -2,6 +2,7 @@
 #include "datawrappertraining.h"
 #include "debug.h"
 #include "nubotdataconfig.h"
+#include "Vision/visioncontext.h"
 
 #include "Vision/VisionTypes/coloursegment.h"
 #include "Infrastructure/NUImage/ColorModelConversions.h"
@@ -49,8 +50,18 @@ DataWrapper::~DataWrapper()
     sensorstrm.close();
 }
 
+/**
+*   @brief Returns the wrapper of the VisionContext bound to the calling thread, or the singleton if there isn't one.
+*   Each context reads its own streams, so several pipelines can run over the same files at once.
+*/
 DataWrapper* DataWrapper::getInstance()
 {
+    VisionContext* context = VisionContext::current();
+    if(context) {
+        if(!context->m_wrapper)
+            context->m_wrapper = new DataWrapper();
+        return context->m_wrapper;
+    }
     if(!instance)
         instance = new DataWrapper();
     return instance;
@@ -220,6 +231,23 @@ bool DataWrapper::updateFrame()
 
 }
 
+//! @brief Reads past the next image and sensor data in the streams without updating anything.
+bool DataWrapper::skipFrame()
+{
+    if(!valid)
+        return false;
+
+    NUImage img;
+    NUSensorsData sensors;
+    imagestrm.peek();
+    sensorstrm.peek();
+    if(!imagestrm.good() || !sensorstrm.good())
+        return false;
+    imagestrm >> img;
+    sensorstrm >> sensors;
+    return true;
+}
+
 //! @brief Updates the data copies from the external system - in this case with a provided image.
 void DataWrapper::updateFrame(NUImage& img, NUSensorsData& sensors)
 {
@@ -31,6 +31,7 @@ class DataWrapper
 {
     friend class VisionController;
     friend class VisionControlWrapper;
+    friend class VisionContext;
 
 public:
     static DataWrapper* getInstance();
@@ -80,6 +81,7 @@ private:
     ~DataWrapper();
     bool updateFrame();
     void updateFrame(NUImage& img, NUSensorsData& sensors);
+    bool skipFrame();
     int getNumFramesProcessed() const {return numFramesProcessed;}  //! @brief Returns the number of processed frames since start.
 
     void resetHistory();
@@ -4,7 +4,6 @@
 #include "debug.h"
 #include "debugverbosityvision.h"
 #include "Infrastructure/Jobs/VisionJobs/SaveImagesJob.h"
-#include "Vision/Threads/SaveImagesThread.h"
 
 VisionControlWrapper* VisionControlWrapper::instance = 0;
 
@@ -18,7 +17,6 @@ VisionControlWrapper* VisionControlWrapper::getInstance()
 VisionControlWrapper::VisionControlWrapper()
 {
     data_wrapper = DataWrapper::getInstance();
-    m_saveimages_thread = new SaveImagesThread(this);
 }
 
 int VisionControlWrapper::runFrame()
@@ -42,9 +40,9 @@ int VisionControlWrapper::runFrame()
     if(data_wrapper->isSavingImages)
     {
         #if DEBUG_VISION_VERBOSITY > 1
-            debug << "Vision::starting the save images loop." << std::endl;
+            debug << "Vision::queueing an image to be saved." << std::endl;
         #endif
-        m_saveimages_thread->signal();
+        saveAnImage();      // only copies the frame; it is compressed and written by the image capture's threads
     }
 
     int result = controller.runFrame(Blackboard->lookForBall, Blackboard->lookForGoals, Blackboard->lookForFieldPoints, Blackboard->lookForObstacles); //run vision on the frame
@@ -10,6 +10,10 @@ VisionControlWrapper* VisionControlWrapper::getInstance()
     return instance;
 }
 
+/*!
+  * @brief creates a vision system. Use getInstance() for the shared one, or create one while
+  *        a VisionContext is bound to run a separate pipeline with that context's streams and constants.
+  */
 VisionControlWrapper::VisionControlWrapper()
 {
     data_wrapper = DataWrapper::getInstance();
@@ -27,6 +31,15 @@ int VisionControlWrapper::runFrame()
     return controller.runFrame(true, true, true, true);
 }
 
+/*!
+  * @brief moves to the next frame in the current stream without running the vision system
+  * @return whether there was a frame to skip.
+  */
+bool VisionControlWrapper::skipFrame()
+{
+    return data_wrapper->skipFrame();
+}
+
 /*!
   * @brief runs the vision system for a single frame - using the supplied image
   * @param img The image to use.
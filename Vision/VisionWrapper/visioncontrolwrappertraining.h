@@ -13,8 +13,10 @@ class VisionControlWrapper
 {
 public:
     static VisionControlWrapper* getInstance();
+    VisionControlWrapper();
 
     int runFrame();
+    bool skipFrame();
     int runFrame(NUImage& img, NUSensorsData &sensors);
     bool setLUT(const std::string& filename);
     bool setImageStream(const std::string& filename);
@@ -35,8 +37,6 @@ public:
 
 
 private:
-    VisionControlWrapper();
-
     bool objectTypesMatch(VFO_ID id0, VFO_ID id1) const;
 
     static VisionControlWrapper* instance;  //! @var static singleton instance
@@ -25,6 +25,7 @@ basicvisiontypes.cpp
 visionblackboard.cpp
 visioncontroller.cpp
 visionconstants.cpp
+visioncontext.cpp
 )
 ####################################################################################
 ########## List your subdirectories here! ##########################################
@@ -4,6 +4,7 @@
 #include "debugverbosityvision.h"
 #include "nubotdataconfig.h"
 #include "visionconstants.h"
+#include "visioncontext.h"
 
 #include <algorithm>
 #include <boost/foreach.hpp>
@@ -18,7 +19,9 @@ VisionBlackboard::VisionBlackboard()
     //Get Image
     original_image = NULL;
 
-    VisionConstants::loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
+    //a context's pipeline keeps the constants it was given
+    if(!VisionContext::current())
+        VisionConstants::get().loadFromFile(std::string(CONFIG_DIR) + std::string("VisionOptions.cfg"));
 }
 
 /** @brief Private destructor.
@@ -32,9 +35,16 @@ VisionBlackboard::~VisionBlackboard()
 
 /**
 *   @brief return unique instance of blackboard - lazy initialisation.
+*   @note Returns the blackboard of the VisionContext bound to the calling thread if there is one.
 */
 VisionBlackboard* VisionBlackboard::getInstance()
 {
+    VisionContext* context = VisionContext::current();
+    if (context) {
+        if (!context->m_blackboard)
+            context->m_blackboard = new VisionBlackboard();
+        return context->m_blackboard;
+    }
     if (!instance)
         instance = new VisionBlackboard();
     return instance;
@@ -662,7 +672,7 @@ void VisionBlackboard::debugPublish() const
     wrapper->debugPublish(DBID_H_SCANS, pts);
     
     //vertical scans
-    wrapper->debugPublish(DBID_V_SCANS, m_green_horizon.getInterpolatedSubset(VisionConstants::VERTICAL_SCANLINE_SPACING));
+    wrapper->debugPublish(DBID_V_SCANS, m_green_horizon.getInterpolatedSubset(VisionConstants::get().VERTICAL_SCANLINE_SPACING));
     
     //horizontal segments
     wrapper->debugPublish(DBID_SEGMENTS, horizontal_segmented_scanlines);
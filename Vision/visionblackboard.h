@@ -42,6 +42,7 @@ class VisionWrapper;
 class VisionBlackboard
 {
     friend class VisionController;
+    friend class VisionContext;
     friend class RobocupHacks;
 
 public:
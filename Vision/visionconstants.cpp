@@ -11,102 +11,12 @@
 #include <fstream>
 #include <boost/algorithm/string.hpp>
 
-//HACK FOR RC2013
-int VisionConstants::WHITE_SIDE_IS_BLUE;
-bool VisionConstants::NON_WHITE_SIDE_CHECK;
-int VisionConstants::UPPER_WHITE_THRESHOLD;
-int VisionConstants::LOWER_WHITE_THRESHOLD;
-//! Distortion Correction
-bool VisionConstants::DO_RADIAL_CORRECTION;
-float VisionConstants::RADIAL_CORRECTION_COEFFICIENT;
-//! Goal filtering constants
-bool VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_GOALS;
-bool VisionConstants::THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_GOALS;
-float VisionConstants::MAX_DISTANCE_METHOD_DISCREPENCY_GOALS;
-bool VisionConstants::THROWOUT_DISTANT_GOALS;
-float VisionConstants::MAX_GOAL_DISTANCE;
-bool VisionConstants::THROWOUT_INSIGNIFICANT_GOALS;
-int VisionConstants::MIN_TRANSITIONS_FOR_SIGNIFICANCE_GOALS;
-bool VisionConstants::THROWOUT_NARROW_GOALS;
-int VisionConstants::MIN_GOAL_WIDTH;
-bool VisionConstants::THROWOUT_SHORT_GOALS;
-int VisionConstants::MIN_GOAL_HEIGHT;
-float VisionConstants::GOAL_HEIGHT_TO_WIDTH_RATIO_MIN;
-int VisionConstants::GOAL_MAX_OBJECTS;
-int VisionConstants::GOAL_BINS;
-int VisionConstants::GOAL_MIN_THRESHOLD;
-float VisionConstants::GOAL_SDEV_THRESHOLD;
-float VisionConstants::GOAL_RANSAC_MATCHING_TOLERANCE;
-////! Beacon filtering constants
-//bool VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_BEACONS;
-//bool VisionConstants::THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BEACONS;
-//float VisionConstants::MAX_DISTANCE_METHOD_DISCREPENCY_BEACONS;
-//bool VisionConstants::THROWOUT_DISTANT_BEACONS;
-//float VisionConstants::MAX_BEACON_DISTANCE;
-//bool VisionConstants::THROWOUT_INSIGNIFICANT_BEACONS;
-//int VisionConstants::MIN_TRANSITIONS_FOR_SIGNIFICANCE_BEACONS;
-//! Ball filtering constants
-bool VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_BALL;
-bool VisionConstants::THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BALL;
-float VisionConstants::MAX_DISTANCE_METHOD_DISCREPENCY_BALL;
-bool VisionConstants::THROWOUT_SMALL_BALLS;
-float VisionConstants::MIN_BALL_DIAMETER_PIXELS;
-bool VisionConstants::THROWOUT_INSIGNIFICANT_BALLS;
-int VisionConstants::MIN_TRANSITIONS_FOR_SIGNIFICANCE_BALL;
-bool VisionConstants::THROWOUT_DISTANT_BALLS;
-float VisionConstants::MAX_BALL_DISTANCE;
-//! Distance calculation options
-bool VisionConstants::D2P_INCLUDE_BODY_PITCH;
-bool VisionConstants::BALL_DISTANCE_POSITION_BOTTOM;
-//! Distance method options
-DistanceMethod VisionConstants::BALL_DISTANCE_METHOD;
-DistanceMethod VisionConstants::GOAL_DISTANCE_METHOD;
-//DistanceMethod VisionConstants::BEACON_DISTANCE_METHOD;
-LineDetectionMethod VisionConstants::LINE_METHOD;
-GoalDetectionMethod VisionConstants::GOAL_METHOD;
-//! Field-object detection constants
-int VisionConstants::BALL_EDGE_THRESHOLD;
-int VisionConstants::BALL_ORANGE_TOLERANCE;
-float VisionConstants::BALL_MIN_PERCENT_ORANGE;
-float VisionConstants::GOAL_MIN_PERCENT_YELLOW;
-float VisionConstants::GOAL_MIN_PERCENT_BLUE;
-//float VisionConstants::BEACON_MIN_PERCENT_YELLOW;
-//float VisionConstants::BEACON_MIN_PERCENT_BLUE;
-int VisionConstants::MIN_GOAL_SEPARATION;
-//! Obstacle detection constants
-int VisionConstants::MIN_DISTANCE_FROM_HORIZON;
-int VisionConstants::MIN_CONSECUTIVE_POINTS;
-//! Field dimension constants
-float VisionConstants::GOAL_WIDTH;
-float VisionConstants::GOAL_HEIGHT;
-float VisionConstants::DISTANCE_BETWEEN_POSTS;
-float VisionConstants::BALL_WIDTH;
-float VisionConstants::CENTRE_CIRCLE_RADIUS;
-//float VisionConstants::BEACON_WIDTH;
-//! ScanLine options
-unsigned int VisionConstants::HORIZONTAL_SCANLINE_SPACING;
-unsigned int VisionConstants::VERTICAL_SCANLINE_SPACING;
-unsigned int VisionConstants::GREEN_HORIZON_SCAN_SPACING;
-unsigned int VisionConstants::GREEN_HORIZON_MIN_GREEN_PIXELS;
-float VisionConstants::GREEN_HORIZON_UPPER_THRESHOLD_MULT;
-//! Split and Merge constants
-unsigned int VisionConstants::SAM_MAX_LINES;
-float VisionConstants::SAM_SPLIT_DISTANCE;
-unsigned int VisionConstants::SAM_MIN_POINTS_OVER;
-unsigned int VisionConstants::SAM_MIN_POINTS_TO_LINE;
-float VisionConstants::SAM_MAX_ANGLE_DIFF_TO_MERGE;
-float VisionConstants::SAM_MAX_DISTANCE_TO_MERGE;
-unsigned int VisionConstants::SAM_MIN_POINTS_TO_LINE_FINAL;
-float VisionConstants::SAM_MIN_LINE_R2_FIT;
-float VisionConstants::SAM_MAX_LINE_MSD;
-bool VisionConstants::SAM_CLEAR_SMALL;
-bool VisionConstants::SAM_CLEAR_DIRTY;
-//! RANSAC constants
-float VisionConstants::RANSAC_MAX_ANGLE_DIFF_TO_MERGE; //
-float VisionConstants::RANSAC_MAX_DISTANCE_TO_MERGE; //
+VisionConstants VisionConstants::defaults;
+__thread VisionConstants* VisionConstants::current = NULL;
 
 VisionConstants::VisionConstants()
 {
+    m_version = 0;
 }
 
 /*! @brief Loads vision constants and options from the given file.
@@ -114,6 +24,7 @@ VisionConstants::VisionConstants()
   */
 void VisionConstants::loadFromFile(std::string filename) 
 {
+    m_version++;
     WHITE_SIDE_IS_BLUE = -1;
     NON_WHITE_SIDE_CHECK = false;
     UPPER_WHITE_THRESHOLD = 1000;
@@ -145,12 +56,17 @@ void VisionConstants::loadFromFile(std::string filename)
     LINE_METHOD = RANSAC;
     GOAL_METHOD = RANSAC_G;
     GOAL_MAX_OBJECTS = 8;
+    BALL_MAX_CANDIDATES = 4;
+    BALL_MAX_SIZE_RATIO = 2;
     GOAL_BINS = 20;
     GOAL_MIN_THRESHOLD = 1;
     GOAL_SDEV_THRESHOLD = 0.75;
     GOAL_RANSAC_MATCHING_TOLERANCE = 0.2;
     RANSAC_MAX_ANGLE_DIFF_TO_MERGE = SAM_MAX_ANGLE_DIFF_TO_MERGE; //
     RANSAC_MAX_DISTANCE_TO_MERGE = SAM_MAX_DISTANCE_TO_MERGE; //
+    SAVE_IMAGES_FORMAT = "RAW";
+    SAVE_IMAGES_JPEG_QUALITY = 90;
+    SAVE_IMAGES_MAX_IMAGES = 2500;
 
     std::ifstream in(filename.c_str());
     if(!in.is_open())
@@ -254,6 +170,12 @@ void VisionConstants::loadFromFile(std::string filename)
         else if(name.compare("BALL_MIN_PERCENT_ORANGE") == 0) {
             in >> BALL_MIN_PERCENT_ORANGE;
         }
+        else if(name.compare("BALL_MAX_CANDIDATES") == 0) {
+            in >> BALL_MAX_CANDIDATES;
+        }
+        else if(name.compare("BALL_MAX_SIZE_RATIO") == 0) {
+            in >> BALL_MAX_SIZE_RATIO;
+        }
         else if(name.compare("GOAL_MIN_PERCENT_YELLOW") == 0) {
             in >> GOAL_MIN_PERCENT_YELLOW;
         }
@@ -365,6 +287,18 @@ void VisionConstants::loadFromFile(std::string filename)
         else if(name.compare("RANSAC_MAX_DISTANCE_TO_MERGE") == 0) {
             in >> RANSAC_MAX_DISTANCE_TO_MERGE;
         }
+        else if(name.compare("SAVE_IMAGES_FORMAT") == 0) {
+            in >> sval;
+            boost::trim(sval);
+            boost::to_upper(sval);
+            SAVE_IMAGES_FORMAT = sval;
+        }
+        else if(name.compare("SAVE_IMAGES_JPEG_QUALITY") == 0) {
+            in >> SAVE_IMAGES_JPEG_QUALITY;
+        }
+        else if(name.compare("SAVE_IMAGES_MAX_IMAGES") == 0) {
+            in >> SAVE_IMAGES_MAX_IMAGES;
+        }
         else if(name.compare("GOAL_MAX_OBJECTS") == 0) {
             in >> GOAL_MAX_OBJECTS;
         }
@@ -397,6 +331,7 @@ void VisionConstants::loadFromFile(std::string filename)
 
 bool VisionConstants::setParameter(std::string name, bool val)
 {
+    m_version++;
     if(name.compare("DO_RADIAL_CORRECTION") == 0) {
         DO_RADIAL_CORRECTION = val;
     }
@@ -465,6 +400,7 @@ bool VisionConstants::setParameter(std::string name, bool val)
 
 bool VisionConstants::setParameter(std::string name, int val)
 {
+    m_version++;
     if(name.compare("BALL_EDGE_THRESHOLD") == 0) {
         BALL_EDGE_THRESHOLD = val;
     }
@@ -498,6 +434,9 @@ bool VisionConstants::setParameter(std::string name, int val)
     else if(name.compare("GOAL_MAX_OBJECTS") == 0) {
         GOAL_MAX_OBJECTS = val;
     }
+    else if(name.compare("BALL_MAX_CANDIDATES") == 0) {
+        BALL_MAX_CANDIDATES = val;
+    }
     else if(name.compare("GOAL_BINS") == 0) {
         GOAL_BINS = val;
     }
@@ -513,6 +452,7 @@ bool VisionConstants::setParameter(std::string name, int val)
 
 bool VisionConstants::setParameter(std::string name, unsigned int val)
 {
+    m_version++;
     if(name.compare("HORIZONTAL_SCANLINE_SPACING") == 0) {
         HORIZONTAL_SCANLINE_SPACING = val;
     }
@@ -545,6 +485,7 @@ bool VisionConstants::setParameter(std::string name, unsigned int val)
 
 bool VisionConstants::setParameter(std::string name, float val)
 {
+    m_version++;
     if(name.compare("RADIAL_CORRECTION_COEFFICIENT") == 0) {
         RADIAL_CORRECTION_COEFFICIENT = val;
     }
@@ -572,6 +513,9 @@ bool VisionConstants::setParameter(std::string name, float val)
     else if(name.compare("BALL_MIN_PERCENT_ORANGE") == 0) {
         BALL_MIN_PERCENT_ORANGE = val;
     }
+    else if(name.compare("BALL_MAX_SIZE_RATIO") == 0) {
+        BALL_MAX_SIZE_RATIO = val;
+    }
     else if(name.compare("GOAL_MIN_PERCENT_YELLOW") == 0) {
         GOAL_MIN_PERCENT_YELLOW = val;
     }
@@ -643,6 +587,7 @@ bool VisionConstants::setParameter(std::string name, float val)
 
 bool VisionConstants::setParameter(std::string name, DistanceMethod val)
 {
+    m_version++;
     if(name.compare("BALL_DISTANCE_METHOD") == 0) {
         BALL_DISTANCE_METHOD = val;
     }
@@ -704,6 +649,8 @@ void VisionConstants::print(std::ostream& out)
     out << "BALL_EDGE_THRESHOLD: " << BALL_EDGE_THRESHOLD << std::endl;
     out << "BALL_ORANGE_TOLERANCE: " << BALL_ORANGE_TOLERANCE << std::endl;
     out << "BALL_MIN_PERCENT_ORANGE: " << BALL_MIN_PERCENT_ORANGE << std::endl;
+    out << "BALL_MAX_CANDIDATES: " << BALL_MAX_CANDIDATES << std::endl;
+    out << "BALL_MAX_SIZE_RATIO: " << BALL_MAX_SIZE_RATIO << std::endl;
     out << "GOAL_MIN_PERCENT_YELLOW: " << GOAL_MIN_PERCENT_YELLOW << std::endl;
     out << "GOAL_MIN_PERCENT_BLUE: " << GOAL_MIN_PERCENT_BLUE << std::endl;
     out << "MIN_GOAL_SEPARATION: " << MIN_GOAL_SEPARATION << std::endl;
@@ -740,10 +687,15 @@ void VisionConstants::print(std::ostream& out)
 
     out << "LINE_METHOD: " << getLineMethodName(LINE_METHOD) << std::endl;
     out << "GOAL_METHOD: " << getGoalMethodName(GOAL_METHOD) << std::endl;
+
+    out << "SAVE_IMAGES_FORMAT: " << SAVE_IMAGES_FORMAT << std::endl;
+    out << "SAVE_IMAGES_JPEG_QUALITY: " << SAVE_IMAGES_JPEG_QUALITY << std::endl;
+    out << "SAVE_IMAGES_MAX_IMAGES: " << SAVE_IMAGES_MAX_IMAGES << std::endl;
 }
 
 void VisionConstants::setFlags(bool val)
 {
+    m_version++;
     DO_RADIAL_CORRECTION = val;
     THROWOUT_ON_ABOVE_KIN_HOR_GOALS = val;
     THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_GOALS = val;
@@ -887,6 +839,7 @@ std::vector<Parameter> VisionConstants::getGeneralParams()
 
 bool VisionConstants::setAllOptimisable(const std::vector<float>& params)
 {
+    m_version++;
     if(params.size() != 29) {
         return false; //not a valid size
     }
@@ -926,6 +879,7 @@ bool VisionConstants::setAllOptimisable(const std::vector<float>& params)
 
 bool VisionConstants::setBallParams(const std::vector<float>& params)
 {
+    m_version++;
     if(params.size() != 5) {
         return false; //not a valid size
     }
@@ -939,6 +893,7 @@ bool VisionConstants::setBallParams(const std::vector<float>& params)
 
 bool VisionConstants::setGoalParams(const std::vector<float>& params)
 {
+    m_version++;
     if(params.size() != 11) {
         return false; //not a valid size
     }
@@ -960,6 +915,7 @@ bool VisionConstants::setGoalParams(const std::vector<float>& params)
 
 bool VisionConstants::setObstacleParams(const std::vector<float>& params)
 {
+    m_version++;
     if(params.size() != 2) {
         return false; //not a valid size
     }
@@ -970,6 +926,7 @@ bool VisionConstants::setObstacleParams(const std::vector<float>& params)
 
 bool VisionConstants::setLineParams(const std::vector<float>& params)
 {
+    m_version++;
     if(params.size() != 8) {
         return false; //not a valid size
     }
@@ -986,6 +943,7 @@ bool VisionConstants::setLineParams(const std::vector<float>& params)
 
 bool VisionConstants::setGeneralParams(const std::vector<float>& params)
 {
+    m_version++;
     if(params.size() != 5) {
         return false; //not a valid size
     }
@@ -0,0 +1,48 @@
+#include "visioncontext.h"
+#include "visionblackboard.h"
+#include "VisionWrapper/datawrappercurrent.h"
+
+__thread VisionContext* VisionContext::bound = NULL;
+
+/** @brief Creates a context with a copy of the calling thread's current constants.
+*/
+VisionContext::VisionContext() : m_constants(VisionConstants::get())
+{
+    m_blackboard = NULL;
+    m_wrapper = NULL;
+}
+
+/** @brief Creates a context with a copy of the given constants.
+*   @param constants The constants used by the context's pipeline.
+*/
+VisionContext::VisionContext(const VisionConstants& constants) : m_constants(constants)
+{
+    m_blackboard = NULL;
+    m_wrapper = NULL;
+}
+
+/** @brief Destroys the context's blackboard and wrapper, unbinding it first if it is bound to this thread.
+*/
+VisionContext::~VisionContext()
+{
+    if(bound == this)
+        unbind();
+    delete m_blackboard;
+    delete m_wrapper;
+}
+
+/** @brief Binds the context to the calling thread, replacing any context already bound to it.
+*/
+void VisionContext::bind()
+{
+    bound = this;
+    VisionConstants::current = &m_constants;
+}
+
+/** @brief Unbinds the calling thread's context, so the thread uses the process-wide vision system again.
+*/
+void VisionContext::unbind()
+{
+    bound = NULL;
+    VisionConstants::current = NULL;
+}
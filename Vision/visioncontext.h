@@ -0,0 +1,55 @@
+/**
+*       @name   VisionContext
+*       @file   visioncontext.h
+*       @brief  The constants, blackboard and data wrapper of one vision pipeline.
+*
+*   The vision system reaches its state through VisionConstants::get(), VisionBlackboard::getInstance()
+*   and DataWrapper::getInstance(). While a context is bound to a thread these return the context's own
+*   objects, otherwise they return the process-wide ones, so code that never binds a context behaves
+*   exactly as before. Binding a different context in each thread lets several independent pipelines
+*   run in one process, e.g. to evaluate candidate parameter sets in parallel.
+*
+*   A context's blackboard and wrapper are created the first time they are asked for while it is bound,
+*   so a context should be bound, used and destroyed by a single thread. Only wrappers that read from
+*   files (the training wrapper) are created per context; on the robot every context shares the wrapper.
+*/
+
+#ifndef VISIONCONTEXT_H
+#define VISIONCONTEXT_H
+
+#include "Vision/visionconstants.h"
+
+class VisionBlackboard;
+class DataWrapper;
+
+class VisionContext
+{
+    friend class VisionBlackboard;
+    friend class DataWrapper;
+
+public:
+    VisionContext();
+    explicit VisionContext(const VisionConstants& constants);
+    ~VisionContext();
+
+    //! @brief Returns the context bound to the calling thread, or NULL if there isn't one.
+    static VisionContext* current() {return bound;}
+
+    void bind();
+    static void unbind();
+
+    //! @brief Returns this context's constants.
+    VisionConstants& getConstants() {return m_constants;}
+
+private:
+    VisionContext(const VisionContext&);            //not copyable, each context owns its pipeline
+    VisionContext& operator=(const VisionContext&);
+
+    VisionConstants m_constants;        //! @var the constants used while this context is bound
+    VisionBlackboard* m_blackboard;     //! @var the blackboard, created on first use
+    DataWrapper* m_wrapper;             //! @var the data wrapper, created on first use (training only)
+
+    static __thread VisionContext* bound;   //! @var the context bound to this thread, if any
+};
+
+#endif // VISIONCONTEXT_H
@@ -5,6 +5,7 @@
 //#include "Infrastructure/Jobs/JobList.h"
 
 #include "Tools/Profiling/Profiler.h"
+#include "Tools/Profiling/Tracer.h"
 
 #include "Vision/VisionTools/lookuptable.h"
 #include "Vision/Modules/greenhorizonch.h"
@@ -61,6 +62,9 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
     Profiler prof("Vision");
     prof.start();
 #endif
+    TRACE_SCOPE("vision frame");
+    TraceSplits trace;
+    trace.start();
 
     m_data_wrapper = DataWrapper::getInstance();
 #if VISION_CONTROLLER_VERBOSITY > 1
@@ -76,6 +80,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
 #ifdef VISION_PROFILER_ON
     prof.split("Update");
 #endif
+    TRACE_SPLIT(trace, "vision update");
 
     //! HORIZON
 
@@ -87,6 +92,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
 #ifdef VISION_PROFILER_ON
     prof.split("Green Horizon");
 #endif
+    TRACE_SPLIT(trace, "vision green horizon");
 
     //! PRE-DETECTION PROCESSING
 
@@ -108,6 +114,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
 #ifdef VISION_PROFILER_ON
     prof.split("Classify Scanlines");
 #endif
+    TRACE_SPLIT(trace, "vision scanlines");
 
     m_segment_filter.run();
 #if VISION_CONTROLLER_VERBOSITY > 2
@@ -118,11 +125,12 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
 #ifdef VISION_PROFILER_ON
     prof.split("Segment Filters");
 #endif
+    TRACE_SPLIT(trace, "vision segment filters");
 
     //! DETECTION MODULES
 
     if(lookForGoals) {
-        if(VisionConstants::GOAL_METHOD == HIST) {
+        if(VisionConstants::get().GOAL_METHOD == HIST) {
             // histogram method
             std::vector<Goal> hist_goals = m_goal_detector_hist->run();
             m_blackboard->addGoals(hist_goals);
@@ -143,6 +151,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
     #ifdef VISION_PROFILER_ON
     prof.split("Goals");
     #endif
+    TRACE_SPLIT(trace, "vision goals");
 
     #if VISION_CONTROLLER_VERBOSITY > 2
     debug << "\tgoal detection done" << std::endl;
@@ -178,6 +187,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
         #ifdef VISION_PROFILER_ON
         prof.split("Ball");
         #endif
+        TRACE_SPLIT(trace, "vision ball");
     }
     else {
         #if VISION_CONTROLLER_VERBOSITY > 2
@@ -206,6 +216,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
     #ifdef VISION_PROFILER_ON
     prof.split("Obstacles");
     #endif
+    TRACE_SPLIT(trace, "vision obstacles");
 
     // publishing
     //force blackboard to publish results through wrapper
@@ -217,6 +228,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
     #ifdef VISION_PROFILER_ON
     prof.split("Publishing");
     #endif
+    TRACE_SPLIT(trace, "vision publish");
 
     //publish debug information as well
 
@@ -232,6 +244,7 @@ int VisionController::runFrame(bool lookForBall, bool lookForGoals, bool lookFor
     prof.stop();
     m_profiling_stream << prof << std::endl;
     #endif
+    TRACE_SPLIT(trace, "vision debug publish");
 
     return 0;
 }
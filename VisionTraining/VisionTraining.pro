@@ -12,6 +12,7 @@ HEADERS += \
     ../Vision/VisionTypes/VisionFieldObjects/fieldline.h \
     labeleditor.h \
     visionoptimiser.h \
+    visionevaluationpool.h \
     visioncomparitor.h
 
 SOURCES += \
@@ -19,6 +20,7 @@ SOURCES += \
     labelgenerator.cpp \
     labeleditor.cpp \
     visionoptimiser.cpp \
+    visionevaluationpool.cpp \
     visioncomparitor.cpp
 
 HEADERS += \
@@ -56,6 +58,7 @@ HEADERS += \
     ../Vision/visionblackboard.h \
     ../Vision/visioncontroller.h \
     ../Vision/visionconstants.h \
+    ../Vision/visioncontext.h \
 
 SOURCES += \
     ../Vision/VisionTypes/*.cpp \
@@ -70,12 +73,15 @@ SOURCES += \
     ../Vision/visionblackboard.cpp \
     ../Vision/visioncontroller.cpp \
     ../Vision/visionconstants.cpp \
+    ../Vision/visioncontext.cpp \
     main.cpp \
 
 ##robocup
 HEADERS += \
     ../Tools/FileFormats/LUTTools.h \
     ../Tools/Optimisation/Parameter.h \
+    ../Tools/Profiling/Tracer.h \
+    ../Tools/Profiling/TraceRegistry.h \
     ../Tools/Math/Line.h \
     ../Tools/Math/LSFittedLine.h \
     ../Tools/Math/Matrix.h \
@@ -88,6 +94,7 @@ HEADERS += \
     ../Tools/Optimisation/PGRLOptimiser.h \
     ../Tools/Optimisation/PSOOptimiser.h \
     ../Tools/Optimisation/PGAOptimiser.h \
+    ../Tools/Optimisation/OptimiserPool.h \
     ../Infrastructure/NUImage/NUImage.h \
     ../NUPlatform/NUCamera/CameraSettings.h \
     ../NUPlatform/NUCamera/NUCameraData.h \
@@ -109,6 +116,7 @@ HEADERS += \
 SOURCES += \
     ../Tools/FileFormats/LUTTools.cpp \
     ../Tools/Optimisation/Parameter.cpp \
+    ../Tools/Profiling/Tracer.cpp \
     ../Tools/Math/Line.cpp \
     ../Tools/Math/LSFittedLine.cpp \
     ../Tools/Math/Matrix.cpp \
@@ -118,6 +126,7 @@ SOURCES += \
     ../Tools/Optimisation/PGRLOptimiser.cpp \
     ../Tools/Optimisation/PSOOptimiser.cpp \
     ../Tools/Optimisation/PGAOptimiser.cpp \
+    ../Tools/Optimisation/OptimiserPool.cpp \
     ../Infrastructure/NUImage/NUImage.cpp \
     ../NUPlatform/NUCamera/CameraSettings.cpp \
     ../NUPlatform/NUCamera/NUCameraData.cpp \
@@ -100,12 +100,12 @@ void VisionComparitor::run(std::string image_name, std::string sensor_name, std:
         m_next = m_prev = false;
 
         //run the vision system with the first parameter set and render the results
-        VisionConstants::loadFromFile(config0);
+        VisionConstants::get().loadFromFile(config0);
         vision->runFrame(m_frames[m_frame_no].first, m_frames[m_frame_no].second);
         vision->renderFrame(img0, lines_only);
 
         //and again with the second
-        VisionConstants::loadFromFile(config1);
+        VisionConstants::get().loadFromFile(config1);
         vision->runFrame(m_frames[m_frame_no].first, m_frames[m_frame_no].second);
         vision->renderFrame(img1, lines_only);
 
@@ -0,0 +1,262 @@
+#include "visionevaluationpool.h"
+#include "Vision/visioncontext.h"
+#include "Vision/GenericAlgorithms/ransac.h"
+#include "debug.h"
+
+#include <unistd.h>
+#include <time.h>
+#include <algorithm>
+
+/** @brief Creates the pool and starts its threads, each of which creates its own vision pipeline.
+*   @param num_threads The number of threads, or 0 for one per processor.
+*/
+VisionEvaluationPool::VisionEvaluationPool(unsigned int num_threads) : m_initial_constants(VisionConstants::get())
+{
+    if(num_threads == 0)
+        num_threads = std::max(1L, sysconf(_SC_NPROCESSORS_ONLN));
+
+    pthread_mutex_init(&m_mutex, NULL);
+    pthread_cond_init(&m_task_ready, NULL);
+    pthread_cond_init(&m_task_done, NULL);
+    m_stopping = false;
+    m_cancelled = false;
+    m_lut_version = 0;
+    m_ground_truth = NULL;
+    m_use_ground_errors = false;
+    m_num_frames = 0;
+    m_next_task = 0;
+    m_tasks_done = 0;
+    m_frames_done = 0;
+
+    for(unsigned int i = 0; i < num_threads; i++) {
+        pthread_t thread;
+        if(pthread_create(&thread, NULL, runThread, this) == 0)
+            m_threads.push_back(thread);
+        else
+            errorlog << "VisionEvaluationPool::VisionEvaluationPool - failed to create thread " << i << std::endl;
+    }
+}
+
+/** @brief Cancels any batch that is running and waits for the threads to exit.
+*/
+VisionEvaluationPool::~VisionEvaluationPool()
+{
+    pthread_mutex_lock(&m_mutex);
+    m_stopping = true;
+    m_cancelled = true;
+    pthread_cond_broadcast(&m_task_ready);
+    pthread_mutex_unlock(&m_mutex);
+
+    for(unsigned int i = 0; i < m_threads.size(); i++)
+        pthread_join(m_threads[i], NULL);
+
+    pthread_cond_destroy(&m_task_done);
+    pthread_cond_destroy(&m_task_ready);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+/** @brief Sets the LUT every pipeline uses. The threads load it before their next task.
+*   @param filename The file to load the LUT from.
+*/
+void VisionEvaluationPool::setLUT(const std::string& filename)
+{
+    pthread_mutex_lock(&m_mutex);
+    m_lut_name = filename;
+    m_lut_version++;
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/** @brief Starts evaluating each candidate over a labelled stream. Any batch still running is cancelled first.
+*   @param candidates The constants to evaluate.
+*   @param stream_name The image stream to use. The pipelines read the sensor stream from its start alongside it.
+*   @param ground_truth The labels for each frame, which must not change until the batch finishes.
+*   @param false_pos_costs A map between field objects and false positive costs.
+*   @param false_neg_costs A map between field objects and false negative costs.
+*   @param use_ground_errors Whether errors are measured on the ground rather than on screen.
+*/
+void VisionEvaluationPool::start(const std::vector<VisionConstants>& candidates,
+                                 const std::string& stream_name,
+                                 const std::vector<std::vector<VisionFieldObject*> >& ground_truth,
+                                 const map<VFO_ID, float>& false_pos_costs,
+                                 const map<VFO_ID, float>& false_neg_costs,
+                                 bool use_ground_errors)
+{
+    cancel();
+    wait(0xFFFFFFFF);
+
+    pthread_mutex_lock(&m_mutex);
+    m_candidates = candidates;
+    m_stream_name = stream_name;
+    m_ground_truth = &ground_truth;
+    m_false_pos_costs = false_pos_costs;
+    m_false_neg_costs = false_neg_costs;
+    m_use_ground_errors = use_ground_errors;
+    m_num_frames = ground_truth.size();
+
+    //split each candidate's frames so that every thread has something to do
+    unsigned int chunks = (m_threads.size() + candidates.size() - 1)/std::max<size_t>(candidates.size(), 1);
+    chunks = std::max(1u, std::min(chunks, m_num_frames));
+    m_tasks.clear();
+    for(unsigned int c = 0; c < candidates.size(); c++) {
+        for(unsigned int i = 0; i < chunks; i++) {
+            Task task;
+            task.candidate = c;
+            task.begin = (m_num_frames*i)/chunks;
+            task.end = (m_num_frames*(i+1))/chunks;
+            m_tasks.push_back(task);
+        }
+    }
+
+    m_results.assign(candidates.size(), std::vector<FrameEvaluation>(m_num_frames));
+    for(unsigned int c = 0; c < m_results.size(); c++)
+        for(unsigned int f = 0; f < m_num_frames; f++)
+            m_results[c][f].valid = false;
+
+    m_next_task = 0;
+    m_tasks_done = 0;
+    m_frames_done = 0;
+    m_cancelled = false;
+    pthread_cond_broadcast(&m_task_ready);
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/** @brief Waits for the batch to finish.
+*   @param timeout_ms The longest time to wait.
+*   @return true if every task is finished (or was cancelled), false if the wait timed out.
+*/
+bool VisionEvaluationPool::wait(unsigned int timeout_ms)
+{
+    struct timespec timeout;
+    clock_gettime(CLOCK_REALTIME, &timeout);
+    timeout.tv_sec += timeout_ms/1000;
+    timeout.tv_nsec += (timeout_ms%1000)*1000000L;
+    if(timeout.tv_nsec >= 1000000000) {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&m_mutex);
+    while(m_tasks_done < m_tasks.size()) {
+        if(pthread_cond_timedwait(&m_task_done, &m_mutex, &timeout) != 0)
+            break;
+    }
+    bool finished = m_tasks_done == m_tasks.size();
+    pthread_mutex_unlock(&m_mutex);
+    return finished;
+}
+
+/** @brief Stops the threads as soon as they finish their current frame. The remaining tasks are dropped.
+*/
+void VisionEvaluationPool::cancel()
+{
+    pthread_mutex_lock(&m_mutex);
+    m_cancelled = true;
+    m_tasks_done += m_tasks.size() - m_next_task;   //nobody will take them now
+    m_next_task = m_tasks.size();
+    pthread_cond_broadcast(&m_task_done);
+    pthread_mutex_unlock(&m_mutex);
+}
+
+/** @brief Returns the number of frames evaluated so far in this batch, for all candidates. */
+unsigned int VisionEvaluationPool::getNumFramesDone()
+{
+    pthread_mutex_lock(&m_mutex);
+    unsigned int done = m_frames_done;
+    pthread_mutex_unlock(&m_mutex);
+    return done;
+}
+
+void* VisionEvaluationPool::runThread(void* arg)
+{
+    static_cast<VisionEvaluationPool*>(arg)->run();
+    return NULL;
+}
+
+/** @brief A thread's main loop. The pipeline is created here so it belongs to this thread's context.
+*/
+void VisionEvaluationPool::run()
+{
+    VisionContext context(m_initial_constants);
+    context.bind();
+    unsigned int seed;
+    RANSAC::setThreadSeed(&seed);
+    {
+        VisionControlWrapper vision;
+        std::string stream;             //the stream the pipeline has open
+        unsigned int position = 0;      //the next frame in that stream
+        unsigned int lut_version = 0;
+
+        pthread_mutex_lock(&m_mutex);
+        while(true) {
+            while(!m_stopping && m_next_task >= m_tasks.size())
+                pthread_cond_wait(&m_task_ready, &m_mutex);
+            if(m_stopping)
+                break;
+
+            Task task = m_tasks[m_next_task++];
+            std::string lut_name = m_lut_name;
+            bool reload_lut = lut_version != m_lut_version;
+            lut_version = m_lut_version;
+            pthread_mutex_unlock(&m_mutex);
+
+            if(reload_lut && !vision.setLUT(lut_name))
+                errorlog << "VisionEvaluationPool::run - failed to load LUT: " << lut_name << std::endl;
+            runTask(vision, task, stream, position);
+
+            pthread_mutex_lock(&m_mutex);
+            m_tasks_done++;
+            pthread_cond_broadcast(&m_task_done);
+        }
+        pthread_mutex_unlock(&m_mutex);
+    }
+    RANSAC::setThreadSeed(NULL);
+    context.unbind();
+}
+
+/** @brief Runs the vision system with a candidate's constants over a range of frames, storing each frame's evaluation.
+*   @param vision The thread's vision system.
+*   @param task The candidate and frames.
+*   @param stream The stream the vision system has open, updated if it changes.
+*   @param position The next frame in the open stream, updated as frames are read.
+*/
+void VisionEvaluationPool::runTask(VisionControlWrapper& vision, const Task& task, std::string& stream, unsigned int& position)
+{
+    VisionConstants::get() = m_candidates[task.candidate];
+
+    //move to the first frame, rewinding only if the task starts behind the stream
+    if(stream != m_stream_name) {
+        vision.setImageStream(m_stream_name);
+        stream = m_stream_name;
+        position = task.begin + 1;      //force the rewind below
+    }
+    if(position > task.begin) {
+        vision.restartStream();
+        position = 0;
+    }
+    while(position < task.begin && vision.skipFrame())
+        position++;
+
+    std::vector<FrameEvaluation>& results = m_results[task.candidate];
+    for(unsigned int f = task.begin; f < task.end && position == f; f++) {
+        pthread_mutex_lock(&m_mutex);
+        bool cancelled = m_cancelled;
+        pthread_mutex_unlock(&m_mutex);
+        if(cancelled)
+            break;
+        //every candidate gets the same random selections on a frame, whichever thread runs it
+        *RANSAC::threadSeed() = f + 1;
+        if(vision.runFrame() != 0)
+            break;
+        position++;
+
+        FrameEvaluation& result = results[f];
+        result.errors = vision.evaluateFrame((*m_ground_truth)[f], m_false_pos_costs, m_false_neg_costs, m_use_ground_errors);
+        result.detections = vision.precisionRecall((*m_ground_truth)[f], m_use_ground_errors);
+        result.valid = true;
+
+        pthread_mutex_lock(&m_mutex);
+        m_frames_done++;
+        pthread_mutex_unlock(&m_mutex);
+    }
+    vision.resetHistory();
+}
@@ -0,0 +1,97 @@
+/**
+*       @name   VisionEvaluationPool
+*       @file   visionevaluationpool.h
+*       @brief  Evaluates the vision system over labelled streams on several threads.
+*
+*   Each thread runs its own vision pipeline in a VisionContext, so candidate parameter sets can be
+*   evaluated at the same time. A batch is split into tasks of one candidate over a range of frames;
+*   when there are fewer candidates than threads each candidate's frames are shared between threads.
+*   Every frame's evaluation is stored at its candidate and frame number, so the results (and anything
+*   accumulated from them in order) are the same whatever the number of threads.
+*
+*   The pool must only be used from one thread, which is expected to be the GUI thread polling wait().
+*/
+
+#ifndef VISIONEVALUATIONPOOL_H
+#define VISIONEVALUATIONPOOL_H
+
+#include "Vision/visionconstants.h"
+#include "Vision/VisionWrapper/visioncontrolwrappertraining.h"
+
+#include <pthread.h>
+
+//! The evaluation of one frame against its labels.
+struct FrameEvaluation
+{
+    bool valid;                                     //! @var whether the vision system ran on the frame
+    map<VFO_ID, pair<float, int> > errors;          //! @var total cost|incident number for each field object
+    map<VFO_ID, Vector3<double> > detections;       //! @var total detections|false_pos|false_neg for each field object
+};
+
+class VisionEvaluationPool
+{
+public:
+    explicit VisionEvaluationPool(unsigned int num_threads = 0);
+    ~VisionEvaluationPool();
+
+    unsigned int getNumThreads() const {return m_threads.size();}
+
+    void setLUT(const std::string& filename);
+
+    void start(const std::vector<VisionConstants>& candidates,
+               const std::string& stream_name,
+               const std::vector<std::vector<VisionFieldObject*> >& ground_truth,
+               const map<VFO_ID, float>& false_pos_costs,
+               const map<VFO_ID, float>& false_neg_costs,
+               bool use_ground_errors);
+    bool wait(unsigned int timeout_ms);
+    void cancel();
+
+    unsigned int getNumFramesDone();
+    unsigned int getNumFrames() const {return m_candidates.size()*m_num_frames;}
+
+    //! @brief Returns the evaluation of each frame for each candidate, valid once wait() returns true.
+    const std::vector<std::vector<FrameEvaluation> >& getResults() const {return m_results;}
+
+private:
+    //! A candidate over a range of frames.
+    struct Task
+    {
+        unsigned int candidate;
+        unsigned int begin;
+        unsigned int end;
+    };
+
+    static void* runThread(void* arg);
+    void run();
+    void runTask(VisionControlWrapper& vision, const Task& task, std::string& stream, unsigned int& position);
+
+    std::vector<pthread_t> m_threads;
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_task_ready;        //! @var signalled when a batch is started, or the pool is stopping
+    pthread_cond_t m_task_done;         //! @var signalled when a task is finished
+
+    const VisionConstants m_initial_constants;  //! @var the constants the pipelines are created with, copied before anything can change them
+    bool m_stopping;
+    bool m_cancelled;
+    std::string m_lut_name;
+    unsigned int m_lut_version;         //! @var incremented each time the LUT changes, so the threads know to reload it
+
+    //! the current batch, which is only changed while no tasks are running
+    std::vector<VisionConstants> m_candidates;
+    std::string m_stream_name;
+    const std::vector<std::vector<VisionFieldObject*> >* m_ground_truth;
+    map<VFO_ID, float> m_false_pos_costs;
+    map<VFO_ID, float> m_false_neg_costs;
+    bool m_use_ground_errors;
+    unsigned int m_num_frames;
+
+    std::vector<Task> m_tasks;
+    unsigned int m_next_task;           //! @var the next task to be taken by a thread
+    unsigned int m_tasks_done;
+    unsigned int m_frames_done;
+
+    std::vector<std::vector<FrameEvaluation> > m_results;   //! @var indexed by candidate, then frame
+};
+
+#endif // VISIONEVALUATIONPOOL_H
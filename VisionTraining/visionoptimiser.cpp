@@ -7,6 +7,7 @@
 #include "Tools/Optimisation/PGAOptimiser.h"
 #include "Vision/visionconstants.h"
 #include <QMessageBox>
+#include <boost/foreach.hpp>
 
 /** @brief String to enum converter for the OPT_TYPE enum.
 */
@@ -67,49 +68,49 @@ VisionOptimiser::VisionOptimiser(QWidget* parent, OPT_TYPE id) :
     case EHCLS:
         m_opt_name = "VisionEHCLS";
 #ifdef MULTI_OPT
-        m_optimisers[BALL_OPT] = new EHCLSOptimiser("EHCLSBall", VisionConstants::getBallParams());
-        m_optimisers[GOAL_OPT] = new EHCLSOptimiser("EHCLSGoalBeacon", VisionConstants::getGoalParams());
-        m_optimisers[OBSTACLE_OPT] = new EHCLSOptimiser("EHCLSObstacle", VisionConstants::getObstacleParams());
-        m_optimisers[LINE_OPT] = new EHCLSOptimiser("EHCLSLine", VisionConstants::getLineParams());
-        m_optimisers[GENERAL_OPT] = new EHCLSOptimiser("EHCLSGeneral", VisionConstants::getGeneralParams());
+        m_optimisers[BALL_OPT] = new EHCLSOptimiser("EHCLSBall", VisionConstants::get().getBallParams());
+        m_optimisers[GOAL_OPT] = new EHCLSOptimiser("EHCLSGoalBeacon", VisionConstants::get().getGoalParams());
+        m_optimisers[OBSTACLE_OPT] = new EHCLSOptimiser("EHCLSObstacle", VisionConstants::get().getObstacleParams());
+        m_optimisers[LINE_OPT] = new EHCLSOptimiser("EHCLSLine", VisionConstants::get().getLineParams());
+        m_optimisers[GENERAL_OPT] = new EHCLSOptimiser("EHCLSGeneral", VisionConstants::get().getGeneralParams());
 #else
-        m_optimiser = new EHCLSOptimiser("VisionEHCLS", VisionConstants::getAllOptimisable());
+        m_optimiser = new EHCLSOptimiser("VisionEHCLS", VisionConstants::get().getAllOptimisable());
 #endif
         break;
     case PGRL:
         m_opt_name = "VisionPGRL";
 #ifdef MULTI_OPT
-        m_optimisers[BALL_OPT] = new PGRLOptimiser("PGRLBall", VisionConstants::getBallParams());
-        m_optimisers[GOAL_OPT] = new PGRLOptimiser("PGRLGoalBeacon", VisionConstants::getGoalParams());
-        m_optimisers[OBSTACLE_OPT] = new PGRLOptimiser("PGRLObstacle", VisionConstants::getObstacleParams());
-        m_optimisers[LINE_OPT] = new PGRLOptimiser("PGRLLine", VisionConstants::getLineParams());
-        m_optimisers[GENERAL_OPT] = new PGRLOptimiser("PGRLGeneral", VisionConstants::getGeneralParams());
+        m_optimisers[BALL_OPT] = new PGRLOptimiser("PGRLBall", VisionConstants::get().getBallParams());
+        m_optimisers[GOAL_OPT] = new PGRLOptimiser("PGRLGoalBeacon", VisionConstants::get().getGoalParams());
+        m_optimisers[OBSTACLE_OPT] = new PGRLOptimiser("PGRLObstacle", VisionConstants::get().getObstacleParams());
+        m_optimisers[LINE_OPT] = new PGRLOptimiser("PGRLLine", VisionConstants::get().getLineParams());
+        m_optimisers[GENERAL_OPT] = new PGRLOptimiser("PGRLGeneral", VisionConstants::get().getGeneralParams());
 #else
-        m_optimiser = new PGRLOptimiser("VisionPGRL", VisionConstants::getAllOptimisable());
+        m_optimiser = new PGRLOptimiser("VisionPGRL", VisionConstants::get().getAllOptimisable());
 #endif
         break;
     case PSO:
         m_opt_name = "VisionPSO";
 #ifdef MULTI_OPT
-        m_optimisers[BALL_OPT] = new PSOOptimiser("PSOBall", VisionConstants::getBallParams());
-        m_optimisers[GOAL_OPT] = new PSOOptimiser("PSOGoalBeacon", VisionConstants::getGoalParams());
-        m_optimisers[OBSTACLE_OPT] = new PSOOptimiser("PSOObstacle", VisionConstants::getObstacleParams());
-        m_optimisers[LINE_OPT] = new PSOOptimiser("PSOLine", VisionConstants::getLineParams());
-        m_optimisers[GENERAL_OPT] = new PSOOptimiser("PSOGeneral", VisionConstants::getGeneralParams());
+        m_optimisers[BALL_OPT] = new PSOOptimiser("PSOBall", VisionConstants::get().getBallParams());
+        m_optimisers[GOAL_OPT] = new PSOOptimiser("PSOGoalBeacon", VisionConstants::get().getGoalParams());
+        m_optimisers[OBSTACLE_OPT] = new PSOOptimiser("PSOObstacle", VisionConstants::get().getObstacleParams());
+        m_optimisers[LINE_OPT] = new PSOOptimiser("PSOLine", VisionConstants::get().getLineParams());
+        m_optimisers[GENERAL_OPT] = new PSOOptimiser("PSOGeneral", VisionConstants::get().getGeneralParams());
 #else
-        m_optimiser = new PSOOptimiser("VisionPSO", VisionConstants::getAllOptimisable());
+        m_optimiser = new PSOOptimiser("VisionPSO", VisionConstants::get().getAllOptimisable());
 #endif
         break;
     case PGA:
         m_opt_name = "VisionPGA";
 #ifdef MULTI_OPT
-        m_optimisers[BALL_OPT] = new PGAOptimiser("PGABall", VisionConstants::getBallParams());
-        m_optimisers[GOAL_OPT] = new PGAOptimiser("PGAGoalBeacon", VisionConstants::getGoalParams());
-        m_optimisers[OBSTACLE_OPT] = new PGAOptimiser("PGAObstacle", VisionConstants::getObstacleParams());
-        m_optimisers[LINE_OPT] = new PGAOptimiser("PGALine", VisionConstants::getLineParams());
-        m_optimisers[GENERAL_OPT] = new PGAOptimiser("PGAGeneral", VisionConstants::getGeneralParams());
+        m_optimisers[BALL_OPT] = new PGAOptimiser("PGABall", VisionConstants::get().getBallParams());
+        m_optimisers[GOAL_OPT] = new PGAOptimiser("PGAGoalBeacon", VisionConstants::get().getGoalParams());
+        m_optimisers[OBSTACLE_OPT] = new PGAOptimiser("PGAObstacle", VisionConstants::get().getObstacleParams());
+        m_optimisers[LINE_OPT] = new PGAOptimiser("PGALine", VisionConstants::get().getLineParams());
+        m_optimisers[GENERAL_OPT] = new PGAOptimiser("PGAGeneral", VisionConstants::get().getGeneralParams());
 #else
-        m_optimiser = new PGAOptimiser("VisionPGA", VisionConstants::getAllOptimisable());
+        m_optimiser = new PGAOptimiser("VisionPGA", VisionConstants::get().getAllOptimisable());
 #endif
         break;
     }
@@ -123,6 +124,7 @@ VisionOptimiser::VisionOptimiser(QWidget* parent, OPT_TYPE id) :
     m_vfo_optimiser_map[FIELDLINE].push_back(LINE_OPT); m_vfo_optimiser_map[FIELDLINE].push_back(GENERAL_OPT);
 
     vision = VisionControlWrapper::getInstance();
+    m_pool = new VisionEvaluationPool();      //after the vision system has loaded its constants, so the pool starts with them
 
 #ifdef MULTI_OPT
     for(int i=0; i<=GENERAL_OPT; i++) {
@@ -135,6 +137,7 @@ VisionOptimiser::VisionOptimiser(QWidget* parent, OPT_TYPE id) :
 
 VisionOptimiser::~VisionOptimiser()
 {
+    delete m_pool;
     delete ui;
 #ifdef MULTI_OPT
     delete m_optimisers[OBSTACLE_OPT];
@@ -161,7 +164,7 @@ void VisionOptimiser::errorPandRevaluation(std::string directory, bool use_groun
     map<VFO_ID, float> zero_costs;                       //empty costs map removes consideration of false positives and negatives
 
     //load parameter file from directory
-    VisionConstants::loadFromFile(directory + std::string("/VisionOptions.cfg"));
+    VisionConstants::get().loadFromFile(directory + std::string("/VisionOptions.cfg"));
 
     //read in the labels
     if(!vision->readLabels(label_file, gt)) {
@@ -171,6 +174,7 @@ void VisionOptimiser::errorPandRevaluation(std::string directory, bool use_groun
 
     //initialise vision system
     vision->setLUT(directory+std::string("/default.lut"));
+    m_pool->setLUT(directory+std::string("/default.lut"));
 
     //set the options we need
     setupVisionConstants();
@@ -210,6 +214,7 @@ void VisionOptimiser::gridSearch(std::string directory, int grids_per_side, bool
 
     //initialise vision system
     vision->setLUT(directory+std::string("default.lut"));
+    m_pool->setLUT(directory+std::string("default.lut"));
 
     //set the options we need
     setupVisionConstants();
@@ -218,32 +223,39 @@ void VisionOptimiser::gridSearch(std::string directory, int grids_per_side, bool
     grid_log << "x : " << p1.name() << " y : " << p2.name() << std::endl;
     //search over set number of grids
     for(float x = p1.min(); x<p1.max() && !halt; x+= (p1.max() - p1.min())/grids_per_side) {
+        //each row of the grid is evaluated as one batch, spread over the pool
+        std::vector<VisionConstants> candidates;
         for(float y = p2.min(); y<p2.max() && !halt; y+= (p2.max() - p2.min())/grids_per_side) {
             //change parameters
-            if(!VisionConstants::setParameter(p1.name(), x)) {
+            VisionConstants candidate = VisionConstants::get();
+            if(!candidate.setParameter(p1.name(), x)) {
                 std::cout << "error setting p1" << std::endl;
                 halt = true;
                 break;
             }
-            if(!VisionConstants::setParameter(p2.name(), (unsigned int)y)) {
+            if(!candidate.setParameter(p2.name(), (unsigned int)y)) {
                 std::cout << "error setting p2" << std::endl;
                 halt = true;
                 break;
             }
-            fitnesses = evaluateBatch(gt, image_name, m_false_positive_costs, m_false_negative_costs, use_ground_errors);
-            if(!fitnesses.empty()) {
-                //log the general fitness
-                grid_log << fitnesses[GENERAL_OPT] << " ";
-                //print the others to stdout
-                std::cout << fitnesses[OBSTACLE_OPT] << " ";
-                std::cout << fitnesses[BALL_OPT] << " ";
-                std::cout << fitnesses[GOAL_OPT] << " ";
-                std::cout << fitnesses[LINE_OPT] << " ";
-                std::cout << fitnesses[GENERAL_OPT] << std::endl;
+            candidates.push_back(candidate);
+        }
+        if(!halt) {
+            if(evaluateCandidates(candidates, gt, image_name, m_false_positive_costs, m_false_negative_costs, use_ground_errors)) {
+                for(unsigned int i=0; i<candidates.size(); i++) {
+                    fitnesses = getFitnesses(m_pool->getResults().at(i));
+                    //log the general fitness
+                    grid_log << fitnesses[GENERAL_OPT] << " ";
+                    //print the others to stdout
+                    std::cout << fitnesses[OBSTACLE_OPT] << " ";
+                    std::cout << fitnesses[BALL_OPT] << " ";
+                    std::cout << fitnesses[GOAL_OPT] << " ";
+                    std::cout << fitnesses[LINE_OPT] << " ";
+                    std::cout << fitnesses[GENERAL_OPT] << std::endl;
+                }
             }
             else {
                 std::cout << "failed" << std::endl;
-                break;
             }
         }
         grid_log << std::endl;
@@ -293,6 +305,7 @@ void VisionOptimiser::run(std::string directory, int total_iterations, bool use_
 
     //initialise vision system
     vision->setLUT(directory+std::string("default.lut"));
+    m_pool->setLUT(directory+std::string("default.lut"));
 
     //set the options we need
     setupVisionConstants();
@@ -333,17 +346,17 @@ void VisionOptimiser::run(std::string directory, int total_iterations, bool use_
 
         //print out the best combined parameter set
 #ifdef MULTI_OPT
-        if(VisionConstants::setBallParams(Parameter::getAsVector(m_best_params[BALL_OPT])) &&
-                VisionConstants::setGoalParams(Parameter::getAsVector(m_best_params[GOAL_OPT])) &&
-                VisionConstants::setObstacleParams(Parameter::getAsVector(m_best_params[OBSTACLE_OPT])) &&
-                VisionConstants::setLineParams(Parameter::getAsVector(m_best_params[LINE_OPT])) &&
-                VisionConstants::setGeneralParams(Parameter::getAsVector(m_best_params[GENERAL_OPT]))) {
-            VisionConstants::print(final);
+        if(VisionConstants::get().setBallParams(Parameter::getAsVector(m_best_params[BALL_OPT])) &&
+                VisionConstants::get().setGoalParams(Parameter::getAsVector(m_best_params[GOAL_OPT])) &&
+                VisionConstants::get().setObstacleParams(Parameter::getAsVector(m_best_params[OBSTACLE_OPT])) &&
+                VisionConstants::get().setLineParams(Parameter::getAsVector(m_best_params[LINE_OPT])) &&
+                VisionConstants::get().setGeneralParams(Parameter::getAsVector(m_best_params[GENERAL_OPT]))) {
+            VisionConstants::get().print(final);
         }
 
 #else
-        if(VisionConstants::setAllOptimisable(Parameter::getAsVector(m_best_params))) {
-            VisionConstants::print(final);
+        if(VisionConstants::get().setAllOptimisable(Parameter::getAsVector(m_best_params))) {
+            VisionConstants::get().print(final);
         }
 #endif
         else {
@@ -374,22 +387,16 @@ bool VisionOptimiser::trainingStep(int iteration,
 {
     map<OPT_ID, float> fitnesses;   //a map between fitnesses and optimiser ID
 
-    //init gui
-    ui->progressBar_strm->setMaximum(ground_truth.size());
-    ui->progressBar_strm->setValue(0);
-    //initialise vision stream
-    vision->setImageStream(stream_name);
-
     //get new params
     bool success = true;
 #ifdef MULTI_OPT
-    success = success && VisionConstants::setBallParams(m_optimisers[BALL_OPT]->getNextParameters());
-    success = success && VisionConstants::setGoalParams(m_optimisers[GOAL_OPT]->getNextParameters());
-    success = success && VisionConstants::setObstacleParams(m_optimisers[OBSTACLE_OPT]->getNextParameters());
-    success = success && VisionConstants::setLineParams(m_optimisers[LINE_OPT]->getNextParameters());
-    success = success && VisionConstants::setGeneralParams(m_optimisers[GENERAL_OPT]->getNextParameters());
+    success = success && VisionConstants::get().setBallParams(m_optimisers[BALL_OPT]->getNextParameters());
+    success = success && VisionConstants::get().setGoalParams(m_optimisers[GOAL_OPT]->getNextParameters());
+    success = success && VisionConstants::get().setObstacleParams(m_optimisers[OBSTACLE_OPT]->getNextParameters());
+    success = success && VisionConstants::get().setLineParams(m_optimisers[LINE_OPT]->getNextParameters());
+    success = success && VisionConstants::get().setGeneralParams(m_optimisers[GENERAL_OPT]->getNextParameters());
 #else
-    success = success && VisionConstants::setAllOptimisable(m_optimiser->getNextParameters());
+    success = success && VisionConstants::get().setAllOptimisable(m_optimiser->getNextParameters());
 #endif
     if(!success) {
         QMessageBox::warning(this, "Error", "Failed to set parameters");
@@ -417,19 +424,19 @@ bool VisionOptimiser::trainingStep(int iteration,
         m_optimiser->setParametersResult(fitnesses[GENERAL_OPT]);
         if(fitnesses[GENERAL_OPT] > m_best_fitness) {
             m_best_fitness = fitnesses[GENERAL_OPT];
-            m_best_params = VisionConstants::getAllOptimisable();
+            m_best_params = VisionConstants::get().getAllOptimisable();
         }
 #endif
 
         //write results to logs
 #ifdef MULTI_OPT
-        *(m_individual_progress_logs[BALL_OPT]) << VisionConstants::getBallParams() << std::endl;
-        *(m_individual_progress_logs[GOAL_OPT]) << VisionConstants::getGoalParams() << std::endl;
-        *(m_individual_progress_logs[OBSTACLE_OPT]) << VisionConstants::getObstacleParams() << std::endl;
-        *(m_individual_progress_logs[LINE_OPT]) << VisionConstants::getLineParams() << std::endl;
-        *(m_individual_progress_logs[GENERAL_OPT]) << VisionConstants::getGeneralParams() << std::endl;
+        *(m_individual_progress_logs[BALL_OPT]) << VisionConstants::get().getBallParams() << std::endl;
+        *(m_individual_progress_logs[GOAL_OPT]) << VisionConstants::get().getGoalParams() << std::endl;
+        *(m_individual_progress_logs[OBSTACLE_OPT]) << VisionConstants::get().getObstacleParams() << std::endl;
+        *(m_individual_progress_logs[LINE_OPT]) << VisionConstants::get().getLineParams() << std::endl;
+        *(m_individual_progress_logs[GENERAL_OPT]) << VisionConstants::get().getGeneralParams() << std::endl;
 #else
-        m_progress_log << VisionConstants::getAllOptimisable() << std::endl;
+        m_progress_log << VisionConstants::get().getAllOptimisable() << std::endl;
 #endif
         printResults(iteration, fitnesses, performance_log);
         return true;
@@ -453,55 +460,85 @@ map<VisionOptimiser::OPT_ID, float> VisionOptimiser::evaluateBatch(const std::ve
                                                                    map<VFO_ID, float>& false_pos_costs,
                                                                    map<VFO_ID, float>& false_neg_costs,
                                                                    bool use_ground_errors) const
+{
+    //the frames are shared between the pool's threads, all using the current constants
+    std::vector<VisionConstants> candidates(1, VisionConstants::get());
+    if(!evaluateCandidates(candidates, ground_truth, stream_name, false_pos_costs, false_neg_costs, use_ground_errors))
+        return map<OPT_ID, float>();
+    return getFitnesses(m_pool->getResults().front());
+}
+
+/** @brief Evaluates a set of candidate constants over a frame batch using the pool, keeping the gui responsive.
+*   @param candidates The constants to evaluate.
+*   @param ground_truth The labels to use.
+*   @param stream_name The image stream to use.
+*   @param false_pos_costs A map between field objects and false positive costs.
+*   @param false_neg_costs A map between field objects and false negative costs.
+*   @return Whether every frame was evaluated for every candidate. The evaluations are in m_pool->getResults().
+*/
+bool VisionOptimiser::evaluateCandidates(const std::vector<VisionConstants>& candidates,
+                                         const std::vector<std::vector<VisionFieldObject *> >& ground_truth,
+                                         const std::string& stream_name,
+                                         const map<VFO_ID, float>& false_pos_costs,
+                                         const map<VFO_ID, float>& false_neg_costs,
+                                         bool use_ground_errors) const
+{
+    m_pool->start(candidates, stream_name, ground_truth, false_pos_costs, false_neg_costs, use_ground_errors);
+
+    //init gui
+    ui->progressBar_strm->setMaximum(m_pool->getNumFrames());
+    ui->progressBar_strm->setValue(0);
+    while(!m_pool->wait(50)) {
+        //update gui
+        ui->progressBar_strm->setValue(m_pool->getNumFramesDone());
+        QApplication::processEvents();
+        if(m_halted)
+            m_pool->cancel();
+    }
+    if(m_halted)
+        return false;
+
+    //as when run serially, the batch fails if any frame couldn't be run
+    BOOST_FOREACH(const std::vector<FrameEvaluation>& frames, m_pool->getResults()) {
+        BOOST_FOREACH(const FrameEvaluation& frame, frames) {
+            if(!frame.valid)
+                return false;
+        }
+    }
+    return true;
+}
+
+/** @brief Generates fitnesses from the frame evaluations of one candidate.
+*   @param frames The evaluation of each frame, which are accumulated in order.
+*   @return A map of optimiser IDs to fitnesses.
+*/
+map<VisionOptimiser::OPT_ID, float> VisionOptimiser::getFitnesses(const std::vector<FrameEvaluation>& frames) const
 {
     //initialise batch errors
     map<OPT_ID, float> fitnesses;
     map<OPT_ID, pair<float, int> > batch_errors;
     for(int i=0; i<=GENERAL_OPT; i++)
         batch_errors[getIDFromInt(i)] = pair<float, int>(0,0);
-    unsigned int frame_no = 0;
-    int vision_code;
-
-    //init gui
-    ui->progressBar_strm->setMaximum(ground_truth.size());
-    ui->progressBar_strm->setValue(0);
-    //initialise vision stream
-    vision->setImageStream(stream_name);
-
-    vision_code = vision->runFrame();
-    while(vision_code == 0 && frame_no < ground_truth.size()-1 && !m_halted) {
-        //get errors
-        map<VFO_ID, pair<float, int> > frame_errors = vision->evaluateFrame(ground_truth[frame_no], false_pos_costs, false_neg_costs, use_ground_errors);
 
+    BOOST_FOREACH(const FrameEvaluation& frame, frames) {
         //accumulate errors
         for(int i=0; i<numVFOIDs(); i++) {
             VFO_ID vfo_id = VFOFromInt(i);
             std::vector<OPT_ID>::const_iterator it;
-            //std::cout << VFOName(vfo_id) << " " << frame_errors[vfo_id].first << " " << frame_errors[vfo_id].second << std::endl;
             for(it = m_vfo_optimiser_map.at(vfo_id).begin(); it != m_vfo_optimiser_map.at(vfo_id).end(); it++) {
-                batch_errors.at(*it).first += frame_errors.at(vfo_id).first;
-                batch_errors.at(*it).second += frame_errors.at(vfo_id).second;
+                batch_errors.at(*it).first += frame.errors.at(vfo_id).first;
+                batch_errors.at(*it).second += frame.errors.at(vfo_id).second;
             }
         }
-
-        //update gui
-        ui->progressBar_strm->setValue(frame_no);
-        QApplication::processEvents();
-
-        //next step
-        vision_code = vision->runFrame();
-        frame_no++;
     }
 
     //generate fitnesses from errors
-    if(vision_code==0 && !m_halted) {
-        for(int i=0; i<=GENERAL_OPT; i++) {
-            OPT_ID id = getIDFromInt(i);
-            if(batch_errors[id].first == 0) //not likely but just in case
-                fitnesses[id] = std::numeric_limits<float>::max();
-            else
-                fitnesses[id] = batch_errors[id].second/batch_errors[id].first; // #instances / sum(error)
-        }
+    for(int i=0; i<=GENERAL_OPT; i++) {
+        OPT_ID id = getIDFromInt(i);
+        if(batch_errors[id].first == 0) //not likely but just in case
+            fitnesses[id] = std::numeric_limits<float>::max();
+        else
+            fitnesses[id] = batch_errors[id].second/batch_errors[id].first; // #instances / sum(error)
     }
     return fitnesses;
 }
@@ -516,33 +553,25 @@ map<VisionOptimiser::OPT_ID, pair<double, double> > VisionOptimiser::evaluateBat
     //initialise batch errors
     map<OPT_ID, pair<double, double> > PR;
     map<OPT_ID, Vector3<double> > detection_sum;
-    map<VFO_ID, Vector3<double> > detections;
-    unsigned int frame_no = 0;
-    int vision_code;
+    map<VFO_ID, float> zero_costs;
 
     //initialise accumulator
     for(int i=0; i<=GENERAL_OPT; i++)
         detection_sum[getIDFromInt(i)] = Vector3<double>(0,0,0);
 
-    //initialise vision stream
-    vision->setImageStream(stream_name);
-
-    vision_code = vision->runFrame();
-    while(vision_code == 0 && frame_no < ground_truth.size()-1 && !m_halted) {
-        //get errors
-        detections = vision->precisionRecall(ground_truth[frame_no], use_ground_errors);
-        //accumulate errors
-        for(int i = 0; i < numVFOIDs(); i++) {
-            VFO_ID vfo_id = VFOFromInt(i);
-            std::vector<OPT_ID>::const_iterator it;
-            for(it = m_vfo_optimiser_map.at(vfo_id).begin(); it != m_vfo_optimiser_map.at(vfo_id).end(); it++) {
-                detection_sum.at(*it) += detections.at(vfo_id);
+    //the frames are shared between the pool's threads, all using the current constants
+    std::vector<VisionConstants> candidates(1, VisionConstants::get());
+    if(evaluateCandidates(candidates, ground_truth, stream_name, zero_costs, zero_costs, use_ground_errors)) {
+        BOOST_FOREACH(const FrameEvaluation& frame, m_pool->getResults().front()) {
+            //accumulate errors
+            for(int i = 0; i < numVFOIDs(); i++) {
+                VFO_ID vfo_id = VFOFromInt(i);
+                std::vector<OPT_ID>::const_iterator it;
+                for(it = m_vfo_optimiser_map.at(vfo_id).begin(); it != m_vfo_optimiser_map.at(vfo_id).end(); it++) {
+                    detection_sum.at(*it) += frame.detections.at(vfo_id);
+                }
             }
         }
-
-        //next step
-        vision_code = vision->runFrame();
-        frame_no++;
     }
 
     for(int i=0; i<=GENERAL_OPT; i++) {
@@ -583,26 +612,26 @@ void VisionOptimiser::printResults(int iteration, map<OPT_ID, float> fitnesses,
 */
 void VisionOptimiser::setupVisionConstants()
 {
-    VisionConstants::DO_RADIAL_CORRECTION = false;
+    VisionConstants::get().DO_RADIAL_CORRECTION = false;
     // Goal filtering constants
-    VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_GOALS = false;
-    VisionConstants::THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_GOALS = false;
-    VisionConstants::THROWOUT_DISTANT_GOALS = false;
-    VisionConstants::THROWOUT_INSIGNIFICANT_GOALS = true;
-    VisionConstants::THROWOUT_NARROW_GOALS = true;
-    VisionConstants::THROWOUT_SHORT_GOALS = true;
+    VisionConstants::get().THROWOUT_ON_ABOVE_KIN_HOR_GOALS = false;
+    VisionConstants::get().THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_GOALS = false;
+    VisionConstants::get().THROWOUT_DISTANT_GOALS = false;
+    VisionConstants::get().THROWOUT_INSIGNIFICANT_GOALS = true;
+    VisionConstants::get().THROWOUT_NARROW_GOALS = true;
+    VisionConstants::get().THROWOUT_SHORT_GOALS = true;
     // Ball filtering constants
-    VisionConstants::THROWOUT_ON_ABOVE_KIN_HOR_BALL = false;
-    VisionConstants::THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BALL = false;
-    VisionConstants::THROWOUT_SMALL_BALLS = true;
-    VisionConstants::THROWOUT_INSIGNIFICANT_BALLS = true;
-    VisionConstants::THROWOUT_DISTANT_BALLS = false;
+    VisionConstants::get().THROWOUT_ON_ABOVE_KIN_HOR_BALL = false;
+    VisionConstants::get().THROWOUT_ON_DISTANCE_METHOD_DISCREPENCY_BALL = false;
+    VisionConstants::get().THROWOUT_SMALL_BALLS = true;
+    VisionConstants::get().THROWOUT_INSIGNIFICANT_BALLS = true;
+    VisionConstants::get().THROWOUT_DISTANT_BALLS = false;
     // ScanLine options
-    VisionConstants::HORIZONTAL_SCANLINE_SPACING = 3;
-    VisionConstants::VERTICAL_SCANLINE_SPACING = 3;
-    VisionConstants::GREEN_HORIZON_SCAN_SPACING = 11;
+    VisionConstants::get().HORIZONTAL_SCANLINE_SPACING = 3;
+    VisionConstants::get().VERTICAL_SCANLINE_SPACING = 3;
+    VisionConstants::get().GREEN_HORIZON_SCAN_SPACING = 11;
     // RANSAC constants
-    VisionConstants::LINE_METHOD = RANSAC;
+    VisionConstants::get().LINE_METHOD = RANSAC;
 }
 
 /** @brief Initialises a map of costs for each field object
@@ -674,10 +703,10 @@ void VisionOptimiser::openLogFiles(std::string directory)
 std::vector<Parameter> VisionOptimiser::getParams(OPT_ID id)
 {
     switch(id) {
-    case BALL_OPT: return VisionConstants::getBallParams();
-    case GOAL_OPT: return VisionConstants::getGoalParams();
-    case OBSTACLE_OPT: return VisionConstants::getObstacleParams();
-    case LINE_OPT: return VisionConstants::getLineParams();
-    case GENERAL_OPT: return VisionConstants::getGeneralParams();
+    case BALL_OPT: return VisionConstants::get().getBallParams();
+    case GOAL_OPT: return VisionConstants::get().getGoalParams();
+    case OBSTACLE_OPT: return VisionConstants::get().getObstacleParams();
+    case LINE_OPT: return VisionConstants::get().getLineParams();
+    case GENERAL_OPT: return VisionConstants::get().getGeneralParams();
     }
 }
@@ -4,6 +4,7 @@
 #include <QMainWindow>
 #include "Tools/Optimisation/Optimiser.h"
 #include "Vision/VisionWrapper/visioncontrolwrappertraining.h"
+#include "visionevaluationpool.h"
 
 //uncomment this for multiple optimisers
 #define MULTI_OPT
@@ -58,6 +59,15 @@ private:
                                      map<VFO_ID, float>& false_neg_costs,
                                      bool use_ground_errors) const;
 
+    bool evaluateCandidates(const std::vector<VisionConstants>& candidates,
+                            const std::vector<std::vector<VisionFieldObject *> >& ground_truth,
+                            const std::string& stream_name,
+                            const map<VFO_ID, float>& false_pos_costs,
+                            const map<VFO_ID, float>& false_neg_costs,
+                            bool use_ground_errors) const;
+
+    map<OPT_ID, float> getFitnesses(const std::vector<FrameEvaluation>& frames) const;
+
     map<OPT_ID, pair<double, double> > evaluateBatchPR(const std::vector<std::vector<VisionFieldObject *> >& ground_truth,
                                                        const std::string& stream_name,
                                                        bool ground_errors) const;
@@ -90,6 +100,7 @@ private:
     map<VFO_ID, float> m_false_negative_costs;           //! @var map between field object type and false negative cost.
 
     VisionControlWrapper* vision;   //! @var The vision training wrapper.
+    VisionEvaluationPool* m_pool;   //! @var Threads evaluating candidates in their own vision contexts.
     std::string m_training_image_name,   //! @var The file name for the training batch.
             m_test_image_name;      //! @var The file name for the test batch.
 